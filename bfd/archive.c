@@ -142,6 +142,10 @@ SUBSECTION
 #include "filenames.h"
 #include "bfdlink.h"
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #ifndef errno
 extern int errno;
 #endif
@@ -704,11 +708,12 @@ _bfd_get_elt_at_filepos (bfd *archive, file_ptr filepos,
 	    }
 	  n_bfd->proxy_origin = bfd_tell (archive);
 
-	  /* Copy BFD_COMPRESS, BFD_DECOMPRESS and BFD_COMPRESS_GABI
-	     flags.  */
+	  /* Copy BFD_COMPRESS, BFD_DECOMPRESS, BFD_COMPRESS_GABI and
+	     BFD_COMPRESS_ZSTD flags.  */
 	  n_bfd->flags |= archive->flags & (BFD_COMPRESS
 					    | BFD_DECOMPRESS
-					    | BFD_COMPRESS_GABI);
+					    | BFD_COMPRESS_GABI
+					    | BFD_COMPRESS_ZSTD);
 
 	  return n_bfd;
 	}
@@ -764,10 +769,12 @@ _bfd_get_elt_at_filepos (bfd *archive, file_ptr filepos,
 
   n_bfd->arelt_data = new_areldata;
 
-  /* Copy BFD_COMPRESS, BFD_DECOMPRESS and BFD_COMPRESS_GABI flags.  */
+  /* Copy BFD_COMPRESS, BFD_DECOMPRESS, BFD_COMPRESS_GABI and
+     BFD_COMPRESS_ZSTD flags.  */
   n_bfd->flags |= archive->flags & (BFD_COMPRESS
 				    | BFD_DECOMPRESS
-				    | BFD_COMPRESS_GABI);
+				    | BFD_COMPRESS_GABI
+				    | BFD_COMPRESS_ZSTD);
 
   /* Copy is_linker_input.  */
   n_bfd->is_linker_input = archive->is_linker_input;
@@ -871,6 +878,25 @@ _bfd_noarchive_openr_next_archived_file (bfd *archive,
   return (bfd *) _bfd_ptr_bfd_null_error (archive);
 }
 
+/* Unmap the armap strings of archive ABFD, if they are mapped.  */
+
+static void
+archive_unmap_armap (bfd *abfd)
+{
+#ifdef HAVE_MMAP
+  struct artdata *ardata = bfd_ardata (abfd);
+
+  if (ardata != NULL && ardata->armap_map_addr != NULL)
+    {
+      munmap (ardata->armap_map_addr, ardata->armap_map_len);
+      ardata->armap_map_addr = NULL;
+      ardata->armap_map_len = 0;
+    }
+#else
+  (void) abfd;
+#endif
+}
+
 bfd_cleanup
 bfd_generic_archive_p (bfd *abfd)
 {
@@ -918,6 +944,7 @@ bfd_generic_archive_p (bfd *abfd)
     {
       if (bfd_get_error () != bfd_error_system_call)
 	bfd_set_error (bfd_error_wrong_format);
+      archive_unmap_armap (abfd);
       bfd_release (abfd, bfd_ardata (abfd));
       bfd_ardata (abfd) = tdata_hold;
       return NULL;
@@ -953,6 +980,10 @@ bfd_generic_archive_p (bfd *abfd)
 	}
     }
 
+  /* If this target is not the one chosen in the end, the armap
+     mapping has to be released along with the rest of its tdata.  */
+  if (bfd_ardata (abfd)->armap_map_addr != NULL)
+    return archive_unmap_armap;
   return _bfd_no_cleanup;
 }
 
@@ -973,6 +1004,25 @@ bfd_generic_archive_p (bfd *abfd)
 /* The size of the string count.  */
 #define BSD_STRING_COUNT_SIZE 4
 
+/* Only map a coff armap from the file if its strings take at least
+   this many bytes.  */
+#define ARMAP_MMAP_MIN_SIZE (64 * 1024)
+
+/* Return the date in the archive header MAPDATA of a symbol table.
+   _bfd_compute_and_write_armap only reuses the entries of members
+   that are no newer than this.  */
+
+static long
+armap_header_date (struct areltdata *mapdata)
+{
+  struct ar_hdr *hdr = (struct ar_hdr *) mapdata->arch_header;
+  char buf[sizeof (hdr->ar_date) + 1];
+
+  memcpy (buf, hdr->ar_date, sizeof (hdr->ar_date));
+  buf[sizeof (hdr->ar_date)] = '\0';
+  return strtol (buf, NULL, 10);
+}
+
 /* Read a BSD-style archive symbol table.  Returns FALSE on error,
    TRUE otherwise.  */
 
@@ -992,6 +1042,7 @@ do_slurp_bsd_armap (bfd *abfd)
   if (mapdata == NULL)
     return false;
   parsed_size = mapdata->parsed_size;
+  ardata->armap_date = armap_header_date (mapdata);
   free (mapdata);
   /* PR 17512: file: 883ff754.  */
   /* PR 17512: file: 0458885f.  */
@@ -1083,6 +1134,7 @@ do_slurp_coff_armap (bfd *abfd)
   if (mapdata == NULL)
     return false;
   parsed_size = mapdata->parsed_size;
+  ardata->armap_date = armap_header_date (mapdata);
   free (mapdata);
 
   if (bfd_bread (int_buf, 4, abfd) != 4)
@@ -1120,6 +1172,47 @@ do_slurp_coff_armap (bfd *abfd)
       return false;
     }
 
+#ifdef HAVE_MMAP
+  /* The armap of a large archive can have megabytes of symbol names.
+     Map them rather than copying them if possible.  The strings are
+     used in place, so the last one must already be NUL terminated.  */
+  if (stringsize >= ARMAP_MMAP_MIN_SIZE && filesize != 0)
+    {
+      file_ptr pos = bfd_tell (abfd);
+      void *map_addr;
+      bfd_size_type map_len;
+      char *map = (char *) -1;
+
+      if ((ufile_ptr) pos + ptrsize + stringsize <= filesize)
+	map = (char *) bfd_mmap (abfd, NULL, ptrsize + stringsize,
+				 PROT_READ, MAP_PRIVATE, pos,
+				 &map_addr, &map_len);
+      if (map != (char *) -1)
+	{
+	  if (map[ptrsize + stringsize - 1] == '\0'
+	      && bfd_seek (abfd, pos + ptrsize + stringsize, SEEK_SET) == 0)
+	    {
+	      ardata->symdefs = (struct carsym *) bfd_alloc (abfd,
+							     carsym_size);
+	      if (ardata->symdefs == NULL)
+		{
+		  munmap (map_addr, map_len);
+		  return false;
+		}
+	      ardata->armap_map_addr = map_addr;
+	      ardata->armap_map_len = map_len;
+	      raw_armap = (int *) map;
+	      stringbase = map + ptrsize;
+	      stringend = stringbase + stringsize - 1;
+	      goto build_carsyms;
+	    }
+	  munmap (map_addr, map_len);
+	  if (bfd_seek (abfd, pos, SEEK_SET) != 0)
+	    return false;
+	}
+    }
+#endif
+
   /* Allocate and read in the raw offsets.  */
   raw_armap = (int *) _bfd_malloc_and_read (abfd, ptrsize, ptrsize);
   if (raw_armap == NULL)
@@ -1129,15 +1222,17 @@ do_slurp_coff_armap (bfd *abfd)
 						 carsym_size + stringsize + 1);
   if (ardata->symdefs == NULL)
     goto free_armap;
-  carsyms = ardata->symdefs;
   stringbase = ((char *) ardata->symdefs) + carsym_size;
 
   if (bfd_bread (stringbase, stringsize, abfd) != stringsize)
     goto release_symdefs;
 
-  /* OK, build the carsyms.  */
   stringend = stringbase + stringsize;
   *stringend = 0;
+
+ build_carsyms:
+  /* OK, build the carsyms.  */
+  carsyms = ardata->symdefs;
   for (i = 0; i < nsymz; i++)
     {
       rawptr = raw_armap + i;
@@ -1157,7 +1252,8 @@ do_slurp_coff_armap (bfd *abfd)
     goto release_symdefs;
 
   abfd->has_armap = true;
-  free (raw_armap);
+  if (ardata->armap_map_addr == NULL)
+    free (raw_armap);
 
   /* Check for a second archive header (as used by PE).  */
   tmp = (struct areltdata *) _bfd_read_ar_hdr (abfd);
@@ -1174,6 +1270,11 @@ do_slurp_coff_armap (bfd *abfd)
 
  release_symdefs:
   bfd_release (abfd, (ardata)->symdefs);
+  if (ardata->armap_map_addr != NULL)
+    {
+      archive_unmap_armap (abfd);
+      return false;
+    }
  free_armap:
   free (raw_armap);
   return false;
@@ -2271,6 +2372,143 @@ _bfd_write_archive_contents (bfd *arch)
   return false;
 }
 
+/* The archive symbol table being built by _bfd_compute_and_write_armap.  */
+
+struct armap_build
+{
+  bfd *arch;
+  struct orl *map;
+  unsigned int orl_max;
+  unsigned int orl_count;
+  int stridx;
+
+  /* The input archive whose symbol table was last looked at by
+     find_armap_entries, and whether that table is in member order.  */
+  bfd *old_arch;
+  bool old_map_ordered;
+};
+
+static bool report_plugin_err = true;
+
+/* Add the symbol name at *NAMEP, defined by member CURRENT, to the
+   symbol table in B.  */
+
+static bool
+add_armap_entry (struct armap_build *b, bfd *current, char **namep)
+{
+  const char *name = *namep;
+  size_t amt;
+  struct orl *new_map;
+
+  if (b->orl_count == b->orl_max)
+    {
+      b->orl_max *= 2;
+      amt = b->orl_max * sizeof (struct orl);
+      new_map = (struct orl *) bfd_realloc (b->map, amt);
+      if (new_map == NULL)
+	return false;
+
+      b->map = new_map;
+    }
+
+  if (name[0] == '_'
+      && name[1] == '_'
+      && strcmp (name + (name[2] == '_'), "__gnu_lto_slim") == 0
+      && report_plugin_err)
+    {
+      report_plugin_err = false;
+      _bfd_error_handler
+	(_("%pB: plugin needed to handle lto object"), current);
+    }
+  b->map[b->orl_count].name = namep;
+  b->map[b->orl_count].u.abfd = current;
+  b->map[b->orl_count].namidx = b->stridx;
+
+  b->stridx += strlen (name) + 1;
+  ++b->orl_count;
+  return true;
+}
+
+/* CURRENT is about to be indexed.  If it is an unmodified member of
+   another archive of the same format, and that archive's own symbol
+   table lists it, set *FIRST and *COUNT to its entries there so that
+   its symbols need not be read again.  Only tables written in member
+   order are used, which is how they are always written by BFD.  A
+   member is read anyway, in case it was added or replaced without the
+   table being updated, if it has no entries, if it is dated after the
+   table, or if its size runs into the next member the table lists.  */
+
+static bool
+find_armap_entries (struct armap_build *b, bfd *current,
+		    carsym **first, symindex *count)
+{
+  bfd *old_arch = current->my_archive;
+  struct artdata *ardata;
+  carsym *symdefs;
+  symindex lo, hi, mid;
+  file_ptr pos;
+  struct stat st;
+
+  if (old_arch == NULL
+      || old_arch->xvec != b->arch->xvec
+      || bfd_is_thin_archive (old_arch)
+      || !bfd_has_map (old_arch)
+      || bfd_ardata (old_arch) == NULL
+      || bfd_ardata (old_arch)->symdefs == NULL
+      || current->arelt_data == NULL
+      || arch_eltdata (current)->parent_cache == NULL)
+    return false;
+
+  ardata = bfd_ardata (old_arch);
+  symdefs = ardata->symdefs;
+  if (b->old_arch != old_arch)
+    {
+      b->old_arch = old_arch;
+      b->old_map_ordered = true;
+      for (lo = 1; lo < ardata->symdef_count; lo++)
+	if (symdefs[lo].file_offset < symdefs[lo - 1].file_offset)
+	  {
+	    b->old_map_ordered = false;
+	    break;
+	  }
+    }
+  if (!b->old_map_ordered)
+    return false;
+
+  /* The table gives the position of the member's header.  */
+  pos = arch_eltdata (current)->key;
+  lo = 0;
+  hi = ardata->symdef_count;
+  while (lo < hi)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (symdefs[mid].file_offset < pos)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  for (hi = lo;
+       hi < ardata->symdef_count && symdefs[hi].file_offset == pos;
+       hi++)
+    ;
+  if (hi == lo)
+    return false;
+
+  if (bfd_stat_arch_elt (current, &st) != 0
+      || st.st_mtime > ardata->armap_date)
+    return false;
+  if (hi < ardata->symdef_count
+      && (symdefs[hi].file_offset
+	  < (pos + (file_ptr) sizeof (struct ar_hdr)
+	     + (file_ptr) arch_eltdata (current)->extra_size
+	     + (file_ptr) arch_eltdata (current)->parsed_size)))
+    return false;
+
+  *first = symdefs + lo;
+  *count = hi - lo;
+  return true;
+}
+
 /* Note that the namidx for the first symbol is 0.  */
 
 bool
@@ -2279,24 +2517,23 @@ _bfd_compute_and_write_armap (bfd *arch, unsigned int elength)
   char *first_name = NULL;
   bfd *current;
   file_ptr elt_no = 0;
-  struct orl *map = NULL;
-  unsigned int orl_max = 1024;		/* Fine initial default.  */
-  unsigned int orl_count = 0;
-  int stridx = 0;
+  struct armap_build b;
   asymbol **syms = NULL;
   long syms_max = 0;
   bool ret;
   size_t amt;
-  static bool report_plugin_err = true;
 
   /* Dunno if this is the best place for this info...  */
   if (elength != 0)
     elength += sizeof (struct ar_hdr);
   elength += elength % 2;
 
-  amt = orl_max * sizeof (struct orl);
-  map = (struct orl *) bfd_malloc (amt);
-  if (map == NULL)
+  memset (&b, 0, sizeof (b));
+  b.arch = arch;
+  b.orl_max = 1024;		/* Fine initial default.  */
+  amt = b.orl_max * sizeof (struct orl);
+  b.map = (struct orl *) bfd_malloc (amt);
+  if (b.map == NULL)
     goto error_return;
 
   /* We put the symbol names on the arch objalloc, and then discard
@@ -2315,8 +2552,20 @@ _bfd_compute_and_write_armap (bfd *arch, unsigned int elength)
        current != NULL;
        current = current->archive_next, elt_no++)
     {
-      if (bfd_check_format (current, bfd_object)
-	  && (bfd_get_file_flags (current) & HAS_SYMS) != 0)
+      carsym *old_syms;
+      symindex old_count;
+
+      if (find_armap_entries (&b, current, &old_syms, &old_count))
+	{
+	  /* Use the entries of the archive it came from.  Their names
+	     stay put until that archive is closed, which cannot happen
+	     before CURRENT has been written out.  */
+	  while (old_count-- != 0)
+	    if (!add_armap_entry (&b, current, (char **) &(old_syms++)->name))
+	      goto error_return;
+	}
+      else if (bfd_check_format (current, bfd_object)
+	       && (bfd_get_file_flags (current) & HAS_SYMS) != 0)
 	{
 	  long storage;
 	  long symcount;
@@ -2363,48 +2612,20 @@ _bfd_compute_and_write_armap (bfd *arch, unsigned int elength)
 		      && ! bfd_is_und_section (sec))
 		    {
 		      bfd_size_type namelen;
-		      struct orl *new_map;
+		      char **namep;
 
 		      /* This symbol will go into the archive header.  */
-		      if (orl_count == orl_max)
-			{
-			  orl_max *= 2;
-			  amt = orl_max * sizeof (struct orl);
-			  new_map = (struct orl *) bfd_realloc (map, amt);
-			  if (new_map == NULL)
-			    goto error_return;
-
-			  map = new_map;
-			}
-
-		      if (syms[src_count]->name != NULL
-			  && syms[src_count]->name[0] == '_'
-			  && syms[src_count]->name[1] == '_'
-			  && strcmp (syms[src_count]->name
-				     + (syms[src_count]->name[2] == '_'),
-				     "__gnu_lto_slim") == 0
-			  && report_plugin_err)
-			{
-			  report_plugin_err = false;
-			  _bfd_error_handler
-			    (_("%pB: plugin needed to handle lto object"),
-			     current);
-			}
 		      namelen = strlen (syms[src_count]->name);
 		      amt = sizeof (char *);
-		      map[orl_count].name = (char **) bfd_alloc (arch, amt);
-		      if (map[orl_count].name == NULL)
+		      namep = (char **) bfd_alloc (arch, amt);
+		      if (namep == NULL)
 			goto error_return;
-		      *(map[orl_count].name) = (char *) bfd_alloc (arch,
-								   namelen + 1);
-		      if (*(map[orl_count].name) == NULL)
+		      *namep = (char *) bfd_alloc (arch, namelen + 1);
+		      if (*namep == NULL)
+			goto error_return;
+		      strcpy (*namep, syms[src_count]->name);
+		      if (!add_armap_entry (&b, current, namep))
 			goto error_return;
-		      strcpy (*(map[orl_count].name), syms[src_count]->name);
-		      map[orl_count].u.abfd = current;
-		      map[orl_count].namidx = stridx;
-
-		      stridx += namelen + 1;
-		      ++orl_count;
 		    }
 		}
 	    }
@@ -2418,10 +2639,10 @@ _bfd_compute_and_write_armap (bfd *arch, unsigned int elength)
 
   /* OK, now we have collected all the data, let's write them out.  */
   ret = BFD_SEND (arch, write_armap,
-		  (arch, elength, map, orl_count, stridx));
+		  (arch, elength, b.map, b.orl_count, b.stridx));
 
   free (syms);
-  free (map);
+  free (b.map);
   if (first_name != NULL)
     bfd_release (arch, first_name);
 
@@ -2429,7 +2650,7 @@ _bfd_compute_and_write_armap (bfd *arch, unsigned int elength)
 
  error_return:
   free (syms);
-  free (map);
+  free (b.map);
   if (first_name != NULL)
     bfd_release (arch, first_name);
 
@@ -2871,6 +3092,8 @@ _bfd_archive_close_and_cleanup (bfd *abfd)
       /* Close the archive plugin file descriptor if needed.  */
       if (abfd->archive_plugin_fd > 0)
 	close (abfd->archive_plugin_fd);
+
+      archive_unmap_armap (abfd);
     }
 
   _bfd_unlink_from_archive_parent (abfd);
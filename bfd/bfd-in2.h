@@ -360,7 +360,8 @@ enum compressed_debug_section_type
   COMPRESS_DEBUG_NONE = 0,
   COMPRESS_DEBUG = 1 << 0,
   COMPRESS_DEBUG_GNU_ZLIB = COMPRESS_DEBUG | 1 << 1,
-  COMPRESS_DEBUG_GABI_ZLIB = COMPRESS_DEBUG | 1 << 2
+  COMPRESS_DEBUG_GABI_ZLIB = COMPRESS_DEBUG | 1 << 2,
+  COMPRESS_DEBUG_ZSTD = COMPRESS_DEBUG | 1 << 3
 };
 
 /* This structure is used to keep track of stabs in sections
@@ -973,7 +974,8 @@ typedef struct bfd_section
   unsigned int compress_status : 2;
 #define COMPRESS_SECTION_NONE    0
 #define COMPRESS_SECTION_DONE    1
-#define DECOMPRESS_SECTION_SIZED 2
+#define DECOMPRESS_SECTION_ZLIB  2
+#define DECOMPRESS_SECTION_ZSTD  3
 
   /* The following flags are used by the ELF linker. */
 
@@ -989,6 +991,7 @@ typedef struct bfd_section
 #define SEC_INFO_TYPE_JUST_SYMS 4
 #define SEC_INFO_TYPE_TARGET    5
 #define SEC_INFO_TYPE_EH_FRAME_ENTRY 6
+#define SEC_INFO_TYPE_ICF       7
 
   /* Nonzero if this section uses RELA relocations, rather than REL.  */
   unsigned int use_rela_p:1;
@@ -6483,6 +6486,41 @@ enum bfd_plugin_format
     bfd_plugin_no = 2
   };
 
+/* Types of compressed DWARF debug sections.  The values match the
+   ELFCOMPRESS_* ch_type values of the gABI compression header.  */
+enum compression_type
+  {
+    ch_none = 0,
+    ch_compress_zlib = 1,      /* Compressed with zlib.  */
+    ch_compress_zstd = 2       /* Compressed with zstd (www.zstandard.org).  */
+  };
+
+/* A block of a compressed section that can be decompressed on its
+   own.  See bfd_get_compressed_section_blocks.  */
+struct bfd_compressed_block
+  {
+    /* Offset and size of the compressed data of the block, relative
+       to the start of the compressed section contents.  */
+    bfd_size_type compressed_offset;
+    bfd_size_type compressed_size;
+    /* Offset and size of the block in the uncompressed section.  */
+    bfd_size_type uncompressed_offset;
+    bfd_size_type uncompressed_size;
+    enum compression_type ch_type;
+  };
+
+/* A read-only view of the contents of a section.  See
+   bfd_get_section_contents_view.  */
+struct bfd_section_view
+  {
+    const bfd_byte *contents;
+    bfd_size_type size;
+    /* The page aligned mapping of the file holding CONTENTS, or NULL
+       if CONTENTS was malloc'd.  */
+    void *map_addr;
+    bfd_size_type map_len;
+  };
+
 struct bfd_build_id
   {
     bfd_size_type size;
@@ -6608,17 +6646,21 @@ struct bfd
   /* Put pathnames into archives (non-POSIX).  */
 #define BFD_ARCHIVE_FULL_PATH  0x100000
 
+  /* Compress sections in this BFD with SHF_COMPRESSED zstd.  */
+#define BFD_COMPRESS_ZSTD      0x200000
+
   /* Flags bits to be saved in bfd_preserve_save.  */
 #define BFD_FLAGS_SAVED \
   (BFD_IN_MEMORY | BFD_COMPRESS | BFD_DECOMPRESS | BFD_LINKER_CREATED \
    | BFD_PLUGIN | BFD_COMPRESS_GABI | BFD_CONVERT_ELF_COMMON \
-   | BFD_USE_ELF_STT_COMMON)
+   | BFD_USE_ELF_STT_COMMON | BFD_COMPRESS_ZSTD)
 
   /* Flags bits which are for BFD use only.  */
 #define BFD_FLAGS_FOR_BFD_USE_MASK \
   (BFD_IN_MEMORY | BFD_COMPRESS | BFD_DECOMPRESS | BFD_LINKER_CREATED \
    | BFD_PLUGIN | BFD_TRADITIONAL_FORMAT | BFD_DETERMINISTIC_OUTPUT \
-   | BFD_COMPRESS_GABI | BFD_CONVERT_ELF_COMMON | BFD_USE_ELF_STT_COMMON)
+   | BFD_COMPRESS_GABI | BFD_CONVERT_ELF_COMMON | BFD_USE_ELF_STT_COMMON \
+   | BFD_COMPRESS_ZSTD)
 
   /* The format which belongs to the BFD. (object, core, etc.)  */
   ENUM_BITFIELD (bfd_format) format : 3;
@@ -7236,6 +7278,7 @@ void bfd_update_compression_header
 
 bool bfd_check_compression_header
    (bfd *abfd, bfd_byte *contents, asection *sec,
+    enum compression_type *ch_type,
     bfd_size_type *uncompressed_size,
     unsigned int *uncompressed_alignment_power);
 
@@ -7904,6 +7947,21 @@ bfd_byte *bfd_simple_get_relocated_section_contents
 bool bfd_get_full_section_contents
    (bfd *abfd, asection *section, bfd_byte **ptr);
 
+bool bfd_get_section_contents_view
+   (bfd *abfd, asection *section, struct bfd_section_view *view);
+
+void bfd_release_section_contents_view (struct bfd_section_view *view);
+
+bool bfd_get_compressed_section_blocks
+   (bfd *abfd, asection *section, bfd_byte **compressed_p,
+    struct bfd_compressed_block **blocks_p,
+    unsigned int *count_p);
+
+bool bfd_decompress_section_block
+   (const bfd_byte *compressed,
+    const struct bfd_compressed_block *block,
+    bfd_byte *uncompressed);
+
 void bfd_cache_section_contents
    (asection *sec, void *contents);
 
@@ -7911,7 +7969,8 @@ bool bfd_is_section_compressed_with_header
    (bfd *abfd, asection *section,
     int *compression_header_size_p,
     bfd_size_type *uncompressed_size_p,
-    unsigned int *uncompressed_alignment_power_p);
+    unsigned int *uncompressed_alignment_power_p,
+    enum compression_type *ch_type);
 
 bool bfd_is_section_compressed
    (bfd *abfd, asection *section);
@@ -70,7 +70,10 @@ enum cache_flag {
 static int max_open_files = 0;
 
 /* Set max_open_files, if not already set, to 12.5% of the allowed open
-   file descriptors, but at least 10, and return the value.  */
+   file descriptors, but at least 10, and return the value.  The soft
+   limit on open file descriptors is first raised to the hard limit if
+   possible, since reopening files evicted from a cache that is too
+   small for a large link or debug session is very slow.  */
 static int
 bfd_cache_max_open (void)
 {
@@ -95,6 +98,17 @@ bfd_cache_max_open (void)
 #ifdef HAVE_GETRLIMIT
       struct rlimit rlim;
 
+      if (getrlimit (RLIMIT_NOFILE, &rlim) == 0
+	  && rlim.rlim_cur < rlim.rlim_max
+	  && rlim.rlim_max != (rlim_t) RLIM_INFINITY)
+	{
+	  rlim_t cur = rlim.rlim_cur;
+
+	  rlim.rlim_cur = rlim.rlim_max;
+	  if (setrlimit (RLIMIT_NOFILE, &rlim) != 0)
+	    rlim.rlim_cur = cur;
+	}
+
       if (getrlimit (RLIMIT_NOFILE, &rlim) == 0
 	  && rlim.rlim_cur != (rlim_t) RLIM_INFINITY)
 	max = rlim.rlim_cur / 8;
@@ -182,27 +196,34 @@ bfd_cache_delete (bfd *abfd)
 }
 
 /* We need to open a new file, and the cache is full.  Find the least
-   recently used cacheable BFD and close it.  */
+   recently used cacheable BFD and close it.  BFDs that are not
+   cacheable are never closed here, so any found at the end of the list
+   are moved to just after its head.  That way they are not walked over
+   again on each of the following calls.  */
 
 static bool
 close_one (void)
 {
-  register bfd *to_kill;
+  bfd *to_kill;
+  int count;
 
-  if (bfd_last_cache == NULL)
-    to_kill = NULL;
-  else
+  to_kill = NULL;
+  for (count = open_files; bfd_last_cache != NULL && count > 0; --count)
     {
-      for (to_kill = bfd_last_cache->lru_prev;
-	   ! to_kill->cacheable;
-	   to_kill = to_kill->lru_prev)
+      to_kill = bfd_last_cache->lru_prev;
+      if (to_kill->cacheable)
+	break;
+      if (to_kill == bfd_last_cache)
 	{
-	  if (to_kill == bfd_last_cache)
-	    {
-	      to_kill = NULL;
-	      break;
-	    }
+	  to_kill = NULL;
+	  break;
 	}
+      snip (to_kill);
+      to_kill->lru_prev = bfd_last_cache;
+      to_kill->lru_next = bfd_last_cache->lru_next;
+      to_kill->lru_prev->lru_next = to_kill;
+      to_kill->lru_next->lru_prev = to_kill;
+      to_kill = NULL;
     }
 
   if (to_kill == NULL)
@@ -20,14 +20,28 @@
 
 #include "sysdep.h"
 #include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 #include "bfd.h"
 #include "libbfd.h"
 #include "safe-ctype.h"
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 #define MAX_COMPRESSION_HEADER_SIZE 24
 
+/* The amount of uncompressed data in each zstd frame written by
+   compress_contents.  Each frame records its uncompressed size, so
+   readers can find the frames of a section without decompressing it,
+   and then decompress them independently of each other.  See
+   bfd_get_compressed_section_blocks.  */
+#define ZSTD_FRAME_SIZE ((bfd_size_type) 1 << 20)
+
 static bool
-decompress_contents (bfd_byte *compressed_buffer,
+decompress_contents (bool is_zstd, bfd_byte *compressed_buffer,
 		     bfd_size_type compressed_size,
 		     bfd_byte *uncompressed_buffer,
 		     bfd_size_type uncompressed_size)
@@ -35,6 +49,18 @@ decompress_contents (bfd_byte *compressed_buffer,
   z_stream strm;
   int rc;
 
+  if (is_zstd)
+    {
+#ifdef HAVE_ZSTD
+      /* ZSTD_decompress handles several concatenated frames.  */
+      size_t ret = ZSTD_decompress (uncompressed_buffer, uncompressed_size,
+				    compressed_buffer, compressed_size);
+      return !ZSTD_isError (ret) && ret == uncompressed_size;
+#else
+      return false;
+#endif
+    }
+
   /* It is possible the section consists of several compressed
      buffers concatenated together, so we uncompress in a loop.  */
   /* PR 18313: The state field in the z_stream structure is supposed
@@ -68,10 +94,88 @@ decompress_contents (bfd_byte *compressed_buffer,
   return inflateEnd (&strm) == Z_OK && rc == Z_OK && strm.avail_out == 0;
 }
 
+/* Return the maximum size of UNCOMPRESSED_SIZE bytes of data once
+   compressed with zstd if USE_ZSTD, or with zlib otherwise.  Return 0
+   if the compression method is not supported.  */
+
+static bfd_size_type
+compress_bound (bool use_zstd, bfd_size_type uncompressed_size)
+{
+  if (use_zstd)
+    {
+#ifdef HAVE_ZSTD
+      bfd_size_type frames = uncompressed_size / ZSTD_FRAME_SIZE;
+      bfd_size_type rest = uncompressed_size % ZSTD_FRAME_SIZE;
+
+      return (frames * ZSTD_compressBound (ZSTD_FRAME_SIZE)
+	      + (rest != 0 || frames == 0 ? ZSTD_compressBound (rest) : 0));
+#else
+      return 0;
+#endif
+    }
+
+  return compressBound (uncompressed_size);
+}
+
+/* Compress UNCOMPRESSED_SIZE bytes at UNCOMPRESSED_BUFFER into the
+   *COMPRESSED_SIZE bytes at COMPRESSED_BUFFER, with zstd if USE_ZSTD,
+   or with zlib otherwise.  zstd data is written as a sequence of
+   frames of at most ZSTD_FRAME_SIZE uncompressed bytes each.  On
+   success, return true and set *COMPRESSED_SIZE to the size of the
+   compressed data.  */
+
+static bool
+compress_contents (bool use_zstd, bfd_byte *compressed_buffer,
+		   bfd_size_type *compressed_size,
+		   const bfd_byte *uncompressed_buffer,
+		   bfd_size_type uncompressed_size)
+{
+  if (use_zstd)
+    {
+#ifdef HAVE_ZSTD
+      bfd_size_type in_pos = 0;
+      bfd_size_type out_pos = 0;
+
+      /* ZSTD_compress stores the uncompressed size in each frame
+	 header.  */
+      do
+	{
+	  bfd_size_type len = uncompressed_size - in_pos;
+	  size_t ret;
+
+	  if (len > ZSTD_FRAME_SIZE)
+	    len = ZSTD_FRAME_SIZE;
+	  ret = ZSTD_compress (compressed_buffer + out_pos,
+			       *compressed_size - out_pos,
+			       uncompressed_buffer + in_pos, len,
+			       ZSTD_CLEVEL_DEFAULT);
+	  if (ZSTD_isError (ret))
+	    return false;
+	  in_pos += len;
+	  out_pos += ret;
+	}
+      while (in_pos < uncompressed_size);
+      *compressed_size = out_pos;
+      return true;
+#else
+      return false;
+#endif
+    }
+
+  uLong zlib_size = *compressed_size;
+  if (compress ((Bytef *) compressed_buffer, &zlib_size,
+		(const Bytef *) uncompressed_buffer,
+		uncompressed_size) != Z_OK)
+    return false;
+  *compressed_size = zlib_size;
+  return true;
+}
+
 /* Compress data of the size specified in @var{uncompressed_size}
-   and pointed to by @var{uncompressed_buffer} using zlib and store
-   as the contents field.  This function assumes the contents
-   field was allocated using bfd_malloc() or equivalent.
+   and pointed to by @var{uncompressed_buffer} using zlib, or zstd if
+   BFD_COMPRESS_ZSTD is set, and store as the contents field.  This
+   function assumes the contents field was allocated using bfd_malloc()
+   or equivalent.
 
    Return the uncompressed size if the full section contents is
    compressed successfully.  Otherwise return 0.  */
@@ -81,7 +185,7 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
 			       bfd_byte *uncompressed_buffer,
 			       bfd_size_type uncompressed_size)
 {
-  uLong compressed_size;
+  bfd_size_type compressed_size;
   bfd_byte *buffer;
   bfd_size_type buffer_size;
   bool decompress;
@@ -89,18 +193,52 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
   int orig_compression_header_size;
   bfd_size_type orig_uncompressed_size;
   unsigned int orig_uncompressed_alignment_pow;
+  enum compression_type orig_ch_type;
   int header_size = bfd_get_compression_header_size (abfd, NULL);
   bool compressed
     = bfd_is_section_compressed_with_header (abfd, sec,
 					     &orig_compression_header_size,
 					     &orig_uncompressed_size,
-					     &orig_uncompressed_alignment_pow);
+					     &orig_uncompressed_alignment_pow,
+					     &orig_ch_type);
+  /* zstd is only supported with the ELF compression header.  */
+  bool use_zstd = header_size != 0 && (abfd->flags & BFD_COMPRESS_ZSTD) != 0;
 
   /* Either ELF compression header or the 12-byte, "ZLIB" + 8-byte size,
      overhead in .zdebug* section.  */
   if (!header_size)
      header_size = 12;
 
+  if (compressed
+      && orig_compression_header_size >= 0
+      && (orig_ch_type == ch_compress_zstd) != use_zstd)
+    {
+      /* The compression method changes, so the compressed contents
+	 can't just be moved.  Decompress them first, and compress them
+	 again below.  */
+      int orig_header_size = (orig_compression_header_size != 0
+			      ? orig_compression_header_size : 12);
+
+      buffer = (bfd_byte *) bfd_malloc (orig_uncompressed_size);
+      if (buffer == NULL)
+	return 0;
+      if (!decompress_contents (orig_ch_type == ch_compress_zstd,
+				uncompressed_buffer + orig_header_size,
+				uncompressed_size - orig_header_size,
+				buffer, orig_uncompressed_size))
+	{
+	  bfd_set_error (bfd_error_bad_value);
+	  free (buffer);
+	  return 0;
+	}
+      free (uncompressed_buffer);
+      uncompressed_buffer = buffer;
+      uncompressed_size = orig_uncompressed_size;
+      sec->size = orig_uncompressed_size;
+      bfd_set_section_alignment (sec, orig_uncompressed_alignment_pow);
+      compressed = false;
+    }
+
   if (compressed)
     {
       /* We shouldn't decompress unsupported compressed section.  */
@@ -128,7 +266,15 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
       compressed_size = zlib_size + header_size;
     }
   else
-    compressed_size = compressBound (uncompressed_size) + header_size;
+    {
+      compressed_size = compress_bound (use_zstd, uncompressed_size);
+      if (compressed_size == 0)
+	{
+	  bfd_set_error (bfd_error_invalid_operation);
+	  return 0;
+	}
+      compressed_size += header_size;
+    }
 
   /* Uncompress if it leads to smaller size.  */
   if (compressed && compressed_size > orig_uncompressed_size)
@@ -150,7 +296,8 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
       sec->size = orig_uncompressed_size;
       if (decompress)
 	{
-	  if (!decompress_contents (uncompressed_buffer
+	  if (!decompress_contents (orig_ch_type == ch_compress_zstd,
+				    uncompressed_buffer
 				    + orig_compression_header_size,
 				    zlib_size, buffer, buffer_size))
 	    {
@@ -175,10 +322,10 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
     }
   else
     {
-      if (compress ((Bytef*) buffer + header_size,
-		    &compressed_size,
-		    (const Bytef*) uncompressed_buffer,
-		    uncompressed_size) != Z_OK)
+      compressed_size -= header_size;
+      if (!compress_contents (use_zstd, buffer + header_size,
+			      &compressed_size, uncompressed_buffer,
+			      uncompressed_size))
 	{
 	  bfd_release (abfd, buffer);
 	  bfd_set_error (bfd_error_bad_value);
@@ -209,6 +356,45 @@ bfd_compress_section_contents (bfd *abfd, sec_ptr sec,
   return uncompressed_size;
 }
 
+/* Read the compressed contents of SEC, which must have a compress_status
+   of DECOMPRESS_SECTION_ZLIB or DECOMPRESS_SECTION_ZSTD, into a buffer
+   allocated with bfd_malloc.  Return NULL on error.  */
+
+static bfd_byte *
+read_compressed_contents (bfd *abfd, sec_ptr sec)
+{
+  bfd_size_type save_size;
+  bfd_size_type save_rawsize;
+  unsigned int save_status;
+  bfd_byte *compressed_buffer;
+  bool ret;
+
+  compressed_buffer = (bfd_byte *) bfd_malloc (sec->compressed_size);
+  if (compressed_buffer == NULL)
+    return NULL;
+  save_rawsize = sec->rawsize;
+  save_size = sec->size;
+  save_status = sec->compress_status;
+  /* Clear rawsize, set size to compressed size and set compress_status
+     to COMPRESS_SECTION_NONE.  If the compressed size is bigger than
+     the uncompressed size, bfd_get_section_contents will fail.  */
+  sec->rawsize = 0;
+  sec->size = sec->compressed_size;
+  sec->compress_status = COMPRESS_SECTION_NONE;
+  ret = bfd_get_section_contents (abfd, sec, compressed_buffer,
+				  0, sec->compressed_size);
+  /* Restore rawsize and size.  */
+  sec->rawsize = save_rawsize;
+  sec->size = save_size;
+  sec->compress_status = save_status;
+  if (!ret)
+    {
+      free (compressed_buffer);
+      return NULL;
+    }
+  return compressed_buffer;
+}
+
 /*
 FUNCTION
 	bfd_get_full_section_contents
@@ -232,9 +418,6 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
 {
   bfd_size_type sz;
   bfd_byte *p = *ptr;
-  bool ret;
-  bfd_size_type save_size;
-  bfd_size_type save_rawsize;
   bfd_byte *compressed_buffer;
   unsigned int compression_header_size;
 
@@ -298,27 +481,23 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
       *ptr = p;
       return true;
 
-    case DECOMPRESS_SECTION_SIZED:
+    case DECOMPRESS_SECTION_ZLIB:
+    case DECOMPRESS_SECTION_ZSTD:
+#ifndef HAVE_ZSTD
+      if (sec->compress_status == DECOMPRESS_SECTION_ZSTD)
+	{
+	  _bfd_error_handler
+	    /* xgettext:c-format */
+	    (_("error: %pB(%pA) is compressed with zstd, but BFD was built"
+	       " without zstd support"), abfd, sec);
+	  bfd_set_error (bfd_error_wrong_format);
+	  return false;
+	}
+#endif
       /* Read in the full compressed section contents.  */
-      compressed_buffer = (bfd_byte *) bfd_malloc (sec->compressed_size);
+      compressed_buffer = read_compressed_contents (abfd, sec);
       if (compressed_buffer == NULL)
 	return false;
-      save_rawsize = sec->rawsize;
-      save_size = sec->size;
-      /* Clear rawsize, set size to compressed size and set compress_status
-	 to COMPRESS_SECTION_NONE.  If the compressed size is bigger than
-	 the uncompressed size, bfd_get_section_contents will fail.  */
-      sec->rawsize = 0;
-      sec->size = sec->compressed_size;
-      sec->compress_status = COMPRESS_SECTION_NONE;
-      ret = bfd_get_section_contents (abfd, sec, compressed_buffer,
-				      0, sec->compressed_size);
-      /* Restore rawsize and size.  */
-      sec->rawsize = save_rawsize;
-      sec->size = save_size;
-      sec->compress_status = DECOMPRESS_SECTION_SIZED;
-      if (!ret)
-	goto fail_compressed;
 
       if (p == NULL)
 	p = (bfd_byte *) bfd_malloc (sz);
@@ -330,8 +509,10 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
 	/* Set header size to the zlib header size if it is a
 	   SHF_COMPRESSED section.  */
 	compression_header_size = 12;
-      if (!decompress_contents (compressed_buffer + compression_header_size,
-				sec->compressed_size - compression_header_size, p, sz))
+      if (!decompress_contents (sec->compress_status == DECOMPRESS_SECTION_ZSTD,
+				compressed_buffer + compression_header_size,
+				sec->compressed_size - compression_header_size,
+				p, sz))
 	{
 	  bfd_set_error (bfd_error_bad_value);
 	  if (p != *ptr)
@@ -365,6 +546,257 @@ bfd_get_full_section_contents (bfd *abfd, sec_ptr sec, bfd_byte **ptr)
     }
 }
 
+/*
+FUNCTION
+	bfd_get_section_contents_view
+
+SYNOPSIS
+	bool bfd_get_section_contents_view
+	  (bfd *abfd, asection *section, struct bfd_section_view *view);
+
+DESCRIPTION
+	Make the full contents of @var{section} in BFD @var{abfd}
+	available in @var{view}.  Large sections that are stored
+	uncompressed in the file are mapped read-only from the file
+	rather than copied, otherwise the contents are read as by
+	@code{bfd_get_full_section_contents}.  The view stays valid
+	after @var{abfd} is closed, and must be released with
+	@code{bfd_release_section_contents_view}.
+
+	Return @code{TRUE} on success.  If the section has no contents
+	then this function returns @code{TRUE} but the view is empty.
+*/
+
+bool
+bfd_get_section_contents_view (bfd *abfd, sec_ptr sec,
+			       struct bfd_section_view *view)
+{
+  bfd_byte *p;
+  bfd_size_type sz;
+
+  view->contents = NULL;
+  view->size = 0;
+  view->map_addr = NULL;
+  view->map_len = 0;
+
+  if (abfd->direction != write_direction && sec->rawsize != 0)
+    sz = sec->rawsize;
+  else
+    sz = sec->size;
+  if (sz == 0)
+    return true;
+
+#ifdef HAVE_MMAP
+  /* Only map sections whose contents are read straight from the file,
+     and which are large enough not to waste most of a page.  */
+  if (abfd->direction == read_direction
+      && sec->compress_status == COMPRESS_SECTION_NONE
+      && ((sec->flags & (SEC_HAS_CONTENTS | SEC_IN_MEMORY | SEC_CONSTRUCTOR))
+	  == SEC_HAS_CONTENTS)
+      && (abfd->xvec->_bfd_get_section_contents
+	  == _bfd_generic_get_section_contents))
+    {
+      static bfd_size_type pagesize;
+      ufile_ptr filesize = bfd_get_file_size (abfd);
+
+      if (pagesize == 0)
+	pagesize = getpagesize ();
+
+      /* Mapping past the end of the file would fault on access.  */
+      if (sz >= 4 * pagesize
+	  && sec->filepos >= 0
+	  && (ufile_ptr) sec->filepos <= filesize
+	  && sz <= filesize - sec->filepos)
+	{
+	  void *map_addr;
+	  bfd_size_type map_len;
+	  void *mem = bfd_mmap (abfd, NULL, sz, PROT_READ, MAP_PRIVATE,
+				sec->filepos, &map_addr, &map_len);
+
+	  if (mem != (void *) -1)
+	    {
+	      view->contents = (const bfd_byte *) mem;
+	      view->size = sz;
+	      view->map_addr = map_addr;
+	      view->map_len = map_len;
+	      return true;
+	    }
+	}
+    }
+#endif
+
+  p = NULL;
+  if (!bfd_get_full_section_contents (abfd, sec, &p))
+    return false;
+  view->contents = p;
+  view->size = sz;
+  return true;
+}
+
+/*
+FUNCTION
+	bfd_release_section_contents_view
+
+SYNOPSIS
+	void bfd_release_section_contents_view (struct bfd_section_view *view);
+
+DESCRIPTION
+	Release the memory held by @var{view}, filled in by
+	@code{bfd_get_section_contents_view}, and clear it.
+*/
+
+void
+bfd_release_section_contents_view (struct bfd_section_view *view)
+{
+#ifdef HAVE_MMAP
+  if (view->map_addr != NULL)
+    munmap (view->map_addr, view->map_len);
+  else
+#endif
+    free ((void *) view->contents);
+  view->contents = NULL;
+  view->size = 0;
+  view->map_addr = NULL;
+  view->map_len = 0;
+}
+
+/*
+FUNCTION
+	bfd_get_compressed_section_blocks
+
+SYNOPSIS
+	bool bfd_get_compressed_section_blocks
+	  (bfd *abfd, asection *section, bfd_byte **compressed_p,
+	   struct bfd_compressed_block **blocks_p,
+	   unsigned int *count_p);
+
+DESCRIPTION
+	If @var{section} in BFD @var{abfd} is compressed as a sequence
+	of blocks that can be decompressed independently, read its
+	compressed contents into @var{*compressed_p} and store an array
+	describing the blocks, in increasing address order, in
+	@var{*blocks_p} and the number of blocks in @var{*count_p}.
+	Both buffers are malloc'd by this function.  The blocks can then
+	be decompressed in any order, and concurrently, with
+	@code{bfd_decompress_section_block}.
+
+	Currently only zstd compressed sections made of several frames
+	whose headers record their uncompressed size, as written by
+	@code{bfd_compress_section_contents}, are split into blocks.
+
+	Return @code{TRUE} if the section was split.  Otherwise, or on
+	error, return @code{FALSE}; @code{bfd_get_full_section_contents}
+	must then be used to read the whole section.
+*/
+
+bool
+bfd_get_compressed_section_blocks (bfd *abfd ATTRIBUTE_UNUSED,
+				   sec_ptr sec ATTRIBUTE_UNUSED,
+				   bfd_byte **compressed_p ATTRIBUTE_UNUSED,
+				   struct bfd_compressed_block **blocks_p
+				     ATTRIBUTE_UNUSED,
+				   unsigned int *count_p ATTRIBUTE_UNUSED)
+{
+#ifdef HAVE_ZSTD
+  bfd_byte *compressed_buffer;
+  struct bfd_compressed_block *blocks = NULL;
+  unsigned int count = 0;
+  unsigned int alloc = 0;
+  bfd_size_type pos;
+  bfd_size_type uncompressed_offset = 0;
+
+  if (sec->compress_status != DECOMPRESS_SECTION_ZSTD)
+    return false;
+
+  compressed_buffer = read_compressed_contents (abfd, sec);
+  if (compressed_buffer == NULL)
+    return false;
+
+  /* zstd is only used with the ELF compression header.  */
+  for (pos = bfd_get_compression_header_size (abfd, sec);
+       pos < sec->compressed_size;
+       pos += blocks[count++].compressed_size)
+    {
+      const bfd_byte *frame = compressed_buffer + pos;
+      size_t avail = sec->compressed_size - pos;
+      size_t frame_size = ZSTD_findFrameCompressedSize (frame, avail);
+      unsigned long long content_size
+	= ZSTD_getFrameContentSize (frame, avail);
+
+      if (ZSTD_isError (frame_size)
+	  || content_size == ZSTD_CONTENTSIZE_UNKNOWN
+	  || content_size == ZSTD_CONTENTSIZE_ERROR
+	  || content_size > sec->size - uncompressed_offset)
+	goto fail;
+
+      if (count == alloc)
+	{
+	  struct bfd_compressed_block *new_blocks;
+
+	  alloc = alloc == 0 ? 16 : alloc * 2;
+	  new_blocks = (struct bfd_compressed_block *)
+	    bfd_realloc (blocks, alloc * sizeof (*blocks));
+	  if (new_blocks == NULL)
+	    goto fail;
+	  blocks = new_blocks;
+	}
+      blocks[count].ch_type = ch_compress_zstd;
+      blocks[count].compressed_offset = pos;
+      blocks[count].compressed_size = frame_size;
+      blocks[count].uncompressed_offset = uncompressed_offset;
+      blocks[count].uncompressed_size = content_size;
+      uncompressed_offset += content_size;
+    }
+
+  /* A single block has nothing to gain over
+     bfd_get_full_section_contents.  */
+  if (count < 2 || uncompressed_offset != sec->size)
+    goto fail;
+
+  *compressed_p = compressed_buffer;
+  *blocks_p = blocks;
+  *count_p = count;
+  return true;
+
+ fail:
+  free (blocks);
+  free (compressed_buffer);
+#endif
+  return false;
+}
+
+/*
+FUNCTION
+	bfd_decompress_section_block
+
+SYNOPSIS
+	bool bfd_decompress_section_block
+	  (const bfd_byte *compressed,
+	   const struct bfd_compressed_block *block,
+	   bfd_byte *uncompressed);
+
+DESCRIPTION
+	Decompress @var{block} of the compressed section contents
+	@var{compressed}, as returned by
+	@code{bfd_get_compressed_section_blocks}, into the
+	@code{uncompressed_size} bytes of @var{block} at
+	@var{uncompressed}.  This function does not access any BFD and
+	may be called from several threads at once.
+
+	Return @code{TRUE} on success.
+*/
+
+bool
+bfd_decompress_section_block (const bfd_byte *compressed,
+			      const struct bfd_compressed_block *block,
+			      bfd_byte *uncompressed)
+{
+  return decompress_contents (block->ch_type == ch_compress_zstd,
+			      (bfd_byte *) compressed + block->compressed_offset,
+			      block->compressed_size, uncompressed,
+			      block->uncompressed_size);
+}
+
 /*
 FUNCTION
 	bfd_cache_section_contents
@@ -381,7 +813,8 @@ DESCRIPTION
 void
 bfd_cache_section_contents (asection *sec, void *contents)
 {
-  if (sec->compress_status == DECOMPRESS_SECTION_SIZED)
+  if (sec->compress_status == DECOMPRESS_SECTION_ZLIB
+      || sec->compress_status == DECOMPRESS_SECTION_ZSTD)
     sec->compress_status = COMPRESS_SECTION_DONE;
   sec->contents = contents;
   sec->flags |= SEC_IN_MEMORY;
@@ -396,23 +829,26 @@ SYNOPSIS
 	  (bfd *abfd, asection *section,
 	  int *compression_header_size_p,
 	  bfd_size_type *uncompressed_size_p,
-	  unsigned int *uncompressed_alignment_power_p);
+	  unsigned int *uncompressed_alignment_power_p,
+	  enum compression_type *ch_type);
 
 DESCRIPTION
 	Return @code{TRUE} if @var{section} is compressed.  Compression
 	header size is returned in @var{compression_header_size_p},
-	uncompressed size is returned in @var{uncompressed_size_p}
-	and the uncompressed data alignement power is returned in
-	@var{uncompressed_align_pow_p}.  If compression is
-	unsupported, compression header size is returned with -1
-	and uncompressed size is returned with 0.
+	uncompressed size is returned in @var{uncompressed_size_p},
+	the uncompressed data alignement power is returned in
+	@var{uncompressed_align_pow_p} and the compression type is
+	returned in @var{ch_type}.  If compression is unsupported,
+	compression header size is returned with -1 and uncompressed
+	size is returned with 0.
 */
 
 bool
 bfd_is_section_compressed_with_header (bfd *abfd, sec_ptr sec,
 				       int *compression_header_size_p,
 				       bfd_size_type *uncompressed_size_p,
-				       unsigned int *uncompressed_align_pow_p)
+				       unsigned int *uncompressed_align_pow_p,
+				       enum compression_type *ch_type)
 {
   bfd_byte header[MAX_COMPRESSION_HEADER_SIZE];
   int compression_header_size;
@@ -421,6 +857,7 @@ bfd_is_section_compressed_with_header (bfd *abfd, sec_ptr sec,
   bool compressed;
 
   *uncompressed_align_pow_p = 0;
+  *ch_type = ch_none;
 
   compression_header_size = bfd_get_compression_header_size (abfd, sec);
   if (compression_header_size > MAX_COMPRESSION_HEADER_SIZE)
@@ -448,7 +885,7 @@ bfd_is_section_compressed_with_header (bfd *abfd, sec_ptr sec,
     {
       if (compression_header_size != 0)
 	{
-	  if (!bfd_check_compression_header (abfd, header, sec,
+	  if (!bfd_check_compression_header (abfd, header, sec, ch_type,
 					     uncompressed_size_p,
 					     uncompressed_align_pow_p))
 	    compression_header_size = -1;
@@ -461,7 +898,10 @@ bfd_is_section_compressed_with_header (bfd *abfd, sec_ptr sec,
 	       && ISPRINT (header[4]))
 	compressed = false;
       else
-	*uncompressed_size_p = bfd_getb64 (header + 4);
+	{
+	  *uncompressed_size_p = bfd_getb64 (header + 4);
+	  *ch_type = ch_compress_zlib;
+	}
     }
 
   /* Restore compress_status.  */
@@ -488,10 +928,12 @@ bfd_is_section_compressed (bfd *abfd, sec_ptr sec)
   int compression_header_size;
   bfd_size_type uncompressed_size;
   unsigned int uncompressed_align_power;
+  enum compression_type ch_type;
   return (bfd_is_section_compressed_with_header (abfd, sec,
 						 &compression_header_size,
 						 &uncompressed_size,
-						 &uncompressed_align_power)
+						 &uncompressed_align_power,
+						 &ch_type)
 	  && compression_header_size >= 0
 	  && uncompressed_size > 0);
 }
@@ -507,7 +949,7 @@ SYNOPSIS
 DESCRIPTION
 	Record compressed section size, update section size with
 	decompressed size and set compress_status to
-	DECOMPRESS_SECTION_SIZED.
+	DECOMPRESS_SECTION_ZLIB or DECOMPRESS_SECTION_ZSTD.
 
 	Return @code{FALSE} if the section is not a valid compressed
 	section.  Otherwise, return @code{TRUE}.
@@ -521,6 +963,7 @@ bfd_init_section_decompress_status (bfd *abfd, sec_ptr sec)
   int header_size;
   bfd_size_type uncompressed_size;
   unsigned int uncompressed_alignment_power = 0;
+  enum compression_type ch_type;
   z_stream strm;
 
   compression_header_size = bfd_get_compression_header_size (abfd, sec);
@@ -548,8 +991,9 @@ bfd_init_section_decompress_status (bfd *abfd, sec_ptr sec)
 	  return false;
 	}
       uncompressed_size = bfd_getb64 (header + 4);
+      ch_type = ch_compress_zlib;
     }
-  else if (!bfd_check_compression_header (abfd, header, sec,
+  else if (!bfd_check_compression_header (abfd, header, sec, &ch_type,
 					  &uncompressed_size,
 					  &uncompressed_alignment_power))
     {
@@ -557,10 +1001,12 @@ bfd_init_section_decompress_status (bfd *abfd, sec_ptr sec)
       return false;
     }
 
-  /* PR28530, reject sizes unsupported by decompress_contents.  */
+  /* PR28530, reject sizes unsupported by decompress_contents.  zstd
+     has no such limitation.  */
   strm.avail_in = sec->size;
   strm.avail_out = uncompressed_size;
-  if (strm.avail_in != sec->size || strm.avail_out != uncompressed_size)
+  if (ch_type == ch_compress_zlib
+      && (strm.avail_in != sec->size || strm.avail_out != uncompressed_size))
     {
       bfd_set_error (bfd_error_nonrepresentable_section);
       return false;
@@ -569,7 +1015,8 @@ bfd_init_section_decompress_status (bfd *abfd, sec_ptr sec)
   sec->compressed_size = sec->size;
   sec->size = uncompressed_size;
   bfd_set_section_alignment (sec, uncompressed_alignment_power);
-  sec->compress_status = DECOMPRESS_SECTION_SIZED;
+  sec->compress_status = (ch_type == ch_compress_zstd
+			 ? DECOMPRESS_SECTION_ZSTD : DECOMPRESS_SECTION_ZLIB);
 
   return true;
 }
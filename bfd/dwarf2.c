@@ -237,6 +237,15 @@ struct dwarf2_debug_file
   struct trie_node *trie_root;
 };
 
+/* A debug section whose contents are mapped from the file rather
+   than read into a malloc'd buffer.  */
+
+struct dwarf2_mapped_section
+{
+  struct bfd_section_view view;
+  struct dwarf2_mapped_section *next;
+};
+
 struct dwarf2_debug
 {
   /* Names of the debug sections.  */
@@ -274,6 +283,13 @@ struct dwarf2_debug
 
 #define STASH_INFO_HASH_TRIGGER    100
 
+  /* Number of times find_nearest_line is called without a symbol.
+     Once this reaches STASH_READ_ALL_TRIGGER, all remaining comp units
+     are read in one go so that the address trie is complete.  */
+  int find_nearest_line_count;
+
+#define STASH_READ_ALL_TRIGGER     100
+
   /* Hash table mapping symbol names to function infos.  */
   struct info_hash_table *funcinfo_hash_table;
 
@@ -291,6 +307,9 @@ struct dwarf2_debug
 
   /* True if we opened bfd_ptr.  */
   bool close_on_cleanup;
+
+  /* Sections read by read_section whose contents are mapped.  */
+  struct dwarf2_mapped_section *mapped_sections;
 };
 
 struct arange
@@ -367,6 +386,14 @@ struct comp_unit
   /* Number of functions in the function_table and sorted_function_table.  */
   bfd_size_type number_of_functions;
 
+  /* The function found by the last lookup_address_in_function_table,
+     and the range of addresses for which it is the best fit.
+     Disassemblers look up increasing addresses, so the next lookup
+     will usually be in the same range.  */
+  struct funcinfo *cached_func;
+  bfd_vma cached_func_low;
+  bfd_vma cached_func_high;
+
   /* A list of the variables found in this comp. unit.  */
   struct varinfo *variable_table;
 
@@ -624,14 +651,79 @@ lookup_info_hash_table (struct info_hash_table *hash_table, const char *key)
   return entry ? entry->head : NULL;
 }
 
+/* Try to map the contents of MSEC, SIZE bytes, from the file instead
+   of copying them.  Return the contents, or NULL if the section could
+   not be mapped; the contents are then read by read_section.  */
+
+static bfd_byte *
+map_section (struct dwarf2_debug *stash, bfd *abfd, asection *msec,
+	     bfd_size_type size)
+{
+  struct dwarf2_mapped_section *mapped;
+  bfd_byte *contents;
+
+  mapped = (struct dwarf2_mapped_section *) bfd_malloc (sizeof (*mapped));
+  if (mapped == NULL)
+    return NULL;
+  if (!bfd_get_section_contents_view (abfd, msec, &mapped->view)
+      || mapped->view.size != size)
+    {
+      bfd_release_section_contents_view (&mapped->view);
+      free (mapped);
+      return NULL;
+    }
+
+  if (mapped->view.map_addr == NULL)
+    {
+      /* The contents were read after all.  Make room for the NUL that
+	 read_section adds.  */
+      contents = (bfd_byte *) bfd_realloc ((void *) mapped->view.contents,
+					   size + 1);
+      if (contents == NULL)
+	bfd_release_section_contents_view (&mapped->view);
+      else
+	contents[size] = 0;
+      free (mapped);
+      return contents;
+    }
+
+  /* Code reading strings from the section relies on a terminating NUL,
+     which can't be added to a read-only mapping.  */
+  if (mapped->view.contents[size - 1] != 0)
+    {
+      bfd_release_section_contents_view (&mapped->view);
+      free (mapped);
+      return NULL;
+    }
+
+  mapped->next = stash->mapped_sections;
+  stash->mapped_sections = mapped;
+  return (bfd_byte *) mapped->view.contents;
+}
+
+/* Free the contents of a section read by read_section.  */
+
+static void
+free_section_buffer (struct dwarf2_debug *stash, bfd_byte *buffer)
+{
+  struct dwarf2_mapped_section *mapped;
+
+  for (mapped = stash->mapped_sections; mapped; mapped = mapped->next)
+    if (mapped->view.contents == buffer)
+      return;
+  free (buffer);
+}
+
 /* Read a section into its appropriate place in the dwarf2_debug
    struct (indicated by SECTION_BUFFER and SECTION_SIZE).  If SYMS is
    not NULL, use bfd_simple_get_relocated_section_contents to read the
-   section contents, otherwise use bfd_get_section_contents.  Fail if
-   the located section does not contain at least OFFSET bytes.  */
+   section contents, otherwise map the section if possible or else use
+   bfd_get_section_contents.  Fail if the located section does not
+   contain at least OFFSET bytes.  */
 
 static bool
-read_section (bfd *abfd,
+read_section (struct dwarf2_debug *stash,
+	      bfd *abfd,
 	      const struct dwarf_debug_section *sec,
 	      asymbol **syms,
 	      uint64_t offset,
@@ -686,18 +778,24 @@ read_section (bfd *abfd,
 	  bfd_set_error (bfd_error_no_memory);
 	  return false;
 	}
-      contents = (bfd_byte *) bfd_malloc (amt);
+      if (syms == NULL && *section_size != 0)
+	contents = map_section (stash, abfd, msec, *section_size);
       if (contents == NULL)
-	return false;
-      if (syms
-	  ? !bfd_simple_get_relocated_section_contents (abfd, msec, contents,
-							syms)
-	  : !bfd_get_section_contents (abfd, msec, contents, 0, *section_size))
 	{
-	  free (contents);
-	  return false;
+	  contents = (bfd_byte *) bfd_malloc (amt);
+	  if (contents == NULL)
+	    return false;
+	  if (syms
+	      ? !bfd_simple_get_relocated_section_contents (abfd, msec,
+							    contents, syms)
+	      : !bfd_get_section_contents (abfd, msec, contents, 0,
+					   *section_size))
+	    {
+	      free (contents);
+	      return false;
+	    }
+	  contents[*section_size] = 0;
 	}
-      contents[*section_size] = 0;
       *section_buffer = contents;
     }
 
@@ -863,7 +961,7 @@ read_indirect_string (struct comp_unit *unit,
   else
     offset = read_8_bytes (unit->abfd, ptr, buf_end);
 
-  if (! read_section (unit->abfd, &stash->debug_sections[debug_str],
+  if (! read_section (stash, unit->abfd, &stash->debug_sections[debug_str],
 		      file->syms, offset,
 		      &file->dwarf_str_buffer, &file->dwarf_str_size))
     return NULL;
@@ -897,7 +995,7 @@ read_indirect_line_string (struct comp_unit *unit,
   else
     offset = read_8_bytes (unit->abfd, ptr, buf_end);
 
-  if (! read_section (unit->abfd, &stash->debug_sections[debug_line_str],
+  if (! read_section (stash, unit->abfd, &stash->debug_sections[debug_line_str],
 		      file->syms, offset,
 		      &file->dwarf_line_str_buffer,
 		      &file->dwarf_line_str_size))
@@ -955,7 +1053,7 @@ read_alt_indirect_string (struct comp_unit *unit,
       stash->alt.bfd_ptr = debug_bfd;
     }
 
-  if (! read_section (unit->stash->alt.bfd_ptr,
+  if (! read_section (stash, unit->stash->alt.bfd_ptr,
 		      stash->debug_sections + debug_str_alt,
 		      stash->alt.syms, offset,
 		      &stash->alt.dwarf_str_buffer,
@@ -1000,7 +1098,7 @@ read_alt_indirect_ref (struct comp_unit *unit, uint64_t offset)
       stash->alt.bfd_ptr = debug_bfd;
     }
 
-  if (! read_section (unit->stash->alt.bfd_ptr,
+  if (! read_section (stash, unit->stash->alt.bfd_ptr,
 		      stash->debug_sections + debug_info_alt,
 		      stash->alt.syms, offset,
 		      &stash->alt.dwarf_info_buffer,
@@ -1151,7 +1249,7 @@ read_abbrevs (bfd *abfd, uint64_t offset, struct dwarf2_debug *stash,
   if (*slot != NULL)
     return ((struct abbrev_offset_entry *) (*slot))->abbrevs;
 
-  if (! read_section (abfd, &stash->debug_sections[debug_abbrev],
+  if (! read_section (stash, abfd, &stash->debug_sections[debug_abbrev],
 		      file->syms, offset,
 		      &file->dwarf_abbrev_buffer,
 		      &file->dwarf_abbrev_size))
@@ -1364,7 +1462,7 @@ read_indexed_address (uint64_t idx, struct comp_unit *unit)
   if (stash == NULL)
     return 0;
 
-  if (!read_section (unit->abfd, &stash->debug_sections[debug_addr],
+  if (!read_section (stash, unit->abfd, &stash->debug_sections[debug_addr],
 		     file->syms, 0,
 		     &file->dwarf_addr_buffer, &file->dwarf_addr_size))
     return 0;
@@ -1402,12 +1500,13 @@ read_indexed_string (uint64_t idx, struct comp_unit *unit)
   if (stash == NULL)
     return NULL;
 
-  if (!read_section (unit->abfd, &stash->debug_sections[debug_str],
+  if (!read_section (stash, unit->abfd, &stash->debug_sections[debug_str],
 		     file->syms, 0,
 		     &file->dwarf_str_buffer, &file->dwarf_str_size))
     return NULL;
 
-  if (!read_section (unit->abfd, &stash->debug_sections[debug_str_offsets],
+  if (!read_section (stash, unit->abfd,
+		     &stash->debug_sections[debug_str_offsets],
 		     file->syms, 0,
 		     &file->dwarf_str_offsets_buffer,
 		     &file->dwarf_str_offsets_size))
@@ -1740,6 +1839,11 @@ struct line_info_table
   struct fileinfo*	files;
   struct line_sequence* sequences;
   struct line_info*	lcl_head;   /* Local head; used in 'add_line_info'.  */
+
+  /* The sequence and index in its line_info_lookup of the entry found
+     by the last lookup_address_in_line_info_table.  */
+  struct line_sequence* cursor_seq;
+  unsigned int		cursor_line;
 };
 
 /* Remember some information about each function.  If the function is
@@ -2614,7 +2718,7 @@ decode_line_info (struct comp_unit *unit)
   if (unit->line_offset == 0 && file->line_table)
     return file->line_table;
 
-  if (! read_section (abfd, &stash->debug_sections[debug_line],
+  if (! read_section (stash, abfd, &stash->debug_sections[debug_line],
 		      file->syms, unit->line_offset,
 		      &file->dwarf_line_buffer, &file->dwarf_line_size))
     return NULL;
@@ -2752,6 +2856,9 @@ decode_line_info (struct comp_unit *unit)
 
   table->lcl_head = NULL;
 
+  table->cursor_seq = NULL;
+  table->cursor_line = 0;
+
   if (lh.version >= 5)
     {
       /* Read directory table.  */
@@ -3009,27 +3116,51 @@ lookup_address_in_line_info_table (struct line_info_table *table,
   struct line_info *info;
   int low, high, mid;
 
-  /* Binary search the array of sequences.  */
-  low = 0;
-  high = table->num_sequences;
-  while (low < high)
-    {
-      mid = (low + high) / 2;
-      seq = &table->sequences[mid];
-      if (addr < seq->low_pc)
-	high = mid;
-      else if (addr >= seq->last_line->address)
-	low = mid + 1;
-      else
-	break;
+  /* sort_line_sequences leaves the sequences disjoint, so if ADDR is
+     in the sequence of the previous lookup there is no need to search
+     for it.  Within the sequence, try the previous entry and the one
+     after it before searching, since successive lookups are usually
+     for increasing nearby addresses.  */
+  seq = table->cursor_seq;
+  if (seq != NULL
+      && addr >= seq->low_pc
+      && addr < seq->last_line->address)
+    {
+      for (mid = table->cursor_line;
+	   mid <= (int) table->cursor_line + 1 && mid + 1 < (int) seq->num_lines;
+	   mid++)
+	{
+	  info = seq->line_info_lookup[mid];
+	  if (addr >= info->address
+	      && addr < seq->line_info_lookup[mid + 1]->address)
+	    goto found;
+	}
     }
+  else
+    {
+      /* Binary search the array of sequences.  */
+      seq = NULL;
+      low = 0;
+      high = table->num_sequences;
+      while (low < high)
+	{
+	  mid = (low + high) / 2;
+	  seq = &table->sequences[mid];
+	  if (addr < seq->low_pc)
+	    high = mid;
+	  else if (addr >= seq->last_line->address)
+	    low = mid + 1;
+	  else
+	    break;
+	}
 
-  /* Check for a valid sequence.  */
-  if (!seq || addr < seq->low_pc || addr >= seq->last_line->address)
-    goto fail;
+      /* Check for a valid sequence.  */
+      if (!seq || addr < seq->low_pc || addr >= seq->last_line->address)
+	goto fail;
 
-  if (!build_line_info_table (table, seq))
-    goto fail;
+      if (!build_line_info_table (table, seq))
+	goto fail;
+    }
 
   /* Binary search the array of line information.  */
   low = 0;
@@ -3050,9 +3181,14 @@ lookup_address_in_line_info_table (struct line_info_table *table,
   /* Check for a valid line information entry.  */
   if (info
       && addr >= info->address
-      && addr < seq->line_info_lookup[mid + 1]->address
-      && !(info->end_sequence || info == seq->last_line))
+      && addr < seq->line_info_lookup[mid + 1]->address)
     {
+    found:
+      table->cursor_seq = seq;
+      table->cursor_line = mid;
+      if (info->end_sequence || info == seq->last_line)
+	goto fail;
+
       *filename_ptr = info->filename;
       *linenumber_ptr = info->line;
       if (discriminator_ptr)
@@ -3073,7 +3209,7 @@ read_debug_ranges (struct comp_unit * unit)
   struct dwarf2_debug *stash = unit->stash;
   struct dwarf2_debug_file *file = unit->file;
 
-  return read_section (unit->abfd, &stash->debug_sections[debug_ranges],
+  return read_section (stash, unit->abfd, &stash->debug_sections[debug_ranges],
 		       file->syms, 0,
 		       &file->dwarf_ranges_buffer, &file->dwarf_ranges_size);
 }
@@ -3086,7 +3222,8 @@ read_debug_rnglists (struct comp_unit * unit)
   struct dwarf2_debug *stash = unit->stash;
   struct dwarf2_debug_file *file = unit->file;
 
-  return read_section (unit->abfd, &stash->debug_sections[debug_rnglists],
+  return read_section (stash, unit->abfd,
+		       &stash->debug_sections[debug_rnglists],
 		       file->syms, 0,
 		       &file->dwarf_rnglists_buffer, &file->dwarf_rnglists_size);
 }
@@ -3197,12 +3334,21 @@ lookup_address_in_function_table (struct comp_unit *unit,
   struct funcinfo* funcinfo = NULL;
   struct funcinfo* best_fit = NULL;
   bfd_vma best_fit_len = 0;
+  bfd_vma fit_low, fit_high;
   bfd_size_type low, high, mid, first;
   struct arange *arange;
 
   if (number_of_functions == 0)
     return false;
 
+  if (unit->cached_func != NULL
+      && addr >= unit->cached_func_low
+      && addr < unit->cached_func_high)
+    {
+      *function_ptr = unit->cached_func;
+      return true;
+    }
+
   if (!build_lookup_funcinfo_table (unit))
     return false;
 
@@ -3226,6 +3372,15 @@ lookup_address_in_function_table (struct comp_unit *unit,
 	high = first = mid;
     }
 
+  /* FIT_LOW and FIT_HIGH track the range around ADDR in which the
+     same ranges contain the address, and so the best match is the
+     same.  Functions before FIRST end at or before its high water
+     mark.  */
+  fit_low = 0;
+  if (first > 0 && first < number_of_functions)
+    fit_low = unit->lookup_funcinfo_table[first - 1].high_addr;
+  fit_high = (bfd_vma) -1;
+
   /* Find the 'best' match for the address.  The prior algorithm defined the
      best match as the function with the smallest address range containing
      the specified address.  This definition should probably be changed to the
@@ -3234,13 +3389,31 @@ lookup_address_in_function_table (struct comp_unit *unit,
   while (first < number_of_functions)
     {
       if (addr < unit->lookup_funcinfo_table[first].low_addr)
-	break;
+	{
+	  if (unit->lookup_funcinfo_table[first].low_addr < fit_high)
+	    fit_high = unit->lookup_funcinfo_table[first].low_addr;
+	  break;
+	}
       funcinfo = unit->lookup_funcinfo_table[first].funcinfo;
 
       for (arange = &funcinfo->arange; arange; arange = arange->next)
 	{
-	  if (addr < arange->low || addr >= arange->high)
-	    continue;
+	  if (addr < arange->low)
+	    {
+	      if (arange->low < fit_high)
+		fit_high = arange->low;
+	      continue;
+	    }
+	  if (addr >= arange->high)
+	    {
+	      if (arange->high > fit_low)
+		fit_low = arange->high;
+	      continue;
+	    }
+	  if (arange->low > fit_low)
+	    fit_low = arange->low;
+	  if (arange->high < fit_high)
+	    fit_high = arange->high;
 
 	  if (!best_fit
 	      || arange->high - arange->low < best_fit_len
@@ -3261,6 +3434,9 @@ lookup_address_in_function_table (struct comp_unit *unit,
   if (!best_fit)
     return false;
 
+  unit->cached_func = best_fit;
+  unit->cached_func_low = fit_low;
+  unit->cached_func_high = fit_high;
   *function_ptr = best_fit;
   return true;
 }
@@ -5416,7 +5592,7 @@ _bfd_dwarf2_slurp_debug_info (bfd *abfd, bfd *debug_bfd,
     {
       /* Case 1: only one info section.  */
       total_size = msec->size;
-      if (! read_section (debug_bfd, &stash->debug_sections[debug_info],
+      if (! read_section (stash, debug_bfd, &stash->debug_sections[debug_info],
 			  symbols, 0,
 			  &stash->f.dwarf_info_buffer, &total_size))
 	return false;
@@ -5527,7 +5703,7 @@ stash_comp_unit (struct dwarf2_debug *stash, struct dwarf2_debug_file *file)
 	  if (each->arange.high == 0)
 	    {
 	      each->next_unit_without_ranges = file->all_comp_units_without_ranges;
-	      file->all_comp_units_without_ranges = each->next_unit_without_ranges;
+	      file->all_comp_units_without_ranges = each;
 	    }
 
 	  file->info_ptr += length;
@@ -5541,6 +5717,27 @@ stash_comp_unit (struct dwarf2_debug *stash, struct dwarf2_debug_file *file)
   return NULL;
 }
 
+/* Read all the remaining comp units of FILE.  Decode the line tables
+   of units without ranges, which also gives them ranges, so that
+   lookups find every unit through the trie instead of scanning the
+   units without ranges one by one.  This is used once many addresses
+   have been looked up, as most units will be needed anyway.  */
+
+static void
+stash_read_all_comp_units (struct dwarf2_debug *stash,
+			   struct dwarf2_debug_file *file)
+{
+  struct comp_unit *each;
+
+  while (stash_comp_unit (stash, file) != NULL)
+    ;
+
+  for (each = file->all_comp_units_without_ranges;
+       each;
+       each = each->next_unit_without_ranges)
+    comp_unit_maybe_decode_line_info (each);
+}
+
 /* Hash function for an asymbol.  */
 
 static hashval_t
@@ -5772,10 +5969,16 @@ _bfd_dwarf2_find_nearest_line (bfd *abfd,
     }
   else
     {
-      struct trie_node *trie = stash->f.trie_root;
+      struct trie_node *trie;
       unsigned int bits = VMA_BITS - 8;
       struct comp_unit **prev_each;
 
+      if (stash->find_nearest_line_count < STASH_READ_ALL_TRIGGER
+	  && ++stash->find_nearest_line_count == STASH_READ_ALL_TRIGGER)
+	stash_read_all_comp_units (stash, &stash->f);
+
+      trie = stash->f.trie_root;
+
       /* Traverse interior nodes until we get to a leaf.  */
       while (trie && trie->num_room_in_leaf == 0)
 	{
@@ -5990,16 +6193,24 @@ _bfd_dwarf2_cleanup_debug_info (bfd *abfd, void **pinfo)
 	}
       htab_delete (file->abbrev_offsets);
 
-      free (file->dwarf_line_str_buffer);
-      free (file->dwarf_str_buffer);
-      free (file->dwarf_ranges_buffer);
-      free (file->dwarf_line_buffer);
-      free (file->dwarf_abbrev_buffer);
-      free (file->dwarf_info_buffer);
+      free_section_buffer (stash, file->dwarf_line_str_buffer);
+      free_section_buffer (stash, file->dwarf_str_buffer);
+      free_section_buffer (stash, file->dwarf_ranges_buffer);
+      free_section_buffer (stash, file->dwarf_line_buffer);
+      free_section_buffer (stash, file->dwarf_abbrev_buffer);
+      free_section_buffer (stash, file->dwarf_info_buffer);
       if (file == &stash->alt)
 	break;
       file = &stash->alt;
     }
+  while (stash->mapped_sections != NULL)
+    {
+      struct dwarf2_mapped_section *mapped = stash->mapped_sections;
+
+      stash->mapped_sections = mapped->next;
+      bfd_release_section_contents_view (&mapped->view);
+      free (mapped);
+    }
   free (stash->sec_vma);
   free (stash->adjusted_sections);
   if (stash->close_on_cleanup)
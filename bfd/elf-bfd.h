@@ -699,6 +699,18 @@ struct elf_link_hash_table
   /* Small local sym cache.  */
   struct sym_cache sym_cache;
 
+  /* Sections marked by _bfd_elf_gc_mark whose relocs are still to be
+     scanned, and whether _bfd_elf_gc_mark is scanning them.  */
+  struct elf_gc_mark_entry *gc_mark_stack;
+  size_t gc_mark_count;
+  size_t gc_mark_alloced;
+  bool gc_mark_running;
+
+  /* Decoded relocations of input sections, kept within
+     info->reloc_cache_size bytes when relocations are not kept in
+     memory.  */
+  struct elf_reloc_cache *reloc_cache;
+
   /* Short-cuts to get to dynamic linker sections.  */
   asection *sgot;
   asection *sgotplt;
@@ -2693,6 +2705,9 @@ extern bool bfd_elf_gc_mark_dynamic_ref_symbol
 extern bool bfd_elf_gc_sections
   (bfd *, struct bfd_link_info *);
 
+extern bool bfd_elf_icf_sections
+  (bfd *, struct bfd_link_info *);
+
 extern bool bfd_elf_gc_record_vtinherit
   (bfd *, asection *, struct elf_link_hash_entry *, bfd_vma);
 
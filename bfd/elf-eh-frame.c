@@ -2276,6 +2276,86 @@ vma_compare (const void *a, const void *b)
   return 0;
 }
 
+/* Sort the COUNT entries of the .eh_frame_hdr search table ARRAY in
+   the order given by vma_compare.  Large tables are sorted with an LSD
+   radix sort on initial_loc, skipping the byte positions in which all
+   entries agree, followed by an insertion sort that orders runs with
+   equal initial_loc by range.  */
+
+static void
+sort_eh_frame_array (struct eh_frame_array_ent *array, size_t count)
+{
+  struct eh_frame_array_ent *tmp, *src, *dst;
+  size_t (*hist)[256];
+  size_t i, j;
+  unsigned int shift, byte;
+
+  for (i = 1; i < count; i++)
+    if (vma_compare (&array[i - 1], &array[i]) > 0)
+      break;
+  if (i >= count)
+    return;
+
+  tmp = NULL;
+  hist = NULL;
+  if (count >= 1024)
+    {
+      tmp = (struct eh_frame_array_ent *) bfd_malloc (count * sizeof (*tmp));
+      hist = (size_t (*)[256]) bfd_zmalloc (sizeof (bfd_vma)
+					    * sizeof (*hist));
+    }
+  if (tmp == NULL || hist == NULL)
+    {
+      free (tmp);
+      free (hist);
+      qsort (array, count, sizeof (*array), vma_compare);
+      return;
+    }
+
+  for (i = 0; i < count; i++)
+    for (byte = 0; byte < sizeof (bfd_vma); byte++)
+      hist[byte][(array[i].initial_loc >> (byte * 8)) & 0xff]++;
+
+  src = array;
+  dst = tmp;
+  for (byte = 0; byte < sizeof (bfd_vma); byte++)
+    {
+      size_t pos, n;
+
+      shift = byte * 8;
+      if (hist[byte][(array[0].initial_loc >> shift) & 0xff] == count)
+	continue;
+
+      pos = 0;
+      for (j = 0; j < 256; j++)
+	{
+	  n = hist[byte][j];
+	  hist[byte][j] = pos;
+	  pos += n;
+	}
+      for (i = 0; i < count; i++)
+	dst[hist[byte][(src[i].initial_loc >> shift) & 0xff]++] = src[i];
+
+      src = dst;
+      dst = dst == tmp ? array : tmp;
+    }
+  if (src != array)
+    memcpy (array, src, count * sizeof (*array));
+  free (hist);
+  free (tmp);
+
+  for (i = 1; i < count; i++)
+    if (array[i].initial_loc == array[i - 1].initial_loc
+	&& array[i].range < array[i - 1].range)
+      {
+	struct eh_frame_array_ent ent = array[i];
+
+	for (j = i; j > 0 && vma_compare (&array[j - 1], &ent) > 0; j--)
+	  array[j] = array[j - 1];
+	array[j] = ent;
+      }
+}
+
 /* Reorder .eh_frame_entry sections to match the associated text sections.
    This routine is called during the final linking step, just before writing
    the contents.  At this stage, sections in the eh_frame_hdr_info are already
@@ -2459,8 +2539,8 @@ write_dwarf_eh_frame_hdr (bfd *abfd, struct bfd_link_info *info)
 
       bfd_put_32 (abfd, hdr_info->u.dwarf.fde_count,
 		  contents + EH_FRAME_HDR_SIZE);
-      qsort (hdr_info->u.dwarf.array, hdr_info->u.dwarf.fde_count,
-	     sizeof (*hdr_info->u.dwarf.array), vma_compare);
+      sort_eh_frame_array (hdr_info->u.dwarf.array,
+			   hdr_info->u.dwarf.fde_count);
       overlap = false;
       overflow = false;
       for (i = 0; i < hdr_info->u.dwarf.fde_count; i++)
@@ -365,6 +365,140 @@ strrevcmp (const void *a, const void *b)
   return lenA - lenB;
 }
 
+/* Return the character DEPTH places from the end of E, or -1 if E is
+   shorter than that.  Comparing these for increasing DEPTH gives the
+   same order as strrevcmp.  */
+
+static inline int
+strrev_char (const struct elf_strtab_hash_entry *e, unsigned int depth)
+{
+  if (depth >= (unsigned int) e->len)
+    return -1;
+  return ((const unsigned char *) e->root.string)[e->len - 1 - depth];
+}
+
+/* A range of entries still to be sorted by strtab_sort, all of which
+   end in the same DEPTH characters.  */
+
+struct strtab_sort_range
+{
+  struct elf_strtab_hash_entry **base;
+  size_t count;
+  unsigned int depth;
+};
+
+/* Sort ARRAY of SIZE entries in strrevcmp order.  This is a multikey
+   quicksort on the reversed strings, which looks at each character of
+   a common suffix once rather than once per comparison as qsort does.
+   Large string tables, with many long symbol names that share
+   suffixes, sort much faster.  Small ranges are finished by qsort.  */
+
+static void
+strtab_sort (struct elf_strtab_hash_entry **array, size_t size)
+{
+  struct strtab_sort_range *stack;
+  size_t sp, alloced;
+
+  alloced = 64;
+  stack = (struct strtab_sort_range *) bfd_malloc (alloced * sizeof (*stack));
+  if (stack == NULL)
+    {
+      qsort (array, size, sizeof (*array), strrevcmp);
+      return;
+    }
+
+  stack[0].base = array;
+  stack[0].count = size;
+  stack[0].depth = 0;
+  sp = 1;
+  while (sp != 0)
+    {
+      struct strtab_sort_range r = stack[--sp];
+      struct elf_strtab_hash_entry **base = r.base;
+      struct elf_strtab_hash_entry *tmp;
+      size_t lt, gt, i;
+      int a, b, c, pivot;
+
+      if (r.count < 16)
+	{
+	  if (r.count > 1)
+	    qsort (base, r.count, sizeof (*base), strrevcmp);
+	  continue;
+	}
+
+      if (sp + 3 > alloced)
+	{
+	  struct strtab_sort_range *n;
+
+	  alloced *= 2;
+	  n = (struct strtab_sort_range *) bfd_realloc (stack,
+							alloced
+							* sizeof (*stack));
+	  if (n == NULL)
+	    {
+	      /* Any partial order is fine as input to qsort.  */
+	      free (stack);
+	      qsort (array, size, sizeof (*array), strrevcmp);
+	      return;
+	    }
+	  stack = n;
+	}
+
+      /* Median of three pivot.  */
+      a = strrev_char (base[0], r.depth);
+      b = strrev_char (base[r.count / 2], r.depth);
+      c = strrev_char (base[r.count - 1], r.depth);
+      if (a > b)
+	{
+	  int t = a;
+	  a = b;
+	  b = t;
+	}
+      pivot = c < a ? a : c > b ? b : c;
+
+      /* Three way partition into less than, equal to and greater than
+	 the pivot character.  */
+      lt = 0;
+      gt = r.count;
+      i = 0;
+      while (i < gt)
+	{
+	  int ch = strrev_char (base[i], r.depth);
+
+	  if (ch < pivot)
+	    {
+	      tmp = base[lt];
+	      base[lt++] = base[i];
+	      base[i++] = tmp;
+	    }
+	  else if (ch > pivot)
+	    {
+	      tmp = base[--gt];
+	      base[gt] = base[i];
+	      base[i] = tmp;
+	    }
+	  else
+	    i++;
+	}
+
+      stack[sp].base = base;
+      stack[sp].count = lt;
+      stack[sp++].depth = r.depth;
+      stack[sp].base = base + gt;
+      stack[sp].count = r.count - gt;
+      stack[sp++].depth = r.depth;
+      /* All entries differ, so at most one string can end here.  */
+      if (pivot >= 0)
+	{
+	  stack[sp].base = base + lt;
+	  stack[sp].count = gt - lt;
+	  stack[sp++].depth = r.depth + 1;
+	}
+    }
+
+  free (stack);
+}
+
 static inline int
 is_suffix (const struct elf_strtab_hash_entry *A,
 	   const struct elf_strtab_hash_entry *B)
@@ -411,7 +545,7 @@ _bfd_elf_strtab_finalize (struct elf_strtab_hash *tab)
   size = a - array;
   if (size != 0)
     {
-      qsort (array, size, sizeof (struct elf_strtab_hash_entry *), strrevcmp);
+      strtab_sort (array, size);
 
       /* Loop over the sorted array and merge suffixes.  Start from the
 	 end because we want eg.
@@ -49,6 +49,10 @@ SECTION
 #include CORE_HEADER
 #endif
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
 static int elf_sort_sections (const void *, const void *);
 static bool assign_file_positions_except_relocs (bfd *, struct bfd_link_info *);
 static bool swap_out_syms (bfd *, struct elf_strtab_hash **, int,
@@ -376,7 +380,9 @@ bfd_elf_string_from_elf_section (bfd *abfd,
    are non-NULL, they are used to store the internal symbols, external
    symbols, and symbol section index extensions, respectively.
    Returns a pointer to the internal symbol buffer (malloced if necessary)
-   or NULL if there were no symbols or some kind of problem.  */
+   or NULL if there were no symbols or some kind of problem.
+   If EXTSYM_BUF is NULL a large symbol table is mapped from the file
+   rather than read into a temporary buffer, saving a copy of it.  */
 
 Elf_Internal_Sym *
 bfd_elf_get_elf_syms (bfd *ibfd,
@@ -389,6 +395,8 @@ bfd_elf_get_elf_syms (bfd *ibfd,
 {
   Elf_Internal_Shdr *shndx_hdr;
   void *alloc_ext;
+  void *ext_map_addr;
+  bfd_size_type ext_map_len;
   const bfd_byte *esym;
   Elf_External_Sym_Shndx *alloc_extshndx;
   Elf_External_Sym_Shndx *shndx;
@@ -439,6 +447,8 @@ bfd_elf_get_elf_syms (bfd *ibfd,
 
   /* Read the symbols.  */
   alloc_ext = NULL;
+  ext_map_addr = NULL;
+  ext_map_len = 0;
   alloc_extshndx = NULL;
   alloc_intsym = NULL;
   bed = get_elf_backend_data (ibfd);
@@ -450,14 +460,42 @@ bfd_elf_get_elf_syms (bfd *ibfd,
       goto out;
     }
   pos = symtab_hdr->sh_offset + symoffset * extsym_size;
+#ifdef HAVE_MMAP
+  if (extsym_buf == NULL
+      && ibfd->direction == read_direction
+      && (ibfd->flags & BFD_IN_MEMORY) == 0)
+    {
+      static bfd_size_type pagesize;
+      ufile_ptr filesize = bfd_get_file_size (ibfd);
+
+      if (pagesize == 0)
+	pagesize = getpagesize ();
+
+      /* Mapping past the end of the file would fault on access.  */
+      if (amt >= 4 * pagesize
+	  && pos >= 0
+	  && (ufile_ptr) pos <= filesize
+	  && amt <= filesize - pos)
+	{
+	  void *mem = bfd_mmap (ibfd, NULL, amt, PROT_READ, MAP_PRIVATE,
+				pos, &ext_map_addr, &ext_map_len);
+
+	  if (mem != (void *) -1)
+	    extsym_buf = mem;
+	  else
+	    ext_map_addr = NULL;
+	}
+    }
+#endif
   if (extsym_buf == NULL)
     {
       alloc_ext = bfd_malloc (amt);
       extsym_buf = alloc_ext;
     }
   if (extsym_buf == NULL
-      || bfd_seek (ibfd, pos, SEEK_SET) != 0
-      || bfd_bread (extsym_buf, amt, ibfd) != amt)
+      || (ext_map_addr == NULL
+	  && (bfd_seek (ibfd, pos, SEEK_SET) != 0
+	      || bfd_bread (extsym_buf, amt, ibfd) != amt)))
     {
       intsym_buf = NULL;
       goto out;
@@ -520,6 +558,10 @@ bfd_elf_get_elf_syms (bfd *ibfd,
       }
 
  out:
+#ifdef HAVE_MMAP
+  if (ext_map_addr != NULL)
+    munmap (ext_map_addr, ext_map_len);
+#endif
   free (alloc_ext);
   free (alloc_extshndx);
 
@@ -1203,11 +1245,13 @@ _bfd_elf_make_section_from_shdr (bfd *abfd,
       int compression_header_size;
       bfd_size_type uncompressed_size;
       unsigned int uncompressed_align_power;
+      enum compression_type ch_type;
       bool compressed
 	= bfd_is_section_compressed_with_header (abfd, newsect,
 						 &compression_header_size,
 						 &uncompressed_size,
-						 &uncompressed_align_power);
+						 &uncompressed_align_power,
+						 &ch_type);
       if (compressed)
 	{
 	  /* Compressed section.  Check if we should decompress.  */
@@ -1215,8 +1259,9 @@ _bfd_elf_make_section_from_shdr (bfd *abfd,
 	    action = decompress;
 	}
 
-      /* Compress the uncompressed section or convert from/to .zdebug*
-	 section.  Check if we should compress.  */
+      /* Compress the uncompressed section, convert from/to .zdebug*
+	 section or change the compression method.  Check if we should
+	 compress.  */
       if (action == nothing)
 	{
 	  if (newsect->size != 0
@@ -1225,7 +1270,9 @@ _bfd_elf_make_section_from_shdr (bfd *abfd,
 	      && uncompressed_size > 0
 	      && (!compressed
 		  || ((compression_header_size > 0)
-		      != ((abfd->flags & BFD_COMPRESS_GABI) != 0))))
+		      != ((abfd->flags & BFD_COMPRESS_GABI) != 0))
+		  || ((ch_type == ch_compress_zstd)
+		      != ((abfd->flags & BFD_COMPRESS_ZSTD) != 0))))
 	    action = compress;
 	  else
 	    return true;
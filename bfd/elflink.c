@@ -27,6 +27,8 @@
 #include "safe-ctype.h"
 #include "libiberty.h"
 #include "objalloc.h"
+#include "hashtab.h"
+#include "demangle.h"
 #if BFD_SUPPORTS_PLUGINS
 #include "plugin-api.h"
 #include "plugin.h"
@@ -2716,6 +2718,215 @@ elf_link_read_relocs_from_section (bfd *abfd,
   return true;
 }
 
+/* When relocations are not kept in memory, every pass that needs them
+   (check_relocs, garbage collection, .eh_frame parsing and the final
+   link) reads and swaps them again.  If info->reloc_cache_size is not
+   zero, a copy of the decoded relocations is kept in this cache,
+   evicting the least recently used sections to stay within that many
+   bytes.  Callers always get their own copy, so ownership of the
+   returned relocations is the same as without the cache.  Entries are
+   keyed by BFD id and section index, which unlike pointers are never
+   reused.  */
+
+struct elf_reloc_cache_entry
+{
+  unsigned int bfd_id;
+  unsigned int sec_index;
+  bfd_size_type size;
+  Elf_Internal_Rela *relocs;
+  /* The use list, most recently used first.  */
+  struct elf_reloc_cache_entry *prev;
+  struct elf_reloc_cache_entry *next;
+};
+
+struct elf_reloc_cache
+{
+  htab_t table;
+  struct elf_reloc_cache_entry *first;
+  struct elf_reloc_cache_entry *last;
+  /* Total size of the cached relocations.  */
+  bfd_size_type size;
+};
+
+static hashval_t
+elf_reloc_cache_hash (const void *p)
+{
+  const struct elf_reloc_cache_entry *e = p;
+
+  return e->bfd_id * 31 + e->sec_index;
+}
+
+static int
+elf_reloc_cache_eq (const void *p1, const void *p2)
+{
+  const struct elf_reloc_cache_entry *e1 = p1;
+  const struct elf_reloc_cache_entry *e2 = p2;
+
+  return e1->bfd_id == e2->bfd_id && e1->sec_index == e2->sec_index;
+}
+
+static void
+elf_reloc_cache_unlink (struct elf_reloc_cache *cache,
+			struct elf_reloc_cache_entry *e)
+{
+  if (e->prev != NULL)
+    e->prev->next = e->next;
+  else
+    cache->first = e->next;
+  if (e->next != NULL)
+    e->next->prev = e->prev;
+  else
+    cache->last = e->prev;
+}
+
+static void
+elf_reloc_cache_push (struct elf_reloc_cache *cache,
+		      struct elf_reloc_cache_entry *e)
+{
+  e->prev = NULL;
+  e->next = cache->first;
+  if (cache->first != NULL)
+    cache->first->prev = e;
+  else
+    cache->last = e;
+  cache->first = e;
+}
+
+/* Remove entry E from CACHE and free it.  */
+
+static void
+elf_reloc_cache_evict (struct elf_reloc_cache *cache,
+		       struct elf_reloc_cache_entry *e)
+{
+  elf_reloc_cache_unlink (cache, e);
+  htab_remove_elt (cache->table, e);
+  cache->size -= e->size;
+  free (e->relocs);
+  free (e);
+}
+
+/* Return the relocation cache for INFO, creating it if need be, or
+   NULL if there isn't one.  */
+
+static struct elf_reloc_cache *
+elf_reloc_cache_get (struct bfd_link_info *info)
+{
+  struct elf_link_hash_table *htab;
+
+  if (info->reloc_cache_size == 0 || !is_elf_hash_table (info->hash))
+    return NULL;
+
+  htab = elf_hash_table (info);
+  if (htab->reloc_cache == NULL)
+    {
+      struct elf_reloc_cache *cache = bfd_zmalloc (sizeof (*cache));
+
+      if (cache == NULL)
+	return NULL;
+      cache->table = htab_try_create (1024, elf_reloc_cache_hash,
+				      elf_reloc_cache_eq, NULL);
+      if (cache->table == NULL)
+	{
+	  free (cache);
+	  return NULL;
+	}
+      htab->reloc_cache = cache;
+    }
+  return htab->reloc_cache;
+}
+
+/* Look up the relocations of section O of ABFD, SIZE bytes, in CACHE
+   and mark them as most recently used.  */
+
+static struct elf_reloc_cache_entry *
+elf_reloc_cache_lookup (struct elf_reloc_cache *cache, bfd *abfd,
+			asection *o, bfd_size_type size)
+{
+  struct elf_reloc_cache_entry key, *e;
+
+  key.bfd_id = abfd->id;
+  key.sec_index = o->index;
+  e = htab_find (cache->table, &key);
+  if (e == NULL)
+    return NULL;
+
+  /* A backend may have changed the reloc count since.  */
+  if (e->size != size)
+    {
+      elf_reloc_cache_evict (cache, e);
+      return NULL;
+    }
+
+  if (e != cache->first)
+    {
+      elf_reloc_cache_unlink (cache, e);
+      elf_reloc_cache_push (cache, e);
+    }
+  return e;
+}
+
+/* Add a copy of RELOCS, the SIZE bytes of relocations of section O of
+   ABFD, to CACHE, evicting older entries to stay within the budget.  */
+
+static void
+elf_reloc_cache_insert (struct elf_reloc_cache *cache,
+			struct bfd_link_info *info, bfd *abfd, asection *o,
+			const Elf_Internal_Rela *relocs, bfd_size_type size)
+{
+  struct elf_reloc_cache_entry *e;
+  void **slot;
+
+  if (size > info->reloc_cache_size)
+    return;
+
+  while (cache->last != NULL
+	 && cache->size + size > info->reloc_cache_size)
+    elf_reloc_cache_evict (cache, cache->last);
+
+  e = bfd_malloc (sizeof (*e));
+  if (e == NULL)
+    return;
+  e->relocs = bfd_malloc (size);
+  if (e->relocs == NULL)
+    {
+      free (e);
+      return;
+    }
+  e->bfd_id = abfd->id;
+  e->sec_index = o->index;
+  e->size = size;
+  memcpy (e->relocs, relocs, size);
+
+  slot = htab_find_slot (cache->table, e, INSERT);
+  if (slot == NULL)
+    {
+      free (e->relocs);
+      free (e);
+      return;
+    }
+  *slot = e;
+  elf_reloc_cache_push (cache, e);
+  cache->size += size;
+}
+
+static void
+elf_reloc_cache_free (struct elf_reloc_cache *cache)
+{
+  struct elf_reloc_cache_entry *e, *next;
+
+  if (cache == NULL)
+    return;
+
+  for (e = cache->first; e != NULL; e = next)
+    {
+      next = e->next;
+      free (e->relocs);
+      free (e);
+    }
+  htab_delete (cache->table);
+  free (cache);
+}
+
 /* Read and swap the relocs for a section O.  They may have been
    cached.  If the EXTERNAL_RELOCS and INTERNAL_RELOCS arguments are
    not NULL, they are used as buffers to read into.  They are known to
@@ -2740,6 +2951,8 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
   const struct elf_backend_data *bed = get_elf_backend_data (abfd);
   struct bfd_elf_section_data *esdo = elf_section_data (o);
   Elf_Internal_Rela *internal_rela_relocs;
+  struct elf_reloc_cache *cache = NULL;
+  bfd_size_type internal_size;
 
   if (esdo->relocs != NULL)
     return esdo->relocs;
@@ -2747,11 +2960,32 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
   if (o->reloc_count == 0)
     return NULL;
 
+  internal_size = (bfd_size_type) o->reloc_count * sizeof (Elf_Internal_Rela);
+
+  if (!keep_memory && info != NULL)
+    cache = elf_reloc_cache_get (info);
+  if (cache != NULL)
+    {
+      struct elf_reloc_cache_entry *e;
+
+      e = elf_reloc_cache_lookup (cache, abfd, o, internal_size);
+      if (e != NULL)
+	{
+	  if (internal_relocs == NULL)
+	    {
+	      internal_relocs = (Elf_Internal_Rela *) bfd_malloc (internal_size);
+	      if (internal_relocs == NULL)
+		return NULL;
+	    }
+	  memcpy (internal_relocs, e->relocs, internal_size);
+	  return internal_relocs;
+	}
+    }
+
   if (internal_relocs == NULL)
     {
-      bfd_size_type size;
+      bfd_size_type size = internal_size;
 
-      size = (bfd_size_type) o->reloc_count * sizeof (Elf_Internal_Rela);
       if (keep_memory)
 	{
 	  internal_relocs = alloc2 = (Elf_Internal_Rela *) bfd_alloc (abfd, size);
@@ -2801,6 +3035,9 @@ _bfd_elf_link_info_read_relocs (bfd *abfd,
   /* Cache the results for next time, if we can.  */
   if (keep_memory)
     esdo->relocs = internal_relocs;
+  else if (cache != NULL)
+    elf_reloc_cache_insert (cache, info, abfd, o, internal_relocs,
+			    internal_size);
 
   free (alloc1);
 
@@ -8110,6 +8347,8 @@ _bfd_elf_link_hash_table_free (bfd *obfd)
   if (htab->dynstr != NULL)
     _bfd_elf_strtab_free (htab->dynstr);
   _bfd_merge_sections_free (htab->merge_info);
+  free (htab->gc_mark_stack);
+  elf_reloc_cache_free (htab->reloc_cache);
   _bfd_generic_link_hash_table_free (obfd);
 }
 
@@ -9657,6 +9896,123 @@ elf_link_sort_cmp2 (const void *A, const void *B)
   return 0;
 }
 
+/* Sort key for elf_link_sort_relative.  */
+
+struct elf_link_sort_key
+{
+  bfd_vma offset;
+  size_t index;
+};
+
+/* Move the relative relocs among the COUNT entries of size SORT_ELT at
+   *PSORT to the front, ordered as elf_link_sort_cmp1 would order them,
+   and return their number.  The relative relocs of large shared
+   libraries number in the millions, so rather than comparing entries
+   with qsort their offsets are radix sorted, then the entries are
+   moved into place in one pass.  The remaining entries keep their
+   original order.  Return (size_t) -1 if the relocs must be sorted
+   with qsort instead.  */
+
+static size_t
+elf_link_sort_relative (bfd_byte **psort, size_t count, size_t sort_elt)
+{
+  bfd_byte *sort = *psort;
+  bfd_byte *sorted, *p;
+  struct elf_link_sort_key *keys, *tmp, *src, *dst;
+  size_t (*hist)[256];
+  size_t i, j, nrel;
+  unsigned int byte;
+  bfd_vma sym_info = 0;
+
+  nrel = 0;
+  for (i = 0, p = sort; i < count; i++, p += sort_elt)
+    {
+      struct elf_link_sort_rela *s = (struct elf_link_sort_rela *) p;
+
+      if (s->type != reloc_class_relative)
+	continue;
+      /* Relative relocs normally have no symbol.  Leave anything
+	 else to qsort.  */
+      if (nrel == 0)
+	sym_info = s->rela->r_info & s->u.sym_mask;
+      else if ((s->rela->r_info & s->u.sym_mask) != sym_info)
+	return (size_t) -1;
+      nrel++;
+    }
+  if (nrel < 1024)
+    return (size_t) -1;
+
+  keys = (struct elf_link_sort_key *) bfd_malloc (2 * nrel * sizeof (*keys));
+  hist = (size_t (*)[256]) bfd_zmalloc (sizeof (bfd_vma) * sizeof (*hist));
+  sorted = (bfd_byte *) bfd_malloc (count * sort_elt);
+  if (keys == NULL || hist == NULL || sorted == NULL)
+    {
+      free (keys);
+      free (hist);
+      free (sorted);
+      return (size_t) -1;
+    }
+
+  for (i = 0, j = 0, p = sort; i < count; i++, p += sort_elt)
+    {
+      struct elf_link_sort_rela *s = (struct elf_link_sort_rela *) p;
+
+      if (s->type != reloc_class_relative)
+	continue;
+      keys[j].offset = s->rela->r_offset;
+      keys[j].index = i;
+      for (byte = 0; byte < sizeof (bfd_vma); byte++)
+	hist[byte][(keys[j].offset >> (byte * 8)) & 0xff]++;
+      j++;
+    }
+
+  src = keys;
+  tmp = keys + nrel;
+  dst = tmp;
+  for (byte = 0; byte < sizeof (bfd_vma); byte++)
+    {
+      unsigned int shift = byte * 8;
+      size_t pos, n;
+
+      if (hist[byte][(keys[0].offset >> shift) & 0xff] == nrel)
+	continue;
+
+      pos = 0;
+      for (j = 0; j < 256; j++)
+	{
+	  n = hist[byte][j];
+	  hist[byte][j] = pos;
+	  pos += n;
+	}
+      for (i = 0; i < nrel; i++)
+	dst[hist[byte][(src[i].offset >> shift) & 0xff]++] = src[i];
+
+      dst = src;
+      src = dst == keys ? tmp : keys;
+    }
+
+  p = sorted;
+  for (i = 0; i < nrel; i++, p += sort_elt)
+    memcpy (p, sort + src[i].index * sort_elt, sort_elt);
+  for (i = 0; i < count; i++)
+    {
+      struct elf_link_sort_rela *s
+	= (struct elf_link_sort_rela *) (sort + i * sort_elt);
+
+      if (s->type != reloc_class_relative)
+	{
+	  memcpy (p, s, sort_elt);
+	  p += sort_elt;
+	}
+    }
+
+  free (keys);
+  free (hist);
+  free (sort);
+  *psort = sorted;
+  return nrel;
+}
+
 static size_t
 elf_link_sort_relocs (bfd *abfd, struct bfd_link_info *info, asection **psec)
 {
@@ -9888,7 +10244,11 @@ elf_link_sort_relocs (bfd *abfd, struct bfd_link_info *info, asection **psec)
 	  }
       }
 
-  qsort (sort, count, sort_elt, elf_link_sort_cmp1);
+  i = elf_link_sort_relative (&sort, count, sort_elt);
+  if (i == (size_t) -1)
+    qsort (sort, count, sort_elt, elf_link_sort_cmp1);
+  else
+    qsort (sort + i * sort_elt, count - i, sort_elt, elf_link_sort_cmp1);
 
   for (i = 0, p = sort; i < count; i++, p += sort_elt)
     {
@@ -11110,6 +11470,9 @@ elf_link_input_bfd (struct elf_final_link_info *flinfo, bfd *input_bfd)
 	      _bfd_merged_section_offset (output_bfd, &isec,
 					  elf_section_data (isec)->sec_info,
 					  isym->st_value);
+	  else if (isec->sec_info_type == SEC_INFO_TYPE_ICF)
+	    /* The section was folded into an identical one.  */
+	    isec = isec->kept_section;
 	}
 
       *ppsection = isec;
@@ -11891,20 +12254,40 @@ elf_link_input_bfd (struct elf_final_link_info *flinfo, bfd *input_bfd)
 			return false;
 		      }
 
-		    do
+		    /* Reverse the order of the words in a buffer and write
+		       them with a single call, rather than writing each
+		       word separately.  flinfo->contents is large enough
+		       for any input section.  */
+		    if (contents == flinfo->contents)
 		      {
-			todo -= address_size;
-			if (! bfd_set_section_contents (output_bfd,
-							o->output_section,
-							contents + todo,
-							offset,
-							address_size))
-			  return false;
-			if (todo == 0)
-			  break;
-			offset += address_size;
+			bfd_byte *lo = contents;
+			bfd_byte *hi = contents + todo - address_size;
+
+			while (lo < hi)
+			  {
+			    bfd_byte tmp[16];
+
+			    memcpy (tmp, lo, address_size);
+			    memcpy (lo, hi, address_size);
+			    memcpy (hi, tmp, address_size);
+			    lo += address_size;
+			    hi -= address_size;
+			  }
 		      }
-		    while (1);
+		    else
+		      {
+			bfd_size_type i;
+
+			for (i = 0; i < todo; i += address_size)
+			  memcpy (flinfo->contents + i,
+				  contents + todo - address_size - i,
+				  address_size);
+			contents = flinfo->contents;
+		      }
+		    if (! bfd_set_section_contents (output_bfd,
+						    o->output_section,
+						    contents, offset, todo))
+		      return false;
 		  }
 		else if (! bfd_set_section_contents (output_bfd,
 						     o->output_section,
@@ -13769,20 +14152,26 @@ _bfd_elf_gc_mark_reloc (struct bfd_link_info *info,
   return true;
 }
 
-/* The mark phase of garbage collection.  For a given section, mark
-   it and any sections in this section's group, and all the sections
-   which define symbols to which it refers.  */
+/* A section marked by _bfd_elf_gc_mark whose relocs have not been
+   scanned yet.  */
 
-bool
-_bfd_elf_gc_mark (struct bfd_link_info *info,
-		  asection *sec,
-		  elf_gc_mark_hook_fn gc_mark_hook)
+struct elf_gc_mark_entry
+{
+  asection *sec;
+  elf_gc_mark_hook_fn gc_mark_hook;
+};
+
+/* Scan the relocs of SEC, which has been marked, and those of the
+   sections it brings along, marking the sections they refer to.  */
+
+static bool
+elf_gc_mark_relocs (struct bfd_link_info *info,
+		    asection *sec,
+		    elf_gc_mark_hook_fn gc_mark_hook)
 {
   bool ret;
   asection *group_sec, *eh_frame;
 
-  sec->gc_mark = 1;
-
   /* Mark all the sections in the group.  */
   group_sec = elf_section_data (sec)->next_in_group;
   if (group_sec && !group_sec->gc_mark)
@@ -13835,6 +14224,59 @@ _bfd_elf_gc_mark (struct bfd_link_info *info,
   return ret;
 }
 
+/* The mark phase of garbage collection.  For a given section, mark
+   it and any sections in this section's group, and all the sections
+   which define symbols to which it refers.
+
+   Sections are marked straight away, but their relocs are scanned
+   from a work list rather than by recursion.  Calls made while the
+   list is being scanned just add to it, so chains of references
+   millions of sections long do not exhaust the stack.  The outermost
+   call returns once everything reachable has been marked.  */
+
+bool
+_bfd_elf_gc_mark (struct bfd_link_info *info,
+		  asection *sec,
+		  elf_gc_mark_hook_fn gc_mark_hook)
+{
+  struct elf_link_hash_table *htab = elf_hash_table (info);
+  bool ret;
+
+  sec->gc_mark = 1;
+
+  if (htab->gc_mark_count == htab->gc_mark_alloced)
+    {
+      size_t alloced = 2 * htab->gc_mark_alloced + 256;
+      struct elf_gc_mark_entry *stack;
+
+      stack = (struct elf_gc_mark_entry *)
+	bfd_realloc (htab->gc_mark_stack, alloced * sizeof (*stack));
+      if (stack == NULL)
+	return false;
+      htab->gc_mark_stack = stack;
+      htab->gc_mark_alloced = alloced;
+    }
+  htab->gc_mark_stack[htab->gc_mark_count].sec = sec;
+  htab->gc_mark_stack[htab->gc_mark_count].gc_mark_hook = gc_mark_hook;
+  htab->gc_mark_count++;
+
+  if (htab->gc_mark_running)
+    return true;
+
+  htab->gc_mark_running = true;
+  ret = true;
+  while (ret && htab->gc_mark_count != 0)
+    {
+      struct elf_gc_mark_entry ent;
+
+      ent = htab->gc_mark_stack[--htab->gc_mark_count];
+      ret = elf_gc_mark_relocs (info, ent.sec, ent.gc_mark_hook);
+    }
+  htab->gc_mark_count = 0;
+  htab->gc_mark_running = false;
+  return ret;
+}
+
 /* Scan and mark sections in a special or debug section group.  */
 
 static void
@@ -14382,6 +14824,742 @@ bfd_elf_gc_sections (bfd *abfd, struct bfd_link_info *info)
   return elf_gc_sweep (abfd, info);
 }
 
+/* Identical code folding.  Sections that gold would consider (code,
+   exception tables and linkonce text) are compared by contents and by
+   relocations, including the FDE describing each section and its CIE.
+   Sections are first grouped optimistically by their bytes, then the
+   groups are split until every member's relocations refer to the same
+   symbols or to sections in the same group.  All but the first section
+   of each group are excluded from the link, with symbols defined in
+   them redirected to the section that is kept.  */
+
+/* A relocation in a section considered for folding, reduced to what
+   matters when comparing two sections.  */
+
+struct elf_icf_reloc
+{
+  bfd_vma offset;
+  bfd_vma type;
+  bfd_vma addend;
+
+  /* The symbol value, relative to SEC.  */
+  bfd_vma value;
+
+  /* The section holding the target, or NULL if the target is the
+     global symbol H.  */
+  asection *sec;
+  struct elf_link_hash_entry *h;
+
+  /* The index of SEC among the candidate sections, or -1.  */
+  size_t target;
+};
+
+/* A section considered for folding.  */
+
+struct elf_icf_section
+{
+  asection *sec;
+
+  /* The section contents, followed by those of any FDE describing the
+     section and of the FDE's CIE.  */
+  bfd_byte *contents;
+  bfd_size_type size;
+
+  /* Relocations against CONTENTS, in order of offset.  */
+  struct elf_icf_reloc *relocs;
+  size_t reloc_count;
+  size_t reloc_alloc;
+
+  /* TRUE if this section must not be folded.  */
+  bool unique;
+};
+
+/* State for one bfd_elf_icf_sections run.  */
+
+struct elf_icf_info
+{
+  struct bfd_link_info *info;
+  struct elf_icf_section *secs;
+  size_t count;
+
+  /* Candidate index by section id, for ids up to MAX_ID.  */
+  size_t *index;
+  unsigned int max_id;
+};
+
+/* Sort key for one round of partition refinement.  */
+
+struct elf_icf_key
+{
+  size_t cls;
+  hashval_t hash;
+  size_t index;
+};
+
+/* Return TRUE if input bfd IBFD may provide sections for folding into
+   output bfd OBFD.  */
+
+static bool
+elf_icf_input_bfd_p (bfd *ibfd, bfd *obfd, struct bfd_link_info *info)
+{
+  const struct elf_backend_data *bed = get_elf_backend_data (obfd);
+
+  return (bfd_get_flavour (ibfd) == bfd_target_elf_flavour
+	  && (ibfd->flags & DYNAMIC) == 0
+	  && elf_object_id (ibfd) == elf_hash_table_id (elf_hash_table (info))
+	  && (*bed->relocs_compatible) (ibfd->xvec, obfd->xvec)
+	  && ibfd->sections != NULL
+	  && ibfd->sections->sec_info_type != SEC_INFO_TYPE_JUST_SYMS);
+}
+
+/* Return TRUE if SEC may be folded into an identical section.  */
+
+static bool
+elf_icf_candidate_p (asection *sec, struct bfd_link_info *info)
+{
+  const flagword need = SEC_ALLOC | SEC_LOAD | SEC_HAS_CONTENTS | SEC_READONLY;
+  const char *name = sec->name;
+
+  if ((sec->flags & need) != need
+      || (sec->flags & (SEC_EXCLUDE | SEC_KEEP | SEC_MERGE
+			| SEC_LINKER_CREATED | SEC_GROUP)) != 0
+      || sec->sec_info_type != SEC_INFO_TYPE_NONE
+      || sec->kept_section != NULL
+      || discarded_section (sec)
+      || sec->size == 0
+      || elf_section_data (sec)->this_hdr.sh_type != SHT_PROGBITS
+      || (elf_section_flags (sec) & SHF_GNU_RETAIN) != 0)
+    return false;
+
+  if (!startswith (name, ".text")
+      && !startswith (name, ".gcc_except_table")
+      && !startswith (name, ".gnu.linkonce.t"))
+    return false;
+
+  if (info->icf == icf_safe)
+    {
+      /* We cannot tell in general whether a function's address is
+	 taken, so only fold constructors and destructors, whose
+	 addresses cannot be taken in C++.  The mangled name follows
+	 the last dot of a -ffunction-sections section name.  */
+      const char *fn = strrchr (name, '.');
+
+      if (!((startswith (fn, "._ZN") || startswith (fn, "._ZZ"))
+	    && (is_gnu_v3_mangled_ctor (fn + 1)
+		|| is_gnu_v3_mangled_dtor (fn + 1))))
+	return false;
+    }
+
+  return true;
+}
+
+/* Return the candidate index of SEC, or -1.  */
+
+static size_t
+elf_icf_lookup (const struct elf_icf_info *icf, const asection *sec)
+{
+  if (sec == NULL || sec->id > icf->max_id)
+    return (size_t) -1;
+  return icf->index[sec->id];
+}
+
+/* Append relocation REL to candidate C, recording it at OFFSET in C's
+   contents.  The relocation's symbol is resolved using COOKIE.  */
+
+static bool
+elf_icf_add_reloc (struct elf_icf_info *icf, struct elf_icf_section *c,
+		   struct elf_reloc_cookie *cookie,
+		   const Elf_Internal_Rela *rel, bfd_vma offset)
+{
+  struct elf_icf_reloc *r;
+  unsigned long r_symndx = rel->r_info >> cookie->r_sym_shift;
+
+  if (c->reloc_count == c->reloc_alloc)
+    {
+      size_t alloc = c->reloc_alloc ? c->reloc_alloc * 2 : 16;
+      struct elf_icf_reloc *relocs
+	= bfd_realloc (c->relocs, alloc * sizeof (*relocs));
+
+      if (relocs == NULL)
+	return false;
+      c->relocs = relocs;
+      c->reloc_alloc = alloc;
+    }
+
+  r = &c->relocs[c->reloc_count++];
+  r->offset = offset;
+  r->type = rel->r_info & (((bfd_vma) 1 << cookie->r_sym_shift) - 1);
+  r->addend = rel->r_addend;
+  r->value = 0;
+  r->sec = NULL;
+  r->h = NULL;
+  r->target = (size_t) -1;
+
+  if (r_symndx == STN_UNDEF)
+    ;
+  else if (r_symndx >= cookie->locsymcount
+	   || ELF_ST_BIND (cookie->locsyms[r_symndx].st_info) != STB_LOCAL)
+    {
+      struct elf_link_hash_entry *h;
+
+      h = cookie->sym_hashes[r_symndx - cookie->extsymoff];
+      if (h == NULL)
+	{
+	  c->unique = true;
+	  return true;
+	}
+      while (h->root.type == bfd_link_hash_indirect
+	     || h->root.type == bfd_link_hash_warning)
+	h = (struct elf_link_hash_entry *) h->root.u.i.link;
+
+      /* A symbol that may be preempted, or that is resolved at run
+	 time, is only identical to itself.  */
+      if ((h->root.type == bfd_link_hash_defined
+	   || h->root.type == bfd_link_hash_defweak)
+	  && h->type != STT_GNU_IFUNC
+	  && SYMBOL_REFERENCES_LOCAL (icf->info, h))
+	{
+	  r->sec = h->root.u.def.section;
+	  r->value = h->root.u.def.value;
+	}
+      else
+	r->h = h;
+    }
+  else
+    {
+      Elf_Internal_Sym *isym = &cookie->locsyms[r_symndx];
+
+      if (isym->st_shndx == SHN_ABS)
+	r->sec = bfd_abs_section_ptr;
+      else
+	r->sec = bfd_section_from_elf_index (cookie->abfd, isym->st_shndx);
+      if (r->sec == NULL)
+	c->unique = true;
+      r->value = isym->st_value;
+    }
+
+  r->target = elf_icf_lookup (icf, r->sec);
+  return true;
+}
+
+/* Append LEN bytes of DATA, found at BASE in their section, to
+   candidate C, along with the relocations from REL to RELEND that
+   apply to them.  RELS must be sorted by offset.  */
+
+static bool
+elf_icf_append (struct elf_icf_info *icf, struct elf_icf_section *c,
+		struct elf_reloc_cookie *cookie,
+		const bfd_byte *data, bfd_size_type len, bfd_vma base,
+		const Elf_Internal_Rela *rel, const Elf_Internal_Rela *relend)
+{
+  bfd_byte *contents = bfd_realloc (c->contents, c->size + len);
+  size_t lo, hi;
+
+  if (contents == NULL)
+    return false;
+  memcpy (contents + c->size, data, len);
+  c->contents = contents;
+
+  /* Find the first relocation at or after BASE.  */
+  lo = 0;
+  hi = relend - rel;
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+
+      if (rel[mid].r_offset < base)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  for (rel += lo;
+       rel < relend && rel->r_offset < base + len;
+       rel++)
+    if (!elf_icf_add_reloc (icf, c, cookie, rel,
+			    c->size + rel->r_offset - base))
+      return false;
+
+  c->size += len;
+  return true;
+}
+
+/* Add the FDEs in .eh_frame section EH, and their CIEs, to the
+   contents of the candidate sections they describe.  Return -1 on
+   error, 0 if the section could not be parsed and 1 on success.  */
+
+static int
+elf_icf_add_eh_frame (struct elf_icf_info *icf, asection *eh,
+		      struct elf_reloc_cookie *cookie)
+{
+  bfd *abfd = eh->owner;
+  bfd_byte *contents = NULL;
+  Elf_Internal_Rela *rels = NULL, *relend, *rel;
+  bfd_size_type off;
+  int ret = -1;
+
+  if (!bfd_malloc_and_get_section (abfd, eh, &contents))
+    goto out;
+  if (eh->reloc_count != 0)
+    {
+      rels = _bfd_elf_link_info_read_relocs (abfd, icf->info, eh, NULL, NULL,
+					     _bfd_link_keep_memory (icf->info));
+      if (rels == NULL)
+	goto out;
+    }
+  /* RELOC_COUNT already counts the internal relocations of each
+     external one.  */
+  relend = rels + eh->reloc_count;
+
+  ret = 0;
+  rel = rels;
+  for (off = 0; off + 8 <= eh->size; )
+    {
+      bfd_vma length = bfd_get_32 (abfd, contents + off);
+      bfd_vma id;
+      bfd_size_type end;
+
+      if (length == 0)
+	break;
+      if (length > eh->size - off - 4)
+	goto out;
+      end = off + 4 + length;
+      id = bfd_get_32 (abfd, contents + off + 4);
+
+      /* An FDE: find the relocation for its initial location, which
+	 tells us the section it describes.  */
+      while (rel < relend && rel->r_offset < off + 8)
+	rel++;
+      if (id != 0 && rel < relend && rel->r_offset == off + 8)
+	{
+	  struct elf_icf_section tmp;
+	  size_t c;
+
+	  memset (&tmp, 0, sizeof (tmp));
+	  if (!elf_icf_add_reloc (icf, &tmp, cookie, rel, 0))
+	    {
+	      ret = -1;
+	      goto out;
+	    }
+	  c = tmp.relocs[0].target;
+	  free (tmp.relocs);
+
+	  if (c != (size_t) -1)
+	    {
+	      bfd_size_type cie = off + 4 - id;
+	      bfd_vma cie_length;
+
+	      if (id > off + 4)
+		goto out;
+	      cie_length = bfd_get_32 (abfd, contents + cie);
+	      if (cie_length > eh->size - cie - 4)
+		goto out;
+
+	      /* Skip the FDE's length and CIE pointer, which depend on
+		 where the FDE lives, but include all of the CIE.  */
+	      if (!elf_icf_append (icf, &icf->secs[c], cookie,
+				   contents + off + 8, end - off - 8, off + 8,
+				   rels, relend)
+		  || !elf_icf_append (icf, &icf->secs[c], cookie,
+				      contents + cie, cie_length + 4, cie,
+				      rels, relend))
+		{
+		  ret = -1;
+		  goto out;
+		}
+	    }
+	}
+      off = end;
+    }
+  ret = 1;
+
+ out:
+  if (rels != NULL && elf_section_data (eh)->relocs != rels)
+    free (rels);
+  free (contents);
+  return ret;
+}
+
+/* Read the contents and relocations of the candidate sections of input
+   bfd IBFD, which start at index FIRST, along with their FDEs.  */
+
+static bool
+elf_icf_read_bfd (struct elf_icf_info *icf, bfd *ibfd, size_t first)
+{
+  struct elf_reloc_cookie cookie;
+  asection *o;
+  size_t i;
+  bool ok = false;
+
+  if (!init_reloc_cookie (&cookie, icf->info, ibfd))
+    return false;
+
+  for (i = first; i < icf->count && icf->secs[i].sec->owner == ibfd; i++)
+    {
+      struct elf_icf_section *c = &icf->secs[i];
+      Elf_Internal_Rela *rels, *rel, *relend;
+
+      if (!bfd_malloc_and_get_section (ibfd, c->sec, &c->contents))
+	goto out;
+      c->size = c->sec->size;
+
+      if (c->sec->reloc_count == 0)
+	continue;
+      rels = _bfd_elf_link_info_read_relocs (ibfd, icf->info, c->sec,
+					     NULL, NULL,
+					     _bfd_link_keep_memory (icf->info));
+      if (rels == NULL)
+	goto out;
+      relend = rels + c->sec->reloc_count;
+      for (rel = rels; rel < relend; rel++)
+	if (!elf_icf_add_reloc (icf, c, &cookie, rel, rel->r_offset))
+	  break;
+      if (elf_section_data (c->sec)->relocs != rels)
+	free (rels);
+      if (rel < relend)
+	goto out;
+    }
+
+  for (o = ibfd->sections; o != NULL; o = o->next)
+    {
+      /* A section that must be output next to a folded section has
+	 nowhere to go; keep such sections apart.  */
+      size_t linked = elf_icf_lookup (icf, elf_linked_to_section (o));
+
+      if (linked != (size_t) -1 && (o->flags & SEC_EXCLUDE) == 0)
+	icf->secs[linked].unique = true;
+
+      if (strcmp (o->name, ".eh_frame") == 0
+	  && (o->flags & SEC_EXCLUDE) == 0
+	  && (o->flags & SEC_HAS_CONTENTS) != 0)
+	{
+	  int res = elf_icf_add_eh_frame (icf, o, &cookie);
+
+	  if (res < 0)
+	    goto out;
+	  if (res == 0)
+	    {
+	      /* We do not know which sections have unwind information
+		 that differs, so fold none of this object's sections.  */
+	      for (i = first;
+		   i < icf->count && icf->secs[i].sec->owner == ibfd;
+		   i++)
+		icf->secs[i].unique = true;
+	    }
+	}
+    }
+  ok = true;
+
+ out:
+  fini_reloc_cookie (&cookie, ibfd);
+  return ok;
+}
+
+/* Hash what distinguishes candidate C in the first round: its size,
+   alignment, contents and relocations, except for the identity of
+   targets that are themselves candidates.  */
+
+static hashval_t
+elf_icf_hash_contents (const struct elf_icf_section *c)
+{
+  hashval_t h = iterative_hash (c->contents, c->size, c->sec->alignment_power);
+  size_t i;
+
+  h = iterative_hash_object (c->size, h);
+  h = iterative_hash_object (c->reloc_count, h);
+  for (i = 0; i < c->reloc_count; i++)
+    {
+      const struct elf_icf_reloc *r = &c->relocs[i];
+
+      h = iterative_hash_object (r->offset, h);
+      h = iterative_hash_object (r->type, h);
+      h = iterative_hash_object (r->addend, h);
+      h = iterative_hash_object (r->value, h);
+      if (r->target == (size_t) -1)
+	{
+	  h = iterative_hash_object (r->sec, h);
+	  h = iterative_hash_object (r->h, h);
+	}
+    }
+  return h;
+}
+
+/* Return TRUE if candidates A and B compare equal in the first
+   round.  */
+
+static bool
+elf_icf_equal_contents (const struct elf_icf_section *a,
+			const struct elf_icf_section *b)
+{
+  size_t i;
+
+  if (a->size != b->size
+      || a->sec->alignment_power != b->sec->alignment_power
+      || a->reloc_count != b->reloc_count
+      || memcmp (a->contents, b->contents, a->size) != 0)
+    return false;
+
+  for (i = 0; i < a->reloc_count; i++)
+    {
+      const struct elf_icf_reloc *ra = &a->relocs[i];
+      const struct elf_icf_reloc *rb = &b->relocs[i];
+
+      if (ra->offset != rb->offset
+	  || ra->type != rb->type
+	  || ra->addend != rb->addend
+	  || ra->value != rb->value
+	  || (ra->target == (size_t) -1) != (rb->target == (size_t) -1)
+	  || (ra->target == (size_t) -1
+	      && (ra->sec != rb->sec || ra->h != rb->h)))
+	return false;
+    }
+  return true;
+}
+
+/* Hash the groups that the relocations of candidate C refer to, given
+   the current grouping CLS.  */
+
+static hashval_t
+elf_icf_hash_targets (const struct elf_icf_section *c, const size_t *cls)
+{
+  hashval_t h = 0;
+  size_t i;
+
+  for (i = 0; i < c->reloc_count; i++)
+    if (c->relocs[i].target != (size_t) -1)
+      h = iterative_hash_object (cls[c->relocs[i].target], h);
+  return h;
+}
+
+/* Return TRUE if the relocations of candidates A and B, which are in
+   the same group, refer to the same groups under CLS.  */
+
+static bool
+elf_icf_equal_targets (const struct elf_icf_section *a,
+		       const struct elf_icf_section *b, const size_t *cls)
+{
+  size_t i;
+
+  for (i = 0; i < a->reloc_count; i++)
+    if (a->relocs[i].target != (size_t) -1
+	&& cls[a->relocs[i].target] != cls[b->relocs[i].target])
+      return false;
+  return true;
+}
+
+static int
+elf_icf_key_compare (const void *a, const void *b)
+{
+  const struct elf_icf_key *ka = (const struct elf_icf_key *) a;
+  const struct elf_icf_key *kb = (const struct elf_icf_key *) b;
+
+  if (ka->cls != kb->cls)
+    return ka->cls < kb->cls ? -1 : 1;
+  if (ka->hash != kb->hash)
+    return ka->hash < kb->hash ? -1 : 1;
+  if (ka->index != kb->index)
+    return ka->index < kb->index ? -1 : 1;
+  return 0;
+}
+
+/* Point symbols defined in folded sections at the kept section.  This
+   is called via elf_link_hash_traverse.  */
+
+static bool
+elf_icf_redirect_symbol (struct elf_link_hash_entry *h,
+			 void *data ATTRIBUTE_UNUSED)
+{
+  if ((h->root.type == bfd_link_hash_defined
+       || h->root.type == bfd_link_hash_defweak)
+      && h->root.u.def.section->sec_info_type == SEC_INFO_TYPE_ICF)
+    h->root.u.def.section = h->root.u.def.section->kept_section;
+  return true;
+}
+
+/* Fold identical sections, as selected by INFO->icf.  */
+
+bool
+bfd_elf_icf_sections (bfd *abfd, struct bfd_link_info *info)
+{
+  struct elf_icf_info icf;
+  struct elf_icf_key *keys = NULL;
+  size_t *cls = NULL, *next_cls = NULL, *reps = NULL;
+  size_t alloc = 0, nkeys, i, classes, prev_classes;
+  unsigned int round;
+  bool ok = false;
+  bfd *sub;
+
+  if (info->icf == icf_none)
+    return true;
+  if (!is_elf_hash_table (info->hash))
+    {
+      _bfd_error_handler (_("warning: --icf option ignored"));
+      return true;
+    }
+
+  memset (&icf, 0, sizeof (icf));
+  icf.info = info;
+
+  /* Collect the candidates, in link order so that the first of each
+     group of identical sections is the one kept.  */
+  for (sub = info->input_bfds; sub != NULL; sub = sub->link.next)
+    {
+      asection *o;
+
+      if (!elf_icf_input_bfd_p (sub, abfd, info))
+	continue;
+
+      for (o = sub->sections; o != NULL; o = o->next)
+	{
+	  if (!elf_icf_candidate_p (o, info))
+	    continue;
+
+	  if (icf.count == alloc)
+	    {
+	      struct elf_icf_section *secs;
+
+	      alloc = alloc ? alloc * 2 : 64;
+	      secs = bfd_realloc (icf.secs, alloc * sizeof (*secs));
+	      if (secs == NULL)
+		goto out;
+	      icf.secs = secs;
+	    }
+	  memset (&icf.secs[icf.count], 0, sizeof (icf.secs[0]));
+	  icf.secs[icf.count++].sec = o;
+	  if (o->id > icf.max_id)
+	    icf.max_id = o->id;
+	}
+    }
+
+  if (icf.count < 2)
+    {
+      ok = true;
+      goto out;
+    }
+
+  icf.index = bfd_malloc ((icf.max_id + 1) * sizeof (*icf.index));
+  if (icf.index == NULL)
+    goto out;
+  memset (icf.index, -1, (icf.max_id + 1) * sizeof (*icf.index));
+  for (i = 0; i < icf.count; i++)
+    icf.index[icf.secs[i].sec->id] = i;
+
+  for (i = 0; i < icf.count; )
+    {
+      bfd *ibfd = icf.secs[i].sec->owner;
+
+      if (!elf_icf_read_bfd (&icf, ibfd, i))
+	goto out;
+      while (i < icf.count && icf.secs[i].sec->owner == ibfd)
+	i++;
+    }
+
+  /* Refine the grouping until it no longer changes.  Each section's key
+     depends only on the previous round's grouping, so the keys of a
+     round can be computed for all sections independently.  */
+  keys = bfd_malloc (icf.count * sizeof (*keys));
+  cls = bfd_malloc (icf.count * sizeof (*cls));
+  next_cls = bfd_malloc (icf.count * sizeof (*next_cls));
+  reps = bfd_malloc (icf.count * sizeof (*reps));
+  if (keys == NULL || cls == NULL || next_cls == NULL || reps == NULL)
+    goto out;
+
+  for (i = 0; i < icf.count; i++)
+    cls[i] = icf.secs[i].unique ? i : 0;
+
+  prev_classes = 0;
+  for (round = 0; ; round++)
+    {
+      size_t start;
+
+      nkeys = 0;
+      for (i = 0; i < icf.count; i++)
+	{
+	  next_cls[i] = i;
+	  if (icf.secs[i].unique)
+	    continue;
+	  keys[nkeys].cls = cls[i];
+	  keys[nkeys].hash = (round == 0
+			      ? elf_icf_hash_contents (&icf.secs[i])
+			      : elf_icf_hash_targets (&icf.secs[i], cls));
+	  keys[nkeys].index = i;
+	  nkeys++;
+	}
+      qsort (keys, nkeys, sizeof (*keys), elf_icf_key_compare);
+
+      /* Within each run of equal keys, put each section in the group
+	 of the first earlier section it really is identical to.  REPS
+	 holds the first section of each group found in the run.  */
+      classes = 0;
+      for (start = 0; start < nkeys; )
+	{
+	  size_t end = start + 1, nreps = 0, j, k;
+
+	  while (end < nkeys
+		 && keys[end].cls == keys[start].cls
+		 && keys[end].hash == keys[start].hash)
+	    end++;
+
+	  for (j = start; j < end; j++)
+	    {
+	      const struct elf_icf_section *c = &icf.secs[keys[j].index];
+
+	      for (k = 0; k < nreps; k++)
+		if (round == 0
+		    ? elf_icf_equal_contents (&icf.secs[reps[k]], c)
+		    : elf_icf_equal_targets (&icf.secs[reps[k]], c, cls))
+		  {
+		    next_cls[keys[j].index] = reps[k];
+		    break;
+		  }
+	      if (k == nreps)
+		reps[nreps++] = keys[j].index;
+	    }
+	  classes += nreps;
+	  start = end;
+	}
+
+      memcpy (cls, next_cls, icf.count * sizeof (*cls));
+      if (round != 0 && classes == prev_classes)
+	break;
+      prev_classes = classes;
+    }
+
+  for (i = 0; i < icf.count; i++)
+    if (cls[i] != i)
+      {
+	asection *sec = icf.secs[i].sec;
+	asection *kept = icf.secs[cls[i]].sec;
+
+	sec->flags |= SEC_EXCLUDE;
+	sec->kept_section = kept;
+	sec->sec_info_type = SEC_INFO_TYPE_ICF;
+	if (info->print_icf_sections)
+	  /* xgettext:c-format */
+	  _bfd_error_handler (_("ICF folding section '%pA' in file '%pB' "
+				"into '%pA' in file '%pB'"),
+			      sec, sec->owner, kept, kept->owner);
+      }
+
+  elf_link_hash_traverse (elf_hash_table (info), elf_icf_redirect_symbol,
+			  NULL);
+  ok = true;
+
+ out:
+  for (i = 0; i < icf.count; i++)
+    {
+      free (icf.secs[i].contents);
+      free (icf.secs[i].relocs);
+    }
+  free (icf.secs);
+  free (icf.index);
+  free (keys);
+  free (cls);
+  free (next_cls);
+  free (reps);
+  return ok;
+}
+
 /* Called from check_relocs to record the existence of a VTINHERIT reloc.  */
 
 bool
@@ -3205,7 +3205,7 @@ _bfd_x86_elf_get_synthetic_symtab (bfd *abfd,
   unsigned int plt_got_offset, plt_entry_size;
   asymbol *s;
   bfd_byte *plt_contents;
-  long dynrelcount;
+  long dynrelcount, next_rel;
   arelent **dynrelbuf, *p;
   char *names;
   const struct elf_backend_data *bed;
@@ -3226,26 +3226,6 @@ _bfd_x86_elf_get_synthetic_symtab (bfd *abfd,
   if (dynrelcount <= 0)
     goto bad_return;
 
-  /* Sort the relocs by address.  */
-  qsort (dynrelbuf, dynrelcount, sizeof (arelent *),
-	 _bfd_x86_elf_compare_relocs);
-
-  size = count * sizeof (asymbol);
-
-  /* Allocate space for @plt suffixes.  */
-  n = 0;
-  for (i = 0; i < dynrelcount; i++)
-    {
-      p = dynrelbuf[i];
-      size += strlen ((*p->sym_ptr_ptr)->name) + sizeof ("@plt");
-      if (p->addend != 0)
-	size += sizeof ("+0x") - 1 + 8 + 8 * ABI_64_P (abfd);
-    }
-
-  s = *ret = (asymbol *) bfd_zmalloc (size);
-  if (s == NULL)
-    goto bad_return;
-
   bed = get_elf_backend_data (abfd);
 
   if (bed->target_id == X86_64_ELF_DATA)
@@ -3276,10 +3256,39 @@ _bfd_x86_elf_get_synthetic_symtab (bfd *abfd,
 	}
     }
 
+  size = count * sizeof (asymbol);
+
+  /* Keep only the relocations that a PLT entry can use; the dynamic
+     relocations of a large shared library are mostly relative ones,
+     which needn't be sorted, searched or given names.  Allocate space
+     for @plt suffixes.  */
+  for (i = 0, n = 0; i < dynrelcount; i++)
+    {
+      p = dynrelbuf[i];
+      if (p->howto == NULL || !valid_plt_reloc_p (p->howto->type))
+	continue;
+      dynrelbuf[n++] = p;
+      size += strlen ((*p->sym_ptr_ptr)->name) + sizeof ("@plt");
+      if (p->addend != 0)
+	size += sizeof ("+0x") - 1 + 8 + 8 * ABI_64_P (abfd);
+    }
+  dynrelcount = n;
+  if (dynrelcount == 0)
+    goto bad_return;
+
+  /* Sort the relocs by address.  */
+  qsort (dynrelbuf, dynrelcount, sizeof (arelent *),
+	 _bfd_x86_elf_compare_relocs);
+
+  s = *ret = (asymbol *) bfd_zmalloc (size);
+  if (s == NULL)
+    goto bad_return;
+
   /* Check for each PLT section.  */
   names = (char *) (s + count);
   size = 0;
   n = 0;
+  next_rel = 0;
   for (j = 0; plts[j].name != NULL; j++)
     if ((plt_contents = plts[j].contents) != NULL)
       {
@@ -3318,24 +3327,37 @@ _bfd_x86_elf_get_synthetic_symtab (bfd *abfd,
 				   + plt_got_offset));
 	    got_vma = get_plt_got_vma (plt_p, off, offset, got_addr);
 
-	    /* Binary search.  */
-	    p = dynrelbuf[0];
-	    min = 0;
-	    max = dynrelcount;
-	    while ((min + 1) < max)
+	    /* PLT entries normally use consecutive GOT slots, so try
+	       the relocation after the last one matched before
+	       searching.  */
+	    if (next_rel < dynrelcount
+		&& dynrelbuf[next_rel]->address == got_vma)
 	      {
-		arelent *r;
-
-		mid = (min + max) / 2;
-		r = dynrelbuf[mid];
-		if (got_vma > r->address)
-		  min = mid;
-		else if (got_vma < r->address)
-		  max = mid;
-		else
+		mid = next_rel;
+		p = dynrelbuf[mid];
+	      }
+	    else
+	      {
+		/* Binary search.  */
+		p = dynrelbuf[0];
+		mid = 0;
+		min = 0;
+		max = dynrelcount;
+		while ((min + 1) < max)
 		  {
-		    p = r;
-		    break;
+		    arelent *r;
+
+		    mid = (min + max) / 2;
+		    r = dynrelbuf[mid];
+		    if (got_vma > r->address)
+		      min = mid;
+		    else if (got_vma < r->address)
+		      max = mid;
+		    else
+		      {
+			p = r;
+			break;
+		      }
 		  }
 	      }
 
@@ -3382,6 +3404,8 @@ _bfd_x86_elf_get_synthetic_symtab (bfd *abfd,
 		   symbol.  Set howto to NULL after processing a PLT
 		   entry to guard against corrupted PLT.  */
 		p->howto = NULL;
+		if (p == dynrelbuf[mid])
+		  next_rel = mid + 1;
 	      }
 	    offset += plt_entry_size;
 	  }
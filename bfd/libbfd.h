@@ -95,6 +95,10 @@ struct artdata
   file_ptr armap_datepos;	/* Position within archive to seek to
 				   rewrite the date field.  */
   void *tdata;			/* Backend specific information.  */
+  void *armap_map_addr;		/* Mapping holding the armap strings,  */
+  bfd_size_type armap_map_len;	/* if they were not copied.  */
+  long armap_date;		/* Date in the header of the armap read
+				   from this archive.  */
 };
 
 #define bfd_ardata(bfd) ((bfd)->tdata.aout_ar_data)
@@ -56,11 +56,24 @@ struct sec_merge_hash_entry
   struct sec_merge_hash_entry *next;
 };
 
-/* The section merge hash table.  */
+/* The section merge hash table.  Entries are allocated from TABLE,
+   but looked up in an open addressing table of NBUCKETS slots, a power
+   of two, so that a probe only has to touch the hash and length of
+   the entries it passes and growing the table does not need to look
+   at the entries at all.  */
 
 struct sec_merge_hash
 {
   struct bfd_hash_table table;
+  /* Number of slots in KEY_LENS and VALUES.  */
+  unsigned int nbuckets;
+  /* Number of used slots.  */
+  unsigned int nentries;
+  /* For each used slot, the entry's hash in the upper 32 bits and its
+     length in the lower 32 bits.  */
+  uint64_t *key_lens;
+  /* The entry in each slot, or NULL if the slot is unused.  */
+  struct sec_merge_hash_entry **values;
   /* Next available index.  */
   bfd_size_type size;
   /* First entity in the SEC_MERGE sections of this type.  */
@@ -131,6 +144,62 @@ sec_merge_hash_newfunc (struct bfd_hash_entry *entry,
   return entry;
 }
 
+/* The initial number of slots of a section merge hash table.  */
+#define SEC_MERGE_INITIAL_BUCKETS 0x2000
+
+/* Combine HASH and LEN into a key for the KEY_LENS array.  */
+
+static inline uint64_t
+sec_merge_key_len (unsigned long hash, unsigned int len)
+{
+  return ((uint64_t) (hash & 0xffffffff) << 32) | len;
+}
+
+/* Double the number of slots in TABLE.  */
+
+static bool
+sec_merge_resize (struct sec_merge_hash *table)
+{
+  unsigned int newsize = table->nbuckets * 2;
+  unsigned int mask = newsize - 1;
+  uint64_t *key_lens;
+  struct sec_merge_hash_entry **values;
+  unsigned int i;
+
+  if (newsize == 0)
+    return false;
+
+  key_lens = (uint64_t *) bfd_malloc ((bfd_size_type) newsize
+				      * sizeof (*key_lens));
+  values = (struct sec_merge_hash_entry **)
+    bfd_zmalloc ((bfd_size_type) newsize * sizeof (*values));
+  if (key_lens == NULL || values == NULL)
+    {
+      free (key_lens);
+      free (values);
+      return false;
+    }
+
+  for (i = 0; i < table->nbuckets; i++)
+    if (table->values[i] != NULL)
+      {
+	uint64_t key_len = table->key_lens[i];
+	unsigned int _index = (key_len >> 32) & mask;
+
+	while (values[_index] != NULL)
+	  _index = (_index + 1) & mask;
+	key_lens[_index] = key_len;
+	values[_index] = table->values[i];
+      }
+
+  free (table->key_lens);
+  free (table->values);
+  table->key_lens = key_lens;
+  table->values = values;
+  table->nbuckets = newsize;
+  return true;
+}
+
 /* Look up an entry in a section merge hash table.  */
 
 static struct sec_merge_hash_entry *
@@ -142,7 +211,8 @@ sec_merge_hash_lookup (struct sec_merge_hash *table, const char *string,
   unsigned int c;
   struct sec_merge_hash_entry *hashp;
   unsigned int len, i;
-  unsigned int _index;
+  unsigned int _index, mask;
+  uint64_t key_len;
 
   hash = 0;
   len = 0;
@@ -193,12 +263,13 @@ sec_merge_hash_lookup (struct sec_merge_hash *table, const char *string,
       len = table->entsize;
     }
 
-  _index = hash % table->table.size;
-  for (hashp = (struct sec_merge_hash_entry *) table->table.table[_index];
-       hashp != NULL;
-       hashp = (struct sec_merge_hash_entry *) hashp->root.next)
+  key_len = sec_merge_key_len (hash, len);
+  mask = table->nbuckets - 1;
+  for (_index = hash & mask;
+       (hashp = table->values[_index]) != NULL;
+       _index = (_index + 1) & mask)
     {
-      if (hashp->root.hash == hash
+      if (table->key_lens[_index] == key_len
 	  && len == hashp->len
 	  && memcmp (hashp->root.string, string, len) == 0)
 	{
@@ -222,11 +293,24 @@ sec_merge_hash_lookup (struct sec_merge_hash *table, const char *string,
     return NULL;
 
   hashp = ((struct sec_merge_hash_entry *)
-	   bfd_hash_insert (&table->table, string, hash));
+	   sec_merge_hash_newfunc (NULL, &table->table, string));
   if (hashp == NULL)
     return NULL;
+  hashp->root.string = string;
+  hashp->root.hash = hash;
   hashp->len = len;
   hashp->alignment = alignment;
+
+  /* A deleted copy's slot is reused for the new copy.  */
+  if (table->values[_index] == NULL)
+    table->nentries++;
+  table->key_lens[_index] = key_len;
+  table->values[_index] = hashp;
+
+  /* Keep the table at most two thirds full.  */
+  if (table->nentries > table->nbuckets / 3 * 2
+      && !sec_merge_resize (table))
+    return NULL;
   return hashp;
 }
 
@@ -242,8 +326,23 @@ sec_merge_init (unsigned int entsize, bool strings)
     return NULL;
 
   if (! bfd_hash_table_init_n (&table->table, sec_merge_hash_newfunc,
-			       sizeof (struct sec_merge_hash_entry), 16699))
+			       sizeof (struct sec_merge_hash_entry), 31))
+    {
+      free (table);
+      return NULL;
+    }
+
+  table->nbuckets = SEC_MERGE_INITIAL_BUCKETS;
+  table->nentries = 0;
+  table->key_lens = (uint64_t *) bfd_malloc (table->nbuckets
+					     * sizeof (*table->key_lens));
+  table->values = (struct sec_merge_hash_entry **)
+    bfd_zmalloc (table->nbuckets * sizeof (*table->values));
+  if (table->key_lens == NULL || table->values == NULL)
     {
+      free (table->key_lens);
+      free (table->values);
+      bfd_hash_table_free (&table->table);
       free (table);
       return NULL;
     }
@@ -613,6 +712,140 @@ strrevcmp_align (const void *a, const void *b)
   return lenA - lenB;
 }
 
+/* Return the octet DEPTH places from the end of E, or -1 if E is
+   shorter than that.  Comparing these for increasing DEPTH gives the
+   same order as strrevcmp.  */
+
+static inline int
+strrev_octet (const struct sec_merge_hash_entry *e, unsigned int depth)
+{
+  if (depth >= e->len)
+    return -1;
+  return ((const unsigned char *) e->root.string)[e->len - 1 - depth];
+}
+
+/* A range of entries still to be sorted by sort_strings, all of which
+   end in the same DEPTH octets.  */
+
+struct sort_strings_range
+{
+  struct sec_merge_hash_entry **base;
+  size_t count;
+  unsigned int depth;
+};
+
+/* Sort ARRAY of SIZE entries in strrevcmp order, using a multikey
+   quicksort on the reversed strings.  Unlike qsort this does not
+   compare the common suffixes of strings over and over again, which
+   for the many long strings in .debug_str is where most of the time
+   goes.  Small ranges are finished by qsort.  */
+
+static void
+sort_strings (struct sec_merge_hash_entry **array, size_t size)
+{
+  struct sort_strings_range *stack;
+  size_t sp, alloced;
+
+  alloced = 64;
+  stack = (struct sort_strings_range *) bfd_malloc (alloced * sizeof (*stack));
+  if (stack == NULL)
+    {
+      qsort (array, size, sizeof (*array), strrevcmp);
+      return;
+    }
+
+  stack[0].base = array;
+  stack[0].count = size;
+  stack[0].depth = 0;
+  sp = 1;
+  while (sp != 0)
+    {
+      struct sort_strings_range r = stack[--sp];
+      struct sec_merge_hash_entry **base = r.base;
+      struct sec_merge_hash_entry *tmp;
+      size_t lt, gt, i;
+      int a, b, c, pivot;
+
+      if (r.count < 16)
+	{
+	  if (r.count > 1)
+	    qsort (base, r.count, sizeof (*base), strrevcmp);
+	  continue;
+	}
+
+      if (sp + 3 > alloced)
+	{
+	  struct sort_strings_range *n;
+
+	  alloced *= 2;
+	  n = (struct sort_strings_range *) bfd_realloc (stack,
+							 alloced
+							 * sizeof (*stack));
+	  if (n == NULL)
+	    {
+	      /* Any partial order is fine as input to qsort.  */
+	      free (stack);
+	      qsort (array, size, sizeof (*array), strrevcmp);
+	      return;
+	    }
+	  stack = n;
+	}
+
+      /* Median of three pivot.  */
+      a = strrev_octet (base[0], r.depth);
+      b = strrev_octet (base[r.count / 2], r.depth);
+      c = strrev_octet (base[r.count - 1], r.depth);
+      if (a > b)
+	{
+	  int t = a;
+	  a = b;
+	  b = t;
+	}
+      pivot = c < a ? a : c > b ? b : c;
+
+      /* Three way partition into less than, equal to and greater than
+	 the pivot octet.  */
+      lt = 0;
+      gt = r.count;
+      i = 0;
+      while (i < gt)
+	{
+	  int ch = strrev_octet (base[i], r.depth);
+
+	  if (ch < pivot)
+	    {
+	      tmp = base[lt];
+	      base[lt++] = base[i];
+	      base[i++] = tmp;
+	    }
+	  else if (ch > pivot)
+	    {
+	      tmp = base[--gt];
+	      base[gt] = base[i];
+	      base[i] = tmp;
+	    }
+	  else
+	    i++;
+	}
+
+      stack[sp].base = base;
+      stack[sp].count = lt;
+      stack[sp++].depth = r.depth;
+      stack[sp].base = base + gt;
+      stack[sp].count = r.count - gt;
+      stack[sp++].depth = r.depth;
+      /* All entries differ, so at most one string can end here.  */
+      if (pivot >= 0)
+	{
+	  stack[sp].base = base + lt;
+	  stack[sp].count = gt - lt;
+	  stack[sp++].depth = r.depth + 1;
+	}
+    }
+
+  free (stack);
+}
+
 static inline int
 is_suffix (const struct sec_merge_hash_entry *A,
 	   const struct sec_merge_hash_entry *B)
@@ -660,10 +893,11 @@ merge_strings (struct sec_merge_info *sinfo)
   sinfo->htab->size = a - array;
   if (sinfo->htab->size != 0)
     {
-      qsort (array, (size_t) sinfo->htab->size,
-	     sizeof (struct sec_merge_hash_entry *),
-	     (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize
-	      ? strrevcmp_align : strrevcmp));
+      if (alignment != (unsigned) -1 && alignment > sinfo->htab->entsize)
+	qsort (array, (size_t) sinfo->htab->size,
+	       sizeof (struct sec_merge_hash_entry *), strrevcmp_align);
+      else
+	sort_strings (array, (size_t) sinfo->htab->size);
 
       /* Loop over the sorted array and merge suffixes */
       e = *--a;
@@ -957,6 +1191,8 @@ _bfd_merge_sections_free (void *xsinfo)
 
   for (sinfo = (struct sec_merge_info *) xsinfo; sinfo; sinfo = sinfo->next)
     {
+      free (sinfo->htab->key_lens);
+      free (sinfo->htab->values);
       bfd_hash_table_free (&sinfo->htab->table);
       free (sinfo->htab);
     }
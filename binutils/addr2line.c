@@ -45,6 +45,7 @@ static bool with_functions;	/* -f, show function names.  */
 static bool do_demangle;	/* -C, demangle names.  */
 static bool pretty_print;	/* -p, print on one line.  */
 static bool base_names;		/* -s, strip directory names.  */
+static bool batch_mode;		/* --batch, translate all addresses at once.  */
 
 /* Flags passed to the name demangler.  */
 static int demangle_flags = DMGL_PARAMS | DMGL_ANSI;
@@ -55,10 +56,16 @@ static char **addr;		/* Hex addresses to process.  */
 static long symcount;
 static asymbol **syms;		/* Symbol table.  */
 
+enum long_option_values
+{
+  OPTION_BATCH = 200
+};
+
 static struct option long_options[] =
 {
   {"addresses", no_argument, NULL, 'a'},
   {"basenames", no_argument, NULL, 's'},
+  {"batch", no_argument, NULL, OPTION_BATCH},
   {"demangle", optional_argument, NULL, 'C'},
   {"exe", required_argument, NULL, 'e'},
   {"functions", no_argument, NULL, 'f'},
@@ -92,6 +99,7 @@ usage (FILE *stream, int status)
   fprintf (stream, _(" The options are:\n\
   @<file>                Read options from <file>\n\
   -a --addresses         Show addresses\n\
+     --batch             Read all addresses before translating them\n\
   -b --target=<bfdname>  Set the binary file format\n\
   -e --exe=<executable>  Set the input file name (default is a.out)\n\
   -i --inlines           Unwind inlined functions\n\
@@ -277,145 +285,293 @@ is_symbol (char *adr, char **symp, size_t *offset)
   return true;
 }
 
-/* Read hexadecimal or symbolic with offset addresses from stdin, translate into
-   file_name:line_number and optionally function name.  */
+/* Convert the hexadecimal or symbolic with offset address ADR to a
+   vma.  */
 
-static void
-translate_addresses (bfd *abfd, asection *section)
+static bfd_vma
+parse_address (bfd *abfd, char *adr)
 {
-  int read_stdin = (naddr == 0);
-  char *adr;
-  char addr_hex[100];
   char *symp;
   size_t offset;
+  bfd_vma vma;
 
-  for (;;)
+  if (is_symbol (adr, &symp, &offset))
+    vma = lookup_symbol (abfd, symp, offset);
+  else
+    vma = bfd_scan_vma (adr, NULL, 16);
+  if (bfd_get_flavour (abfd) == bfd_target_elf_flavour)
     {
-      if (read_stdin)
-	{
-	  if (fgets (addr_hex, sizeof addr_hex, stdin) == NULL)
-	    break;
-	  adr = addr_hex;
-	}
-      else
-	{
-	  if (naddr <= 0)
-	    break;
-	  --naddr;
-	  adr = *addr++;
-	}
+      const struct elf_backend_data *bed = get_elf_backend_data (abfd);
+      bfd_vma sign = (bfd_vma) 1 << (bed->s->arch_size - 1);
 
-      if (is_symbol (adr, &symp, &offset))
-        pc = lookup_symbol (abfd, symp, offset);
-      else
-        pc = bfd_scan_vma (adr, NULL, 16);
-      if (bfd_get_flavour (abfd) == bfd_target_elf_flavour)
-	{
-	  const struct elf_backend_data *bed = get_elf_backend_data (abfd);
-	  bfd_vma sign = (bfd_vma) 1 << (bed->s->arch_size - 1);
+      vma &= (sign << 1) - 1;
+      if (bed->sign_extend_vma)
+	vma = (vma ^ sign) - sign;
+    }
+  return vma;
+}
+
+/* In --batch mode the output for an address is collected here, so
+   that it can be printed in input order once all the addresses have
+   been translated.  */
 
-	  pc &= (sign << 1) - 1;
-	  if (bed->sign_extend_vma)
-	    pc = (pc ^ sign) - sign;
+static bool batch_output;
+static char *batch_buf;
+static size_t batch_len;
+static size_t batch_alloc;
+
+/* Print the output for an address, either to stdout or to BATCH_BUF.  */
+
+static void ATTRIBUTE_PRINTF_1
+emit (const char *format, ...)
+{
+  va_list args;
+
+  va_start (args, format);
+  if (!batch_output)
+    vprintf (format, args);
+  else
+    {
+      char *str = xvasprintf (format, args);
+      size_t len = strlen (str);
+
+      if (batch_len + len + 1 > batch_alloc)
+	{
+	  batch_alloc = (batch_len + len + 1) * 2;
+	  batch_buf = (char *) xrealloc (batch_buf, batch_alloc);
 	}
+      memcpy (batch_buf + batch_len, str, len + 1);
+      batch_len += len;
+      free (str);
+    }
+  va_end (args);
+}
 
-      if (with_addresses)
-        {
-          printf ("0x");
-          bfd_printf_vma (abfd, pc);
+/* Translate PC into file_name:line_number and optionally function
+   name.  */
 
-          if (pretty_print)
-            printf (": ");
-          else
-            printf ("\n");
-        }
+static void
+translate_address (bfd *abfd, asection *section)
+{
+  if (with_addresses)
+    {
+      char buf[30];
 
-      found = false;
-      if (section)
-	find_offset_in_section (abfd, section);
+      bfd_sprintf_vma (abfd, buf, pc);
+      emit ("0x%s", buf);
+
+      if (pretty_print)
+	emit (": ");
       else
-	bfd_map_over_sections (abfd, find_address_in_section, NULL);
+	emit ("\n");
+    }
+
+  found = false;
+  if (section)
+    find_offset_in_section (abfd, section);
+  else
+    bfd_map_over_sections (abfd, find_address_in_section, NULL);
 
-      if (! found)
+  if (! found)
+    {
+      if (with_functions)
+	{
+	  if (pretty_print)
+	    emit ("?? ");
+	  else
+	    emit ("??\n");
+	}
+      emit ("??:0\n");
+    }
+  else
+    {
+      while (1)
 	{
 	  if (with_functions)
 	    {
+	      const char *name;
+	      char *alloc = NULL;
+
+	      name = functionname;
+	      if (name == NULL || *name == '\0')
+		name = "??";
+	      else if (do_demangle)
+		{
+		  alloc = bfd_demangle (abfd, name, demangle_flags);
+		  if (alloc != NULL)
+		    name = alloc;
+		}
+
+	      emit ("%s", name);
 	      if (pretty_print)
-		printf ("?? ");
+		/* Note for translators:  This printf is used to join the
+		   function name just printed above to the line number/
+		   file name pair that is about to be printed below.  Eg:
+
+		     foo at 123:bar.c  */
+		emit (_(" at "));
+	      else
+		emit ("\n");
+
+	      free (alloc);
+	    }
+
+	  if (base_names && filename != NULL)
+	    {
+	      char *h;
+
+	      h = strrchr (filename, '/');
+	      if (h != NULL)
+		filename = h + 1;
+	    }
+
+	  emit ("%s:", filename ? filename : "??");
+	  if (line != 0)
+	    {
+	      if (discriminator != 0)
+		emit ("%u (discriminator %u)\n", line, discriminator);
 	      else
-		printf ("??\n");
+		emit ("%u\n", line);
 	    }
-	  printf ("??:0\n");
+	  else
+	    emit ("?\n");
+	  if (!unwind_inlines)
+	    found = false;
+	  else
+	    found = bfd_find_inliner_info (abfd, &filename, &functionname,
+					   &line);
+	  if (! found)
+	    break;
+	  if (pretty_print)
+	    /* Note for translators: This printf is used to join the
+	       line number/file name pair that has just been printed with
+	       the line number/file name pair that is going to be printed
+	       by the next iteration of the while loop.  Eg:
+
+		 123:bar.c (inlined by) 456:main.c  */
+	    emit (_(" (inlined by) "));
 	}
+    }
+}
+
+/* Return the next address to translate, reading it into ADDR_HEX if
+   READ_STDIN, or else taking it from the command line.  Return NULL
+   when there are no more addresses.  */
+
+static char *
+next_address (bool read_stdin, char *addr_hex, int size)
+{
+  if (read_stdin)
+    return fgets (addr_hex, size, stdin);
+  if (naddr <= 0)
+    return NULL;
+  --naddr;
+  return *addr++;
+}
+
+/* An address read in --batch mode.  */
+
+struct batch_address
+{
+  bfd_vma pc;
+  size_t index;
+};
+
+/* Sort batch addresses by address, keeping input order for equal
+   addresses.  */
+
+static int
+compare_batch_addresses (const void *a, const void *b)
+{
+  const struct batch_address *ba = (const struct batch_address *) a;
+  const struct batch_address *bb = (const struct batch_address *) b;
+
+  if (ba->pc != bb->pc)
+    return ba->pc < bb->pc ? -1 : 1;
+  return ba->index < bb->index ? -1 : ba->index > bb->index;
+}
+
+/* Translate all the addresses in one go: read them all, look them up
+   in address order, which keeps the debug info being walked local and
+   lets repeated addresses share a lookup, then print the results in
+   input order.  */
+
+static void
+translate_addresses_batch (bfd *abfd, asection *section)
+{
+  bool read_stdin = (naddr == 0);
+  char addr_hex[100];
+  char *adr;
+  struct batch_address *addrs = NULL;
+  char **results;
+  size_t count = 0;
+  size_t alloc = 0;
+  size_t i;
+
+  while ((adr = next_address (read_stdin, addr_hex, sizeof addr_hex)) != NULL)
+    {
+      if (count == alloc)
+	{
+	  alloc = alloc == 0 ? 1024 : alloc * 2;
+	  addrs = (struct batch_address *) xrealloc (addrs,
+						     alloc * sizeof (*addrs));
+	}
+      addrs[count].pc = parse_address (abfd, adr);
+      addrs[count].index = count;
+      count++;
+    }
+
+  qsort (addrs, count, sizeof (*addrs), compare_batch_addresses);
+
+  results = (char **) xmalloc (count * sizeof (*results));
+  batch_output = true;
+  for (i = 0; i < count; i++)
+    {
+      if (i > 0 && addrs[i].pc == addrs[i - 1].pc)
+	results[addrs[i].index] = results[addrs[i - 1].index];
       else
 	{
-	  while (1)
-            {
-              if (with_functions)
-                {
-                  const char *name;
-                  char *alloc = NULL;
-
-                  name = functionname;
-                  if (name == NULL || *name == '\0')
-                    name = "??";
-                  else if (do_demangle)
-                    {
-                      alloc = bfd_demangle (abfd, name, demangle_flags);
-                      if (alloc != NULL)
-                        name = alloc;
-                    }
-
-                  printf ("%s", name);
-                  if (pretty_print)
-		    /* Note for translators:  This printf is used to join the
-		       function name just printed above to the line number/
-		       file name pair that is about to be printed below.  Eg:
-
-		         foo at 123:bar.c  */
-                    printf (_(" at "));
-                  else
-                    printf ("\n");
-
-		  free (alloc);
-                }
-
-              if (base_names && filename != NULL)
-                {
-                  char *h;
-
-                  h = strrchr (filename, '/');
-                  if (h != NULL)
-                    filename = h + 1;
-                }
-
-              printf ("%s:", filename ? filename : "??");
-	      if (line != 0)
-                {
-                  if (discriminator != 0)
-                    printf ("%u (discriminator %u)\n", line, discriminator);
-                  else
-                    printf ("%u\n", line);
-                }
-	      else
-		printf ("?\n");
-              if (!unwind_inlines)
-                found = false;
-              else
-                found = bfd_find_inliner_info (abfd, &filename, &functionname,
-					       &line);
-              if (! found)
-                break;
-              if (pretty_print)
-		/* Note for translators: This printf is used to join the
-		   line number/file name pair that has just been printed with
-		   the line number/file name pair that is going to be printed
-		   by the next iteration of the while loop.  Eg:
-
-		     123:bar.c (inlined by) 456:main.c  */
-                printf (_(" (inlined by) "));
-            }
+	  pc = addrs[i].pc;
+	  batch_len = 0;
+	  translate_address (abfd, section);
+	  results[addrs[i].index] = xstrdup (batch_len ? batch_buf : "");
 	}
+    }
+  batch_output = false;
+
+  for (i = 0; i < count; i++)
+    fputs (results[i], stdout);
+
+  for (i = 0; i < count; i++)
+    if (i == 0 || addrs[i].pc != addrs[i - 1].pc)
+      free (results[addrs[i].index]);
+  free (results);
+  free (addrs);
+  free (batch_buf);
+  batch_buf = NULL;
+  batch_alloc = 0;
+}
+
+/* Read hexadecimal or symbolic with offset addresses from stdin, translate into
+   file_name:line_number and optionally function name.  */
+
+static void
+translate_addresses (bfd *abfd, asection *section)
+{
+  bool read_stdin = (naddr == 0);
+  char addr_hex[100];
+  char *adr;
+
+  if (batch_mode)
+    {
+      translate_addresses_batch (abfd, section);
+      return;
+    }
+
+  while ((adr = next_address (read_stdin, addr_hex, sizeof addr_hex)) != NULL)
+    {
+      pc = parse_address (abfd, adr);
+      translate_address (abfd, section);
 
       /* fflush() is essential for using this command as a server
          child process that reads addresses from a pipe and responds
@@ -564,6 +720,9 @@ main (int argc, char **argv)
 	case 'j':
 	  section_name = optarg;
 	  break;
+	case OPTION_BATCH:
+	  batch_mode = true;
+	  break;
 	default:
 	  usage (stderr, 1);
 	  break;
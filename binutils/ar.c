@@ -1579,6 +1579,10 @@ ranlib_only (const char *archname)
   arch = open_inarch (archname, (char *) NULL);
   if (arch == NULL)
     xexit (1);
+  /* Other updates reuse the entries of the existing symbol map for
+     unchanged members.  Don't let that happen here, since ranlib is
+     also used to repair a map that has become stale.  */
+  arch->has_armap = false;
   write_archive (arch);
   return 0;
 }
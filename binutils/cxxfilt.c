@@ -29,14 +29,25 @@
 #include "safe-ctype.h"
 #include "bucomm.h"
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 static int flags = DMGL_PARAMS | DMGL_ANSI | DMGL_VERBOSE;
 static int strip_underscore = TARGET_PREPENDS_UNDERSCORE;
+static unsigned long filter_jobs = 1;	/* --jobs */
+
+enum long_option_values
+{
+  OPTION_JOBS = 200
+};
 
 static const struct option long_options[] =
 {
   {"strip-underscore", no_argument, NULL, '_'},
   {"format", required_argument, NULL, 's'},
   {"help", no_argument, NULL, 'h'},
+  {"jobs", required_argument, NULL, OPTION_JOBS},
   {"no-params", no_argument, NULL, 'p'},
   {"no-strip-underscores", no_argument, NULL, 'n'},
   {"no-verbose", no_argument, NULL, 'i'},
@@ -49,8 +60,10 @@ static const struct option long_options[] =
   {NULL, no_argument, NULL, 0}
 };
 
+/* Write MANGLED_NAME to OUT, demangled if possible.  */
+
 static void
-demangle_it (char *mangled_name)
+demangle_it (char *mangled_name, FILE *out)
 {
   char *result;
   unsigned int skip_first = 0;
@@ -66,16 +79,201 @@ demangle_it (char *mangled_name)
   result = cplus_demangle (mangled_name + skip_first, flags);
 
   if (result == NULL)
-    printf ("%s", mangled_name);
+    fputs (mangled_name, out);
   else
     {
       if (mangled_name[0] == '.')
-	putchar ('.');
-      printf ("%s", result);
+	putc ('.', out);
+      fputs (result, out);
       free (result);
     }
 }
 
+/* In a --jobs worker, the part of standard input that it should
+   demangle.  */
+static const char *input_pos;
+static const char *input_end;
+
+/* Return the next input character, or EOF.  */
+
+static inline int
+next_char (void)
+{
+  if (input_pos == NULL)
+    return getchar ();
+  if (input_pos == input_end)
+    return EOF;
+  return (unsigned char) *input_pos++;
+}
+
+/* Demangle every potential mangled name in the input, made up of
+   alphanumerics and the characters in VALID_SYMBOLS, and write the
+   result to OUT.  If FLUSH, flush OUT at each newline, so that c++filt
+   can be used interactively.  */
+
+static void
+filter (const char *valid_symbols, FILE *out, bool flush)
+{
+  int c;
+
+  for (;;)
+    {
+      static char mbuffer[32767];
+      unsigned i = 0;
+
+      c = next_char ();
+      /* Try to read a mangled name.  */
+      while (c != EOF && (ISALNUM (c) || strchr (valid_symbols, c)))
+	{
+	  if (i >= sizeof (mbuffer) - 1)
+	    break;
+	  mbuffer[i++] = c;
+	  c = next_char ();
+	}
+
+      if (i > 0)
+	{
+	  mbuffer[i] = 0;
+	  demangle_it (mbuffer, out);
+	}
+
+      if (c == EOF)
+	break;
+
+      /* Echo the whitespace characters so that the output looks
+	 like the input, only with the mangled names demangled.  */
+      putc (c, out);
+      if (c == '\n' && flush)
+	fflush (out);
+    }
+}
+
+#ifdef HAVE_FORK
+/* The amount of standard input read for each --jobs worker at a
+   time.  */
+#define JOB_INPUT_SIZE (4 * 1024 * 1024)
+
+/* Demangle the LEN bytes of input in BUF with --jobs worker processes.
+   The input is split between them at newlines, so that no name is
+   split.  Each worker writes its output to a temporary file, and the
+   parent copies the files to stdout in order once all the workers have
+   finished.  Returns the number of workers that failed.  */
+
+static int
+run_filter_workers (const char *valid_symbols, const char *buf, size_t len)
+{
+  unsigned long jobs = filter_jobs;
+  FILE **out;
+  pid_t *pids;
+  char copy[BUFSIZ];
+  size_t start = 0;
+  int failures = 0;
+  unsigned long i;
+
+  out = xmalloc (jobs * sizeof (*out));
+  pids = xmalloc (jobs * sizeof (*pids));
+
+  fflush (stdout);
+  for (i = 0; i < jobs; i++)
+    {
+      size_t stop = len * (i + 1) / jobs;
+
+      while (stop < len && (stop == 0 || buf[stop - 1] != '\n'))
+	stop++;
+      if (stop <= start)
+	{
+	  out[i] = NULL;
+	  continue;
+	}
+
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	fatal (_("can't create temporary file: %s"), strerror (errno));
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	fatal (_("can't fork: %s"), strerror (errno));
+      if (pids[i] == 0)
+	{
+	  input_pos = buf + start;
+	  input_end = buf + stop;
+	  filter (valid_symbols, out[i], false);
+	  _exit (fflush (out[i]) != 0 || ferror (out[i]));
+	}
+      start = stop;
+    }
+
+  for (i = 0; i < jobs; i++)
+    {
+      int status;
+      size_t n;
+
+      if (out[i] == NULL)
+	continue;
+      if (waitpid (pids[i], &status, 0) == -1
+	  || !WIFEXITED (status)
+	  || WEXITSTATUS (status) != 0)
+	++failures;
+      rewind (out[i]);
+      while ((n = fread (copy, 1, sizeof (copy), out[i])) != 0)
+	fwrite (copy, 1, n, stdout);
+      fclose (out[i]);
+    }
+
+  free (out);
+  free (pids);
+  return failures;
+}
+
+/* Demangle standard input with --jobs worker processes, reading it in
+   blocks that end at a newline.  Returns the number of workers that
+   failed.  */
+
+static int
+filter_with_jobs (const char *valid_symbols)
+{
+  size_t alloc = filter_jobs * JOB_INPUT_SIZE;
+  char *buf = xmalloc (alloc);
+  size_t len = 0;
+  bool eof = false;
+  int failures = 0;
+
+  while (!eof || len != 0)
+    {
+      size_t end;
+
+      while (!eof && len < alloc)
+	{
+	  size_t n = fread (buf + len, 1, alloc - len, stdin);
+
+	  if (n == 0)
+	    eof = true;
+	  len += n;
+	}
+
+      end = len;
+      if (!eof)
+	{
+	  while (end > 0 && buf[end - 1] != '\n')
+	    end--;
+	  if (end == 0)
+	    {
+	      /* A line longer than the buffer.  */
+	      alloc *= 2;
+	      buf = xrealloc (buf, alloc);
+	      continue;
+	    }
+	}
+
+      failures += run_filter_workers (valid_symbols, buf, end);
+      memmove (buf, buf + end, len - end);
+      len -= end;
+    }
+
+  free (buf);
+  return failures;
+}
+#endif
+
 static void
 print_demangler_list (FILE *stream)
 {
@@ -114,7 +312,12 @@ Options are:\n\
   fprintf (stream, "]\n");
 
   fprintf (stream, "\
-  [@<file>]                   Read extra options from <file>\n\
+  [@<file>]                   Read extra options from <file>\n");
+#ifdef HAVE_FORK
+  fprintf (stream, "\
+  [--jobs=N]                  Demangle standard input with N processes\n");
+#endif
+  fprintf (stream, "\
   [-h|--help]                 Display this information\n\
   [-v|--version]              Show the version information\n\
 Demangled names are displayed to stdout.\n\
@@ -193,6 +396,16 @@ main (int argc, char **argv)
 	    }
 	  cplus_demangle_set_style (style);
 	  break;
+	case OPTION_JOBS:
+	  filter_jobs = strtoul (optarg, NULL, 0);
+	  if (filter_jobs == 0)
+	    fatal (_("number of jobs must be positive"));
+#ifndef HAVE_FORK
+	  if (filter_jobs > 1)
+	    non_fatal (_("warning: --jobs is not supported on this host"));
+	  filter_jobs = 1;
+#endif
+	  break;
 	}
     }
 
@@ -200,7 +413,7 @@ main (int argc, char **argv)
     {
       for ( ; optind < argc; optind++)
 	{
-	  demangle_it (argv[optind]);
+	  demangle_it (argv[optind], stdout);
 	  putchar ('\n');
 	}
 
@@ -224,36 +437,18 @@ main (int argc, char **argv)
       fatal ("Internal error: no symbol alphabet for current style");
     }
 
-  for (;;)
+#ifdef HAVE_FORK
+  if (filter_jobs > 1)
     {
-      static char mbuffer[32767];
-      unsigned i = 0;
-
-      c = getchar ();
-      /* Try to read a mangled name.  */
-      while (c != EOF && (ISALNUM (c) || strchr (valid_symbols, c)))
+      if (filter_with_jobs (valid_symbols) != 0)
 	{
-	  if (i >= sizeof (mbuffer) - 1)
-	    break;
-	  mbuffer[i++] = c;
-	  c = getchar ();
+	  fflush (stdout);
+	  fatal (_("a --jobs worker failed"));
 	}
-
-      if (i > 0)
-	{
-	  mbuffer[i] = 0;
-	  demangle_it (mbuffer);
-	}
-
-      if (c == EOF)
-	break;
-
-      /* Echo the whitespace characters so that the output looks
-	 like the input, only with the mangled names demangled.  */
-      putchar (c);
-      if (c == '\n')
-	fflush (stdout);
     }
+  else
+#endif
+    filter (valid_symbols, stdout, true);
 
   fflush (stdout);
   return 0;
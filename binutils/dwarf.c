@@ -36,6 +36,10 @@
 #include <elfutils/debuginfod.h>
 #endif
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #include <limits.h>
 #ifndef CHAR_BIT
 #define CHAR_BIT 8
@@ -116,6 +120,7 @@ bool do_checks;
 
 int dwarf_cutoff_level = -1;
 unsigned long dwarf_start_die;
+int dwarf_jobs = 1;
 
 int dwarf_check = 0;
 
@@ -3536,6 +3541,82 @@ introduce (struct dwarf_section * section, bool raw)
     }
 }
 
+#ifdef HAVE_FORK
+/* Split the display of the units in the SIZE bytes of a .debug_info
+   or .debug_types section between --jobs worker processes.  Each
+   worker writes its output to a temporary file, and the parent copies
+   the files to stdout in order once all the workers have finished.
+   Returns true in a worker, with [*LO, *HI) set to the offsets of the
+   units it should display.  Returns false in the parent, with
+   [*LO, *HI) set to the units that could not be handed to a worker
+   and that the parent must display itself, normally none.  *OK is
+   cleared if a worker failed.  */
+
+static bool
+start_dwarf_workers (size_t size, dwarf_vma *lo, dwarf_vma *hi, bool *ok)
+{
+  FILE **out = xmalloc (dwarf_jobs * sizeof (*out));
+  pid_t *pids = xmalloc (dwarf_jobs * sizeof (*pids));
+  dwarf_vma chunk = (size + dwarf_jobs - 1) / dwarf_jobs;
+  char buf[BUFSIZ];
+  int i, n_workers;
+
+  fflush (stdout);
+  for (i = 0; i < dwarf_jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	{
+	  error (_("Unable to create temporary file: %s\n"),
+		 strerror (errno));
+	  break;
+	}
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	{
+	  error (_("Unable to fork: %s\n"), strerror (errno));
+	  fclose (out[i]);
+	  break;
+	}
+      if (pids[i] == 0)
+	{
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    {
+	      error (_("Unable to redirect output: %s\n"), strerror (errno));
+	      _exit (EXIT_FAILURE);
+	    }
+	  *lo = i * chunk;
+	  *hi = i == dwarf_jobs - 1 ? (dwarf_vma) -1 : *lo + chunk;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  n_workers = i;
+  for (i = 0; i < n_workers; i++)
+    {
+      int status;
+      size_t n;
+
+      if (waitpid (pids[i], &status, 0) == -1
+	  || !WIFEXITED (status)
+	  || WEXITSTATUS (status) != 0)
+	*ok = false;
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+
+  *lo = n_workers * chunk;
+  *hi = n_workers == dwarf_jobs ? 0 : (dwarf_vma) -1;
+  free (out);
+  free (pids);
+  return false;
+}
+#endif
+
 /* Process the contents of a .debug_info section.
    If do_loc is TRUE then we are scanning for location lists and dwo tags
    and we do not want to display anything to the user.
@@ -3558,6 +3639,12 @@ process_debug_info (struct dwarf_section * section,
   unsigned char *section_begin;
   unsigned int unit;
   unsigned int num_units = 0;
+  bool ok = true;
+#ifdef HAVE_FORK
+  bool worker = false;
+  dwarf_vma print_lo = 0;
+  dwarf_vma print_hi = (dwarf_vma) -1;
+#endif
 
   /* First scan the section to get the number of comp units.
      Length sanity checks are done here.  */
@@ -3600,6 +3687,20 @@ process_debug_info (struct dwarf_section * section,
       return false;
     }
 
+#ifdef HAVE_FORK
+  /* With --jobs the units are displayed by worker processes, which
+     cannot pass back what the display records about each unit for
+     the other debug sections.  Collect that first.  */
+  if (dwarf_jobs > 1
+      && !do_loc
+      && dwarf_start_die == 0
+      && num_units > 1
+      && (do_debug_loc || do_debug_ranges || do_debug_info)
+      && num_debug_info_entries == 0
+      && ! do_types)
+    process_debug_info (section, file, abbrev_sec, true, false);
+#endif
+
   if ((do_loc || do_debug_loc || do_debug_ranges || do_debug_info)
       && num_debug_info_entries == 0
       && ! do_types)
@@ -3744,6 +3845,18 @@ process_debug_info (struct dwarf_section * section,
       record_abbrev_list_for_cu (cu_offset, start - section_begin, list);
     }
 
+#ifdef HAVE_FORK
+  if (dwarf_jobs > 1
+      && !do_loc
+      && dwarf_start_die == 0
+      && num_units > 1
+      && (do_types
+	  || num_debug_info_entries != 0
+	  || !(do_debug_loc || do_debug_ranges || do_debug_info)))
+    worker = start_dwarf_workers (end - section_begin,
+				  &print_lo, &print_hi, &ok);
+#endif
+
   for (start = section_begin, unit = 0; start < end; unit++)
     {
       DWARF2_Internal_CompUnit compunit;
@@ -3774,6 +3887,14 @@ process_debug_info (struct dwarf_section * section,
 	offset_size = 4;
       end_cu = hdrptr + compunit.cu_length;
 
+#ifdef HAVE_FORK
+      if (cu_offset < print_lo || cu_offset >= print_hi)
+	{
+	  start = end_cu;
+	  continue;
+	}
+#endif
+
       SAFE_BYTE_GET_AND_INC (compunit.cu_version, hdrptr, 2, end_cu);
 
       this_set = find_cu_tu_set_v2 (cu_offset, do_types);
@@ -4044,7 +4165,8 @@ process_debug_info (struct dwarf_section * section,
 		}
 	      warn (_("DIE at offset 0x%lx refers to abbreviation number %lu which does not exist\n"),
 		    die_offset, abbrev_number);
-	      return false;
+	      ok = false;
+	      goto done;
 	    }
 
 	  if (!do_loc && do_printing)
@@ -4130,6 +4252,17 @@ process_debug_info (struct dwarf_section * section,
 	}
     }
 
+ done:
+#ifdef HAVE_FORK
+  if (worker)
+    {
+      fflush (stdout);
+      _exit (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+#endif
+  if (!ok)
+    return false;
+
   /* Set num_debug_info_entries here so that it can be used to check if
      we need to process .debug_loc and .debug_ranges sections.  */
   if ((do_loc || do_debug_loc || do_debug_ranges || do_debug_info)
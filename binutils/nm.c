@@ -41,6 +41,10 @@
 #include "plugin.h"
 #include "safe-ctype.h"
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #ifndef streq
 #define streq(a,b) (strcmp ((a),(b)) == 0)
 #endif
@@ -100,11 +104,13 @@ static void do_not_print_archive_member (const char *, const char *);
 static void print_symbol_filename_bsd (bfd *, bfd *);
 static void print_symbol_filename_sysv (bfd *, bfd *);
 static void print_symbol_filename_posix (bfd *, bfd *);
+static void print_symbol_filename_json (bfd *, bfd *);
 static void do_not_print_symbol_filename (bfd *, bfd *);
 
 static void print_symbol_info_bsd (struct extended_symbol_info *, bfd *);
 static void print_symbol_info_sysv (struct extended_symbol_info *, bfd *);
 static void print_symbol_info_posix (struct extended_symbol_info *, bfd *);
+static void print_symbol_info_json (struct extended_symbol_info *, bfd *);
 static void just_print_symbol_name (struct extended_symbol_info *, bfd *);
 
 static void print_value (bfd *, bfd_vma);
@@ -136,6 +142,7 @@ enum formats
   FORMAT_SYSV,
   FORMAT_POSIX,
   FORMAT_JUST_SYMBOLS,
+  FORMAT_JSON,
   FORMAT_MAX
 };
 
@@ -162,7 +169,12 @@ static struct output_fns formats[FORMAT_MAX] =
    do_not_print_archive_filename,
    do_not_print_archive_member,
    do_not_print_symbol_filename,
-   just_print_symbol_name}
+   just_print_symbol_name},
+  {do_not_print_object_filename,
+   do_not_print_archive_filename,
+   do_not_print_archive_member,
+   print_symbol_filename_json,
+   print_symbol_info_json}
 };
 
 
@@ -192,6 +204,7 @@ static int line_numbers = 0;	/* Print line numbers for symbols.  */
 static int allow_special_symbols = 0;  /* Allow special symbols.  */
 static int with_symbol_versions = -1; /* Output symbol version information.  */
 static int quiet = 0;		/* Suppress "no symbols" diagnostic.  */
+static int nm_jobs = 1;		/* --jobs */
 
 /* The characters to use for global and local ifunc symbols.  */
 #if DEFAULT_F_FOR_IFUNC_SYMBOLS
@@ -244,7 +257,8 @@ enum long_option_values
   OPTION_NO_RECURSE_LIMIT,
   OPTION_IFUNC_CHARS,
   OPTION_UNICODE,
-  OPTION_QUIET
+  OPTION_QUIET,
+  OPTION_JOBS
 };
 
 static struct option long_options[] =
@@ -256,6 +270,7 @@ static struct option long_options[] =
   {"format", required_argument, 0, 'f'},
   {"help", no_argument, 0, 'h'},
   {"ifunc-chars", required_argument, 0, OPTION_IFUNC_CHARS},
+  {"jobs", required_argument, 0, OPTION_JOBS},
   {"just-symbols", no_argument, 0, 'j'},
   {"line-numbers", no_argument, 0, 'l'},
   {"no-cplus", no_argument, &do_demangle, 0},  /* Linux compatibility.  */
@@ -318,7 +333,7 @@ usage (FILE *stream, int status)
   -e                     (ignored)\n"));
   fprintf (stream, _("\
   -f, --format=FORMAT    Use the output format FORMAT.  FORMAT can be `bsd',\n\
-                           `sysv', `posix' or 'just-symbols'.\n\
+                           `sysv', `posix', `just-symbols' or `json'.\n\
                            The default is `bsd'\n"));
   fprintf (stream, _("\
   -g, --extern-only      Display only external symbols\n"));
@@ -326,6 +341,11 @@ usage (FILE *stream, int status)
     --ifunc-chars=CHARS  Characters to use when displaying ifunc symbols\n"));
   fprintf (stream, _("\
   -j, --just-symbols     Same as --format=just-symbols\n"));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+      --jobs=N           Display the files, or the members of an archive,\n\
+                           with N processes\n"));
+#endif
   fprintf (stream, _("\
   -l, --line-numbers     Use debugging information to find a filename and\n\
                            line number for each symbol\n"));
@@ -408,6 +428,14 @@ set_output_format (char *f)
 {
   int i;
 
+  /* Only the first character of the other format names is checked.  */
+  if (strcasecmp (f, "json") == 0)
+    {
+      format = &formats[FORMAT_JSON];
+      print_format = FORMAT_JSON;
+      return;
+    }
+
   switch (*f)
     {
     case 'b':
@@ -673,8 +701,33 @@ convert_utf8 (const char * in)
   return buffer;
 }
 
+/* Print STR as a JSON string, escaping quotes, backslashes and control
+   characters.  Other bytes are copied unchanged.  */
+
+static void
+print_json_string (const char *str)
+{
+  const unsigned char *p;
+
+  putchar ('"');
+  for (p = (const unsigned char *) str; *p != 0; p++)
+    {
+      if (*p == '"' || *p == '\\')
+	{
+	  putchar ('\\');
+	  putchar (*p);
+	}
+      else if (*p < 0x20)
+	printf ("\\u%04x", *p);
+      else
+	putchar (*p);
+    }
+  putchar ('"');
+}
+
 /* Print symbol name NAME, read from ABFD, with printf format FORM,
-   demangling it if requested.  */
+   demangling it if requested.  If FORM is NULL, print NAME as a JSON
+   string.  */
 
 static void
 print_symname (const char *form, struct extended_symbol_info *info,
@@ -724,7 +777,10 @@ print_symname (const char *form, struct extended_symbol_info *info,
 	    name = alloc;
 	}
     }
-  printf (form, name);
+  if (form == NULL)
+    print_json_string (name);
+  else
+    printf (form, name);
   if (atver)
     *atver = '@';
   free (alloc);
@@ -1172,6 +1228,21 @@ get_relocs (bfd *abfd, asection *sec, void *dataarg)
   ++data->relcount;
 }
 
+/* Print the source FILENAME and LINENO found for a symbol.  */
+
+static void
+print_line_number (const char *filename, unsigned int lineno)
+{
+  if (print_format == FORMAT_JSON)
+    {
+      fputs (",\"source\":", stdout);
+      print_json_string (filename);
+      printf (",\"line\":%u", lineno);
+    }
+  else
+    printf ("\t%s:%u", filename, lineno);
+}
+
 /* Print a single symbol.  */
 
 static void
@@ -1310,7 +1381,7 @@ print_symbol (bfd *        abfd,
 		      && filename != NULL)
 		    {
 		      /* We only print the first one we find.  */
-		      printf ("\t%s:%u", filename, lineno);
+		      print_line_number (filename, lineno);
 		      i = seccount;
 		      break;
 		    }
@@ -1325,10 +1396,12 @@ print_symbol (bfd *        abfd,
 					 &functionname, &lineno))
 	      && filename != NULL
 	      && lineno != 0)
-	    printf ("\t%s:%u", filename, lineno);
+	    print_line_number (filename, lineno);
 	}
     }
 
+  if (print_format == FORMAT_JSON)
+    putchar ('}');
   putchar ('\n');
 }
 
@@ -1590,19 +1663,139 @@ set_print_width (bfd *file)
   print_format_string = get_print_format ();
 }
 
-static void
+#ifdef HAVE_FORK
+/* Split COUNT items, either archive members or command line files,
+   between --jobs worker processes.  Each worker writes its output to a
+   temporary file, and the parent copies the files to stdout in order
+   once all the workers have finished.  Returns true in a worker, with
+   [*LO, *HI) set to the items it should display.  Returns false in the
+   parent when the output is complete, with the sum of the workers' exit
+   statuses in *FAILURES.  */
+
+static bool
+start_nm_workers (unsigned long count, unsigned long *lo, unsigned long *hi,
+		  int *failures)
+{
+  unsigned long jobs = count;
+  FILE **out;
+  pid_t *pids;
+  char buf[BUFSIZ];
+  unsigned long i;
+
+  if ((unsigned long) nm_jobs < jobs)
+    jobs = nm_jobs;
+  out = xmalloc (jobs * sizeof (*out));
+  pids = xmalloc (jobs * sizeof (*pids));
+
+  fflush (stdout);
+  for (i = 0; i < jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	fatal (_("can't create temporary file: %s"), strerror (errno));
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	fatal (_("can't fork: %s"), strerror (errno));
+      if (pids[i] == 0)
+	{
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    fatal (_("can't redirect output: %s"), strerror (errno));
+	  /* Stop the workers sharing the parent's file offsets.  */
+	  bfd_cache_close_all ();
+	  *lo = count * i / jobs;
+	  *hi = count * (i + 1) / jobs;
+	  nm_jobs = 1;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  *failures = 0;
+  for (i = 0; i < jobs; i++)
+    {
+      int status;
+      size_t n;
+
+      if (waitpid (pids[i], &status, 0) == -1 || !WIFEXITED (status))
+	++*failures;
+      else
+	*failures += WEXITSTATUS (status);
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+  bfd_cache_close_all ();
+
+  free (out);
+  free (pids);
+  return false;
+}
+
+/* Return the number of members in archive FILE.  */
+
+static unsigned long
+count_archive_members (bfd *file)
+{
+  bfd *arfile = NULL;
+  bfd *last_arfile = NULL;
+  unsigned long count = 0;
+
+  while ((arfile = bfd_openr_next_archived_file (file, arfile)) != NULL)
+    {
+      if (last_arfile != NULL)
+	{
+	  bfd_close (last_arfile);
+	  if (arfile == last_arfile)
+	    return count;
+	}
+      last_arfile = arfile;
+      count++;
+    }
+
+  if (last_arfile != NULL)
+    bfd_close (last_arfile);
+  return count;
+}
+#endif
+
+/* Display the symbols of the members of archive FILE.  Returns false if
+   a --jobs worker failed.  */
+
+static bool
 display_archive (bfd *file)
 {
   bfd *arfile = NULL;
   bfd *last_arfile = NULL;
   char **matching;
+  unsigned long idx = 0;
+  unsigned long lo = 0;
+  unsigned long hi = -1ul;
+  bool worker = false;
 
   format->print_archive_filename (bfd_get_filename (file));
 
   if (print_armap)
     print_symdef_entry (file);
 
-  for (;;)
+#ifdef HAVE_FORK
+  if (nm_jobs > 1)
+    {
+      unsigned long count = count_archive_members (file);
+
+      if (count > 1)
+	{
+	  int failures;
+
+	  worker = start_nm_workers (count, &lo, &hi, &failures);
+	  if (!worker)
+	    return failures == 0;
+	}
+    }
+#endif
+
+  for (;; idx++)
     {
       PROGRESS (1);
 
@@ -1615,7 +1808,9 @@ display_archive (bfd *file)
 	  break;
 	}
 
-      if (bfd_check_format_matches (arfile, bfd_object, &matching))
+      if (idx < lo || idx >= hi)
+	;
+      else if (bfd_check_format_matches (arfile, bfd_object, &matching))
 	{
 	  set_print_width (arfile);
 	  format->print_archive_member (bfd_get_filename (file),
@@ -1635,17 +1830,24 @@ display_archive (bfd *file)
 	  lineno_cache_bfd = NULL;
 	  lineno_cache_rel_bfd = NULL;
 	  if (arfile == last_arfile)
-	    return;
+	    break;
 	}
       last_arfile = arfile;
     }
 
-  if (last_arfile != NULL)
+  if (worker)
+    {
+      fflush (stdout);
+      _exit (0);
+    }
+
+  if (last_arfile != NULL && arfile != last_arfile)
     {
       bfd_close (last_arfile);
       lineno_cache_bfd = NULL;
       lineno_cache_rel_bfd = NULL;
     }
+  return true;
 }
 
 static bool
@@ -1671,7 +1873,8 @@ display_file (char *filename)
 
   if (bfd_check_format (file, bfd_archive))
     {
-      display_archive (file);
+      if (!display_archive (file))
+	retval = false;
     }
   else if (bfd_check_format_matches (file, bfd_object, &matching))
     {
@@ -1839,6 +2042,24 @@ print_symbol_filename_posix (bfd *archive_bfd, bfd *abfd)
     }
 }
 
+/* JSON output has one object per symbol, which always records the file
+   (and archive) the symbol came from.  This starts the object, and
+   print_symbol closes it.  */
+
+static void
+print_symbol_filename_json (bfd *archive_bfd, bfd *abfd)
+{
+  putchar ('{');
+  if (archive_bfd)
+    {
+      fputs ("\"archive\":", stdout);
+      print_json_string (bfd_get_filename (archive_bfd));
+      putchar (',');
+    }
+  fputs ("\"file\":", stdout);
+  print_json_string (bfd_get_filename (abfd));
+}
+
 static void
 do_not_print_symbol_filename (bfd *archive_bfd ATTRIBUTE_UNUSED,
 			      bfd *abfd ATTRIBUTE_UNUSED)
@@ -1978,6 +2199,53 @@ print_symbol_info_posix (struct extended_symbol_info *info, bfd *abfd)
     }
 }
 
+static void
+print_symbol_info_json (struct extended_symbol_info *info, bfd *abfd)
+{
+  char type[2];
+
+  fputs (",\"name\":", stdout);
+  print_symname (NULL, info, NULL, abfd);
+
+  type[0] = SYM_TYPE (info);
+  type[1] = 0;
+  fputs (",\"type\":", stdout);
+  print_json_string (type);
+
+  /* Values and sizes are printed as hex strings: JSON numbers are
+     often read as doubles, which can't hold every 64-bit address.  */
+  if (!bfd_is_undefined_symclass (SYM_TYPE (info)))
+    printf (",\"value\":\"0x%" PRIx64 "\"", (uint64_t) SYM_VALUE (info));
+
+  if (SYM_TYPE (info) == '-')
+    {
+      /* A stab.  */
+      printf (",\"stab_other\":%d,\"stab_desc\":%d",
+	      SYM_STAB_OTHER (info), SYM_STAB_DESC (info));
+      if (SYM_STAB_NAME (info) != NULL)
+	{
+	  fputs (",\"stab_name\":", stdout);
+	  print_json_string (SYM_STAB_NAME (info));
+	}
+    }
+  else
+    {
+      if (SYM_SIZE (info))
+	printf (",\"size\":\"0x%" PRIx64 "\"", (uint64_t) SYM_SIZE (info));
+
+      if (info->elfinfo)
+	{
+	  fputs (",\"section\":", stdout);
+	  print_json_string (info->elfinfo->symbol.section->name);
+	}
+      else if (info->coffinfo)
+	{
+	  fputs (",\"section\":", stdout);
+	  print_json_string (info->coffinfo->symbol.section->name);
+	}
+    }
+}
+
 static void
 just_print_symbol_name (struct extended_symbol_info *info, bfd *abfd)
 {
@@ -2051,6 +2319,16 @@ main (int argc, char **argv)
 	case OPTION_QUIET:
 	  quiet = 1;
 	  break;
+	case OPTION_JOBS:
+	  nm_jobs = strtoul (optarg, NULL, 0);
+	  if (nm_jobs <= 0)
+	    fatal (_("number of jobs must be positive"));
+#ifndef HAVE_FORK
+	  if (nm_jobs > 1)
+	    non_fatal (_("warning: --jobs is not supported on this host"));
+	  nm_jobs = 1;
+#endif
+	  break;
 	case 'D':
 	  dynamic = 1;
 	  break;
@@ -2190,6 +2468,24 @@ main (int argc, char **argv)
   if (argc - optind > 1)
     filename_per_file = 1;
 
+#ifdef HAVE_FORK
+  if (nm_jobs > 1 && argc - optind > 1)
+    {
+      unsigned long lo, hi;
+
+      if (start_nm_workers (argc - optind, &lo, &hi, &retval))
+	{
+	  retval = 0;
+	  for (; lo < hi; lo++)
+	    if (!display_file (argv[optind + lo]))
+	      retval++;
+	  fflush (stdout);
+	  _exit (retval);
+	}
+      optind = argc;
+    }
+#endif
+
   /* We were given several filenames to do.  */
   while (optind < argc)
     {
@@ -32,6 +32,10 @@
 #include "libcoff.h"
 #include "safe-ctype.h"
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 /* FIXME: See bfd/peXXigen.c for why we include an architecture specific
    header in generic PE code.  */
 #include "coff/i386.h"
@@ -96,6 +100,7 @@ static bool verbose;		/* Print file and target names.  */
 static bool preserve_dates;	/* Preserve input file timestamp.  */
 static int deterministic = -1;		/* Enable deterministic archives.  */
 static int status = 0;			/* Exit status.  */
+static int copy_jobs = 1;		/* --jobs */
 
 static bool    merge_notes = false;	/* Merge note sections.  */
 
@@ -232,7 +237,8 @@ static enum
   compress_zlib = compress | 1 << 1,
   compress_gnu_zlib = compress | 1 << 2,
   compress_gabi_zlib = compress | 1 << 3,
-  decompress = 1 << 4
+  compress_zstd = compress | 1 << 4,
+  decompress = 1 << 5
 } do_debug_sections = nothing;
 
 /* Whether to generate ELF common symbols with the STT_COMMON type.  */
@@ -333,6 +339,7 @@ enum command_line_switch
   OPTION_IMAGE_BASE,
   OPTION_IMPURE,
   OPTION_INTERLEAVE_WIDTH,
+  OPTION_JOBS,
   OPTION_KEEPGLOBAL_SYMBOLS,
   OPTION_KEEP_FILE_SYMBOLS,
   OPTION_KEEP_SECTION,
@@ -390,6 +397,7 @@ static struct option strip_options[] =
   {"info", no_argument, 0, OPTION_FORMATS_INFO},
   {"input-format", required_argument, 0, 'I'}, /* Obsolete */
   {"input-target", required_argument, 0, 'I'},
+  {"jobs", required_argument, 0, OPTION_JOBS},
   {"keep-section-symbols", no_argument, 0, OPTION_KEEP_SECTION_SYMBOLS},
   {"keep-file-symbols", no_argument, 0, OPTION_KEEP_FILE_SYMBOLS},
   {"keep-section", required_argument, 0, OPTION_KEEP_SECTION},
@@ -461,6 +469,7 @@ static struct option copy_options[] =
   {"input-target", required_argument, 0, 'I'},
   {"interleave", optional_argument, 0, 'i'},
   {"interleave-width", required_argument, 0, OPTION_INTERLEAVE_WIDTH},
+  {"jobs", required_argument, 0, OPTION_JOBS},
   {"keep-file-symbols", no_argument, 0, OPTION_KEEP_FILE_SYMBOLS},
   {"keep-global-symbol", required_argument, 0, 'G'},
   {"keep-global-symbols", required_argument, 0, OPTION_KEEPGLOBAL_SYMBOLS},
@@ -678,9 +687,9 @@ copy_usage (FILE *stream, int exit_status)
                                    <commit>\n\
      --subsystem <name>[:<version>]\n\
                                    Set PE subsystem to <name> [& <version>]\n\
-     --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}]\n\
-                                   Compress DWARF debug sections using zlib\n\
-     --decompress-debug-sections   Decompress DWARF debug sections using zlib\n\
+     --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi|zstd}]\n\
+                                   Compress DWARF debug sections\n\
+     --decompress-debug-sections   Decompress DWARF debug sections\n\
      --elf-stt-common=[yes|no]     Generate ELF common symbols with STT_COMMON\n\
                                      type\n\
      --verilog-data-width <number> Specifies data width, in bytes, for verilog output\n\
@@ -692,6 +701,11 @@ copy_usage (FILE *stream, int exit_status)
   -h --help                        Display this output\n\
      --info                        List object formats & architectures supported\n\
 "));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+     --jobs=N                      Copy the members of an archive with N processes\n\
+"));
+#endif
   list_supported_targets (program_name, stream);
   if (REPORT_BUGS_TO[0] && exit_status == 0)
     fprintf (stream, _("Report bugs to %s\n"), REPORT_BUGS_TO);
@@ -746,6 +760,12 @@ strip_usage (FILE *stream, int exit_status)
      --info                        List object formats & architectures supported\n\
   -o <file>                        Place stripped output into <file>\n\
 "));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+     --jobs=N                      Strip the input files, or the members of an\n\
+                                     archive, with N processes\n\
+"));
+#endif
 
   list_supported_targets (program_name, stream);
   if (REPORT_BUGS_TO[0] && exit_status == 0)
@@ -2645,7 +2665,7 @@ copy_object (bfd *ibfd, bfd *obfd, const bfd_arch_info_type *input_arch)
       if ((do_debug_sections & compress) != 0
 	  && do_debug_sections != compress)
 	{
-	  non_fatal (_("--compress-debug-sections=[zlib|zlib-gnu|zlib-gabi] is unsupported on `%s'"),
+	  non_fatal (_("--compress-debug-sections=[zlib|zlib-gnu|zlib-gabi|zstd] is unsupported on `%s'"),
 		     bfd_get_archive_filename (ibfd));
 	  return false;
 	}
@@ -3501,6 +3521,183 @@ copy_object (bfd *ibfd, bfd *obfd, const bfd_arch_info_type *input_arch)
   return true;
 }
 
+/* Parse the argument of --jobs.  */
+
+static void
+set_copy_jobs (const char *arg)
+{
+  copy_jobs = strtoul (arg, NULL, 0);
+  if (copy_jobs <= 0)
+    fatal (_("number of jobs must be positive"));
+#ifndef HAVE_FORK
+  if (copy_jobs > 1)
+    non_fatal (_("warning: --jobs is not supported on this host"));
+  copy_jobs = 1;
+#endif
+}
+
+#ifdef HAVE_FORK
+/* Split COUNT items, either archive members or input files, between
+   --jobs worker processes.  Each worker writes anything it prints on
+   stdout to a temporary file, and the parent copies the files to stdout
+   in order once all the workers have finished.  Returns true in a
+   worker, with [*LO, *HI) set to the items it should copy.  Returns
+   false in the parent, with the number of workers that failed in
+   *FAILURES.  */
+
+static bool
+start_copy_workers (unsigned long count, unsigned long *lo,
+		    unsigned long *hi, int *failures)
+{
+  unsigned long jobs = count;
+  FILE **out;
+  pid_t *pids;
+  char buf[BUFSIZ];
+  unsigned long i;
+
+  if ((unsigned long) copy_jobs < jobs)
+    jobs = copy_jobs;
+  out = xmalloc (jobs * sizeof (*out));
+  pids = xmalloc (jobs * sizeof (*pids));
+
+  fflush (stdout);
+  for (i = 0; i < jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	fatal (_("can't create temporary file: %s"), strerror (errno));
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	fatal (_("can't fork: %s"), strerror (errno));
+      if (pids[i] == 0)
+	{
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    fatal (_("can't redirect output: %s"), strerror (errno));
+	  /* Stop the workers sharing the parent's file offsets.  */
+	  bfd_cache_close_all ();
+	  *lo = count * i / jobs;
+	  *hi = count * (i + 1) / jobs;
+	  copy_jobs = 1;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  *failures = 0;
+  for (i = 0; i < jobs; i++)
+    {
+      int wstatus;
+      size_t n;
+
+      if (waitpid (pids[i], &wstatus, 0) == -1
+	  || !WIFEXITED (wstatus)
+	  || WEXITSTATUS (wstatus) != 0)
+	++*failures;
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+  bfd_cache_close_all ();
+
+  free (out);
+  free (pids);
+  return false;
+}
+
+/* Return true if the uses of any --change-section-vma or
+   --change-section-lma options are being tracked for the "never used"
+   warnings.  Workers could not report the uses back, so archives are
+   then copied in one process.  */
+
+static bool
+change_sections_tracked (void)
+{
+  struct section_list *p;
+
+  for (p = change_sections; p != NULL; p = p->next)
+    if ((p->context & (SECTION_CONTEXT_SET_VMA | SECTION_CONTEXT_ALTER_VMA
+		       | SECTION_CONTEXT_SET_LMA | SECTION_CONTEXT_ALTER_LMA))
+	!= 0)
+      return true;
+  return false;
+}
+#endif
+
+/* Copy archive member THIS_ELEMENT to a new file called OUTPUT_NAME.
+   Returns false, having removed the file, if the member could not be
+   copied.  If the file could not even be created, *ABORT_COPY is set
+   too.  STATUS is set on any error.  */
+
+static bool
+copy_archive_element (bfd *this_element, const char *output_name,
+		      const char *output_target, bool force_output_target,
+		      const bfd_arch_info_type *input_arch,
+		      struct stat *buf, int stat_status, bool *abort_copy)
+{
+  bfd *output_bfd;
+  bool del = true;
+  bool ok_object;
+
+  ok_object = bfd_check_format (this_element, bfd_object);
+  if (!ok_object)
+    bfd_nonfatal_message (NULL, this_element, NULL,
+			  _("Unable to recognise the format of file"));
+
+  /* PR binutils/3110: Cope with archives
+     containing multiple target types.  */
+  if (force_output_target || !ok_object)
+    output_bfd = bfd_openw (output_name, output_target);
+  else
+    output_bfd = bfd_openw (output_name, bfd_get_target (this_element));
+
+  if (output_bfd == NULL)
+    {
+      bfd_nonfatal_message (output_name, NULL, NULL, NULL);
+      status = 1;
+      *abort_copy = true;
+      return false;
+    }
+
+  if (ok_object)
+    {
+      del = !copy_object (this_element, output_bfd, input_arch);
+
+      if (del && bfd_get_arch (this_element) == bfd_arch_unknown)
+	/* Try again as an unknown object file.  */
+	ok_object = false;
+      else if (!bfd_close (output_bfd))
+	{
+	  bfd_nonfatal_message (output_name, NULL, NULL, NULL);
+	  /* Error in new object file. Don't change archive.  */
+	  status = 1;
+	}
+    }
+
+  if (!ok_object)
+    {
+      del = !copy_unknown_object (this_element, output_bfd);
+      if (!bfd_close_all_done (output_bfd))
+	{
+	  bfd_nonfatal_message (output_name, NULL, NULL, NULL);
+	  /* Error in new object file. Don't change archive.  */
+	  status = 1;
+	}
+    }
+
+  if (del)
+    {
+      unlink (output_name);
+      status = 1;
+      return false;
+    }
+
+  if (preserve_dates && stat_status == 0)
+    set_times (output_name, buf);
+  return true;
+}
+
 /* Read each archive element in turn from IBFD, copy the
    contents to temp file, and keep the temp file handle.
    If 'force_output_target' is TRUE then make sure that
@@ -3522,6 +3719,19 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
   bfd *this_element;
   char *dir;
   const char *filename;
+  bool abort_copy = false;
+#ifdef HAVE_FORK
+  struct archive_job_member
+    {
+      bfd *element;
+      struct name_list *l;
+      struct stat buf;
+      int stat_status;
+    } *jobs_members = NULL;
+  unsigned long jobs_count = 0;
+  unsigned long jobs_alloc = 0;
+  htab_t jobs_names = NULL;
+#endif
 
   /* PR 24281: It is not clear what should happen when copying a thin archive.
      One part is straight forward - if the output archive is in a different
@@ -3570,6 +3780,20 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
       goto cleanup_and_exit;
     }
 
+#ifdef HAVE_FORK
+  /* With --jobs, first give every member its output file name, then
+     share the copying out between worker processes.  Member names are
+     tracked in a table, as the files that would show up duplicates do
+     not exist yet.  */
+  if (copy_jobs > 1 && this_element != NULL && !change_sections_tracked ())
+    {
+      jobs_alloc = 16;
+      jobs_members = xmalloc (jobs_alloc * sizeof (*jobs_members));
+      jobs_names = htab_create_alloc (16, htab_hash_string, htab_eq_string,
+				      NULL, xcalloc, free);
+    }
+#endif
+
   while (!status && this_element != NULL)
     {
       char *output_name;
@@ -3577,8 +3801,7 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
       bfd *last_element;
       struct stat buf;
       int stat_status = 0;
-      bool del = true;
-      bool ok_object;
+      bool exists;
 
       /* PR binutils/17533: Do not allow directory traversal
 	 outside of the current directory tree by archive members.  */
@@ -3595,7 +3818,19 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
 			    bfd_get_filename (this_element), (char *) 0);
 
       /* If the file already exists, make another temp dir.  */
-      if (stat (output_name, &buf) >= 0)
+#ifdef HAVE_FORK
+      if (jobs_names != NULL)
+	{
+	  void **slot = htab_find_slot (jobs_names, output_name, INSERT);
+
+	  exists = *slot != NULL;
+	  if (!exists)
+	    *slot = output_name;
+	}
+      else
+#endif
+	exists = stat (output_name, &buf) >= 0;
+      if (exists)
 	{
 	  char * tmpdir = make_tempdir (output_name);
 
@@ -3633,61 +3868,35 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
       l->obfd = NULL;
       list = l;
 
-      ok_object = bfd_check_format (this_element, bfd_object);
-      if (!ok_object)
-	bfd_nonfatal_message (NULL, this_element, NULL,
-			      _("Unable to recognise the format of file"));
-
-      /* PR binutils/3110: Cope with archives
-	 containing multiple target types.  */
-      if (force_output_target || !ok_object)
-	output_bfd = bfd_openw (output_name, output_target);
-      else
-	output_bfd = bfd_openw (output_name, bfd_get_target (this_element));
-
-      if (output_bfd == NULL)
-	{
-	  bfd_nonfatal_message (output_name, NULL, NULL, NULL);
-	  status = 1;
-	  goto cleanup_and_exit;
-	}
-
-      if (ok_object)
-	{
-	  del = !copy_object (this_element, output_bfd, input_arch);
-
-	  if (del && bfd_get_arch (this_element) == bfd_arch_unknown)
-	    /* Try again as an unknown object file.  */
-	    ok_object = false;
-	  else if (!bfd_close (output_bfd))
-	    {
-	      bfd_nonfatal_message (output_name, NULL, NULL, NULL);
-	      /* Error in new object file. Don't change archive.  */
-	      status = 1;
-	    }
-	}
-
-      if (!ok_object)
+#ifdef HAVE_FORK
+      if (jobs_members != NULL)
 	{
-	  del = !copy_unknown_object (this_element, output_bfd);
-	  if (!bfd_close_all_done (output_bfd))
+	  /* Just record the member for now.  */
+	  if (jobs_count == jobs_alloc)
 	    {
-	      bfd_nonfatal_message (output_name, NULL, NULL, NULL);
-	      /* Error in new object file. Don't change archive.  */
-	      status = 1;
+	      jobs_alloc = jobs_alloc * 2 + 16;
+	      jobs_members = xrealloc (jobs_members,
+				       jobs_alloc * sizeof (*jobs_members));
 	    }
+	  jobs_members[jobs_count].element = this_element;
+	  jobs_members[jobs_count].l = l;
+	  jobs_members[jobs_count].buf = buf;
+	  jobs_members[jobs_count].stat_status = stat_status;
+	  jobs_count++;
+	  this_element = bfd_openr_next_archived_file (ibfd, this_element);
+	  continue;
 	}
+#endif
 
-      if (del)
+      if (!copy_archive_element (this_element, output_name, output_target,
+				 force_output_target, input_arch,
+				 &buf, stat_status, &abort_copy))
 	{
-	  unlink (output_name);
-	  status = 1;
+	  if (abort_copy)
+	    goto cleanup_and_exit;
 	}
       else
 	{
-	  if (preserve_dates && stat_status == 0)
-	    set_times (output_name, &buf);
-
 	  /* Open the newly output file and attach to our list.  */
 	  output_bfd = bfd_openr (output_name, output_target);
 
@@ -3703,6 +3912,47 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
 	  bfd_close (last_element);
 	}
     }
+
+#ifdef HAVE_FORK
+  if (jobs_members != NULL)
+    {
+      unsigned long i, lo, hi;
+      int failures;
+
+      if (!status
+	  && start_copy_workers (jobs_count, &lo, &hi, &failures))
+	{
+	  for (i = lo; i < hi && !status; i++)
+	    copy_archive_element (jobs_members[i].element,
+				  jobs_members[i].l->name, output_target,
+				  force_output_target, input_arch,
+				  &jobs_members[i].buf,
+				  jobs_members[i].stat_status, &abort_copy);
+	  fflush (stdout);
+	  _exit (status);
+	}
+      if (!status && failures != 0)
+	status = 1;
+
+      /* Attach the copies to the output archive in order, or if anything
+	 went wrong, remove whatever the workers left behind.  */
+      for (i = 0; i < jobs_count; i++)
+	{
+	  if (status)
+	    unlink (jobs_members[i].l->name);
+	  else
+	    {
+	      bfd *output_bfd = bfd_openr (jobs_members[i].l->name,
+					   output_target);
+
+	      jobs_members[i].l->obfd = output_bfd;
+	      *ptr = output_bfd;
+	      ptr = &output_bfd->archive_next;
+	    }
+	  bfd_close (jobs_members[i].element);
+	}
+    }
+#endif
   *ptr = NULL;
 
   filename = bfd_get_filename (obfd);
@@ -3738,6 +3988,12 @@ copy_archive (bfd *ibfd, bfd *obfd, const char *output_target,
       }
   }
 
+#ifdef HAVE_FORK
+  free (jobs_members);
+  if (jobs_names != NULL)
+    htab_delete (jobs_names);
+#endif
+
   rmdir (dir);
 }
 
@@ -3791,11 +4047,14 @@ copy_file (const char *input_filename, const char *output_filename, int ofd,
     case compress_zlib:
     case compress_gnu_zlib:
     case compress_gabi_zlib:
+    case compress_zstd:
       ibfd->flags |= BFD_COMPRESS;
       /* Don't check if input is ELF here since this information is
 	 only available after bfd_check_format_matches is called.  */
       if (do_debug_sections != compress_gnu_zlib)
 	ibfd->flags |= BFD_COMPRESS_GABI;
+      if (do_debug_sections == compress_zstd)
+	ibfd->flags |= BFD_COMPRESS_ZSTD;
       break;
     case decompress:
       ibfd->flags |= BFD_DECOMPRESS;
@@ -4372,6 +4631,38 @@ copy_relocations_in_section (bfd *ibfd, sec_ptr isection, void *obfdarg)
     }
 }
 
+/* Sections whose contents are copied unchanged are copied this many
+   bytes at a time, rather than being read into memory whole.  */
+#define COPY_SECTION_PIECE (1024 * 1024)
+
+/* Return true if ISECTION of IBFD, which is SIZE bytes long, can be
+   copied to OBFD a piece at a time.  That is so when nothing will
+   change its contents: it is not compressed, no byte reversal or
+   interleaving is requested, and bfd_convert_section_contents would
+   leave it alone.  Small sections, and those that claim to be larger
+   than the file (so that the usual error is given), are not worth it.  */
+
+static bool
+copy_section_in_pieces_p (bfd *ibfd, asection *isection, bfd *obfd,
+			  bfd_size_type size)
+{
+  ufile_ptr filesize;
+
+  if (size <= COPY_SECTION_PIECE
+      || reverse_bytes != 0
+      || copy_byte >= 0
+      || isection->compress_status != COMPRESS_SECTION_NONE
+      || isection->rawsize != 0
+      || bfd_get_flavour (ibfd) != bfd_target_elf_flavour
+      || bfd_get_flavour (obfd) != bfd_target_elf_flavour
+      || (get_elf_backend_data (ibfd)->s->elfclass
+	  != get_elf_backend_data (obfd)->s->elfclass))
+    return false;
+
+  filesize = bfd_get_file_size (ibfd);
+  return filesize == 0 || size <= filesize;
+}
+
 /* Copy the data of input section ISECTION of IBFD
    to an output section with the same name in OBFD.  */
 
@@ -4394,7 +4685,34 @@ copy_section (bfd *ibfd, sec_ptr isection, void *obfdarg)
   size = bfd_section_size (isection);
 
   if (bfd_section_flags (isection) & SEC_HAS_CONTENTS
-      && bfd_section_flags (osection) & SEC_HAS_CONTENTS)
+      && bfd_section_flags (osection) & SEC_HAS_CONTENTS
+      && copy_section_in_pieces_p (ibfd, isection, obfd, size))
+    {
+      bfd_byte *buf = xmalloc (COPY_SECTION_PIECE);
+      bfd_size_type offset, count;
+
+      for (offset = 0; offset < size; offset += count)
+	{
+	  count = size - offset;
+	  if (count > COPY_SECTION_PIECE)
+	    count = COPY_SECTION_PIECE;
+	  if (!bfd_get_section_contents (ibfd, isection, buf, offset, count))
+	    {
+	      status = 1;
+	      bfd_nonfatal_message (NULL, ibfd, isection, NULL);
+	      break;
+	    }
+	  if (!bfd_set_section_contents (obfd, osection, buf, offset, count))
+	    {
+	      status = 1;
+	      bfd_nonfatal_message (NULL, obfd, osection, NULL);
+	      break;
+	    }
+	}
+      free (buf);
+    }
+  else if (bfd_section_flags (isection) & SEC_HAS_CONTENTS
+	   && bfd_section_flags (osection) & SEC_HAS_CONTENTS)
     {
       bfd_byte *memhunk = NULL;
 
@@ -4774,6 +5092,9 @@ strip_main (int argc, char *argv[])
 	case OPTION_KEEP_SECTION_SYMBOLS:
 	  keep_section_symbols = true;
 	  break;
+	case OPTION_JOBS:
+	  set_copy_jobs (optarg);
+	  break;
 	case 0:
 	  /* We've been given a long option.  */
 	  break;
@@ -4823,6 +5144,24 @@ strip_main (int argc, char *argv[])
       || (output_file != NULL && (i + 1) < argc))
     strip_usage (stderr, 1);
 
+#ifdef HAVE_FORK
+  if (copy_jobs > 1 && argc - i > 1)
+    {
+      unsigned long lo, hi;
+      int failures;
+
+      if (!start_copy_workers (argc - i, &lo, &hi, &failures))
+	{
+	  status = failures != 0;
+	  return status;
+	}
+      /* This is a worker.  Strip its share of the files, and return
+	 the status for them.  */
+      argc = i + hi;
+      i += lo;
+    }
+#endif
+
   for (; i < argc; i++)
     {
       int hold_status = status;
@@ -5148,6 +5487,10 @@ copy_main (int argc, char *argv[])
 	    fatal(_("interleave width must be positive"));
 	  break;
 
+	case OPTION_JOBS:
+	  set_copy_jobs (optarg);
+	  break;
+
 	case 'I':
 	case 's':		/* "source" - 'I' is preferred */
 	  input_target = optarg;
@@ -5462,6 +5805,15 @@ copy_main (int argc, char *argv[])
 		do_debug_sections = compress_gnu_zlib;
 	      else if (strcasecmp (optarg, "zlib-gabi") == 0)
 		do_debug_sections = compress_gabi_zlib;
+	      else if (strcasecmp (optarg, "zstd") == 0)
+		{
+#ifdef HAVE_ZSTD
+		  do_debug_sections = compress_zstd;
+#else
+		  fatal (_("--compress-debug-sections=zstd: binutils is not"
+			   " built with zstd support"));
+#endif
+		}
 	      else
 		fatal (_("unrecognized --compress-debug-sections type `%s'"),
 		       optarg);
@@ -72,6 +72,10 @@
 #include <sys/mman.h>
 #endif
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 /* Internal headers for the ELF .stab-dump code - sorry.  */
 #define	BYTES_IN_WORD	32
 #include "aout/aout64.h"
@@ -111,6 +115,7 @@ static int disassemble_zeroes;		/* --disassemble-zeroes */
 static bool formats_info;		/* -i */
 static int wide_output;			/* -w */
 static int insn_width;			/* --insn-width */
+static int disasm_jobs = 1;		/* --jobs */
 static bfd_vma start_address = (bfd_vma) -1; /* --start-address */
 static bfd_vma stop_address = (bfd_vma) -1;  /* --stop-address */
 static int dump_debugging;		/* --debugging */
@@ -190,6 +195,26 @@ static asymbol **sorted_syms;
 /* Number of symbols in `sorted_syms'.  */
 static long sorted_symcount = 0;
 
+/* The symbols sorted by compare_symbols alone.  `sorted_syms' is this
+   array rearranged for the section being disassembled.  */
+static asymbol **value_sorted_syms;
+
+/* Indices in `value_sorted_syms', ordered by section name and then
+   by index.  */
+static long *section_name_places;
+
+/* The section `sorted_syms' is arranged for, and the indices in
+   `sorted_syms' of the symbols from sections with the same name, in
+   increasing order.  */
+static asection *sorted_syms_section;
+static long *sorted_section_places;
+static long sorted_section_count;
+
+/* Pairs of indices delimiting the ranges of `sorted_syms' that differ
+   from `value_sorted_syms'.  */
+static long *moved_syms_ranges;
+static long moved_syms_count;
+
 /* The dynamic symbol table.  */
 static asymbol **dynsyms;
 
@@ -376,6 +401,11 @@ usage (FILE *stream, int status)
       --[no-]show-raw-insn       Display hex alongside symbolic disassembly\n"));
       fprintf (stream, _("\
       --insn-width=WIDTH         Display WIDTH bytes on a single line for -d\n"));
+#ifdef HAVE_FORK
+      fprintf (stream, _("\
+      --jobs=N                   Disassemble each section, and display the\n\
+                                  units of .debug_info, with N processes\n"));
+#endif
       fprintf (stream, _("\
       --adjust-vma=OFFSET        Add OFFSET to all displayed section addresses\n"));
       fprintf (stream, _("\
@@ -451,7 +481,8 @@ enum option_values
     OPTION_CTF_PARENT,
 #endif
     OPTION_VISUALIZE_JUMPS,
-    OPTION_DISASSEMBLER_COLOR
+    OPTION_DISASSEMBLER_COLOR,
+    OPTION_JOBS
   };
 
 static struct option long_options[]=
@@ -488,6 +519,7 @@ static struct option long_options[]=
   {"info", no_argument, NULL, 'i'},
   {"inlines", no_argument, 0, OPTION_INLINES},
   {"insn-width", required_argument, NULL, OPTION_INSN_WIDTH},
+  {"jobs", required_argument, NULL, OPTION_JOBS},
   {"line-numbers", no_argument, NULL, 'l'},
   {"no-addresses", no_argument, &no_addresses, 1},
   {"no-recurse-limit", no_argument, NULL, OPTION_NO_RECURSE_LIMIT},
@@ -1070,9 +1102,9 @@ remove_useless_symbols (asymbol **symbols, long count)
   return out_ptr - symbols;
 }
 
-static const asection *compare_section;
-
-/* Sort symbols into value order.  */
+/* Sort symbols into value order.  Symbols from the section currently
+   being disassembled are moved ahead of others with the same value
+   separately, by sort_symbols_for_section.  */
 
 static int
 compare_symbols (const void *ap, const void *bp)
@@ -1083,7 +1115,7 @@ compare_symbols (const void *ap, const void *bp)
   const char *bn;
   size_t anl;
   size_t bnl;
-  bool as, af, bs, bf;
+  bool af, bf;
   flagword aflags;
   flagword bflags;
 
@@ -1092,17 +1124,6 @@ compare_symbols (const void *ap, const void *bp)
   else if (bfd_asymbol_value (a) < bfd_asymbol_value (b))
     return -1;
 
-  /* Prefer symbols from the section currently being disassembled.
-     Don't sort symbols from other sections by section, since there
-     isn't much reason to prefer one section over another otherwise.
-     See sym_ok comment for why we compare by section name.  */
-  as = strcmp (compare_section->name, a->section->name) == 0;
-  bs = strcmp (compare_section->name, b->section->name) == 0;
-  if (as && !bs)
-    return -1;
-  if (!as && bs)
-    return 1;
-
   an = bfd_asymbol_name (a);
   bn = bfd_asymbol_name (b);
   anl = strlen (an);
@@ -1216,6 +1237,222 @@ compare_symbols (const void *ap, const void *bp)
   return strcmp (an, bn);
 }
 
+/* Sort section_name_places by section name and index.  */
+
+static int
+compare_section_places (const void *ap, const void *bp)
+{
+  long a = * (const long *) ap;
+  long b = * (const long *) bp;
+  int cmp;
+
+  cmp = strcmp (value_sorted_syms[a]->section->name,
+		value_sorted_syms[b]->section->name);
+  if (cmp != 0)
+    return cmp;
+  return a < b ? -1 : a > b;
+}
+
+/* Sort the symbols in `sorted_syms' by value once, and prepare the
+   per section name index used by sort_symbols_for_section.  */
+
+static void
+sort_symbols (void)
+{
+  long i;
+
+  if (sorted_symcount > 1)
+    qsort (sorted_syms, sorted_symcount, sizeof (asymbol *), compare_symbols);
+
+  value_sorted_syms = xmemdup (sorted_syms, sorted_symcount * sizeof (asymbol *),
+			       sorted_symcount * sizeof (asymbol *));
+  section_name_places = xmalloc (sorted_symcount * sizeof (long));
+  for (i = 0; i < sorted_symcount; i++)
+    section_name_places[i] = i;
+  if (sorted_symcount > 1)
+    qsort (section_name_places, sorted_symcount, sizeof (long),
+	   compare_section_places);
+
+  sorted_section_places = xmalloc (sorted_symcount * sizeof (long));
+  sorted_section_count = 0;
+  sorted_syms_section = NULL;
+  moved_syms_ranges = xmalloc (sorted_symcount * 2 * sizeof (long));
+  moved_syms_count = 0;
+}
+
+static void
+free_sorted_symbols (void)
+{
+  free (value_sorted_syms);
+  value_sorted_syms = NULL;
+  free (section_name_places);
+  section_name_places = NULL;
+  free (sorted_section_places);
+  sorted_section_places = NULL;
+  sorted_syms_section = NULL;
+  free (moved_syms_ranges);
+  moved_syms_ranges = NULL;
+}
+
+/* Return the index of the first symbol in `sorted_syms' between LO
+   and HI (exclusive) whose value is at least VALUE, or greater than
+   VALUE if AFTER.  */
+
+static long
+bisect_sorted_syms (bfd_vma value, bool after, long lo, long hi)
+{
+  while (lo < hi)
+    {
+      long mid = lo + (hi - lo) / 2;
+      bfd_vma v = bfd_asymbol_value (sorted_syms[mid]);
+
+      if (v > value || (!after && v == value))
+	hi = mid;
+      else
+	lo = mid + 1;
+    }
+  return lo;
+}
+
+/* Arrange `sorted_syms' for disassembling SECTION: among symbols with
+   the same value, prefer those from the section being disassembled.
+   Don't order symbols from other sections by section, since there
+   isn't much reason to prefer one section over another otherwise.
+   See sym_ok comment for why we compare by section name.
+
+   This gives the same order as sorting with the section as a
+   secondary key, but only touches groups of equal-valued symbols that
+   hold symbols of SECTION, and records where those symbols end up in
+   `sorted_section_places'.  */
+
+static void
+sort_symbols_for_section (asection *section)
+{
+  long lo, hi, i;
+
+  /* Undo the arrangement for the previous section.  */
+  for (i = 0; i < moved_syms_count; i += 2)
+    memcpy (sorted_syms + moved_syms_ranges[i],
+	    value_sorted_syms + moved_syms_ranges[i],
+	    ((moved_syms_ranges[i + 1] - moved_syms_ranges[i])
+	     * sizeof (asymbol *)));
+  moved_syms_count = 0;
+  sorted_section_count = 0;
+  sorted_syms_section = section;
+
+  /* Find the symbols whose section has SECTION's name.  */
+  lo = 0;
+  hi = sorted_symcount;
+  while (lo < hi)
+    {
+      long mid = lo + (hi - lo) / 2;
+      asymbol *sym = value_sorted_syms[section_name_places[mid]];
+
+      if (strcmp (sym->section->name, section->name) < 0)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  for (i = lo;
+       (i < sorted_symcount
+	&& strcmp (value_sorted_syms[section_name_places[i]]->section->name,
+		   section->name) == 0); )
+    {
+      bfd_vma value = bfd_asymbol_value (value_sorted_syms[section_name_places[i]]);
+      long start, last, count, j, dst, prev;
+
+      /* The symbols with this value start at START, and those of
+	 SECTION among them are section_name_places[i] up to but not
+	 including section_name_places[I + COUNT].  */
+      start = bisect_sorted_syms (value, false, 0, section_name_places[i]);
+      count = 1;
+      while (i + count < sorted_symcount
+	     && (strcmp (value_sorted_syms[section_name_places[i + count]]
+			 ->section->name, section->name) == 0)
+	     && (bfd_asymbol_value (value_sorted_syms[section_name_places[i
+									  + count]])
+		 == value))
+	++count;
+      last = section_name_places[i + count - 1];
+
+      for (j = 0; j < count; j++)
+	sorted_section_places[sorted_section_count++] = start + j;
+
+      if (last - start + 1 != count)
+	{
+	  /* Move SECTION's symbols to the front, keeping the others in
+	     order behind them.  */
+	  for (j = 0; j < count; j++)
+	    sorted_syms[start + j] = value_sorted_syms[section_name_places[i + j]];
+	  dst = start + count;
+	  prev = start;
+	  for (j = 0; j < count; j++)
+	    {
+	      long place = section_name_places[i + j];
+
+	      memcpy (sorted_syms + dst, value_sorted_syms + prev,
+		      (place - prev) * sizeof (asymbol *));
+	      dst += place - prev;
+	      prev = place + 1;
+	    }
+	  moved_syms_ranges[moved_syms_count++] = start;
+	  moved_syms_ranges[moved_syms_count++] = last + 1;
+	}
+      i += count;
+    }
+}
+
+/* Return the index of the next symbol in `sorted_syms' after PLACE
+   that may satisfy sym_ok for SEC and WANT_SECTION, or
+   `sorted_symcount' if there is none.  */
+
+static long
+next_sym_place (long place, bool want_section, asection *sec)
+{
+  long lo, hi;
+
+  if (!want_section || sec != sorted_syms_section)
+    return place + 1;
+
+  lo = 0;
+  hi = sorted_section_count;
+  while (lo < hi)
+    {
+      long mid = lo + (hi - lo) / 2;
+
+      if (sorted_section_places[mid] > place)
+	hi = mid;
+      else
+	lo = mid + 1;
+    }
+  return lo < sorted_section_count ? sorted_section_places[lo] : sorted_symcount;
+}
+
+/* Likewise, for the previous symbol before PLACE, or -1.  */
+
+static long
+prev_sym_place (long place, bool want_section, asection *sec)
+{
+  long lo, hi;
+
+  if (!want_section || sec != sorted_syms_section)
+    return place - 1;
+
+  lo = 0;
+  hi = sorted_section_count;
+  while (lo < hi)
+    {
+      long mid = lo + (hi - lo) / 2;
+
+      if (sorted_section_places[mid] >= place)
+	hi = mid;
+      else
+	lo = mid + 1;
+    }
+  return lo > 0 ? sorted_section_places[lo - 1] : -1;
+}
+
 /* Sort relocs into address order.  */
 
 static int
@@ -1401,19 +1638,17 @@ find_symbol_for_address (bfd_vma vma,
   /* The symbol we want is now in min, the low end of the range we
      were searching.  If there are several symbols with the same
      value, we want the first one.  */
-  thisplace = min;
-  while (thisplace > 0
-	 && (bfd_asymbol_value (sorted_syms[thisplace])
-	     == bfd_asymbol_value (sorted_syms[thisplace - 1])))
-    --thisplace;
+  thisplace = bisect_sorted_syms (bfd_asymbol_value (sorted_syms[min]),
+				  false, 0, min);
 
   /* Prefer a symbol in the current section if we have multple symbols
      with the same value, as can occur with overlays or zero size
      sections.  */
-  min = thisplace;
-  while (min < max_count
-	 && (bfd_asymbol_value (sorted_syms[min])
-	     == bfd_asymbol_value (sorted_syms[thisplace])))
+  max_count = bisect_sorted_syms (bfd_asymbol_value (sorted_syms[min]),
+				  true, min, max_count);
+  for (min = thisplace;
+       min < max_count;
+       min = next_sym_place (min, true, sec))
     {
       if (sym_ok (true, abfd, min, sec, inf))
 	{
@@ -1424,8 +1659,8 @@ find_symbol_for_address (bfd_vma vma,
 
 	  return sorted_syms[thisplace];
 	}
-      ++min;
     }
+  min = max_count;
 
   /* If the file is relocatable, and the symbol could be from this
      section, prefer a symbol from this section over symbols from
@@ -1448,7 +1683,9 @@ find_symbol_for_address (bfd_vma vma,
       long i;
       long newplace = sorted_symcount;
 
-      for (i = min - 1; i >= 0; i--)
+      for (i = prev_sym_place (min, want_section, sec);
+	   i >= 0;
+	   i = prev_sym_place (i, want_section, sec))
 	{
 	  if (sym_ok (want_section, abfd, i, sec, inf))
 	    {
@@ -1471,7 +1708,9 @@ find_symbol_for_address (bfd_vma vma,
 	{
 	  /* We didn't find a good symbol with a smaller value.
 	     Look for one with a larger value.  */
-	  for (i = thisplace + 1; i < sorted_symcount; i++)
+	  for (i = next_sym_place (thisplace, want_section, sec);
+	       i < sorted_symcount;
+	       i = next_sym_place (i, want_section, sec))
 	    {
 	      if (sym_ok (want_section, abfd, i, sec, inf))
 		{
@@ -1852,7 +2091,8 @@ try_print_file_open (const char *origname, const char *modname, struct stat *fst
 
 /* If the source file, as described in the symtab, is not found
    try to locate it in one of the paths specified with -I
-   If found, add location to print_files linked list.  */
+   If found, add location to print_files linked list.  If not, add
+   a node without a map, so that we don't look for it again.  */
 
 static struct print_file_list *
 update_source_path (const char *filename, bfd *abfd)
@@ -1865,9 +2105,6 @@ update_source_path (const char *filename, bfd *abfd)
   p = try_print_file_open (filename, filename, &fst);
   if (p == NULL)
     {
-      if (include_path_count == 0)
-	return NULL;
-
       /* Get the name of the file.  */
       fname = lbasename (filename);
 
@@ -1894,6 +2131,14 @@ update_source_path (const char *filename, bfd *abfd)
 	warn (_("source file %s is more recent than object file\n"),
 	      filename);
     }
+  else
+    {
+      p = (struct print_file_list *) xcalloc (1, sizeof (*p));
+      p->filename = filename;
+      p->modname = filename;
+      p->next = print_files;
+      print_files = p;
+    }
 
   return p;
 }
@@ -2066,8 +2311,16 @@ show_line (bfd *abfd, asection *section, bfd_vma addr_offset)
 	    filename = xstrdup (filename);
 	  p = update_source_path (filename, abfd);
 	}
+      else if (pp != &print_files)
+	{
+	  /* Move the file to the front of the list, since the next
+	     line is most likely from the same file.  */
+	  *pp = p->next;
+	  p->next = print_files;
+	  print_files = p;
+	}
 
-      if (p != NULL && linenumber != p->last_line)
+      if (p != NULL && p->map != NULL && linenumber != p->last_line)
 	{
 	  if (file_start_context && p->first)
 	    l = 1;
@@ -3429,6 +3682,65 @@ disassemble_bytes (struct disassemble_info *inf,
   free (color_buffer);
 }
 
+#ifdef HAVE_FORK
+/* Split the disassembly of the range [START, STOP) of a section
+   between --jobs worker processes.  Each worker writes its output to
+   a temporary file, and the parent copies the files to stdout in
+   order once all the workers have finished.  Returns true in a worker,
+   with [*LO, *HI) set to the part of the range whose blocks it should
+   print, and false in the parent when the output is complete.  */
+
+static bool
+start_disasm_workers (bfd_vma start, bfd_vma stop, bfd_vma *lo, bfd_vma *hi)
+{
+  FILE **out = xmalloc (disasm_jobs * sizeof (*out));
+  pid_t *pids = xmalloc (disasm_jobs * sizeof (*pids));
+  bfd_vma chunk = (stop - start + disasm_jobs - 1) / disasm_jobs;
+  char buf[BUFSIZ];
+  int i;
+
+  fflush (stdout);
+  for (i = 0; i < disasm_jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	fatal (_("can't create temporary file: %s"), strerror (errno));
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	fatal (_("can't fork: %s"), strerror (errno));
+      if (pids[i] == 0)
+	{
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    fatal (_("can't redirect output: %s"), strerror (errno));
+	  *lo = start + i * chunk;
+	  *hi = i == disasm_jobs - 1 ? stop : *lo + chunk;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  for (i = 0; i < disasm_jobs; i++)
+    {
+      int status;
+      size_t n;
+
+      if (waitpid (pids[i], &status, 0) == -1
+	  || !WIFEXITED (status)
+	  || WEXITSTATUS (status) != 0)
+	exit_status = 1;
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+
+  free (out);
+  free (pids);
+  return false;
+}
+#endif
+
 static void
 disassemble_section (bfd *abfd, asection *section, void *inf)
 {
@@ -3449,6 +3761,9 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
   bfd_vma rel_offset;
   unsigned long addr_offset;
   bool do_print;
+  bfd_vma print_lo = 0;
+  bfd_vma print_hi = (bfd_vma) -1;
+  bool worker = false;
   enum loop_control
   {
    stop_offset_reached,
@@ -3545,9 +3860,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
   pinfo->section = section;
 
   /* Sort the symbols into value and section order.  */
-  compare_section = section;
-  if (sorted_symcount > 1)
-    qsort (sorted_syms, sorted_symcount, sizeof (asymbol *), compare_symbols);
+  sort_symbols_for_section (section);
 
   /* Skip over the relocs belonging to addresses below the
      start address.  */
@@ -3579,6 +3892,26 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
   do_print = paux->symbol == NULL;
   loop_until = stop_offset_reached;
 
+#ifdef HAVE_FORK
+  /* Blocks are printed by the worker whose share of the section they
+     start in.  Anything that carries state from one block to the next
+     (relocations, line numbers, jump visualization, the search for a
+     single symbol) keeps the section in one process.  */
+  if (disasm_jobs > 1
+      && stop_offset - addr_offset >= (bfd_vma) disasm_jobs * 4096
+      && paux->symbol == NULL
+      && rel_pp == rel_ppend
+      && !with_line_numbers
+      && !with_source_code
+      && !visualize_jumps)
+    {
+      worker = start_disasm_workers (addr_offset, stop_offset,
+				     &print_lo, &print_hi);
+      if (!worker)
+	addr_offset = stop_offset;
+    }
+#endif
+
   while (addr_offset < stop_offset)
     {
       bfd_vma addr;
@@ -3591,13 +3924,9 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
 
       if (sym != NULL && bfd_asymbol_value (sym) <= addr)
 	{
-	  int x;
+	  long x;
 
-	  for (x = place;
-	       (x < sorted_symcount
-		&& (bfd_asymbol_value (sorted_syms[x]) <= addr));
-	       ++x)
-	    continue;
+	  x = bisect_sorted_syms (addr, true, place, sorted_symcount);
 
 	  pinfo->symbols = sorted_syms + place;
 	  pinfo->num_symbols = x - place;
@@ -3686,7 +4015,8 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
 	    }
 	}
 
-      if (! prefix_addresses && do_print)
+      if (! prefix_addresses && do_print
+	  && addr_offset >= print_lo && addr_offset < print_hi)
 	{
 	  pinfo->fprintf_func (pinfo->stream, "\n");
 	  objdump_print_addr_with_sym (abfd, section, sym, addr,
@@ -3711,7 +4041,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
 	     may have overlapping addresses.  */
 	  while (place < sorted_symcount
 		 && ! is_valid_next_sym (sorted_syms [place]))
-	    ++place;
+	    place = next_sym_place (place, true, section);
 
 	  if (place >= sorted_symcount)
 	    nextsym = NULL;
@@ -3747,7 +4077,7 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
       else
 	insns = false;
 
-      if (do_print)
+      if (do_print && addr_offset >= print_lo && addr_offset < print_hi)
 	{
 	  /* Resolve symbol name.  */
 	  if (visualize_jumps && abfd && sym && sym->name)
@@ -3790,6 +4120,12 @@ disassemble_section (bfd *abfd, asection *section, void *inf)
       sym = nextsym;
     }
 
+  if (worker)
+    {
+      fflush (stdout);
+      _exit (exit_status);
+    }
+
   free (data);
 
   if (rel_ppstart != NULL)
@@ -3829,6 +4165,8 @@ disassemble_data (bfd *abfd)
       ++sorted_symcount;
     }
 
+  sort_symbols ();
+
   init_disassemble_info (&disasm_info, stdout, (fprintf_ftype) fprintf,
 			 (fprintf_styled_ftype) fprintf_styled);
   disasm_info.application_data = (void *) &aux;
@@ -3924,16 +4262,63 @@ disassemble_data (bfd *abfd)
   free (disasm_info.dynrelbuf);
   disasm_info.dynrelbuf = NULL;
   free (sorted_syms);
+  free_sorted_symbols ();
   disassemble_free_target (&disasm_info);
 }
 
+/* Debug sections whose contents are mapped from the file, rather than
+   read into memory, by load_specific_debug_section.  */
+static struct bfd_section_view debug_section_views[max];
+
+/* Load the contents of debug section SEC of ABFD, which needs no
+   relocation, for DEBUG, mapping them from the file if possible.  */
+
+static bool
+load_debug_section_view (enum dwarf_section_display_enum debug,
+			 asection *sec, bfd *abfd)
+{
+  struct bfd_section_view *view = &debug_section_views[debug];
+  struct dwarf_section *section = &debug_displays [debug].section;
+  bfd_byte *contents;
+
+  if (!bfd_get_section_contents_view (abfd, sec, view))
+    return false;
+  if (view->size != section->size)
+    {
+      bfd_release_section_contents_view (view);
+      return false;
+    }
+
+  /* String sections must end with a NUL, which can be added to a
+     malloc'd copy but not to a mapping.  */
+  if (view->map_addr != NULL
+      && view->contents[view->size - 1] == 0)
+    {
+      section->start = (unsigned char *) view->contents;
+      return true;
+    }
+  if (view->map_addr == NULL)
+    {
+      contents = xrealloc ((void *) view->contents, view->size + 1);
+      view->contents = NULL;
+    }
+  else
+    {
+      contents = xmalloc (view->size + 1);
+      memcpy (contents, view->contents, view->size);
+      bfd_release_section_contents_view (view);
+    }
+  contents[section->size] = 0;
+  section->start = contents;
+  return true;
+}
+
 static bool
 load_specific_debug_section (enum dwarf_section_display_enum debug,
 			     asection *sec, void *file)
 {
   struct dwarf_section *section = &debug_displays [debug].section;
   bfd *abfd = (bfd *) file;
-  bfd_byte *contents;
   bfd_size_type amt;
   size_t alloced;
   bool ret;
@@ -3943,7 +4328,7 @@ load_specific_debug_section (enum dwarf_section_display_enum debug,
       /* If it is already loaded, do nothing.  */
       if (streq (section->filename, bfd_get_filename (abfd)))
 	return true;
-      free (section->start);
+      free_debug_section (debug);
     }
 
   section->filename = bfd_get_filename (abfd);
@@ -3963,13 +4348,13 @@ load_specific_debug_section (enum dwarf_section_display_enum debug,
       return false;
     }
 
-  section->start = contents = xmalloc (alloced);
-  /* Ensure any string section has a terminating NUL.  */
-  section->start[section->size] = 0;
-
   if ((abfd->flags & (EXEC_P | DYNAMIC)) == 0
       && debug_displays [debug].relocate)
     {
+      section->start = xmalloc (alloced);
+      /* Ensure any string section has a terminating NUL.  */
+      section->start[section->size] = 0;
+
       ret = bfd_simple_get_relocated_section_contents (abfd,
 						       sec,
 						       section->start,
@@ -3997,7 +4382,7 @@ load_specific_debug_section (enum dwarf_section_display_enum debug,
 	}
     }
   else
-    ret = bfd_get_full_section_contents (abfd, sec, &contents);
+    ret = load_debug_section_view (debug, sec, abfd);
 
   if (!ret)
     {
@@ -4072,7 +4457,10 @@ free_debug_section (enum dwarf_section_display_enum debug)
 {
   struct dwarf_section *section = &debug_displays [debug].section;
 
-  free ((char *) section->start);
+  if (debug_section_views[debug].contents != NULL)
+    bfd_release_section_contents_view (&debug_section_views[debug]);
+  else
+    free ((char *) section->start);
   section->start = NULL;
   section->address = 0;
   section->size = 0;
@@ -5657,6 +6045,17 @@ main (int argc, char **argv)
 	  if (insn_width <= 0)
 	    fatal (_("error: instruction width must be positive"));
 	  break;
+	case OPTION_JOBS:
+	  disasm_jobs = strtoul (optarg, NULL, 0);
+	  if (disasm_jobs <= 0)
+	    fatal (_("error: number of jobs must be positive"));
+#ifndef HAVE_FORK
+	  if (disasm_jobs > 1)
+	    non_fatal (_("warning: --jobs is not supported on this host"));
+	  disasm_jobs = 1;
+#endif
+	  dwarf_jobs = disasm_jobs;
+	  break;
 	case OPTION_INLINES:
 	  unwind_inlines = true;
 	  break;
@@ -44,12 +44,19 @@
 #include <assert.h>
 #include <time.h>
 #include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 #include <wchar.h>
 
 #if defined HAVE_MSGPACK
 #include <msgpack.h>
 #endif
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #if __GNUC__ >= 2
 /* Define BFD64 here, even if our default architecture is 32 bit ELF
    as this will allow us to read in and parse 64bit and 32bit ELF files.
@@ -551,6 +558,54 @@ get_data (void *         var,
   return mvar;
 }
 
+/* Print VMA as exactly DIGITS zero-padded lower case hex digits, and
+   return DIGITS.  VMA must fit.  Symbol and relocation tables can run
+   to millions of lines, and this is a good deal cheaper than printf.  */
+
+static unsigned int
+print_hex_digits (bfd_vma vma, unsigned int digits)
+{
+  char buf[sizeof (bfd_vma) * 2];
+  unsigned int i;
+
+  for (i = digits; i-- > 0; vma >>= 4)
+    buf[i] = "0123456789abcdef"[vma & 0xf];
+  fwrite (buf, 1, digits, stdout);
+  return digits;
+}
+
+/* Print VMA in decimal, right justified in a field of WIDTH characters,
+   as printf "%*u" would.  Returns the number of characters displayed.  */
+
+static unsigned int
+print_dec_width (bfd_vma vma, unsigned int width)
+{
+  char buf[24];
+  unsigned int i = sizeof (buf);
+
+  do
+    buf[--i] = '0' + vma % 10;
+  while ((vma /= 10) != 0);
+  while (i > sizeof (buf) - width)
+    buf[--i] = ' ';
+  fwrite (buf + i, 1, sizeof (buf) - i, stdout);
+  return sizeof (buf) - i;
+}
+
+/* Print a space followed by TEXT, padded on the right to WIDTH characters,
+   as printf " %-*s" would.  */
+
+static void
+print_column (const char *text, unsigned int width)
+{
+  size_t len = strlen (text);
+
+  putchar (' ');
+  fwrite (text, 1, len, stdout);
+  for (; len < width; len++)
+    putchar (' ');
+}
+
 /* Print a VMA value in the MODE specified.
    Returns the number of characters displayed.  */
 
@@ -567,14 +622,17 @@ print_vma (bfd_vma vma, print_mode mode)
     case LONG_HEX:
 #ifdef BFD64
       if (is_32bit_elf)
-	return nc + printf ("%8.8" BFD_VMA_FMT "x", vma);
+	{
+	  if ((vma >> 16 >> 16) == 0)
+	    return nc + print_hex_digits (vma, 8);
+	  return nc + printf ("%8.8" BFD_VMA_FMT "x", vma);
+	}
 #endif
-      printf_vma (vma);
-      return nc + 16;
+      return nc + print_hex_digits (vma, sizeof (bfd_vma) * 2);
 
     case DEC_5:
       if (vma <= 99999)
-	return printf ("%5" BFD_VMA_FMT "d", vma);
+	return print_dec_width (vma, 5);
       /* Fall through.  */
     case PREFIX_HEX:
       nc = printf ("0x");
@@ -684,9 +742,16 @@ print_symbol (signed int width, const char * symbol)
 
       if (ISPRINT (c))
 	{
-	  putchar (c);
-	  width_remaining --;
-	  num_printed ++;
+	  /* Emit a whole run of plain characters at once.  */
+	  const char * start = symbol - 1;
+
+	  n = 1;
+	  while (n < width_remaining && ISPRINT (start[n]))
+	    n++;
+	  fwrite (start, 1, n, stdout);
+	  symbol = start + n;
+	  width_remaining -= n;
+	  num_printed += n;
 	}
       else if (ISCNTRL (c))
 	{
@@ -5109,6 +5174,7 @@ enum long_option_values
   OPTION_DWARF_DEPTH,
   OPTION_DWARF_START,
   OPTION_DWARF_CHECK,
+  OPTION_JOBS,
   OPTION_CTF_DUMP,
   OPTION_CTF_PARENT,
   OPTION_CTF_SYMBOLS,
@@ -5169,6 +5235,7 @@ static struct option options[] =
   {"dwarf-depth",      required_argument, 0, OPTION_DWARF_DEPTH},
   {"dwarf-start",      required_argument, 0, OPTION_DWARF_START},
   {"dwarf-check",      no_argument, 0, OPTION_DWARF_CHECK},
+  {"jobs",	       required_argument, 0, OPTION_JOBS},
 #ifdef ENABLE_LIBCTF
   {"ctf",	       required_argument, 0, OPTION_CTF_DUMP},
   {"ctf-symbols",      required_argument, 0, OPTION_CTF_SYMBOLS},
@@ -5303,6 +5370,11 @@ usage (FILE * stream)
   --dwarf-depth=N        Do not display DIEs at depth N or greater\n"));
   fprintf (stream, _("\
   --dwarf-start=N        Display DIEs starting at offset N\n"));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+  --jobs=N               Display the units of .debug_info, or the members\n\
+                         of an archive, with N processes\n"));
+#endif
 #ifdef ENABLE_LIBCTF
   fprintf (stream, _("\
   --ctf=<number|name>    Display CTF info from section <number|name>\n"));
@@ -5572,6 +5644,19 @@ parse_args (struct dump_data *dumpdata, int argc, char ** argv)
 	case OPTION_DWARF_CHECK:
 	  dwarf_check = true;
 	  break;
+	case OPTION_JOBS:
+	  dwarf_jobs = strtoul (optarg, NULL, 0);
+	  if (dwarf_jobs <= 0)
+	    {
+	      error (_("Invalid number of jobs: %s\n"), optarg);
+	      dwarf_jobs = 1;
+	    }
+#ifndef HAVE_FORK
+	  if (dwarf_jobs > 1)
+	    warn (_("--jobs is not supported on this host\n"));
+	  dwarf_jobs = 1;
+#endif
+	  break;
 	case OPTION_CTF_DUMP:
 	  do_ctf = true;
 	  request_dump (dumpdata, CTF_DUMP);
@@ -6484,12 +6569,22 @@ get_section_headers (Filedata *filedata, bool probe)
     return get_64bit_section_headers (filedata, probe);
 }
 
+/* The number of symbols process_symbol_table decodes at a time.  */
+#define SYMBOL_WINDOW 8192
+
+/* Decode at most COUNT symbols of SECTION, starting with symbol FIRST.
+   Only the part of the section (and of any associated SHT_SYMTAB_SHNDX
+   section) covering those symbols is read from the file.  */
+
 static Elf_Internal_Sym *
 get_32bit_elf_symbols (Filedata *           filedata,
 		       Elf_Internal_Shdr *  section,
+		       unsigned long        first,
+		       unsigned long        count,
 		       unsigned long *      num_syms_return)
 {
   unsigned long number = 0;
+  unsigned long total;
   Elf32_External_Sym * esyms = NULL;
   Elf_External_Sym_Shndx * shndx = NULL;
   Elf_Internal_Sym * isyms = NULL;
@@ -6532,8 +6627,32 @@ get_32bit_elf_symbols (Filedata *           filedata,
       goto exit_point;
     }
 
-  esyms = (Elf32_External_Sym *) get_data (NULL, filedata, section->sh_offset, 1,
-                                           section->sh_size, _("symbols"));
+  total = number;
+  if (first >= total)
+    {
+      number = 0;
+      goto exit_point;
+    }
+  number = total - first;
+  if (count < number)
+    number = count;
+
+  if (number == total)
+    esyms = (Elf32_External_Sym *) get_data (NULL, filedata,
+					       section->sh_offset, 1,
+					       section->sh_size, _("symbols"));
+  else
+    {
+      bfd_size_type start = first * sizeof (Elf32_External_Sym);
+      bfd_size_type size = number * sizeof (Elf32_External_Sym);
+
+      /* The final symbol may be truncated, see the check above.  */
+      if (size > section->sh_size - start)
+	size = section->sh_size - start;
+      esyms = (Elf32_External_Sym *) get_data (NULL, filedata,
+						 section->sh_offset + start,
+						 1, size, _("symbols"));
+    }
   if (esyms == NULL)
     goto exit_point;
 
@@ -6549,15 +6668,22 @@ get_32bit_elf_symbols (Filedata *           filedata,
 	  free (shndx);
 	}
 
-      shndx = (Elf_External_Sym_Shndx *) get_data (NULL, filedata,
-						   entry->hdr->sh_offset,
-						   1, entry->hdr->sh_size,
-						   _("symbol table section indices"));
+      if (number == total)
+	shndx = (Elf_External_Sym_Shndx *)
+	  get_data (NULL, filedata, entry->hdr->sh_offset, 1,
+		    entry->hdr->sh_size, _("symbol table section indices"));
+      else
+	shndx = (Elf_External_Sym_Shndx *)
+	  get_data (NULL, filedata,
+		    entry->hdr->sh_offset
+		    + first * sizeof (Elf_External_Sym_Shndx),
+		    sizeof (Elf_External_Sym_Shndx), number,
+		    _("symbol table section indices"));
       if (shndx == NULL)
 	goto exit_point;
 
       /* PR17531: file: heap-buffer-overflow */
-      if (entry->hdr->sh_size / sizeof (Elf_External_Sym_Shndx) < number)
+      if (entry->hdr->sh_size / sizeof (Elf_External_Sym_Shndx) < total)
 	{
 	  error (_("Index section %s has an sh_size of 0x%lx - expected 0x%lx\n"),
 		 printable_section_name (filedata, entry->hdr),
@@ -6601,12 +6727,19 @@ get_32bit_elf_symbols (Filedata *           filedata,
   return isyms;
 }
 
+/* Decode at most COUNT symbols of SECTION, starting with symbol FIRST.
+   Only the part of the section (and of any associated SHT_SYMTAB_SHNDX
+   section) covering those symbols is read from the file.  */
+
 static Elf_Internal_Sym *
 get_64bit_elf_symbols (Filedata *           filedata,
 		       Elf_Internal_Shdr *  section,
+		       unsigned long        first,
+		       unsigned long        count,
 		       unsigned long *      num_syms_return)
 {
   unsigned long number = 0;
+  unsigned long total;
   Elf64_External_Sym * esyms = NULL;
   Elf_External_Sym_Shndx * shndx = NULL;
   Elf_Internal_Sym * isyms = NULL;
@@ -6649,8 +6782,32 @@ get_64bit_elf_symbols (Filedata *           filedata,
       goto exit_point;
     }
 
-  esyms = (Elf64_External_Sym *) get_data (NULL, filedata, section->sh_offset, 1,
-                                           section->sh_size, _("symbols"));
+  total = number;
+  if (first >= total)
+    {
+      number = 0;
+      goto exit_point;
+    }
+  number = total - first;
+  if (count < number)
+    number = count;
+
+  if (number == total)
+    esyms = (Elf64_External_Sym *) get_data (NULL, filedata,
+					       section->sh_offset, 1,
+					       section->sh_size, _("symbols"));
+  else
+    {
+      bfd_size_type start = first * sizeof (Elf64_External_Sym);
+      bfd_size_type size = number * sizeof (Elf64_External_Sym);
+
+      /* The final symbol may be truncated, see the check above.  */
+      if (size > section->sh_size - start)
+	size = section->sh_size - start;
+      esyms = (Elf64_External_Sym *) get_data (NULL, filedata,
+						 section->sh_offset + start,
+						 1, size, _("symbols"));
+    }
   if (!esyms)
     goto exit_point;
 
@@ -6666,15 +6823,22 @@ get_64bit_elf_symbols (Filedata *           filedata,
 	  free (shndx);
 	}
 
-      shndx = (Elf_External_Sym_Shndx *) get_data (NULL, filedata,
-						   entry->hdr->sh_offset,
-						   1, entry->hdr->sh_size,
-						   _("symbol table section indices"));
+      if (number == total)
+	shndx = (Elf_External_Sym_Shndx *)
+	  get_data (NULL, filedata, entry->hdr->sh_offset, 1,
+		    entry->hdr->sh_size, _("symbol table section indices"));
+      else
+	shndx = (Elf_External_Sym_Shndx *)
+	  get_data (NULL, filedata,
+		    entry->hdr->sh_offset
+		    + first * sizeof (Elf_External_Sym_Shndx),
+		    sizeof (Elf_External_Sym_Shndx), number,
+		    _("symbol table section indices"));
       if (shndx == NULL)
 	goto exit_point;
 
       /* PR17531: file: heap-buffer-overflow */
-      if (entry->hdr->sh_size / sizeof (Elf_External_Sym_Shndx) < number)
+      if (entry->hdr->sh_size / sizeof (Elf_External_Sym_Shndx) < total)
 	{
 	  error (_("Index section %s has an sh_size of 0x%lx - expected 0x%lx\n"),
 		 printable_section_name (filedata, entry->hdr),
@@ -6726,9 +6890,29 @@ get_elf_symbols (Filedata *filedata,
 		 unsigned long *num_syms_return)
 {
   if (is_32bit_elf)
-    return get_32bit_elf_symbols (filedata, section, num_syms_return);
+    return get_32bit_elf_symbols (filedata, section, 0, -1ul,
+				  num_syms_return);
   else
-    return get_64bit_elf_symbols (filedata, section, num_syms_return);
+    return get_64bit_elf_symbols (filedata, section, 0, -1ul,
+				  num_syms_return);
+}
+
+/* Like get_elf_symbols, but only decode at most COUNT symbols starting
+   with symbol FIRST.  */
+
+static Elf_Internal_Sym *
+get_elf_symbol_range (Filedata *filedata,
+		      Elf_Internal_Shdr *section,
+		      unsigned long first,
+		      unsigned long count,
+		      unsigned long *num_syms_return)
+{
+  if (is_32bit_elf)
+    return get_32bit_elf_symbols (filedata, section, first, count,
+				  num_syms_return);
+  else
+    return get_64bit_elf_symbols (filedata, section, first, count,
+				  num_syms_return);
 }
 
 static const char *
@@ -7733,6 +7917,8 @@ process_section_headers (Filedata * filedata)
 		    {
 		      if (chdr.ch_type == ELFCOMPRESS_ZLIB)
 			printf ("       ZLIB, ");
+		      else if (chdr.ch_type == ELFCOMPRESS_ZSTD)
+			printf ("       ZSTD, ");
 		      else
 			printf (_("       [<unknown>: 0x%x], "),
 				chdr.ch_type);
@@ -13151,9 +13337,11 @@ print_dynamic_symbol_size (bfd_vma vma, int base)
     }
 }
 
+/* Display PSYM, which is symbol number SI of SECTION.  */
+
 static void
 print_dynamic_symbol (Filedata *filedata, unsigned long si,
-		      Elf_Internal_Sym *symtab,
+		      Elf_Internal_Sym *psym,
 		      Elf_Internal_Shdr *section,
 		      char *strtab, size_t strtab_size)
 {
@@ -13162,21 +13350,21 @@ print_dynamic_symbol (Filedata *filedata, unsigned long si,
   unsigned short vna_other;
   bool is_valid;
   const char * sstr;
-  Elf_Internal_Sym *psym = symtab + si;
 
-  printf ("%6ld: ", si);
+  print_dec_width (si, 6);
+  fputs (": ", stdout);
   print_vma (psym->st_value, LONG_HEX);
   putchar (' ');
   print_dynamic_symbol_size (psym->st_size, sym_base);
-  printf (" %-7s", get_symbol_type (filedata, ELF_ST_TYPE (psym->st_info)));
-  printf (" %-6s", get_symbol_binding (filedata, ELF_ST_BIND (psym->st_info)));
+  print_column (get_symbol_type (filedata, ELF_ST_TYPE (psym->st_info)), 7);
+  print_column (get_symbol_binding (filedata, ELF_ST_BIND (psym->st_info)), 6);
   if (filedata->file_header.e_ident[EI_OSABI] == ELFOSABI_SOLARIS)
-    printf (" %-7s",  get_solaris_symbol_visibility (psym->st_other));
+    print_column (get_solaris_symbol_visibility (psym->st_other), 7);
   else
     {
       unsigned int vis = ELF_ST_VISIBILITY (psym->st_other);
 
-      printf (" %-7s", get_symbol_visibility (vis));
+      print_column (get_symbol_visibility (vis), 7);
       /* Check to see if any other bits in the st_other field are set.
 	 Note - displaying this information disrupts the layout of the
 	 table being generated, but for the moment this case is very rare.  */
@@ -13548,7 +13736,7 @@ process_symbol_table (Filedata * filedata)
 	printf (_("   Num:    Value          Size Type    Bind   Vis      Ndx Name\n"));
 
       for (si = 0; si < filedata->num_dynamic_syms; si++)
-	print_dynamic_symbol (filedata, si, filedata->dynamic_symbols, NULL,
+	print_dynamic_symbol (filedata, si, filedata->dynamic_symbols + si, NULL,
 			      filedata->dynamic_strings,
 			      filedata->dynamic_strings_length);
     }
@@ -13564,7 +13752,7 @@ process_symbol_table (Filedata * filedata)
 	  char * strtab = NULL;
 	  unsigned long int strtab_size = 0;
 	  Elf_Internal_Sym * symtab;
-	  unsigned long si, num_syms;
+	  unsigned long si, num_syms, window, nwin, j;
 
 	  if ((section->sh_type != SHT_SYMTAB
 	       && section->sh_type != SHT_DYNSYM)
@@ -13600,7 +13788,20 @@ process_symbol_table (Filedata * filedata)
 	  else
 	    printf (_("   Num:    Value          Size Type    Bind   Vis      Ndx Name\n"));
 
-	  symtab = get_elf_symbols (filedata, section, & num_syms);
+	  /* Decode and display the table SYMBOL_WINDOW symbols at a time,
+	     so that huge tables do not need to be held in memory.  A table
+	     which runs off the end of the file is read in one go, so that
+	     the error is reported before anything is displayed.  */
+	  window = SYMBOL_WINDOW;
+	  if (filedata->archive_file_offset > filedata->file_size
+	      || (unsigned long) section->sh_offset
+		  > filedata->file_size - filedata->archive_file_offset
+	      || section->sh_size > (filedata->file_size
+				     - filedata->archive_file_offset
+				     - section->sh_offset))
+	    window = -1ul;
+
+	  symtab = get_elf_symbol_range (filedata, section, 0, window, &nwin);
 	  if (symtab == NULL)
 	    continue;
 
@@ -13621,11 +13822,20 @@ process_symbol_table (Filedata * filedata)
 	      strtab_size = strtab != NULL ? string_sec->sh_size : 0;
 	    }
 
-	  for (si = 0; si < num_syms; si++)
-	    print_dynamic_symbol (filedata, si, symtab, section,
-				  strtab, strtab_size);
+	  si = 0;
+	  while (symtab != NULL)
+	    {
+	      for (j = 0; j < nwin; j++)
+		print_dynamic_symbol (filedata, si + j, symtab + j, section,
+				      strtab, strtab_size);
+	      free (symtab);
+	      si += nwin;
+	      symtab = NULL;
+	      if (si < num_syms)
+		symtab = get_elf_symbol_range (filedata, section, si, window,
+					       &nwin);
+	    }
 
-	  free (symtab);
 	  if (strtab != filedata->string_table)
 	    free (strtab);
 	}
@@ -15177,10 +15387,12 @@ get_section_contents (Elf_Internal_Shdr * section, Filedata * filedata)
                              _("section contents"));
 }
 
-/* Uncompresses a section that was compressed using zlib, in place.  */
+/* Uncompresses a section that was compressed using zlib, or zstd if
+   IS_ZSTD, in place.  */
 
 static bool
-uncompress_section_contents (unsigned char **   buffer,
+uncompress_section_contents (bool               is_zstd,
+			     unsigned char **   buffer,
 			     dwarf_size_type    uncompressed_size,
 			     dwarf_size_type *  size)
 {
@@ -15190,6 +15402,27 @@ uncompress_section_contents (unsigned char **   buffer,
   z_stream strm;
   int rc;
 
+  if (is_zstd)
+    {
+#ifdef HAVE_ZSTD
+      size_t ret;
+
+      uncompressed_buffer = (unsigned char *) xmalloc (uncompressed_size);
+      ret = ZSTD_decompress (uncompressed_buffer, uncompressed_size,
+			     compressed_buffer, compressed_size);
+      if (ZSTD_isError (ret) || ret != uncompressed_size)
+	goto fail;
+      *buffer = uncompressed_buffer;
+      *size = uncompressed_size;
+      return true;
+#else
+      /* The caller has already warned about the unsupported
+	 compression type.  */
+      *buffer = NULL;
+      return false;
+#endif
+    }
+
   /* It is possible the section consists of several compressed
      buffers concatenated together, so we uncompress in a loop.  */
   /* PR 18313: The state field in the z_stream structure is supposed
@@ -15261,6 +15494,7 @@ dump_section_as_strings (Elf_Internal_Shdr * section, Filedata * filedata)
     {
       dwarf_size_type new_size = num_bytes;
       dwarf_size_type uncompressed_size = 0;
+      bool is_zstd = false;
 
       if ((section->sh_flags & SHF_COMPRESSED) != 0)
 	{
@@ -15273,7 +15507,13 @@ dump_section_as_strings (Elf_Internal_Shdr * section, Filedata * filedata)
 	       by get_compression_header.  */
 	    goto error_out;
 
-	  if (chdr.ch_type != ELFCOMPRESS_ZLIB)
+	  if (chdr.ch_type == ELFCOMPRESS_ZLIB)
+	    ;
+#ifdef HAVE_ZSTD
+	  else if (chdr.ch_type == ELFCOMPRESS_ZSTD)
+	    is_zstd = true;
+#endif
+	  else
 	    {
 	      warn (_("section '%s' has unsupported compress type: %d\n"),
 		    printable_section_name (filedata, section), chdr.ch_type);
@@ -15302,7 +15542,7 @@ dump_section_as_strings (Elf_Internal_Shdr * section, Filedata * filedata)
 
       if (uncompressed_size)
 	{
-	  if (uncompress_section_contents (& start,
+	  if (uncompress_section_contents (is_zstd, & start,
 					   uncompressed_size, & new_size))
 	    num_bytes = new_size;
 	  else
@@ -15477,6 +15717,7 @@ dump_section_as_bytes (Elf_Internal_Shdr *section,
     {
       dwarf_size_type new_size = section_size;
       dwarf_size_type uncompressed_size = 0;
+      bool is_zstd = false;
 
       if ((section->sh_flags & SHF_COMPRESSED) != 0)
 	{
@@ -15489,7 +15730,13 @@ dump_section_as_bytes (Elf_Internal_Shdr *section,
 	       by get_compression_header.  */
 	    goto error_out;
 
-	  if (chdr.ch_type != ELFCOMPRESS_ZLIB)
+	  if (chdr.ch_type == ELFCOMPRESS_ZLIB)
+	    ;
+#ifdef HAVE_ZSTD
+	  else if (chdr.ch_type == ELFCOMPRESS_ZSTD)
+	    is_zstd = true;
+#endif
+	  else
 	    {
 	      warn (_("section '%s' has unsupported compress type: %d\n"),
 		    printable_section_name (filedata, section), chdr.ch_type);
@@ -15518,8 +15765,8 @@ dump_section_as_bytes (Elf_Internal_Shdr *section,
 
       if (uncompressed_size)
 	{
-	  if (uncompress_section_contents (& start, uncompressed_size,
-					   & new_size))
+	  if (uncompress_section_contents (is_zstd, & start,
+					   uncompressed_size, & new_size))
 	    {
 	      section_size = new_size;
 	    }
@@ -15855,6 +16102,7 @@ load_specific_debug_section (enum dwarf_section_display_enum  debug,
       unsigned char *start = section->start;
       dwarf_size_type size = sec->sh_size;
       dwarf_size_type uncompressed_size = 0;
+      bool is_zstd = false;
 
       if ((sec->sh_flags & SHF_COMPRESSED) != 0)
 	{
@@ -15876,7 +16124,13 @@ load_specific_debug_section (enum dwarf_section_display_enum  debug,
 	       by get_compression_header.  */
 	    return false;
 
-	  if (chdr.ch_type != ELFCOMPRESS_ZLIB)
+	  if (chdr.ch_type == ELFCOMPRESS_ZLIB)
+	    ;
+#ifdef HAVE_ZSTD
+	  else if (chdr.ch_type == ELFCOMPRESS_ZSTD)
+	    is_zstd = true;
+#endif
+	  else
 	    {
 	      warn (_("section '%s' has unsupported compress type: %d\n"),
 		    section->name, chdr.ch_type);
@@ -15905,8 +16159,8 @@ load_specific_debug_section (enum dwarf_section_display_enum  debug,
 
       if (uncompressed_size)
 	{
-	  if (uncompress_section_contents (&start, uncompressed_size,
-					   &size))
+	  if (uncompress_section_contents (is_zstd, &start,
+					   uncompressed_size, &size))
 	    {
 	      /* Free the compressed buffer, update the section buffer
 		 and the section size if uncompress is successful.  */
@@ -22412,6 +22666,135 @@ process_object (Filedata * filedata)
   return res;
 }
 
+#ifdef HAVE_FORK
+/* Return the number of members in ARCH that follow its current archive
+   header offset, stopping at the first header that cannot be read.  */
+
+static unsigned long
+count_archive_members (struct archive_info *arch)
+{
+  unsigned long offset = arch->next_arhdr_offset;
+  unsigned long count = 0;
+  struct ar_hdr arhdr;
+
+  while (fseek (arch->file, offset, SEEK_SET) == 0
+	 && fread (&arhdr, 1, sizeof arhdr, arch->file) == sizeof arhdr
+	 && memcmp (arhdr.ar_fmag, ARFMAG, 2) == 0)
+    {
+      unsigned long size = strtoul (arhdr.ar_size, NULL, 10);
+
+      count++;
+      offset += sizeof arhdr;
+      if (!arch->is_thin_archive)
+	{
+	  offset += (size + 1) & -2;
+	  if (offset < size)
+	    break;
+	}
+    }
+
+  return count;
+}
+
+/* Share out the COUNT members of the archive in FILEDATA between
+   --jobs worker processes.  Each worker writes its output to a
+   temporary file, which the parent copies to stdout in order once all
+   the workers have finished.  Returns TRUE in a worker, which should
+   display the members [*LO, *HI) and then exit.  Returns FALSE in the
+   parent, with *LO set to the first member that no worker handled, and
+   *OK cleared if any worker failed.  */
+
+static bool
+start_archive_workers (Filedata *filedata, struct archive_info *arch,
+		       struct archive_info *nested_arch, unsigned long count,
+		       unsigned long *lo, unsigned long *hi, bool *ok)
+{
+  unsigned long jobs = count;
+  FILE **out;
+  pid_t *pids;
+  char buf[BUFSIZ];
+  unsigned long i, n_workers;
+
+  if ((unsigned long) dwarf_jobs < jobs)
+    jobs = dwarf_jobs;
+  out = xmalloc (jobs * sizeof (*out));
+  pids = xmalloc (jobs * sizeof (*pids));
+
+  fflush (stdout);
+  for (i = 0; i < jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	{
+	  error (_("Unable to create temporary file: %s\n"),
+		 strerror (errno));
+	  break;
+	}
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	{
+	  error (_("Unable to fork: %s\n"), strerror (errno));
+	  fclose (out[i]);
+	  break;
+	}
+      if (pids[i] == 0)
+	{
+	  FILE *file;
+
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    {
+	      error (_("Unable to redirect output: %s\n"), strerror (errno));
+	      _exit (EXIT_FAILURE);
+	    }
+	  /* Stop the workers sharing the parent's file offsets.  */
+	  file = fopen (filedata->file_name, "rb");
+	  if (file == NULL)
+	    {
+	      error (_("Input file '%s' is not readable.\n"),
+		     filedata->file_name);
+	      _exit (EXIT_FAILURE);
+	    }
+	  fclose (filedata->handle);
+	  filedata->handle = arch->file = file;
+	  if (nested_arch->file != NULL)
+	    {
+	      fclose (nested_arch->file);
+	      nested_arch->file = NULL;
+	      release_archive (nested_arch);
+	    }
+	  *lo = count * i / jobs;
+	  *hi = count * (i + 1) / jobs;
+	  dwarf_jobs = 1;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  n_workers = i;
+  for (i = 0; i < n_workers; i++)
+    {
+      int status;
+      size_t n;
+
+      if (waitpid (pids[i], &status, 0) == -1
+	  || !WIFEXITED (status)
+	  || WEXITSTATUS (status) != 0)
+	*ok = false;
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+
+  *lo = count * n_workers / jobs;
+  *hi = -1ul;
+  free (out);
+  free (pids);
+  return false;
+}
+#endif
+
 /* Process an ELF archive.
    On entry the file is positioned just after the ARMAG string.
    Returns TRUE upon success, FALSE otherwise.  */
@@ -22423,6 +22806,10 @@ process_archive (Filedata * filedata, bool is_thin_archive)
   struct archive_info nested_arch;
   size_t got;
   bool ret = true;
+  unsigned long idx, lo = 0, hi = -1ul;
+#ifdef HAVE_FORK
+  bool worker = false;
+#endif
 
   show_name = true;
 
@@ -22546,7 +22933,18 @@ process_archive (Filedata * filedata, bool is_thin_archive)
 	}
     }
 
-  while (1)
+#ifdef HAVE_FORK
+  if (dwarf_jobs > 1)
+    {
+      unsigned long count = count_archive_members (&arch);
+
+      if (count > 1)
+	worker = start_archive_workers (filedata, &arch, &nested_arch, count,
+					&lo, &hi, &ret);
+    }
+#endif
+
+  for (idx = 0; idx < hi; idx++)
     {
       char * name;
       size_t namelen;
@@ -22602,7 +23000,18 @@ process_archive (Filedata * filedata, bool is_thin_archive)
 	  break;
 	}
 
-      if (is_thin_archive && arch.nested_member_origin == 0)
+      if (idx < lo)
+	{
+	  /* Another --jobs worker displays this member.  */
+	  free (name);
+	  if (!is_thin_archive)
+	    {
+	      arch.next_arhdr_offset += (filedata->archive_file_size + 1) & -2;
+	      if (arch.next_arhdr_offset < filedata->archive_file_size)
+		arch.next_arhdr_offset = -1ul;
+	    }
+	}
+      else if (is_thin_archive && arch.nested_member_origin == 0)
 	{
 	  /* This is a proxy for an external member of a thin archive.  */
 	  Filedata * member_filedata;
@@ -22695,6 +23104,14 @@ process_archive (Filedata * filedata, bool is_thin_archive)
       free (qualified_name);
     }
 
+#ifdef HAVE_FORK
+  if (worker)
+    {
+      fflush (stdout);
+      _exit (ret ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+#endif
+
  out:
   if (nested_arch.file != NULL)
     fclose (nested_arch.file);
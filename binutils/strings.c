@@ -90,6 +90,14 @@
 #include "safe-ctype.h"
 #include "bucomm.h"
 
+#ifdef HAVE_MMAP
+#include <sys/mman.h>
+#endif
+
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #ifndef streq
 #define streq(a,b) (strcmp ((a),(b)) == 0)
 #endif
@@ -148,6 +156,17 @@ static int encoding_bytes;
 /* Output string used to separate parsed strings  */
 static char *output_separator;
 
+/* The number of processes to share the files between.  */
+static unsigned long strings_jobs = 1;
+
+/* STRING_ISGRAPHIC for each byte value, for the single byte encodings.  */
+static bool graphic_byte[256];
+
+enum long_option_values
+{
+  OPTION_JOBS = 200
+};
+
 static struct option long_options[] =
 {
   {"all", no_argument, NULL, 'a'},
@@ -156,6 +175,7 @@ static struct option long_options[] =
   {"encoding", required_argument, NULL, 'e'},
   {"help", no_argument, NULL, 'h'},
   {"include-all-whitespace", no_argument, NULL, 'w'},
+  {"jobs", required_argument, NULL, OPTION_JOBS},
   {"output-separator", required_argument, NULL, 's'},
   {"print-file-name", no_argument, NULL, 'f'},
   {"radix", required_argument, NULL, 't'},
@@ -167,6 +187,12 @@ static struct option long_options[] =
 
 static bool strings_file (char *);
 static void print_strings (const char *, FILE *, file_ptr, int, char *);
+static void print_byte_strings (const char *, file_ptr,
+				const unsigned char *, size_t);
+#ifdef HAVE_FORK
+static bool start_strings_workers (unsigned long, unsigned long *,
+				   unsigned long *, int *);
+#endif
 static void usage (FILE *, int) ATTRIBUTE_NORETURN;
 
 int main (int, char **);
@@ -297,6 +323,17 @@ main (int argc, char **argv)
 	  print_version ("strings");
 	  break;
 
+	case OPTION_JOBS:
+	  strings_jobs = strtoul (optarg, NULL, 0);
+	  if (strings_jobs == 0)
+	    fatal (_("number of jobs must be positive"));
+#ifndef HAVE_FORK
+	  if (strings_jobs > 1)
+	    non_fatal (_("warning: --jobs is not supported on this host"));
+	  strings_jobs = 1;
+#endif
+	  break;
+
 	case '?':
 	  usage (stderr, 1);
 
@@ -336,6 +373,14 @@ main (int argc, char **argv)
       usage (stderr, 1);
     }
 
+  if (encoding_bytes == 1)
+    {
+      int c;
+
+      for (c = 0; c < 256; c++)
+	graphic_byte[c] = STRING_ISGRAPHIC (c);
+    }
+
   if (bfd_init () != BFD_INIT_MAGIC)
     fatal (_("fatal error: libbfd ABI mismatch"));
   set_default_bfd_target ();
@@ -349,6 +394,36 @@ main (int argc, char **argv)
     }
   else
     {
+      unsigned long idx = 0, lo = 0, hi = -1ul;
+#ifdef HAVE_FORK
+      bool worker = false;
+
+      if (strings_jobs > 1)
+	{
+	  unsigned long count = 0;
+	  int i;
+
+	  for (i = optind; i < argc; i++)
+	    if (!streq (argv[i], "-"))
+	      count++;
+	  if (count > 1)
+	    {
+	      int failures;
+
+	      worker = start_strings_workers (count, &lo, &hi, &failures);
+	      if (!worker)
+		{
+		  /* Walk the arguments only to check that files were
+		     given; the workers have displayed them all.  */
+		  exit_status |= failures != 0;
+		  lo = hi = 0;
+		}
+	    }
+	}
+#endif
+
+      /* A "-" argument changes how the files after it are scanned, so
+	 every process walks all of the arguments.  */
       for (; optind < argc; ++optind)
 	{
 	  if (streq (argv[optind], "-"))
@@ -356,9 +431,19 @@ main (int argc, char **argv)
 	  else
 	    {
 	      files_given = true;
-	      exit_status |= !strings_file (argv[optind]);
+	      if (idx >= lo && idx < hi)
+		exit_status |= !strings_file (argv[optind]);
+	      idx++;
 	    }
 	}
+
+#ifdef HAVE_FORK
+      if (worker)
+	{
+	  fflush (stdout);
+	  _exit (exit_status);
+	}
+#endif
     }
 
   if (!files_given)
@@ -367,6 +452,72 @@ main (int argc, char **argv)
   return (exit_status);
 }
 
+#ifdef HAVE_FORK
+/* Share out the COUNT files named on the command line between --jobs
+   worker processes.  Each worker writes its output to a temporary file,
+   which the parent copies to stdout in order once all the workers have
+   finished.  Returns TRUE in a worker, which should scan the files
+   [*LO, *HI) and then exit.  Returns FALSE in the parent, with
+   *FAILURES set to the number of workers that failed.  */
+
+static bool
+start_strings_workers (unsigned long count, unsigned long *lo,
+		       unsigned long *hi, int *failures)
+{
+  unsigned long jobs = count;
+  FILE **out;
+  pid_t *pids;
+  char buf[BUFSIZ];
+  unsigned long i;
+
+  if (strings_jobs < jobs)
+    jobs = strings_jobs;
+  out = xmalloc (jobs * sizeof (*out));
+  pids = xmalloc (jobs * sizeof (*pids));
+
+  fflush (stdout);
+  for (i = 0; i < jobs; i++)
+    {
+      out[i] = tmpfile ();
+      if (out[i] == NULL)
+	fatal (_("can't create temporary file: %s"), strerror (errno));
+      pids[i] = fork ();
+      if (pids[i] == -1)
+	fatal (_("can't fork: %s"), strerror (errno));
+      if (pids[i] == 0)
+	{
+	  if (dup2 (fileno (out[i]), fileno (stdout)) == -1)
+	    fatal (_("can't redirect output: %s"), strerror (errno));
+	  *lo = count * i / jobs;
+	  *hi = count * (i + 1) / jobs;
+	  free (out);
+	  free (pids);
+	  return true;
+	}
+    }
+
+  *failures = 0;
+  for (i = 0; i < jobs; i++)
+    {
+      int status;
+      size_t n;
+
+      if (waitpid (pids[i], &status, 0) == -1
+	  || !WIFEXITED (status)
+	  || WEXITSTATUS (status) != 0)
+	++*failures;
+      rewind (out[i]);
+      while ((n = fread (buf, 1, sizeof (buf), out[i])) != 0)
+	fwrite (buf, 1, n, stdout);
+      fclose (out[i]);
+    }
+
+  free (out);
+  free (pids);
+  return false;
+}
+#endif
+
 /* Scan section SECT of the file ABFD, whose printable name is
    FILENAME.  If it contains initialized data set GOT_A_SECTION and
    print the strings in it.  */
@@ -470,6 +621,36 @@ strings_file (char *file)
     {
       FILE *stream;
 
+#ifdef HAVE_MMAP
+      if (S_ISREG (st.st_mode)
+	  && encoding_bytes == 1
+	  && unicode_display == unicode_default)
+	{
+	  int fd = open (file, O_RDONLY | O_BINARY);
+
+	  if (fd >= 0)
+	    {
+	      size_t size = st.st_size;
+	      void *map = MAP_FAILED;
+
+	      /* An empty file cannot be mapped, but has no strings.  */
+	      if (size == 0)
+		map = NULL;
+	      else if ((off_t) size == st.st_size)
+		map = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	      close (fd);
+	      if (map != MAP_FAILED)
+		{
+		  print_byte_strings (file, 0, map, size);
+		  if (map != NULL)
+		    munmap (map, size);
+		  return true;
+		}
+	    }
+	}
+#endif
+
+
       stream = fopen (file, FOPEN_RB);
       if (stream == NULL)
 	{
@@ -1249,6 +1430,13 @@ print_strings (const char *filename, FILE *stream, file_ptr address,
       return;
     }
 
+  if (stream == NULL && encoding_bytes == 1)
+    {
+      print_byte_strings (filename, address,
+			  (const unsigned char *) magic, magiccount);
+      return;
+    }
+
   char *buf = (char *) xmalloc (sizeof (char) * (string_min + 1));
 
   while (1)
@@ -1306,6 +1494,41 @@ print_strings (const char *filename, FILE *stream, file_ptr address,
   free (buf);
 }
 
+/* Find the strings in the SIZE bytes at BUF, which come from address
+   ADDRESS in FILENAME, when each character is a single byte and UTF-8
+   sequences get no special treatment.  This gives the same output as
+   print_strings, but looks up each byte in a table rather than reading
+   it with get_char, and writes each string with a single call.  */
+
+static void
+print_byte_strings (const char *filename, file_ptr address,
+		    const unsigned char *buf, size_t size)
+{
+  const unsigned char *p = buf;
+  const unsigned char *end = buf + size;
+
+  while (p < end)
+    {
+      const unsigned char *start;
+
+      while (p < end && !graphic_byte[*p])
+	p++;
+      start = p;
+      while (p < end && graphic_byte[*p])
+	p++;
+
+      if ((size_t) (p - start) >= string_min)
+	{
+	  print_filename_and_address (filename, address + (start - buf));
+	  fwrite (start, 1, p - start, stdout);
+	  if (output_separator)
+	    fputs (output_separator, stdout);
+	  else
+	    putchar ('\n');
+	}
+    }
+}
+
 static void
 usage (FILE *stream, int status)
 {
@@ -1334,7 +1557,12 @@ usage (FILE *stream, int status)
                             s = 7-bit, S = 8-bit, {b,l} = 16-bit, {B,L} = 32-bit\n\
   --unicode={default|show|invalid|hex|escape|highlight}\n\
   -U {d|s|i|x|e|h}          Specify how to treat UTF-8 encoded unicode characters\n\
-  -s --output-separator=<string> String used to separate strings in output.\n\
+  -s --output-separator=<string> String used to separate strings in output.\n"));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+  --jobs=<number>           Scan the files with <number> processes\n"));
+#endif
+  fprintf (stream, _("\
   @<file>                   Read options from <file>\n\
   -h --help                 Display this information\n\
   -v -V --version           Print the program's version number\n"));
@@ -0,0 +1,10 @@
+	.file 1 "addr2line.c"
+	.text
+	.loc 1 10
+	.4byte 0
+	.loc 1 20
+	.4byte 0
+	.loc 1 30
+	.4byte 0
+	.loc 1 40
+	.4byte 0
@@ -217,7 +217,8 @@ static char out_buf[20];
 static int add_newlines;
 static char *saved_input;
 static size_t saved_input_len;
-static char input_buffer[32 * 1024];
+/* Matches input-file.c's BUFFER_SIZE.  */
+static char input_buffer[128 * 1024];
 static const char *mri_state;
 static char mri_last_ch;
 
@@ -770,6 +771,69 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 
       /* OK, we are somewhere in states 0 through 4 or 9 through 11.  */
 
+#if !defined TC_KEEP_OPERAND_SPACES && !defined KEEP_WHITE_AROUND_COLON \
+  && !defined TC_Z80
+      /* Operands make up most of the text of compiler generated
+	 code, and in states 3, 9 and 10 only symbol characters,
+	 normal characters and whitespace between them occur in the
+	 common case.  Handle runs of those here without going
+	 through the switch below for every character.  The state
+	 transitions are exactly those made by the code below; any
+	 other character, or whitespace not followed by one of these,
+	 is left to it.  */
+      if ((state == 3 || state == 9 || state == 10)
+	  && ! scrub_m68k_mri
+	  && mri_state == NULL
+#if defined TC_ARM && defined OBJ_ELF
+	  && symver_state == NULL
+#endif
+	  )
+	{
+	  char *s = from;
+
+	  /* Each input character produces at most two output
+	     characters.  */
+	  while (s < fromend && to + 1 < toend)
+	    {
+	      int type = lex[*(unsigned char *) s];
+
+	      if (type == LEX_IS_SYMBOL_COMPONENT)
+		{
+		  if (state == 10)
+		    *to++ = ' ';
+		  state = 9;
+		}
+	      else if (type == 0)
+		{
+		  if (state == 10 && *s == '\\')
+		    break;
+		  state = 3;
+		}
+	      else if (type == LEX_IS_WHITESPACE)
+		{
+		  char *t = s + 1;
+
+		  while (t < fromend && IS_WHITESPACE (*(unsigned char *) t))
+		    t++;
+		  if (t >= fromend)
+		    break;
+		  type = lex[*(unsigned char *) t];
+		  if (type != 0 && type != LEX_IS_SYMBOL_COMPONENT)
+		    break;
+		  if (state == 9)
+		    state = 10;
+		  s = t;
+		  continue;
+		}
+	      else
+		break;
+
+	      *to++ = *s++;
+	    }
+	  from = s;
+	}
+#endif
+
       /* flushchar: */
       ch = GET ();
 
@@ -1419,7 +1483,10 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	    state = 9;
 
 	  /* This is a common case.  Quickly copy CH and all the
-	     following symbol component or normal characters.  */
+	     following symbol component or normal characters.  The
+	     characters are copied as they are scanned, since the runs
+	     are typically short and a separate memcpy costs more than
+	     the copy itself.  */
 	  if (to + 1 < toend
 	      && mri_state == NULL
 #if defined TC_ARM && defined OBJ_ELF
@@ -1428,9 +1495,18 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 	      )
 	    {
 	      char *s;
+	      char *d;
+	      char *lim;
 	      ptrdiff_t len;
 
-	      for (s = from; s < fromend; s++)
+	      lim = fromend;
+	      if (lim - from > (toend - to) - 1)
+		lim = from + ((toend - to) - 1);
+
+	      /* The output slot for CH is filled in below, if any
+		 characters are copied.  */
+	      d = to + 1;
+	      for (s = from; s < lim; s++)
 		{
 		  int type;
 
@@ -1439,6 +1515,7 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 		  if (type != 0
 		      && type != LEX_IS_SYMBOL_COMPONENT)
 		    break;
+		  *d++ = ch2;
 		}
 
 	      if (s > from)
@@ -1448,17 +1525,11 @@ do_scrub_chars (size_t (*get) (char *, size_t), char *tostart, size_t tolen)
 
 	      len = s - from;
 
-	      if (len > (toend - to) - 1)
-		len = (toend - to) - 1;
-
 	      if (len > 0)
 		{
-		  PUT (ch);
-		  memcpy (to, from, len);
-		  to += len;
+		  *to = ch;
+		  to += len + 1;
 		  from += len;
-		  if (to >= toend)
-		    goto tofull;
 		  ch = GET ();
 		}
 	    }
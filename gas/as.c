@@ -45,6 +45,10 @@
 #include "bfdver.h"
 #include "write.h"
 
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+
 #ifdef HAVE_ITBL_CPU
 #include "itbl-ops.h"
 #else
@@ -114,6 +118,10 @@ bool flag_generate_build_notes = DEFAULT_GENERATE_BUILD_NOTES;
 /* Keep the output file.  */
 static int keep_it = 0;
 
+/* Number of INPUT OUTPUT pairs to assemble at once with --batch, or
+   zero if not in batch mode.  */
+static int batch_jobs = 0;
+
 segT reg_section;
 segT expr_section;
 segT text_section;
@@ -263,16 +271,21 @@ Options:\n\
 
   fprintf (stream, _("\
   --alternate             initially turn on alternate macro syntax\n"));
+#ifdef HAVE_FORK
+  fprintf (stream, _("\
+  --batch[=JOBS]          file arguments are INPUT OUTPUT pairs; assemble\n\
+                          each separately, JOBS at a time [default 1]\n"));
+#endif
 #ifdef DEFAULT_FLAG_COMPRESS_DEBUG
   fprintf (stream, _("\
-  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}]\n\
+  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi|zstd}]\n\
                           compress DWARF debug sections using zlib [default]\n"));
   fprintf (stream, _("\
   --nocompress-debug-sections\n\
                           don't compress DWARF debug sections\n"));
 #else
   fprintf (stream, _("\
-  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi}]\n\
+  --compress-debug-sections[={none|zlib|zlib-gnu|zlib-gabi|zstd}]\n\
                           compress DWARF debug sections using zlib\n"));
   fprintf (stream, _("\
   --nocompress-debug-sections\n\
@@ -504,7 +517,8 @@ parse_args (int * pargc, char *** pargv)
       OPTION_COMPRESS_DEBUG,
       OPTION_NOCOMPRESS_DEBUG,
       OPTION_NO_PAD_SECTIONS,
-      OPTION_MULTIBYTE_HANDLING  /* = STD_BASE + 40 */
+      OPTION_MULTIBYTE_HANDLING,  /* = STD_BASE + 40 */
+      OPTION_BATCH
     /* When you add options here, check that they do
        not collide with OPTION_MD_BASE.  See as.h.  */
     };
@@ -522,6 +536,7 @@ parse_args (int * pargc, char *** pargv)
     ,{"a", optional_argument, NULL, 'a'}
     /* Handle -al=<FILE>.  */
     ,{"al", optional_argument, NULL, OPTION_AL}
+    ,{"batch", optional_argument, NULL, OPTION_BATCH}
     ,{"compress-debug-sections", optional_argument, NULL, OPTION_COMPRESS_DEBUG}
     ,{"nocompress-debug-sections", no_argument, NULL, OPTION_NOCOMPRESS_DEBUG}
     ,{"debug-prefix-map", required_argument, NULL, OPTION_DEBUG_PREFIX_MAP}
@@ -698,6 +713,24 @@ parse_args (int * pargc, char *** pargv)
 	    as_fatal (_("unexpected argument to --multibyte-input-option: '%s'"), optarg);
 	  break;
 
+	case OPTION_BATCH:
+#ifdef HAVE_FORK
+	  if (optarg == NULL)
+	    batch_jobs = 1;
+	  else
+	    {
+	      char *end;
+	      long jobs = strtol (optarg, &end, 10);
+
+	      if (*end != '\0' || jobs <= 0 || jobs != (int) jobs)
+		as_fatal (_("bad number of jobs for --batch: `%s'"), optarg);
+	      batch_jobs = jobs;
+	    }
+#else
+	  as_fatal (_("--batch is not supported on this host"));
+#endif
+	  break;
+
 	case OPTION_VERSION:
 	  /* This output is intended to follow the GNU standards document.  */
 	  printf (_("GNU assembler %s\n"), BFD_VERSION_STRING);
@@ -749,6 +782,15 @@ This program has absolutely no warranty.\n"));
 		flag_compress_debug = COMPRESS_DEBUG_GNU_ZLIB;
 	      else if (strcasecmp (optarg, "zlib-gabi") == 0)
 		flag_compress_debug = COMPRESS_DEBUG_GABI_ZLIB;
+	      else if (strcasecmp (optarg, "zstd") == 0)
+		{
+#ifdef HAVE_ZSTD
+		  flag_compress_debug = COMPRESS_DEBUG_ZSTD;
+#else
+		  as_fatal (_("--compress-debug-sections=zstd: gas is not "
+			      "built with zstd support"));
+#endif
+		}
 	      else
 		as_fatal (_("Invalid --compress-debug-sections option: `%s'"),
 			  optarg);
@@ -1185,6 +1227,80 @@ macro_expr (const char *emsg, size_t idx, sb *in, offsetT *val)
   return idx;
 }
 
+#ifdef HAVE_FORK
+/* Wait for one batch child to finish.  Return false if it failed.  */
+
+static bool
+batch_wait (void)
+{
+  int status;
+
+  if (wait (&status) == -1)
+    as_fatal (_("wait failed: %s"), xstrerror (errno));
+  return WIFEXITED (status) && WEXITSTATUS (status) == EXIT_SUCCESS;
+}
+
+/* Handle --batch.  The file arguments in *PARGV are pairs of an INPUT
+   followed by its OUTPUT.  They are separate arguments so that neither
+   name needs to be split, whatever characters it contains.  Fork a
+   child for each pair, running at most batch_jobs of them at
+   once.  In a child this returns with *PARGC and *PARGV naming just its
+   input file and out_file_name set to its output, so that the child
+   assembles it exactly as if it had been invoked on its own.  The
+   parent never returns: it waits for all the children and exits,
+   failing if any of them did.  Everything set up before this point,
+   including the parsed options, is shared with the children.  */
+
+static void
+batch_assemble (int *pargc, char ***pargv)
+{
+  int argc = *pargc;
+  char **argv = *pargv;
+  int i;
+  int running = 0;
+  bool ok = true;
+
+  if (argc < 3 || (argc - 1) % 2 != 0)
+    as_fatal (_("--batch needs pairs of input and output files"));
+
+  for (i = 1; i < argc; i += 2)
+    {
+      pid_t pid;
+
+      if (argv[i][0] == '\0' || argv[i + 1][0] == '\0')
+	as_fatal (_("--batch needs non-empty input and output file names"));
+
+      if (running == batch_jobs)
+	{
+	  if (!batch_wait ())
+	    ok = false;
+	  --running;
+	}
+
+      fflush (stdout);
+      fflush (stderr);
+      pid = fork ();
+      if (pid == -1)
+	as_fatal (_("can't fork: %s"), xstrerror (errno));
+      if (pid == 0)
+	{
+	  out_file_name = argv[i + 1];
+	  argv[1] = argv[i];
+	  argv[2] = NULL;
+	  *pargc = 2;
+	  return;
+	}
+      ++running;
+    }
+
+  while (running-- > 0)
+    if (!batch_wait ())
+      ok = false;
+
+  xexit (ok ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+#endif
+
 /* Here to attempt 1 pass over each input file.
    We scan argv[*] looking for filenames or exactly "" which is
    shorthand for stdin. Any argv that is NULL is not a file-name.
@@ -1314,6 +1430,11 @@ main (int argc, char ** argv)
      so that switches like --hash-size can be honored.  */
   parse_args (&argc, &argv);
 
+#ifdef HAVE_FORK
+  if (batch_jobs != 0)
+    batch_assemble (&argc, &argv);
+#endif
+
   if (argc > 1 && stat (out_file_name, &sob) == 0)
     {
       int i;
@@ -19,16 +19,30 @@
    02110-1301, USA.  */
 
 #include "config.h"
+#include <stdbool.h>
 #include <stdio.h>
 #include <zlib.h>
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
 #include "ansidecl.h"
 #include "compress-debug.h"
 
-/* Initialize the compression engine.  */
+/* Initialize the compression engine, using zstd if USE_ZSTD and zlib
+   otherwise.  */
 
-struct z_stream_s *
-compress_init (void)
+void *
+compress_init (bool use_zstd)
 {
+  if (use_zstd)
+    {
+#if HAVE_ZSTD
+      return ZSTD_createCCtx ();
+#else
+      return NULL;
+#endif
+    }
+
   static struct z_stream_s strm;
 
   strm.zalloc = NULL;
@@ -42,12 +56,33 @@ compress_init (void)
    from the engine goes into the current frag on the obstack.  */
 
 int
-compress_data (struct z_stream_s *strm, const char **next_in,
+compress_data (bool use_zstd, void *ctx, const char **next_in,
 	       int *avail_in, char **next_out, int *avail_out)
 {
+  struct z_stream_s *strm;
   int out_size = 0;
   int x;
 
+  if (use_zstd)
+    {
+#if HAVE_ZSTD
+      ZSTD_outBuffer ob = { *next_out, *avail_out, 0 };
+      ZSTD_inBuffer ib = { *next_in, *avail_in, 0 };
+      size_t ret = ZSTD_compressStream2 (ctx, &ob, &ib, ZSTD_e_continue);
+
+      *next_in += ib.pos;
+      *avail_in -= ib.pos;
+      *next_out += ob.pos;
+      *avail_out -= ob.pos;
+      if (ZSTD_isError (ret))
+	return -1;
+      return (int) ob.pos;
+#else
+      return -1;
+#endif
+    }
+
+  strm = (struct z_stream_s *) ctx;
   strm->next_in = (Bytef *) (*next_in);
   strm->avail_in = *avail_in;
   strm->next_out = (Bytef *) (*next_out);
@@ -71,11 +106,33 @@ compress_data (struct z_stream_s *strm, const char **next_in,
    needed.  */
 
 int
-compress_finish (struct z_stream_s *strm, char **next_out,
+compress_finish (bool use_zstd, void *ctx, char **next_out,
 		 int *avail_out, int *out_size)
 {
+  struct z_stream_s *strm;
   int x;
 
+  if (use_zstd)
+    {
+#if HAVE_ZSTD
+      ZSTD_outBuffer ob = { *next_out, *avail_out, 0 };
+      ZSTD_inBuffer ib = { NULL, 0, 0 };
+      size_t ret = ZSTD_compressStream2 (ctx, &ob, &ib, ZSTD_e_end);
+
+      *out_size = ob.pos;
+      *next_out += ob.pos;
+      *avail_out -= ob.pos;
+      if (ZSTD_isError (ret))
+	return -1;
+      if (ret == 0)
+	ZSTD_freeCCtx (ctx);
+      return ret ? 1 : 0;
+#else
+      return -1;
+#endif
+    }
+
+  strm = (struct z_stream_s *) ctx;
   strm->avail_in = 0;
   strm->next_out = (Bytef *) (*next_out);
   strm->avail_out = *avail_out;
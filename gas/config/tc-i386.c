@@ -87,20 +87,6 @@
 /* This matches the C -> StaticRounding alias in the opcode table.  */
 #define commutative staticrounding
 
-/*
-  'templates' is for grouping together 'template' structures for opcodes
-  of the same name.  This is only used for storing the insns in the grand
-  ole hash table of insns.
-  The templates themselves start at START and range up to (but not including)
-  END.
-  */
-typedef struct
-{
-  const insn_template *start;
-  const insn_template *end;
-}
-templates;
-
 /* 386 operand encoding bytes:  see 386 book for details of this.  */
 typedef struct
 {
@@ -1190,8 +1176,8 @@ const pseudo_typeS md_pseudo_table[] =
 /* For interface with expression ().  */
 extern char *input_line_pointer;
 
-/* Hash table for instruction mnemonic lookup.  */
-static htab_t op_hash;
+/* Hits and misses of the match_template cache, for --statistics.  */
+static unsigned int match_cache_hits, match_cache_misses;
 
 /* Hash table for register lookup.  */
 static htab_t reg_hash;
@@ -2938,38 +2924,6 @@ md_begin (void)
   /* Support pseudo prefixes like {disp32}.  */
   lex_type ['{'] = LEX_BEGIN_NAME;
 
-  /* Initialize op_hash hash table.  */
-  op_hash = str_htab_create ();
-
-  {
-    const insn_template *optab;
-    templates *core_optab;
-
-    /* Setup for loop.  */
-    optab = i386_optab;
-    core_optab = XNEW (templates);
-    core_optab->start = optab;
-
-    while (1)
-      {
-	++optab;
-	if (optab->name == NULL
-	    || strcmp (optab->name, (optab - 1)->name) != 0)
-	  {
-	    /* different name --> ship out current template list;
-	       add to hash table; & begin anew.  */
-	    core_optab->end = optab;
-	    if (str_hash_insert (op_hash, (optab - 1)->name, core_optab, 0))
-	      as_fatal (_("duplicate %s"), (optab - 1)->name);
-
-	    if (optab->name == NULL)
-	      break;
-	    core_optab = XNEW (templates);
-	    core_optab->start = optab;
-	  }
-      }
-  }
-
   /* Initialize reg_hash hash table.  */
   reg_hash = str_htab_create ();
   {
@@ -3096,8 +3050,10 @@ md_begin (void)
 void
 i386_print_statistics (FILE *file)
 {
-  htab_print_statistics (file, "i386 opcode", op_hash);
   htab_print_statistics (file, "i386 register", reg_hash);
+  fprintf (file, "i386 template match cache statistics:\n");
+  fprintf (file, "\t%u hits\n", match_cache_hits);
+  fprintf (file, "\t%u misses\n", match_cache_misses);
 }
 
 #ifdef DEBUG386
@@ -5271,7 +5227,7 @@ parse_insn (char *line, char *mnemonic)
 	}
 
       /* Look up instruction (or prefix) via hash table.  */
-      current_templates = (const templates *) str_hash_find (op_hash, mnemonic);
+      current_templates = i386_mnemonic_lookup (mnemonic);
 
       if (*l != END_OF_INSN
 	  && (!is_space_char (*l) || l[1] != END_OF_INSN)
@@ -5398,7 +5354,7 @@ parse_insn (char *line, char *mnemonic)
 	goto check_suffix;
       mnem_p = dot_p;
       *dot_p = '\0';
-      current_templates = (const templates *) str_hash_find (op_hash, mnemonic);
+      current_templates = i386_mnemonic_lookup (mnemonic);
     }
 
   if (!current_templates)
@@ -5418,8 +5374,7 @@ parse_insn (char *line, char *mnemonic)
 	      case QWORD_MNEM_SUFFIX:
 		i.suffix = mnem_p[-1];
 	      mnem_p[-1] = '\0';
-	      current_templates
-		= (const templates *) str_hash_find (op_hash, mnemonic);
+	      current_templates = i386_mnemonic_lookup (mnemonic);
 	      break;
 	    case SHORT_MNEM_SUFFIX:
 	    case LONG_MNEM_SUFFIX:
@@ -5428,7 +5383,7 @@ parse_insn (char *line, char *mnemonic)
 		  i.suffix = mnem_p[-1];
 		  mnem_p[-1] = '\0';
 		  current_templates
-		    = (const templates *) str_hash_find (op_hash, mnemonic);
+		    = i386_mnemonic_lookup (mnemonic);
 		}
 	      break;
 
@@ -5442,7 +5397,7 @@ parse_insn (char *line, char *mnemonic)
 		    i.suffix = LONG_MNEM_SUFFIX;
 		  mnem_p[-1] = '\0';
 		  current_templates
-		    = (const templates *) str_hash_find (op_hash, mnemonic);
+		    = i386_mnemonic_lookup (mnemonic);
 		}
 	      break;
 	    }
@@ -6395,11 +6350,103 @@ VEX_check_encoding (const insn_template *t)
   return 0;
 }
 
+/* Cache for match_template.  Compiler output uses the same few forms
+   of the same few insns over and over again, and most of the templates
+   for a mnemonic are rejected based only on the operand types, the
+   suffix and a few other properties of the insn and of the assembler
+   state.  For each combination of those properties seen, remember the
+   first template that is not rejected by them, and start the search
+   there next time.  The templates skipped over would all be rejected
+   again in exactly the same way, so the result is the same.  */
+
+struct match_cache_key
+{
+  const insn_template *start;
+  const insn_template *end;
+  i386_operand_type types[MAX_OPERANDS];
+  unsigned int flags[MAX_OPERANDS];
+  i386_cpu_flags cpu_arch_flags;
+  enum bfd_reloc_code_real reloc0;
+  unsigned int operands, reg_operands, mem_operands, imm_operands;
+  unsigned int broadcast_type, broadcast_operand, broadcast_bytes;
+  int dir_encoding, vec_encoding;
+  int flag_code, intel_syntax, intel_mnemonic, isa64;
+  unsigned int sse2avx;
+  char mnem_suffix, suffix;
+  bool addr_prefix, data_prefix, hle_prefix, jumpabsolute;
+};
+
+struct match_cache_entry
+{
+  struct match_cache_key key;
+  /* The first template not rejected by KEY, or NULL if the entry is
+     unused.  */
+  const insn_template *first;
+};
+
+#define MATCH_CACHE_SIZE 1024
+
+static struct match_cache_entry match_cache[MATCH_CACHE_SIZE];
+
+/* Fill in KEY for the current insn with mnemonic suffix MNEM_SUFFIX,
+   and return its hash value.  */
+
+static unsigned int
+match_cache_key (struct match_cache_key *key, char mnem_suffix)
+{
+  unsigned int h = 2166136261u;
+  unsigned int j, w;
+
+  memset (key, 0, sizeof (*key));
+  key->start = current_templates->start;
+  key->end = current_templates->end;
+  for (j = 0; j < i.operands; j++)
+    {
+      key->types[j] = i.types[j];
+      key->flags[j] = i.flags[j];
+    }
+  key->cpu_arch_flags = cpu_arch_flags;
+  key->reloc0 = i.reloc[0];
+  key->operands = i.operands;
+  key->reg_operands = i.reg_operands;
+  key->mem_operands = i.mem_operands;
+  key->imm_operands = i.imm_operands;
+  key->broadcast_type = i.broadcast.type;
+  key->broadcast_operand = i.broadcast.operand;
+  key->broadcast_bytes = i.broadcast.bytes;
+  key->dir_encoding = i.dir_encoding;
+  key->vec_encoding = i.vec_encoding;
+  key->flag_code = flag_code;
+  key->intel_syntax = intel_syntax;
+  key->intel_mnemonic = intel_mnemonic;
+  key->isa64 = isa64;
+  key->sse2avx = sse2avx;
+  key->mnem_suffix = mnem_suffix;
+  key->suffix = i.suffix;
+  key->addr_prefix = i.prefix[ADDR_PREFIX] != 0;
+  key->data_prefix = i.prefix[DATA_PREFIX] != 0;
+  key->hle_prefix = i.hle_prefix != NULL;
+  key->jumpabsolute = i.jumpabsolute;
+
+  for (j = 0; j + sizeof (w) <= sizeof (*key); j += sizeof (w))
+    {
+      memcpy (&w, (const char *) key + j, sizeof (w));
+      h = (h ^ w) * 16777619u;
+    }
+  return h;
+}
+
 static const insn_template *
 match_template (char mnem_suffix)
 {
   /* Points to template once we've found it.  */
   const insn_template *t;
+  /* The first template that isn't rejected by the checks covered by
+     struct match_cache_key.  */
+  const insn_template *first = NULL;
+  struct match_cache_key key;
+  struct match_cache_entry *entry;
+  bool cache_hit = false;
   i386_operand_type overlap0, overlap1, overlap2, overlap3;
   i386_operand_type overlap4;
   unsigned int found_reverse_match;
@@ -6448,7 +6495,20 @@ match_template (char mnem_suffix)
   /* Must have right number of operands.  */
   i.error = number_of_operands_mismatch;
 
-  for (t = current_templates->start; t < current_templates->end; t++)
+  entry = &match_cache[match_cache_key (&key, mnem_suffix)
+		       % MATCH_CACHE_SIZE];
+  t = current_templates->start;
+  if (entry->first != NULL
+      && memcmp (&entry->key, &key, sizeof (key)) == 0)
+    {
+      t = first = entry->first;
+      cache_hit = true;
+      match_cache_hits++;
+    }
+  else
+    match_cache_misses++;
+
+  for (; t < current_templates->end; t++)
     {
       addr_prefix_disp = -1;
       found_reverse_match = 0;
@@ -6557,6 +6617,8 @@ match_template (char mnem_suffix)
       /* Do not verify operands when there are none.  */
       if (!t->operands)
 	{
+	  if (first == NULL)
+	    first = t;
 	  if (VEX_check_encoding (t))
 	    {
 	      specific_error = i.error;
@@ -6820,6 +6882,9 @@ match_template (char mnem_suffix)
 	     slip through to break.  */
 	}
 
+      if (first == NULL)
+	first = t;
+
       /* Check if vector operands are valid.  */
       if (check_VecOperands (t))
 	{
@@ -6838,6 +6903,12 @@ match_template (char mnem_suffix)
       break;
     }
 
+  if (!cache_hit && first != NULL)
+    {
+      entry->key = key;
+      entry->first = first;
+    }
+
   if (t == current_templates->end)
     {
       /* We found no match.  */
@@ -11802,6 +11873,12 @@ i386_frag_max_var (fragS *frag)
 static int
 elf_symbol_resolved_in_segment_p (symbolS *fr_symbol, offsetT fr_var)
 {
+  /* A local symbol can be neither an IFUNC nor global nor weak.  Don't
+     look at its BFD symbol, as that would convert it to a full symbol,
+     which for compiler generated .L labels costs a lot of memory.  */
+  if (symbol_symbolS (fr_symbol) == NULL)
+    return 1;
+
   /* STT_GNU_IFUNC symbol must go through PLT.  */
   if ((symbol_get_bfdsym (fr_symbol)->flags
        & BSF_GNU_INDIRECT_FUNCTION) != 0)
@@ -238,6 +238,7 @@ iq2000_add_macro (const char *  name,
 
   macro->formal_count = 0;
   macro->formals = 0;
+  macro->tmpl = NULL;
 
   sb_add_string (& macro->sub, semantics);
 
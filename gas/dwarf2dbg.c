@@ -514,7 +514,9 @@ dwarf2_gen_line_info_1 (symbolS *label, struct dwarf2_line_info *loc)
       return;
     }
 
-  e = XNEW (struct line_entry);
+  /* Entries live until the end of assembly, so allocate them on the
+     notes obstack rather than individually.  */
+  e = (struct line_entry *) obstack_alloc (&notes, sizeof (*e));
   e->next = NULL;
   e->label = label;
   e->loc = *loc;
@@ -584,7 +586,7 @@ dwarf2_gen_line_info (addressT ofs, struct dwarf2_line_info *loc)
       sym = symbol_new (name, now_seg, frag_now, ofs);
     }
   else
-    sym = symbol_temp_new (now_seg, frag_now, ofs);
+    sym = symbol_temp_new_local (now_seg, frag_now, ofs);
   dwarf2_gen_line_info_1 (sym, loc);
 }
 
@@ -789,7 +791,7 @@ do_allocate_filenum (struct line_entry *e)
 
 /* Remove any generated line entries.  These don't live comfortably
    with compiler generated line info.  If THELOT then remove
-   everything, freeing all list entries we have created.  */
+   everything, freeing all list headers we have created.  */
 
 static void
 purge_generated_debug (bool thelot)
@@ -802,15 +804,12 @@ purge_generated_debug (bool thelot)
 
       for (lss = s->head; lss; lss = nextlss)
 	{
-	  struct line_entry *e, *next;
+	  struct line_entry *e;
 
-	  for (e = lss->head; e; e = next)
-	    {
-	      if (!thelot)
-		know (e->loc.filenum == -1u);
-	      next = e->next;
-	      free (e);
-	    }
+	  /* Line entries are allocated on the notes obstack.  */
+	  if (!thelot)
+	    for (e = lss->head; e; e = e->next)
+	      know (e->loc.filenum == -1u);
 
 	  lss->head = NULL;
 	  lss->ptail = &lss->head;
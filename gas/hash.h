@@ -110,8 +110,8 @@ str_hash_insert (htab_t table, const char *key, const void *value, int replace)
 static inline htab_t
 str_htab_create (void)
 {
-  return htab_create_alloc (16, hash_string_tuple, eq_string_tuple,
-			    NULL, xcalloc, free);
+  return htab_create_alloc_flags (16, hash_string_tuple, eq_string_tuple,
+				  NULL, xcalloc, free, HTAB_STORE_HASHES);
 }
 
 #endif /* HASH_H */
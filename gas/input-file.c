@@ -33,11 +33,13 @@ int preprocess = 0;
 
 /* This code opens a file, then delivers BUFFER_SIZE character
    chunks of the file on demand.
-   BUFFER_SIZE is supposed to be a number chosen for speed.
+   BUFFER_SIZE is supposed to be a number chosen for speed; it is
+   large enough that big compiler-generated inputs, often read from a
+   pipe, don't cost a read system call every few lines.
    The caller only asks once what BUFFER_SIZE is, and asks before
    the nature of the input files (if any) is known.  */
 
-#define BUFFER_SIZE (32 * 1024)
+#define BUFFER_SIZE (128 * 1024)
 
 /* We use static data: the data area is not sharable.  */
 
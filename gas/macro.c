@@ -70,6 +70,26 @@ static size_t (*macro_expr) (const char *, size_t, sb *, offsetT *);
 
 static int macro_number;
 
+/* A macro body scanned once in the default syntax mode, so that
+   expanding it is a matter of copying the literal text and splicing in
+   the actual arguments.  Each substitution is recorded as the offset in
+   TEXT where it goes and the formal whose value is inserted there, or
+   NULL for the macro invocation number (\@).  */
+
+struct macro_subst
+{
+  size_t offset;
+  formal_entry *formal;
+};
+
+struct macro_template
+{
+  sb text;
+  struct macro_subst *subst;
+  size_t count;
+  size_t alloc;
+};
+
 /* Initialize macro processing.  */
 
 void
@@ -656,6 +676,9 @@ do_formals (macro_entry *macro, size_t idx, sb *in)
   return idx;
 }
 
+static struct macro_template *compile_macro_body (sb *, struct htab *);
+static void free_macro_template (struct macro_template *);
+
 /* Free the memory allocated to a macro.  */
 
 static void
@@ -673,6 +696,7 @@ free_macro (macro_entry *macro)
     }
   htab_delete (macro->formal_hash);
   sb_kill (&macro->sub);
+  free_macro_template (macro->tmpl);
   free (macro);
 }
 
@@ -700,6 +724,7 @@ define_macro (size_t idx, sb *in, sb *label,
   macro->formals = 0;
   macro->formal_hash = htab_create_alloc (7, hash_formal_entry, eq_formal_entry,
 					  NULL, xcalloc, free);
+  macro->tmpl = NULL;
 
   idx = sb_skip_white (idx, in);
   if (! buffer_and_nest ("MACRO", "ENDM", &macro->sub, get_line))
@@ -758,7 +783,10 @@ define_macro (size_t idx, sb *in, sb *label,
     *namep = macro->name;
 
   if (!error)
-    macro_defined = 1;
+    {
+      macro_defined = 1;
+      macro->tmpl = compile_macro_body (&macro->sub, macro->formal_hash);
+    }
   else
     free_macro (macro);
 
@@ -1059,6 +1087,158 @@ macro_expand_body (sb *in, sb *out, formal_entry *formals,
   return err;
 }
 
+/* Record a substitution of FORMAL at the current end of T's text.  */
+
+static void
+add_macro_subst (struct macro_template *t, formal_entry *formal)
+{
+  if (t->count == t->alloc)
+    {
+      t->alloc = t->alloc ? t->alloc * 2 : 8;
+      t->subst = XRESIZEVEC (struct macro_subst, t->subst, t->alloc);
+    }
+  t->subst[t->count].offset = t->text.len;
+  t->subst[t->count].formal = formal;
+  t->count++;
+}
+
+static void
+free_macro_template (struct macro_template *t)
+{
+  if (t == NULL)
+    return;
+  sb_kill (&t->text);
+  free (t->subst);
+  free (t);
+}
+
+/* Scan IN, a macro or .irp body whose formals are in FORMAL_HASH, once
+   and for all, doing what macro_expand_body would do apart from the
+   substitutions themselves.  This is only possible in the default
+   syntax mode: the alternate and MRI modes allow LOCAL and add formals
+   at expansion time.  Returns NULL if the body can't be handled this
+   way, in which case macro_expand_body is used for every expansion,
+   which also reports any errors.  */
+
+static struct macro_template *
+compile_macro_body (sb *in, struct htab *formal_hash)
+{
+  struct macro_template *t;
+  size_t src = 0;
+  sb name;
+
+  if (macro_mri || macro_alternate || macro_strip_at)
+    return NULL;
+
+  t = XNEW (struct macro_template);
+  sb_build (&t->text, in->len);
+  t->subst = NULL;
+  t->count = 0;
+  t->alloc = 0;
+  sb_new (&name);
+
+  while (src < in->len)
+    {
+      const char *p;
+      size_t start;
+      int kind;
+      formal_entry *f;
+
+      /* Copy plain text in bulk.  */
+      p = memchr (in->ptr + src, '&', in->len - src);
+      start = p ? (size_t) (p - in->ptr) : in->len;
+      p = memchr (in->ptr + src, '\\', start - src);
+      if (p)
+	start = p - in->ptr;
+      sb_add_buffer (&t->text, in->ptr + src, start - src);
+      src = start;
+      if (src >= in->len)
+	break;
+
+      if (in->ptr[src] == '&')
+	kind = '&';
+      else
+	{
+	  kind = '\'';
+	  src++;
+	  if (src < in->len && in->ptr[src] == '(')
+	    {
+	      /* Sub in till the next ')' literally.  */
+	      p = memchr (in->ptr + src + 1, ')', in->len - src - 1);
+	      if (p == NULL)
+		{
+		  free_macro_template (t);
+		  sb_kill (&name);
+		  return NULL;
+		}
+	      sb_add_buffer (&t->text, in->ptr + src + 1,
+			     p - (in->ptr + src + 1));
+	      src = p - in->ptr + 1;
+	      continue;
+	    }
+	  else if (src < in->len && in->ptr[src] == '@')
+	    {
+	      add_macro_subst (t, NULL);
+	      src++;
+	      continue;
+	    }
+	  else if (src < in->len && in->ptr[src] == '&')
+	    {
+	      sb_add_string (&t->text, "\\&");
+	      src++;
+	      continue;
+	    }
+	  --src;
+	}
+
+      /* As sub_actual.  */
+      start = src + 1;
+      sb_reset (&name);
+      src = get_apost_token (start, in, &name, kind);
+      f = formal_entry_find (formal_hash, sb_terminate (&name));
+      if (f != NULL)
+	add_macro_subst (t, f);
+      else
+	{
+	  sb_add_char (&t->text, kind == '&' ? '&' : '\\');
+	  sb_add_sb (&t->text, &name);
+	  if (kind == '&' && src != start && in->ptr[src - 1] == '&')
+	    sb_add_char (&t->text, '&');
+	}
+    }
+
+  sb_kill (&name);
+  return t;
+}
+
+/* Expand T into OUT using the current actual arguments.  */
+
+static void
+macro_expand_template (const struct macro_template *t, sb *out)
+{
+  size_t i, pos = 0;
+
+  for (i = 0; i < t->count; i++)
+    {
+      const struct macro_subst *s = &t->subst[i];
+
+      sb_add_buffer (out, t->text.ptr + pos, s->offset - pos);
+      pos = s->offset;
+      if (s->formal == NULL)
+	{
+	  char buffer[12];
+
+	  sprintf (buffer, "%d", macro_number);
+	  sb_add_string (out, buffer);
+	}
+      else if (s->formal->actual.len)
+	sb_add_sb (out, &s->formal->actual);
+      else
+	sb_add_sb (out, &s->formal->def);
+    }
+  sb_add_buffer (out, t->text.ptr + pos, t->text.len - pos);
+}
+
 /* Assign values to the formal parameters of a macro, and expand the
    body.  */
 
@@ -1239,7 +1419,11 @@ macro_expand (size_t idx, sb *in, macro_entry *m, sb *out)
 	  sb_add_string (&ptr->actual, buffer);
 	}
 
-      err = macro_expand_body (&m->sub, out, m->formals, m->formal_hash, m);
+      if (m->tmpl != NULL
+	  && !macro_mri && !macro_alternate && !macro_strip_at)
+	macro_expand_template (m->tmpl, out);
+      else
+	err = macro_expand_body (&m->sub, out, m->formals, m->formal_hash, m);
     }
 
   /* Discard any unnamed formal arguments.  */
@@ -1277,6 +1461,7 @@ check_macro (const char *line, sb *expand,
 {
   const char *s;
   char *copy, *cls;
+  char buf[64];
   macro_entry *macro;
   sb line_sb;
 
@@ -1290,12 +1475,22 @@ check_macro (const char *line, sb *expand,
   if (is_name_ender (*s))
     ++s;
 
-  copy = xmemdup0 (line, s - line);
+  /* This is done for every line once any macro is defined, so avoid
+     the heap for the name copy in the usual case.  */
+  if ((size_t) (s - line) < sizeof (buf))
+    {
+      memcpy (buf, line, s - line);
+      buf[s - line] = '\0';
+      copy = buf;
+    }
+  else
+    copy = xmemdup0 (line, s - line);
   for (cls = copy; *cls != '\0'; cls ++)
     *cls = TOLOWER (*cls);
 
   macro = macro_entry_find (macro_hash, copy);
-  free (copy);
+  if (copy != buf)
+    free (copy);
 
   if (macro == NULL)
     return 0;
@@ -1356,6 +1551,7 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
   sb sub;
   formal_entry f;
   struct htab *h;
+  struct macro_template *tmpl;
   const char *err = NULL;
 
   idx = sb_skip_white (idx, in);
@@ -1381,6 +1577,8 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
   f.next = NULL;
   f.type = FORMAL_OPTIONAL;
 
+  tmpl = compile_macro_body (&sub, h);
+
   sb_reset (out);
 
   idx = sb_skip_comma (idx, in);
@@ -1424,7 +1622,10 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
 	      ++idx;
 	    }
 
-	  err = macro_expand_body (&sub, out, &f, h, 0);
+	  if (tmpl != NULL)
+	    macro_expand_template (tmpl, out);
+	  else
+	    err = macro_expand_body (&sub, out, &f, h, 0);
 	  if (err != NULL)
 	    break;
 	  if (!irpc)
@@ -1434,6 +1635,7 @@ expand_irp (int irpc, size_t idx, sb *in, sb *out, size_t (*get_line) (sb *))
 	}
     }
 
+  free_macro_template (tmpl);
   htab_delete (h);
   sb_kill (&f.actual);
   sb_kill (&f.def);
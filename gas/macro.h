@@ -67,6 +67,7 @@ typedef struct macro_struct
   const char *name;			/* Macro name.  */
   const char *file;				/* File the macro was defined in.  */
   unsigned int line;			/* Line number of definition.  */
+  struct macro_template *tmpl;		/* Pre-scanned body, or NULL.  */
 } macro_entry;
 
 /* Whether any macros have been defined.  */
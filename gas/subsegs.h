@@ -71,6 +71,10 @@ typedef struct segment_info_struct {
      there are frags.  */
   unsigned int bss : 1;
 
+  /* This field is set once all the frags in this section have a fixed
+     size, so that further relaxation passes cannot move them.  */
+  unsigned int fixed_frags : 1;
+
   int user_stuff;
 
   /* Fixups for this segment.  This is only valid after the frchains
@@ -101,6 +105,9 @@ typedef struct segment_info_struct {
   }
   stabu;
 
+  /* Run time spent relaxing this section, for --statistics.  */
+  long relax_time;
+
 #ifdef NEED_LITERAL_POOL
   unsigned long literal_pool_size;
 #endif
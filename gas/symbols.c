@@ -846,6 +846,34 @@ symbol_temp_new (segT seg, fragS *frag, valueT ofs)
   return symbol_new (FAKE_LABEL_NAME, seg, frag, ofs);
 }
 
+/* Like symbol_temp_new, but create a local symbol which is neither
+   entered in the symbol hash table nor put on the symbol chain unless
+   something later needs the full symbol.  This is much cheaper for the
+   large number of position labels generated for debug info.  */
+
+symbolS *
+symbol_temp_new_local (segT seg, fragS *frag, valueT ofs)
+{
+  static const char *fake_label_name;
+  struct local_symbol *ret;
+  struct symbol_flags flags = { .local_symbol = 1, .resolved = 0 };
+
+  if (fake_label_name == NULL)
+    fake_label_name = save_symbol_name (FAKE_LABEL_NAME);
+
+  ++local_symbol_count;
+
+  ret = (struct local_symbol *) obstack_alloc (&notes, sizeof *ret);
+  ret->flags = flags;
+  ret->hash = 0;
+  ret->name = fake_label_name;
+  ret->frag = frag;
+  ret->section = seg;
+  ret->value = ofs;
+
+  return (symbolS *) ret;
+}
+
 symbolS *
 symbol_temp_new_now (void)
 {
@@ -2983,8 +3011,8 @@ symbol_begin (void)
 {
   symbol_lastP = NULL;
   symbol_rootP = NULL;		/* In case we have 0 symbols (!!)  */
-  sy_hash = htab_create_alloc (16, hash_symbol_entry, eq_symbol_entry,
-			       NULL, xcalloc, free);
+  sy_hash = htab_create_alloc_flags (16, hash_symbol_entry, eq_symbol_entry,
+				     NULL, xcalloc, free, HTAB_STORE_HASHES);
 
 #if defined (EMIT_SECTION_SYMBOLS) || !defined (RELOC_REQUIRES_SYMBOL)
   abs_symbol.bsym = bfd_abs_section_ptr->symbol;
@@ -53,6 +53,7 @@ symbolS *symbol_clone (symbolS *, int);
 symbolS *symbol_clone_if_forward_ref (symbolS *, int);
 #define symbol_clone_if_forward_ref(s) symbol_clone_if_forward_ref (s, 0)
 symbolS *symbol_temp_new (segT, fragS *, valueT);
+symbolS *symbol_temp_new_local (segT, fragS *, valueT);
 symbolS *symbol_temp_new_now (void);
 symbolS *symbol_temp_new_now_octets (void);
 symbolS *symbol_temp_make (void);
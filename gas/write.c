@@ -534,15 +534,43 @@ struct relax_seg_info
   int changed;
 };
 
+/* The number of relaxation passes, for --statistics.  */
+static int n_relax_passes;
+
+/* Return TRUE if every frag in the chain starting at FRAGP has a fixed
+   size, so that relaxing its section again cannot change anything.  */
+
+static bool
+frags_fixed_p (fragS *fragp)
+{
+  for (; fragp != NULL; fragp = fragp->fr_next)
+    if (fragp->fr_type != rs_fill)
+      return false;
+  return true;
+}
+
 static void
 relax_seg (bfd *abfd ATTRIBUTE_UNUSED, asection *sec, void *xxx)
 {
   segment_info_type *seginfo = seg_info (sec);
   struct relax_seg_info *info = (struct relax_seg_info *) xxx;
+  long start = 0;
 
-  if (seginfo && seginfo->frchainP
-      && relax_segment (seginfo->frchainP->frch_root, sec, info->pass))
+  /* Sections holding only fixed size frags, typically large data
+     sections, have their final addresses after one pass.  Don't walk
+     them again each time another section needs another pass.  */
+  if (seginfo == NULL || seginfo->frchainP == NULL || seginfo->fixed_frags)
+    return;
+
+  if (flag_print_statistics)
+    start = get_run_time ();
+
+  if (relax_segment (seginfo->frchainP->frch_root, sec, info->pass))
     info->changed = 1;
+  seginfo->fixed_frags = frags_fixed_p (seginfo->frchainP->frch_root);
+
+  if (flag_print_statistics)
+    seginfo->relax_time += get_run_time () - start;
 }
 
 static void
@@ -1413,7 +1441,7 @@ write_relocs (bfd *abfd ATTRIBUTE_UNUSED, asection *sec,
 }
 
 static int
-compress_frag (struct z_stream_s *strm, const char *contents, int in_size,
+compress_frag (bool use_zstd, void *ctx, const char *contents, int in_size,
 	       fragS **last_newf, struct obstack *ob)
 {
   int out_size;
@@ -1442,7 +1470,7 @@ compress_frag (struct z_stream_s *strm, const char *contents, int in_size,
 	as_fatal (_("can't extend frag"));
       next_out = obstack_next_free (ob);
       obstack_blank_fast (ob, avail_out);
-      out_size = compress_data (strm, &contents, &in_size,
+      out_size = compress_data (use_zstd, ctx, &contents, &in_size,
 				&next_out, &avail_out);
       if (out_size < 0)
         return -1;
@@ -1471,10 +1499,11 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
   const char *section_name;
   char *compressed_name;
   char *header;
-  struct z_stream_s *strm;
+  void *ctx;
   int x;
   flagword flags = bfd_section_flags (sec);
   unsigned int header_size, compression_header_size;
+  bool use_zstd = flag_compress_debug == COMPRESS_DEBUG_ZSTD;
 
   if (seginfo == NULL
       || sec->size < 32
@@ -1485,11 +1514,12 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
   if (!startswith (section_name, ".debug_"))
     return;
 
-  strm = compress_init ();
-  if (strm == NULL)
+  ctx = compress_init (use_zstd);
+  if (ctx == NULL)
     return;
 
-  if (flag_compress_debug == COMPRESS_DEBUG_GABI_ZLIB)
+  if (flag_compress_debug == COMPRESS_DEBUG_GABI_ZLIB
+      || flag_compress_debug == COMPRESS_DEBUG_ZSTD)
     {
       compression_header_size
 	= bfd_get_compression_header_size (stdoutput, NULL);
@@ -1531,7 +1561,7 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
       gas_assert (f->fr_type == rs_fill);
       if (f->fr_fix)
 	{
-	  out_size = compress_frag (strm, f->fr_literal, f->fr_fix,
+	  out_size = compress_frag (use_zstd, ctx, f->fr_literal, f->fr_fix,
 				    &last_newf, ob);
 	  if (out_size < 0)
 	    return;
@@ -1545,8 +1575,8 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
 	{
 	  while (count--)
 	    {
-	      out_size = compress_frag (strm, fill_literal, (int) fill_size,
-				        &last_newf, ob);
+	      out_size = compress_frag (use_zstd, ctx, fill_literal,
+					(int) fill_size, &last_newf, ob);
 	      if (out_size < 0)
 		return;
 	      compressed_size += out_size;
@@ -1579,7 +1609,7 @@ compress_debug (bfd *abfd, asection *sec, void *xxx ATTRIBUTE_UNUSED)
 	as_fatal (_("can't extend frag"));
       next_out = obstack_next_free (ob);
       obstack_blank_fast (ob, avail_out);
-      x = compress_finish (strm, &next_out, &avail_out, &out_size);
+      x = compress_finish (use_zstd, ctx, &next_out, &avail_out, &out_size);
       if (x < 0)
 	return;
 
@@ -2196,6 +2226,7 @@ write_object_file (void)
       rsi.changed = 0;
       bfd_map_over_sections (stdoutput, relax_seg, &rsi);
       rsi.pass++;
+      n_relax_passes = rsi.pass;
       if (!rsi.changed)
 	break;
     }
@@ -2540,6 +2571,8 @@ write_object_file (void)
     {
       if (flag_compress_debug == COMPRESS_DEBUG_GABI_ZLIB)
 	stdoutput->flags |= BFD_COMPRESS | BFD_COMPRESS_GABI;
+      else if (flag_compress_debug == COMPRESS_DEBUG_ZSTD)
+	stdoutput->flags |= BFD_COMPRESS | BFD_COMPRESS_GABI | BFD_COMPRESS_ZSTD;
       else
 	stdoutput->flags |= BFD_COMPRESS;
       bfd_map_over_sections (stdoutput, compress_debug, (char *) 0);
@@ -2574,6 +2607,14 @@ relax_frag (segT segment, fragS *fragP, long stretch)
   table = TC_GENERIC_RELAX_TABLE;
   this_state = fragP->fr_subtype;
   start_type = this_type = table + this_state;
+
+  /* A frag already in its final state can never grow again, so there
+     is no need to look up where its target has moved to.  Large
+     sections full of branches that were relaxed on an early pass
+     otherwise pay for a symbol lookup per branch on every pass.  */
+  if (this_type->rlx_more == 0)
+    return 0;
+
   symbolP = fragP->fr_symbol;
 
   if (symbolP)
@@ -3198,10 +3239,25 @@ number_to_chars_littleendian (char *buf, valueT val, int n)
     }
 }
 
+static void
+print_relax_time (bfd *abfd ATTRIBUTE_UNUSED, asection *sec, void *xxx)
+{
+  segment_info_type *seginfo = seg_info (sec);
+  FILE *file = (FILE *) xxx;
+
+  if (seginfo != NULL && seginfo->relax_time != 0)
+    fprintf (file, "relaxation time for %s: %ld.%06ld\n",
+	     segment_name (sec), seginfo->relax_time / 1000000,
+	     seginfo->relax_time % 1000000);
+}
+
 void
 write_print_statistics (FILE *file)
 {
   fprintf (file, "fixups: %d\n", n_fixups);
+  fprintf (file, "relaxation passes: %d\n", n_relax_passes);
+  if (stdoutput != NULL)
+    bfd_map_over_sections (stdoutput, print_relax_time, file);
 }
 
 /* For debugging.  */
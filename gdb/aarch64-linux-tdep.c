@@ -1816,7 +1816,11 @@ aarch64_linux_init_abi (struct gdbarch_info info, struct gdbarch *gdbarch)
 
   tdep->lowest_pc = 0x8000;
 
-  linux_init_abi (info, gdbarch, 1);
+  /* A displaced step buffer holds a single instruction, so even a
+     short _start has room for a few of them, letting that many
+     threads step over breakpoints at the same time in non-stop
+     mode.  */
+  linux_init_abi (info, gdbarch, 4);
 
   set_solib_svr4_fetch_link_map_offsets (gdbarch,
 					 linux_lp64_fetch_link_map_offsets);
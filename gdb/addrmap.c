@@ -21,6 +21,7 @@
 #include "gdbsupport/gdb_obstack.h"
 #include "addrmap.h"
 #include "gdbsupport/selftest.h"
+#include <algorithm>
 
 /* Make sure splay trees can actually hold the values we want to
    store in them.  */
@@ -43,32 +44,27 @@ addrmap_fixed::set_empty (CORE_ADDR start, CORE_ADDR end_inclusive,
 void *
 addrmap_fixed::find (CORE_ADDR addr) const
 {
-  const struct addrmap_transition *bottom = &transitions[0];
-  const struct addrmap_transition *top = &transitions[num_transitions - 1];
-
-  while (bottom < top)
+  /* Find the last transition at or below ADDR.  There always is one,
+     since ADDRS[0] is zero.  The loop halves the candidate range
+     without a data-dependent branch, and fetches both possible next
+     probes while the current one is compared; on maps with millions
+     of transitions the search is bound by cache misses.  */
+  const CORE_ADDR *base = addrs;
+  size_t n = num_transitions;
+
+  while (n > 1)
     {
-      /* This needs to round towards top, or else when top = bottom +
-	 1 (i.e., two entries are under consideration), then mid ==
-	 bottom, and then we may not narrow the range when (mid->addr
-	 < addr).  */
-      const addrmap_transition *mid = top - (top - bottom) / 2;
-
-      if (mid->addr == addr)
-	{
-	  bottom = mid;
-	  break;
-	}
-      else if (mid->addr < addr)
-	/* We don't eliminate mid itself here, since each transition
-	   covers all subsequent addresses until the next.  This is why
-	   we must round up in computing the midpoint.  */
-	bottom = mid;
-      else
-	top = mid - 1;
+      size_t half = n / 2;
+
+#ifdef __GNUC__
+      __builtin_prefetch (base + half / 2);
+      __builtin_prefetch (base + half + half / 2);
+#endif
+      base = base[half] <= addr ? base + half : base;
+      n -= half;
     }
 
-  return bottom->value;
+  return values[base - addrs];
 }
 
 
@@ -78,7 +74,7 @@ addrmap_fixed::relocate (CORE_ADDR offset)
   size_t i;
 
   for (i = 0; i < num_transitions; i++)
-    transitions[i].addr += offset;
+    addrs[i] += offset;
 }
 
 
@@ -89,7 +85,7 @@ addrmap_fixed::foreach (addrmap_foreach_fn fn)
 
   for (i = 0; i < num_transitions; i++)
     {
-      int res = fn (transitions[i].addr, transitions[i].value);
+      int res = fn (addrs[i], values[i]);
 
       if (res != 0)
 	return res;
@@ -277,17 +273,17 @@ addrmap_fixed::addrmap_fixed (struct obstack *obstack, addrmap_mutable *mut)
   transition_count++;
 
   num_transitions = 1;
-  transitions = XOBNEWVEC (obstack, struct addrmap_transition,
-			   transition_count);
-  transitions[0].addr = 0;
-  transitions[0].value = NULL;
+  addrs = XOBNEWVEC (obstack, CORE_ADDR, transition_count);
+  values = XOBNEWVEC (obstack, void *, transition_count);
+  addrs[0] = 0;
+  values[0] = NULL;
 
   /* Copy all entries from the splay tree to the array, in order 
      of increasing address.  */
   mut->foreach ([&] (CORE_ADDR start, void *obj)
     {
-      transitions[num_transitions].addr = start;
-      transitions[num_transitions].value = obj;
+      addrs[num_transitions] = start;
+      values[num_transitions] = obj;
       ++num_transitions;
       return 0;
     });
@@ -297,6 +293,74 @@ addrmap_fixed::addrmap_fixed (struct obstack *obstack, addrmap_mutable *mut)
 }
 
 
+addrmap_fixed::addrmap_fixed (struct obstack *obstack,
+			      std::vector<addrmap_range> &ranges)
+{
+  /* Every transition is at the start of a range or just past its
+     end.  */
+  std::vector<CORE_ADDR> points;
+  points.reserve (2 * ranges.size () + 1);
+  points.push_back (0);
+  for (const addrmap_range &r : ranges)
+    {
+      gdb_assert (r.obj != nullptr);
+      gdb_assert (r.start <= r.end_inclusive);
+      points.push_back (r.start);
+      if (r.end_inclusive < CORE_ADDR_MAX)
+	points.push_back (r.end_inclusive + 1);
+    }
+  std::sort (points.begin (), points.end ());
+  points.erase (std::unique (points.begin (), points.end ()), points.end ());
+
+  /* Visit the ranges by start address.  Where ranges overlap, the
+     earliest in RANGES wins, so a range's index is its priority.  */
+  std::vector<size_t> order (ranges.size ());
+  for (size_t i = 0; i < ranges.size (); ++i)
+    order[i] = i;
+  std::sort (order.begin (), order.end (), [&] (size_t a, size_t b)
+    {
+      return ranges[a].start < ranges[b].start;
+    });
+
+  /* Sweep the points, keeping the ranges that have started in a heap
+     with the highest priority on top.  Ranges that have ended are
+     only dropped once they reach the top.  */
+  auto lower_priority = [] (size_t a, size_t b) { return a > b; };
+  std::vector<size_t> active;
+  std::vector<CORE_ADDR> new_addrs;
+  std::vector<void *> new_values;
+  size_t next = 0;
+
+  for (CORE_ADDR point : points)
+    {
+      while (next < order.size () && ranges[order[next]].start <= point)
+	{
+	  active.push_back (order[next++]);
+	  std::push_heap (active.begin (), active.end (), lower_priority);
+	}
+      while (!active.empty ()
+	     && ranges[active.front ()].end_inclusive < point)
+	{
+	  std::pop_heap (active.begin (), active.end (), lower_priority);
+	  active.pop_back ();
+	}
+
+      void *value = active.empty () ? nullptr : ranges[active.front ()].obj;
+      if (new_values.empty () || value != new_values.back ())
+	{
+	  new_addrs.push_back (point);
+	  new_values.push_back (value);
+	}
+    }
+
+  num_transitions = new_addrs.size ();
+  addrs = XOBNEWVEC (obstack, CORE_ADDR, num_transitions);
+  values = XOBNEWVEC (obstack, void *, num_transitions);
+  std::copy (new_addrs.begin (), new_addrs.end (), addrs);
+  std::copy (new_values.begin (), new_values.end (), values);
+}
+
+
 void
 addrmap_mutable::relocate (CORE_ADDR offset)
 {
@@ -478,6 +542,17 @@ test_addrmap ()
   CHECK_ADDRMAP_FIND (map, array, 10, 12, val1);
   CHECK_ADDRMAP_FIND (map, array, 13, 13, val2);
   CHECK_ADDRMAP_FIND (map, array, 14, 19, nullptr);
+
+  /* Build a fixed addrmap directly from the same ranges.  */
+  std::vector<addrmap_range> ranges
+    = { { core_addr (&array[10]), core_addr (&array[12]), val1 },
+	{ core_addr (&array[11]), core_addr (&array[13]), val2 } };
+  struct addrmap *map3
+    = new (&temp_obstack) addrmap_fixed (&temp_obstack, ranges);
+  CHECK_ADDRMAP_FIND (map3, array, 0, 9, nullptr);
+  CHECK_ADDRMAP_FIND (map3, array, 10, 12, val1);
+  CHECK_ADDRMAP_FIND (map3, array, 13, 13, val2);
+  CHECK_ADDRMAP_FIND (map3, array, 14, 19, nullptr);
 }
 
 } // namespace selftests
@@ -22,6 +22,7 @@
 
 #include "splay-tree.h"
 #include "gdbsupport/function-view.h"
+#include <vector>
 
 /* An address map is essentially a table mapping CORE_ADDRs onto GDB
    data structures, like blocks, symtabs, partial symtabs, and so on.
@@ -100,6 +101,16 @@ struct addrmap
 
 struct addrmap_mutable;
 
+/* A range of addresses, START to END_INCLUSIVE, to be mapped to OBJ.
+   Used to build a fixed address map without a mutable one.  */
+
+struct addrmap_range
+{
+  CORE_ADDR start;
+  CORE_ADDR end_inclusive;
+  void *obj;
+};
+
 /* Fixed address maps.  */
 struct addrmap_fixed : public addrmap,
 		       public allocate_on_obstack
@@ -107,6 +118,13 @@ struct addrmap_fixed : public addrmap,
 public:
 
   addrmap_fixed (struct obstack *obstack, addrmap_mutable *mut);
+
+  /* Build the map that would result from calling set_empty on an
+     empty mutable map for each of RANGES in turn, so that where
+     ranges overlap, the earliest one wins.  This sorts RANGES.  */
+  addrmap_fixed (struct obstack *obstack,
+		 std::vector<addrmap_range> &ranges);
+
   DISABLE_COPY_AND_ASSIGN (addrmap_fixed);
 
   void set_empty (CORE_ADDR start, CORE_ADDR end_inclusive,
@@ -117,24 +135,18 @@ struct addrmap_fixed : public addrmap,
 
 private:
 
-  /* A transition: a point in an address map where the value changes.
-     The map maps ADDR to VALUE, but if ADDR > 0, it maps ADDR-1 to
-     something else.  */
-  struct addrmap_transition
-  {
-    CORE_ADDR addr;
-    void *value;
-  };
-
-  /* The number of transitions in TRANSITIONS.  */
+  /* The number of transitions in the map.  */
   size_t num_transitions;
 
-  /* An array of transitions, sorted by address.  For every point in
-     the map where either ADDR == 0 or ADDR is mapped to one value and
-     ADDR - 1 is mapped to something different, we have an entry here
-     containing ADDR and VALUE.  (Note that this means we always have
-     an entry for address 0).  */
-  struct addrmap_transition *transitions;
+  /* The transitions: points in the map where the value changes.  For
+     every point in the map where either ADDR == 0 or ADDR is mapped
+     to one value and ADDR - 1 is mapped to something different, the
+     address is in ADDRS and the value in the same slot of VALUES.
+     (Note that this means we always have an entry for address 0).
+     The addresses are sorted, and kept apart from the values so that
+     a lookup only has to search a dense array of addresses.  */
+  CORE_ADDR *addrs;
+  void **values;
 };
 
 /* Mutable address maps.  */
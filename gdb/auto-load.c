@@ -42,6 +42,8 @@
 #include <algorithm>
 #include "gdbsupport/pathstuff.h"
 #include "cli/cli-style.h"
+#include <unordered_map>
+#include <unordered_set>
 
 /* The section to look in for auto-loaded scripts (in file formats that
    support sections).
@@ -193,6 +195,109 @@ auto_load_expand_dir_vars (const char *string)
   return dir_vec;
 }
 
+/* Files already found to be in AUTO_LOAD_SAFE_PATH_VEC, so that
+   loading scripts for many objfiles doesn't match and canonicalize the
+   same names against the safe-path again.  Cleared whenever
+   AUTO_LOAD_SAFE_PATH_VEC is updated.  */
+static std::unordered_set<std::string> auto_load_safe_files;
+
+/* Canonicalized names of files, keyed by the name they were looked up
+   with.  gdb_realpath examines every component of a name, which is slow
+   on networked filesystems, and the same names are resolved repeatedly:
+   once for each extension language, and again when checking a script
+   against the safe-path.  */
+static std::unordered_map<std::string, std::string> auto_load_realpath_cache;
+
+/* Contents of the directories searched for auto-load scripts, keyed by
+   directory name.  Most of the candidate script files for an objfile
+   don't exist, and with many objfiles and a long scripts-directory list
+   the failed opens add up, especially on networked filesystems.  Reading
+   each directory once answers all the probes in it.  */
+
+struct auto_load_dir_listing
+{
+  /* True if the directory doesn't exist.  */
+  bool missing = false;
+
+  /* True if NAMES holds the contents of the directory, false if it could
+     not be read and nothing is known about it.  */
+  bool listed = false;
+
+  std::unordered_set<std::string> names;
+};
+
+static std::unordered_map<std::string, auto_load_dir_listing>
+  auto_load_dir_listings;
+
+/* Forget what is known about files, so that scripts added or removed
+   since are noticed.  Called when a new executable is loaded and when an
+   inferior is created or exits.  */
+
+static void
+auto_load_clear_file_caches ()
+{
+  auto_load_safe_files.clear ();
+  auto_load_realpath_cache.clear ();
+  auto_load_dir_listings.clear ();
+}
+
+/* Like gdb_realpath, but use AUTO_LOAD_REALPATH_CACHE.  */
+
+static gdb::unique_xmalloc_ptr<char>
+auto_load_realpath (const char *filename)
+{
+  auto iter = auto_load_realpath_cache.find (filename);
+  if (iter == auto_load_realpath_cache.end ())
+    {
+      gdb::unique_xmalloc_ptr<char> real_path = gdb_realpath (filename);
+      iter = auto_load_realpath_cache.emplace (filename,
+					       real_path.get ()).first;
+    }
+  return make_unique_xstrdup (iter->second.c_str ());
+}
+
+/* Return false if FILENAME is known not to exist according to
+   AUTO_LOAD_DIR_LISTINGS, true if it may exist.  */
+
+static bool
+auto_load_file_may_exist (const std::string &filename)
+{
+#ifdef HAVE_DOS_BASED_FILE_SYSTEM
+  /* File names are not case sensitive there, so the listing can't be
+     used to look them up.  */
+  return true;
+#else
+  size_t slash = filename.find_last_of ('/');
+  if (slash == std::string::npos)
+    return true;
+
+  std::string dir = filename.substr (0, slash == 0 ? 1 : slash);
+  auto inserted = auto_load_dir_listings.emplace (std::move (dir),
+						  auto_load_dir_listing ());
+  auto_load_dir_listing &listing = inserted.first->second;
+  if (inserted.second)
+    {
+      gdb_dir_up dirp (opendir (inserted.first->first.c_str ()));
+      if (dirp == nullptr)
+	listing.missing = errno == ENOENT || errno == ENOTDIR;
+      else
+	{
+	  struct dirent *ent;
+
+	  while ((ent = readdir (dirp.get ())) != nullptr)
+	    listing.names.insert (ent->d_name);
+	  listing.listed = true;
+	}
+    }
+
+  if (listing.missing)
+    return false;
+  if (listing.listed)
+    return listing.names.count (filename.substr (slash + 1)) != 0;
+  return true;
+#endif
+}
+
 /* Update auto_load_safe_path_vec from current AUTO_LOAD_SAFE_PATH.  */
 
 static void
@@ -201,6 +306,8 @@ auto_load_safe_path_vec_update (void)
   auto_load_debug_printf ("Updating directories of \"%s\".",
 			  auto_load_safe_path.c_str ());
 
+  auto_load_safe_files.clear ();
+
   auto_load_safe_path_vec
     = auto_load_expand_dir_vars (auto_load_safe_path.c_str ());
   size_t len = auto_load_safe_path_vec.size ();
@@ -408,7 +515,7 @@ filename_is_in_auto_load_safe_path_vec (const char *filename,
     {
       if (*filename_realp == NULL)
 	{
-	  *filename_realp = gdb_realpath (filename);
+	  *filename_realp = auto_load_realpath (filename);
 	  if (debug_auto_load && strcmp (filename_realp->get (), filename) != 0)
 	    auto_load_debug_printf ("Resolved file \"%s\" as \"%s\".",
 				    filename, filename_realp->get ());
@@ -441,12 +548,25 @@ file_is_auto_load_safe (const char *filename)
   gdb::unique_xmalloc_ptr<char> filename_real;
   static bool advice_printed = false;
 
+  if (auto_load_safe_files.count (filename) != 0)
+    {
+      auto_load_debug_printf ("File \"%s\" is already known to be safe.",
+			      filename);
+      return true;
+    }
+
   if (filename_is_in_auto_load_safe_path_vec (filename, &filename_real))
-    return true;
+    {
+      auto_load_safe_files.insert (filename);
+      return true;
+    }
 
   auto_load_safe_path_vec_update ();
   if (filename_is_in_auto_load_safe_path_vec (filename, &filename_real))
-    return true;
+    {
+      auto_load_safe_files.insert (filename);
+      return true;
+    }
 
   warning (_("File \"%ps\" auto-loading has been declined by your "
 	     "`auto-load safe-path' set to \"%s\"."),
@@ -730,7 +850,9 @@ auto_load_objfile_script_1 (struct objfile *objfile, const char *realname,
 
   std::string filename = std::string (realname) + suffix;
 
-  gdb_file_up input = gdb_fopen_cloexec (filename.c_str (), "r");
+  gdb_file_up input;
+  if (auto_load_file_may_exist (filename))
+    input = gdb_fopen_cloexec (filename.c_str (), "r");
   debugfile = filename.c_str ();
 
   auto_load_debug_printf ("Attempted file \"%ps\" %s.",
@@ -761,7 +883,8 @@ auto_load_objfile_script_1 (struct objfile *objfile, const char *realname,
 	  debugfile_holder = dir.get () + filename;
 	  debugfile = debugfile_holder.c_str ();
 
-	  input = gdb_fopen_cloexec (debugfile, "r");
+	  if (auto_load_file_may_exist (debugfile_holder))
+	    input = gdb_fopen_cloexec (debugfile, "r");
 
 	  auto_load_debug_printf ("Attempted file \"%ps\" %s.",
 				  styled_string (file_name_style.style (),
@@ -825,7 +948,7 @@ auto_load_objfile_script (struct objfile *objfile,
 			  const struct extension_language_defn *language)
 {
   gdb::unique_xmalloc_ptr<char> realname
-    = gdb_realpath (objfile_name (objfile));
+    = auto_load_realpath (objfile_name (objfile));
 
   if (auto_load_objfile_script_1 (objfile, realname.get (), language))
     return;
@@ -866,7 +989,8 @@ auto_load_objfile_script (struct objfile *objfile,
 	  /* Replace the last component of the parent's path with the
 	     debuglink name.  */
 
-	  std::string p_realname = gdb_realpath (objfile_name (parent)).get ();
+	  std::string p_realname
+	    = auto_load_realpath (objfile_name (parent)).get ();
 	  size_t last = p_realname.find_last_of ('/');
 
 	  if (last != std::string::npos)
@@ -1178,6 +1302,7 @@ auto_load_new_objfile (struct objfile *objfile)
     {
       /* OBJFILE is NULL when loading a new "main" symbol-file.  */
       clear_section_scripts ();
+      auto_load_clear_file_caches ();
       return;
     }
 
@@ -1641,6 +1766,10 @@ This option has security implications for untrusted inferiors."),
 				     auto_load_show_cmdlist_get ());
   gdb::observers::gdb_datadir_changed.attach (auto_load_gdb_datadir_changed,
 					      "auto-load");
+  gdb::observers::inferior_created.attach
+    ([] (inferior *) { auto_load_clear_file_caches (); }, "auto-load");
+  gdb::observers::inferior_exit.attach
+    ([] (inferior *) { auto_load_clear_file_caches (); }, "auto-load");
 
   cmd = add_cmd ("add-auto-load-safe-path", class_support,
 		 add_auto_load_safe_path,
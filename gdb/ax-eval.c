@@ -0,0 +1,487 @@
+/* Evaluation of agent expressions by GDB itself.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include "defs.h"
+#include "ax-eval.h"
+#include "gdbarch.h"
+#include "regcache.h"
+#include "target.h"
+#include "gdbsupport/selftest.h"
+
+/* Read the N-byte big-endian constant at P.  */
+
+static ULONGEST
+read_bytecode_const (const unsigned char *p, int n)
+{
+  ULONGEST result = 0;
+
+  for (int i = 0; i < n; ++i)
+    result = (result << 8) | p[i];
+  return result;
+}
+
+/* Return the GDB number of the raw register whose remote number is
+   REMOTE_REGNUM, or -1 if there is none.  */
+
+static int
+regnum_from_remote_regnum (struct gdbarch *gdbarch, int remote_regnum)
+{
+  for (int regnum = 0; regnum < gdbarch_num_regs (gdbarch); ++regnum)
+    if (gdbarch_remote_register_number (gdbarch, regnum) == remote_regnum)
+      return regnum;
+  return -1;
+}
+
+/* See ax-eval.h.  */
+
+ax_evaluator::ax_evaluator (agent_expr_up ax)
+  : m_ax (std::move (ax))
+{
+  agent_expr *x = m_ax.get ();
+  struct gdbarch *gdbarch = x->gdbarch;
+
+  /* Check that all the bytecodes are supported before handing the
+     expression to ax_reqs, which computes the stack heights.  */
+  m_regnums.resize (x->len, -1);
+  for (int pc = 0; pc < x->len; )
+    {
+      int op = x->buf[pc];
+
+      switch (op)
+	{
+	case aop_add:
+	case aop_sub:
+	case aop_mul:
+	case aop_div_signed:
+	case aop_div_unsigned:
+	case aop_rem_signed:
+	case aop_rem_unsigned:
+	case aop_lsh:
+	case aop_rsh_signed:
+	case aop_rsh_unsigned:
+	case aop_log_not:
+	case aop_bit_and:
+	case aop_bit_or:
+	case aop_bit_xor:
+	case aop_bit_not:
+	case aop_equal:
+	case aop_less_signed:
+	case aop_less_unsigned:
+	case aop_ext:
+	case aop_zero_ext:
+	case aop_ref8:
+	case aop_ref16:
+	case aop_ref32:
+	case aop_ref64:
+	case aop_if_goto:
+	case aop_goto:
+	case aop_const8:
+	case aop_const16:
+	case aop_const32:
+	case aop_const64:
+	case aop_reg:
+	case aop_end:
+	case aop_dup:
+	case aop_pop:
+	case aop_swap:
+	case aop_pick:
+	case aop_rot:
+	  break;
+
+	default:
+	  error (_("Bytecode 0x%02x can't be evaluated by GDB."), op);
+	}
+
+      int size = aop_map[op].op_size;
+      if (pc + 1 + size > x->len)
+	error (_("Incomplete bytecode at offset %d."), pc);
+
+      if (op == aop_goto || op == aop_if_goto)
+	{
+	  /* Only allow forward jumps, so that evaluation always
+	     terminates.  */
+	  if ((int) read_bytecode_const (&x->buf[pc + 1], 2) <= pc)
+	    error (_("Backward jump at offset %d."), pc);
+	}
+      else if (op == aop_reg)
+	{
+	  int remote_regnum = read_bytecode_const (&x->buf[pc + 1], 2);
+	  int regnum = regnum_from_remote_regnum (gdbarch, remote_regnum);
+
+	  if (regnum < 0)
+	    error (_("Unknown register %d."), remote_regnum);
+	  if (register_size (gdbarch, regnum) > sizeof (ULONGEST))
+	    error (_("Register %d is too large."), remote_regnum);
+	  m_regnums[pc] = regnum;
+	}
+
+      pc += 1 + size;
+    }
+
+  ax_reqs (x);
+  if (x->flaw != agent_flaw_none)
+    error (_("Invalid agent expression."));
+  if (x->min_height < 0 || x->max_height > max_stack)
+    error (_("Agent expression stack out of bounds."));
+}
+
+/* See ax-eval.h.  */
+
+bool
+ax_evaluator::evaluate (readable_regcache *regcache, ULONGEST *result) const
+{
+  const agent_expr *x = m_ax.get ();
+  struct gdbarch *gdbarch = x->gdbarch;
+
+  if (regcache->arch () != gdbarch)
+    return false;
+
+  enum bfd_endian byte_order = gdbarch_byte_order (gdbarch);
+  ULONGEST stack[max_stack];
+  int sp = 0;
+  gdb_byte buf[sizeof (ULONGEST)];
+
+  /* The constructor checked the stack heights, so the stack can't
+     underflow or overflow, except for aop_pick whose depth is checked
+     below.  */
+  for (int pc = 0; pc < x->len; )
+    {
+      int op = x->buf[pc];
+      const unsigned char *arg = &x->buf[pc + 1];
+      int regnum = m_regnums[pc];
+
+      pc += 1 + aop_map[op].op_size;
+
+      switch (op)
+	{
+	case aop_add:
+	  stack[sp - 2] += stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_sub:
+	  stack[sp - 2] -= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_mul:
+	  stack[sp - 2] *= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_div_signed:
+	case aop_rem_signed:
+	  {
+	    LONGEST a = stack[sp - 2];
+	    LONGEST b = stack[sp - 1];
+
+	    if (b == 0
+		|| (b == -1 && a == std::numeric_limits<LONGEST>::min ()))
+	      return false;
+	    stack[sp - 2] = op == aop_div_signed ? a / b : a % b;
+	    --sp;
+	  }
+	  break;
+
+	case aop_div_unsigned:
+	case aop_rem_unsigned:
+	  if (stack[sp - 1] == 0)
+	    return false;
+	  if (op == aop_div_unsigned)
+	    stack[sp - 2] /= stack[sp - 1];
+	  else
+	    stack[sp - 2] %= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_lsh:
+	case aop_rsh_signed:
+	case aop_rsh_unsigned:
+	  /* Let the generic evaluator deal with out of range shift
+	     counts.  */
+	  if (stack[sp - 1] >= 8 * sizeof (ULONGEST))
+	    return false;
+	  if (op == aop_lsh)
+	    stack[sp - 2] <<= stack[sp - 1];
+	  else if (op == aop_rsh_signed)
+	    stack[sp - 2] = ((LONGEST) stack[sp - 2]) >> stack[sp - 1];
+	  else
+	    stack[sp - 2] >>= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_log_not:
+	  stack[sp - 1] = !stack[sp - 1];
+	  break;
+
+	case aop_bit_and:
+	  stack[sp - 2] &= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_bit_or:
+	  stack[sp - 2] |= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_bit_xor:
+	  stack[sp - 2] ^= stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_bit_not:
+	  stack[sp - 1] = ~stack[sp - 1];
+	  break;
+
+	case aop_equal:
+	  stack[sp - 2] = stack[sp - 2] == stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_less_signed:
+	  stack[sp - 2] = (LONGEST) stack[sp - 2] < (LONGEST) stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_less_unsigned:
+	  stack[sp - 2] = stack[sp - 2] < stack[sp - 1];
+	  --sp;
+	  break;
+
+	case aop_ext:
+	  if (arg[0] > 0 && arg[0] < 8 * sizeof (ULONGEST))
+	    {
+	      ULONGEST sign = (ULONGEST) 1 << (arg[0] - 1);
+	      ULONGEST value = stack[sp - 1] & ((sign << 1) - 1);
+
+	      stack[sp - 1] = (value ^ sign) - sign;
+	    }
+	  break;
+
+	case aop_zero_ext:
+	  if (arg[0] < 8 * sizeof (ULONGEST))
+	    stack[sp - 1] &= ((ULONGEST) 1 << arg[0]) - 1;
+	  break;
+
+	case aop_ref8:
+	case aop_ref16:
+	case aop_ref32:
+	case aop_ref64:
+	  {
+	    int len = aop_map[op].data_size / 8;
+
+	    if (target_read_memory (stack[sp - 1], buf, len) != 0)
+	      return false;
+	    stack[sp - 1] = extract_unsigned_integer (buf, len, byte_order);
+	  }
+	  break;
+
+	case aop_if_goto:
+	  if (stack[--sp] != 0)
+	    pc = read_bytecode_const (arg, 2);
+	  break;
+
+	case aop_goto:
+	  pc = read_bytecode_const (arg, 2);
+	  break;
+
+	case aop_const8:
+	case aop_const16:
+	case aop_const32:
+	case aop_const64:
+	  stack[sp++] = read_bytecode_const (arg, aop_map[op].op_size);
+	  break;
+
+	case aop_reg:
+	  {
+	    int len = register_size (gdbarch, regnum);
+
+	    if (regcache->raw_read (regnum, buf) != REG_VALID)
+	      return false;
+	    stack[sp++] = extract_unsigned_integer (buf, len, byte_order);
+	  }
+	  break;
+
+	case aop_end:
+	  if (sp == 0)
+	    return false;
+	  *result = stack[sp - 1];
+	  return true;
+
+	case aop_dup:
+	  stack[sp] = stack[sp - 1];
+	  ++sp;
+	  break;
+
+	case aop_pop:
+	  --sp;
+	  break;
+
+	case aop_swap:
+	  std::swap (stack[sp - 1], stack[sp - 2]);
+	  break;
+
+	case aop_pick:
+	  if (arg[0] >= sp)
+	    return false;
+	  stack[sp] = stack[sp - 1 - arg[0]];
+	  ++sp;
+	  break;
+
+	case aop_rot:
+	  {
+	    /* Rotate the top three items: A B C -> C A B, where C is the
+	       top of the stack.  */
+	    ULONGEST c = stack[sp - 1];
+
+	    stack[sp - 1] = stack[sp - 2];
+	    stack[sp - 2] = stack[sp - 3];
+	    stack[sp - 3] = c;
+	  }
+	  break;
+
+	default:
+	  gdb_assert_not_reached ("unexpected bytecode");
+	}
+    }
+
+  /* Fell off the end of the expression without an aop_end.  */
+  return false;
+}
+
+#if GDB_SELF_TEST
+
+namespace selftests {
+
+/* Evaluate the expression built by BUILD for GDBARCH, with register 0
+   holding 42 and all the other registers unavailable.  Return true
+   and set *RESULT on success.  */
+
+static bool
+evaluate_test_expr (struct gdbarch *gdbarch,
+		    gdb::function_view<void (agent_expr *)> build,
+		    ULONGEST *result)
+{
+  agent_expr_up ax (new agent_expr (gdbarch, 0));
+  build (ax.get ());
+  ax_simple (ax.get (), aop_end);
+
+  ax_evaluator evaluator (std::move (ax));
+  readonly_detached_regcache regcache
+    (gdbarch, [&] (int regnum, gdb_byte *buf)
+      {
+	if (regnum != 0)
+	  return REG_UNAVAILABLE;
+	store_unsigned_integer (buf, register_size (gdbarch, regnum),
+				gdbarch_byte_order (gdbarch), 42);
+	return REG_VALID;
+      });
+
+  return evaluator.evaluate (&regcache, result);
+}
+
+static void
+test_ax_evaluator ()
+{
+  struct gdbarch *gdbarch = target_gdbarch ();
+  ULONGEST result;
+
+  /* (2 + 3) * 4 == 20.  */
+  SELF_CHECK (evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+    {
+      ax_const_l (ax, 2);
+      ax_const_l (ax, 3);
+      ax_simple (ax, aop_add);
+      ax_const_l (ax, 4);
+      ax_simple (ax, aop_mul);
+      ax_const_l (ax, 20);
+      ax_simple (ax, aop_equal);
+    }, &result));
+  SELF_CHECK (result == 1);
+
+  /* Sign extension: (int8_t) 0xff < 0.  */
+  SELF_CHECK (evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+    {
+      ax_const_l (ax, 0xff);
+      ax_ext (ax, 8);
+      ax_const_l (ax, 0);
+      ax_simple (ax, aop_less_signed);
+    }, &result));
+  SELF_CHECK (result == 1);
+
+  /* Conditional jumps: 1 ? 7 : 5.  */
+  SELF_CHECK (evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+    {
+      ax_const_l (ax, 1);
+      int if_jump = ax_goto (ax, aop_if_goto);
+      ax_const_l (ax, 5);
+      int end_jump = ax_goto (ax, aop_goto);
+      ax_label (ax, if_jump, ax->len);
+      ax_const_l (ax, 7);
+      ax_label (ax, end_jump, ax->len);
+    }, &result));
+  SELF_CHECK (result == 7);
+
+  /* Division by zero is left to the generic evaluator.  */
+  SELF_CHECK (!evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+    {
+      ax_const_l (ax, 1);
+      ax_const_l (ax, 0);
+      ax_simple (ax, aop_div_signed);
+    }, &result));
+
+  /* Registers.  */
+  if (gdbarch_num_regs (gdbarch) > 0
+      && register_size (gdbarch, 0) <= sizeof (ULONGEST))
+    {
+      SELF_CHECK (evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+	{
+	  ax_reg (ax, 0);
+	}, &result));
+      SELF_CHECK (result == 42);
+    }
+
+  /* Floating-point bytecodes are not supported.  */
+  bool threw = false;
+  try
+    {
+      evaluate_test_expr (gdbarch, [] (agent_expr *ax)
+	{
+	  ax_simple (ax, aop_float);
+	}, &result);
+    }
+  catch (const gdb_exception_error &ex)
+    {
+      threw = true;
+    }
+  SELF_CHECK (threw);
+}
+
+} /* namespace selftests */
+
+#endif /* GDB_SELF_TEST */
+
+void _initialize_ax_eval ();
+void
+_initialize_ax_eval ()
+{
+#if GDB_SELF_TEST
+  selftests::register_test ("ax-evaluator", selftests::test_ax_evaluator);
+#endif
+}
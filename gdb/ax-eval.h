@@ -0,0 +1,73 @@
+/* Evaluation of agent expressions by GDB itself.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#ifndef AX_EVAL_H
+#define AX_EVAL_H
+
+#include "ax.h"
+
+class readable_regcache;
+
+/* Agent expressions are normally sent to the target, but they are
+   also a convenient "compiled" form of an expression for GDB itself:
+   all the symbols, types and locations of the expression are resolved
+   once, for the scope of the agent expression, and what remains is
+   only register reads, memory reads and integer arithmetic.  This is
+   used to evaluate the conditions of breakpoints that are hit often,
+   without going through the generic expression evaluator and
+   allocating values on each hit.
+
+   Only the subset of bytecodes needed to evaluate an expression is
+   supported; trace, floating-point and trace state variable bytecodes
+   are not.  */
+
+class ax_evaluator
+{
+public:
+
+  /* Prepare to evaluate AX, which should have been generated by
+     gen_eval_for_expr.  Throws an error if AX can't be evaluated by
+     this class.  */
+  explicit ax_evaluator (agent_expr_up ax);
+
+  DISABLE_COPY_AND_ASSIGN (ax_evaluator);
+
+  /* Evaluate the expression, reading registers from REGCACHE and
+     memory from the current inferior.  Return true and set *RESULT to
+     the value of the expression on success.  Return false if the
+     evaluation failed, for instance because some memory couldn't be
+     read or because of a division by zero; the caller should then use
+     the generic expression evaluator, which will report the error
+     properly.  */
+  bool evaluate (readable_regcache *regcache, ULONGEST *result) const;
+
+  /* The maximum stack depth supported by the evaluator.  */
+  static constexpr int max_stack = 64;
+
+private:
+
+  agent_expr_up m_ax;
+
+  /* For each aop_reg bytecode, indexed by its offset in the
+     expression, the GDB number of the register it reads.  The
+     bytecode itself uses the remote register numbers.  */
+  std::vector<int> m_regnums;
+};
+
+#endif /* AX_EVAL_H */
@@ -69,6 +69,7 @@ bcache::expand_hash_table ()
      the end of this table, we just double.  Don't laugh --- there have
      been executables sighted with a gigabyte of debug info.  */
   static const unsigned long sizes[] = {
+    61, 127, 251, 509,
     1021, 2053, 4099, 8191, 16381, 32771,
     65537, 131071, 262144, 524287, 1048573, 2097143,
     4194301, 8388617, 16777213, 33554467, 67108859, 134217757,
@@ -142,7 +143,15 @@ bcache::expand_hash_table ()
 const void *
 bcache::insert (const void *addr, int length, bool *added)
 {
-  unsigned long full_hash;
+  return insert_hashed (addr, length, this->hash (addr, length), added);
+}
+
+/* See bcache.h.  */
+
+const void *
+bcache::insert_hashed (const void *addr, int length,
+		       unsigned long full_hash, bool *added)
+{
   unsigned short half_hash;
   int hash_index;
   struct bstring *s;
@@ -167,8 +176,6 @@ bcache::insert (const void *addr, int length, bool *added)
   m_total_count++;
   m_total_size += length;
 
-  full_hash = this->hash (addr, length);
-
   half_hash = (full_hash >> 16);
   hash_index = full_hash % m_num_buckets;
 
@@ -388,4 +395,88 @@ bcache::memory_used ()
   return obstack_memory_used (&m_cache);
 }
 
+
+/* The concurrent bcache.  */
+
+/* See bcache.h.  */
+
+const void *
+concurrent_bcache::insert (const void *addr, int length, bool *added)
+{
+  unsigned long full_hash = fast_hash (addr, length, 0);
+  stripe &s = m_stripes[full_hash % n_stripes];
+
+#if CXX_STD_THREAD
+  std::lock_guard<std::mutex> guard (s.lock);
+#endif
+  return s.cache.insert_hashed (addr, length, full_hash, added);
+}
+
+/* See bcache.h.  */
+
+void
+concurrent_bcache::print_statistics (const char *type)
+{
+  unsigned long unique_count = 0;
+  long total_count = 0;
+  long unique_size = 0;
+  long total_size = 0;
+  long structure_size = 0;
+  unsigned long expand_count = 0;
+  unsigned long half_hash_miss_count = 0;
+  unsigned long num_buckets = 0;
+
+  for (const stripe &s : m_stripes)
+    {
+      unique_count += s.cache.m_unique_count;
+      total_count += s.cache.m_total_count;
+      unique_size += s.cache.m_unique_size;
+      total_size += s.cache.m_total_size;
+      structure_size += s.cache.m_structure_size;
+      expand_count += s.cache.m_expand_count;
+      half_hash_miss_count += s.cache.m_half_hash_miss_count;
+      num_buckets += s.cache.m_num_buckets;
+    }
+
+  gdb_printf (_("  M_Cached '%s' statistics:\n"), type);
+  gdb_printf (_("    Total object count:  %ld\n"), total_count);
+  gdb_printf (_("    Unique object count: %lu\n"), unique_count);
+  gdb_printf (_("    Percentage of duplicates, by count: "));
+  print_percentage (total_count - unique_count, total_count);
+  gdb_printf ("\n");
+
+  gdb_printf (_("    Total object size:   %ld\n"), total_size);
+  gdb_printf (_("    Unique object size:  %ld\n"), unique_size);
+  gdb_printf (_("    Percentage of duplicates, by size:  "));
+  print_percentage (total_size - unique_size, total_size);
+  gdb_printf ("\n");
+
+  gdb_printf (_("    \
+Total memory used by bcache, including overhead: %ld\n"),
+	      structure_size);
+  gdb_printf (_("    Percentage memory overhead: "));
+  print_percentage (structure_size - unique_size, unique_size);
+  gdb_printf (_("    Net memory savings:         "));
+  print_percentage (total_size - structure_size, total_size);
+  gdb_printf ("\n");
+
+  gdb_printf (_("    Stripes:                   %3d\n"), n_stripes);
+  gdb_printf (_("    Hash table size:           %3lu\n"), num_buckets);
+  gdb_printf (_("    Hash table expands:        %lu\n"), expand_count);
+  gdb_printf (_("    Half hash misses:          %lu\n"),
+	      half_hash_miss_count);
+  gdb_printf ("\n");
+}
+
+/* See bcache.h.  */
+
+int
+concurrent_bcache::memory_used ()
+{
+  int result = 0;
+  for (stripe &s : m_stripes)
+    result += s.cache.memory_used ();
+  return result;
+}
+
 } /* namespace gdb */
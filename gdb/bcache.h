@@ -22,6 +22,10 @@
 #ifndef BCACHE_H
 #define BCACHE_H 1
 
+#if CXX_STD_THREAD
+#include <mutex>
+#endif
+
 /* A bcache is a data structure for factoring out duplication in
    read-only structures.  You give the bcache some string of bytes S.
    If the bcache already contains a copy of S, it hands you back a
@@ -139,6 +143,7 @@
 namespace gdb {
 
 struct bstring;
+struct concurrent_bcache;
 
 struct bcache
 {
@@ -203,6 +208,50 @@ struct bcache
 
   /* Expand the hash table.  */
   void expand_hash_table ();
+
+  /* Like insert, but FULL_HASH is the hash of the LENGTH bytes at
+     ADDR, as computed by this->hash.  */
+  const void *insert_hashed (const void *addr, int length,
+			     unsigned long full_hash, bool *added);
+
+  friend struct concurrent_bcache;
+};
+
+/* A bcache that several threads can insert into at the same time.
+
+   The data is spread over a number of stripes according to its hash
+   value.  Each stripe is an ordinary bcache, with its own lock and its
+   own storage, so threads only wait for each other when they insert
+   into the same stripe at the same time.  The hash and comparison
+   functions are always the default ones.  */
+
+struct concurrent_bcache
+{
+  concurrent_bcache () = default;
+  DISABLE_COPY_AND_ASSIGN (concurrent_bcache);
+
+  /* See bcache::insert.  This may be called from any thread.  */
+  const void *insert (const void *addr, int length, bool *added = nullptr);
+
+  /* See bcache::print_statistics.  These must not be called while
+     another thread may be inserting.  */
+  void print_statistics (const char *type);
+  int memory_used ();
+
+private:
+
+  /* The number of stripes.  */
+  static constexpr int n_stripes = 8;
+
+  struct stripe
+  {
+#if CXX_STD_THREAD
+    std::mutex lock;
+#endif
+    bcache cache;
+  };
+
+  stripe m_stripes[n_stripes];
 };
 
 } /* namespace gdb */
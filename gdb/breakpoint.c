@@ -61,6 +61,7 @@
 #include "cli/cli-utils.h"
 #include "stack.h"
 #include "ax-gdb.h"
+#include "regcache.h"
 #include "dummy-frame.h"
 #include "interps.h"
 #include "gdbsupport/format.h"
@@ -148,6 +149,10 @@ static enum print_stop_action print_bp_stop_message (bpstat *bs);
 
 static int hw_breakpoint_used_count (void);
 
+static bool is_hardware_watchpoint (const struct breakpoint *bpt);
+
+static bool has_target_conditions (const struct breakpoint *bpt);
+
 static int hw_watchpoint_use_count (struct breakpoint *);
 
 static int hw_watchpoint_used_count_others (struct breakpoint *except,
@@ -593,10 +598,9 @@ breakpoint_condition_evaluation_mode (void)
   return translate_condition_evaluation_mode (condition_evaluation_mode);
 }
 
-/* Return true if GDB should evaluate breakpoint conditions or false
-   otherwise.  */
+/* See breakpoint.h.  */
 
-static int
+int
 gdb_evaluates_breakpoint_condition_p (void)
 {
   const char *mode = breakpoint_condition_evaluation_mode ();
@@ -836,7 +840,7 @@ mark_breakpoint_modified (struct breakpoint *b)
       || !target_supports_evaluation_of_breakpoint_conditions ())
     return;
 
-  if (!is_breakpoint (b))
+  if (!has_target_conditions (b))
     return;
 
   for (bp_location *loc : b->locations ())
@@ -858,7 +862,7 @@ mark_breakpoint_location_modified (struct bp_location *loc)
 
     return;
 
-  if (!is_breakpoint (loc->owner))
+  if (!has_target_conditions (loc->owner))
     return;
 
   loc->condition_changed = condition_modified;
@@ -912,7 +916,7 @@ set_condition_evaluation_mode (const char *args, int from_tty,
 	     with the target.  We do this to remove all the conditions the
 	     target knows about.  */
 	  for (bp_location *loc : all_bp_locations ())
-	    if (is_breakpoint (loc->owner) && loc->inserted)
+	    if (has_target_conditions (loc->owner) && loc->inserted)
 	      loc->needs_update = 1;
 	}
 
@@ -960,6 +964,8 @@ set_breakpoint_location_condition (const char *cond_string, bp_location *loc,
       else
 	{
 	  loc->cond = std::move (new_exp);
+	  loc->cond_evaluator.reset ();
+	  loc->cond_evaluator_tried = false;
 	  if (loc->disabled_by_cond && loc->enabled)
 	    gdb_printf (_("Breakpoint %d's condition is now valid at "
 			  "location %d, enabling.\n"),
@@ -1007,6 +1013,8 @@ set_breakpoint_condition (struct breakpoint *b, const char *exp,
 	  for (bp_location *loc : b->locations ())
 	    {
 	      loc->cond.reset ();
+	      loc->cond_evaluator.reset ();
+	      loc->cond_evaluator_tried = false;
 	      if (loc->disabled_by_cond && loc->enabled)
 		gdb_printf (_("Breakpoint %d's condition is now valid at "
 			      "location %d, enabling.\n"),
@@ -1081,6 +1089,7 @@ set_breakpoint_condition (struct breakpoint *b, const char *exp,
       b->cond_string = make_unique_xstrdup (exp);
       b->condition_not_parsed = 0;
     }
+
   mark_breakpoint_modified (b);
 
   gdb::observers::breakpoint_modified.notify (b);
@@ -1109,7 +1118,7 @@ set_breakpoint_condition (int bpnum, const char *exp, int from_tty,
 	  }
 	set_breakpoint_condition (b, exp, from_tty, force);
 
-	if (is_breakpoint (b))
+	if (has_target_conditions (b))
 	  update_global_location_list (UGLL_MAY_INSERT);
 
 	return;
@@ -1791,6 +1800,20 @@ is_hardware_watchpoint (const struct breakpoint *bpt)
 	  || bpt->type == bp_access_watchpoint);
 }
 
+/* Return true if the target may be given the conditions of BPT's
+   locations when inserting them.  Those locations need to be
+   re-inserted when the conditions at their address change.  Only
+   the conditions of read and access watchpoints are sent (see
+   watchpoint_target_conditions).  */
+
+static bool
+has_target_conditions (const struct breakpoint *bpt)
+{
+  return (is_breakpoint (bpt)
+	  || bpt->type == bp_read_watchpoint
+	  || bpt->type == bp_access_watchpoint);
+}
+
 /* See breakpoint.h.  */
 
 bool
@@ -2702,10 +2725,14 @@ insert_bp_location (struct bp_location *bl,
     {
       build_target_condition_list (bl);
       build_target_command_list (bl);
-      /* Reset the modification marker.  */
-      bl->needs_update = 0;
     }
 
+  /* Reset the modification marker.  The conditions of watchpoints
+     are collected by the target when it inserts them (see
+     watchpoint_target_conditions).  */
+  if (has_target_conditions (bl->owner))
+    bl->needs_update = 0;
+
   /* If "set breakpoint auto-hw" is "on" and a software breakpoint was
      set at a read-only address, then a breakpoint location will have
      been changed to hardware breakpoint before we get here.  If it is
@@ -2937,6 +2964,15 @@ insert_bp_location (struct bp_location *bl,
 		bl->target_info = loc->target_info;
 		bl->watchpoint_type = hw_access;
 		val = 0;
+
+		/* The target may be filtering the hits of LOC on the
+		   conditions it was given, which would hide reads
+		   from this watchpoint.  Insert LOC again, now that
+		   it has an unconditional duplicate (see
+		   watchpoint_target_conditions).  */
+		if (!gdb_evaluates_breakpoint_condition_p ()
+		    && target_supports_evaluation_of_breakpoint_conditions ())
+		  loc->owner->insert_location (loc);
 		break;
 	      }
 
@@ -3068,9 +3104,9 @@ update_inserted_breakpoint_locations (void)
 
   for (bp_location *bl : all_bp_locations ())
     {
-      /* We only want to update software breakpoints and hardware
-	 breakpoints.  */
-      if (!is_breakpoint (bl->owner))
+      /* We only want to update breakpoints and watchpoints whose
+	 conditions the target may evaluate.  */
+      if (!has_target_conditions (bl->owner))
 	continue;
 
       /* We only want to update locations that are already inserted
@@ -4847,6 +4883,59 @@ breakpoint_cond_eval (expression *exp)
   return res;
 }
 
+/* Whether GDB compiles the breakpoint conditions it evaluates itself
+   to bytecode.  */
+
+static bool breakpoint_condition_bytecode = true;
+
+/* Try to evaluate the condition of BL, hit by THREAD, using its
+   bytecode form, compiling it on first use.  The bytecode is
+   generated for the scope of BL and reads the registers of the
+   innermost frame, so this is only done if that frame is stopped at
+   BL's address.  Return true and store the result in *RESULT on
+   success.  Return false if the condition has to be evaluated by
+   breakpoint_cond_eval instead.  */
+
+static bool
+breakpoint_cond_eval_bytecode (bp_location *bl, thread_info *thread,
+			       bool *result)
+{
+  if (!breakpoint_condition_bytecode)
+    return false;
+
+  frame_info *frame = get_current_frame ();
+  if (get_frame_pc (frame) != bl->address
+      || get_frame_arch (frame) != bl->gdbarch)
+    return false;
+
+  if (!bl->cond_evaluator_tried)
+    {
+      bl->cond_evaluator_tried = true;
+      try
+	{
+	  bl->cond_evaluator.reset
+	    (new ax_evaluator (gen_eval_for_expr (bl->address,
+						  bl->cond.get ())));
+	}
+      catch (const gdb_exception_error &ex)
+	{
+	  /* The condition uses something that can't be expressed as
+	     bytecode, such as a function call; always use the generic
+	     evaluator for it.  */
+	}
+    }
+
+  if (bl->cond_evaluator == nullptr)
+    return false;
+
+  ULONGEST value;
+  if (!bl->cond_evaluator->evaluate (get_thread_regcache (thread), &value))
+    return false;
+
+  *result = value != 0;
+  return true;
+}
+
 /* Allocate a new bpstat.  Link it to the FIFO list by BS_LINK_POINTER.  */
 
 bpstat::bpstat (struct bp_location *bl, bpstat ***bs_link_pointer)
@@ -5404,7 +5493,11 @@ bpstat_check_breakpoint_conditions (bpstat *bs, thread_info *thread)
 	{
 	  try
 	    {
-	      condition_result = breakpoint_cond_eval (cond);
+	      if (w != nullptr
+		  || !breakpoint_cond_eval_bytecode (bs->bp_location_at.get (),
+						     thread,
+						     &condition_result))
+		condition_result = breakpoint_cond_eval (cond);
 	    }
 	  catch (const gdb_exception &ex)
 	    {
@@ -9424,13 +9517,67 @@ watchpoint::re_set ()
 
 /* Implement the "insert" method for hardware watchpoints.  */
 
+/* Return the condition to pass to the target along with location BL
+   of watchpoint W.  When a read watchpoint is emulated with an access
+   watchpoint, GDB tells reads from writes by looking at every hit
+   (see bpstat_check_watchpoint), so the target must not filter hits
+   on the condition; don't give it one.  */
+
+static struct expression *
+watchpoint_target_cond (watchpoint *w, struct bp_location *bl)
+{
+  if (w->type == bp_read_watchpoint && bl->watchpoint_type == hw_access)
+    return nullptr;
+
+  return w->cond_exp.get ();
+}
+
+/* See breakpoint.h.  */
+
+bool
+watchpoint_target_conditions (CORE_ADDR addr, int len,
+			      enum target_hw_bp_type type,
+			      std::vector<struct expression *> *conds)
+{
+  conds->clear ();
+
+  /* Only one of a set of duplicate locations is inserted, so the
+     target must be given the conditions of all of them, like
+     build_target_condition_list does for breakpoints.  */
+  for (bp_location *loc : all_bp_locations_at_addr (addr))
+    {
+      if (!is_hardware_watchpoint (loc->owner)
+	  || loc->pspace != current_program_space
+	  || loc->watchpoint_type != type
+	  || !unduplicated_should_be_inserted (loc))
+	continue;
+
+      watchpoint *w = static_cast<watchpoint *> (loc->owner);
+      if ((w->exact ? 1 : loc->length) != len)
+	continue;
+
+      struct expression *cond = watchpoint_target_cond (w, loc);
+
+      /* An unconditional location must report every hit.  */
+      if (cond == nullptr)
+	{
+	  conds->clear ();
+	  return false;
+	}
+
+      conds->push_back (cond);
+    }
+
+  return !conds->empty ();
+}
+
 int
 watchpoint::insert_location (struct bp_location *bl)
 {
   int length = exact ? 1 : bl->length;
 
   return target_insert_watchpoint (bl->address, length, bl->watchpoint_type,
-				   cond_exp.get ());
+				   watchpoint_target_cond (this, bl));
 }
 
 /* Implement the "remove" method for hardware watchpoints.  */
@@ -9442,7 +9589,7 @@ watchpoint::remove_location (struct bp_location *bl,
   int length = exact ? 1 : bl->length;
 
   return target_remove_watchpoint (bl->address, length, bl->watchpoint_type,
-				   cond_exp.get ());
+				   watchpoint_target_cond (this, bl));
 }
 
 int
@@ -10906,7 +11053,7 @@ force_breakpoint_reinsertion (struct bp_location *bl)
      update the conditions on the target's side.  */
   for (bp_location *loc : all_bp_locations_at_addr (address))
     {
-      if (!is_breakpoint (loc->owner)
+      if (!has_target_conditions (loc->owner)
 	  || pspace_num != loc->pspace->num)
 	continue;
 
@@ -11237,7 +11384,7 @@ update_global_location_list (enum ugll_insert_mode insert_mode)
 	  *loc_first_p = loc;
 	  loc->duplicate = 0;
 
-	  if (is_breakpoint (loc->owner) && loc->condition_changed)
+	  if (has_target_conditions (loc->owner) && loc->condition_changed)
 	    {
 	      loc->needs_update = 1;
 	      /* Clear the condition modification flag.  */
@@ -12764,6 +12911,82 @@ breakpoint_re_set_one (breakpoint *b)
   b->re_set ();
 }
 
+/* The objfiles of RE_SET_PSPACE as of the last breakpoint_re_set in
+   that program space, used to find out which objfiles are new on the
+   next one.  RE_SET_PSPACE is NULL if there is no usable snapshot.  */
+
+static program_space *re_set_pspace;
+static std::unordered_set<objfile *> re_set_objfiles;
+
+/* Observer for free_objfile.  Once an objfile is gone, we can no
+   longer tell which of the remaining ones are new, so forget the
+   snapshot; the next breakpoint_re_set re-sets everything.  */
+
+static void
+forget_re_set_objfiles (struct objfile *objfile)
+{
+  re_set_pspace = nullptr;
+  re_set_objfiles.clear ();
+}
+
+/* Observer for new_objfile.  A NULL OBJFILE means the symbol tables
+   were reset, e.g. by reread_symbols, which re-reads objfiles in place
+   without freeing them.  The snapshot would then wrongly claim those
+   objfiles were already searched, so forget it.  */
+
+static void
+forget_re_set_objfiles_on_reset (struct objfile *objfile)
+{
+  if (objfile == nullptr)
+    forget_re_set_objfiles (objfile);
+}
+
+/* Return true if B is a pending breakpoint that can't be resolved by
+   any of the objfiles in ADDED, which are the objfiles of the current
+   program space loaded since B was last re-set.  Since B resolved to
+   nothing against the other objfiles, re-setting it would leave it
+   unchanged, and we can skip the full (and, with many objfiles,
+   costly) location search.  */
+
+static bool
+pending_breakpoint_unaffected_p (breakpoint *b,
+				 const std::unordered_set<objfile *> &added)
+{
+  if (b->loc != nullptr
+      || (b->type != bp_breakpoint
+	  && b->type != bp_hardware_breakpoint
+	  && b->type != bp_dprintf)
+      || b->locspec == nullptr
+      || b->locspec_range_end != nullptr
+      || (b->locspec->type () != LINESPEC_LOCATION_SPEC
+	  && b->locspec->type () != EXPLICIT_LOCATION_SPEC))
+    return false;
+
+  /* With no new objfiles, whatever triggered this re-set wasn't a
+     library load, so don't assume B is unaffected.  */
+  if (added.empty ())
+    return false;
+
+  scoped_restore save_objfiles
+    = make_scoped_restore (&linespec_search_objfiles, &added);
+  scoped_restore_current_pspace_and_thread restore_pspace_thread;
+
+  input_radix = b->input_radix;
+  set_language (b->language);
+
+  try
+    {
+      return b->decode_location_spec (b->locspec.get (),
+				      current_program_space).empty ();
+    }
+  catch (const gdb_exception_error &e)
+    {
+      /* Anything other than the expected "not found" is left to the
+	 full re-set to report.  */
+      return e.error == NOT_FOUND_ERROR;
+    }
+}
+
 /* Re-set breakpoint locations for the current program space.
    Locations bound to other program spaces are left untouched.  */
 
@@ -12793,10 +13016,28 @@ breakpoint_re_set (void)
        breakpoint 1, we'd insert the locations of breakpoint 2, which
        hadn't been re-set yet, and thus may have stale locations.  */
 
+    /* If only new objfiles were added since the last re-set, pending
+       breakpoints need only be looked up in those.  Program spaces
+       still executing their startup code are skipped by the symbol
+       searches, so don't trust a snapshot taken in one.  */
+    program_space *pspace = current_program_space;
+    gdb::optional<std::unordered_set<objfile *>> added;
+    if (re_set_pspace == pspace && !pspace->executing_startup)
+      {
+	added.emplace ();
+	for (objfile *objfile : pspace->objfiles ())
+	  if (re_set_objfiles.count (objfile) == 0)
+	    added->insert (objfile);
+      }
+
     for (breakpoint *b : all_breakpoints_safe ())
       {
 	try
 	  {
+	    if (added.has_value ()
+		&& pending_breakpoint_unaffected_p (b, *added))
+	      continue;
+
 	    breakpoint_re_set_one (b);
 	  }
 	catch (const gdb_exception &ex)
@@ -12808,6 +13049,16 @@ breakpoint_re_set (void)
       }
 
     jit_breakpoint_re_set ();
+
+    re_set_objfiles.clear ();
+    if (pspace->executing_startup)
+      re_set_pspace = nullptr;
+    else
+      {
+	re_set_pspace = pspace;
+	for (objfile *objfile : pspace->objfiles ())
+	  re_set_objfiles.insert (objfile);
+      }
   }
 
   create_overlay_event_breakpoint ();
@@ -14187,6 +14438,10 @@ _initialize_breakpoint ()
 					 "breakpoint");
   gdb::observers::free_objfile.attach (disable_breakpoints_in_freed_objfile,
 				       "breakpoint");
+  gdb::observers::free_objfile.attach (forget_re_set_objfiles,
+				       "breakpoint");
+  gdb::observers::new_objfile.attach (forget_re_set_objfiles_on_reset,
+				      "breakpoint");
   gdb::observers::memory_changed.attach (invalidate_bp_value_on_memory_change,
 					 "breakpoint");
 
@@ -14655,6 +14910,19 @@ be set to \"host\"."),
 			   &breakpoint_set_cmdlist,
 			   &breakpoint_show_cmdlist);
 
+  add_setshow_boolean_cmd ("breakpoint-condition-bytecode", class_maintenance,
+			   &breakpoint_condition_bytecode, _("\
+Set whether GDB compiles breakpoint conditions to bytecode."), _("\
+Show whether GDB compiles breakpoint conditions to bytecode."), _("\
+When on, the conditions that GDB evaluates itself are compiled to agent\n\
+expression bytecode the first time their location is hit, and the bytecode\n\
+is evaluated on the following hits, which is much faster.  Conditions that\n\
+can't be compiled, such as function calls, are always evaluated normally."),
+			   NULL,
+			   NULL,
+			   &maintenance_set_cmdlist,
+			   &maintenance_show_cmdlist);
+
   add_com ("break-range", class_breakpoint, break_range_command, _("\
 Set a breakpoint for an address range.\n\
 break-range START-LOCATION, END-LOCATION\n\
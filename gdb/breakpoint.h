@@ -21,7 +21,7 @@
 
 #include "frame.h"
 #include "value.h"
-#include "ax.h"
+#include "ax-eval.h"
 #include "command.h"
 #include "gdbsupport/break-common.h"
 #include "probe.h"
@@ -362,6 +362,14 @@ class bp_location : public refcounted_object
      condition evaluation.  */
   agent_expr_up cond_bytecode;
 
+  /* Conditional expression compiled to agent expression bytecode for
+     evaluation by GDB itself, see bpstat_check_breakpoint_conditions.
+     COND_EVALUATOR_TRIED is set once compilation has been attempted;
+     if it failed, COND_EVALUATOR stays NULL.  Both are reset whenever
+     COND changes.  */
+  std::unique_ptr<ax_evaluator> cond_evaluator;
+  bool cond_evaluator_tried = false;
+
   /* Signals that the condition has changed since the last time
      we updated the global location list.  This means the condition
      needs to be sent to the target again.  This is used together
@@ -1846,6 +1854,21 @@ extern int pc_at_non_inline_function (const address_space *aspace,
 
 extern int user_breakpoint_p (struct breakpoint *);
 
+/* Return true if GDB should evaluate breakpoint conditions or false
+   otherwise, in which case the target might evaluate them, according
+   to "set breakpoint condition-evaluation".  */
+extern int gdb_evaluates_breakpoint_condition_p (void);
+
+/* Collect in CONDS the conditions of the enabled hardware watchpoint
+   locations in the current program space that watch LEN bytes at
+   ADDR for accesses of type TYPE: the location being inserted and
+   all its duplicates.  Return false, leaving CONDS empty, if none is
+   found or if any of them must report every hit, as the target may
+   then not filter hits on the other conditions.  */
+extern bool watchpoint_target_conditions
+  (CORE_ADDR addr, int len, enum target_hw_bp_type type,
+   std::vector<struct expression *> *conds);
+
 /* Return true if this breakpoint is pending, false if not.  */
 extern int pending_breakpoint_p (struct breakpoint *);
 
@@ -42,6 +42,7 @@
 #include <inttypes.h>
 #include <ctype.h>
 #include <algorithm>
+#include "leb128.h"
 
 /* Command lists for btrace maintenance commands.  */
 static struct cmd_list_element *maint_btrace_cmdlist;
@@ -69,6 +70,184 @@ static void btrace_add_pc (struct thread_info *tp);
 
 #define DEBUG_FTRACE(msg, args...) DEBUG ("[ftrace] " msg, ##args)
 
+/* The bits of btrace_insn_list's attribute bytes.  */
+
+#define BTRACE_INSN_ATTR_CLASS_MASK 0x7
+#define BTRACE_INSN_ATTR_FLAGS_SHIFT 3
+#define BTRACE_INSN_ATTR_BRANCHED 0x80
+
+/* See btrace.h.  */
+
+CORE_ADDR
+btrace_insn_list::decode_pc (size_t index, size_t *delta_offset) const
+{
+  gdb_assert (index < size ());
+
+  size_t first = index - index % CHECKPOINT_INTERVAL;
+  const checkpoint &cp = m_checkpoints[first / CHECKPOINT_INTERVAL];
+  CORE_ADDR pc = cp.pc;
+  size_t offset = cp.delta_offset;
+
+  for (size_t i = first + 1; i <= index; ++i)
+    {
+      pc += m_sizes[i - 1];
+      if ((m_attrs[i] & BTRACE_INSN_ATTR_BRANCHED) != 0)
+	pc += read_delta (&offset);
+    }
+
+  if (delta_offset != nullptr)
+    *delta_offset = offset;
+
+  return pc;
+}
+
+/* See btrace.h.  */
+
+CORE_ADDR
+btrace_insn_list::read_delta (size_t *offset) const
+{
+  int64_t delta = 0;
+
+  *offset += read_sleb128_to_int64 (m_deltas.data () + *offset,
+				    m_deltas.data () + m_deltas.size (),
+				    &delta);
+  return (CORE_ADDR) delta;
+}
+
+/* See btrace.h.  */
+
+btrace_insn
+btrace_insn_list::operator[] (size_t index) const
+{
+  return make_insn (index, decode_pc (index));
+}
+
+/* See btrace.h.  */
+
+btrace_insn_list::const_iterator::const_iterator
+  (const btrace_insn_list *list, size_t index)
+    : m_list (list), m_index (index)
+{
+  if (m_index < m_list->size ())
+    m_pc = m_list->decode_pc (m_index, &m_delta_offset);
+}
+
+/* See btrace.h.  */
+
+btrace_insn_list::const_iterator &
+btrace_insn_list::const_iterator::operator++ ()
+{
+  ++m_index;
+  if (m_index >= m_list->size ())
+    return *this;
+
+  if (m_index % CHECKPOINT_INTERVAL == 0)
+    {
+      const checkpoint &cp = m_list->m_checkpoints[m_index
+						   / CHECKPOINT_INTERVAL];
+      m_pc = cp.pc;
+      m_delta_offset = cp.delta_offset;
+    }
+  else
+    {
+      m_pc += m_list->m_sizes[m_index - 1];
+      if ((m_list->m_attrs[m_index] & BTRACE_INSN_ATTR_BRANCHED) != 0)
+	m_pc += m_list->read_delta (&m_delta_offset);
+    }
+
+  return *this;
+}
+
+/* See btrace.h.  */
+
+btrace_insn
+btrace_insn_list::make_insn (size_t index, CORE_ADDR pc) const
+{
+  gdb_byte attrs = m_attrs[index];
+  btrace_insn_flags flags
+    = (enum btrace_insn_flag) ((attrs & ~BTRACE_INSN_ATTR_BRANCHED)
+			       >> BTRACE_INSN_ATTR_FLAGS_SHIFT);
+
+  return {pc, m_sizes[index],
+	  (enum btrace_insn_class) (attrs & BTRACE_INSN_ATTR_CLASS_MASK),
+	  flags};
+}
+
+/* See btrace.h.  */
+
+void
+btrace_insn_list::push_back (const btrace_insn &insn)
+{
+  gdb_byte attrs = insn.iclass;
+  unsigned int flags = insn.flags;
+  attrs |= (gdb_byte) (flags << BTRACE_INSN_ATTR_FLAGS_SHIFT);
+  gdb_assert ((attrs & BTRACE_INSN_ATTR_BRANCHED) == 0);
+
+  if (size () % CHECKPOINT_INTERVAL == 0)
+    m_checkpoints.push_back ({insn.pc, m_deltas.size ()});
+  else if (insn.pc != m_next_pc)
+    {
+      attrs |= BTRACE_INSN_ATTR_BRANCHED;
+
+      /* Append the difference as signed LEB128.  */
+      int64_t delta = (int64_t) (insn.pc - m_next_pc);
+      for (;;)
+	{
+	  gdb_byte byte = delta & 0x7f;
+	  delta >>= 7;
+	  if ((delta == 0 && (byte & 0x40) == 0)
+	      || (delta == -1 && (byte & 0x40) != 0))
+	    {
+	      m_deltas.push_back (byte);
+	      break;
+	    }
+	  m_deltas.push_back (byte | 0x80);
+	}
+    }
+
+  m_sizes.push_back (insn.size);
+  m_attrs.push_back (attrs);
+  m_next_pc = insn.pc + insn.size;
+}
+
+/* See btrace.h.  */
+
+void
+btrace_insn_list::pop_back ()
+{
+  gdb_assert (!empty ());
+
+  size_t index = size () - 1;
+  if ((m_attrs[index] & BTRACE_INSN_ATTR_BRANCHED) != 0)
+    {
+      size_t offset;
+
+      gdb_assert (index > 0);
+      decode_pc (index - 1, &offset);
+      m_deltas.resize (offset);
+    }
+
+  if (index % CHECKPOINT_INTERVAL == 0)
+    m_checkpoints.pop_back ();
+
+  m_sizes.pop_back ();
+  m_attrs.pop_back ();
+
+  if (index > 0)
+    m_next_pc = decode_pc (index - 1) + m_sizes[index - 1];
+  else
+    m_next_pc = 0;
+}
+
+/* See btrace.h.  */
+
+size_t
+btrace_insn_list::memory_used () const
+{
+  return (m_sizes.capacity () + m_attrs.capacity () + m_deltas.capacity ()
+	  + m_checkpoints.capacity () * sizeof (checkpoint));
+}
+
 /* Return the function name of a recorded function segment for printing.
    This function never returns NULL.  */
 
@@ -398,9 +577,7 @@ ftrace_find_call (struct btrace_thread_info *btinfo,
       if (bfun->errcode != 0)
 	continue;
 
-      btrace_insn &last = bfun->insn.back ();
-
-      if (last.iclass == BTRACE_INSN_CALL)
+      if (bfun->insn.back ().iclass == BTRACE_INSN_CALL)
 	break;
     }
 
@@ -576,11 +753,11 @@ ftrace_update_function (struct btrace_thread_info *btinfo, CORE_ADDR pc)
   /* Check the last instruction, if we have one.
      We do this check first, since it allows us to fill in the call stack
      links in addition to the normal flow links.  */
-  btrace_insn *last = NULL;
+  gdb::optional<btrace_insn> last;
   if (!bfun->insn.empty ())
-    last = &bfun->insn.back ();
+    last = bfun->insn.back ();
 
-  if (last != NULL)
+  if (last.has_value ())
     {
       switch (last->iclass)
 	{
@@ -650,7 +827,7 @@ ftrace_update_function (struct btrace_thread_info *btinfo, CORE_ADDR pc)
   if (ftrace_function_switched (bfun, mfun, fun))
     {
       DEBUG_FTRACE ("switching from %s in %s at %s",
-		    ftrace_print_insn_addr (last),
+		    ftrace_print_insn_addr (last.has_value () ? &*last : NULL),
 		    ftrace_print_function_name (bfun),
 		    ftrace_print_filename (bfun));
 
@@ -2336,7 +2513,7 @@ parse_xml_btrace_conf (struct btrace_config *conf, const char *xml)
 
 /* See btrace.h.  */
 
-const struct btrace_insn *
+gdb::optional<btrace_insn>
 btrace_insn_get (const struct btrace_insn_iterator *it)
 {
   const struct btrace_function *bfun;
@@ -2347,14 +2524,14 @@ btrace_insn_get (const struct btrace_insn_iterator *it)
 
   /* Check if the iterator points to a gap in the trace.  */
   if (bfun->errcode != 0)
-    return NULL;
+    return {};
 
   /* The index is within the bounds of this function's instruction vector.  */
   end = bfun->insn.size ();
   gdb_assert (0 < end);
   gdb_assert (index < end);
 
-  return &bfun->insn[index];
+  return bfun->insn[index];
 }
 
 /* See btrace.h.  */
@@ -3429,6 +3606,16 @@ maint_info_btrace_cmd (const char *args, int from_tty)
       break;
 #endif /* defined (HAVE_LIBIPT)  */
     }
+
+  size_t insns = 0, memory = 0;
+  for (const btrace_function &bfun : btinfo->functions)
+    {
+      insns += bfun.insn.size ();
+      memory += bfun.insn.memory_used ();
+    }
+
+  gdb_printf (_("Number of instructions: %zu.\n"), insns);
+  gdb_printf (_("Memory used by instructions: %zu bytes.\n"), memory);
 }
 
 /* The "maint show btrace pt skip-pad" show value function. */
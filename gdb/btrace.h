@@ -29,6 +29,7 @@
 #include "gdbsupport/btrace-common.h"
 #include "target/waitstatus.h" /* For enum target_stop_reason.  */
 #include "gdbsupport/enum-flags.h"
+#include "gdbsupport/gdb_optional.h"
 
 #if defined (HAVE_LIBIPT)
 #  include <intel-pt.h>
@@ -81,6 +82,135 @@ struct btrace_insn
   btrace_insn_flags flags;
 };
 
+/* The instructions of a btrace function segment.
+
+   Traces can hold hundreds of millions of instructions, so they are not
+   stored as btrace_insn objects but in columns: one byte for the size,
+   and one byte for the class and flags of each instruction.  The PC of
+   an instruction is that of the preceding one plus its size, unless
+   control flow branched, in which case the difference is stored as a
+   signed LEB128 number.  Every CHECKPOINT_INTERVAL instructions, the
+   full PC is stored, so instructions are decoded lazily, in constant
+   time, when accessed.  */
+
+class btrace_insn_list
+{
+public:
+  /* An iterator over the instructions, decoding them in order.  */
+  class const_iterator
+  {
+  public:
+    typedef const_iterator self_type;
+    typedef btrace_insn value_type;
+    typedef std::forward_iterator_tag iterator_category;
+    typedef ptrdiff_t difference_type;
+
+    const_iterator (const btrace_insn_list *list, size_t index);
+
+    btrace_insn operator* () const
+    { return m_list->make_insn (m_index, m_pc); }
+
+    self_type &operator++ ();
+
+    bool operator== (const self_type &other) const
+    { return m_index == other.m_index; }
+
+    bool operator!= (const self_type &other) const
+    { return m_index != other.m_index; }
+
+  private:
+    /* The list iterated over.  */
+    const btrace_insn_list *m_list;
+
+    /* The index of the current instruction.  */
+    size_t m_index;
+
+    /* The PC of the current instruction, and the offset in the list's
+       M_DELTAS of the data of the next ones.  */
+    CORE_ADDR m_pc = 0;
+    size_t m_delta_offset = 0;
+  };
+
+  const_iterator begin () const
+  { return const_iterator (this, 0); }
+
+  const_iterator end () const
+  { return const_iterator (this, size ()); }
+
+  /* Return the number of instructions.  */
+  size_t size () const
+  { return m_sizes.size (); }
+
+  /* Return true if there are no instructions.  */
+  bool empty () const
+  { return m_sizes.empty (); }
+
+  /* Return the instruction at INDEX.  */
+  btrace_insn operator[] (size_t index) const;
+
+  /* Return the first instruction.  */
+  btrace_insn front () const
+  { return (*this)[0]; }
+
+  /* Return the last instruction.  */
+  btrace_insn back () const
+  { return (*this)[size () - 1]; }
+
+  /* Append INSN.  */
+  void push_back (const btrace_insn &insn);
+
+  /* Remove the last instruction.  */
+  void pop_back ();
+
+  /* Return the number of bytes used to store the instructions.  */
+  size_t memory_used () const;
+
+private:
+  /* The number of instructions between two full PCs.  */
+  static constexpr size_t CHECKPOINT_INTERVAL = 32;
+
+  /* A full PC, stored for each instruction whose index is a multiple of
+     CHECKPOINT_INTERVAL.  */
+  struct checkpoint
+  {
+    /* The PC of the instruction.  */
+    CORE_ADDR pc;
+
+    /* The size of M_DELTAS when the instruction was added.  */
+    size_t delta_offset;
+  };
+
+  /* Return the PC of the instruction at INDEX.  If DELTA_OFFSET is not
+     nullptr, set it to the offset in M_DELTAS of the data of the
+     instructions following INDEX.  */
+  CORE_ADDR decode_pc (size_t index, size_t *delta_offset = nullptr) const;
+
+  /* Return the instruction at INDEX, whose PC is PC.  */
+  btrace_insn make_insn (size_t index, CORE_ADDR pc) const;
+
+  /* Read the PC delta at *OFFSET in M_DELTAS, and advance *OFFSET past
+     it.  */
+  CORE_ADDR read_delta (size_t *offset) const;
+
+  /* The size of each instruction.  */
+  std::vector<gdb_byte> m_sizes;
+
+  /* The class, flags and whether control flow branched to it, for each
+     instruction.  */
+  std::vector<gdb_byte> m_attrs;
+
+  /* The LEB128-encoded PC deltas of the instructions control flow
+     branched to, in order.  */
+  std::vector<gdb_byte> m_deltas;
+
+  /* The full PCs.  */
+  std::vector<checkpoint> m_checkpoints;
+
+  /* The PC following the last instruction, if control flow doesn't
+     branch.  */
+  CORE_ADDR m_next_pc = 0;
+};
+
 /* Flags for btrace function segments.  */
 enum btrace_function_flag
 {
@@ -155,9 +285,9 @@ struct btrace_function
   unsigned int up = 0;
 
   /* The instructions in this function segment.
-     The instruction vector will be empty if the function segment
+     The instruction list will be empty if the function segment
      represents a decode error.  */
-  std::vector<btrace_insn> insn;
+  btrace_insn_list insn;
 
   /* The error code of a decode error that led to a gap.
      Must be zero unless INSN is empty; non-zero otherwise.  */
@@ -399,10 +529,11 @@ extern void parse_xml_btrace (struct btrace_data *data, const char *xml);
 /* Parse a branch trace configuration xml document XML into CONF.  */
 extern void parse_xml_btrace_conf (struct btrace_config *conf, const char *xml);
 
-/* Dereference a branch trace instruction iterator.  Return a pointer to the
+/* Dereference a branch trace instruction iterator.  Return the
    instruction the iterator points to.
-   May return NULL if the iterator points to a gap in the trace.  */
-extern const struct btrace_insn *
+   Returns an empty optional if the iterator points to a gap in the
+   trace.  */
+extern gdb::optional<btrace_insn>
   btrace_insn_get (const struct btrace_insn_iterator *);
 
 /* Return the error code for a branch trace instruction iterator.  Returns zero
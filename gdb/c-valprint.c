@@ -237,9 +237,11 @@ c_value_print_array (struct value *val,
 {
   struct type *type = check_typedef (value_type (val));
   CORE_ADDR address = value_address (val);
-  const gdb_byte *valaddr = value_contents_for_printing (val).data ();
   struct type *unresolved_elttype = TYPE_TARGET_TYPE (type);
   struct type *elttype = check_typedef (unresolved_elttype);
+  /* Arrays printed element by element are read as they are printed;
+     see value_print_array_elements.  The others are read here.  */
+  const gdb_byte *valaddr = nullptr;
 
   if (TYPE_LENGTH (type) > 0 && TYPE_LENGTH (unresolved_elttype) > 0)
     {
@@ -253,10 +255,14 @@ c_value_print_array (struct value *val,
       eltlen = TYPE_LENGTH (elttype);
       len = high_bound - low_bound + 1;
 
+      bool textual = c_textual_element_type (unresolved_elttype,
+					     options->format);
+      if (textual)
+	valaddr = value_contents_for_printing (val).data ();
+
       /* Print arrays of textual chars with a string syntax, as
 	 long as the entire array is valid.  */
-      if (c_textual_element_type (unresolved_elttype,
-				  options->format)
+      if (textual
 	  && value_bytes_available (val, 0, TYPE_LENGTH (type))
 	  && !value_bits_any_optimized_out (val, 0,
 					    TARGET_CHAR_BIT * TYPE_LENGTH (type)))
@@ -315,6 +321,7 @@ c_value_print_array (struct value *val,
   else
     {
       /* Array of unspecified length: treat like pointer to first elt.  */
+      valaddr = value_contents_for_printing (val).data ();
       print_unpacked_pointer (type, elttype, unresolved_elttype, valaddr,
 			      0, address, stream, recurse, options);
     }
@@ -2216,6 +2216,14 @@ value_from_setting (const setting &var, struct gdbarch *gdbarch)
     case var_zuinteger_unlimited:
       return value_from_longest (builtin_type (gdbarch)->builtin_int,
 				 var.get<int> ());
+    case var_zulongest_unlimited:
+      if (var.get<ULONGEST> () == ULONGEST_MAX)
+	return value_from_longest (builtin_type (gdbarch)->builtin_long_long,
+				   -1);
+      else
+	return value_from_ulongest
+	  (builtin_type (gdbarch)->builtin_unsigned_long_long,
+	   var.get<ULONGEST> ());
     case var_auto_boolean:
       {
 	int val;
@@ -2321,6 +2329,7 @@ str_value_from_setting (const setting &var, struct gdbarch *gdbarch)
     case var_zinteger:
     case var_boolean:
     case var_zuinteger_unlimited:
+    case var_zulongest_unlimited:
     case var_auto_boolean:
     case var_uinteger:
     case var_zuinteger:
@@ -1181,6 +1181,34 @@ add_setshow_zuinteger_unlimited_cmd (const char *name, command_class theclass,
   return cmds;
 }
 
+/* Add element named NAME to both the set and show command LISTs (the
+   list for set/show or some sublist thereof).  CLASS is as in
+   add_cmd.  VAR is address of the variable which will contain the
+   value.  SET_DOC and SHOW_DOC are the documentation strings.  */
+
+set_show_commands
+add_setshow_zulongest_unlimited_cmd (const char *name,
+				     enum command_class theclass,
+				     ULONGEST *var,
+				     const char *set_doc,
+				     const char *show_doc,
+				     const char *help_doc,
+				     cmd_func_ftype *set_func,
+				     show_value_ftype *show_func,
+				     struct cmd_list_element **set_list,
+				     struct cmd_list_element **show_list)
+{
+  set_show_commands commands
+    = add_setshow_cmd_full<ULONGEST> (name, theclass, var_zulongest_unlimited,
+				      var, set_doc, show_doc, help_doc,
+				      nullptr, nullptr, set_func, show_func,
+				      set_list, show_list);
+
+  set_cmd_completer (commands.set, integer_unlimited_completer);
+
+  return commands;
+}
+
 /* Add element named NAME to both the set and show command LISTs (the
    list for set/show or some sublist thereof).  CLASS is as in
    add_cmd.  VAR is address of the variable which will contain the
@@ -245,6 +245,34 @@ parse_cli_var_zuinteger_unlimited (const char **arg, bool expression)
   return val;
 }
 
+/* Parse ARG, the argument of a var_zulongest_unlimited setting, and
+   return the value to store.  */
+
+static ULONGEST
+parse_cli_var_zulongest_unlimited (const char **arg)
+{
+  if (*arg == nullptr || **arg == '\0')
+    error_no_arg (_("integer to set it to, or \"unlimited\""));
+
+  if (is_unlimited_literal (arg, true))
+    return ULONGEST_MAX;
+
+  struct value *val = parse_and_eval (*arg);
+  struct type *type = check_typedef (value_type (val));
+
+  if (!type->is_unsigned ())
+    {
+      LONGEST l = value_as_long (val);
+
+      if (l == -1)
+	return ULONGEST_MAX;
+      else if (l < -1)
+	error (_("only -1 is allowed to set as unlimited"));
+    }
+
+  return (ULONGEST) value_as_long (val);
+}
+
 /* See cli-setshow.h.  */
 
 const char *
@@ -458,6 +486,10 @@ do_set_command (const char *arg, int from_tty, struct cmd_list_element *c)
       option_changed = c->var->set<int>
 	(parse_cli_var_zuinteger_unlimited (&arg, true));
       break;
+    case var_zulongest_unlimited:
+      option_changed = c->var->set<ULONGEST>
+	(parse_cli_var_zulongest_unlimited (&arg));
+      break;
     default:
       error (_("gdb internal error: bad var_type in do_setshow_command"));
     }
@@ -569,6 +601,14 @@ do_set_command (const char *arg, int from_tty, struct cmd_list_element *c)
 	    gdb::observers::command_param_changed.notify (name, s);
 	  }
 	  break;
+	case var_zulongest_unlimited:
+	  {
+	    ULONGEST value = c->var->get<ULONGEST> ();
+
+	    gdb::observers::command_param_changed.notify
+	      (name, value == ULONGEST_MAX ? "-1" : pulongest (value));
+	  }
+	  break;
 	}
       xfree (name);
     }
@@ -655,6 +695,15 @@ get_setshow_command_value_string (const setting &var)
 	  stb.printf ("%d", value);
       }
       break;
+    case var_zulongest_unlimited:
+      {
+	const ULONGEST value = var.get<ULONGEST> ();
+	if (value == ULONGEST_MAX)
+	  stb.puts ("unlimited");
+	else
+	  stb.puts (pulongest (value));
+      }
+      break;
     default:
       gdb_assert_not_reached ("bad var_type");
     }
@@ -116,6 +116,10 @@ enum var_types
        but its range is [0, INT_MAX].  -1 stands for unlimited and
        other negative numbers are not allowed.  */
     var_zuinteger_unlimited,
+    /* Like var_zuinteger_unlimited, but *VAR is a ULONGEST, for sizes
+       that may not fit in an int.  "unlimited" or -1 is stored as
+       ULONGEST_MAX.  */
+    var_zulongest_unlimited,
     /* Enumerated type.  Can only have one of the specified values.
        *VAR is a char pointer to the name of the element that we
        find.  */
@@ -163,6 +167,13 @@ inline bool var_type_uses<int> (var_types t)
 	  || t == var_zuinteger_unlimited);
 }
 
+/* Return true if a setting of type T is backed by a ULONGEST variable.  */
+template<>
+inline bool var_type_uses<ULONGEST> (var_types t)
+{
+  return t == var_zulongest_unlimited;
+}
+
 /* Return true if a setting of type T is backed by a std::string variable.  */
 template<>
 inline bool var_type_uses<std::string> (var_types t)
@@ -811,6 +822,12 @@ extern set_show_commands add_setshow_zuinteger_unlimited_cmd
    show_value_ftype *show_func, cmd_list_element **set_list,
    cmd_list_element **show_list);
 
+extern set_show_commands add_setshow_zulongest_unlimited_cmd
+  (const char *name, command_class theclass, ULONGEST *var,
+   const char *set_doc, const char *show_doc, const char *help_doc,
+   cmd_func_ftype *set_func, show_value_ftype *show_func,
+   cmd_list_element **set_list, cmd_list_element **show_list);
+
 /* Do a "show" command for each thing on a command list.  */
 
 extern void cmd_show_list (struct cmd_list_element *, int);
@@ -47,6 +47,7 @@
 #include "build-id.h"
 #include "gdbsupport/pathstuff.h"
 #include "gdbsupport/scoped_fd.h"
+#include "gdbsupport/scoped_mmap.h"
 #include "debuginfod-support.h"
 #include <unordered_map>
 #include <unordered_set>
@@ -149,6 +150,41 @@ class core_target final : public process_stratum_target
 						    ULONGEST len,
 						    ULONGEST *xfered_len);
 
+#if HAVE_SYS_MMAN_H
+  /* Helper method for xfer_partial.  Read memory from the core file
+     sections with contents by mapping them into GDB's address space,
+     rather than going through BFD's file I/O for each request.  */
+  enum target_xfer_status xfer_memory_via_mmap (gdb_byte *readbuf,
+						ULONGEST offset,
+						ULONGEST len,
+						ULONGEST *xfered_len);
+
+  /* Return the mapping for the section at index IDX of
+     m_core_section_table, creating it if needed, or NULL if the
+     section can't be mapped.  */
+  const gdb_byte *map_core_section (size_t idx);
+
+  /* A descriptor for the core file, used to create the mappings
+     below.  Opened the first time a section is mapped.  */
+  scoped_fd m_core_fd;
+
+  /* The size of the core file, used to avoid mapping past its end
+     when the core is truncated.  */
+  off_t m_core_file_size = 0;
+
+  /* Whether we have already tried to open M_CORE_FD.  */
+  bool m_core_fd_tried = false;
+
+  /* Mappings of the core sections, indexed like
+     m_core_section_table.  Sections are mapped lazily, the first time
+     memory inside them is read; an entry whose mapping is MAP_FAILED
+     records a section we could not map.  The second member is the
+     offset of the section's contents within the mapping, as mappings
+     must start on a page boundary.  */
+  std::unordered_map<size_t, std::pair<scoped_mmap, size_t>>
+    m_core_section_maps;
+#endif
+
   /* FIXME: kettenis/20031023: Eventually this field should
      disappear.  */
   struct gdbarch *m_core_gdbarch = NULL;
@@ -833,6 +869,105 @@ core_target::xfer_memory_via_mappings (gdb_byte *readbuf,
   return xfer_status;
 }
 
+#if HAVE_SYS_MMAN_H
+
+/* See class declaration.  */
+
+const gdb_byte *
+core_target::map_core_section (size_t idx)
+{
+  auto it = m_core_section_maps.find (idx);
+  if (it != m_core_section_maps.end ())
+    {
+      if (it->second.first.get () == MAP_FAILED)
+	return nullptr;
+      return ((const gdb_byte *) it->second.first.get ()
+	      + it->second.second);
+    }
+
+  if (!m_core_fd_tried)
+    {
+      m_core_fd_tried = true;
+
+      /* Only map cores we opened for reading from the local
+	 filesystem; for anything else, BFD knows best how to get at
+	 the contents.  */
+      const char *filename = bfd_get_filename (core_bfd);
+      if (bfd_get_flavour (core_bfd) == bfd_target_elf_flavour
+	  && core_bfd->direction == read_direction
+	  && !is_target_filename (filename))
+	{
+	  scoped_fd fd (gdb_open_cloexec (filename, O_RDONLY, 0));
+	  struct stat st;
+
+	  if (fd.get () >= 0 && fstat (fd.get (), &st) == 0)
+	    {
+	      m_core_file_size = st.st_size;
+	      m_core_fd = std::move (fd);
+	    }
+	}
+    }
+
+  auto &entry = m_core_section_maps[idx];
+  if (m_core_fd.get () < 0)
+    return nullptr;
+
+  asection *asect = m_core_section_table[idx].the_bfd_section;
+  file_ptr filepos = asect->filepos;
+  bfd_size_type size = bfd_section_size (asect);
+
+  /* A truncated core may not contain the whole section; touching a
+     mapping past the end of the file would fault, so leave those to
+     BFD, which reports the short read properly.  */
+  if (size == 0 || filepos < 0
+      || (ULONGEST) filepos + size > (ULONGEST) m_core_file_size)
+    return nullptr;
+
+  static const long page_size = sysconf (_SC_PAGESIZE);
+  off_t map_offset = filepos & ~((off_t) page_size - 1);
+  size_t delta = filepos - map_offset;
+
+  entry.first.reset (nullptr, size + delta, PROT_READ, MAP_PRIVATE,
+		     m_core_fd.get (), map_offset);
+  entry.second = delta;
+  if (entry.first.get () == MAP_FAILED)
+    return nullptr;
+
+  return (const gdb_byte *) entry.first.get () + delta;
+}
+
+/* See class declaration.  */
+
+enum target_xfer_status
+core_target::xfer_memory_via_mmap (gdb_byte *readbuf, ULONGEST offset,
+				   ULONGEST len, ULONGEST *xfered_len)
+{
+  for (size_t i = 0; i < m_core_section_table.size (); ++i)
+    {
+      const target_section &p = m_core_section_table[i];
+
+      if ((p.the_bfd_section->flags & SEC_HAS_CONTENTS) == 0
+	  || offset < p.addr || offset >= p.endaddr)
+	continue;
+
+      const gdb_byte *contents = map_core_section (i);
+      if (contents == nullptr)
+	return TARGET_XFER_E_IO;
+
+      /* Like section_table_xfer_memory_partial, don't read past the
+	 end of this section; the caller will come back for the
+	 rest.  */
+      ULONGEST n = std::min (len, p.endaddr - offset);
+      memcpy (readbuf, contents + (offset - p.addr), n);
+      *xfered_len = n;
+      return TARGET_XFER_OK;
+    }
+
+  return TARGET_XFER_EOF;
+}
+
+#endif /* HAVE_SYS_MMAN_H */
+
 enum target_xfer_status
 core_target::xfer_partial (enum target_object object, const char *annex,
 			   gdb_byte *readbuf, const gdb_byte *writebuf,
@@ -844,6 +979,19 @@ core_target::xfer_partial (enum target_object object, const char *annex,
       {
 	enum target_xfer_status xfer_status;
 
+#if HAVE_SYS_MMAN_H
+	/* Reads are served straight from a mapping of the core file
+	   when possible.  If that fails, fall back to going through
+	   BFD below.  */
+	if (readbuf != nullptr)
+	  {
+	    xfer_status = xfer_memory_via_mmap (readbuf, offset, len,
+						xfered_len);
+	    if (xfer_status == TARGET_XFER_OK)
+	      return TARGET_XFER_OK;
+	  }
+#endif
+
 	/* Try accessing memory contents from core file data,
 	   restricting consideration to those sections for which
 	   the BFD section flag SEC_HAS_CONTENTS is set.  */
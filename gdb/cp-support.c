@@ -42,6 +42,11 @@
 #include "event-top.h"
 #include "run-on-main-thread.h"
 #include "typeprint.h"
+#include "perf-counter.h"
+#include <unordered_map>
+#if CXX_STD_THREAD
+#include <mutex>
+#endif
 
 #define d_left(dc) (dc)->u.s_binary.left
 #define d_right(dc) (dc)->u.s_binary.right
@@ -618,19 +623,54 @@ cp_canonicalize_string_no_typedefs (const char *string)
   return cp_canonicalize_string_full (string, NULL, NULL);
 }
 
-/* Parse STRING and convert it to canonical form.  If parsing fails,
-   or if STRING is already canonical, return nullptr.
-   Otherwise return the canonical form.  */
+/* A cache of the results of cp_canonicalize_string.  Linespecs,
+   lookup_name_info and breakpoint re-setting canonicalize the same
+   names over and over, and each time the name has to be parsed.  The
+   result only depends on the string, so it can be remembered.  Like
+   the demangle cache in symtab.c, the cache is split into shards,
+   each with its own lock, so that it can be used from the worker
+   threads that build the DWARF index.  */
 
-gdb::unique_xmalloc_ptr<char>
-cp_canonicalize_string (const char *string)
+struct canonicalize_cache_result
+{
+  /* The canonical form, if HAS_CANONICAL.  */
+  std::string canonical;
+  /* False if the name failed to parse or was already canonical.  */
+  bool has_canonical;
+};
+
+struct canonicalize_cache_shard
+{
+#if CXX_STD_THREAD
+  std::mutex lock;
+#endif
+  std::unordered_map<std::string, canonicalize_cache_result> map;
+};
+
+/* The number of shards of the canonicalization cache.  */
+#define CANONICALIZE_CACHE_SHARDS 16
+
+/* When a shard holds more entries than this, it is emptied.  */
+#define CANONICALIZE_CACHE_SHARD_LIMIT 8192
+
+static canonicalize_cache_shard canonicalize_cache[CANONICALIZE_CACHE_SHARDS];
+
+static perf_counter canonicalize_calls_counter
+  ("cp-canonicalize-calls", perf_counter_unit::count,
+   N_("Names parsed or looked up by cp_canonicalize_string."));
+static perf_counter canonicalize_hits_counter
+  ("cp-canonicalize-cache-hits", perf_counter_unit::count,
+   N_("Calls of cp_canonicalize_string served from its cache."));
+
+/* The part of cp_canonicalize_string that does the work.  Set
+   *CACHEABLE to false if the result should not be remembered.  */
+
+static gdb::unique_xmalloc_ptr<char>
+cp_canonicalize_string_1 (const char *string, bool *cacheable)
 {
   std::unique_ptr<demangle_parse_info> info;
   unsigned int estimated_len;
 
-  if (cp_already_canonical (string))
-    return nullptr;
-
   info = cp_demangled_name_to_comp (string, NULL);
   if (info == NULL)
     return nullptr;
@@ -641,6 +681,8 @@ cp_canonicalize_string (const char *string)
 
   if (!us)
     {
+      /* Don't cache this, so the warning is issued every time.  */
+      *cacheable = false;
       warning (_("internal error: string \"%s\" failed to be canonicalized"),
 	       string);
       return nullptr;
@@ -652,6 +694,83 @@ cp_canonicalize_string (const char *string)
   return us;
 }
 
+/* Parse STRING and convert it to canonical form.  If parsing fails,
+   or if STRING is already canonical, return nullptr.
+   Otherwise return the canonical form.  */
+
+gdb::unique_xmalloc_ptr<char>
+cp_canonicalize_string (const char *string)
+{
+  if (cp_already_canonical (string))
+    return nullptr;
+
+  canonicalize_calls_counter.add ();
+
+  std::string key = string;
+  canonicalize_cache_shard &shard
+    = canonicalize_cache[std::hash<std::string> () (key)
+			 % CANONICALIZE_CACHE_SHARDS];
+
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (shard.lock);
+#endif
+    auto iter = shard.map.find (key);
+    if (iter != shard.map.end ())
+      {
+	canonicalize_hits_counter.add ();
+	if (!iter->second.has_canonical)
+	  return nullptr;
+	return make_unique_xstrdup (iter->second.canonical.c_str ());
+      }
+  }
+
+  /* Parse without holding the lock.  */
+  bool cacheable = true;
+  gdb::unique_xmalloc_ptr<char> us = cp_canonicalize_string_1 (string,
+							      &cacheable);
+  if (!cacheable)
+    return us;
+
+  canonicalize_cache_result result;
+  result.has_canonical = us != nullptr;
+  if (us != nullptr)
+    result.canonical = us.get ();
+
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (shard.lock);
+#endif
+    if (shard.map.size () >= CANONICALIZE_CACHE_SHARD_LIMIT)
+      shard.map.clear ();
+    shard.map.emplace (std::move (key), std::move (result));
+  }
+
+  return us;
+}
+
+/* See cp-support.h.  */
+
+void
+cp_print_canonicalize_statistics ()
+{
+  size_t entries = 0;
+  for (canonicalize_cache_shard &shard : canonicalize_cache)
+    {
+#if CXX_STD_THREAD
+      std::lock_guard<std::mutex> guard (shard.lock);
+#endif
+      entries += shard.map.size ();
+    }
+
+  gdb_printf (_("C++ name canonicalization cache:\n"));
+  gdb_printf (_("  Names canonicalized: %llu\n"),
+	      canonicalize_calls_counter.value ());
+  gdb_printf (_("  Cache hits: %llu\n"),
+	      canonicalize_hits_counter.value ());
+  gdb_printf (_("  Cached names: %zu\n"), entries);
+}
+
 /* Convert a mangled name to a demangle_component tree.  *MEMORY is
    set to the block of used memory that should be freed when finished
    with the tree.  DEMANGLED_P is set to the char * that should be
@@ -80,6 +80,11 @@ struct demangle_parse_info
 extern gdb::unique_xmalloc_ptr<char> cp_canonicalize_string
   (const char *string);
 
+/* Print statistics about the cache used by cp_canonicalize_string, for
+   "maint print statistics".  */
+
+extern void cp_print_canonicalize_statistics ();
+
 extern gdb::unique_xmalloc_ptr<char> cp_canonicalize_string_no_typedefs
   (const char *string);
 
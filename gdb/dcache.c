@@ -25,6 +25,8 @@
 #include "inferior.h"
 #include "splay-tree.h"
 #include "gdbarch.h"
+#include "gdbsupport/byte-vector.h"
+#include "perf-counter.h"
 
 /* Commands with a prefix of `{set,show} dcache'.  */
 static struct cmd_list_element *dcache_set_list = NULL;
@@ -83,6 +85,23 @@ static unsigned dcache_size = DCACHE_DEFAULT_SIZE;
 #define DCACHE_DEFAULT_LINE_SIZE 64
 static unsigned dcache_line_size = DCACHE_DEFAULT_LINE_SIZE;
 
+/* The maximum number of lines fetched by a single target read when a
+   miss is followed by other uncached lines.  Walking the stack during a
+   backtrace reads successive frames at increasing addresses, so stack
+   reads always fetch this many lines along with the missing one,
+   saving a round trip per frame on remote targets.  For other memory,
+   the number of lines read starts at one and doubles each time a miss
+   falls right after the lines read by the previous one, up to this
+   limit.  */
+#define DCACHE_READ_AHEAD_LINES 16
+
+/* When filling lines ahead, runs of uncached lines separated by at
+   most this many cached lines are read with a single request, the
+   cached lines in between being read again and discarded.  This keeps
+   targets that can't batch reads from issuing one request per run.  */
+
+#define DCACHE_READ_AHEAD_MAX_GAP 4
+
 /* Each cache block holds LINE_SIZE bytes of data
    starting at a multiple-of-LINE_SIZE address.  */
 
@@ -120,6 +139,20 @@ struct dcache_struct
   /* The process target of last inferior to use the cache or
      nullptr.  */
   process_stratum_target *proc_target;
+
+  /* The number of lines the next miss outside the stack reads, and the
+     address just past the lines read by the previous miss.  */
+  int read_ahead;
+  CORE_ADDR read_ahead_end;
+
+  /* Statistics shown by "info dcache": the number of reads, how many
+     of them were served without reading target memory, the number of
+     target reads, and the number of lines read ahead of a miss.
+     These are kept across invalidations.  */
+  unsigned long reads;
+  unsigned long read_hits;
+  unsigned long target_reads;
+  unsigned long lines_read_ahead;
 };
 
 typedef void (block_func) (struct dcache_block *block, void *param);
@@ -254,6 +287,8 @@ dcache_invalidate (DCACHE *dcache)
   dcache->size = 0;
   dcache->ptid = null_ptid;
   dcache->proc_target = nullptr;
+  dcache->read_ahead = 1;
+  dcache->read_ahead_end = 0;
 
   if (dcache->line_size != dcache_line_size)
     {
@@ -391,21 +426,133 @@ dcache_alloc (DCACHE *dcache, CORE_ADDR addr)
   return db;
 }
 
+/* Fill the cache line containing ADDR, which must not be cached yet,
+   along with the uncached lines among the MAX_LINES - 1 lines
+   following it, using a single batched target read.  Lines that are
+   already cached are skipped, so the lines read need not be
+   contiguous; runs separated by only a few cached lines are read as
+   one, though.  The lines are only read together if they all lie
+   within one readable memory region; otherwise, or if the batched
+   read fails, just the line containing ADDR is read.
+
+   Return the block holding ADDR, or NULL if its line wasn't
+   readable.  */
+
+static struct dcache_block *
+dcache_read_lines (DCACHE *dcache, CORE_ADDR addr, int max_lines)
+{
+  CORE_ADDR memaddr = MASK (dcache, addr);
+  struct mem_region *region = lookup_mem_region (memaddr);
+  std::vector<CORE_ADDR> lines { memaddr };
+
+  dcache->target_reads++;
+
+  if (region->attrib.mode != MEM_WO)
+    {
+      max_lines = std::min<unsigned> (max_lines, dcache_size);
+
+      for (int i = 1; i < max_lines; i++)
+	{
+	  CORE_ADDR next = memaddr + i * dcache->line_size;
+
+	  /* Stop on address wrap-around or at the end of the
+	     region.  */
+	  if (next < memaddr
+	      || (region->hi != 0
+		  && next + dcache->line_size > region->hi))
+	    break;
+
+	  if (splay_tree_lookup (dcache->tree, (splay_tree_key) next) == NULL)
+	    lines.push_back (next);
+	}
+    }
+
+  if (lines.size () > 1)
+    {
+      /* BUF mirrors memory from MEMADDR to the end of the last line,
+	 so that a request spanning a gap of cached lines is contiguous
+	 there too.  */
+      gdb::byte_vector buf (lines.back () + dcache->line_size - memaddr);
+      std::vector<memory_read_request> requests;
+      const CORE_ADDR max_gap = DCACHE_READ_AHEAD_MAX_GAP * dcache->line_size;
+
+      /* Read each run of uncached lines as one request, extending the
+	 previous request over short gaps.  */
+      for (CORE_ADDR line : lines)
+	{
+	  memory_read_request *prev
+	    = requests.empty () ? nullptr : &requests.back ();
+
+	  if (prev != nullptr && line - (prev->addr + prev->len) <= max_gap)
+	    prev->len = line + dcache->line_size - prev->addr;
+	  else
+	    requests.push_back ({ line, buf.data () + (line - memaddr),
+				  (ULONGEST) dcache->line_size });
+	}
+
+      if (target_read_raw_memory_batch (requests))
+	{
+	  struct dcache_block *first = NULL;
+
+	  /* There are never more lines than the cache size, so
+	     allocating the later blocks can't evict the first one.  */
+	  for (size_t i = 0; i < lines.size (); i++)
+	    {
+	      struct dcache_block *db = dcache_alloc (dcache, lines[i]);
+
+	      memcpy (db->data, buf.data () + (lines[i] - memaddr),
+		      dcache->line_size);
+	      if (i == 0)
+		first = db;
+	    }
+
+	  dcache->lines_read_ahead += lines.size () - 1;
+	  dcache->read_ahead_end = lines.back () + dcache->line_size;
+	  return first;
+	}
+    }
+
+  struct dcache_block *db = dcache_alloc (dcache, addr);
+
+  if (!dcache_read_line (dcache, db))
+    return NULL;
+
+  dcache->read_ahead_end = memaddr + dcache->line_size;
+  return db;
+}
+
 /* Using the data cache DCACHE, store in *PTR the contents of the byte at
-   address ADDR in the remote machine.  
+   address ADDR in the remote machine.  STACK is true if ADDR is known
+   to be stack memory.
 
    Returns 1 for success, 0 for error.  */
 
 static int
-dcache_peek_byte (DCACHE *dcache, CORE_ADDR addr, gdb_byte *ptr)
+dcache_peek_byte (DCACHE *dcache, CORE_ADDR addr, gdb_byte *ptr,
+		  bool stack)
 {
   struct dcache_block *db = dcache_hit (dcache, addr);
 
   if (!db)
     {
-      db = dcache_alloc (dcache, addr);
+      int max_lines;
+
+      if (stack)
+	max_lines = DCACHE_READ_AHEAD_LINES;
+      else
+	{
+	  /* Grow the read-ahead while the misses are sequential.  */
+	  if (MASK (dcache, addr) == dcache->read_ahead_end)
+	    dcache->read_ahead = std::min (dcache->read_ahead * 2,
+					   DCACHE_READ_AHEAD_LINES);
+	  else
+	    dcache->read_ahead = 1;
+	  max_lines = dcache->read_ahead;
+	}
 
-      if (!dcache_read_line (dcache, db))
+      db = dcache_read_lines (dcache, addr, max_lines);
+
+      if (db == NULL)
 	 return 0;
     }
 
@@ -459,10 +606,26 @@ dcache_init (void)
   dcache->line_size = dcache_line_size;
   dcache->ptid = null_ptid;
   dcache->proc_target = nullptr;
+  dcache->read_ahead = 1;
+  dcache->read_ahead_end = 0;
+  dcache->reads = 0;
+  dcache->read_hits = 0;
+  dcache->target_reads = 0;
+  dcache->lines_read_ahead = 0;
 
   return dcache;
 }
 
+/* Reads through all the data caches, and those of them served without
+   reading from the target.  */
+
+static perf_counter dcache_reads_counter
+  ("dcache-reads", perf_counter_unit::count,
+   N_("Memory reads through the data cache."));
+static perf_counter dcache_hits_counter
+  ("dcache-hits", perf_counter_unit::count,
+   N_("Memory reads fully served from the data cache."));
+
 
 /* Read LEN bytes from dcache memory at MEMADDR, transferring to
    debugger address MYADDR.  If the data is presently cached, this
@@ -472,7 +635,8 @@ dcache_init (void)
 enum target_xfer_status
 dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
 			    CORE_ADDR memaddr, gdb_byte *myaddr,
-			    ULONGEST len, ULONGEST *xfered_len)
+			    ULONGEST len, ULONGEST *xfered_len,
+			    bool stack)
 {
   ULONGEST i;
 
@@ -487,9 +651,12 @@ dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
       dcache->proc_target = proc_target;
     }
 
+  unsigned long target_reads = dcache->target_reads;
+
+  dcache->reads++;
   for (i = 0; i < len; i++)
     {
-      if (!dcache_peek_byte (dcache, memaddr + i, myaddr + i))
+      if (!dcache_peek_byte (dcache, memaddr + i, myaddr + i, stack))
 	{
 	  /* That failed.  Discard its cache line so we don't have a
 	     partially read line.  */
@@ -498,6 +665,13 @@ dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
 	}
     }
 
+  dcache_reads_counter.add ();
+  if (dcache->target_reads == target_reads)
+    {
+      dcache->read_hits++;
+      dcache_hits_counter.add ();
+    }
+
   if (i == 0)
     {
       /* Even though reading the whole line failed, we may be able to
@@ -644,6 +818,13 @@ dcache_info_1 (DCACHE *dcache, const char *exp)
     }
 
   gdb_printf (_("Cache state: %d active lines, %d hits\n"), i, refcount);
+
+  if (dcache->reads != 0)
+    gdb_printf (_("Reads: %lu, served from cache: %lu (%lu%%), "
+		  "target reads: %lu, lines read ahead: %lu\n"),
+		dcache->reads, dcache->read_hits,
+		dcache->read_hits * 100 / dcache->reads,
+		dcache->target_reads, dcache->lines_read_ahead);
 }
 
 static void
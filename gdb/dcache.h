@@ -43,10 +43,15 @@ struct dcache_deleter
   }
 };
 
+/* Read LEN bytes at MEMADDR into MYADDR through DCACHE.  STACK is
+   true if the memory is known to be on the stack, which makes a miss
+   read further ahead.  */
+
 enum target_xfer_status
   dcache_read_memory_partial (struct target_ops *ops, DCACHE *dcache,
 			      CORE_ADDR memaddr, gdb_byte *myaddr,
-			      ULONGEST len, ULONGEST *xfered_len);
+			      ULONGEST len, ULONGEST *xfered_len,
+			      bool stack);
 
 void dcache_update (DCACHE *dcache, enum target_xfer_status status,
 		    CORE_ADDR memaddr, const gdb_byte *myaddr,
@@ -25,6 +25,9 @@
 #include "cli/cli-cmds.h"
 #include "cli/cli-style.h"
 #include "target.h"
+#include "gdbsupport/thread-pool.h"
+#include <atomic>
+#include <chrono>
 
 /* Set/show debuginfod commands.  */
 static cmd_list_element *set_debuginfod_prefix_list;
@@ -51,6 +54,14 @@ static const char *debuginfod_enabled =
 
 static unsigned int debuginfod_verbose = 1;
 
+/* The maximum number of downloads debuginfod_debuginfo_prefetch runs
+   at the same time.  A value below 2 disables prefetching.  */
+static unsigned int debuginfod_parallel_downloads = 8;
+
+/* Whether debuginfod_section_query is allowed to download individual
+   sections.  */
+static bool debuginfod_download_sections = true;
+
 #ifndef HAVE_LIBDEBUGINFOD
 scoped_fd
 debuginfod_source_query (const unsigned char *build_id,
@@ -79,10 +90,27 @@ debuginfod_exec_query (const unsigned char *build_id,
   return scoped_fd (-ENOSYS);
 }
 
+scoped_fd
+debuginfod_section_query (const unsigned char *build_id,
+			  int build_id_len,
+			  const char *filename,
+			  const char *section_name,
+			  gdb::unique_xmalloc_ptr<char> *destname)
+{
+  return scoped_fd (-ENOSYS);
+}
+
+void
+debuginfod_debuginfo_prefetch
+  (gdb::array_view<const bfd_build_id * const> build_ids)
+{
+}
+
 #define NO_IMPL _("Support for debuginfod is not compiled into GDB.")
 
 #else
 #include <elfutils/debuginfod.h>
+#include <elfutils/version.h>
 
 struct user_data
 {
@@ -358,6 +386,149 @@ debuginfod_exec_query (const unsigned char *build_id,
 
   return fd;
 }
+
+/* See debuginfod-support.h  */
+
+scoped_fd
+debuginfod_section_query (const unsigned char *build_id,
+			  int build_id_len,
+			  const char *filename,
+			  const char *section_name,
+			  gdb::unique_xmalloc_ptr<char> *destname)
+{
+  /* debuginfod_find_section appeared in elfutils 0.188.  */
+#if _ELFUTILS_PREREQ (0, 188)
+  if (!debuginfod_download_sections || !debuginfod_is_enabled ())
+    return scoped_fd (-ENOSYS);
+
+  debuginfod_client *c = get_debuginfod_client ();
+
+  if (c == nullptr)
+    return scoped_fd (-ENOMEM);
+
+  char *dname = nullptr;
+  std::string desc = string_printf ("section %s for", section_name);
+  user_data data (desc.c_str (), filename);
+
+  debuginfod_set_user_data (c, &data);
+  gdb::optional<target_terminal::scoped_restore_terminal_state> term_state;
+  if (target_supports_terminal_ours ())
+    {
+      term_state.emplace ();
+      target_terminal::ours ();
+    }
+
+  scoped_fd fd (debuginfod_find_section (c, build_id, build_id_len,
+					 section_name, &dname));
+  debuginfod_set_user_data (c, nullptr);
+
+  /* Failures are not reported, the callers fall back to downloading
+     the whole file.  */
+  if (fd.get () >= 0)
+    destname->reset (dname);
+
+  return fd;
+#else
+  return scoped_fd (-ENOSYS);
+#endif
+}
+
+/* Progress function of the clients used by
+   debuginfod_debuginfo_prefetch.  They run in worker threads, so
+   this can't print anything; it only cancels the download once the
+   user asked for it.  */
+
+static int
+prefetch_progressfn (debuginfod_client *c, long cur, long total)
+{
+  auto *cancelled
+    = static_cast<std::atomic<bool> *> (debuginfod_get_user_data (c));
+
+  return cancelled->load () ? 1 : 0;
+}
+
+/* See debuginfod-support.h  */
+
+void
+debuginfod_debuginfo_prefetch
+  (gdb::array_view<const bfd_build_id * const> build_ids)
+{
+  if (build_ids.size () < 2
+      || debuginfod_parallel_downloads < 2
+      || !debuginfod_is_enabled ())
+    return;
+
+  std::atomic<bool> cancelled (false);
+  std::atomic<size_t> next (0);
+  std::atomic<size_t> done (0);
+
+  /* Each worker uses a client of its own, since a client can only do
+     one query at a time, and takes the next build-id from the list
+     until there is none left.  */
+  auto worker = [&] ()
+    {
+      debuginfod_client_up c (debuginfod_begin ());
+
+      if (c == nullptr)
+	return;
+
+      debuginfod_set_user_data (c.get (), &cancelled);
+      debuginfod_set_progressfn (c.get (), prefetch_progressfn);
+
+      for (size_t i = next++; i < build_ids.size (); i = next++)
+	{
+	  if (cancelled.load ())
+	    break;
+
+	  char *dname = nullptr;
+	  int fd = debuginfod_find_debuginfo (c.get (), build_ids[i]->data,
+					      build_ids[i]->size, &dname);
+	  if (fd >= 0)
+	    close (fd);
+	  free (dname);
+	  done++;
+	}
+    };
+
+  gdb::optional<target_terminal::scoped_restore_terminal_state> term_state;
+  if (target_supports_terminal_ours ())
+    {
+      term_state.emplace ();
+      target_terminal::ours ();
+    }
+
+  gdb_printf (_("Downloading separate debug info for %zu files...\n"),
+	      build_ids.size ());
+
+  {
+    ui_out::progress_meter meter (current_uiout, "", false);
+    size_t n_workers = std::min<size_t> (build_ids.size (),
+					 debuginfod_parallel_downloads);
+    std::vector<gdb::future<void>> results;
+
+    for (size_t i = 0; i < n_workers; i++)
+      results.push_back (gdb::thread_pool::g_thread_pool->post_task
+			   (worker, gdb::task_priority::interactive));
+
+    for (gdb::future<void> &result : results)
+      {
+#if CXX_STD_THREAD
+	while (result.wait_for (std::chrono::milliseconds (100))
+	       != std::future_status::ready)
+	  {
+	    if (!cancelled.load () && check_quit_flag ())
+	      {
+		gdb_printf (_("Cancelling downloads of separate "
+			      "debug info...\n"));
+		cancelled = true;
+	      }
+	    meter.progress ((double) done.load () / build_ids.size ());
+	  }
+#endif
+	result.get ();
+      }
+  }
+}
 #endif
 
 /* Set callback for "set debuginfod enabled".  */
@@ -435,6 +606,30 @@ show_debuginfod_urls (ui_file *file, int from_tty, cmd_list_element *cmd,
 		value);
 }
 
+/* Show callback for "set debuginfod parallel-downloads".  */
+
+static void
+show_debuginfod_parallel_downloads (ui_file *file, int from_tty,
+				    cmd_list_element *cmd, const char *value)
+{
+  gdb_printf (file,
+	      _("The maximum number of parallel debuginfod downloads "
+		"is %s.\n"),
+	      value);
+}
+
+/* Show callback for "set debuginfod download-sections".  */
+
+static void
+show_debuginfod_download_sections (ui_file *file, int from_tty,
+				   cmd_list_element *cmd, const char *value)
+{
+  gdb_printf (file,
+	      _("Downloading individual sections from debuginfod "
+		"is %s.\n"),
+	      value);
+}
+
 /* Show callback for "set debuginfod verbose".  */
 
 static void
@@ -495,4 +690,32 @@ query.\nTo disable, set to zero.  Verbose output is displayed by default."),
 			     show_debuginfod_verbose_command,
 			     &set_debuginfod_prefix_list,
 			     &show_debuginfod_prefix_list);
+
+  /* set/show debuginfod parallel-downloads */
+  add_setshow_zuinteger_cmd ("parallel-downloads", class_support,
+			     &debuginfod_parallel_downloads, _("\
+Set the maximum number of parallel debuginfod downloads."), _("\
+Show the maximum number of parallel debuginfod downloads."), _("\
+When shared libraries are loaded, GDB downloads the missing debug info of \
+all of them\nat once, using up to this many parallel downloads, before \
+reading their symbols.\nWhen set to 0 or 1, debug info is downloaded for \
+each library in turn as its\nsymbols are read."),
+			     nullptr,
+			     show_debuginfod_parallel_downloads,
+			     &set_debuginfod_prefix_list,
+			     &show_debuginfod_prefix_list);
+
+  /* set/show debuginfod download-sections */
+  add_setshow_boolean_cmd ("download-sections", class_support,
+			   &debuginfod_download_sections, _("\
+Set whether debuginfod may download individual sections."), _("\
+Show whether debuginfod may download individual sections."), _("\
+When on, GDB first downloads only the index of the separate debug info of\n\
+a file, and downloads the whole debug info only once a symbol lookup needs\n\
+it.  When off, or when the servers can't provide the index, the whole\n\
+debug info is downloaded as soon as the file is loaded."),
+			   nullptr,
+			   show_debuginfod_download_sections,
+			   &set_debuginfod_prefix_list,
+			   &show_debuginfod_prefix_list);
 }
@@ -20,6 +20,7 @@
 #define DEBUGINFOD_SUPPORT_H
 
 #include "gdbsupport/scoped_fd.h"
+#include "gdbsupport/array-view.h"
 
 /* Query debuginfod servers for a source file associated with an
    executable with BUILD_ID.  BUILD_ID can be given as a binary blob or
@@ -78,4 +79,33 @@ extern scoped_fd debuginfod_exec_query (const unsigned char *build_id,
 					const char *filename,
 					gdb::unique_xmalloc_ptr<char>
 					  *destname);
+
+/* Query debuginfod servers for the section named SECTION_NAME of the
+   separate debug info file with BUILD_ID.  BUILD_ID is as for
+   debuginfod_debuginfo_query, and FILENAME is used for printing
+   messages to the user.
+
+   If the section is successfully retrieved, the path of a local file
+   holding its contents is stored in DESTNAME.  This function returns
+   -ENOSYS if GDB is not built with a libdebuginfod providing section
+   queries, or if they are disabled by the user.  Unlike the other
+   queries, failures are not reported.  */
+
+extern scoped_fd debuginfod_section_query (const unsigned char *build_id,
+					   int build_id_len,
+					   const char *filename,
+					   const char *section_name,
+					   gdb::unique_xmalloc_ptr<char>
+					     *destname);
+
+/* Query debuginfod servers for the debug info files of all the
+   objects with the given BUILD_IDS, several at a time, so that the
+   debuginfod_debuginfo_query calls made later for each of them, one
+   at a time as their symbols are read, find the files in the local
+   debuginfod cache.  Nothing is done if debuginfod is disabled, or
+   has been disabled for parallel downloads.  */
+
+extern void debuginfod_debuginfo_prefetch
+  (gdb::array_view<const bfd_build_id * const> build_ids);
+
 #endif /* DEBUGINFOD_SUPPORT_H */
@@ -98,7 +98,10 @@ enum dict_type
     /* Symbols are stored in a fixed-size array.  */
     DICT_LINEAR,
     /* Symbols are stored in an expandable array.  */
-    DICT_LINEAR_EXPANDABLE
+    DICT_LINEAR_EXPANDABLE,
+    /* Symbols are stored in a fixed-size array, with a hash table
+       indexing it.  */
+    DICT_LINEAR_HASHED
   };
 
 /* The virtual function table.  */
@@ -124,6 +127,10 @@ struct dict_vector
 				     struct dict_iterator *iterator);
   /* A size function, for maint print symtabs.  */
   int (*size) (const struct dictionary *dict);
+  /* Accumulate statistics about the hash table, if any, for maint
+     print statistics.  */
+  void (*add_hash_stats) (const struct dictionary *dict,
+			  struct mdict_hash_stats *stats);
 };
 
 /* Now comes the structs used to store the data for different
@@ -162,6 +169,21 @@ struct dictionary_linear_expandable
   int capacity;
 };
 
+struct dictionary_linear_hashed
+{
+  int nsyms;
+  struct symbol **syms;
+  /* A hash table indexing SYMS.  Each bucket holds the index in SYMS
+     of the first symbol hashing to it, or -1; NEXT chains the
+     following ones, in increasing order.  HASHES holds the full hash
+     of each symbol's search name, so that most symbols in a bucket
+     can be skipped without comparing names.  */
+  int nbuckets;
+  int *buckets;
+  int *next;
+  unsigned int *hashes;
+};
+
 /* And now, the star of our show.  */
 
 struct dictionary
@@ -174,6 +196,7 @@ struct dictionary
     struct dictionary_hashed_expandable hashed_expandable;
     struct dictionary_linear linear;
     struct dictionary_linear_expandable linear_expandable;
+    struct dictionary_linear_hashed linear_hashed;
   }
   data;
 };
@@ -200,6 +223,11 @@ struct dictionary
 #define DICT_LINEAR_EXPANDABLE_CAPACITY(d) \
 		(d)->data.linear_expandable.capacity
 
+#define DICT_LINEAR_HASHED_NBUCKETS(d)	(d)->data.linear_hashed.nbuckets
+#define DICT_LINEAR_HASHED_BUCKETS(d)	(d)->data.linear_hashed.buckets
+#define DICT_LINEAR_HASHED_NEXT(d)	(d)->data.linear_hashed.next
+#define DICT_LINEAR_HASHED_HASHES(d)	(d)->data.linear_hashed.hashes
+
 /* The initial size of a DICT_*_EXPANDABLE dictionary.  */
 
 #define DICT_EXPANDABLE_INITIAL_CAPACITY 10
@@ -209,6 +237,11 @@ struct dictionary
 
 #define DICT_HASHTABLE_SIZE(n)	((n)/5 + 1)
 
+/* Linear dictionaries with at least this many symbols get a hash
+   table indexing them; smaller ones are just searched linearly.  */
+
+#define DICT_LINEAR_HASHED_MIN_SYMS 64
+
 /* Accessor macros for dict_iterators; they're here rather than
    dictionary.h because code elsewhere should treat dict_iterators as
    opaque.  */
@@ -229,6 +262,9 @@ struct dictionary
 static void add_symbol_nonexpandable (struct dictionary *dict,
 				      struct symbol *sym);
 
+static void add_hash_stats_none (const struct dictionary *dict,
+				 struct mdict_hash_stats *stats);
+
 static void free_obstack (struct dictionary *dict);
 
 /* Functions for DICT_HASHED and DICT_HASHED_EXPANDABLE
@@ -250,6 +286,9 @@ static struct symbol *iter_match_next_hashed (const lookup_name_info &name,
 
 static int size_hashed (const struct dictionary *dict);
 
+static void add_hash_stats_hashed (const struct dictionary *dict,
+				   struct mdict_hash_stats *stats);
+
 /* Functions only for DICT_HASHED_EXPANDABLE.  */
 
 static void free_hashed_expandable (struct dictionary *dict);
@@ -276,6 +315,18 @@ static struct symbol *iter_match_next_linear (const lookup_name_info &name,
 
 static int size_linear (const struct dictionary *dict);
 
+/* Functions only for DICT_LINEAR_HASHED.  */
+
+static struct symbol *iter_match_first_linear_hashed
+    (const struct dictionary *dict, const lookup_name_info &name,
+     struct dict_iterator *iterator);
+
+static struct symbol *iter_match_next_linear_hashed
+    (const lookup_name_info &name, struct dict_iterator *iterator);
+
+static void add_hash_stats_linear_hashed (const struct dictionary *dict,
+					  struct mdict_hash_stats *stats);
+
 /* Functions only for DICT_LINEAR_EXPANDABLE.  */
 
 static void free_linear_expandable (struct dictionary *dict);
@@ -295,6 +346,7 @@ static const struct dict_vector dict_hashed_vector =
     iter_match_first_hashed,		/* iter_name_first */
     iter_match_next_hashed,		/* iter_name_next */
     size_hashed,			/* size */
+    add_hash_stats_hashed,		/* add_hash_stats */
   };
 
 static const struct dict_vector dict_hashed_expandable_vector =
@@ -307,6 +359,7 @@ static const struct dict_vector dict_hashed_expandable_vector =
     iter_match_first_hashed,		/* iter_name_first */
     iter_match_next_hashed,		/* iter_name_next */
     size_hashed_expandable,		/* size */
+    add_hash_stats_hashed,		/* add_hash_stats */
   };
 
 static const struct dict_vector dict_linear_vector =
@@ -319,6 +372,7 @@ static const struct dict_vector dict_linear_vector =
     iter_match_first_linear,		/* iter_name_first */
     iter_match_next_linear,		/* iter_name_next */
     size_linear,			/* size */
+    add_hash_stats_none,		/* add_hash_stats */
   };
 
 static const struct dict_vector dict_linear_expandable_vector =
@@ -331,6 +385,20 @@ static const struct dict_vector dict_linear_expandable_vector =
     iter_match_first_linear,		/* iter_name_first */
     iter_match_next_linear,		/* iter_name_next */
     size_linear,			/* size */
+    add_hash_stats_none,		/* add_hash_stats */
+  };
+
+static const struct dict_vector dict_linear_hashed_vector =
+  {
+    DICT_LINEAR_HASHED,			/* type */
+    free_obstack,			/* free */
+    add_symbol_nonexpandable,		/* add_symbol */
+    iterator_first_linear,		/* iterator_first */
+    iterator_next_linear,		/* iterator_next */
+    iter_match_first_linear_hashed,	/* iter_name_first */
+    iter_match_next_linear_hashed,	/* iter_name_next */
+    size_linear,			/* size */
+    add_hash_stats_linear_hashed,	/* add_hash_stats */
   };
 
 /* Declarations of helper functions (i.e. ones that don't go into
@@ -411,6 +479,38 @@ dict_create_linear (struct obstack *obstack,
   for (const auto &sym : symbol_list)
     syms[idx--] = sym;
 
+  /* Index big dictionaries, so that looking up a name doesn't have to
+     compare it against every symbol.  The symbols stay in the array
+     so that iterating over them still preserves their order.  */
+  if (nsyms >= DICT_LINEAR_HASHED_MIN_SYMS)
+    {
+      DICT_VECTOR (retval) = &dict_linear_hashed_vector;
+
+      int nbuckets = nsyms;
+      int *buckets = XOBNEWVEC (obstack, int, nbuckets);
+      int *next = XOBNEWVEC (obstack, int, nsyms);
+      unsigned int *hashes = XOBNEWVEC (obstack, unsigned int, nsyms);
+      std::fill (buckets, buckets + nbuckets, -1);
+
+      /* Insert the symbols backwards, so that each chain ends up in
+	 the same order as the array.  */
+      for (int i = nsyms - 1; i >= 0; --i)
+	{
+	  unsigned int hash = search_name_hash (syms[i]->language (),
+						syms[i]->search_name ());
+	  int bucket = hash % nbuckets;
+
+	  hashes[i] = hash;
+	  next[i] = buckets[bucket];
+	  buckets[bucket] = i;
+	}
+
+      DICT_LINEAR_HASHED_NBUCKETS (retval) = nbuckets;
+      DICT_LINEAR_HASHED_BUCKETS (retval) = buckets;
+      DICT_LINEAR_HASHED_NEXT (retval) = next;
+      DICT_LINEAR_HASHED_HASHES (retval) = hashes;
+    }
+
   return retval;
 }
 
@@ -503,6 +603,13 @@ dict_size (const struct dictionary *dict)
 {
   return (DICT_VECTOR (dict))->size (dict);
 }
+
+static void
+dict_add_hash_stats (const struct dictionary *dict,
+		     struct mdict_hash_stats *stats)
+{
+  (DICT_VECTOR (dict))->add_hash_stats (dict, stats);
+}
  
 /* Now come functions (well, one function, currently) that are
    implemented generically by means of the vtable.  Typically, they're
@@ -526,6 +633,13 @@ add_symbol_nonexpandable (struct dictionary *dict, struct symbol *sym)
 		  _("dict_add_symbol: non-expandable dictionary"));
 }
 
+static void
+add_hash_stats_none (const struct dictionary *dict,
+		     struct mdict_hash_stats *stats)
+{
+  /* Nothing to do.  */
+}
+
 /* Functions for DICT_HASHED and DICT_HASHED_EXPANDABLE.  */
 
 static struct symbol *
@@ -654,6 +768,29 @@ size_hashed (const struct dictionary *dict)
   return DICT_HASHED_NBUCKETS (dict);
 }
 
+static void
+add_hash_stats_hashed (const struct dictionary *dict,
+		       struct mdict_hash_stats *stats)
+{
+  int nbuckets = DICT_HASHED_NBUCKETS (dict);
+
+  stats->n_buckets += nbuckets;
+  for (int i = 0; i < nbuckets; ++i)
+    {
+      size_t chain = 0;
+
+      for (struct symbol *sym = DICT_HASHED_BUCKET (dict, i);
+	   sym != NULL;
+	   sym = sym->hash_next)
+	++chain;
+
+      if (chain > 0)
+	++stats->n_used_buckets;
+      stats->n_symbols += chain;
+      stats->max_chain = std::max (stats->max_chain, chain);
+    }
+}
+
 /* Functions only for DICT_HASHED_EXPANDABLE.  */
 
 static void
@@ -862,6 +999,93 @@ size_linear (const struct dictionary *dict)
   return DICT_LINEAR_NSYMS (dict);
 }
 
+/* Functions only for DICT_LINEAR_HASHED.  */
+
+/* Return the first symbol at or after index I in the hash chain of
+   DICT matching NAME, whose hash is HASH, or NULL.  Store the index
+   of the symbol in ITERATOR.  */
+
+static struct symbol *
+linear_hashed_match_from (const struct dictionary *dict, int i,
+			  const lookup_name_info &name, unsigned int hash,
+			  struct dict_iterator *iterator)
+{
+  const language_defn *lang = DICT_LANGUAGE (dict);
+  symbol_name_matcher_ftype *matches_name
+    = lang->get_symbol_name_matcher (name);
+  const int *next = DICT_LINEAR_HASHED_NEXT (dict);
+  const unsigned int *hashes = DICT_LINEAR_HASHED_HASHES (dict);
+
+  for (; i >= 0; i = next[i])
+    {
+      struct symbol *sym = DICT_LINEAR_SYM (dict, i);
+
+      if (hashes[i] == hash
+	  && matches_name (sym->search_name (), name, NULL))
+	{
+	  DICT_ITERATOR_INDEX (iterator) = i;
+	  return sym;
+	}
+    }
+
+  DICT_ITERATOR_INDEX (iterator) = -1;
+  return NULL;
+}
+
+static struct symbol *
+iter_match_first_linear_hashed (const struct dictionary *dict,
+				const lookup_name_info &name,
+				struct dict_iterator *iterator)
+{
+  const language_defn *lang = DICT_LANGUAGE (dict);
+  unsigned int hash = name.search_name_hash (lang->la_language);
+  int bucket = hash % DICT_LINEAR_HASHED_NBUCKETS (dict);
+
+  DICT_ITERATOR_DICT (iterator) = dict;
+  return linear_hashed_match_from (dict,
+				   DICT_LINEAR_HASHED_BUCKETS (dict)[bucket],
+				   name, hash, iterator);
+}
+
+static struct symbol *
+iter_match_next_linear_hashed (const lookup_name_info &name,
+			       struct dict_iterator *iterator)
+{
+  const struct dictionary *dict = DICT_ITERATOR_DICT (iterator);
+  const language_defn *lang = DICT_LANGUAGE (dict);
+  int i = DICT_ITERATOR_INDEX (iterator);
+
+  if (i < 0)
+    return NULL;
+
+  return linear_hashed_match_from (dict, DICT_LINEAR_HASHED_NEXT (dict)[i],
+				   name,
+				   name.search_name_hash (lang->la_language),
+				   iterator);
+}
+
+static void
+add_hash_stats_linear_hashed (const struct dictionary *dict,
+			      struct mdict_hash_stats *stats)
+{
+  int nbuckets = DICT_LINEAR_HASHED_NBUCKETS (dict);
+  const int *next = DICT_LINEAR_HASHED_NEXT (dict);
+
+  stats->n_buckets += nbuckets;
+  for (int b = 0; b < nbuckets; ++b)
+    {
+      size_t chain = 0;
+
+      for (int i = DICT_LINEAR_HASHED_BUCKETS (dict)[b]; i >= 0; i = next[i])
+	++chain;
+
+      if (chain > 0)
+	++stats->n_used_buckets;
+      stats->n_symbols += chain;
+      stats->max_chain = std::max (stats->max_chain, chain);
+    }
+}
+
 /* Functions only for DICT_LINEAR_EXPANDABLE.  */
 
 static void
@@ -1050,6 +1274,7 @@ mdict_free (struct multidictionary *mdict)
     {
     case DICT_HASHED:
     case DICT_LINEAR:
+    case DICT_LINEAR_HASHED:
       /* Memory was allocated on an obstack when created.  */
       break;
 
@@ -1280,3 +1505,13 @@ mdict_size (const struct multidictionary *mdict)
 
   return size;
 }
+
+/* See dictionary.h.  */
+
+void
+mdict_add_hash_stats (const struct multidictionary *mdict,
+		      struct mdict_hash_stats *stats)
+{
+  for (unsigned short idx = 0; idx < mdict->n_allocated_dictionaries; ++idx)
+    dict_add_hash_stats (mdict->dictionaries[idx], stats);
+}
@@ -164,6 +164,28 @@ extern struct symbol *mdict_iter_match_next (const lookup_name_info &name,
 
 extern int mdict_size (const struct multidictionary *mdict);
 
+/* Statistics about the hash tables of multidictionaries, for "maint
+   print statistics".  */
+
+struct mdict_hash_stats
+{
+  /* The number of hash buckets, and how many of them are not
+     empty.  */
+  size_t n_buckets = 0;
+  size_t n_used_buckets = 0;
+
+  /* The number of symbols in the hash tables, and the length of the
+     longest hash chain.  */
+  size_t n_symbols = 0;
+  size_t max_chain = 0;
+};
+
+/* Add the statistics about the hash tables of MDICT, if any, to
+   STATS.  */
+
+extern void mdict_add_hash_stats (const struct multidictionary *mdict,
+				  struct mdict_hash_stats *stats);
+
 /* Macro to loop through all symbols in a dictionary DICT, in no
    particular order.  ITER is a struct dict_iterator (NOTE: __not__ a
    struct dict_iterator *), and SYM points to the current symbol.
@@ -860,12 +860,18 @@ gdb_disassemble_info::~gdb_disassemble_info ()
    instruction being disassembled, and INFO is the libopcodes disassembler
    related information.  */
 
+/* Set by gdb_print_insn_1 to true if an extension language disassembled
+   the last instruction, and to false if libopcodes did.  */
+
+static bool last_insn_from_ext_lang = false;
+
 static int
 gdb_print_insn_1 (struct gdbarch *gdbarch, CORE_ADDR vma,
 		  struct disassemble_info *info)
 {
   /* Call into the extension languages to do the disassembly.  */
   gdb::optional<int> length = ext_lang_print_insn (gdbarch, vma, info);
+  last_insn_from_ext_lang = length.has_value ();
   if (length.has_value ())
     return *length;
 
@@ -874,6 +880,28 @@ gdb_print_insn_1 (struct gdbarch *gdbarch, CORE_ADDR vma,
   return gdbarch_print_insn (gdbarch, vma, info);
 }
 
+/* Like gdb_print_insn_1, but only work out the length of the
+   instruction at VMA.  If libopcodes has a decoder for GDBARCH that
+   skips formatting the instruction, use that.  */
+
+static int
+gdb_insn_length_1 (struct gdbarch *gdbarch, CORE_ADDR vma,
+		   struct disassemble_info *info)
+{
+  gdb::optional<int> length = ext_lang_print_insn (gdbarch, vma, info);
+  last_insn_from_ext_lang = length.has_value ();
+  if (length.has_value ())
+    return *length;
+
+  disassembler_ftype length_insn
+    = disassembler_length (info->arch, info->endian == BFD_ENDIAN_BIG,
+			   info->mach, nullptr);
+  if (length_insn != nullptr)
+    return length_insn (vma, info);
+
+  return gdbarch_print_insn (gdbarch, vma, info);
+}
+
 /* See disasm.h.  */
 
 bool gdb_disassembler::use_ext_lang_colorization_p = true;
@@ -994,13 +1022,82 @@ gdb_print_insn (struct gdbarch *gdbarch, CORE_ADDR memaddr,
   return di.print_insn (memaddr, branch_delay_insns);
 }
 
+/* Callers such as "x/-Ni", the TUI and the btrace code ask for the
+   length of the same instructions over and over again.  Decoding an
+   instruction means setting up a fresh disassembler, so remember the
+   lengths of recently seen instructions together with their bytes.  An
+   entry is only used if the bytes in target memory are still the same,
+   so there is no need to flush the cache when memory changes.
+
+   On some architectures the length also depends on state that isn't
+   part of the key, such as mapping symbols or settings that select an
+   instruction set (ARM/Thumb, MIPS16, microMIPS), so the cache is only
+   used where gdbarch_insn_length_cacheable says it is safe.  */
+
+#define INSN_LENGTH_CACHE_SIZE 256
+#define INSN_LENGTH_CACHE_MAX_BYTES 16
+
+struct insn_length_cache_entry
+{
+  struct gdbarch *gdbarch;
+  CORE_ADDR addr;
+  int length;
+  gdb_byte bytes[INSN_LENGTH_CACHE_MAX_BYTES];
+};
+
+static insn_length_cache_entry insn_length_cache[INSN_LENGTH_CACHE_SIZE];
+
+/* The disassembler options the entries in INSN_LENGTH_CACHE were
+   decoded with.  */
+
+static std::string insn_length_cache_options;
+
 /* Return the length in bytes of the instruction at address MEMADDR in
    debugged memory.  */
 
 int
 gdb_insn_length (struct gdbarch *gdbarch, CORE_ADDR addr)
 {
-  return gdb_print_insn (gdbarch, addr, &null_stream, NULL);
+  if (!gdbarch_insn_length_cacheable (gdbarch))
+    return gdb_print_insn (gdbarch, addr, &null_stream, NULL);
+
+  std::string options = get_all_disassembler_options (gdbarch);
+  if (options != insn_length_cache_options)
+    {
+      for (insn_length_cache_entry &entry : insn_length_cache)
+	entry.gdbarch = nullptr;
+      insn_length_cache_options = std::move (options);
+    }
+
+  insn_length_cache_entry &entry
+    = insn_length_cache[addr % INSN_LENGTH_CACHE_SIZE];
+  gdb_byte bytes[INSN_LENGTH_CACHE_MAX_BYTES];
+
+  if (entry.gdbarch == gdbarch && entry.addr == addr
+      && target_read_code (addr, bytes, entry.length) == 0
+      && memcmp (bytes, entry.bytes, entry.length) == 0)
+    return entry.length;
+
+  gdb_non_printing_memory_disassembler dis (gdbarch);
+  int length = gdb_insn_length_1 (gdbarch, addr, dis.disasm_info ());
+
+  /* Let gdb_print_insn report any error.  */
+  if (length < 0)
+    length = gdb_print_insn (gdbarch, addr, &null_stream, NULL);
+
+  /* Extension languages may disassemble however they like, so only
+     remember what libopcodes decoded.  */
+  entry.gdbarch = nullptr;
+  if (!last_insn_from_ext_lang
+      && length > 0 && length <= INSN_LENGTH_CACHE_MAX_BYTES
+      && target_read_code (addr, entry.bytes, length) == 0)
+    {
+      entry.gdbarch = gdbarch;
+      entry.addr = addr;
+      entry.length = length;
+    }
+
+  return length;
 }
 
 /* See disasm.h.  */
@@ -1054,7 +1151,7 @@ gdb_buffered_insn_length (struct gdbarch *gdbarch,
   gdb::array_view<const gdb_byte> buffer
     = gdb::make_array_view (insn, max_len);
   gdb_non_printing_buffer_disassembler dis (gdbarch, buffer, addr);
-  int result = gdb_print_insn_1 (gdbarch, addr, dis.disasm_info ());
+  int result = gdb_insn_length_1 (gdbarch, addr, dis.disasm_info ());
   return result;
 }
 
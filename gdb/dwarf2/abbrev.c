@@ -29,6 +29,10 @@
 #include "dwarf2/abbrev.h"
 #include "dwarf2/leb.h"
 #include "bfd.h"
+#include "leb128.h"
+#if CXX_STD_THREAD
+#include <mutex>
+#endif
 
 /* Hash function for an abbrev.  */
 
@@ -58,10 +62,8 @@ eq_abbrev (const void *lhs, const void *rhs)
    dies from a section we read in all abbreviations and install them
    in a hash table.  */
 
-abbrev_table::abbrev_table (sect_offset off, struct dwarf2_section_info *sect)
-  : sect_off (off),
-    section (sect),
-    m_abbrevs (htab_create_alloc (20, hash_abbrev, eq_abbrev,
+abbrev_table_contents::abbrev_table_contents ()
+  : m_abbrevs (htab_create_alloc (20, hash_abbrev, eq_abbrev,
 				  nullptr, xcalloc, xfree))
 {
 }
@@ -69,7 +71,7 @@ abbrev_table::abbrev_table (sect_offset off, struct dwarf2_section_info *sect)
 /* Add an abbreviation to the table.  */
 
 void
-abbrev_table::add_abbrev (struct abbrev_info *abbrev)
+abbrev_table_contents::add_abbrev (struct abbrev_info *abbrev)
 {
   void **slot = htab_find_slot_with_hash (m_abbrevs.get (), abbrev,
 					  abbrev->number, INSERT);
@@ -114,22 +116,14 @@ tag_interesting_for_index (dwarf_tag tag)
   return false;
 }
 
-/* Read in an abbrev table.  */
+/* Parse the abbrev table starting at ABBREV_PTR into CONTENTS.  */
 
-abbrev_table_up
-abbrev_table::read (struct dwarf2_section_info *section,
-		    sect_offset sect_off)
+static void
+read_abbrev_contents (bfd *abfd, const gdb_byte *abbrev_ptr,
+		      abbrev_table_contents *contents)
 {
-  bfd *abfd = section->get_bfd_owner ();
-  const gdb_byte *abbrev_ptr;
   struct abbrev_info *cur_abbrev;
-
-  abbrev_table_up abbrev_table (new struct abbrev_table (sect_off, section));
-  struct obstack *obstack = &abbrev_table->m_abbrev_obstack;
-
-  /* Caller must ensure this.  */
-  gdb_assert (section->readin);
-  abbrev_ptr = section->buffer + to_underlying (sect_off);
+  struct obstack *obstack = &contents->m_abbrev_obstack;
 
   while (true)
     {
@@ -313,8 +307,210 @@ abbrev_table::read (struct dwarf2_section_info *section,
       cur_abbrev->size_if_constant = is_csize ? size : 0;
       cur_abbrev->sibling_offset = sibling_offset;
 
-      abbrev_table->add_abbrev (cur_abbrev);
+      contents->add_abbrev (cur_abbrev);
+    }
+}
+
+/* Return the length in bytes of the abbrev table starting at START,
+   including the terminating zero code.  Return 0 if the table is not
+   properly terminated before END.  */
+
+static size_t
+abbrev_table_length (const gdb_byte *start, const gdb_byte *end)
+{
+  const gdb_byte *ptr = start;
+  uint64_t value;
+  unsigned int len;
+
+  while (true)
+    {
+      /* The abbrev code.  */
+      len = read_uleb128_to_uint64 (ptr, end, &value);
+      if (len == 0)
+	return 0;
+      ptr += len;
+      if (value == 0)
+	break;
+
+      /* The tag and the children byte.  */
+      len = skip_leb128 (ptr, end);
+      if (len == 0 || ptr + len >= end)
+	return 0;
+      ptr += len + 1;
+
+      /* The attribute specifications.  */
+      while (true)
+	{
+	  uint64_t name, form;
+
+	  len = read_uleb128_to_uint64 (ptr, end, &name);
+	  if (len == 0)
+	    return 0;
+	  ptr += len;
+	  len = read_uleb128_to_uint64 (ptr, end, &form);
+	  if (len == 0)
+	    return 0;
+	  ptr += len;
+	  if (form == DW_FORM_implicit_const)
+	    {
+	      len = skip_leb128 (ptr, end);
+	      if (len == 0)
+		return 0;
+	      ptr += len;
+	    }
+	  if (name == 0)
+	    break;
+	}
+    }
+
+  return ptr - start;
+}
+
+/* Hash function for the table of shared abbrev table contents.  */
+
+static hashval_t
+hash_abbrev_contents (const void *item)
+{
+  const abbrev_table_contents *contents
+    = (const abbrev_table_contents *) item;
+  return contents->m_hash;
+}
+
+/* Equality function for the table of shared abbrev table contents.  */
+
+static int
+eq_abbrev_contents (const void *lhs, const void *rhs)
+{
+  const abbrev_table_contents *l = (const abbrev_table_contents *) lhs;
+  const abbrev_table_contents *r = (const abbrev_table_contents *) rhs;
+  return (l->m_bytes.size () == r->m_bytes.size ()
+	  && memcmp (l->m_bytes.data (), r->m_bytes.data (),
+		     l->m_bytes.size ()) == 0);
+}
+
+/* All the abbrev table contents that are currently shared, keyed by
+   their bytes.  The table does not own its elements; an element is
+   removed when the last reference to it goes away.  */
+
+static htab_t shared_abbrev_contents;
+
+#if CXX_STD_THREAD
+/* Lock for SHARED_ABBREV_CONTENTS.  Abbrev tables are read from the
+   worker threads of the DWARF indexer.  */
+static std::mutex shared_abbrev_contents_lock;
+#endif
+
+/* Deleter for shared abbrev table contents.  */
+
+static void
+release_abbrev_contents (abbrev_table_contents *contents)
+{
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (shared_abbrev_contents_lock);
+#endif
+    void **slot = htab_find_slot_with_hash (shared_abbrev_contents, contents,
+					    contents->m_hash, NO_INSERT);
+    /* The slot may already have been taken over by a new object, if
+       this one was looked up while it was being released.  */
+    if (slot != nullptr && *slot == contents)
+      htab_clear_slot (shared_abbrev_contents, slot);
+  }
+
+  delete contents;
+}
+
+/* Look for shared contents whose bytes are the same as SEARCH's.
+   If found, return a new reference to them.  If not found and
+   INSERT is true, make SEARCH itself the shared instance.  Return
+   null otherwise.  */
+
+static std::shared_ptr<const abbrev_table_contents>
+find_shared_abbrev_contents (abbrev_table_contents *search, bool insert)
+{
+#if CXX_STD_THREAD
+  std::lock_guard<std::mutex> guard (shared_abbrev_contents_lock);
+#endif
+
+  if (shared_abbrev_contents == nullptr)
+    shared_abbrev_contents = htab_create_alloc (20, hash_abbrev_contents,
+						eq_abbrev_contents,
+						nullptr, xcalloc, xfree);
+
+  void **slot = htab_find_slot_with_hash (shared_abbrev_contents, search,
+					  search->m_hash,
+					  insert ? INSERT : NO_INSERT);
+  if (slot != nullptr && *slot != nullptr)
+    {
+      abbrev_table_contents *found = (abbrev_table_contents *) *slot;
+      std::shared_ptr<const abbrev_table_contents> result
+	= found->m_self.lock ();
+      /* An expired reference means FOUND is just being released;
+	 in that case SEARCH replaces it.  */
+      if (result != nullptr || !insert)
+	return result;
+    }
+
+  if (!insert)
+    return nullptr;
+
+  std::shared_ptr<abbrev_table_contents> result (search,
+						 release_abbrev_contents);
+  search->m_self = result;
+  *slot = search;
+  return result;
+}
+
+/* Read in an abbrev table.  */
+
+abbrev_table_up
+abbrev_table::read (struct dwarf2_section_info *section,
+		    sect_offset sect_off)
+{
+  bfd *abfd = section->get_bfd_owner ();
+
+  /* Caller must ensure this.  */
+  gdb_assert (section->readin);
+  const gdb_byte *abbrev_ptr = section->buffer + to_underlying (sect_off);
+  const gdb_byte *end = section->buffer + section->size;
+
+  size_t length = 0;
+  if (abbrev_ptr < end)
+    length = abbrev_table_length (abbrev_ptr, end);
+
+  std::shared_ptr<const abbrev_table_contents> contents;
+  if (length == 0)
+    {
+      /* A malformed table is never shared.  */
+      abbrev_table_contents *unshared = new abbrev_table_contents;
+      contents.reset (unshared);
+      read_abbrev_contents (abfd, abbrev_ptr, unshared);
+    }
+  else
+    {
+      std::unique_ptr<abbrev_table_contents> search
+	(new abbrev_table_contents);
+      search->m_hash = fast_hash (abbrev_ptr, length);
+      search->m_bytes
+	= gdb::array_view<const gdb_byte> (abbrev_ptr, length);
+
+      contents = find_shared_abbrev_contents (search.get (), false);
+      if (contents == nullptr)
+	{
+	  /* Parse outside of the lock; if another thread gets there
+	     first, its result is used and ours is discarded.  */
+	  read_abbrev_contents (abfd, abbrev_ptr, search.get ());
+	  search->m_bytes
+	    = gdb::array_view<const gdb_byte>
+		((const gdb_byte *) obstack_copy (&search->m_abbrev_obstack,
+						  abbrev_ptr, length),
+		 length);
+	  contents = find_shared_abbrev_contents (search.get (), true);
+	  if (contents.get () == search.get ())
+	    search.release ();
+	}
     }
 
-  return abbrev_table;
+  return abbrev_table_up (new abbrev_table (sect_off, section,
+					    std::move (contents)));
 }
@@ -28,6 +28,8 @@
 #define GDB_DWARF2_ABBREV_H
 
 #include "hashtab.h"
+#include "gdbsupport/array-view.h"
+#include <memory>
 
 struct attr_abbrev
 {
@@ -60,16 +62,18 @@ struct abbrev_info
 struct abbrev_table;
 typedef std::unique_ptr<struct abbrev_table> abbrev_table_up;
 
-/* Top level data structure to contain an abbreviation table.  */
+/* The parsed contents of an abbreviation table.  These depend only
+   on the bytes of the table, so that identical tables -- which are
+   very common when many compilation units or DWO files were produced
+   by the same compiler -- can share a single instance, even across
+   objfiles.  Instances are reference counted and are only ever
+   created by abbrev_table::read.  */
 
-struct abbrev_table
+struct abbrev_table_contents
 {
-  /* Read an abbrev table from the indicated section, at the given
-     offset.  The caller is responsible for ensuring that the section
-     has already been read.  */
+  abbrev_table_contents ();
 
-  static abbrev_table_up read (struct dwarf2_section_info *section,
-			       sect_offset sect_off);
+  DISABLE_COPY_AND_ASSIGN (abbrev_table_contents);
 
   /* Look up an abbrev in the table.
      Returns NULL if the abbrev is not found.  */
@@ -84,6 +88,44 @@ struct abbrev_table
 						       abbrev_number);
   }
 
+  /* Add an abbreviation to the table.  */
+  void add_abbrev (struct abbrev_info *abbrev);
+
+  /* Hash table of abbrevs.  */
+  htab_up m_abbrevs;
+
+  /* Storage for the abbrev table.  */
+  auto_obstack m_abbrev_obstack;
+
+  /* If this instance is shared, the raw bytes of the table (a copy
+     held on M_ABBREV_OBSTACK), their hash, and a weak reference to
+     this object; these are used by the table of shared contents.
+     Otherwise, M_BYTES is empty.  */
+  gdb::array_view<const gdb_byte> m_bytes;
+  hashval_t m_hash = 0;
+  std::weak_ptr<const abbrev_table_contents> m_self;
+};
+
+/* Top level data structure to contain an abbreviation table.  */
+
+struct abbrev_table
+{
+  /* Read an abbrev table from the indicated section, at the given
+     offset.  The caller is responsible for ensuring that the section
+     has already been read.  If an identical table has already been
+     read, from this or any other section, its contents are shared.  */
+
+  static abbrev_table_up read (struct dwarf2_section_info *section,
+			       sect_offset sect_off);
+
+  /* Look up an abbrev in the table.
+     Returns NULL if the abbrev is not found.  */
+
+  const struct abbrev_info *lookup_abbrev (unsigned int abbrev_number) const
+  {
+    return m_contents->lookup_abbrev (abbrev_number);
+  }
+
   /* Where the abbrev table came from.
      This is used as a sanity check when the table is used.  */
   const sect_offset sect_off;
@@ -92,18 +134,18 @@ struct abbrev_table
 
 private:
 
-  abbrev_table (sect_offset off, struct dwarf2_section_info *sect);
+  abbrev_table (sect_offset off, struct dwarf2_section_info *sect,
+		std::shared_ptr<const abbrev_table_contents> contents)
+    : sect_off (off),
+      section (sect),
+      m_contents (std::move (contents))
+  {
+  }
 
   DISABLE_COPY_AND_ASSIGN (abbrev_table);
 
-  /* Add an abbreviation to the table.  */
-  void add_abbrev (struct abbrev_info *abbrev);
-
-  /* Hash table of abbrevs.  */
-  htab_up m_abbrevs;
-
-  /* Storage for the abbrev table.  */
-  auto_obstack m_abbrev_obstack;
+  /* The abbrevs themselves, possibly shared with other tables.  */
+  std::shared_ptr<const abbrev_table_contents> m_contents;
 };
 
 #endif /* GDB_DWARF2_ABBREV_H */
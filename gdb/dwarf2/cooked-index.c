@@ -24,6 +24,7 @@
 #include "ada-lang.h"
 #include "split-name.h"
 #include <algorithm>
+#include <unordered_map>
 
 /* Hash function for cooked_index_entry.  */
 
@@ -117,9 +118,15 @@ cooked_index::add (sect_offset die_offset, enum dwarf_tag tag,
 void
 cooked_index::finalize ()
 {
+  if (m_finalize_started)
+    return;
+  m_finalize_started = true;
+
   m_future = gdb::thread_pool::g_thread_pool->post_task ([this] ()
     {
-      do_finalize ();
+      if (!m_from_cache)
+	do_finalize ();
+      build_wild_index ();
     });
 }
 
@@ -251,6 +258,77 @@ cooked_index::do_finalize ()
 
 /* See cooked-index.h.  */
 
+void
+cooked_index::build_wild_index ()
+{
+  for (cooked_index_entry *entry : m_entries)
+    {
+      if (entry->parent_entry != nullptr)
+	continue;
+
+      /* Only a name with a "__" separator, an "_ada_" prefix or a
+	 suffix such as ".N" or "$N" can decode to something else.  */
+      const char *name = entry->canonical;
+      if (strpbrk (name, "_.$") == nullptr)
+	continue;
+
+      std::string decoded = ada_decode (name, false, false);
+      if (decoded.empty ())
+	continue;
+      std::vector<gdb::string_view> names = split_name (decoded.c_str (),
+							split_style::DOT);
+      gdb::string_view tail = names.back ();
+      if (tail.length () == strlen (name)
+	  && strncasecmp (tail.data (), name, tail.length ()) == 0)
+	continue;
+
+      m_wild_entries.emplace_back (obstack_strndup (&m_storage, tail.data (),
+						    tail.length ()),
+				   entry);
+    }
+
+  m_wild_entries.shrink_to_fit ();
+  std::sort (m_wild_entries.begin (), m_wild_entries.end (),
+	     [] (const std::pair<const char *, cooked_index_entry *> &a,
+		 const std::pair<const char *, cooked_index_entry *> &b)
+	     {
+	       return strcasecmp (a.first, b.first) < 0;
+	     });
+}
+
+/* See cooked-index.h.  */
+
+void
+cooked_index::find_wild (gdb::string_view tail,
+			 std::vector<const cooked_index_entry *> *result)
+{
+  for (const cooked_index_entry *entry : find (tail, false))
+    if (entry->parent_entry == nullptr)
+      result->push_back (entry);
+
+  auto lower = std::lower_bound (m_wild_entries.begin (),
+				 m_wild_entries.end (), tail,
+				 [] (const std::pair<const char *,
+						     cooked_index_entry *> &e,
+				     const gdb::string_view &n)
+  {
+    int cmp = strncasecmp (e.first, n.data (), n.length ());
+    if (cmp != 0)
+      return cmp < 0;
+    return strlen (e.first) < n.length ();
+  });
+
+  for (auto iter = lower; iter != m_wild_entries.end (); ++iter)
+    {
+      if (strlen (iter->first) != tail.length ()
+	  || strncasecmp (iter->first, tail.data (), tail.length ()) != 0)
+	break;
+      result->push_back (iter->second);
+    }
+}
+
+/* See cooked-index.h.  */
+
 cooked_index::range
 cooked_index::find (gdb::string_view name, bool completing)
 {
@@ -327,6 +405,17 @@ cooked_index_vector::find (gdb::string_view name, bool completing)
 
 /* See cooked-index.h.  */
 
+std::vector<const cooked_index_entry *>
+cooked_index_vector::find_wild (gdb::string_view tail)
+{
+  std::vector<const cooked_index_entry *> result;
+  for (auto &entry : m_vector)
+    entry->find_wild (tail, &result);
+  return result;
+}
+
+/* See cooked-index.h.  */
+
 const cooked_index_entry *
 cooked_index_vector::get_main () const
 {
@@ -344,3 +433,418 @@ cooked_index_vector::get_main () const
 
   return result;
 }
+
+/* The format of a cooked index as stored in the index cache.
+
+   The file starts with a cooked_cache_header.  All the other parts of
+   the file are found using the offsets stored in the header, which
+   are relative to the start of the file and are suitably aligned for
+   the records stored there.  The records are written in host byte
+   order, so that a mapped file can be used directly; a cache written
+   by a host with a different byte order is simply rejected.
+
+   Entries are stored in the order in which they are searched, so no
+   sorting or name canonicalization is needed when reading the index
+   back in.  The entries listed in the index come first, followed by
+   any entries that are only referenced as the parent of another
+   entry.  Names are stored in a table of NUL-terminated strings and
+   are used in place.  */
+
+/* The magic string at the start of a cooked index cache file.  */
+static const char cooked_cache_magic[8] = "GDBCOOK";
+
+/* The current version of the format.  Bump this when changing it.  */
+#define COOKED_CACHE_VERSION 1
+
+/* Marker used to indicate that there is no index for a given
+   reference.  */
+#define COOKED_CACHE_NONE ((uint32_t) -1)
+
+struct cooked_cache_header
+{
+  char magic[8];
+  uint32_t version;
+  /* This is always 1 in the writer's byte order.  */
+  uint32_t byte_order;
+
+  uint32_t n_units;
+  uint32_t n_entries;
+  uint32_t n_parents;
+  uint32_t n_ranges;
+  /* The index of the "main" entry, or COOKED_CACHE_NONE.  */
+  uint32_t main_entry;
+  /* Offset in the string table of the dwz file's build-id, or
+     COOKED_CACHE_NONE.  */
+  uint32_t dwz_build_id;
+
+  uint64_t units_offset;
+  uint64_t entries_offset;
+  uint64_t ranges_offset;
+  uint64_t strings_offset;
+  uint64_t strings_size;
+};
+
+/* A unit, in the order of dwarf2_per_bfd::all_comp_units.  This is
+   used to check that the cache still matches the objfile, and to
+   restore the per-unit state computed by the indexer.  */
+
+struct cooked_cache_unit
+{
+  uint64_t sect_off;
+  uint32_t length;
+  uint8_t is_dwz;
+  uint8_t is_debug_types;
+  uint8_t lang;
+  uint8_t unit_type;
+};
+
+/* A single cooked_index_entry.  */
+
+struct cooked_cache_entry
+{
+  uint64_t die_offset;
+  uint32_t name;
+  uint32_t canonical;
+  uint32_t parent;
+  uint32_t unit;
+  uint16_t tag;
+  uint8_t flags;
+  uint8_t padding[5];
+};
+
+/* A transition in the address map.  Addresses from START up to the
+   start of the next range (or the end of the address space) map to
+   UNIT, which may be COOKED_CACHE_NONE.  */
+
+struct cooked_cache_range
+{
+  uint64_t start;
+  uint32_t unit;
+  uint32_t padding;
+};
+
+/* Append the bytes of OBJ to OUT.  */
+
+template<typename T>
+static void
+cooked_cache_append (std::vector<gdb_byte> *out, const T &obj)
+{
+  const gdb_byte *bytes = (const gdb_byte *) &obj;
+  out->insert (out->end (), bytes, bytes + sizeof (T));
+}
+
+/* Pad OUT to a multiple of 8 bytes.  */
+
+static void
+cooked_cache_align (std::vector<gdb_byte> *out)
+{
+  out->resize ((out->size () + 7) & ~(size_t) 7);
+}
+
+/* See cooked-index.h.  */
+
+void
+cooked_index_vector::write_cache (std::vector<gdb_byte> *out,
+				  dwarf2_per_bfd *per_bfd,
+				  const char *dwz_build_id)
+{
+  /* Merge the entries of all the shards, in search order.  */
+  std::vector<const cooked_index_entry *> entries;
+  for (const cooked_index_entry *entry : all_entries ())
+    entries.push_back (entry);
+  std::stable_sort (entries.begin (), entries.end (),
+		    [] (const cooked_index_entry *a,
+			const cooked_index_entry *b)
+		    {
+		      return *a < *b;
+		    });
+  size_t n_entries = entries.size ();
+
+  std::unordered_map<const cooked_index_entry *, uint32_t> entry_indices;
+  for (size_t i = 0; i < n_entries; ++i)
+    entry_indices[entries[i]] = i;
+
+  /* Parents are not necessarily listed in the index -- for instance
+     the namespaces synthesized for GNAT entries.  Append these.  */
+  for (size_t i = 0; i < entries.size (); ++i)
+    {
+      const cooked_index_entry *parent = entries[i]->parent_entry;
+      if (parent != nullptr
+	  && entry_indices.emplace (parent, entries.size ()).second)
+	entries.push_back (parent);
+    }
+
+  std::vector<gdb_byte> strings;
+  std::unordered_map<const char *, uint32_t> string_indices;
+  auto add_string = [&] (const char *str)
+    {
+      auto iter = string_indices.emplace (str, strings.size ());
+      if (iter.second)
+	strings.insert (strings.end (), str, str + strlen (str) + 1);
+      return iter.first->second;
+    };
+
+  /* The address maps of the shards are searched in order.  Build a
+     combined map with the same behavior.  */
+  addrmap_mutable combined;
+  for (auto &index : m_vector)
+    {
+      std::vector<std::pair<CORE_ADDR, void *>> transitions;
+      index->m_addrmap->foreach ([&] (CORE_ADDR start, void *obj)
+	{
+	  transitions.emplace_back (start, obj);
+	  return 0;
+	});
+      for (size_t i = 0; i < transitions.size (); ++i)
+	{
+	  if (transitions[i].second == nullptr)
+	    continue;
+	  CORE_ADDR end = (i + 1 < transitions.size ()
+			   ? transitions[i + 1].first - 1
+			   : (CORE_ADDR) -1);
+	  combined.set_empty (transitions[i].first, end,
+			      transitions[i].second);
+	}
+    }
+
+  std::vector<cooked_cache_range> ranges;
+  combined.foreach ([&] (CORE_ADDR start, void *obj)
+    {
+      cooked_cache_range range {};
+      range.start = start;
+      range.unit = (obj == nullptr
+		    ? COOKED_CACHE_NONE
+		    : ((dwarf2_per_cu_data *) obj)->index);
+      ranges.push_back (range);
+      return 0;
+    });
+
+  cooked_cache_header header {};
+  memcpy (header.magic, cooked_cache_magic, sizeof (header.magic));
+  header.version = COOKED_CACHE_VERSION;
+  header.byte_order = 1;
+  header.n_entries = n_entries;
+  header.n_parents = entries.size () - n_entries;
+  header.n_ranges = ranges.size ();
+  header.dwz_build_id = (dwz_build_id == nullptr
+			 ? COOKED_CACHE_NONE
+			 : add_string (dwz_build_id));
+
+  const cooked_index_entry *main_entry = get_main ();
+  header.main_entry = (main_entry == nullptr
+		       ? COOKED_CACHE_NONE
+		       : entry_indices[main_entry]);
+
+  std::vector<cooked_cache_entry> cache_entries;
+  cache_entries.reserve (entries.size ());
+  for (const cooked_index_entry *entry : entries)
+    {
+      cooked_cache_entry item {};
+      item.die_offset = to_underlying (entry->die_offset);
+      item.name = add_string (entry->name);
+      item.canonical = add_string (entry->canonical);
+      item.parent = (entry->parent_entry == nullptr
+		     ? COOKED_CACHE_NONE
+		     : entry_indices[entry->parent_entry]);
+      item.unit = entry->per_cu->index;
+      item.tag = entry->tag;
+      item.flags = entry->flags;
+      cache_entries.push_back (item);
+    }
+
+  out->clear ();
+  cooked_cache_append (out, header);
+
+  cooked_cache_align (out);
+  header.units_offset = out->size ();
+  header.n_units = per_bfd->all_comp_units.size ();
+  for (const auto &per_cu : per_bfd->all_comp_units)
+    {
+      cooked_cache_unit unit {};
+      unit.sect_off = to_underlying (per_cu->sect_off);
+      unit.length = per_cu->length;
+      unit.is_dwz = per_cu->is_dwz;
+      unit.is_debug_types = per_cu->is_debug_types;
+      /* Units that were not scanned may not have a language or
+	 type yet; these are stored as zero.  */
+      unit.lang = per_cu->lang (false);
+      unit.unit_type = per_cu->unit_type (false);
+      cooked_cache_append (out, unit);
+    }
+
+  cooked_cache_align (out);
+  header.entries_offset = out->size ();
+  for (const cooked_cache_entry &item : cache_entries)
+    cooked_cache_append (out, item);
+
+  cooked_cache_align (out);
+  header.ranges_offset = out->size ();
+  for (const cooked_cache_range &range : ranges)
+    cooked_cache_append (out, range);
+
+  header.strings_offset = out->size ();
+  header.strings_size = strings.size ();
+  out->insert (out->end (), strings.begin (), strings.end ());
+
+  memcpy (out->data (), &header, sizeof (header));
+}
+
+/* See cooked-index.h.  */
+
+cooked_index_vector *
+cooked_index_vector::read_cache (gdb::array_view<const gdb_byte> contents,
+				 dwarf2_per_bfd *per_bfd,
+				 const char *dwz_build_id)
+{
+  cooked_cache_header header;
+  if (contents.size () < sizeof (header))
+    return nullptr;
+  memcpy (&header, contents.data (), sizeof (header));
+
+  if (memcmp (header.magic, cooked_cache_magic, sizeof (header.magic)) != 0
+      || header.version != COOKED_CACHE_VERSION
+      || header.byte_order != 1)
+    return nullptr;
+
+  /* Check that each part of the file is in bounds, and aligned so
+     the records can be used in place.  */
+  auto part_ok = [&] (uint64_t offset, uint64_t count, size_t size)
+    {
+      return (offset % 8 == 0
+	      && offset <= contents.size ()
+	      && count <= (contents.size () - offset) / size);
+    };
+  if (!part_ok (header.units_offset, header.n_units,
+		sizeof (cooked_cache_unit))
+      || !part_ok (header.entries_offset,
+		   (uint64_t) header.n_entries + header.n_parents,
+		   sizeof (cooked_cache_entry))
+      || !part_ok (header.ranges_offset, header.n_ranges,
+		   sizeof (cooked_cache_range))
+      || header.strings_offset > contents.size ()
+      || header.strings_size > contents.size () - header.strings_offset)
+    return nullptr;
+
+  const char *strings
+    = (const char *) contents.data () + header.strings_offset;
+  /* Make sure every string is terminated.  */
+  if (header.strings_size > 0 && strings[header.strings_size - 1] != '\0')
+    return nullptr;
+  auto get_string = [&] (uint32_t offset) -> const char *
+    {
+      if (offset >= header.strings_size)
+	return nullptr;
+      return strings + offset;
+    };
+
+  if (header.dwz_build_id == COOKED_CACHE_NONE)
+    {
+      if (dwz_build_id != nullptr)
+	return nullptr;
+    }
+  else
+    {
+      const char *cached_id = get_string (header.dwz_build_id);
+      if (cached_id == nullptr
+	  || dwz_build_id == nullptr
+	  || strcmp (cached_id, dwz_build_id) != 0)
+	return nullptr;
+    }
+
+  /* The units must match exactly, because entries refer to them by
+     index.  */
+  if (header.n_units != per_bfd->all_comp_units.size ())
+    return nullptr;
+  const cooked_cache_unit *units
+    = (const cooked_cache_unit *) (contents.data () + header.units_offset);
+  for (uint32_t i = 0; i < header.n_units; ++i)
+    {
+      dwarf2_per_cu_data *per_cu = per_bfd->all_comp_units[i].get ();
+      if (units[i].sect_off != to_underlying (per_cu->sect_off)
+	  || units[i].length != per_cu->length
+	  || units[i].is_dwz != per_cu->is_dwz
+	  || units[i].is_debug_types != per_cu->is_debug_types
+	  || units[i].lang >= nr_languages)
+	return nullptr;
+    }
+
+  uint32_t n_all = header.n_entries + header.n_parents;
+  const cooked_cache_entry *cache_entries
+    = ((const cooked_cache_entry *)
+       (contents.data () + header.entries_offset));
+  for (uint32_t i = 0; i < n_all; ++i)
+    {
+      const cooked_cache_entry &item = cache_entries[i];
+      if (get_string (item.name) == nullptr
+	  || get_string (item.canonical) == nullptr
+	  || item.unit >= header.n_units
+	  || (item.parent != COOKED_CACHE_NONE && item.parent >= n_all))
+	return nullptr;
+    }
+  if (header.main_entry != COOKED_CACHE_NONE
+      && header.main_entry >= header.n_entries)
+    return nullptr;
+
+  const cooked_cache_range *ranges
+    = ((const cooked_cache_range *)
+       (contents.data () + header.ranges_offset));
+  for (uint32_t i = 0; i < header.n_ranges; ++i)
+    if ((ranges[i].unit != COOKED_CACHE_NONE
+	 && ranges[i].unit >= header.n_units)
+	|| (i > 0 && ranges[i].start <= ranges[i - 1].start))
+      return nullptr;
+
+  /* Everything checks out.  Restore the state computed by the
+     indexer, and then rebuild the index.  */
+  for (uint32_t i = 0; i < header.n_units; ++i)
+    {
+      dwarf2_per_cu_data *per_cu = per_bfd->all_comp_units[i].get ();
+      if (units[i].lang != language_unknown)
+	per_cu->set_lang ((enum language) units[i].lang);
+      if (units[i].unit_type != 0)
+	per_cu->set_unit_type ((dwarf_unit_type) units[i].unit_type);
+    }
+
+  std::unique_ptr<cooked_index> index (new cooked_index);
+  index->m_from_cache = true;
+
+  std::vector<cooked_index_entry *> entries;
+  entries.reserve (n_all);
+  for (uint32_t i = 0; i < n_all; ++i)
+    {
+      const cooked_cache_entry &item = cache_entries[i];
+      dwarf2_per_cu_data *per_cu = per_bfd->all_comp_units[item.unit].get ();
+      cooked_index_entry *entry
+	= index->create ((sect_offset) item.die_offset,
+			 (enum dwarf_tag) item.tag,
+			 (cooked_index_flag_enum) item.flags,
+			 get_string (item.name), nullptr, per_cu);
+      entry->canonical = get_string (item.canonical);
+      entries.push_back (entry);
+    }
+  for (uint32_t i = 0; i < n_all; ++i)
+    if (cache_entries[i].parent != COOKED_CACHE_NONE)
+      entries[i]->parent_entry = entries[cache_entries[i].parent];
+
+  if (header.main_entry != COOKED_CACHE_NONE)
+    index->m_main = entries[header.main_entry];
+  entries.resize (header.n_entries);
+  index->m_entries = std::move (entries);
+
+  addrmap_mutable map;
+  for (uint32_t i = 0; i < header.n_ranges; ++i)
+    {
+      if (ranges[i].unit == COOKED_CACHE_NONE)
+	continue;
+      CORE_ADDR end = (i + 1 < header.n_ranges
+		       ? ranges[i + 1].start - 1
+		       : (CORE_ADDR) -1);
+      map.set_empty (ranges[i].start, end,
+		     per_bfd->all_comp_units[ranges[i].unit].get ());
+    }
+  index->install_addrmap (&map);
+
+  vec_type vec;
+  vec.push_back (std::move (index));
+  return new cooked_index_vector (std::move (vec));
+}
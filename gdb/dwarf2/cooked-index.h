@@ -26,6 +26,7 @@
 #include "hashtab.h"
 #include "dwarf2/index-common.h"
 #include "gdbsupport/gdb_string_view.h"
+#include "gdbsupport/array-view.h"
 #include "quick-symbol.h"
 #include "gdbsupport/gdb_obstack.h"
 #include "addrmap.h"
@@ -36,6 +37,7 @@
 #include "gdbsupport/range-chain.h"
 
 struct dwarf2_per_cu_data;
+struct dwarf2_per_bfd;
 
 /* Flags that describe an entry in the index.  */
 enum cooked_index_flag_enum : unsigned char
@@ -191,9 +193,10 @@ class cooked_index
     m_addrmap = new (&m_storage) addrmap_fixed (&m_storage, map);
   }
 
-  /* Finalize the index.  This should be called a single time, when
-     the index has been fully populated.  It enters all the entries
-     into the internal table.  */
+  /* Finalize the index.  This should be called when the index has
+     been fully populated.  It enters all the entries into the
+     internal table.  The work is done in the background; calls after
+     the first one do nothing.  */
   void finalize ();
 
   /* Wait for this index's finalization to be complete.  */
@@ -219,6 +222,14 @@ class cooked_index
      for completion, will be returned.  */
   range find (gdb::string_view name, bool completing);
 
+  /* Append to RESULT the top-level entries that an Ada wild match of
+     a name whose last component is TAIL may match.  These are the
+     entries whose canonical name is TAIL, and those whose name
+     decodes to something ending in TAIL, for instance "pkg__tail".
+     The caller must still check each entry against the name.  */
+  void find_wild (gdb::string_view tail,
+		  std::vector<const cooked_index_entry *> *result);
+
 private:
 
   /* Return the entry that is believed to represent the program's
@@ -261,6 +272,16 @@ class cooked_index
   /* A helper method that does the work of 'finalize'.  */
   void do_finalize ();
 
+  /* Fill in m_wild_entries.  */
+  void build_wild_index ();
+
+  /* True if this index was read from the index cache.  Such an index
+     is already finalized, so 'finalize' has nothing to do.  */
+  bool m_from_cache = false;
+
+  /* True once 'finalize' has been called.  */
+  bool m_finalize_started = false;
+
   /* Storage for the entries.  */
   auto_obstack m_storage;
   /* List of all entries.  */
@@ -273,6 +294,13 @@ class cooked_index
   addrmap *m_addrmap = nullptr;
   /* Storage for canonical names.  */
   std::vector<gdb::unique_xmalloc_ptr<char>> m_names;
+  /* Top-level entries whose canonical name, when decoded as an Ada
+     name, has a last component that differs from it, paired with that
+     component and sorted by it.  Ada wild matching matches a name by
+     its last component, so together with m_entries this lets a wild
+     match be done with two binary searches instead of matching every
+     entry.  */
+  std::vector<std::pair<const char *, cooked_index_entry *>> m_wild_entries;
   /* A future that tracks when the 'finalize' method is done.  Note
      that the 'get' method is never called on this future, only
      'wait'.  */
@@ -315,6 +343,11 @@ class cooked_index_vector : public dwarf_scanner_base
      for completion, will be returned.  */
   range find (gdb::string_view name, bool completing);
 
+  /* Return the top-level entries that an Ada wild match of a name
+     whose last component is TAIL may match.  See
+     cooked_index::find_wild.  */
+  std::vector<const cooked_index_entry *> find_wild (gdb::string_view tail);
+
   /* Return a range of all the entries.  */
   range all_entries ()
   {
@@ -345,6 +378,21 @@ class cooked_index_vector : public dwarf_scanner_base
 
   quick_symbol_functions_up make_quick_functions () const override;
 
+  /* Serialize this index, which was made for PER_BFD, to OUT, using
+     the format of the index cache.  DWZ_BUILD_ID is the build-id of
+     the associated dwz file, or nullptr if there is none.  */
+  void write_cache (std::vector<gdb_byte> *out, dwarf2_per_bfd *per_bfd,
+		    const char *dwz_build_id);
+
+  /* Create a new index from CONTENTS, which was previously created by
+     write_cache.  The units in PER_BFD must already have been
+     created.  Names in the new index point directly into CONTENTS,
+     so it must outlive the result.  Return nullptr if CONTENTS is
+     malformed, or does not describe PER_BFD and DWZ_BUILD_ID.  */
+  static cooked_index_vector *read_cache
+       (gdb::array_view<const gdb_byte> contents, dwarf2_per_bfd *per_bfd,
+	const char *dwz_build_id);
+
 private:
 
   /* The vector of cooked_index objects.  This is stored because the
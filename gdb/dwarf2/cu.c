@@ -102,35 +102,48 @@ dwarf2_cu::addr_type () const
   return addr_type;
 }
 
+/* The data passed to dwarf2_mark_helper.  */
+
+struct dwarf2_mark_data
+{
+  dwarf2_per_objfile *per_objfile;
+
+  /* The memory used by the CUs marked so far.  */
+  size_t memory_used;
+};
+
 /* A hashtab traversal function that marks the dependent CUs.  */
 
 static int
 dwarf2_mark_helper (void **slot, void *data)
 {
   dwarf2_per_cu_data *per_cu = (dwarf2_per_cu_data *) *slot;
-  dwarf2_per_objfile *per_objfile = (dwarf2_per_objfile *) data;
-  dwarf2_cu *cu = per_objfile->get_cu (per_cu);
+  dwarf2_mark_data *mark_data = (dwarf2_mark_data *) data;
+  dwarf2_cu *cu = mark_data->per_objfile->get_cu (per_cu);
 
   /* cu->m_dependencies references may not yet have been ever read if
      QUIT aborts reading of the chain.  As such dependencies remain
      valid it is not much useful to track and undo them during QUIT
      cleanups.  */
   if (cu != nullptr)
-    cu->mark ();
+    mark_data->memory_used += cu->mark ();
   return 1;
 }
 
 /* See dwarf2/cu.h.  */
 
-void
+size_t
 dwarf2_cu::mark ()
 {
-  if (!m_mark)
-    {
-      m_mark = true;
-      if (m_dependencies != nullptr)
-	htab_traverse (m_dependencies, dwarf2_mark_helper, per_objfile);
-    }
+  if (m_mark)
+    return 0;
+
+  m_mark = true;
+
+  dwarf2_mark_data data { per_objfile, memory_used () };
+  if (m_dependencies != nullptr)
+    htab_traverse (m_dependencies, dwarf2_mark_helper, &data);
+  return data.memory_used;
 }
 
 /* See dwarf2/cu.h.  */
@@ -23,6 +23,19 @@
 #include "buildsym.h"
 #include "dwarf2/comp-unit-head.h"
 #include "gdbsupport/gdb_optional.h"
+#include "gdbsupport/hash-table.h"
+
+struct die_info;
+
+/* Traits for dwarf2_cu::die_hash.  The hash of a DIE is its offset
+   in the section.  These are defined in read.c, the only user of the
+   table.  */
+
+struct die_hash_traits : public gdb::default_hash_table_traits<die_info *>
+{
+  static hashval_t hash (die_info *const &die);
+  static bool equal (die_info *const &die, sect_offset sect_off);
+};
 
 /* Type used for delaying computation of method physnames.
    See comments for compute_delayed_physnames.  */
@@ -78,8 +91,10 @@ struct dwarf2_cu
      the integer is unsigned or not.  */
   struct type *addr_sized_int_type (bool unsigned_p) const;
 
-  /* Mark this CU as used.  */
-  void mark ();
+  /* Mark this CU as used, along with the CUs it depends on.  Return
+     the memory used by the CUs that were not marked yet (see
+     memory_used).  */
+  size_t mark ();
 
   /* Clear the mark on this CU.  */
   void clear_mark ()
@@ -96,6 +111,14 @@ struct dwarf2_cu
   /* Add a dependence relationship from this cu to REF_PER_CU.  */
   void add_dependence (struct dwarf2_per_cu_data *ref_per_cu);
 
+  /* Return an estimate of the memory, in bytes, used by the DIEs and
+     other data that this CU holds while it is cached.  */
+  size_t memory_used () const
+  {
+    return obstack_memory_used (const_cast<auto_obstack *>
+				(&comp_unit_obstack));
+  }
+
   /* The header of the compilation unit.  */
   struct comp_unit_head header {};
 
@@ -148,7 +171,7 @@ struct dwarf2_cu
 
   /* A hash table of DIE cu_offset for following references with
      die_info->offset.sect_off as hash.  */
-  htab_t die_hash = nullptr;
+  gdb::hash_table<die_info *, die_hash_traits> die_hash;
 
   /* Full DIEs if read in.  */
   struct die_info *dies = nullptr;
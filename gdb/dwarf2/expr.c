@@ -771,6 +771,48 @@ dwarf_expr_context::fetch (int n)
   return this->m_stack[this->m_stack.size () - (1 + n)].value;
 }
 
+/* The frame base of the frame that was most recently used by
+   DW_OP_fbreg.  Printing the locals of a frame, for instance with
+   "info locals" or "bt full", evaluates DW_OP_fbreg for each of them;
+   without this, each evaluation would look up the frame's function
+   and re-evaluate its DW_AT_frame_base.  The frame cache generation
+   changes whenever the state of the target does, which invalidates
+   this cache too.  */
+
+struct frame_base_cache
+{
+  frame_info *frame = nullptr;
+  unsigned int generation = 0;
+  CORE_ADDR base = 0;
+};
+
+static frame_base_cache last_frame_base;
+
+/* If the frame base of FRAME is cached, store it in *BASE and return
+   true.  Otherwise return false.  */
+
+static bool
+lookup_frame_base_cache (frame_info *frame, CORE_ADDR *base)
+{
+  if (frame == nullptr
+      || last_frame_base.frame != frame
+      || last_frame_base.generation != get_frame_cache_generation ())
+    return false;
+
+  *base = last_frame_base.base;
+  return true;
+}
+
+/* Record BASE as the frame base of FRAME.  */
+
+static void
+update_frame_base_cache (frame_info *frame, CORE_ADDR base)
+{
+  last_frame_base.frame = frame;
+  last_frame_base.generation = get_frame_cache_generation ();
+  last_frame_base.base = base;
+}
+
 /* See expr.h.  */
 
 void
@@ -1808,33 +1850,39 @@ dwarf_expr_context::execute_stack_op (const gdb_byte *op_ptr,
 
 	    op_ptr = safe_read_sleb128 (op_ptr, op_end, &offset);
 
-	    /* Rather than create a whole new context, we simply
-	       backup the current stack locally and install a new empty stack,
-	       then reset it afterwards, effectively erasing whatever the
-	       recursive call put there.  */
-	    std::vector<dwarf_stack_value> saved_stack = std::move (this->m_stack);
-	    this->m_stack.clear ();
-
-	    /* FIXME: cagney/2003-03-26: This code should be using
-	       get_frame_base_address(), and then implement a dwarf2
-	       specific this_base method.  */
-	    this->get_frame_base (&datastart, &datalen);
-	    eval (datastart, datalen);
-	    if (this->m_location == DWARF_VALUE_MEMORY)
-	      result = fetch_address (0);
-	    else if (this->m_location == DWARF_VALUE_REGISTER)
-	      result
-		= read_addr_from_reg (this->m_frame, value_as_long (fetch (0)));
-	    else
-	      error (_("Not implemented: computing frame "
-		       "base using explicit value operator"));
+	    if (!lookup_frame_base_cache (this->m_frame, &result))
+	      {
+		/* Rather than create a whole new context, we simply
+		   backup the current stack locally and install a new
+		   empty stack, then reset it afterwards, effectively
+		   erasing whatever the recursive call put there.  */
+		std::vector<dwarf_stack_value> saved_stack
+		  = std::move (this->m_stack);
+		this->m_stack.clear ();
+
+		/* FIXME: cagney/2003-03-26: This code should be using
+		   get_frame_base_address(), and then implement a dwarf2
+		   specific this_base method.  */
+		this->get_frame_base (&datastart, &datalen);
+		eval (datastart, datalen);
+		if (this->m_location == DWARF_VALUE_MEMORY)
+		  result = fetch_address (0);
+		else if (this->m_location == DWARF_VALUE_REGISTER)
+		  result = read_addr_from_reg (this->m_frame,
+					       value_as_long (fetch (0)));
+		else
+		  error (_("Not implemented: computing frame "
+			   "base using explicit value operator"));
+
+		/* Restore the content of the original stack.  */
+		this->m_stack = std::move (saved_stack);
+
+		update_frame_base_cache (this->m_frame, result);
+	      }
 	    result = result + offset;
 	    result_val = value_from_ulongest (address_type, result);
 	    in_stack_memory = true;
 
-	    /* Restore the content of the original stack.  */
-	    this->m_stack = std::move (saved_stack);
-
 	    this->m_location = DWARF_VALUE_MEMORY;
 	  }
 	  break;
@@ -33,6 +33,7 @@
 #include "regcache.h"
 #include "value.h"
 #include "record.h"
+#include "observable.h"
 
 #include "complaints.h"
 #include "dwarf2/frame.h"
@@ -42,11 +43,13 @@
 #include "dwarf2/loc.h"
 #include "dwarf2/frame-tailcall.h"
 #include "gdbsupport/gdb_binary_search.h"
+#include "gdbsupport/parallel-for.h"
 #if GDB_SELF_TEST
 #include "gdbsupport/selftest.h"
 #include "selftest-arch.h"
 #endif
 #include <unordered_map>
+#include <unordered_set>
 
 #include <algorithm>
 
@@ -132,6 +135,16 @@ struct dwarf2_fde
 
 typedef std::vector<dwarf2_fde *> dwarf2_fde_table;
 
+/* The address range covered by an FDE.  A vector of these is kept
+   alongside each FDE table, so that the binary search for a PC only
+   has to touch this compact array instead of the FDEs themselves.  */
+
+struct dwarf2_fde_range
+{
+  CORE_ADDR begin;
+  CORE_ADDR end;
+};
+
 /* A minimal decoding of DWARF2 compilation units.  We only decode
    what's needed to get to the call frame information.  */
 
@@ -163,6 +176,10 @@ struct comp_unit
   /* The FDE table.  */
   dwarf2_fde_table fde_table;
 
+  /* The address ranges of the FDEs in FDE_TABLE, in the same
+     order.  */
+  std::vector<dwarf2_fde_range> fde_ranges;
+
   /* Hold data used by this module.  */
   auto_obstack obstack;
 };
@@ -170,6 +187,9 @@ struct comp_unit
 static struct dwarf2_fde *dwarf2_frame_find_fde
   (CORE_ADDR *pc, dwarf2_per_objfile **out_per_objfile);
 
+static void dwarf2_build_frame_info_parallel
+  (gdb::array_view<struct objfile *> objfiles);
+
 static int dwarf2_frame_adjust_regnum (struct gdbarch *gdbarch, int regnum,
 				       int eh_frame_p);
 
@@ -867,6 +887,74 @@ struct dwarf2_frame_cache
   void *tailcall_cache;
 };
 
+/* The result of executing the CFI program of an FDE up to a given
+   PC.  This only depends on the unwind tables, not on the contents
+   of the inferior's registers or memory, so it can be reused across
+   stops, and saves re-decoding the CIE and FDE instructions each time
+   the same frame is unwound again, e.g. for repeated backtraces.  */
+
+struct dwarf2_cfi_row_cache_entry
+{
+  /* The key.  FDE is NULL for an unused entry.  */
+  struct dwarf2_fde *fde = nullptr;
+  struct gdbarch *gdbarch = nullptr;
+  CORE_ADDR pc = 0;
+  bool entry_pc_p = false;
+  CORE_ADDR entry_pc = 0;
+
+  /* The resulting row.  */
+  std::vector<struct dwarf2_frame_state_reg> reg;
+  LONGEST cfa_offset = 0;
+  ULONGEST cfa_reg = 0;
+  enum cfa_how_kind cfa_how = CFA_UNSET;
+  const gdb_byte *cfa_exp = nullptr;
+  CORE_ADDR row_pc = 0;
+  LONGEST entry_cfa_sp_offset = 0;
+  int entry_cfa_sp_offset_p = 0;
+};
+
+/* The number of entries in the CFI row cache.  Must be a power of
+   two.  */
+
+#define DWARF2_CFI_ROW_CACHE_SIZE 256
+
+static dwarf2_cfi_row_cache_entry
+  dwarf2_cfi_row_cache[DWARF2_CFI_ROW_CACHE_SIZE];
+
+/* Return the CFI row cache slot for PC.  */
+
+static dwarf2_cfi_row_cache_entry &
+dwarf2_cfi_row_cache_slot (CORE_ADDR pc)
+{
+  ULONGEST h = pc;
+  h ^= h >> 7;
+  h ^= h >> 17;
+  return dwarf2_cfi_row_cache[h & (DWARF2_CFI_ROW_CACHE_SIZE - 1)];
+}
+
+/* Forget all cached CFI rows.  The FDEs and the CFA expressions the
+   cache points into belong to the objfile, so this must be done
+   whenever an objfile is freed.  */
+
+static void
+dwarf2_cfi_row_cache_clear ()
+{
+  for (dwarf2_cfi_row_cache_entry &entry : dwarf2_cfi_row_cache)
+    {
+      entry.fde = nullptr;
+      entry.gdbarch = nullptr;
+      entry.reg.clear ();
+    }
+}
+
+/* free_objfile observer for the CFI row cache.  */
+
+static void
+dwarf2_cfi_row_cache_free_objfile (struct objfile *objfile)
+{
+  dwarf2_cfi_row_cache_clear ();
+}
+
 static struct dwarf2_frame_cache *
 dwarf2_frame_cache (struct frame_info *this_frame, void **this_cache)
 {
@@ -915,45 +1003,86 @@ dwarf2_frame_cache (struct frame_info *this_frame, void **this_cache)
   /* Check for "quirks" - known bugs in producers.  */
   dwarf2_frame_find_quirks (&fs, fde);
 
-  /* First decode all the insns in the CIE.  */
-  execute_cfa_program (fde, fde->cie->initial_instructions,
-		       fde->cie->end, gdbarch,
-		       get_frame_address_in_block (this_frame), &fs,
-		       cache->per_objfile->objfile->text_section_offset ());
-
-  /* Save the initialized register set.  */
-  fs.initial = fs.regs;
+  CORE_ADDR block_pc = get_frame_address_in_block (this_frame);
+  bool entry_pc_p = get_frame_func_if_available (this_frame, &entry_pc);
+  if (!entry_pc_p)
+    entry_pc = 0;
 
-  /* Fetching the entry pc for THIS_FRAME won't necessarily result
-     in an address that's within the range of FDE locations.  This
-     is due to the possibility of the function occupying non-contiguous
-     ranges.  */
   LONGEST entry_cfa_sp_offset;
   int entry_cfa_sp_offset_p = 0;
-  if (get_frame_func_if_available (this_frame, &entry_pc)
-      && fde->initial_location <= entry_pc
-      && entry_pc < fde->initial_location + fde->address_range)
+
+  dwarf2_cfi_row_cache_entry &row = dwarf2_cfi_row_cache_slot (block_pc);
+  if (row.fde == fde && row.gdbarch == gdbarch && row.pc == block_pc
+      && row.entry_pc_p == entry_pc_p && row.entry_pc == entry_pc)
     {
-      /* Decode the insns in the FDE up to the entry PC.  */
-      instr = execute_cfa_program
-	(fde, fde->instructions, fde->end, gdbarch, entry_pc, &fs,
-	 cache->per_objfile->objfile->text_section_offset ());
-
-      if (fs.regs.cfa_how == CFA_REG_OFFSET
-	  && (dwarf_reg_to_regnum (gdbarch, fs.regs.cfa_reg)
-	      == gdbarch_sp_regnum (gdbarch)))
-	{
-	  entry_cfa_sp_offset = fs.regs.cfa_offset;
-	  entry_cfa_sp_offset_p = 1;
-	}
+      /* We already ran the CFI program for this PC.  */
+      fs.regs.reg = row.reg;
+      fs.regs.cfa_offset = row.cfa_offset;
+      fs.regs.cfa_reg = row.cfa_reg;
+      fs.regs.cfa_how = row.cfa_how;
+      fs.regs.cfa_exp = row.cfa_exp;
+      fs.pc = row.row_pc;
+      entry_cfa_sp_offset = row.entry_cfa_sp_offset;
+      entry_cfa_sp_offset_p = row.entry_cfa_sp_offset_p;
     }
   else
-    instr = fde->instructions;
+    {
+      /* First decode all the insns in the CIE.  */
+      execute_cfa_program (fde, fde->cie->initial_instructions,
+			   fde->cie->end, gdbarch, block_pc, &fs,
+			   cache->per_objfile->objfile->text_section_offset ());
+
+      /* Save the initialized register set.  */
+      fs.initial = fs.regs;
+
+      /* Fetching the entry pc for THIS_FRAME won't necessarily result
+	 in an address that's within the range of FDE locations.  This
+	 is due to the possibility of the function occupying non-contiguous
+	 ranges.  */
+      if (entry_pc_p
+	  && fde->initial_location <= entry_pc
+	  && entry_pc < fde->initial_location + fde->address_range)
+	{
+	  /* Decode the insns in the FDE up to the entry PC.  */
+	  instr = execute_cfa_program
+	    (fde, fde->instructions, fde->end, gdbarch, entry_pc, &fs,
+	     cache->per_objfile->objfile->text_section_offset ());
+
+	  if (fs.regs.cfa_how == CFA_REG_OFFSET
+	      && (dwarf_reg_to_regnum (gdbarch, fs.regs.cfa_reg)
+		  == gdbarch_sp_regnum (gdbarch)))
+	    {
+	      entry_cfa_sp_offset = fs.regs.cfa_offset;
+	      entry_cfa_sp_offset_p = 1;
+	    }
+	}
+      else
+	instr = fde->instructions;
 
-  /* Then decode the insns in the FDE up to our target PC.  */
-  execute_cfa_program (fde, instr, fde->end, gdbarch,
-		       get_frame_address_in_block (this_frame), &fs,
-		       cache->per_objfile->objfile->text_section_offset ());
+      /* Then decode the insns in the FDE up to our target PC.  */
+      execute_cfa_program (fde, instr, fde->end, gdbarch, block_pc, &fs,
+			   cache->per_objfile->objfile->text_section_offset ());
+
+      /* Remember the resulting row.  A row left with unbalanced
+	 DW_CFA_remember_state entries is not cached.  */
+      if (fs.regs.prev == nullptr)
+	{
+	  row.fde = fde;
+	  row.gdbarch = gdbarch;
+	  row.pc = block_pc;
+	  row.entry_pc_p = entry_pc_p;
+	  row.entry_pc = entry_pc;
+	  row.reg = fs.regs.reg;
+	  row.cfa_offset = fs.regs.cfa_offset;
+	  row.cfa_reg = fs.regs.cfa_reg;
+	  row.cfa_how = fs.regs.cfa_how;
+	  row.cfa_exp = fs.regs.cfa_exp;
+	  row.row_pc = fs.pc;
+	  row.entry_cfa_sp_offset = (entry_cfa_sp_offset_p
+				     ? entry_cfa_sp_offset : 0);
+	  row.entry_cfa_sp_offset_p = entry_cfa_sp_offset_p;
+	}
+    }
 
   try
     {
@@ -1520,11 +1649,11 @@ find_cie (const dwarf2_cie_table &cie_table, ULONGEST cie_pointer)
 }
 
 static inline int
-bsearch_fde_cmp (const dwarf2_fde *fde, CORE_ADDR seek_pc)
+bsearch_fde_cmp (const dwarf2_fde_range &range, CORE_ADDR seek_pc)
 {
-  if (fde->initial_location + fde->address_range <= seek_pc)
+  if (range.end <= seek_pc)
     return -1;
-  if (fde->initial_location <= seek_pc)
+  if (range.begin <= seek_pc)
     return 0;
   return 1;
 }
@@ -1560,40 +1689,50 @@ set_comp_unit (struct objfile *objfile, struct comp_unit *unit)
 static struct dwarf2_fde *
 dwarf2_frame_find_fde (CORE_ADDR *pc, dwarf2_per_objfile **out_per_objfile)
 {
+  /* The first unwind after loading a program usually needs the frame
+     information of many objfiles.  Build it for all the objfiles
+     that lack it at once, so that the decoding can be done in
+     parallel.  */
+  std::vector<struct objfile *> unbuilt;
+  std::unordered_set<bfd *> unbuilt_bfds;
+  for (objfile *objfile : current_program_space->objfiles ())
+    if (find_comp_unit (objfile) == nullptr
+	&& (gdb_bfd_requires_relocations (objfile->obfd)
+	    || unbuilt_bfds.insert (objfile->obfd).second))
+      unbuilt.push_back (objfile);
+  if (!unbuilt.empty ())
+    dwarf2_build_frame_info_parallel (unbuilt);
+
   for (objfile *objfile : current_program_space->objfiles ())
     {
       CORE_ADDR offset;
       CORE_ADDR seek_pc;
 
       comp_unit *unit = find_comp_unit (objfile);
-      if (unit == NULL)
-	{
-	  dwarf2_build_frame_info (objfile);
-	  unit = find_comp_unit (objfile);
-	}
       gdb_assert (unit != NULL);
 
-      dwarf2_fde_table *fde_table = &unit->fde_table;
-      if (fde_table->empty ())
+      const std::vector<dwarf2_fde_range> &fde_ranges = unit->fde_ranges;
+      if (fde_ranges.empty ())
 	continue;
 
       gdb_assert (!objfile->section_offsets.empty ());
       offset = objfile->text_section_offset ();
 
-      gdb_assert (!fde_table->empty ());
-      if (*pc < offset + (*fde_table)[0]->initial_location)
+      if (*pc < offset + fde_ranges[0].begin)
 	continue;
 
       seek_pc = *pc - offset;
-      auto it = gdb::binary_search (fde_table->begin (), fde_table->end (),
+      auto it = gdb::binary_search (fde_ranges.begin (), fde_ranges.end (),
 				    seek_pc, bsearch_fde_cmp);
-      if (it != fde_table->end ())
+      if (it != fde_ranges.end ())
 	{
-	  *pc = (*it)->initial_location + offset;
+	  dwarf2_fde *fde = unit->fde_table[it - fde_ranges.begin ()];
+
+	  *pc = fde->initial_location + offset;
 	  if (out_per_objfile != nullptr)
 	    *out_per_objfile = get_dwarf2_per_objfile (objfile);
 
-	  return *it;
+	  return fde;
 	}
     }
   return NULL;
@@ -2049,27 +2188,55 @@ fde_is_less_than (const dwarf2_fde *aa, const dwarf2_fde *bb)
   return aa->initial_location < bb->initial_location;
 }
 
-void
-dwarf2_build_frame_info (struct objfile *objfile)
+/* The state needed to build the frame information of a single
+   objfile.  The sections are read on the main thread; decoding the
+   CIEs and FDEs only touches the comp_unit being built, so it can be
+   done on a worker thread.  */
+
+struct dwarf2_frame_build_job
 {
-  const gdb_byte *frame_ptr;
-  dwarf2_cie_table cie_table;
-  dwarf2_fde_table fde_table;
+  explicit dwarf2_frame_build_job (struct objfile *objf)
+    : objfile (objf), unit (new comp_unit (objf))
+  {
+  }
+
+  struct objfile *objfile;
+  std::unique_ptr<comp_unit> unit;
+
+  /* The .eh_frame section, if it should be read.  */
+  asection *eh_frame_section = nullptr;
+  const gdb_byte *eh_frame_buffer = nullptr;
+  bfd_size_type eh_frame_size = 0;
 
-  struct gdbarch *gdbarch = objfile->arch ();
+  /* The .debug_frame section.  */
+  asection *debug_frame_section = nullptr;
+  const gdb_byte *debug_frame_buffer = nullptr;
+  bfd_size_type debug_frame_size = 0;
 
-  /* Build a minimal decoding of the DWARF2 compilation unit.  */
-  std::unique_ptr<comp_unit> unit (new comp_unit (objfile));
+  /* Errors found while decoding, reported as warnings once decoding
+     is done.  */
+  std::string eh_frame_error;
+  std::string debug_frame_error;
+};
+
+/* Read the frame sections of JOB's objfile.  This must be called on
+   the main thread.  */
+
+static void
+dwarf2_frame_read_sections (dwarf2_frame_build_job &job)
+{
+  struct objfile *objfile = job.objfile;
+  comp_unit *unit = job.unit.get ();
 
   if (objfile->separate_debug_objfile_backlink == NULL)
     {
       /* Do not read .eh_frame from separate file as they must be also
 	 present in the main file.  */
       dwarf2_get_section_info (objfile, DWARF2_EH_FRAME,
-			       &unit->dwarf_frame_section,
-			       &unit->dwarf_frame_buffer,
-			       &unit->dwarf_frame_size);
-      if (unit->dwarf_frame_size)
+			       &job.eh_frame_section,
+			       &job.eh_frame_buffer,
+			       &job.eh_frame_size);
+      if (job.eh_frame_size)
 	{
 	  asection *got, *txt;
 
@@ -2086,34 +2253,58 @@ dwarf2_build_frame_info (struct objfile *objfile)
 	  txt = bfd_get_section_by_name (unit->abfd, ".text");
 	  if (txt)
 	    unit->tbase = txt->vma;
+	}
+    }
 
-	  try
-	    {
-	      frame_ptr = unit->dwarf_frame_buffer;
-	      while (frame_ptr < unit->dwarf_frame_buffer + unit->dwarf_frame_size)
-		frame_ptr = decode_frame_entry (gdbarch, unit.get (),
-						frame_ptr, 1,
-						cie_table, &fde_table,
-						EH_CIE_OR_FDE_TYPE_ID);
-	    }
+  dwarf2_get_section_info (objfile, DWARF2_DEBUG_FRAME,
+			   &job.debug_frame_section,
+			   &job.debug_frame_buffer,
+			   &job.debug_frame_size);
+}
 
-	  catch (const gdb_exception_error &e)
-	    {
-	      warning (_("skipping .eh_frame info of %s: %s"),
-		       objfile_name (objfile), e.what ());
+/* Decode the CIEs and FDEs of JOB and build its sorted FDE table.
+   This may be called on a worker thread.  */
 
-	      fde_table.clear ();
-	      /* The cie_table is discarded below.  */
-	    }
+static void
+dwarf2_frame_decode (dwarf2_frame_build_job &job)
+{
+  const gdb_byte *frame_ptr;
+  dwarf2_cie_table cie_table;
+  dwarf2_fde_table fde_table;
+
+  struct gdbarch *gdbarch = job.objfile->arch ();
+  comp_unit *unit = job.unit.get ();
+
+  if (job.eh_frame_size)
+    {
+      unit->dwarf_frame_section = job.eh_frame_section;
+      unit->dwarf_frame_buffer = job.eh_frame_buffer;
+      unit->dwarf_frame_size = job.eh_frame_size;
+
+      try
+	{
+	  frame_ptr = unit->dwarf_frame_buffer;
+	  while (frame_ptr < unit->dwarf_frame_buffer + unit->dwarf_frame_size)
+	    frame_ptr = decode_frame_entry (gdbarch, unit,
+					    frame_ptr, 1,
+					    cie_table, &fde_table,
+					    EH_CIE_OR_FDE_TYPE_ID);
+	}
+
+      catch (const gdb_exception_error &e)
+	{
+	  job.eh_frame_error = e.what ();
 
-	  cie_table.clear ();
+	  fde_table.clear ();
+	  /* The cie_table is discarded below.  */
 	}
+
+      cie_table.clear ();
     }
 
-  dwarf2_get_section_info (objfile, DWARF2_DEBUG_FRAME,
-			   &unit->dwarf_frame_section,
-			   &unit->dwarf_frame_buffer,
-			   &unit->dwarf_frame_size);
+  unit->dwarf_frame_section = job.debug_frame_section;
+  unit->dwarf_frame_buffer = job.debug_frame_buffer;
+  unit->dwarf_frame_size = job.debug_frame_size;
   if (unit->dwarf_frame_size)
     {
       size_t num_old_fde_entries = fde_table.size ();
@@ -2122,14 +2313,13 @@ dwarf2_build_frame_info (struct objfile *objfile)
 	{
 	  frame_ptr = unit->dwarf_frame_buffer;
 	  while (frame_ptr < unit->dwarf_frame_buffer + unit->dwarf_frame_size)
-	    frame_ptr = decode_frame_entry (gdbarch, unit.get (), frame_ptr, 0,
+	    frame_ptr = decode_frame_entry (gdbarch, unit, frame_ptr, 0,
 					    cie_table, &fde_table,
 					    EH_CIE_OR_FDE_TYPE_ID);
 	}
       catch (const gdb_exception_error &e)
 	{
-	  warning (_("skipping .debug_frame info of %s: %s"),
-		   objfile_name (objfile), e.what ());
+	  job.debug_frame_error = e.what ();
 
 	  fde_table.resize (num_old_fde_entries);
 	}
@@ -2178,11 +2368,73 @@ dwarf2_build_frame_info (struct objfile *objfile)
 	continue;
 
       unit->fde_table.push_back (fde);
+      unit->fde_ranges.push_back ({fde->initial_location,
+				   fde->initial_location
+				   + fde->address_range});
       fde_prev = fde;
     }
   unit->fde_table.shrink_to_fit ();
+  unit->fde_ranges.shrink_to_fit ();
+}
+
+/* Report any errors found while decoding JOB, and install its
+   comp_unit.  This must be called on the main thread.  */
+
+static void
+dwarf2_frame_finish_build (dwarf2_frame_build_job &job)
+{
+  if (!job.eh_frame_error.empty ())
+    warning (_("skipping .eh_frame info of %s: %s"),
+	     objfile_name (job.objfile), job.eh_frame_error.c_str ());
+  if (!job.debug_frame_error.empty ())
+    warning (_("skipping .debug_frame info of %s: %s"),
+	     objfile_name (job.objfile), job.debug_frame_error.c_str ());
+
+  set_comp_unit (job.objfile, job.unit.release ());
+}
+
+/* Build the frame information of all of OBJFILES, decoding the
+   objfiles in parallel.  None of OBJFILES may have frame information
+   yet, and no two of them may share it.  */
 
-  set_comp_unit (objfile, unit.release ());
+static void
+dwarf2_build_frame_info_parallel (gdb::array_view<struct objfile *> objfiles)
+{
+  std::vector<dwarf2_frame_build_job> jobs;
+  jobs.reserve (objfiles.size ());
+  for (struct objfile *objfile : objfiles)
+    {
+      jobs.emplace_back (objfile);
+      dwarf2_frame_read_sections (jobs.back ());
+    }
+
+  {
+    /* Decoding issues complaints from the worker threads.  Collect
+       them, and issue them from this thread once all the objfiles
+       are decoded, as the cooked indexer does.  */
+    complaint_interceptor complaint_handler;
+
+    gdb::parallel_for_each (1, jobs.begin (), jobs.end (),
+			    [] (std::vector<dwarf2_frame_build_job>::iterator iter,
+				std::vector<dwarf2_frame_build_job>::iterator end)
+			    {
+			      for (; iter != end; ++iter)
+				dwarf2_frame_decode (*iter);
+			    });
+  }
+
+  for (dwarf2_frame_build_job &job : jobs)
+    dwarf2_frame_finish_build (job);
+}
+
+void
+dwarf2_build_frame_info (struct objfile *objfile)
+{
+  dwarf2_frame_build_job job (objfile);
+
+  dwarf2_frame_read_sections (job);
+  dwarf2_frame_decode (job);
+  dwarf2_frame_finish_build (job);
 }
 
 /* Handle 'maintenance show dwarf unwinders'.  */
@@ -2203,6 +2455,9 @@ _initialize_dwarf2_frame ()
 {
   dwarf2_frame_data = gdbarch_data_register_pre_init (dwarf2_frame_init);
 
+  gdb::observers::free_objfile.attach (dwarf2_cfi_row_cache_free_objfile,
+				       "dwarf2-frame");
+
   add_setshow_boolean_cmd ("unwinders", class_obscure,
 			   &dwarf2_frame_unwinders_enabled_p , _("\
 Set whether the DWARF stack frame unwinders are used."), _("\
@@ -31,8 +31,11 @@
 #include "dwarf2/dwz.h"
 #include "objfiles.h"
 #include "gdbsupport/selftest.h"
+#include "gdbsupport/filestuff.h"
+#include <algorithm>
 #include <string>
 #include <stdlib.h>
+#include <utime.h>
 
 /* When set to true, show debug messages about the index cache.  */
 static bool debug_index_cache = false;
@@ -44,6 +47,14 @@ static bool debug_index_cache = false;
 /* The index cache directory, used for "set/show index-cache directory".  */
 static std::string index_cache_directory;
 
+/* The shared index cache directory, used for "set/show index-cache
+   shared-directory".  */
+static std::string index_cache_shared_directory;
+
+/* The size limit of the index cache in megabytes, used for "set/show
+   index-cache max-size".  */
+static unsigned int index_cache_max_size = UINT_MAX;
+
 /* See dwarf-index.cache.h.  */
 index_cache global_index_cache;
 
@@ -68,6 +79,16 @@ index_cache::set_directory (std::string dir)
 
 /* See dwarf-index-cache.h.  */
 
+void
+index_cache::set_shared_directory (std::string dir)
+{
+  m_shared_dir = std::move (dir);
+
+  index_cache_debug ("now using shared directory %s", m_shared_dir.c_str ());
+}
+
+/* See dwarf-index-cache.h.  */
+
 void
 index_cache::enable ()
 {
@@ -160,6 +181,97 @@ index_cache::store (dwarf2_per_objfile *per_objfile)
     {
       index_cache_debug ("couldn't store index cache for objfile %s: %s",
 			 objfile_name (obj), except.what ());
+      return;
+    }
+
+  try
+    {
+      index_cache_debug ("writing cooked index cache for objfile %s",
+			 objfile_name (obj));
+
+      write_cooked_index (per_objfile, m_dir.c_str (),
+			  build_id_str.c_str (), dwz_build_id_ptr);
+    }
+  catch (const gdb_exception_error &except)
+    {
+      index_cache_debug ("couldn't store cooked index cache for objfile %s: %s",
+			 objfile_name (obj), except.what ());
+    }
+
+  evict (build_id_str);
+}
+
+/* See dwarf-index-cache.h.  */
+
+void
+index_cache::evict (const std::string &keep)
+{
+  if (m_max_size == 0)
+    return;
+
+  gdb_dir_up dir (opendir (m_dir.c_str ()));
+  if (dir == nullptr)
+    return;
+
+  struct cache_file
+  {
+    std::string filename;
+    ULONGEST size;
+    time_t mtime;
+  };
+
+  /* Lookups refresh the modification time of the files they use, so
+     the oldest files are the least recently used ones.  */
+  std::vector<cache_file> files;
+  ULONGEST total = 0;
+  while (true)
+    {
+      struct dirent *ent = readdir (dir.get ());
+      if (ent == nullptr)
+	break;
+
+      std::string name (ent->d_name);
+      const char *suffix;
+      if (name.size () > strlen (INDEX4_SUFFIX)
+	  && name.compare (name.size () - strlen (INDEX4_SUFFIX),
+			   std::string::npos, INDEX4_SUFFIX) == 0)
+	suffix = INDEX4_SUFFIX;
+      else if (name.size () > strlen (INDEX_COOKED_SUFFIX)
+	       && name.compare (name.size () - strlen (INDEX_COOKED_SUFFIX),
+				std::string::npos, INDEX_COOKED_SUFFIX) == 0)
+	suffix = INDEX_COOKED_SUFFIX;
+      else
+	continue;
+
+      std::string filename = m_dir + SLASH_STRING + name;
+      struct stat st;
+      if (stat (filename.c_str (), &st) != 0 || !S_ISREG (st.st_mode))
+	continue;
+
+      total += st.st_size;
+      if (name == keep + suffix)
+	continue;
+      files.push_back ({std::move (filename), (ULONGEST) st.st_size,
+			st.st_mtime});
+    }
+
+  std::sort (files.begin (), files.end (),
+	     [] (const cache_file &a, const cache_file &b)
+	     {
+	       return a.mtime < b.mtime;
+	     });
+
+  for (const cache_file &file : files)
+    {
+      if (total <= m_max_size)
+	break;
+
+      if (unlink (file.filename.c_str ()) == 0)
+	{
+	  index_cache_debug ("evicted %s", file.filename.c_str ());
+	  total -= file.size;
+	  m_n_evictions++;
+	}
     }
 }
 
@@ -181,42 +293,58 @@ struct index_cache_resource_mmap final : public index_cache_resource
 /* See dwarf-index-cache.h.  */
 
 gdb::array_view<const gdb_byte>
-index_cache::lookup_gdb_index (const bfd_build_id *build_id,
-			       std::unique_ptr<index_cache_resource> *resource)
+index_cache::lookup (const bfd_build_id *build_id, const char *suffix,
+		     std::unique_ptr<index_cache_resource> *resource)
 {
   if (!enabled ())
     return {};
 
-  if (m_dir.empty ())
+  if (m_dir.empty () && m_shared_dir.empty ())
     {
       warning (_("The index cache directory name is empty, skipping cache "
 		 "lookup."));
       return {};
     }
 
-  /* Compute where we would expect a gdb index file for this build id to be.  */
-  std::string filename = make_index_filename (build_id, INDEX4_SUFFIX);
-
-  try
+  /* Look in the shared directory first, then in our own.  */
+  for (const std::string *dir : { &m_shared_dir, &m_dir })
     {
-      index_cache_debug ("trying to read %s",
-			 filename.c_str ());
+      if (dir->empty ())
+	continue;
 
-      /* Try to map that file.  */
-      index_cache_resource_mmap *mmap_resource
-	= new index_cache_resource_mmap (filename.c_str ());
+      /* Compute where we would expect an index file for this build id
+	 to be.  */
+      std::string filename = make_index_filename (*dir, build_id, suffix);
 
-      /* Yay, it worked!  Hand the resource to the caller.  */
-      resource->reset (mmap_resource);
-
-      return gdb::array_view<const gdb_byte>
-	  ((const gdb_byte *) mmap_resource->mapping.get (),
-	   mmap_resource->mapping.size ());
-    }
-  catch (const gdb_exception_error &except)
-    {
-      index_cache_debug ("couldn't read %s: %s",
-			 filename.c_str (), except.what ());
+      try
+	{
+	  index_cache_debug ("trying to read %s",
+			     filename.c_str ());
+
+	  /* Try to map that file.  */
+	  index_cache_resource_mmap *mmap_resource
+	    = new index_cache_resource_mmap (filename.c_str ());
+
+	  /* Yay, it worked!  Hand the resource to the caller.  */
+	  resource->reset (mmap_resource);
+
+	  if (dir == &m_shared_dir)
+	    m_n_shared_hits++;
+	  else
+	    {
+	      /* Mark the file as recently used, for eviction.  */
+	      utime (filename.c_str (), nullptr);
+	    }
+
+	  return gdb::array_view<const gdb_byte>
+	      ((const gdb_byte *) mmap_resource->mapping.get (),
+	       mmap_resource->mapping.size ());
+	}
+      catch (const gdb_exception_error &except)
+	{
+	  index_cache_debug ("couldn't read %s: %s",
+			     filename.c_str (), except.what ());
+	}
     }
 
   return {};
@@ -227,8 +355,8 @@ index_cache::lookup_gdb_index (const bfd_build_id *build_id,
 /* See dwarf-index-cache.h.  This is a no-op on unsupported systems.  */
 
 gdb::array_view<const gdb_byte>
-index_cache::lookup_gdb_index (const bfd_build_id *build_id,
-			       std::unique_ptr<index_cache_resource> *resource)
+index_cache::lookup (const bfd_build_id *build_id, const char *suffix,
+		     std::unique_ptr<index_cache_resource> *resource)
 {
   return {};
 }
@@ -238,12 +366,13 @@ index_cache::lookup_gdb_index (const bfd_build_id *build_id,
 /* See dwarf-index-cache.h.  */
 
 std::string
-index_cache::make_index_filename (const bfd_build_id *build_id,
+index_cache::make_index_filename (const std::string &dir,
+				  const bfd_build_id *build_id,
 				  const char *suffix) const
 {
   std::string build_id_str = build_id_to_string (build_id);
 
-  return m_dir + SLASH_STRING + build_id_str + suffix;
+  return dir + SLASH_STRING + build_id_str + suffix;
 }
 
 /* True when we are executing "show index-cache".  This is used to improve the
@@ -306,6 +435,45 @@ set_index_cache_directory_command (const char *arg, int from_tty,
   global_index_cache.set_directory (index_cache_directory);
 }
 
+/* "set index-cache shared-directory" handler.  */
+
+static void
+set_index_cache_shared_directory_command (const char *arg, int from_tty,
+					  cmd_list_element *element)
+{
+  if (!index_cache_shared_directory.empty ())
+    index_cache_shared_directory
+      = gdb_abspath (index_cache_shared_directory.c_str ());
+  global_index_cache.set_shared_directory (index_cache_shared_directory);
+}
+
+/* "set index-cache max-size" handler.  */
+
+static void
+set_index_cache_max_size_command (const char *arg, int from_tty,
+				  cmd_list_element *element)
+{
+  if (index_cache_max_size == UINT_MAX)
+    global_index_cache.set_max_size (0);
+  else
+    global_index_cache.set_max_size ((ULONGEST) index_cache_max_size
+				     * 1024 * 1024);
+}
+
+/* "show index-cache max-size" handler.  */
+
+static void
+show_index_cache_max_size_command (ui_file *stream, int from_tty,
+				   cmd_list_element *cmd, const char *value)
+{
+  if (index_cache_max_size == 0 || index_cache_max_size == UINT_MAX)
+    gdb_printf (stream, _("The size of the index cache is unlimited.\n"));
+  else
+    gdb_printf (stream,
+		_("The size of the index cache is limited to %s MB.\n"),
+		value);
+}
+
 /* "show index-cache stats" handler.  */
 
 static void
@@ -325,6 +493,10 @@ show_index_cache_stats_command (const char *arg, int from_tty)
 	      indent, global_index_cache.n_hits ());
   gdb_printf (_("%sCache misses (this session): %u\n"),
 	      indent, global_index_cache.n_misses ());
+  gdb_printf (_("%s Shared hits (this session): %u\n"),
+	      indent, global_index_cache.n_shared_hits ());
+  gdb_printf (_("%s   Evictions (this session): %u\n"),
+	      indent, global_index_cache.n_evictions ());
 }
 
 void _initialize_index_cache ();
@@ -387,6 +559,35 @@ _initialize_index_cache ()
 			    &set_index_cache_prefix_list,
 			    &show_index_cache_prefix_list);
 
+  /* set index-cache shared-directory */
+  add_setshow_optional_filename_cmd ("shared-directory", class_files,
+				     &index_cache_shared_directory,
+				     _("\
+Set the shared, read-only directory of the index cache."),
+				     _("\
+Show the shared, read-only directory of the index cache."),
+				     _("\
+When set, index files are looked up in this directory before the\n\
+index cache directory.  GDB never writes to it, so it can be shared\n\
+by many machines and populated from elsewhere."),
+				     set_index_cache_shared_directory_command,
+				     NULL,
+				     &set_index_cache_prefix_list,
+				     &show_index_cache_prefix_list);
+
+  /* set index-cache max-size */
+  add_setshow_uinteger_cmd ("max-size", class_files, &index_cache_max_size,
+			    _("\
+Set the maximum size of the index cache, in megabytes."), _("\
+Show the maximum size of the index cache, in megabytes."), _("\
+When the index files in the index cache directory grow beyond this\n\
+size, the least recently used ones are removed.\n\
+A value of \"unlimited\", the default, means no limit."),
+			    set_index_cache_max_size_command,
+			    show_index_cache_max_size_command,
+			    &set_index_cache_prefix_list,
+			    &show_index_cache_prefix_list);
+
   /* show index-cache stats */
   add_cmd ("stats", class_files, show_index_cache_stats_command,
 	   _("Show some stats about the index cache."),
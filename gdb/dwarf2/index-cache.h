@@ -40,6 +40,16 @@ class index_cache
   /* Change the directory used to save/load index files.  */
   void set_directory (std::string dir);
 
+  /* Change the read-only directory that is searched for index files
+     before the cache directory.  An empty DIR means there is none.  */
+  void set_shared_directory (std::string dir);
+
+  /* Limit the total size of the index files in the cache directory to
+     MAX_SIZE bytes, evicting the least recently used ones when storing
+     an index would exceed it.  Zero means no limit.  */
+  void set_max_size (ULONGEST max_size)
+  { m_max_size = max_size; }
+
   /* Return true if the usage of the cache is enabled.  */
   bool enabled () const
   {
@@ -63,7 +73,19 @@ class index_cache
      If no matching index file is found, return an empty array view.  */
   gdb::array_view<const gdb_byte>
   lookup_gdb_index (const bfd_build_id *build_id,
-		    std::unique_ptr<index_cache_resource> *resource);
+		    std::unique_ptr<index_cache_resource> *resource)
+  {
+    return lookup (build_id, INDEX4_SUFFIX, resource);
+  }
+
+  /* Like lookup_gdb_index, but look for a cooked index file, as
+     written by cooked_index_vector::write_cache.  */
+  gdb::array_view<const gdb_byte>
+  lookup_cooked_index (const bfd_build_id *build_id,
+		       std::unique_ptr<index_cache_resource> *resource)
+  {
+    return lookup (build_id, INDEX_COOKED_SUFFIX, resource);
+  }
 
   /* Return the number of cache hits.  */
   unsigned int n_hits () const
@@ -87,23 +109,57 @@ class index_cache
       m_n_misses++;
   }
 
+  /* Return the number of index files found in the shared directory.  */
+  unsigned int n_shared_hits () const
+  { return m_n_shared_hits; }
+
+  /* Return the number of index files evicted from the cache
+     directory.  */
+  unsigned int n_evictions () const
+  { return m_n_evictions; }
+
 private:
 
+  /* Remove the least recently used index files from the cache
+     directory until their total size fits in M_MAX_SIZE.  The files
+     of the objfile with build id KEEP, just stored, are kept.  */
+  void evict (const std::string &keep);
+
+  /* Look for an index file matching BUILD_ID, with the filename suffix
+     SUFFIX.  See lookup_gdb_index for the meaning of RESOURCE and of
+     the result.  */
+  gdb::array_view<const gdb_byte>
+  lookup (const bfd_build_id *build_id, const char *suffix,
+	  std::unique_ptr<index_cache_resource> *resource);
+
   /* Compute the absolute filename where the index of the objfile with build
      id BUILD_ID will be stored.  SUFFIX is appended at the end of the
      filename.  */
-  std::string make_index_filename (const bfd_build_id *build_id,
+  std::string make_index_filename (const std::string &dir,
+				   const bfd_build_id *build_id,
 				   const char *suffix) const;
 
   /* The base directory where we are storing and looking up index files.  */
   std::string m_dir;
 
+  /* A read-only directory searched before M_DIR, typically shared
+     between many machines.  Empty if there is none.  */
+  std::string m_shared_dir;
+
+  /* The size budget of M_DIR in bytes, or zero for no limit.  */
+  ULONGEST m_max_size = 0;
+
   /* Whether the cache is enabled.  */
   bool m_enabled = false;
 
   /* Number of cache hits and misses during this GDB session.  */
   unsigned int m_n_hits = 0;
   unsigned int m_n_misses = 0;
+
+  /* Number of hits served from M_SHARED_DIR, and of files evicted
+     from M_DIR, during this GDB session.  */
+  unsigned int m_n_shared_hits = 0;
+  unsigned int m_n_evictions = 0;
 };
 
 /* The global instance of the index cache.  */
@@ -24,6 +24,7 @@
 #define INDEX4_SUFFIX ".gdb-index"
 #define INDEX5_SUFFIX ".debug_names"
 #define DEBUG_STR_SUFFIX ".debug_str"
+#define INDEX_COOKED_SUFFIX ".gdb-cooked-index"
 
 /* All offsets in the index are of this type.  It must be
    architecture-independent.  */
@@ -26,6 +26,7 @@
 #include "gdbsupport/byte-vector.h"
 #include "gdbsupport/filestuff.h"
 #include "gdbsupport/gdb_unlinker.h"
+#include "gdbsupport/parallel-for.h"
 #include "gdbsupport/pathstuff.h"
 #include "gdbsupport/scoped_fd.h"
 #include "complaints.h"
@@ -276,16 +277,25 @@ add_index_entry (struct mapped_symtab *symtab, const char *name,
 static void
 uniquify_cu_indices (struct mapped_symtab *symtab)
 {
-  for (auto &entry : symtab->data)
+  /* Each entry is independent of the others, so this can be done in
+     parallel.  */
+  using iter_type = decltype (symtab->data.begin ());
+  gdb::parallel_for_each (1000, symtab->data.begin (), symtab->data.end (),
+			  [] (iter_type iter, iter_type end)
     {
-      if (entry.name != NULL && !entry.cu_indices.empty ())
+      for (; iter != end; ++iter)
 	{
-	  auto &cu_indices = entry.cu_indices;
-	  std::sort (cu_indices.begin (), cu_indices.end ());
-	  auto from = std::unique (cu_indices.begin (), cu_indices.end ());
-	  cu_indices.erase (from, cu_indices.end ());
+	  symtab_index_entry &entry = *iter;
+	  if (entry.name != NULL && !entry.cu_indices.empty ())
+	    {
+	      auto &cu_indices = entry.cu_indices;
+	      std::sort (cu_indices.begin (), cu_indices.end ());
+	      auto from = std::unique (cu_indices.begin (),
+				       cu_indices.end ());
+	      cu_indices.erase (from, cu_indices.end ());
+	    }
 	}
-    }
+    });
 }
 
 /* A form of 'const char *' suitable for container keys.  Only the
@@ -606,20 +616,35 @@ class debug_names
       uint32_t hash;
       decltype (m_name_to_value_set)::const_iterator it;
     };
-    std::vector<std::forward_list<hash_it_pair>> bucket_hash;
-    bucket_hash.resize (m_bucket_table.size ());
+    std::vector<hash_it_pair> hashes;
+    hashes.reserve (name_count);
     for (decltype (m_name_to_value_set)::const_iterator it
 	   = m_name_to_value_set.cbegin ();
 	 it != m_name_to_value_set.cend ();
 	 ++it)
       {
-	const char *const name = it->first.c_str ();
-	const uint32_t hash = dwarf5_djb_hash (name);
 	hash_it_pair hashitpair;
-	hashitpair.hash = hash;
 	hashitpair.it = it;
-	auto &slot = bucket_hash[hash % bucket_hash.size()];
-	slot.push_front (std::move (hashitpair));
+	hashes.push_back (hashitpair);
+      }
+
+    /* Hashing the names is independent for each name, so do it in
+       parallel; distributing them into buckets is done afterward, in
+       order, so that the output does not depend on the threads.  */
+    using iter_type = decltype (hashes.begin ());
+    gdb::parallel_for_each (1000, hashes.begin (), hashes.end (),
+			    [] (iter_type iter, iter_type end)
+      {
+	for (; iter != end; ++iter)
+	  iter->hash = dwarf5_djb_hash (iter->it->first.c_str ());
+      });
+
+    std::vector<std::forward_list<hash_it_pair>> bucket_hash;
+    bucket_hash.resize (m_bucket_table.size ());
+    for (const hash_it_pair &hashitpair : hashes)
+      {
+	auto &slot = bucket_hash[hashitpair.hash % bucket_hash.size()];
+	slot.push_front (hashitpair);
       }
     for (size_t bucket_ix = 0; bucket_ix < bucket_hash.size (); ++bucket_ix)
       {
@@ -1467,6 +1492,32 @@ write_dwarf_index (dwarf2_per_objfile *per_objfile, const char *dir,
     dwz_index_wip->finalize ();
 }
 
+/* See dwarf-index-write.h.  */
+
+void
+write_cooked_index (dwarf2_per_objfile *per_objfile, const char *dir,
+		    const char *basename, const char *dwz_build_id)
+{
+  dwarf2_per_bfd *per_bfd = per_objfile->per_bfd;
+
+  if (per_bfd->index_table == nullptr)
+    error (_("No debugging symbols"));
+  cooked_index_vector *table = per_bfd->index_table->index_for_writing ();
+
+  /* Type units found in .dwo files are only discovered while
+     indexing, so the set of units can't be validated when the index
+     is read back in.  */
+  if (per_bfd->dwo_files != nullptr)
+    error (_("Cannot make a cooked index for split DWARF"));
+
+  std::vector<gdb_byte> contents;
+  table->write_cache (&contents, per_bfd, dwz_build_id);
+
+  index_wip_file index_wip (dir, basename, INDEX_COOKED_SUFFIX);
+  file_write (index_wip.out_file.get (), contents);
+  index_wip.finalize ();
+}
+
 /* Implementation of the `save gdb-index' command.
 
    Note that the .gdb_index file format used by this command is
@@ -36,4 +36,13 @@ extern void write_dwarf_index
   (dwarf2_per_objfile *per_objfile, const char *dir, const char *basename,
    const char *dwz_basename, dw_index_kind index_kind);
 
+/* Write the cooked index of PER_OBJFILE to the directory DIR, in the
+   format used by the index cache.  BASENAME is the desired filename
+   base; INDEX_COOKED_SUFFIX is appended to it.  DWZ_BUILD_ID is the
+   build-id of the associated dwz file, or nullptr if there is none.  */
+
+extern void write_cooked_index
+  (dwarf2_per_objfile *per_objfile, const char *dir, const char *basename,
+   const char *dwz_build_id);
+
 #endif /* DWARF_INDEX_WRITE_H */
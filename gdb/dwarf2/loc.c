@@ -344,11 +344,16 @@ decode_debug_loc_dwo_addresses (dwarf2_per_cu_data *per_cu,
    to the beginning of the expression.  Returns NULL on failure.
 
    For now, only return the first matching location expression; there
-   can be more than one in the list.  */
+   can be more than one in the list.
 
-const gdb_byte *
-dwarf2_find_location_expression (struct dwarf2_loclist_baton *baton,
-				 size_t *locexpr_length, CORE_ADDR pc)
+   TEXT_OFFSET is the adjustment for relocatable objects.  This does
+   the actual search; dwarf2_find_location_expression caches its
+   result.  */
+
+static const gdb_byte *
+find_location_expression_1 (struct dwarf2_loclist_baton *baton,
+			    size_t *locexpr_length, CORE_ADDR pc,
+			    CORE_ADDR text_offset)
 {
   dwarf2_per_objfile *per_objfile = baton->per_objfile;
   struct objfile *objfile = per_objfile->objfile;
@@ -356,8 +361,6 @@ dwarf2_find_location_expression (struct dwarf2_loclist_baton *baton,
   enum bfd_endian byte_order = gdbarch_byte_order (gdbarch);
   unsigned int addr_size = baton->per_cu->addr_size ();
   int signed_addr_p = bfd_get_sign_extend_vma (objfile->obfd);
-  /* Adjustment for relocatable objects.  */
-  CORE_ADDR text_offset = baton->per_objfile->objfile->text_section_offset ();
   CORE_ADDR base_address = baton->base_address;
   const gdb_byte *loc_ptr, *buf_end;
 
@@ -470,6 +473,34 @@ dwarf2_find_location_expression (struct dwarf2_loclist_baton *baton,
     }
 }
 
+/* See loc.h.  */
+
+const gdb_byte *
+dwarf2_find_location_expression (struct dwarf2_loclist_baton *baton,
+				 size_t *locexpr_length, CORE_ADDR pc)
+{
+  CORE_ADDR text_offset = baton->per_objfile->objfile->text_section_offset ();
+
+  if (baton->cached_valid
+      && baton->cached_pc == pc
+      && baton->cached_text_offset == text_offset)
+    {
+      *locexpr_length = baton->cached_length;
+      return baton->cached_expr;
+    }
+
+  const gdb_byte *result
+    = find_location_expression_1 (baton, locexpr_length, pc, text_offset);
+
+  baton->cached_valid = true;
+  baton->cached_pc = pc;
+  baton->cached_text_offset = text_offset;
+  baton->cached_expr = result;
+  baton->cached_length = *locexpr_length;
+
+  return result;
+}
+
 /* Implement find_frame_base_location method for LOC_BLOCK functions using
    DWARF expression for its DW_AT_frame_base.  */
 
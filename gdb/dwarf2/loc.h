@@ -198,6 +198,19 @@ struct dwarf2_loclist_baton
   /* Non-zero if the location list lives in .debug_loc.dwo.
      The format of entries in this section are different.  */
   unsigned char from_dwo;
+
+  /* The result of the most recent dwarf2_find_location_expression
+     call, which is reused when the same PC is looked up again, as
+     happens when a breakpoint condition refers to this variable.
+     CACHED_TEXT_OFFSET is the text offset of the objfile at the time,
+     so that a relocation invalidates the cache.  CACHED_EXPR is NULL
+     if no expression matched.  Nothing is cached if CACHED_VALID is
+     false.  */
+  bool cached_valid;
+  CORE_ADDR cached_pc;
+  CORE_ADDR cached_text_offset;
+  const gdb_byte *cached_expr;
+  size_t cached_length;
 };
 
 /* The baton used when a dynamic property is an offset to a parent
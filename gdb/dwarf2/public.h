@@ -20,6 +20,9 @@
 #ifndef DWARF2_PUBLIC_H
 #define DWARF2_PUBLIC_H
 
+#include "gdbsupport/byte-vector.h"
+#include <functional>
+
 extern int dwarf2_has_info (struct objfile *,
                             const struct dwarf2_debug_sections *,
 			    bool = false);
@@ -38,6 +41,16 @@ enum class dw_index_kind
    entry on the objfile's "qf" list.  */
 extern void dwarf2_initialize_objfile (struct objfile *objfile);
 
+/* Push on OBJFILE's "qf" list an entry that answers symbol lookups
+   from INDEX, the contents of the .gdb_index section of OBJFILE's
+   separate debug info, until one of them needs the debug info itself.
+   DOWNLOAD is then called to fetch it; it returns the new separate
+   debug objfile, or nullptr on failure.  Return false, doing nothing,
+   if INDEX can't be used.  */
+extern bool dwarf2_initialize_deferred_objfile
+  (struct objfile *objfile, gdb::byte_vector &&index,
+   std::function<struct objfile *()> &&download);
+
 extern void dwarf2_build_frame_info (struct objfile *);
 
 #endif /* DWARF2_PUBLIC_H */
@@ -93,6 +93,7 @@
 #include "split-name.h"
 #include "gdbsupport/parallel-for.h"
 #include "gdbsupport/thread-pool.h"
+#include "perf-counter.h"
 
 /* When == 1, print basic high level tracing messages.
    When > 1, be more verbose.
@@ -883,6 +884,21 @@ show_dwarf_max_cache_age (struct ui_file *file, int from_tty,
 	      value);
 }
 
+/* An upper bound on the total memory, in bytes, used by the loaded
+   secondary compilation units that are kept in memory.  When the
+   cache grows beyond this, the least recently used compilation units
+   are released, even if they are younger than DWARF_MAX_CACHE_AGE.
+   ULONGEST_MAX means unlimited.  */
+static ULONGEST dwarf_max_cache_size = ULONGEST_MAX;
+static void
+show_dwarf_max_cache_size (struct ui_file *file, int from_tty,
+			   struct cmd_list_element *c, const char *value)
+{
+  gdb_printf (file, _("The upper bound on the memory used by cached "
+		      "DWARF compilation units is %s.\n"),
+	      value);
+}
+
 /* local function prototypes */
 
 static void dwarf2_find_base_address (struct die_info *die,
@@ -892,7 +908,7 @@ class cooked_index_storage;
 static void build_type_psymtabs_reader (cutu_reader *reader,
 					cooked_index_storage *storage);
 
-static void dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile);
+static bool dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile);
 
 static void var_decode_location (struct attribute *attr,
 				 struct symbol *sym,
@@ -1288,6 +1304,9 @@ static const char *compute_include_file_name
 
 static htab_up allocate_signatured_type_table ();
 
+static void **find_signatured_type_slot (htab_t table, ULONGEST sig,
+					 enum insert_option insert);
+
 static htab_up allocate_dwo_unit_table ();
 
 static struct dwo_unit *lookup_dwo_unit_in_dwp
@@ -2064,6 +2083,16 @@ dw2_do_instantiate_symtab (dwarf2_per_cu_data *per_cu,
   per_objfile->age_comp_units ();
 }
 
+/* The number of units whose full symbols were read, and the time
+   spent expanding symbol tables.  */
+
+static perf_counter dwarf2_cus_expanded_counter
+  ("dwarf2-cus-expanded", perf_counter_unit::count,
+   N_("DWARF compilation and type units expanded to full symbols."));
+static perf_counter dwarf2_expansion_time_counter
+  ("dwarf2-expansion-time", perf_counter_unit::nanoseconds,
+   N_("Time spent expanding DWARF units to full symbols."));
+
 /* Ensure that the symbols for PER_CU have been read in.  DWARF2_PER_OBJFILE is
    the per-objfile for which this symtab is instantiated.
 
@@ -2076,6 +2105,7 @@ dw2_instantiate_symtab (dwarf2_per_cu_data *per_cu,
 {
   if (!per_objfile->symtab_set_p (per_cu))
     {
+      scoped_perf_timer timer (&dwarf2_expansion_time_counter);
       free_cached_comp_units freer (per_objfile);
       scoped_restore decrementer = increment_reading_symtab ();
       dw2_do_instantiate_symtab (per_cu, per_objfile, skip_partial);
@@ -2203,7 +2233,8 @@ create_signatured_type_table_from_index
       sig_type->section = section;
       sig_type->sect_off = sect_off;
 
-      slot = htab_find_slot (sig_types_hash.get (), sig_type.get (), INSERT);
+      slot = find_signatured_type_slot (sig_types_hash.get (), signature,
+					INSERT);
       *slot = sig_type.get ();
 
       per_bfd->all_comp_units.emplace_back (sig_type.release ());
@@ -2251,7 +2282,8 @@ create_signatured_type_table_from_debug_names
       sig_type->section = section;
       sig_type->sect_off = sect_off;
 
-      slot = htab_find_slot (sig_types_hash.get (), sig_type.get (), INSERT);
+      slot = find_signatured_type_slot (sig_types_hash.get (),
+					cu_header.signature, INSERT);
       *slot = sig_type.get ();
 
       per_objfile->per_bfd->all_comp_units.emplace_back (sig_type.release ());
@@ -2273,10 +2305,11 @@ create_addrmap_from_index (dwarf2_per_objfile *per_objfile,
   const gdb_byte *iter, *end;
   CORE_ADDR baseaddr;
 
-  addrmap_mutable mutable_map;
+  std::vector<addrmap_range> ranges;
 
   iter = index->address_table.data ();
   end = iter + index->address_table.size ();
+  ranges.reserve ((end - iter) / 20);
 
   baseaddr = objfile->text_section_offset ();
 
@@ -2306,11 +2339,12 @@ create_addrmap_from_index (dwarf2_per_objfile *per_objfile,
 
       lo = gdbarch_adjust_dwarf2_addr (gdbarch, lo + baseaddr) - baseaddr;
       hi = gdbarch_adjust_dwarf2_addr (gdbarch, hi + baseaddr) - baseaddr;
-      mutable_map.set_empty (lo, hi - 1, per_bfd->get_cu (cu_index));
+      if (lo < hi)
+	ranges.push_back ({ lo, hi - 1, per_bfd->get_cu (cu_index) });
     }
 
   per_bfd->index_addrmap
-    = new (&per_bfd->obstack) addrmap_fixed (&per_bfd->obstack, &mutable_map);
+    = new (&per_bfd->obstack) addrmap_fixed (&per_bfd->obstack, ranges);
 }
 
 /* Read the address map data from DWARF-5 .debug_aranges, and use it
@@ -2713,54 +2747,58 @@ dwarf2_read_gdb_index
   return 1;
 }
 
-/* die_reader_func for dw2_get_file_names.  */
+/* The file names of a CU, as read by dw2_read_file_names.  This holds
+   everything that can be computed without touching shared state, so
+   that it can be filled in by a worker thread.  */
+
+struct dw2_file_names_data
+{
+  /* True if the CU was read at all.  */
+  bool valid = false;
+
+  /* The CU's line table header, if it has a DW_AT_stmt_list.  */
+  struct stmt_list_hash hash {};
+  bool has_stmt_list = false;
+
+  /* The file names of the CU, or nullptr if it has none.  This is
+     allocated on the obstack passed to dw2_read_file_names, but is
+     only used if no other CU sharing the same line table was
+     installed first.  */
+  struct quick_file_names *qfn = nullptr;
+};
+
+/* Read the file name information of the CU described by READER and
+   COMP_UNIT_DIE into RESULT, allocating on STORAGE.  This does not
+   modify any state shared between CUs, so different CUs may be read
+   in parallel, each with its own STORAGE.  STORAGE must eventually be
+   handed over to the per-BFD obstack.  */
 
 static void
-dw2_get_file_names_reader (const struct die_reader_specs *reader,
-			   struct die_info *comp_unit_die)
+dw2_read_file_names (const struct die_reader_specs *reader,
+		     struct die_info *comp_unit_die,
+		     struct obstack *storage,
+		     dw2_file_names_data *result)
 {
   struct dwarf2_cu *cu = reader->cu;
-  struct dwarf2_per_cu_data *this_cu = cu->per_cu;
-  dwarf2_per_objfile *per_objfile = cu->per_objfile;
-  struct dwarf2_per_cu_data *lh_cu;
   struct attribute *attr;
-  void **slot;
-  struct quick_file_names *qfn;
 
-  gdb_assert (! this_cu->is_debug_types);
+  gdb_assert (! cu->per_cu->is_debug_types);
 
-  this_cu->files_read = true;
   /* Our callers never want to match partial units -- instead they
      will match the enclosing full CU.  */
   if (comp_unit_die->tag == DW_TAG_partial_unit)
     return;
 
-  lh_cu = this_cu;
-  slot = NULL;
+  result->valid = true;
 
   line_header_up lh;
-  sect_offset line_offset {};
-
   attr = dwarf2_attr (comp_unit_die, DW_AT_stmt_list, cu);
   if (attr != nullptr && attr->form_is_unsigned ())
     {
-      struct quick_file_names find_entry;
-
-      line_offset = (sect_offset) attr->as_unsigned ();
-
-      /* We may have already read in this line header (TU line header sharing).
-	 If we have we're done.  */
-      find_entry.hash.dwo_unit = cu->dwo_unit;
-      find_entry.hash.line_sect_off = line_offset;
-      slot = htab_find_slot (per_objfile->per_bfd->quick_file_names_table.get (),
-			     &find_entry, INSERT);
-      if (*slot != NULL)
-	{
-	  lh_cu->file_names = (struct quick_file_names *) *slot;
-	  return;
-	}
-
-      lh = dwarf_decode_line_header (line_offset, cu);
+      result->has_stmt_list = true;
+      result->hash.dwo_unit = cu->dwo_unit;
+      result->hash.line_sect_off = (sect_offset) attr->as_unsigned ();
+      lh = dwarf_decode_line_header (result->hash.line_sect_off, cu);
     }
 
   file_and_directory &fnd = find_file_and_directory (comp_unit_die, cu);
@@ -2771,13 +2809,6 @@ dw2_get_file_names_reader (const struct die_reader_specs *reader,
   else if (lh == nullptr)
     return;
 
-  qfn = XOBNEW (&per_objfile->per_bfd->obstack, struct quick_file_names);
-  qfn->hash.dwo_unit = cu->dwo_unit;
-  qfn->hash.line_sect_off = line_offset;
-  /* There may not be a DW_AT_stmt_list.  */
-  if (slot != nullptr)
-    *slot = qfn;
-
   std::vector<const char *> include_names;
   if (lh != nullptr)
     {
@@ -2785,30 +2816,73 @@ dw2_get_file_names_reader (const struct die_reader_specs *reader,
 	{
 	  std::string name_holder;
 	  const char *include_name =
-	    compute_include_file_name (lh.get (), entry, fnd, name_holder);
+	    compute_include_file_name (lh.get (), entry, fnd,
+				       name_holder);
 	  if (include_name != nullptr)
-	    {
-	      include_name = per_objfile->objfile->intern (include_name);
-	      include_names.push_back (include_name);
-	    }
+	    include_names.push_back
+	      (cu->per_objfile->objfile->intern (include_name));
 	}
     }
 
+  struct quick_file_names *qfn = XOBNEW (storage, struct quick_file_names);
+  qfn->hash = result->hash;
   qfn->num_file_names = offset + include_names.size ();
-  qfn->comp_dir = fnd.intern_comp_dir (per_objfile->objfile);
-  qfn->file_names =
-    XOBNEWVEC (&per_objfile->per_bfd->obstack, const char *,
-	       qfn->num_file_names);
+  qfn->comp_dir = fnd.intern_comp_dir (cu->per_objfile->objfile);
+  qfn->file_names = XOBNEWVEC (storage, const char *, qfn->num_file_names);
   if (offset != 0)
     qfn->file_names[0] = xstrdup (fnd.get_name ());
+  std::copy (include_names.begin (), include_names.end (),
+	     qfn->file_names + offset);
+  qfn->real_names = NULL;
 
-  if (!include_names.empty ())
-    memcpy (&qfn->file_names[offset], include_names.data (),
-	    include_names.size () * sizeof (const char *));
+  result->qfn = qfn;
+}
 
-  qfn->real_names = NULL;
+/* Install the file names in DATA, previously computed by
+   dw2_read_file_names, into THIS_CU.  This must be done on the main
+   thread.  */
 
-  lh_cu->file_names = qfn;
+static void
+dw2_install_file_names (dwarf2_per_cu_data *this_cu,
+			dwarf2_per_objfile *per_objfile,
+			dw2_file_names_data *data)
+{
+  void **slot;
+
+  this_cu->files_read = true;
+  if (!data->valid)
+    return;
+
+  slot = NULL;
+
+  if (data->has_stmt_list)
+    {
+      struct quick_file_names find_entry;
+
+      /* We may have already read in this line header (TU line header sharing).
+	 If we have we're done.  */
+      find_entry.hash = data->hash;
+      slot = htab_find_slot (per_objfile->per_bfd->quick_file_names_table.get (),
+			     &find_entry, INSERT);
+      if (*slot != NULL)
+	{
+	  /* DATA->QFN itself is reclaimed along with the obstack, but
+	     the name it may own must be freed here.  */
+	  if (data->qfn != nullptr && !this_cu->fnd->is_unknown ())
+	    xfree ((char *) data->qfn->file_names[0]);
+	  this_cu->file_names = (struct quick_file_names *) *slot;
+	  return;
+	}
+    }
+
+  if (data->qfn == nullptr)
+    return;
+
+  /* There may not be a DW_AT_stmt_list.  */
+  if (slot != nullptr)
+    *slot = data->qfn;
+
+  this_cu->file_names = data->qfn;
 }
 
 /* A helper for the "quick" functions which attempts to read the line
@@ -2826,11 +2900,86 @@ dw2_get_file_names (dwarf2_per_cu_data *this_cu,
 
   cutu_reader reader (this_cu, per_objfile);
   if (!reader.dummy_p)
-    dw2_get_file_names_reader (&reader, reader.comp_unit_die);
+    {
+      dw2_file_names_data data;
+      dw2_read_file_names (&reader, reader.comp_unit_die,
+			   &per_objfile->per_bfd->obstack, &data);
+      dw2_install_file_names (this_cu, per_objfile, &data);
+    }
 
   return this_cu->file_names;
 }
 
+/* Read the file names of all the CUs of PER_OBJFILE that will be
+   needed by a search over file names, that is, those that have not
+   been expanded and whose file names were not read yet.  The line
+   headers are decoded in parallel; the results are then installed on
+   the main thread, in CU order.  Errors are ignored here: the CUs
+   concerned are left unread, so that dw2_get_file_names reports them
+   as usual.  */
+
+static void
+dw2_read_all_file_names (dwarf2_per_objfile *per_objfile)
+{
+  dwarf2_per_bfd *per_bfd = per_objfile->per_bfd;
+
+  std::vector<dwarf2_per_cu_data *> todo;
+  for (dwarf2_per_cu_data *per_cu : all_comp_units_range (per_bfd))
+    if (!per_cu->is_debug_types
+	&& !per_cu->files_read
+	&& !per_objfile->symtab_set_p (per_cu))
+      todo.push_back (per_cu);
+
+  /* Not worth the overhead of the thread pool.  */
+  if (todo.size () < 2)
+    return;
+
+  /* The sections are read lazily, which is not thread-safe.  */
+  per_bfd->map_info_sections (per_objfile->objfile);
+
+  std::vector<dw2_file_names_data> results (todo.size ());
+
+  {
+    /* Ensure that complaints are handled correctly.  */
+    complaint_interceptor complaint_handler;
+
+    /* Each thread allocates on an obstack of its own, which is then
+       handed over to the per-BFD obstack as a whole.  */
+    std::vector<std::unique_ptr<auto_obstack>> storage
+      = gdb::parallel_for_each (1, (size_t) 0, todo.size (),
+				[&] (size_t iter, size_t end)
+      {
+	std::unique_ptr<auto_obstack> thread_storage (new auto_obstack);
+	for (; iter < end; ++iter)
+	  {
+	    try
+	      {
+		cutu_reader reader (todo[iter], per_objfile);
+		if (reader.dummy_p)
+		  todo[iter] = nullptr;
+		else
+		  dw2_read_file_names (&reader, reader.comp_unit_die,
+				       thread_storage.get (), &results[iter]);
+	      }
+	    catch (const gdb_exception &except)
+	      {
+		results[iter] = dw2_file_names_data ();
+		/* Make sure dw2_get_file_names tries again.  */
+		todo[iter] = nullptr;
+	      }
+	  }
+	return thread_storage;
+      });
+
+    for (const std::unique_ptr<auto_obstack> &thread_storage : storage)
+      obstack_transfer (&per_bfd->obstack, thread_storage.get ());
+  }
+
+  for (size_t i = 0; i < todo.size (); ++i)
+    if (todo[i] != nullptr)
+      dw2_install_file_names (todo[i], per_objfile, &results[i]);
+}
+
 /* A helper for the "quick" functions which computes and caches the
    real path for a given file name from the line table.  */
 
@@ -3068,6 +3217,15 @@ dwarf2_base_index_functions::print_stats (struct objfile *objfile,
     }
   gdb_printf (_("  Number of read CUs: %d\n"), total - count);
   gdb_printf (_("  Number of unread CUs: %d\n"), count);
+
+  const tu_stats &stats = per_objfile->per_bfd->tu_stats;
+  if (stats.nr_signature_lookups > 0)
+    {
+      gdb_printf (_("  Number of type signature lookups: %d\n"),
+		  stats.nr_signature_lookups);
+      gdb_printf (_("  Number of type signature lookup misses: %d\n"),
+		  stats.nr_signature_misses);
+    }
 }
 
 /* This dumps minimal information about the index.
@@ -4088,6 +4246,10 @@ dw_expand_symtabs_matching_file_matcher
 						htab_eq_pointer,
 						NULL, xcalloc, xfree));
 
+  /* Most of the work below is reading the line headers; do that up
+     front, in parallel.  */
+  dw2_read_all_file_names (per_objfile);
+
   /* The rule is CUs specify all the files, including those used by
      any TU, so there's no need to scan TUs here.  */
 
@@ -4318,6 +4480,8 @@ dwarf2_base_index_functions::map_symbol_filenames
 	}
     }
 
+  dw2_read_all_file_names (per_objfile);
+
   for (dwarf2_per_cu_data *per_cu
 	 : all_comp_units_range (per_objfile->per_bfd))
     {
@@ -5288,6 +5452,81 @@ get_gdb_index_contents_from_cache_dwz (objfile *obj, dwz_file *dwz)
   return global_index_cache.lookup_gdb_index (build_id, &dwz->index_cache_res);
 }
 
+/* Return the build-id of the dwz file associated with PER_BFD, as a
+   string, or an empty string if there is no dwz file.  Return false
+   if the dwz file exists but has no build-id.  */
+
+static bool
+get_dwz_build_id_string (dwarf2_per_bfd *per_bfd, std::string *result)
+{
+  result->clear ();
+
+  const dwz_file *dwz = dwarf2_get_dwz_file (per_bfd);
+  if (dwz == nullptr)
+    return true;
+
+  const bfd_build_id *build_id = build_id_bfd_get (dwz->dwz_bfd.get ());
+  if (build_id == nullptr)
+    return false;
+
+  *result = build_id_to_string (build_id);
+  return true;
+}
+
+/* Look in the index cache for a cooked index for OBJ.  If one is
+   found, it is recorded in PER_BFD, to be read when the symbols are
+   needed, and true is returned.  */
+
+static bool
+find_cooked_index_in_cache (objfile *obj, dwarf2_per_bfd *per_bfd)
+{
+  const bfd_build_id *build_id = build_id_bfd_get (obj->obfd);
+  if (build_id == nullptr)
+    return false;
+
+  per_bfd->cooked_index_cache_contents
+    = global_index_cache.lookup_cooked_index (build_id,
+					      &per_bfd->index_cache_res);
+  return !per_bfd->cooked_index_cache_contents.empty ();
+}
+
+/* Try to create the cooked index for PER_OBJFILE from the contents
+   previously found by find_cooked_index_in_cache.  The units must
+   already have been created.  Return true on success.  */
+
+static bool
+read_cooked_index_from_cache (dwarf2_per_objfile *per_objfile)
+{
+  dwarf2_per_bfd *per_bfd = per_objfile->per_bfd;
+
+  if (per_bfd->cooked_index_cache_contents.empty ())
+    return false;
+
+  gdb::array_view<const gdb_byte> contents
+    = per_bfd->cooked_index_cache_contents;
+  per_bfd->cooked_index_cache_contents = {};
+
+  std::string dwz_build_id;
+  cooked_index_vector *vec = nullptr;
+  if (get_dwz_build_id_string (per_bfd, &dwz_build_id))
+    vec = (cooked_index_vector::read_cache
+	   (contents, per_bfd,
+	    dwz_build_id.empty () ? nullptr : dwz_build_id.c_str ()));
+
+  if (vec == nullptr)
+    {
+      dwarf_read_debug_printf ("cooked index from cache is stale, ignoring");
+      per_bfd->index_cache_res.reset ();
+      global_index_cache.miss ();
+      return false;
+    }
+
+  dwarf_read_debug_printf ("read cooked index from cache");
+  global_index_cache.hit ();
+  per_bfd->index_table.reset (vec);
+  return true;
+}
+
 static quick_symbol_functions_up make_cooked_index_funcs ();
 
 /* See dwarf2/public.h.  */
@@ -5342,6 +5581,17 @@ dwarf2_initialize_objfile (struct objfile *objfile)
       return;
     }
 
+  /* ... otherwise, try to find a cooked index in the index cache.
+     This is preferred to the cached .gdb_index, because it can be
+     used without any further processing.  The hit or miss is
+     recorded when the index is actually read.  */
+  if (find_cooked_index_in_cache (objfile, per_bfd))
+    {
+      dwarf_read_debug_printf ("found cooked index in cache");
+      objfile->qf.push_front (make_cooked_index_funcs ());
+      return;
+    }
+
   /* ... otherwise, try to find the index in the index cache.  */
   if (dwarf2_read_gdb_index (per_objfile,
 			     get_gdb_index_contents_from_cache,
@@ -5357,6 +5607,267 @@ dwarf2_initialize_objfile (struct objfile *objfile)
   objfile->qf.push_front (make_cooked_index_funcs ());
 }
 
+/* The "quick" symbol functions of an objfile whose separate debug
+   info has not been downloaded yet.  Lookups are answered from a
+   .gdb_index section downloaded on its own: those that can't match
+   anything in the index are answered without the debug info, and the
+   first one that may match downloads it and is forwarded to the new
+   separate debug objfile.  From then on this does nothing, since GDB
+   searches the separate debug objfile by itself.  */
+
+struct dwarf2_deferred_functions : public quick_symbol_functions
+{
+  dwarf2_deferred_functions (gdb::byte_vector &&contents,
+			     std::function<struct objfile *()> &&download)
+    : m_contents (std::move (contents)),
+      m_download (std::move (download))
+  {
+  }
+
+  /* Parse the index contents.  Return false if the index can't be
+     used.  */
+  bool read_index (struct objfile *objfile)
+  {
+    const gdb_byte *cu_list, *types_list;
+    offset_type cu_list_elements, types_list_elements;
+
+    if (m_contents.size () < 6 * sizeof (offset_type)
+	|| !read_gdb_index_from_buffer (objfile_name (objfile),
+					use_deprecated_index_sections,
+					m_contents, &m_index,
+					&cu_list, &cu_list_elements,
+					&types_list, &types_list_elements)
+	|| !m_index.version_check ())
+      return false;
+
+    struct gdbarch *gdbarch = objfile->arch ();
+    CORE_ADDR baseaddr = objfile->text_section_offset ();
+    const gdb_byte *iter = m_index.address_table.data ();
+    const gdb_byte *end = iter + m_index.address_table.size ();
+
+    for (; iter + 20 <= end; iter += 20)
+      {
+	ULONGEST lo = extract_unsigned_integer (iter, 8, BFD_ENDIAN_LITTLE);
+	ULONGEST hi = extract_unsigned_integer (iter + 8, 8,
+						BFD_ENDIAN_LITTLE);
+
+	if (lo >= hi)
+	  continue;
+
+	lo = gdbarch_adjust_dwarf2_addr (gdbarch, lo + baseaddr) - baseaddr;
+	hi = gdbarch_adjust_dwarf2_addr (gdbarch, hi + baseaddr) - baseaddr;
+	m_ranges.emplace_back (lo, hi);
+      }
+
+    return true;
+  }
+
+  bool has_symbols (struct objfile *objfile) override
+  {
+    return !m_downloaded;
+  }
+
+  bool has_unexpanded_symtabs (struct objfile *objfile) override
+  {
+    return !m_downloaded;
+  }
+
+  struct symtab *find_last_source_symtab (struct objfile *objfile) override
+  {
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile == nullptr)
+      return nullptr;
+    return debug_objfile->find_last_source_symtab ();
+  }
+
+  void forget_cached_source_info (struct objfile *objfile) override
+  {
+  }
+
+  enum language lookup_global_symbol_language (struct objfile *objfile,
+					       const char *name,
+					       domain_enum domain,
+					       bool *symbol_found_p) override
+  {
+    *symbol_found_p = false;
+
+    lookup_name_info lookup_name (name, symbol_name_match_type::FULL);
+    if (!may_match (lookup_name))
+      return language_unknown;
+
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile == nullptr)
+      return language_unknown;
+    return debug_objfile->lookup_global_symbol_language (name, domain,
+							  symbol_found_p);
+  }
+
+  void print_stats (struct objfile *objfile, bool print_bcache) override
+  {
+    if (!print_bcache)
+      gdb_printf (_("  Separate debug info download deferred: %s\n"),
+		  m_downloaded ? _("no") : _("yes"));
+  }
+
+  void dump (struct objfile *objfile) override
+  {
+    gdb_printf (".gdb_index: deferred download of separate debug info%s\n",
+		m_downloaded ? " (done)" : "");
+  }
+
+  void expand_all_symtabs (struct objfile *objfile) override
+  {
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile != nullptr)
+      debug_objfile->expand_all_symtabs ();
+  }
+
+  void expand_matching_symbols
+    (struct objfile *objfile,
+     const lookup_name_info &lookup_name,
+     domain_enum domain,
+     int global,
+     symbol_compare_ftype *ordered_compare) override
+  {
+    if (!may_match (lookup_name))
+      return;
+
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile != nullptr)
+      debug_objfile->expand_matching_symbols (lookup_name, domain, global,
+					       ordered_compare);
+  }
+
+  bool expand_symtabs_matching
+    (struct objfile *objfile,
+     gdb::function_view<expand_symtabs_file_matcher_ftype> file_matcher,
+     const lookup_name_info *lookup_name,
+     gdb::function_view<expand_symtabs_symbol_matcher_ftype> symbol_matcher,
+     gdb::function_view<expand_symtabs_exp_notify_ftype> expansion_notify,
+     block_search_flags search_flags,
+     domain_enum domain,
+     enum search_domain kind) override
+  {
+    /* The index has no file names, so only a name lookup can be
+       answered without the debug info.  */
+    if (lookup_name != nullptr && !may_match (*lookup_name, symbol_matcher))
+      return true;
+
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile == nullptr)
+      return true;
+    return debug_objfile->expand_symtabs_matching (file_matcher, lookup_name,
+						   symbol_matcher,
+						   expansion_notify,
+						   search_flags, domain,
+						   kind);
+  }
+
+  struct compunit_symtab *find_pc_sect_compunit_symtab
+    (struct objfile *objfile, struct bound_minimal_symbol msymbol,
+     CORE_ADDR pc, struct obj_section *section,
+     int warn_if_readin) override
+  {
+    CORE_ADDR unrel_pc = pc - objfile->text_section_offset ();
+    auto covers = [=] (const std::pair<CORE_ADDR, CORE_ADDR> &range)
+      {
+	return range.first <= unrel_pc && unrel_pc < range.second;
+      };
+
+    if (m_downloaded
+	|| std::find_if (m_ranges.begin (), m_ranges.end (), covers)
+	   == m_ranges.end ())
+      return nullptr;
+
+    struct objfile *debug_objfile = download ();
+    if (debug_objfile == nullptr)
+      return nullptr;
+    return debug_objfile->find_pc_sect_compunit_symtab (msymbol, pc, section,
+							warn_if_readin);
+  }
+
+  struct compunit_symtab *find_compunit_symtab_by_address
+    (struct objfile *objfile, CORE_ADDR address) override
+  {
+    return nullptr;
+  }
+
+  void map_symbol_filenames (struct objfile *objfile,
+			     gdb::function_view<symbol_filename_ftype> fun,
+			     bool need_fullname) override
+  {
+    /* Don't download the debug info just to complete or list file
+       names.  */
+  }
+
+private:
+
+  /* Return true if a symbol named LOOKUP_NAME, and accepted by
+     SYMBOL_MATCHER if it is not null, may be in the debug info.  */
+  bool may_match (const lookup_name_info &lookup_name,
+		  gdb::function_view<expand_symtabs_symbol_matcher_ftype>
+		    symbol_matcher = nullptr)
+  {
+    if (m_downloaded)
+      return false;
+
+    bool found = false;
+    dw2_expand_symtabs_matching_symbol (m_index, lookup_name, symbol_matcher,
+					[&] (offset_type idx)
+					  {
+					    found = true;
+					    return false;
+					  },
+					nullptr);
+    return found;
+  }
+
+  /* Download the separate debug info, the first time this is called.
+     Return the separate debug objfile, or nullptr if this was already
+     done or the download failed.  */
+  struct objfile *download ()
+  {
+    if (m_downloaded)
+      return nullptr;
+
+    /* Set this first, to not recurse while the debug info is read.  */
+    m_downloaded = true;
+    return m_download ();
+  }
+
+  /* The contents of the .gdb_index section, and its parsed form.  */
+  gdb::byte_vector m_contents;
+  mapped_index m_index;
+
+  /* The unrelocated address ranges covered by the index.  */
+  std::vector<std::pair<CORE_ADDR, CORE_ADDR>> m_ranges;
+
+  /* Downloads and adds the separate debug objfile.  */
+  std::function<struct objfile *()> m_download;
+
+  /* Whether the download was attempted.  */
+  bool m_downloaded = false;
+};
+
+/* See dwarf2/public.h.  */
+
+bool
+dwarf2_initialize_deferred_objfile
+  (struct objfile *objfile, gdb::byte_vector &&index,
+   std::function<struct objfile *()> &&download)
+{
+  std::unique_ptr<dwarf2_deferred_functions> qf
+    (new dwarf2_deferred_functions (std::move (index), std::move (download)));
+
+  if (!qf->read_index (objfile))
+    return false;
+
+  dwarf_read_debug_printf ("deferring separate debug info of %s",
+			   objfile_name (objfile));
+  objfile->qf.push_front (std::move (qf));
+  return true;
+}
+
 
 
 /* Build a partial symbol table.  */
@@ -5371,10 +5882,10 @@ dwarf2_build_psymtabs (struct objfile *objfile)
 
   try
     {
-      dwarf2_build_psymtabs_hard (per_objfile);
-
-      /* (maybe) store an index in the cache.  */
-      global_index_cache.store (per_objfile);
+      /* (maybe) store an index in the cache, unless the index came
+	 from there in the first place.  */
+      if (!dwarf2_build_psymtabs_hard (per_objfile))
+	global_index_cache.store (per_objfile);
     }
   catch (const gdb_exception_error &except)
     {
@@ -5462,13 +5973,18 @@ hash_signatured_type (const void *item)
   return sig_type->signature;
 }
 
+/* Compare a signatured_type in the table with a signature.  The keys
+   used to search the table are signatures, not signatured_type
+   objects, so that a lookup does not need to construct a (large)
+   signatured_type just to hold the key.  */
+
 static int
 eq_signatured_type (const void *item_lhs, const void *item_rhs)
 {
   const struct signatured_type *lhs = (const struct signatured_type *) item_lhs;
-  const struct signatured_type *rhs = (const struct signatured_type *) item_rhs;
+  const ULONGEST *rhs = (const ULONGEST *) item_rhs;
 
-  return lhs->signature == rhs->signature;
+  return lhs->signature == *rhs;
 }
 
 /* Allocate a hash table for signatured types.  */
@@ -5482,6 +5998,18 @@ allocate_signatured_type_table ()
 				     NULL, xcalloc, xfree));
 }
 
+/* Find the slot for signature SIG in TABLE, a table allocated by
+   allocate_signatured_type_table.  INSERT is as for
+   htab_find_slot.  */
+
+static void **
+find_signatured_type_slot (htab_t table, ULONGEST sig,
+			   enum insert_option insert)
+{
+  /* This must agree with hash_signatured_type.  */
+  return htab_find_slot_with_hash (table, &sig, (hashval_t) sig, insert);
+}
+
 /* A helper for create_debug_types_hash_table.  Read types from SECTION
    and fill them into TYPES_HTAB.  It will process only type units,
    therefore DW_UT_type.  */
@@ -5618,8 +6146,8 @@ add_type_unit (dwarf2_per_objfile *per_objfile, ULONGEST sig, void **slot)
 
   if (slot == NULL)
     {
-      slot = htab_find_slot (per_objfile->per_bfd->signatured_types.get (),
-			     sig_type, INSERT);
+      slot = find_signatured_type_slot
+	(per_objfile->per_bfd->signatured_types.get (), sig, INSERT);
     }
   gdb_assert (*slot == NULL);
   *slot = sig_type;
@@ -5691,9 +6219,8 @@ lookup_dwo_signatured_type (struct dwarf2_cu *cu, ULONGEST sig)
      the TU has an entry in .gdb_index, replace the recorded data from
      .gdb_index with this TU.  */
 
-  signatured_type find_sig_entry (sig);
-  slot = htab_find_slot (per_objfile->per_bfd->signatured_types.get (),
-			 &find_sig_entry, INSERT);
+  slot = find_signatured_type_slot
+    (per_objfile->per_bfd->signatured_types.get (), sig, INSERT);
   signatured_type *sig_entry = (struct signatured_type *) *slot;
 
   /* We can get here with the TU already read, *or* in the process of being
@@ -5752,9 +6279,8 @@ lookup_dwp_signatured_type (struct dwarf2_cu *cu, ULONGEST sig)
   if (per_objfile->per_bfd->signatured_types == NULL)
     per_objfile->per_bfd->signatured_types = allocate_signatured_type_table ();
 
-  signatured_type find_sig_entry (sig);
-  slot = htab_find_slot (per_objfile->per_bfd->signatured_types.get (),
-			 &find_sig_entry, INSERT);
+  slot = find_signatured_type_slot
+    (per_objfile->per_bfd->signatured_types.get (), sig, INSERT);
   signatured_type *sig_entry = (struct signatured_type *) *slot;
 
   /* Have we already tried to read this TU?
@@ -5796,12 +6322,21 @@ lookup_signatured_type (struct dwarf2_cu *cu, ULONGEST sig)
     }
   else
     {
-      if (per_objfile->per_bfd->signatured_types == NULL)
-	return NULL;
-      signatured_type find_entry (sig);
-      return ((struct signatured_type *)
-	      htab_find (per_objfile->per_bfd->signatured_types.get (),
-			 &find_entry));
+      tu_stats *stats = &per_objfile->per_bfd->tu_stats;
+      struct signatured_type *result = nullptr;
+
+      if (per_objfile->per_bfd->signatured_types != NULL)
+	{
+	  void **slot = find_signatured_type_slot
+	    (per_objfile->per_bfd->signatured_types.get (), sig, NO_INSERT);
+	  if (slot != nullptr)
+	    result = (struct signatured_type *) *slot;
+	}
+
+      ++stats->nr_signature_lookups;
+      if (result == nullptr)
+	++stats->nr_signature_misses;
+      return result;
     }
 }
 
@@ -6988,9 +7523,9 @@ process_skeletonless_type_unit (void **slot, void *info)
     data->per_objfile->per_bfd->signatured_types
       = allocate_signatured_type_table ();
 
-  signatured_type find_entry (dwo_unit->signature);
-  slot = htab_find_slot (data->per_objfile->per_bfd->signatured_types.get (),
-			 &find_entry, INSERT);
+  slot = find_signatured_type_slot
+    (data->per_objfile->per_bfd->signatured_types.get (),
+     dwo_unit->signature, INSERT);
   /* If we've already seen this type there's nothing to do.  What's happening
      is we're doing our own version of comdat-folding here.  */
   if (*slot != NULL)
@@ -7046,9 +7581,10 @@ process_skeletonless_type_units (dwarf2_per_objfile *per_objfile,
 }
 
 /* Build the partial symbol table by doing a quick pass through the
-   .debug_info and .debug_abbrev sections.  */
+   .debug_info and .debug_abbrev sections.  Return true if the index
+   was instead read from the index cache.  */
 
-static void
+static bool
 dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile)
 {
   struct objfile *objfile = per_objfile->objfile;
@@ -7061,11 +7597,23 @@ dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile)
 
   cooked_index_storage index_storage;
   create_all_comp_units (per_objfile);
+  per_bfd->quick_file_names_table
+    = create_quick_file_names_table (per_bfd->all_comp_units.size ());
+
+  if (read_cooked_index_from_cache (per_objfile))
+    {
+      cooked_index_vector *vec
+	= static_cast<cooked_index_vector *> (per_bfd->index_table.get ());
+      const cooked_index_entry *main_entry = vec->get_main ();
+      if (main_entry != nullptr)
+	set_objfile_main_name (objfile, main_entry->name,
+			       main_entry->per_cu->lang ());
+      return true;
+    }
+
   build_type_psymtabs (per_objfile, &index_storage);
   std::vector<std::unique_ptr<cooked_index>> indexes;
 
-  per_bfd->quick_file_names_table
-    = create_quick_file_names_table (per_bfd->all_comp_units.size ());
   if (!per_bfd->debug_aranges.empty ())
     read_addrmap_from_aranges (per_objfile, &per_bfd->debug_aranges,
 			       index_storage.get_addrmap ());
@@ -7076,6 +7624,14 @@ dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile)
 
     using iter_type = decltype (per_bfd->all_comp_units.begin ());
 
+    /* Units vary a lot in size, so split the work by the size of the
+       units rather than by their number.  */
+    auto unit_size = [] (iter_type iter)
+      {
+	return (size_t) std::max ((*iter)->length, 1u);
+      };
+    gdb::function_view<size_t (iter_type)> task_size = unit_size;
+
     /* Each thread returns a pair holding a cooked index, and a vector
        of errors that should be printed.  The latter is done because
        GDB's I/O system is not thread-safe.  run_on_main_thread could be
@@ -7103,8 +7659,15 @@ dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile)
 		errors.push_back (std::move (except));
 	      }
 	  }
-	return result_type (thread_storage.release (), std::move (errors));
-      });
+	/* Start finalizing this shard right away, so that it overlaps
+	   with the indexing still being done by the other workers.
+	   Only the last shard to finish then delays the first
+	   lookup.  */
+	std::unique_ptr<cooked_index> shard = thread_storage.release ();
+	if (shard != nullptr)
+	  shard->finalize ();
+	return result_type (std::move (shard), std::move (errors));
+      }, task_size);
 
     /* Only show a given exception a single time.  */
     std::unordered_set<gdb_exception> seen_exceptions;
@@ -7146,6 +7709,7 @@ dwarf2_build_psymtabs_hard (dwarf2_per_objfile *per_objfile)
 
   dwarf_read_debug_printf ("Done building psymtabs of %s",
 			   objfile_name (objfile));
+  return false;
 }
 
 static void
@@ -7192,7 +7756,9 @@ read_comp_units_from_section (dwarf2_per_objfile *per_objfile,
 	  sig_type->type_offset_in_tu = cu_header.type_cu_offset_in_tu;
 	  this_cu.reset (sig_type.release ());
 
-	  void **slot = htab_find_slot (types_htab.get (), sig_ptr, INSERT);
+	  void **slot = find_signatured_type_slot (types_htab.get (),
+						   cu_header.signature,
+						   INSERT);
 	  gdb_assert (slot != nullptr);
 	  if (*slot != nullptr)
 	    complaint (_("debug type entry at offset %s is duplicate to"
@@ -7626,27 +8192,20 @@ process_queue (dwarf2_per_objfile *per_objfile)
 			   objfile_name (per_objfile->objfile));
 }
 
-/* Trivial hash function for die_info: the hash value of a DIE
-   is its offset in .debug_info for this objfile.  */
+/* See cu.h.  */
 
-static hashval_t
-die_hash (const void *item)
+hashval_t
+die_hash_traits::hash (die_info *const &die)
 {
-  const struct die_info *die = (const struct die_info *) item;
-
   return to_underlying (die->sect_off);
 }
 
-/* Trivial comparison function for die_info structures: two DIEs
-   are equal if they have the same offset.  */
+/* See cu.h.  */
 
-static int
-die_eq (const void *item_lhs, const void *item_rhs)
+bool
+die_hash_traits::equal (die_info *const &die, sect_offset sect_off)
 {
-  const struct die_info *die_lhs = (const struct die_info *) item_lhs;
-  const struct die_info *die_rhs = (const struct die_info *) item_rhs;
-
-  return die_lhs->sect_off == die_rhs->sect_off;
+  return die->sect_off == sect_off;
 }
 
 /* Load the DIEs associated with PER_CU into memory.
@@ -7672,15 +8231,8 @@ load_full_comp_unit (dwarf2_per_cu_data *this_cu,
   struct dwarf2_cu *cu = reader.cu;
   const gdb_byte *info_ptr = reader.info_ptr;
 
-  gdb_assert (cu->die_hash == NULL);
-  cu->die_hash =
-    htab_create_alloc_ex (cu->header.length / 12,
-			  die_hash,
-			  die_eq,
-			  NULL,
-			  &cu->comp_unit_obstack,
-			  hashtab_obstack_allocate,
-			  dummy_obstack_deallocate);
+  gdb_assert (cu->die_hash.empty ());
+  cu->die_hash.reserve (cu->header.length / 12);
 
   if (reader.comp_unit_die->has_children)
     reader.comp_unit_die->child
@@ -8342,6 +8894,8 @@ process_full_comp_unit (dwarf2_cu *cu, enum language pretend_language)
   struct block *static_block;
   CORE_ADDR addr;
 
+  dwarf2_cus_expanded_counter.add ();
+
   baseaddr = objfile->text_section_offset ();
 
   /* Clear the list here in case something was left over.  */
@@ -8451,6 +9005,8 @@ process_full_type_unit (dwarf2_cu *cu,
   struct compunit_symtab *cust;
   struct signatured_type *sig_type;
 
+  dwarf2_cus_expanded_counter.add ();
+
   gdb_assert (cu->per_cu->is_debug_types);
   sig_type = (struct signatured_type *) cu->per_cu;
 
@@ -18556,18 +19112,39 @@ cooked_index_functions::expand_matching_symbols
   cooked_index_vector *table
     = (static_cast<cooked_index_vector *>
        (per_objfile->per_bfd->index_table.get ()));
-  for (const cooked_index_entry *entry : table->all_entries ())
+
+  auto maybe_expand = [&] (const cooked_index_entry *entry)
     {
       if (entry->parent_entry != nullptr)
-	continue;
+	return;
 
       if (!entry->matches (search_flags)
 	  || !entry->matches (domain))
-	continue;
+	return;
 
       if (name_match (entry->canonical, lookup_name, nullptr))
 	dw2_instantiate_symtab (entry->per_cu, per_objfile, false);
+    };
+
+  /* A wild match only depends on the last component of the name, so
+     the index can find the candidates directly.  */
+  if (lookup_name.match_type () != symbol_name_match_type::SEARCH_NAME
+      && !lookup_name.completion_mode ()
+      && lookup_name.ada ().wild_match_p ())
+    {
+      std::vector<gdb::string_view> name_vec
+	= lookup_name.ada ().split_name ();
+      if (!name_vec.empty () && !name_vec.back ().empty ())
+	{
+	  for (const cooked_index_entry *entry
+		 : table->find_wild (name_vec.back ()))
+	    maybe_expand (entry);
+	  return;
+	}
     }
+
+  for (const cooked_index_entry *entry : table->all_entries ())
+    maybe_expand (entry);
 }
 
 bool
@@ -18628,29 +19205,30 @@ cooked_index_functions::expand_symtabs_matching
       std::vector<gdb::string_view> name_vec
 	= lookup_name_without_params.split_name (lang);
 
-      for (const cooked_index_entry *entry : table->find (name_vec.back (),
-							  completing))
+      /* Return true if ENTRY is a candidate for expansion.  This only
+	 reads the index and the per-objfile data, so that it can be
+	 called from worker threads.  SYMBOL_MATCHER, if any, must be
+	 checked separately by the caller.  */
+      auto entry_matches = [&] (const cooked_index_entry *entry)
 	{
 	  /* No need to consider symbols from expanded CUs.  */
 	  if (per_objfile->symtab_set_p (entry->per_cu))
-	    continue;
+	    return false;
 
 	  /* If file-matching was done, we don't need to consider
 	     symbols from unmarked CUs.  */
 	  if (file_matcher != nullptr && !entry->per_cu->mark)
-	    continue;
+	    return false;
 
 	  /* See if the symbol matches the type filter.  */
 	  if (!entry->matches (search_flags)
 	      || !entry->matches (domain)
 	      || !entry->matches (kind))
-	    continue;
+	    return false;
 
 	  /* We've found the base name of the symbol; now walk its
 	     parentage chain, ensuring that each component
 	     matches.  */
-	  bool found = true;
-
 	  const cooked_index_entry *parent = entry->parent_entry;
 	  for (int i = name_vec.size () - 1; i > 0; --i)
 	    {
@@ -18659,17 +19237,11 @@ cooked_index_functions::expand_symtabs_matching
 	      if (parent == nullptr
 		  || strncmp (parent->name, name_vec[i - 1].data (),
 			      name_vec[i - 1].length ()) != 0)
-		{
-		  found = false;
-		  break;
-		}
+		return false;
 
 	      parent = parent->parent_entry;
 	    }
 
-	  if (!found)
-	    continue;
-
 	  /* Might have been looking for "a::b" and found
 	     "x::a::b".  */
 	  if (symbol_matcher == nullptr)
@@ -18680,9 +19252,78 @@ cooked_index_functions::expand_symtabs_matching
 		   || (lang != language_ada
 		       && match_type == symbol_name_match_type::EXPRESSION))
 		  && parent != nullptr)
-		continue;
+		return false;
 	    }
-	  else
+
+	  return true;
+	};
+
+      /* When completing, a short prefix can match a large part of the
+	 index, so the candidates are filtered in parallel.  The CUs
+	 are still expanded in the main thread, in index order.  This
+	 isn't done when there is a SYMBOL_MATCHER, unless the caller
+	 has said that it is safe to call it from another thread.  */
+      if (completing
+	  && (symbol_matcher == nullptr
+	      || (search_flags & SEARCH_PARALLEL_MATCHER) != 0))
+	{
+	  std::vector<const cooked_index_entry *> entries;
+	  for (const cooked_index_entry *entry : table->find (name_vec.back (),
+							      true))
+	    entries.push_back (entry);
+
+	  using cu_vector = std::vector<dwarf2_per_cu_data *>;
+	  using iter_type = decltype (entries.begin ());
+	  std::vector<cu_vector> results
+	    = gdb::parallel_for_each (1000, entries.begin (), entries.end (),
+				      [&] (iter_type iter, iter_type end)
+	      {
+		cu_vector result;
+		auto_obstack temp_storage;
+		for (; iter != end; ++iter)
+		  {
+		    if (!entry_matches (*iter)
+			|| (!result.empty ()
+			    && result.back () == (*iter)->per_cu))
+		      continue;
+
+		    if (symbol_matcher != nullptr)
+		      {
+			const char *full_name
+			  = (*iter)->full_name (&temp_storage);
+			bool matched = symbol_matcher (full_name);
+			if (full_name != (*iter)->canonical)
+			  obstack_free (&temp_storage, (void *) full_name);
+			if (!matched)
+			  continue;
+		      }
+
+		    result.push_back ((*iter)->per_cu);
+		  }
+		return result;
+	      });
+
+	  for (const cu_vector &result : results)
+	    for (dwarf2_per_cu_data *per_cu : result)
+	      {
+		QUIT;
+
+		if (!dw2_expand_symtabs_matching_one (per_cu, per_objfile,
+						      file_matcher,
+						      expansion_notify))
+		  return false;
+	      }
+
+	  continue;
+	}
+
+      for (const cooked_index_entry *entry : table->find (name_vec.back (),
+							  completing))
+	{
+	  if (!entry_matches (entry))
+	    continue;
+
+	  if (symbol_matcher != nullptr)
 	    {
 	      auto_obstack temp_storage;
 	      const char *full_name = entry->full_name (&temp_storage);
@@ -22171,13 +22812,8 @@ dump_die (struct die_info *die, int max_level)
 static void
 store_in_ref_table (struct die_info *die, struct dwarf2_cu *cu)
 {
-  void **slot;
-
-  slot = htab_find_slot_with_hash (cu->die_hash, die,
-				   to_underlying (die->sect_off),
-				   INSERT);
-
-  *slot = die;
+  cu->die_hash.find_or_insert (die->sect_off,
+			       to_underlying (die->sect_off)) = die;
 }
 
 /* Follow reference or signature attribute ATTR of SRC_DIE.
@@ -22213,7 +22849,6 @@ static struct die_info *
 follow_die_offset (sect_offset sect_off, int offset_in_dwz,
 		   struct dwarf2_cu **ref_cu)
 {
-  struct die_info temp_die;
   struct dwarf2_cu *target_cu, *cu = *ref_cu;
   dwarf2_per_objfile *per_objfile = cu->per_objfile;
 
@@ -22269,11 +22904,9 @@ follow_die_offset (sect_offset sect_off, int offset_in_dwz,
     }
 
   *ref_cu = target_cu;
-  temp_die.sect_off = sect_off;
-
-  return (struct die_info *) htab_find_with_hash (target_cu->die_hash,
-						  &temp_die,
-						  to_underlying (sect_off));
+  die_info **slot = target_cu->die_hash.find (sect_off,
+					       to_underlying (sect_off));
+  return slot == nullptr ? nullptr : *slot;
 }
 
 /* Follow reference attribute ATTR of SRC_DIE.
@@ -22622,7 +23255,6 @@ static struct die_info *
 follow_die_sig_1 (struct die_info *src_die, struct signatured_type *sig_type,
 		  struct dwarf2_cu **ref_cu)
 {
-  struct die_info temp_die;
   struct dwarf2_cu *sig_cu;
   struct die_info *die;
   dwarf2_per_objfile *per_objfile = (*ref_cu)->per_objfile;
@@ -22645,9 +23277,9 @@ follow_die_sig_1 (struct die_info *src_die, struct signatured_type *sig_type,
   sig_cu = per_objfile->get_cu (sig_type);
   gdb_assert (sig_cu != NULL);
   gdb_assert (to_underlying (sig_type->type_offset_in_section) != 0);
-  temp_die.sect_off = sig_type->type_offset_in_section;
-  die = (struct die_info *) htab_find_with_hash (sig_cu->die_hash, &temp_die,
-						 to_underlying (temp_die.sect_off));
+  sect_offset sect_off = sig_type->type_offset_in_section;
+  die_info **slot = sig_cu->die_hash.find (sect_off, to_underlying (sect_off));
+  die = slot == nullptr ? nullptr : *slot;
   if (die)
     {
       /* For .gdb_index version 7 keep track of included TUs.
@@ -22835,15 +23467,8 @@ read_signatured_type (signatured_type *sig_type,
       struct dwarf2_cu *cu = reader.cu;
       const gdb_byte *info_ptr = reader.info_ptr;
 
-      gdb_assert (cu->die_hash == NULL);
-      cu->die_hash =
-	htab_create_alloc_ex (cu->header.length / 12,
-			      die_hash,
-			      die_eq,
-			      NULL,
-			      &cu->comp_unit_obstack,
-			      hashtab_obstack_allocate,
-			      dummy_obstack_deallocate);
+      gdb_assert (cu->die_hash.empty ());
+      cu->die_hash.reserve (cu->header.length / 12);
 
       if (reader.comp_unit_die->has_children)
 	reader.comp_unit_die->child
@@ -23315,6 +23940,7 @@ fill_in_loclist_baton (struct dwarf2_cu *cu,
   else
     baton->base_address = 0;
   baton->from_dwo = cu->dwo_unit != NULL;
+  baton->cached_valid = false;
 }
 
 static void
@@ -23630,15 +24256,41 @@ dwarf2_per_objfile::age_comp_units ()
   for (const auto &pair : m_dwarf2_cus)
     pair.second->clear_mark ();
 
-  /* Traverse all CUs, mark them and their dependencies if used recently
-     enough.  */
+  /* Traverse all CUs, from the most recently used, and mark them and
+     their dependencies if used recently enough.  If the cache has a
+     size limit, stop once the marked CUs use that much memory; the
+     most recently used CU is always kept.  */
+  std::vector<dwarf2_cu *> cus;
+  cus.reserve (m_dwarf2_cus.size ());
   for (const auto &pair : m_dwarf2_cus)
     {
       dwarf2_cu *cu = pair.second.get ();
 
       cu->last_used++;
-      if (cu->last_used <= dwarf_max_cache_age)
-	cu->mark ();
+      cus.push_back (cu);
+    }
+  std::stable_sort (cus.begin (), cus.end (),
+		    [] (const dwarf2_cu *a, const dwarf2_cu *b)
+		    {
+		      return a->last_used < b->last_used;
+		    });
+
+  /* The memory used by the CUs marked so far.  */
+  ULONGEST used = 0;
+  for (dwarf2_cu *cu : cus)
+    {
+      if (cu->last_used > dwarf_max_cache_age)
+	break;
+
+      if (cu->is_marked ())
+	continue;
+
+      if (dwarf_max_cache_size != ULONGEST_MAX
+	  && cu != cus.front ()
+	  && used + cu->memory_used () > dwarf_max_cache_size)
+	break;
+
+      used += cu->mark ();
     }
 
   /* Delete all CUs still not marked.  */
@@ -23891,6 +24543,20 @@ caching, which can slow down startup."),
 			    &set_dwarf_cmdlist,
 			    &show_dwarf_cmdlist);
 
+  add_setshow_zulongest_unlimited_cmd ("max-cache-size", class_obscure,
+				       &dwarf_max_cache_size, _("\
+Set the upper bound on the memory used by cached DWARF compilation units."),
+				       _("\
+Show the upper bound on the memory used by cached DWARF compilation units."),
+				       _("\
+When the compilation units cached in memory use more than this many\n\
+bytes, the least recently used ones are released, regardless of their\n\
+age.  \"unlimited\" means that only max-cache-age limits the cache."),
+				       NULL,
+				       show_dwarf_max_cache_size,
+				       &set_dwarf_cmdlist,
+				       &show_dwarf_cmdlist);
+
   add_setshow_zuinteger_cmd ("dwarf-read", no_class, &dwarf_read_debug, _("\
 Set debugging of the DWARF reader."), _("\
 Show debugging of the DWARF reader."), _("\
@@ -46,6 +46,10 @@ struct tu_stats
   int nr_stmt_less_type_units;
   int nr_all_type_units_reallocs;
   int nr_tus;
+  /* Lookups done by lookup_signatured_type, and how many of them did
+     not find the signature; see "maint print statistics".  */
+  int nr_signature_lookups;
+  int nr_signature_misses;
 };
 
 struct dwarf2_cu;
@@ -306,9 +310,12 @@ struct dwarf2_per_cu_data
       gdb_assert (m_dwarf_version == version);
   }
 
-  dwarf_unit_type unit_type () const
+  /* Return the unit type of this CU.  If STRICT_P is false, the
+     result may be zero, meaning that the type is not yet known.  */
+  dwarf_unit_type unit_type (bool strict_p = true) const
   {
-    gdb_assert (m_unit_type != 0);
+    if (strict_p)
+      gdb_assert (m_unit_type != 0);
     return m_unit_type;
   }
 
@@ -322,9 +329,13 @@ struct dwarf2_per_cu_data
       gdb_assert (m_unit_type == unit_type);
   }
 
-  enum language lang () const
+  /* Return the language of this CU.  If STRICT_P is false, the
+     result may be language_unknown, meaning that the language is not
+     yet known.  */
+  enum language lang (bool strict_p = true) const
   {
-    gdb_assert (m_lang != language_unknown);
+    if (strict_p)
+      gdb_assert (m_lang != language_unknown);
     return m_lang;
   }
 
@@ -508,6 +519,11 @@ struct dwarf2_per_bfd
      resources associated to the open file, memory mapping, etc.  */
   std::unique_ptr<index_cache_resource> index_cache_res;
 
+  /* If a cooked index was found in the index cache, this holds its
+     contents.  It is only used when the index is actually read, and
+     the memory is owned by INDEX_CACHE_RES.  */
+  gdb::array_view<const gdb_byte> cooked_index_cache_contents;
+
   /* Mapping from abstract origin DIE to concrete DIEs that reference it as
      DW_AT_abstract_origin.  */
   std::unordered_map<sect_offset, std::vector<sect_offset>,
@@ -1173,6 +1173,86 @@ elf_read_minimal_symbols (struct objfile *objfile, int symfile_flags,
     gdb_printf (gdb_stdlog, "Done reading minimal symbols.\n");
 }
 
+/* Download the separate debug info of OBJFILE, whose build-id is
+   BUILD_ID, from debuginfod, and add it as a separate debug objfile.
+   Return it, or nullptr on failure.  */
+
+static struct objfile *
+elf_add_debuginfod_debug_file (struct objfile *objfile,
+			       const struct bfd_build_id *build_id,
+			       symfile_add_flags symfile_flags)
+{
+  gdb::unique_xmalloc_ptr<char> symfile_path;
+  scoped_fd fd (debuginfod_debuginfo_query (build_id->data, build_id->size,
+					    objfile->original_name,
+					    &symfile_path));
+  if (fd.get () < 0)
+    return nullptr;
+
+  gdb_bfd_ref_ptr debug_bfd (symfile_bfd_open (symfile_path.get ()));
+  if (debug_bfd == nullptr)
+    {
+      warning (_("File \"%s\" from debuginfod cannot be opened as bfd"),
+	       objfile->original_name);
+      return nullptr;
+    }
+
+  if (!build_id_verify (debug_bfd.get (), build_id->size, build_id->data))
+    return nullptr;
+
+  symbol_file_add_separate (debug_bfd.get (), symfile_path.get (),
+			    symfile_flags, objfile);
+  return objfile->separate_debug_objfile;
+}
+
+/* Try to defer the download of the separate debug info of OBJFILE,
+   whose build-id is BUILD_ID, until a symbol lookup needs it, by
+   downloading only its .gdb_index section from debuginfod for now.
+   Return true if the download was deferred.  */
+
+static bool
+elf_defer_debuginfod_download (struct objfile *objfile,
+			       const struct bfd_build_id *build_id,
+			       symfile_add_flags symfile_flags)
+{
+  gdb::unique_xmalloc_ptr<char> index_path;
+  scoped_fd fd (debuginfod_section_query (build_id->data, build_id->size,
+					  objfile->original_name, ".gdb_index",
+					  &index_path));
+  if (fd.get () < 0)
+    return false;
+
+  struct stat st;
+  if (fstat (fd.get (), &st) < 0)
+    return false;
+
+  gdb::byte_vector contents (st.st_size);
+  size_t done = 0;
+  while (done < contents.size ())
+    {
+      ssize_t n = read (fd.get (), contents.data () + done,
+			contents.size () - done);
+      if (n <= 0)
+	return false;
+      done += n;
+    }
+
+  /* The download happens in the middle of a symbol lookup, so it must
+     neither be treated as a new main symbol file nor re-set the
+     breakpoints; the lookup that triggered it is forwarded to the new
+     objfile instead.  */
+  symfile_flags &= ~(SYMFILE_MAINLINE | SYMFILE_VERBOSE);
+  symfile_flags |= SYMFILE_DEFER_BP_RESET;
+
+  return dwarf2_initialize_deferred_objfile
+    (objfile, std::move (contents),
+     [=] ()
+       {
+	 return elf_add_debuginfod_debug_file (objfile, build_id,
+					       symfile_flags);
+       });
+}
+
 /* Scan and build partial symbols for a symbol file.
    We have been initialized by a call to elf_symfile_init, which
    currently does nothing.
@@ -1286,30 +1366,14 @@ elf_symfile_read (struct objfile *objfile, symfile_add_flags symfile_flags)
 	  has_dwarf2 = false;
 	  const struct bfd_build_id *build_id = build_id_bfd_get (objfile->obfd);
 
-	  if (build_id != nullptr)
-	    {
-	      gdb::unique_xmalloc_ptr<char> symfile_path;
-	      scoped_fd fd (debuginfod_debuginfo_query (build_id->data,
-							build_id->size,
-							objfile->original_name,
-							&symfile_path));
-
-	      if (fd.get () >= 0)
-		{
-		  /* File successfully retrieved from server.  */
-		  gdb_bfd_ref_ptr debug_bfd (symfile_bfd_open (symfile_path.get ()));
-
-		  if (debug_bfd == nullptr)
-		    warning (_("File \"%s\" from debuginfod cannot be opened as bfd"),
-			     objfile->original_name);
-		  else if (build_id_verify (debug_bfd.get (), build_id->size, build_id->data))
-		    {
-		      symbol_file_add_separate (debug_bfd.get (), symfile_path.get (),
-						symfile_flags, objfile);
-		      has_dwarf2 = true;
-		    }
-		}
-	    }
+	  if (build_id != nullptr
+	      && elf_defer_debuginfod_download (objfile, build_id,
+						symfile_flags))
+	    has_dwarf2 = true;
+	  else if (build_id != nullptr
+		   && elf_add_debuginfod_debug_file (objfile, build_id,
+						     symfile_flags) != nullptr)
+	    has_dwarf2 = true;
 	}
     }
 
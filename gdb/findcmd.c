@@ -55,15 +55,16 @@ put_bits (uint64_t data, gdb::byte_vector &buf, int bits, bfd_boolean big_p)
 static gdb::byte_vector
 parse_find_args (const char *args, ULONGEST *max_countp,
 		 CORE_ADDR *start_addrp, ULONGEST *search_space_lenp,
-		 bfd_boolean big_p)
+		 bool *all_regionsp, bfd_boolean big_p)
 {
   /* Default to using the specified type.  */
   char size = '\0';
   ULONGEST max_count = ~(ULONGEST) 0;
   /* Buffer to hold the search pattern.  */
   gdb::byte_vector pattern_buf;
-  CORE_ADDR start_addr;
-  ULONGEST search_space_len;
+  CORE_ADDR start_addr = 0;
+  ULONGEST search_space_len = 0;
+  bool all_regions = false;
   const char *s = args;
   struct value *v;
 
@@ -95,6 +96,10 @@ parse_find_args (const char *args, ULONGEST *max_countp,
 	    case 'g':
 	      size = *s++;
 	      break;
+	    case 'a':
+	      all_regions = true;
+	      ++s;
+	      break;
 	    default:
 	      error (_("Invalid size granularity."));
 	    }
@@ -103,50 +108,54 @@ parse_find_args (const char *args, ULONGEST *max_countp,
       s = skip_spaces (s);
     }
 
-  /* Get the search range.  */
+  /* Get the search range, unless all the memory regions are to be
+     searched.  */
 
-  v = parse_to_comma_and_eval (&s);
-  start_addr = value_as_address (v);
+  if (!all_regions)
+    {
+      v = parse_to_comma_and_eval (&s);
+      start_addr = value_as_address (v);
 
-  if (*s == ',')
-    ++s;
-  s = skip_spaces (s);
+      if (*s == ',')
+	++s;
+      s = skip_spaces (s);
 
-  if (*s == '+')
-    {
-      LONGEST len;
+      if (*s == '+')
+	{
+	  LONGEST len;
 
-      ++s;
-      v = parse_to_comma_and_eval (&s);
-      len = value_as_long (v);
-      if (len == 0)
+	  ++s;
+	  v = parse_to_comma_and_eval (&s);
+	  len = value_as_long (v);
+	  if (len == 0)
+	    {
+	      gdb_printf (_("Empty search range.\n"));
+	      return pattern_buf;
+	    }
+	  if (len < 0)
+	    error (_("Invalid length."));
+	  /* Watch for overflows.  */
+	  if (len > CORE_ADDR_MAX
+	      || (start_addr + len - 1) < start_addr)
+	    error (_("Search space too large."));
+	  search_space_len = len;
+	}
+      else
 	{
-	  gdb_printf (_("Empty search range.\n"));
-	  return pattern_buf;
+	  CORE_ADDR end_addr;
+
+	  v = parse_to_comma_and_eval (&s);
+	  end_addr = value_as_address (v);
+	  if (start_addr > end_addr)
+	    error (_("Invalid search space, end precedes start."));
+	  search_space_len = end_addr - start_addr + 1;
+	  /* We don't support searching all of memory
+	     (i.e. start=0, end = 0xff..ff).
+	     Bail to avoid overflows later on.  */
+	  if (search_space_len == 0)
+	    error (_("Overflow in address range "
+		     "computation, choose smaller range."));
 	}
-      if (len < 0)
-	error (_("Invalid length."));
-      /* Watch for overflows.  */
-      if (len > CORE_ADDR_MAX
-	  || (start_addr + len - 1) < start_addr)
-	error (_("Search space too large."));
-      search_space_len = len;
-    }
-  else
-    {
-      CORE_ADDR end_addr;
-
-      v = parse_to_comma_and_eval (&s);
-      end_addr = value_as_address (v);
-      if (start_addr > end_addr)
-	error (_("Invalid search space, end precedes start."));
-      search_space_len = end_addr - start_addr + 1;
-      /* We don't support searching all of memory
-	 (i.e. start=0, end = 0xff..ff).
-	 Bail to avoid overflows later on.  */
-      if (search_space_len == 0)
-	error (_("Overflow in address range "
-		 "computation, choose smaller range."));
     }
 
   if (*s == ',')
@@ -198,42 +207,29 @@ parse_find_args (const char *args, ULONGEST *max_countp,
   if (pattern_buf.empty ())
     error (_("Missing search pattern."));
 
-  if (search_space_len < pattern_buf.size ())
+  if (!all_regions && search_space_len < pattern_buf.size ())
     error (_("Search space too small to contain pattern."));
 
   *max_countp = max_count;
   *start_addrp = start_addr;
   *search_space_lenp = search_space_len;
+  *all_regionsp = all_regions;
 
   return pattern_buf;
 }
 
+/* Search SEARCH_SPACE_LEN bytes of memory at START_ADDR for PATTERN,
+   printing each match, until *FOUND_COUNTP reaches MAX_COUNT.
+   *FOUND_COUNTP and *LAST_FOUND_ADDRP are updated with the matches.  */
+
 static void
-find_command (const char *args, int from_tty)
+find_in_range (struct gdbarch *gdbarch, CORE_ADDR start_addr,
+	       ULONGEST search_space_len, const gdb::byte_vector &pattern_buf,
+	       ULONGEST max_count, unsigned int *found_countp,
+	       CORE_ADDR *last_found_addrp)
 {
-  struct gdbarch *gdbarch = get_current_arch ();
-  bfd_boolean big_p = gdbarch_byte_order (gdbarch) == BFD_ENDIAN_BIG;
-  /* Command line parameters.
-     These are initialized to avoid uninitialized warnings from -Wall.  */
-  ULONGEST max_count = 0;
-  CORE_ADDR start_addr = 0;
-  ULONGEST search_space_len = 0;
-  /* End of command line parameters.  */
-  unsigned int found_count;
-  CORE_ADDR last_found_addr;
-
-  gdb::byte_vector pattern_buf = parse_find_args (args, &max_count,
-						  &start_addr,
-						  &search_space_len,
-						  big_p);
-
-  /* Perform the search.  */
-
-  found_count = 0;
-  last_found_addr = 0;
-
   while (search_space_len >= pattern_buf.size ()
-	 && found_count < max_count)
+	 && *found_countp < max_count)
     {
       /* Offset from start of this iteration to the next iteration.  */
       ULONGEST next_iter_incr;
@@ -248,8 +244,8 @@ find_command (const char *args, int from_tty)
 
       print_address (gdbarch, found_addr, gdb_stdout);
       gdb_printf ("\n");
-      ++found_count;
-      last_found_addr = found_addr;
+      ++*found_countp;
+      *last_found_addrp = found_addr;
 
       /* Begin next iteration at one byte past this match.  */
       next_iter_incr = (found_addr - start_addr) + 1;
@@ -261,6 +257,66 @@ find_command (const char *args, int from_tty)
 	search_space_len = 0;
       start_addr += next_iter_incr;
     }
+}
+
+/* Callback for target_find_memory_regions, used by "find /a".  Add
+   the readable regions to the vector pointed to by DATA.  */
+
+static int
+find_add_memory_region (CORE_ADDR vaddr, unsigned long size, int read,
+			int write, int exec, int modified, void *data)
+{
+  auto *regions = (std::vector<std::pair<CORE_ADDR, ULONGEST>> *) data;
+
+  if (read && size > 0)
+    regions->emplace_back (vaddr, size);
+  return 0;
+}
+
+static void
+find_command (const char *args, int from_tty)
+{
+  struct gdbarch *gdbarch = get_current_arch ();
+  bfd_boolean big_p = gdbarch_byte_order (gdbarch) == BFD_ENDIAN_BIG;
+  /* Command line parameters.
+     These are initialized to avoid uninitialized warnings from -Wall.  */
+  ULONGEST max_count = 0;
+  CORE_ADDR start_addr = 0;
+  ULONGEST search_space_len = 0;
+  bool all_regions = false;
+  /* End of command line parameters.  */
+  unsigned int found_count;
+  CORE_ADDR last_found_addr;
+
+  gdb::byte_vector pattern_buf = parse_find_args (args, &max_count,
+						  &start_addr,
+						  &search_space_len,
+						  &all_regions,
+						  big_p);
+
+  /* Perform the search.  */
+
+  found_count = 0;
+  last_found_addr = 0;
+
+  if (all_regions)
+    {
+      std::vector<std::pair<CORE_ADDR, ULONGEST>> regions;
+
+      if (target_find_memory_regions (find_add_memory_region, &regions) != 0)
+	error (_("Can't find the memory regions of the inferior."));
+      std::sort (regions.begin (), regions.end ());
+
+      for (const auto &region : regions)
+	{
+	  QUIT;
+	  find_in_range (gdbarch, region.first, region.second, pattern_buf,
+			 max_count, &found_count, &last_found_addr);
+	}
+    }
+  else
+    find_in_range (gdbarch, start_addr, search_space_len, pattern_buf,
+		   max_count, &found_count, &last_found_addr);
 
   /* Record and print the results.  */
 
@@ -289,10 +345,13 @@ Search memory for a sequence of bytes.\n\
 Usage:\nfind \
 [/SIZE-CHAR] [/MAX-COUNT] START-ADDRESS, END-ADDRESS, EXPR1 [, EXPR2 ...]\n\
 find [/SIZE-CHAR] [/MAX-COUNT] START-ADDRESS, +LENGTH, EXPR1 [, EXPR2 ...]\n\
+find /a [/SIZE-CHAR] [/MAX-COUNT] EXPR1 [, EXPR2 ...]\n\
 SIZE-CHAR is one of b,h,w,g for 8,16,32,64 bit values respectively,\n\
 and if not specified the size is taken from the type of the expression\n\
 in the current language.\n\
 The two-address form specifies an inclusive range.\n\
+With /a, all the readable memory regions of the inferior that would be\n\
+saved by \"gcore\" are searched, and no range is given.\n\
 Note that this means for example that in the case of C-like languages\n\
 a search for an untyped 0x42 will search for \"(int) 0x42\"\n\
 which is typically four bytes, and a search for a string \"hello\" will\n\
@@ -43,6 +43,7 @@
 #include "hashtab.h"
 #include "valprint.h"
 #include "cli/cli-option.h"
+#include "perf-counter.h"
 
 /* The sentinel frame terminates the innermost end of the frame chain.
    If unwound, it returns the information needed to construct an
@@ -2339,6 +2340,12 @@ get_prev_frame_always (struct frame_info *this_frame)
   return prev_frame;
 }
 
+/* The number of frames created by unwinding.  */
+
+static perf_counter frames_unwound_counter
+  ("frame-unwinds", perf_counter_unit::count,
+   N_("Frames created by unwinding the stack."));
+
 /* Construct a new "struct frame_info" and link it previous to
    this_frame.  */
 
@@ -2387,6 +2394,7 @@ get_prev_frame_raw (struct frame_info *this_frame)
   /* Link it in.  */
   this_frame->prev = prev_frame;
   prev_frame->next = this_frame;
+  frames_unwound_counter.add ();
 
   frame_debug_printf ("  -> %s", prev_frame->to_string ().c_str ());
 
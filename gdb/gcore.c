@@ -511,6 +511,66 @@ objfile_find_memory_regions (struct target_ops *self,
   return 0;
 }
 
+/* Write the SIZE bytes at BUF to OSEC at OFFSET, skipping blocks of
+   SPARSE_BLOCK_SIZE bytes that are entirely zero.  The output file is
+   freshly created, so the skipped ranges are left as holes which read
+   back as zeros; on a filesystem that supports sparse files they take
+   no disk space either, which matters for large, mostly untouched
+   heaps.  If LAST is true, this is the final piece of the section and
+   its last byte is always written, so that the file extends over the
+   whole section even when it ends in zeros.  Return false on a write
+   error.  */
+
+static bool
+gcore_write_nonzero_blocks (bfd *obfd, asection *osec, const gdb_byte *buf,
+			    file_ptr offset, bfd_size_type size, bool last)
+{
+  static const bfd_size_type SPARSE_BLOCK_SIZE = 4096;
+  static const gdb_byte zeros[SPARSE_BLOCK_SIZE] = { 0 };
+  bfd_size_type start = 0;
+
+  while (start < size)
+    {
+      /* Skip over zero blocks.  */
+      while (start < size)
+	{
+	  bfd_size_type n = std::min (SPARSE_BLOCK_SIZE, size - start);
+	  if (memcmp (buf + start, zeros, n) != 0)
+	    break;
+	  start += n;
+	}
+
+      if (start == size)
+	break;
+
+      /* Then find the end of this run of non-zero blocks.  */
+      bfd_size_type end = start;
+      while (end < size)
+	{
+	  bfd_size_type n = std::min (SPARSE_BLOCK_SIZE, size - end);
+	  if (memcmp (buf + end, zeros, n) == 0)
+	    break;
+	  end += n;
+	}
+
+      if (!bfd_set_section_contents (obfd, osec, buf + start,
+				     offset + start, end - start))
+	return false;
+
+      if (end == size)
+	return true;
+      start = end;
+    }
+
+  /* The tail of this piece is zero; if it is also the end of the
+     section, write its last byte.  */
+  if (last && size > 0)
+    return bfd_set_section_contents (obfd, osec, buf + size - 1,
+				     offset + size - 1, 1);
+
+  return true;
+}
+
 static void
 gcore_copy_callback (bfd *obfd, asection *osec)
 {
@@ -542,8 +602,8 @@ gcore_copy_callback (bfd *obfd, asection *osec)
 		   paddress (target_gdbarch (), bfd_section_vma (osec)));
 	  break;
 	}
-      if (!bfd_set_section_contents (obfd, osec, memhunk.data (),
-				     offset, size))
+      if (!gcore_write_nonzero_blocks (obfd, osec, memhunk.data (),
+				       offset, size, size == total_size))
 	{
 	  warning (_("Failed to write corefile contents (%s)."),
 		   bfd_errmsg (bfd_get_error ()));
@@ -33,6 +33,14 @@
 #include "gdb/fileio.h"
 #include "inferior.h"
 #include "cli/cli-style.h"
+#include "gdbsupport/parallel-for.h"
+#include "gdbsupport/pathstuff.h"
+#include "gdbsupport/gdb_tilde_expand.h"
+#include "gdbsupport/gdb_unlinker.h"
+#include "gdbsupport/scoped_fd.h"
+#include "gdbsupport/byte-vector.h"
+#include "build-id.h"
+#include <atomic>
 
 /* An object of this type is stored in the section's user data when
    mapping a section.  */
@@ -353,11 +361,27 @@ fileio_errno_to_host (int errnum)
   return -1;
 }
 
+/* The stream of a BFD opened with the gdb_bfd_iovec_fileio_*
+   functions.  */
+struct gdb_bfd_fileio_stream
+{
+  /* The target file descriptor.  */
+  int fd;
+
+  /* If not -1, a host file descriptor for a copy of the file in the
+     target file cache.  Reads are then served from it rather than
+     from the target.  */
+  int local_fd = -1;
+};
+
 /* bfd_openr_iovec OPEN_CLOSURE data for gdb_bfd_open.  */
 struct gdb_bfd_open_closure
 {
   inferior *inf;
   bool warn_if_slow;
+
+  /* Set by gdb_bfd_iovec_fileio_open to the stream it created.  */
+  gdb_bfd_fileio_stream *stream = nullptr;
 };
 
 /* Wrapper for target_fileio_open suitable for passing as the
@@ -368,7 +392,7 @@ gdb_bfd_iovec_fileio_open (struct bfd *abfd, void *open_closure)
 {
   const char *filename = bfd_get_filename (abfd);
   int fd, target_errno;
-  int *stream;
+  gdb_bfd_fileio_stream *stream;
   gdb_bfd_open_closure *oclosure = (gdb_bfd_open_closure *) open_closure;
 
   gdb_assert (is_target_filename (filename));
@@ -384,8 +408,9 @@ gdb_bfd_iovec_fileio_open (struct bfd *abfd, void *open_closure)
       return NULL;
     }
 
-  stream = XCNEW (int);
-  *stream = fd;
+  stream = new gdb_bfd_fileio_stream;
+  stream->fd = fd;
+  oclosure->stream = stream;
   return stream;
 }
 
@@ -396,10 +421,34 @@ static file_ptr
 gdb_bfd_iovec_fileio_pread (struct bfd *abfd, void *stream, void *buf,
 			    file_ptr nbytes, file_ptr offset)
 {
-  int fd = *(int *) stream;
+  gdb_bfd_fileio_stream *fstream = (gdb_bfd_fileio_stream *) stream;
+  int fd = fstream->fd;
   int target_errno;
   file_ptr pos, bytes;
 
+  if (fstream->local_fd != -1)
+    {
+      pos = 0;
+      while (nbytes > pos)
+	{
+	  bytes = pread (fstream->local_fd, (gdb_byte *) buf + pos,
+			 nbytes - pos, offset + pos);
+	  if (bytes == 0)
+	    break;
+	  if (bytes == -1)
+	    {
+	      if (errno == EINTR)
+		continue;
+	      bfd_set_error (bfd_error_system_call);
+	      return -1;
+	    }
+
+	  pos += bytes;
+	}
+
+      return pos;
+    }
+
   pos = 0;
   while (nbytes > pos)
     {
@@ -439,10 +488,13 @@ gdb_bfd_close_warning (const char *name, const char *reason)
 static int
 gdb_bfd_iovec_fileio_close (struct bfd *abfd, void *stream)
 {
-  int fd = *(int *) stream;
+  gdb_bfd_fileio_stream *fstream = (gdb_bfd_fileio_stream *) stream;
+  int fd = fstream->fd;
   int target_errno;
 
-  xfree (stream);
+  if (fstream->local_fd != -1)
+    close (fstream->local_fd);
+  delete fstream;
 
   /* Ignore errors on close.  These may happen with remote
      targets if the connection has already been torn down.  */
@@ -468,7 +520,7 @@ static int
 gdb_bfd_iovec_fileio_fstat (struct bfd *abfd, void *stream,
 			    struct stat *sb)
 {
-  int fd = *(int *) stream;
+  int fd = ((gdb_bfd_fileio_stream *) stream)->fd;
   int target_errno;
   int result;
 
@@ -482,6 +534,129 @@ gdb_bfd_iovec_fileio_fstat (struct bfd *abfd, void *stream,
   return result;
 }
 
+/* The directory holding the target file cache, or empty if the cache
+   is disabled.  */
+
+static std::string target_file_cache_directory;
+
+/* Copy the SIZE bytes of the target file read through STREAM to PATH
+   in the target file cache.  The copy is written to a temporary file
+   first, so that an interrupted download doesn't leave a truncated
+   file behind.  Return true on success.  */
+
+static bool
+target_file_cache_store (gdb_bfd_fileio_stream *stream, ULONGEST size,
+			 const std::string &path)
+{
+  std::string dir = ldirname (path.c_str ());
+  if (!mkdir_recursive (dir.c_str ()))
+    return false;
+
+  std::string temp = path + "-XXXXXX";
+  scoped_fd out = gdb_mkostemp_cloexec (&temp[0], O_BINARY);
+  if (out.get () == -1)
+    return false;
+  gdb::unlinker unlink_temp (temp.c_str ());
+
+  /* Reads may return less than was asked for; the remote target, for
+     instance, returns at most a packet's worth at a time.  */
+  gdb::byte_vector buf (1024 * 1024);
+  ULONGEST offset = 0;
+  while (offset < size)
+    {
+      QUIT;
+
+      int target_errno;
+      int n = target_fileio_pread (stream->fd, buf.data (),
+				   std::min<ULONGEST> (buf.size (),
+						       size - offset),
+				   offset, &target_errno);
+      if (n <= 0)
+	return false;
+
+      for (int written = 0; written < n; )
+	{
+	  ssize_t w = write (out.get (), buf.data () + written, n - written);
+	  if (w == -1)
+	    {
+	      if (errno == EINTR)
+		continue;
+	      return false;
+	    }
+	  written += w;
+	}
+      offset += n;
+    }
+
+  if (rename (temp.c_str (), path.c_str ()) != 0)
+    return false;
+
+  unlink_temp.keep ();
+  return true;
+}
+
+/* If the target file cache is enabled, make ABFD, which reads the
+   target file open as STREAM, read from a copy of the file in the
+   cache instead.  The cache is keyed by build-id, and the file is
+   copied into it first if it isn't there yet.  Files without a
+   build-id are not cached.  */
+
+static void
+target_file_cache_attach (bfd *abfd, gdb_bfd_fileio_stream *stream)
+{
+  if (target_file_cache_directory.empty () || stream == nullptr)
+    return;
+
+  const bfd_build_id *build_id = build_id_bfd_get (abfd);
+  if (build_id == nullptr || build_id->size < 2)
+    return;
+
+  struct stat st;
+  int target_errno;
+  if (target_fileio_fstat (stream->fd, &st, &target_errno) != 0)
+    return;
+
+  std::string hex = build_id_to_string (build_id);
+  std::string path = string_printf ("%s/%.2s/%s",
+				    target_file_cache_directory.c_str (),
+				    hex.c_str (), hex.c_str () + 2);
+
+  scoped_fd local = gdb_open_cloexec (path, O_RDONLY | O_BINARY, 0);
+  struct stat local_st;
+  if (local.get () == -1
+      || fstat (local.get (), &local_st) != 0
+      || local_st.st_size != st.st_size)
+    {
+      bfd_cache_debug_printf ("Copying %s to %s",
+			      bfd_get_filename (abfd), path.c_str ());
+
+      try
+	{
+	  if (!target_file_cache_store (stream, st.st_size, path))
+	    {
+	      bfd_cache_debug_printf ("Could not write %s: %s", path.c_str (),
+				      safe_strerror (errno));
+	      return;
+	    }
+	}
+      catch (const gdb_exception_error &ex)
+	{
+	  bfd_cache_debug_printf ("Could not copy %s: %s",
+				  bfd_get_filename (abfd), ex.what ());
+	  return;
+	}
+
+      local = gdb_open_cloexec (path, O_RDONLY | O_BINARY, 0);
+      if (local.get () == -1)
+	return;
+    }
+  else
+    bfd_cache_debug_printf ("Using %s for %s", path.c_str (),
+			    bfd_get_filename (abfd));
+
+  stream->local_fd = local.release ();
+}
+
 /* A helper function to initialize the data that gdb attaches to each
    BFD.  */
 
@@ -525,12 +700,16 @@ gdb_bfd_open (const char *name, const char *target, int fd,
 	  gdb_assert (fd == -1);
 
 	  gdb_bfd_open_closure open_closure { current_inferior (), warn_if_slow };
-	  return gdb_bfd_openr_iovec (name, target,
-				      gdb_bfd_iovec_fileio_open,
-				      &open_closure,
-				      gdb_bfd_iovec_fileio_pread,
-				      gdb_bfd_iovec_fileio_close,
-				      gdb_bfd_iovec_fileio_fstat);
+	  gdb_bfd_ref_ptr result
+	    = gdb_bfd_openr_iovec (name, target,
+				   gdb_bfd_iovec_fileio_open,
+				   &open_closure,
+				   gdb_bfd_iovec_fileio_pread,
+				   gdb_bfd_iovec_fileio_close,
+				   gdb_bfd_iovec_fileio_fstat);
+	  if (result != nullptr)
+	    target_file_cache_attach (result.get (), open_closure.stream);
+	  return result;
 	}
 
       name += strlen (TARGET_SYSROOT_PREFIX);
@@ -757,6 +936,45 @@ get_section_descriptor (asection *section)
   return result;
 }
 
+/* Try to read the compressed section SECTP by decompressing its
+   blocks in parallel.  Return the malloc'd contents, or NULL if the
+   section can't be split into blocks, in which case the caller should
+   fall back to bfd_get_full_section_contents.  */
+
+static bfd_byte *
+gdb_bfd_decompress_section_parallel (asection *sectp)
+{
+  bfd_byte *compressed;
+  struct bfd_compressed_block *blocks;
+  unsigned int count;
+
+  if (!bfd_get_compressed_section_blocks (sectp->owner, sectp, &compressed,
+					  &blocks, &count))
+    return NULL;
+
+  gdb::unique_xmalloc_ptr<bfd_byte> compressed_holder (compressed);
+  gdb::unique_xmalloc_ptr<struct bfd_compressed_block> blocks_holder (blocks);
+  gdb::unique_xmalloc_ptr<bfd_byte> data
+    ((bfd_byte *) xmalloc (bfd_section_size (sectp)));
+  bfd_byte *dest = data.get ();
+  std::atomic<bool> failed (false);
+
+  gdb::parallel_for_each (1, blocks, blocks + count,
+			  [&] (struct bfd_compressed_block *iter,
+			       struct bfd_compressed_block *end)
+			  {
+			    for (; iter != end && !failed; ++iter)
+			      if (!bfd_decompress_section_block
+				    (compressed, iter,
+				     dest + iter->uncompressed_offset))
+				failed = true;
+			  });
+
+  if (failed)
+    return NULL;
+  return data.release ();
+}
+
 /* See gdb_bfd.h.  */
 
 const gdb_byte *
@@ -819,7 +1037,10 @@ gdb_bfd_map_section (asection *sectp, bfd_size_type *size)
   descriptor->data = NULL;
 
   data = NULL;
-  if (!bfd_get_full_section_contents (abfd, sectp, &data))
+  if (bfd_is_section_compressed (abfd, sectp))
+    data = gdb_bfd_decompress_section_parallel (sectp);
+  if (data == NULL
+      && !bfd_get_full_section_contents (abfd, sectp, &data))
     {
       warning (_("Can't read data for section '%s' in file '%s'"),
 	       bfd_section_name (sectp),
@@ -1125,6 +1346,33 @@ maintenance_info_bfds (const char *arg, int from_tty)
   htab_traverse (all_bfds, print_one_bfd, uiout);
 }
 
+/* Implement "set target-file-cache-directory".  */
+
+static void
+set_target_file_cache_directory (const char *args, int from_tty,
+				 struct cmd_list_element *c)
+{
+  if (!target_file_cache_directory.empty ())
+    target_file_cache_directory
+      = gdb_abspath (gdb_tilde_expand (target_file_cache_directory.c_str ())
+		     .c_str ());
+}
+
+/* Implement "show target-file-cache-directory".  */
+
+static void
+show_target_file_cache_directory (struct ui_file *file, int from_tty,
+				  struct cmd_list_element *c,
+				  const char *value)
+{
+  if (*value == '\0')
+    gdb_printf (file, _("The target file cache is disabled.\n"));
+  else
+    gdb_printf (file, _("Files read from the target are cached in "
+			"\"%ps\".\n"),
+		styled_string (file_name_style.style (), value));
+}
+
 void _initialize_gdb_bfd ();
 void
 _initialize_gdb_bfd ()
@@ -1148,6 +1396,20 @@ filename, file size, file modification time, and file inode."),
 			   &maintenance_set_cmdlist,
 			   &maintenance_show_cmdlist);
 
+  add_setshow_optional_filename_cmd ("target-file-cache-directory",
+				     class_files,
+				     &target_file_cache_directory, _("\
+Set the directory where files read from the target are cached."), _("\
+Show the directory where files read from the target are cached."), _("\
+When set, files that GDB reads from the target, such as shared libraries\n\
+found through a \"target:\" sysroot, are copied into this directory,\n\
+keyed by their build-id.  Later sessions read the local copy instead of\n\
+fetching the file again.  Files without a build-id are not cached.\n\
+An empty directory, the default, disables the cache."),
+				     set_target_file_cache_directory,
+				     show_target_file_cache_directory,
+				     &setlist, &showlist);
+
   add_setshow_boolean_cmd ("bfd-cache", class_maintenance,
 			   &debug_bfd_cache,
 			   _("Set bfd cache debugging."),
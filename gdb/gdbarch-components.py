@@ -1641,6 +1641,19 @@ The maximum length of an instruction on this architecture in bytes.
     invalid=True,
 )
 
+Value(
+    comment="""
+True if the length of an instruction depends only on its bytes, on the
+architecture and on the disassembler options, and not on other state
+such as symbols or settings that select an instruction set.  If so,
+gdb_insn_length may cache instruction lengths.
+""",
+    type="bool",
+    name="insn_length_cacheable",
+    predefault="false",
+    invalid=False,
+)
+
 Method(
     comment="""
 Copy the instruction at FROM to TO, and make any adjustments
@@ -954,6 +954,14 @@ extern bool gdbarch_max_insn_length_p (struct gdbarch *gdbarch);
 extern ULONGEST gdbarch_max_insn_length (struct gdbarch *gdbarch);
 extern void set_gdbarch_max_insn_length (struct gdbarch *gdbarch, ULONGEST max_insn_length);
 
+/* True if the length of an instruction depends only on its bytes, on the
+   architecture and on the disassembler options, and not on other state
+   such as symbols or settings that select an instruction set.  If so,
+   gdb_insn_length may cache instruction lengths. */
+
+extern bool gdbarch_insn_length_cacheable (struct gdbarch *gdbarch);
+extern void set_gdbarch_insn_length_cacheable (struct gdbarch *gdbarch, bool insn_length_cacheable);
+
 /* Copy the instruction at FROM to TO, and make any adjustments
    necessary to single-step it at that address.
 
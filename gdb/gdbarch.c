@@ -181,6 +181,7 @@ struct gdbarch
   int vbit_in_delta;
   gdbarch_skip_permanent_breakpoint_ftype *skip_permanent_breakpoint;
   ULONGEST max_insn_length;
+  bool insn_length_cacheable;
   gdbarch_displaced_step_copy_insn_ftype *displaced_step_copy_insn;
   gdbarch_displaced_step_hw_singlestep_ftype *displaced_step_hw_singlestep;
   gdbarch_displaced_step_fixup_ftype *displaced_step_fixup;
@@ -345,6 +346,7 @@ gdbarch_alloc (const struct gdbarch_info *info,
   gdbarch->execute_dwarf_cfa_vendor_op = default_execute_dwarf_cfa_vendor_op;
   gdbarch->register_reggroup_p = default_register_reggroup_p;
   gdbarch->skip_permanent_breakpoint = default_skip_permanent_breakpoint;
+  gdbarch->insn_length_cacheable = false;
   gdbarch->displaced_step_hw_singlestep = default_displaced_step_hw_singlestep;
   gdbarch->displaced_step_fixup = NULL;
   gdbarch->displaced_step_finish = NULL;
@@ -537,6 +539,7 @@ verify_gdbarch (struct gdbarch *gdbarch)
   /* Skip verify of vbit_in_delta, invalid_p == 0 */
   /* Skip verify of skip_permanent_breakpoint, invalid_p == 0 */
   /* Skip verify of max_insn_length, has predicate.  */
+  /* Skip verify of insn_length_cacheable, invalid_p == 0 */
   /* Skip verify of displaced_step_copy_insn, has predicate.  */
   /* Skip verify of displaced_step_hw_singlestep, invalid_p == 0 */
   /* Skip verify of displaced_step_fixup, has predicate.  */
@@ -1147,6 +1150,9 @@ gdbarch_dump (struct gdbarch *gdbarch, struct ui_file *file)
   gdb_printf (file,
                       "gdbarch_dump: max_insn_length = %s\n",
                       plongest (gdbarch->max_insn_length));
+  gdb_printf (file,
+                      "gdbarch_dump: insn_length_cacheable = %s\n",
+                      plongest (gdbarch->insn_length_cacheable));
   gdb_printf (file,
                       "gdbarch_dump: gdbarch_displaced_step_copy_insn_p() = %d\n",
                       gdbarch_displaced_step_copy_insn_p (gdbarch));
@@ -3965,6 +3971,23 @@ set_gdbarch_max_insn_length (struct gdbarch *gdbarch,
   gdbarch->max_insn_length = max_insn_length;
 }
 
+bool
+gdbarch_insn_length_cacheable (struct gdbarch *gdbarch)
+{
+  gdb_assert (gdbarch != NULL);
+  /* Skip verify of insn_length_cacheable, invalid_p == 0 */
+  if (gdbarch_debug >= 2)
+    gdb_printf (gdb_stdlog, "gdbarch_insn_length_cacheable called\n");
+  return gdbarch->insn_length_cacheable;
+}
+
+void
+set_gdbarch_insn_length_cacheable (struct gdbarch *gdbarch,
+                                   bool insn_length_cacheable)
+{
+  gdbarch->insn_length_cacheable = insn_length_cacheable;
+}
+
 bool
 gdbarch_displaced_step_copy_insn_p (struct gdbarch *gdbarch)
 {
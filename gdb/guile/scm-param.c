@@ -646,6 +646,11 @@ pascm_param_value (const setting &var, int arg_pos, const char *func_name)
     case var_zuinteger:
       return scm_from_uint (var.get<unsigned int> ());
 
+    case var_zulongest_unlimited:
+      if (var.get<ULONGEST> () == ULONGEST_MAX)
+	return unlimited_keyword;
+      return gdbscm_scm_from_ulongest (var.get<ULONGEST> ());
+
     default:
       break;
     }
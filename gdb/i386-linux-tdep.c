@@ -833,7 +833,8 @@ i386_linux_init_abi (struct gdbarch_info info, struct gdbarch *gdbarch)
 
   gdb_assert (tdesc_data);
 
-  linux_init_abi (info, gdbarch, 1);
+  /* Use two displaced step buffers, as amd64-linux does.  */
+  linux_init_abi (info, gdbarch, 2);
 
   /* GNU/Linux uses ELF.  */
   i386_elf_init_abi (info, gdbarch);
@@ -8585,6 +8585,7 @@ i386_gdbarch_init (struct gdbarch_info info, struct gdbarch_list *arches)
 
   set_gdbarch_decr_pc_after_break (gdbarch, 1);
   set_gdbarch_max_insn_length (gdbarch, I386_MAX_INSN_LEN);
+  set_gdbarch_insn_length_cacheable (gdbarch, true);
 
   set_gdbarch_frame_args_skip (gdbarch, 8);
 
@@ -8656,6 +8656,13 @@ normal_stop (void)
      instead of after.  */
   update_thread_list ();
 
+  /* Read the symbols of any shared libraries loaded while the
+     inferior ran, so that the stop is presented with them.  */
+  if (last.kind () != TARGET_WAITKIND_SIGNALLED
+      && last.kind () != TARGET_WAITKIND_EXITED
+      && last.kind () != TARGET_WAITKIND_NO_RESUMED)
+    load_deferred_solib_symbols ();
+
   if (last.kind () == TARGET_WAITKIND_STOPPED && stopped_by_random_signal)
     gdb::observers::signal_received.notify (inferior_thread ()->stop_signal ());
 
@@ -42,6 +42,7 @@
 #include "readline/tilde.h"
 #include "completer.h"
 #include <forward_list>
+#include <unordered_set>
 
 static std::string jit_reader_dir;
 
@@ -62,6 +63,12 @@ static struct gdbarch_data *jit_gdbarch_data;
 
 static bool jit_debug = false;
 
+/* True if the debug info of JIT-compiled object files read with BFD
+   is read.  When false, only their minimal symbols and call frame
+   information are.  */
+
+static bool jit_read_debug_info = true;
+
 /* Print a "jit" debug statement.  */
 
 #define jit_debug_printf(fmt, ...) \
@@ -219,6 +226,26 @@ jiter_objfile_data::~jiter_objfile_data ()
 {
   if (this->jit_breakpoint != nullptr)
     delete_breakpoint (this->jit_breakpoint);
+
+  for (const auto &item : this->jited_objfiles)
+    item.second->jited_data->jiter = nullptr;
+}
+
+/* Called when OBJF is about to be destroyed.  If it holds JIT code,
+   forget it in its JITer's index.  */
+
+static void
+jit_free_objfile (struct objfile *objf)
+{
+  jited_objfile_data *data = objf->jited_data.get ();
+  if (data == nullptr || data->jiter == nullptr)
+    return;
+
+  /* Another objfile may have been registered for the same code entry
+     since; leave it alone.  */
+  auto it = data->jiter->jited_objfiles.find (data->addr);
+  if (it != data->jiter->jited_objfiles.end () && it->second == objf)
+    data->jiter->jited_objfiles.erase (it);
 }
 
 /* Fetch the jiter_objfile_data associated with OBJF.  If no data exists
@@ -234,16 +261,19 @@ get_jiter_objfile_data (objfile *objf)
 }
 
 /* Remember OBJFILE has been created for struct jit_code_entry located
-   at inferior address ENTRY.  */
+   at inferior address ENTRY, registered through JITER.  */
 
 static void
-add_objfile_entry (struct objfile *objfile, CORE_ADDR entry,
-		   CORE_ADDR symfile_addr, ULONGEST symfile_size)
+add_objfile_entry (struct objfile *objfile, jiter_objfile_data *jiter,
+		   CORE_ADDR entry, CORE_ADDR symfile_addr,
+		   ULONGEST symfile_size)
 {
   gdb_assert (objfile->jited_data == nullptr);
 
-  objfile->jited_data.reset (new jited_objfile_data (entry, symfile_addr,
+  objfile->jited_data.reset (new jited_objfile_data (jiter, entry,
+						     symfile_addr,
 						     symfile_size));
+  jiter->jited_objfiles[entry] = objfile;
 }
 
 /* Helper function for reading the global JIT descriptor from remote
@@ -417,6 +447,9 @@ struct jit_dbg_reader_data
   const jit_code_entry &entry;
 
   struct gdbarch *gdbarch;
+
+  /* The objfile data of the JITer that registered the entry.  */
+  jiter_objfile_data *jiter;
 };
 
 /* The reader calls into this function to read data off the targets
@@ -672,7 +705,7 @@ jit_object_close_impl (struct gdb_symbol_callbacks *cb,
   for (gdb_symtab &symtab : obj->symtabs)
     finalize_symtab (&symtab, objfile);
 
-  add_objfile_entry (objfile, priv_data->entry_addr,
+  add_objfile_entry (objfile, priv_data->jiter, priv_data->entry_addr,
 		     priv_data->entry.symfile_addr,
 		     priv_data->entry.symfile_size);
 
@@ -681,18 +714,20 @@ jit_object_close_impl (struct gdb_symbol_callbacks *cb,
 
 /* Try to read CODE_ENTRY using the loaded jit reader (if any).
    ENTRY_ADDR is the address of the struct jit_code_entry in the
-   inferior address space.  */
+   inferior address space, and JITER the data of the objfile that
+   registered it.  */
 
 static int
-jit_reader_try_read_symtab (gdbarch *gdbarch, jit_code_entry *code_entry,
-			    CORE_ADDR entry_addr)
+jit_reader_try_read_symtab (gdbarch *gdbarch, jiter_objfile_data *jiter,
+			    jit_code_entry *code_entry, CORE_ADDR entry_addr)
 {
   int status;
   jit_dbg_reader_data priv_data
     {
       entry_addr,
       *code_entry,
-      gdbarch
+      gdbarch,
+      jiter
     };
   struct gdb_reader_funcs *funcs;
   struct gdb_symbol_callbacks callbacks =
@@ -742,12 +777,16 @@ jit_reader_try_read_symtab (gdbarch *gdbarch, jit_code_entry *code_entry,
 }
 
 /* Try to read CODE_ENTRY using BFD.  ENTRY_ADDR is the address of the
-   struct jit_code_entry in the inferior address space.  */
+   struct jit_code_entry in the inferior address space, and JITER the
+   data of the objfile that registered it.  ADD_FLAGS is passed to
+   symbol_file_add_from_bfd.  */
 
 static void
 jit_bfd_try_read_symtab (struct jit_code_entry *code_entry,
 			 CORE_ADDR entry_addr,
-			 struct gdbarch *gdbarch)
+			 struct gdbarch *gdbarch,
+			 jiter_objfile_data *jiter,
+			 symfile_add_flags add_flags)
 {
   struct bfd_section *sec;
   struct objfile *objfile;
@@ -797,13 +836,19 @@ JITed symbol file is not an object file, ignoring it.\n"));
 			  sec->index);
       }
 
+  /* Without debug info, only minimal symbols and the call frame
+     information are read, which is all that is needed to show and
+     unwind JIT-compiled frames.  */
+  objfile_flags flags = OBJF_SHARED | OBJF_NOT_FILENAME;
+  if (!jit_read_debug_info)
+    flags |= OBJF_READNEVER;
+
   /* This call does not take ownership of SAI.  */
   objfile = symbol_file_add_from_bfd (nbfd.get (),
-				      bfd_get_filename (nbfd.get ()), 0,
-				      &sai,
-				      OBJF_SHARED | OBJF_NOT_FILENAME, NULL);
+				      bfd_get_filename (nbfd.get ()),
+				      add_flags, &sai, flags, NULL);
 
-  add_objfile_entry (objfile, entry_addr, code_entry->symfile_addr,
+  add_objfile_entry (objfile, jiter, entry_addr, code_entry->symfile_addr,
 		     code_entry->symfile_size);
 }
 
@@ -813,8 +858,9 @@ JITed symbol file is not an object file, ignoring it.\n"));
    a symbol file added by the user.  */
 
 static void
-jit_register_code (struct gdbarch *gdbarch,
-		   CORE_ADDR entry_addr, struct jit_code_entry *code_entry)
+jit_register_code (struct gdbarch *gdbarch, jiter_objfile_data *jiter,
+		   CORE_ADDR entry_addr, struct jit_code_entry *code_entry,
+		   symfile_add_flags add_flags = 0)
 {
   int success;
 
@@ -822,24 +868,25 @@ jit_register_code (struct gdbarch *gdbarch,
 		    paddress (gdbarch, code_entry->symfile_addr),
 		    pulongest (code_entry->symfile_size));
 
-  success = jit_reader_try_read_symtab (gdbarch, code_entry, entry_addr);
+  success = jit_reader_try_read_symtab (gdbarch, jiter, code_entry,
+					entry_addr);
 
   if (!success)
-    jit_bfd_try_read_symtab (code_entry, entry_addr, gdbarch);
+    jit_bfd_try_read_symtab (code_entry, entry_addr, gdbarch, jiter,
+			     add_flags);
 }
 
-/* Look up the objfile with this code entry address.  */
+/* Look up the objfile created for the code entry at ENTRY_ADDR,
+   registered through JITER.  */
 
 static struct objfile *
-jit_find_objf_with_entry_addr (CORE_ADDR entry_addr)
+jit_find_objf_with_entry_addr (jiter_objfile_data *jiter,
+			       CORE_ADDR entry_addr)
 {
-  for (objfile *objf : current_program_space->objfiles ())
-    {
-      if (objf->jited_data != nullptr && objf->jited_data->addr == entry_addr)
-	return objf;
-    }
-
-  return NULL;
+  auto it = jiter->jited_objfiles.find (entry_addr);
+  if (it == jiter->jited_objfiles.end ())
+    return nullptr;
+  return it->second;
 }
 
 /* This is called when a breakpoint is deleted.  It updates the
@@ -1157,6 +1204,8 @@ jit_inferior_init (inferior *inf)
   CORE_ADDR cur_entry_addr;
   struct gdbarch *gdbarch = inf->gdbarch;
   program_space *pspace = inf->pspace;
+  bool changed = false;
+  std::vector<objfile *> stale;
 
   jit_debug_printf ("called");
 
@@ -1186,21 +1235,45 @@ jit_inferior_init (inferior *inf)
 
       /* If we've attached to a running program, we need to check the
 	 descriptor to register any functions that were already
-	 generated.  */
+	 generated.  Only the entries we don't know yet are read in, and
+	 breakpoints are only re-set once all of them are.  */
+      jiter_objfile_data *jiter_data = jiter->jiter_data.get ();
+      std::unordered_set<CORE_ADDR> listed;
       for (cur_entry_addr = descriptor.first_entry;
 	   cur_entry_addr != 0;
 	   cur_entry_addr = cur_entry.next_entry)
 	{
 	  jit_read_code_entry (gdbarch, cur_entry_addr, &cur_entry);
+	  if (!listed.insert (cur_entry_addr).second)
+	    {
+	      warning (_("Loop in the JIT code entry list at %s."),
+		       paddress (gdbarch, cur_entry_addr));
+	      break;
+	    }
 
 	  /* This hook may be called many times during setup, so make sure
 	     we don't add the same symbol file twice.  */
-	  if (jit_find_objf_with_entry_addr (cur_entry_addr) != NULL)
+	  if (jit_find_objf_with_entry_addr (jiter_data, cur_entry_addr)
+	      != nullptr)
 	    continue;
 
-	  jit_register_code (gdbarch, cur_entry_addr, &cur_entry);
+	  jit_register_code (gdbarch, jiter_data, cur_entry_addr,
+			     &cur_entry, SYMFILE_DEFER_BP_RESET);
+	  changed = true;
 	}
+
+      /* Remember the objfiles of code entries that were unregistered
+	 while we were not looking, e.g. before attaching.  */
+      for (const auto &item : jiter_data->jited_objfiles)
+	if (listed.find (item.first) == listed.end ())
+	  stale.push_back (item.second);
     }
+
+  for (objfile *objf : stale)
+    objf->unlink ();
+
+  if (changed || !stale.empty ())
+    breakpoint_re_set ();
 }
 
 /* Looks for the descriptor and registration symbols and breakpoints
@@ -1261,13 +1334,16 @@ jit_event_handler (gdbarch *gdbarch, objfile *jiter)
       {
 	jit_code_entry code_entry;
 	jit_read_code_entry (gdbarch, entry_addr, &code_entry);
-	jit_register_code (gdbarch, entry_addr, &code_entry);
+	jit_register_code (gdbarch, jiter->jiter_data.get (), entry_addr,
+			   &code_entry);
 	break;
       }
 
     case JIT_UNREGISTER:
       {
-	objfile *jited = jit_find_objf_with_entry_addr (entry_addr);
+	objfile *jited
+	  = jit_find_objf_with_entry_addr (jiter->jiter_data.get (),
+					   entry_addr);
 	if (jited == nullptr)
 	  gdb_printf (gdb_stderr,
 		      _("Unable to find JITed code "
@@ -1313,6 +1389,21 @@ _initialize_jit ()
 			   show_jit_debug,
 			   &setdebuglist, &showdebuglist);
 
+  add_setshow_boolean_cmd ("jit-read-debug-info", class_support,
+			   &jit_read_debug_info, _("\
+Set whether to read the debug info of JIT-compiled code."), _("\
+Show whether to read the debug info of JIT-compiled code."), _("\
+When on, which is the default, the debug info of the object files that\n\
+a program registers through the JIT interface is read.  When off, only\n\
+their minimal symbols and call frame information are read, which is\n\
+enough to show and unwind JIT-compiled frames, and much cheaper when\n\
+the program registers many small object files.  This does not apply to\n\
+code read by a JIT debug info reader.  Changing this setting only\n\
+affects the object files registered later."),
+			   NULL,
+			   NULL,
+			   &setlist, &showlist);
+
   add_cmd ("jit", class_maintenance, maint_info_jit_cmd,
 	   _("Print information about JIT-ed code objects."),
 	   &maintenanceinfolist);
@@ -1321,6 +1412,7 @@ _initialize_jit ()
   gdb::observers::inferior_execd.attach (jit_inferior_created_hook, "jit");
   gdb::observers::inferior_exit.attach (jit_inferior_exit_hook, "jit");
   gdb::observers::breakpoint_deleted.attach (jit_breakpoint_deleted, "jit");
+  gdb::observers::free_objfile.attach (jit_free_objfile, "jit");
 
   jit_gdbarch_data = gdbarch_data_register_pre_init (jit_gdbarch_data_init);
   if (is_dl_available ())
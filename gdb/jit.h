@@ -20,6 +20,8 @@
 #ifndef JIT_H
 #define JIT_H
 
+#include <unordered_map>
+
 struct inferior;
 struct objfile;
 struct minimal_symbol;
@@ -88,6 +90,11 @@ struct jiter_objfile_data
 
   /* This is the JIT event breakpoint, or nullptr if it has been deleted.  */
   breakpoint *jit_breakpoint = nullptr;
+
+  /* The objfiles created for the code entries registered through this
+     objfile's descriptor, indexed by the address of their struct
+     jit_code_entry.  */
+  std::unordered_map<CORE_ADDR, objfile *> jited_objfiles;
 };
 
 /* An objfile that is the product of JIT compilation and was registered
@@ -95,13 +102,18 @@ struct jiter_objfile_data
 
 struct jited_objfile_data
 {
-  jited_objfile_data (CORE_ADDR addr, CORE_ADDR symfile_addr,
-		      ULONGEST symfile_size)
-    : addr (addr),
+  jited_objfile_data (jiter_objfile_data *jiter, CORE_ADDR addr,
+		      CORE_ADDR symfile_addr, ULONGEST symfile_size)
+    : jiter (jiter),
+      addr (addr),
       symfile_addr (symfile_addr),
       symfile_size (symfile_size)
   {}
 
+  /* The data of the objfile through which this objfile was registered,
+     or nullptr if that objfile is gone.  */
+  jiter_objfile_data *jiter;
+
   /* Address of struct jit_code_entry for this objfile.  */
   CORE_ADDR addr;
 
@@ -49,6 +49,19 @@
 #include <algorithm>
 #include "inferior.h"
 
+/* See linespec.h.  */
+
+const std::unordered_set<objfile *> *linespec_search_objfiles;
+
+/* Return true if linespec searches should look at OBJFILE.  */
+
+static bool
+linespec_objfile_searched_p (objfile *objfile)
+{
+  return (linespec_search_objfiles == nullptr
+	  || linespec_search_objfiles->count (objfile) != 0);
+}
+
 /* An enumeration of the various things a user might attempt to
    complete for a linespec location.  */
 
@@ -1170,6 +1183,9 @@ iterate_over_all_matching_symtabs
 
       for (objfile *objfile : current_program_space->objfiles ())
 	{
+	  if (!linespec_objfile_searched_p (objfile))
+	    continue;
+
 	  objfile->expand_symtabs_matching (NULL, &lookup_name, NULL, NULL,
 					    (SEARCH_GLOBAL_BLOCK
 					     | SEARCH_STATIC_BLOCK),
@@ -3712,7 +3728,17 @@ collect_symtabs_from_filename (const char *file,
       iterate_over_symtabs (file, collector);
     }
 
-  return collector.release_symtabs ();
+  std::vector<symtab *> result = collector.release_symtabs ();
+  if (linespec_search_objfiles != nullptr)
+    result.erase (std::remove_if (result.begin (), result.end (),
+				  [] (symtab *s)
+				  {
+				    objfile *objf = s->compunit ()->objfile ();
+				    return !linespec_objfile_searched_p (objf);
+				  }),
+		  result.end ());
+
+  return result;
 }
 
 /* Return all the symtabs associated to the FILENAME.  If SEARCH_PSPACE is
@@ -4224,6 +4250,9 @@ search_minsyms_for_name (struct collect_info *info,
 
 	  for (objfile *objfile : current_program_space->objfiles ())
 	    {
+	      if (!linespec_objfile_searched_p (objfile))
+		continue;
+
 	      iterate_over_minimal_symbols (objfile, name,
 					    [&] (struct minimal_symbol *msym)
 					    {
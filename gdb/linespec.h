@@ -20,6 +20,7 @@
 struct symtab;
 
 #include "location.h"
+#include <unordered_set>
 
 /* Flags to pass to decode_line_1 and decode_line_full.  */
 
@@ -78,6 +79,13 @@ struct linespec_result
   std::vector<linespec_sals> lsals;
 };
 
+/* If not NULL, symbol and source file searches done while decoding
+   linespecs only consider the objfiles in this set.  The breakpoint
+   code uses this to check whether newly loaded objfiles can resolve
+   a pending breakpoint, without searching every objfile again.  */
+
+extern const std::unordered_set<objfile *> *linespec_search_objfiles;
+
 /* Decode a linespec using the provided default symtab and line.  */
 
 extern std::vector<symtab_and_line>
@@ -26,6 +26,7 @@
 #include "gdbsupport/gdb_wait.h"
 #include <unistd.h>
 #include <sys/syscall.h>
+#include <sys/uio.h>
 #include "nat/gdb_ptrace.h"
 #include "linux-nat.h"
 #include "nat/linux-ptrace.h"
@@ -71,6 +72,7 @@
 #include "gdbsupport/gdb-sigmask.h"
 #include "gdbsupport/common-debug.h"
 #include <unordered_map>
+#include <chrono>
 
 /* This comment documents high-level logic of this file.
 
@@ -230,6 +232,7 @@ static int report_thread_events;
 static int kill_lwp (int lwpid, int signo);
 
 static int stop_callback (struct lwp_info *lp);
+static void stop_and_wait_lwps (ptid_t filter);
 
 static void block_child_signals (sigset_t *prev_mask);
 static void restore_child_signals_mask (sigset_t *prev_mask);
@@ -243,6 +246,7 @@ static struct lwp_info *find_lwp_pid (ptid_t ptid);
 static int lwp_status_pending_p (struct lwp_info *lp);
 
 static void save_stop_reason (struct lwp_info *lp);
+static void linux_nat_filter_event (int lwpid, int status);
 
 static void close_proc_mem_file (pid_t pid);
 static void open_proc_mem_file (ptid_t ptid);
@@ -339,6 +343,66 @@ pull_pid_from_list (struct simple_pid_list **listp, int pid, int *statusp)
   return 0;
 }
 
+/* Wait statuses that reap_lwp_events pulled out of the kernel for
+   LWPs we know about, in the order they were reported, along with the
+   LWP ids.  Each is consumed by whoever would otherwise have waited
+   for that LWP: wait_lwp, or failing that linux_nat_wait_1.  */
+static std::vector<std::pair<int, int>> reaped_statuses;
+
+/* If an event for LWPID is in REAPED_STATUSES, remove the oldest such
+   event, store its status in *STATUSP and return true.  */
+
+static bool
+pull_reaped_status (int lwpid, int *statusp)
+{
+  for (auto it = reaped_statuses.begin (); it != reaped_statuses.end (); ++it)
+    if (it->first == lwpid)
+      {
+	*statusp = it->second;
+	reaped_statuses.erase (it);
+	return true;
+      }
+
+  return false;
+}
+
+/* Pull all the pending events out of the kernel at once.  The events
+   of LWPs we know about are saved in REAPED_STATUSES; the others are
+   handled right away, as linux_nat_wait_1 would.  */
+
+static void
+reap_lwp_events ()
+{
+  pid_t lwpid;
+  int status;
+
+  while ((lwpid = my_waitpid (-1, &status, __WALL | WNOHANG)) > 0)
+    {
+      linux_nat_debug_printf ("waitpid %ld received %s (reaped)",
+			      (long) lwpid, status_to_str (status).c_str ());
+
+      if (find_lwp_pid (ptid_t (lwpid)) != nullptr)
+	reaped_statuses.emplace_back (lwpid, status);
+      else
+	linux_nat_filter_event (lwpid, status);
+    }
+}
+
+/* Statistics about stopping all LWPs, shown by "maint info
+   linux-stop-latency".  */
+
+static struct
+{
+  /* The number of times LWPs were stopped together.  */
+  unsigned long count;
+
+  /* The number of LWPs the last of those stopped.  */
+  unsigned long last_lwps;
+
+  /* How long the last, the longest and all of those took.  */
+  std::chrono::steady_clock::duration last, max, total;
+} stop_all_stats;
+
 /* Return the ptrace options that we want to try to enable.  */
 
 static int
@@ -1160,7 +1224,10 @@ detach_one_pid (int pid, int signo)
 	{
 	  int ret, status;
 
-	  ret = my_waitpid (pid, &status, __WALL);
+	  if (pull_reaped_status (pid, &status))
+	    ret = pid;
+	  else
+	    ret = my_waitpid (pid, &status, __WALL);
 	  if (ret == -1)
 	    {
 	      warning (_("Couldn't reap LWP %d while detaching: %s"),
@@ -1390,10 +1457,7 @@ linux_nat_target::detach (inferior *inf, int from_tty)
 
   /* Stop all threads before detaching.  ptrace requires that the
      thread is stopped to successfully detach.  */
-  iterate_over_lwps (ptid_t (pid), stop_callback);
-  /* ... and wait until all of them have reported back that
-     they're no longer running.  */
-  iterate_over_lwps (ptid_t (pid), stop_wait_callback);
+  stop_and_wait_lwps (ptid_t (pid));
 
   /* We can now safely remove breakpoints.  We don't this in earlier
      in common code because this target doesn't currently support
@@ -2034,7 +2098,10 @@ wait_lwp (struct lwp_info *lp)
 
   for (;;)
     {
-      pid = my_waitpid (lp->ptid.lwp (), &status, __WALL | WNOHANG);
+      if (pull_reaped_status (lp->ptid.lwp (), &status))
+	pid = lp->ptid.lwp ();
+      else
+	pid = my_waitpid (lp->ptid.lwp (), &status, __WALL | WNOHANG);
       if (pid == -1 && errno == ECHILD)
 	{
 	  /* The thread has previously exited.  We need to delete it
@@ -2078,6 +2145,11 @@ wait_lwp (struct lwp_info *lp)
 	 again before it gets to sigsuspend so we can safely let the handlers
 	 get executed here.  */
       wait_for_signal ();
+
+      /* A single SIGCHLD may stand for the stops of many LWPs.  Pull
+	 them all out of the kernel now, so that waiting for the other
+	 LWPs doesn't need a waitpid and a sigsuspend each.  */
+      reap_lwp_events ();
     }
 
   restore_child_signals_mask (&prev_mask);
@@ -2192,17 +2264,57 @@ linux_stop_lwp (struct lwp_info *lwp)
   stop_callback (lwp);
 }
 
-/* See linux-nat.h  */
+/* Stop all the LWPs matching FILTER and wait until all of them have
+   reported back that they're no longer running.  All the SIGSTOPs are
+   sent before any stop is waited for, and the stops are then pulled
+   out of the kernel in bulk as they come in, rather than waiting for
+   each LWP in turn.  */
 
-void
-linux_stop_and_wait_all_lwps (void)
+static void
+stop_and_wait_lwps (ptid_t filter)
 {
+  using namespace std::chrono;
+
+  steady_clock::time_point start = steady_clock::now ();
+  unsigned long nlwps = 0;
+
   /* Stop all LWP's ...  */
-  iterate_over_lwps (minus_one_ptid, stop_callback);
+  iterate_over_lwps (filter, [&] (struct lwp_info *lp)
+    {
+      if (!lp->stopped)
+	nlwps++;
+      return stop_callback (lp);
+    });
 
   /* ... and wait until all of them have reported back that
      they're no longer running.  */
-  iterate_over_lwps (minus_one_ptid, stop_wait_callback);
+  reap_lwp_events ();
+  iterate_over_lwps (filter, stop_wait_callback);
+
+  steady_clock::duration elapsed = steady_clock::now () - start;
+
+  stop_all_stats.count++;
+  stop_all_stats.last_lwps = nlwps;
+  stop_all_stats.last = elapsed;
+  stop_all_stats.max = std::max (stop_all_stats.max, elapsed);
+  stop_all_stats.total += elapsed;
+
+  linux_nat_debug_printf ("stopped %lu LWPs in %ld us", nlwps,
+			  (long) duration_cast<microseconds> (elapsed).count ());
+
+  /* Events left over were reported by LWPs that weren't waited for,
+     e.g. LWPs that were already stopped and then exited.  Have
+     linux_nat_wait_1 handle them.  */
+  if (!reaped_statuses.empty ())
+    linux_nat_target::async_file_mark_if_open ();
+}
+
+/* See linux-nat.h  */
+
+void
+linux_stop_and_wait_all_lwps (void)
+{
+  stop_and_wait_lwps (minus_one_ptid);
 }
 
 /* See linux-nat.h  */
@@ -3166,6 +3278,18 @@ linux_nat_wait_1 (ptid_t ptid, struct target_waitstatus *ourstatus,
 	   explicitly in that case).  The exec event is reported to
 	   the TGID pid.  */
 
+      /* First handle the events that reap_lwp_events already pulled
+	 out of the kernel.  */
+      if (!reaped_statuses.empty ())
+	{
+	  std::vector<std::pair<int, int>> reaped
+	    = std::move (reaped_statuses);
+
+	  reaped_statuses.clear ();
+	  for (const auto &event : reaped)
+	    linux_nat_filter_event (event.first, event.second);
+	}
+
       errno = 0;
       lwpid = my_waitpid (-1, &status,  __WALL | WNOHANG);
 
@@ -3240,12 +3364,8 @@ linux_nat_wait_1 (ptid_t ptid, struct target_waitstatus *ourstatus,
 
   if (!target_is_non_stop_p ())
     {
-      /* Now stop all other LWP's ...  */
-      iterate_over_lwps (minus_one_ptid, stop_callback);
-
-      /* ... and wait until all of them have reported back that
-	 they're no longer running.  */
-      iterate_over_lwps (minus_one_ptid, stop_wait_callback);
+      /* Now stop all other LWP's.  */
+      stop_and_wait_lwps (minus_one_ptid);
     }
 
   /* If we're not waiting for a specific LWP, choose an event LWP from
@@ -3470,6 +3590,11 @@ static void
 kill_wait_one_lwp (pid_t pid)
 {
   pid_t res;
+  int status;
+
+  /* Discard the events already pulled out of the kernel.  */
+  while (pull_reaped_status (pid, &status))
+    ;
 
   /* We must make sure that there are no pending events (delayed
      SIGSTOPs, pending SIGTRAPs, etc.) to make sure the current
@@ -3555,10 +3680,7 @@ linux_nat_target::kill ()
 
       /* Stop all threads before killing them, since ptrace requires
 	 that the thread is stopped to successfully PTRACE_KILL.  */
-      iterate_over_lwps (ptid, stop_callback);
-      /* ... and wait until all of them have reported back that
-	 they're no longer running.  */
-      iterate_over_lwps (ptid, stop_wait_callback);
+      stop_and_wait_lwps (ptid);
 
       /* Kill all LWP's ...  */
       iterate_over_lwps (ptid, kill_callback);
@@ -3718,6 +3840,72 @@ linux_nat_target::xfer_partial (enum target_object object,
 					  offset, len, xfered_len);
 }
 
+/* Implement the "read_memory_batch" target_ops method.  Read the
+   requests with process_vm_readv, which takes a list of remote ranges
+   and so serves all of them, contiguous or not, with a single
+   system call.  */
+
+size_t
+linux_nat_target::read_memory_batch
+  (gdb::array_view<const memory_read_request> requests)
+{
+#ifdef __NR_process_vm_readv
+  if (inferior_ptid == null_ptid)
+    return 0;
+
+  int addr_bit = gdbarch_addr_bit (target_gdbarch ());
+  ULONGEST addr_mask = ULONGEST_MAX;
+  if (addr_bit < (sizeof (ULONGEST) * HOST_CHAR_BIT))
+    addr_mask = ((ULONGEST) 1 << addr_bit) - 1;
+
+  /* The kernel won't take more than IOV_MAX ranges at once.  */
+  const size_t max_iov = 1024;
+  std::vector<struct iovec> local_iov, remote_iov;
+  size_t done = 0;
+
+  while (done < requests.size ())
+    {
+      size_t n = std::min (requests.size () - done, max_iov);
+
+      local_iov.resize (n);
+      remote_iov.resize (n);
+      for (size_t i = 0; i < n; i++)
+	{
+	  const memory_read_request &req = requests[done + i];
+
+	  local_iov[i].iov_base = req.buf;
+	  local_iov[i].iov_len = req.len;
+	  remote_iov[i].iov_base = (void *) (uintptr_t) (req.addr & addr_mask);
+	  remote_iov[i].iov_len = req.len;
+	}
+
+      long ret = syscall (__NR_process_vm_readv, inferior_ptid.pid (),
+			  local_iov.data (), (unsigned long) n,
+			  remote_iov.data (), (unsigned long) n, 0UL);
+      if (ret <= 0)
+	break;
+
+      /* The kernel stops at the first range it can't read; count the
+	 requests that were read in full.  */
+      size_t read = 0;
+      while (read < n && (ULONGEST) ret >= requests[done + read].len)
+	{
+	  ret -= requests[done + read].len;
+	  read++;
+	}
+
+      done += read;
+      if (read < n)
+	break;
+    }
+
+  linux_nat_debug_printf ("read %zu of %zu ranges", done, requests.size ());
+  return done;
+#else
+  return 0;
+#endif
+}
+
 bool
 linux_nat_target::thread_alive (ptid_t ptid)
 {
@@ -4400,6 +4588,31 @@ current_lwp_ptid (void)
   return inferior_ptid;
 }
 
+/* Implement "maint info linux-stop-latency".  */
+
+static void
+maintenance_info_linux_stop_latency (const char *args, int from_tty)
+{
+  using namespace std::chrono;
+
+  auto usecs = [] (steady_clock::duration d)
+    {
+      return (long) duration_cast<microseconds> (d).count ();
+    };
+
+  gdb_printf (_("Number of times all LWPs were stopped: %lu\n"),
+	      stop_all_stats.count);
+  if (stop_all_stats.count == 0)
+    return;
+
+  gdb_printf (_("LWPs stopped the last time: %lu\n"),
+	      stop_all_stats.last_lwps);
+  gdb_printf (_("Last stop time: %ld us\n"), usecs (stop_all_stats.last));
+  gdb_printf (_("Longest stop time: %ld us\n"), usecs (stop_all_stats.max));
+  gdb_printf (_("Average stop time: %ld us\n"),
+	      usecs (stop_all_stats.total) / (long) stop_all_stats.count);
+}
+
 void _initialize_linux_nat ();
 void
 _initialize_linux_nat ()
@@ -4422,6 +4635,13 @@ Enables printf debugging output."),
 			   NULL,
 			   &setdebuglist, &showdebuglist);
 
+  add_cmd ("linux-stop-latency", class_maintenance,
+	   maintenance_info_linux_stop_latency, _("\
+Show how long stopping all the threads of GNU/Linux inferiors took.\n\
+This reports the time from the first stop request being sent to the\n\
+last thread having reported its stop."),
+	   &maintenanceinfolist);
+
   /* Install a SIGCHLD handler.  */
   sigchld_action.sa_handler = sigchld_handler;
   sigemptyset (&sigchld_action.sa_mask);
@@ -57,6 +57,9 @@ class linux_nat_target : public inf_ptrace_target
 					ULONGEST offset, ULONGEST len,
 					ULONGEST *xfered_len) override;
 
+  size_t read_memory_batch
+    (gdb::array_view<const memory_read_request> requests) override;
+
   void kill () override;
 
   void mourn_inferior () override;
@@ -26,7 +26,7 @@ struct obstack;
 struct compunit_symtab;
 
 namespace gdb {
-struct bcache;
+struct concurrent_bcache;
 }
 
 /* How do we represent a source location?  I mean, how should we
@@ -173,7 +173,7 @@ struct macro_source_file
    the same source location (although 'gcc -DFOO -UFOO -DFOO=2' does
    do that in GCC 4.1.2.).  */
 struct macro_table *new_macro_table (struct obstack *obstack,
-				     gdb::bcache *bcache,
+				     gdb::concurrent_bcache *bcache,
 				     struct compunit_symtab *cust);
 
 
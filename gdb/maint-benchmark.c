@@ -0,0 +1,620 @@
+/* Maintenance commands for benchmarking GDB.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include "defs.h"
+#include "gdbcmd.h"
+#include "cli/cli-option.h"
+#include "cli/cli-utils.h"
+#include "completer.h"
+#include "symtab.h"
+#include "symfile.h"
+#include "objfiles.h"
+#include "minsyms.h"
+#include "frame.h"
+#include "stack.h"
+#include "expression.h"
+#include "value.h"
+#include "valprint.h"
+#include "gdbsupport/run-time-clock.h"
+#include "gdbsupport/function-view.h"
+#include "gdbsupport/buildargv.h"
+#include "gdbsupport/scope-exit.h"
+#include "readline/tilde.h"
+#include <chrono>
+#if defined HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
+
+/* The "maintenance benchmark" command list.  */
+
+static struct cmd_list_element *maint_benchmark_list;
+
+/* The options of the "maintenance benchmark" subcommands.  */
+
+struct benchmark_opts
+{
+  /* How many times to run the workload.  */
+  unsigned int repeat = 1;
+};
+
+static const gdb::option::option_def benchmark_option_defs[] = {
+  gdb::option::uinteger_option_def<benchmark_opts> {
+    "repeat",
+    [] (benchmark_opts *opts) { return &opts->repeat; },
+    nullptr, /* show_cmd_cb */
+    N_("How many times to run the workload."),
+  },
+};
+
+/* Create an option_def_group for the benchmark options, with OPTS as
+   context.  */
+
+static inline gdb::option::option_def_group
+make_benchmark_options_def_group (benchmark_opts *opts)
+{
+  return {{benchmark_option_defs}, opts};
+}
+
+/* Return the peak resident set size of GDB in KiB, or -1 if it is not
+   known.  */
+
+static long
+peak_rss_kib ()
+{
+#if defined HAVE_GETRUSAGE
+  struct rusage rusage;
+
+  if (getrusage (RUSAGE_SELF, &rusage) != 0)
+    return -1;
+#ifdef __APPLE__
+  /* Darwin reports bytes rather than KiB.  */
+  return rusage.ru_maxrss / 1024;
+#else
+  return rusage.ru_maxrss;
+#endif
+#else
+  return -1;
+#endif
+}
+
+/* Print STR to STREAM as a JSON string.  */
+
+static void
+print_json_string (ui_file *stream, const char *str)
+{
+  stream->putc ('"');
+  for (; *str != '\0'; ++str)
+    {
+      unsigned char c = *str;
+
+      if (c == '"' || c == '\\')
+	gdb_printf (stream, "\\%c", c);
+      else if (c < 0x20)
+	gdb_printf (stream, "\\u%04x", c);
+      else
+	stream->putc (c);
+    }
+  stream->putc ('"');
+}
+
+/* Accumulated timings of a benchmark, or of one of its phases.  */
+
+struct benchmark_times
+{
+  std::chrono::steady_clock::duration wall {};
+  run_time_clock::duration cpu {};
+
+  void print (ui_file *stream) const
+  {
+    using namespace std::chrono;
+
+    gdb_printf (stream, "\"wall\": %.6f, \"cpu\": %.6f",
+		duration<double> (wall).count (),
+		duration<double> (cpu).count ());
+  }
+};
+
+/* Measure the wall and CPU time spent between construction and
+   destruction, and add them to a benchmark_times.  */
+
+class scoped_benchmark_timer
+{
+public:
+
+  explicit scoped_benchmark_timer (benchmark_times *times)
+    : m_times (times),
+      m_start_wall (std::chrono::steady_clock::now ()),
+      m_start_cpu (run_time_clock::now ())
+  {
+  }
+
+  ~scoped_benchmark_timer ()
+  {
+    m_times->wall += std::chrono::steady_clock::now () - m_start_wall;
+    m_times->cpu += run_time_clock::now () - m_start_cpu;
+  }
+
+  DISABLE_COPY_AND_ASSIGN (scoped_benchmark_timer);
+
+private:
+
+  benchmark_times *m_times;
+  std::chrono::steady_clock::time_point m_start_wall;
+  run_time_clock::time_point m_start_cpu;
+};
+
+/* A run of one of the benchmark workloads.  The workload is split in
+   named phases, whose timings are added up over all the
+   iterations.  */
+
+class benchmark
+{
+public:
+
+  explicit benchmark (const char *name)
+    : m_name (name)
+  {
+  }
+
+  DISABLE_COPY_AND_ASSIGN (benchmark);
+
+  /* Call ITERATION REPEAT times, and print the results as JSON to
+     gdb_stdout.  */
+  void run (unsigned int repeat, gdb::function_view<void ()> iteration)
+  {
+    long rss_before = peak_rss_kib ();
+
+    for (unsigned int i = 0; i < repeat; ++i)
+      {
+	m_iterations.emplace_back ();
+	scoped_benchmark_timer timer (&m_iterations.back ());
+	iteration ();
+	QUIT;
+      }
+
+    print (gdb_stdout, rss_before, peak_rss_kib ());
+  }
+
+  /* Call FUNC as the phase NAME of the current iteration.  FUNC
+     returns the number of items it processed: symbols looked up,
+     frames unwound, and so on.  */
+  void phase (const char *name, gdb::function_view<size_t ()> func)
+  {
+    phase_data *data = find_phase (name);
+    size_t n;
+    {
+      scoped_benchmark_timer timer (&data->times);
+      n = func ();
+    }
+    data->items += n;
+  }
+
+private:
+
+  struct phase_data
+  {
+    std::string name;
+    benchmark_times times;
+    size_t items = 0;
+  };
+
+  /* Return the phase called NAME, creating it if needed.  Phases are
+     kept in the order in which they first ran.  */
+  phase_data *find_phase (const char *name)
+  {
+    for (phase_data &data : m_phases)
+      if (data.name == name)
+	return &data;
+    m_phases.emplace_back ();
+    m_phases.back ().name = name;
+    return &m_phases.back ();
+  }
+
+  /* Print the results to STREAM.  RSS_BEFORE and RSS_AFTER are the
+     peak resident set sizes at the start and at the end of the
+     run.  */
+  void print (ui_file *stream, long rss_before, long rss_after) const
+  {
+    benchmark_times total;
+    for (const benchmark_times &times : m_iterations)
+      {
+	total.wall += times.wall;
+	total.cpu += times.cpu;
+      }
+
+    gdb_printf (stream, "{\"benchmark\": ");
+    print_json_string (stream, m_name);
+    gdb_printf (stream, ", \"repeat\": %s, ",
+		pulongest (m_iterations.size ()));
+    total.print (stream);
+    if (rss_after >= 0)
+      gdb_printf (stream,
+		  ", \"peak-rss-kib\": %ld, \"peak-rss-growth-kib\": %ld",
+		  rss_after, rss_after - rss_before);
+
+    gdb_printf (stream, ",\n \"iterations\": [");
+    for (size_t i = 0; i < m_iterations.size (); ++i)
+      {
+	gdb_printf (stream, "%s{", i == 0 ? "" : ", ");
+	m_iterations[i].print (stream);
+	gdb_printf (stream, "}");
+      }
+    gdb_printf (stream, "],\n \"phases\": [");
+    for (size_t i = 0; i < m_phases.size (); ++i)
+      {
+	gdb_printf (stream, "%s{\"name\": ", i == 0 ? "" : ",\n   ");
+	print_json_string (stream, m_phases[i].name.c_str ());
+	gdb_printf (stream, ", ");
+	m_phases[i].times.print (stream);
+	gdb_printf (stream, ", \"items\": %s}",
+		    pulongest (m_phases[i].items));
+      }
+    gdb_printf (stream, "]}\n");
+  }
+
+  /* The name of the workload.  */
+  const char *m_name;
+
+  /* The timings of each iteration.  */
+  std::vector<benchmark_times> m_iterations;
+
+  /* The phases seen so far.  */
+  std::vector<phase_data> m_phases;
+};
+
+/* Parse the options at the start of *ARGS into OPTS, and leave *ARGS
+   pointing at the remaining arguments, or at nullptr if there are
+   none.  MODE is passed to gdb::option::process_options.  */
+
+static void
+parse_benchmark_options (const char **args, benchmark_opts *opts,
+			 gdb::option::process_options_mode mode)
+{
+  gdb::option::process_options (args, mode,
+				make_benchmark_options_def_group (opts));
+  if (*args != nullptr)
+    {
+      *args = skip_spaces (*args);
+      if (**args == '\0')
+	*args = nullptr;
+    }
+
+  if (opts->repeat == UINT_MAX)
+    error (_("The repeat count must be a positive number."));
+}
+
+/* Completer for the options of the "maintenance benchmark"
+   subcommands.  Arguments are completed with COMPLETER, if it is not
+   nullptr.  */
+
+static void
+complete_benchmark_options (completion_tracker &tracker, const char *text,
+			    const char *word, completer_ftype *completer)
+{
+  const auto group = make_benchmark_options_def_group (nullptr);
+  if (gdb::option::complete_options
+      (tracker, &text, gdb::option::PROCESS_OPTIONS_UNKNOWN_IS_OPERAND, group))
+    return;
+
+  if (completer != nullptr)
+    {
+      word = advance_to_filename_complete_word_point (tracker, text);
+      completer (nullptr, tracker, text, word);
+    }
+}
+
+/* Completer for "maintenance benchmark index".  */
+
+static void
+benchmark_index_completer (struct cmd_list_element *ignore,
+			   completion_tracker &tracker,
+			   const char *text, const char *word)
+{
+  complete_benchmark_options (tracker, text, word, filename_completer);
+}
+
+/* Completer for the subcommands that only take options.  */
+
+static void
+benchmark_options_completer (struct cmd_list_element *ignore,
+			     completion_tracker &tracker,
+			     const char *text, const char *word)
+{
+  complete_benchmark_options (tracker, text, word, nullptr);
+}
+
+/* The "maintenance benchmark index" command.  */
+
+static void
+maintenance_benchmark_index (const char *args, int from_tty)
+{
+  benchmark_opts opts;
+  parse_benchmark_options (&args, &opts,
+			   gdb::option::PROCESS_OPTIONS_UNKNOWN_IS_OPERAND);
+  if (args == nullptr)
+    error_no_arg (_("file to load"));
+
+  gdb::unique_xmalloc_ptr<char> filename (tilde_expand (args));
+
+  benchmark bench ("index");
+  bench.run (opts.repeat, [&] ()
+    {
+      /* Load FILE next to the user's objfiles, without making it the
+	 main symbol file or re-setting breakpoints, and remove it again
+	 at the end of the iteration, so that the user's session is left
+	 as it was.  */
+      objfile *objf = nullptr;
+      SCOPE_EXIT
+	{
+	  if (objf != nullptr)
+	    objf->unlink ();
+	};
+
+      bench.phase ("load", [&] ()
+	{
+	  objf = symbol_file_add (filename.get (), SYMFILE_DEFER_BP_RESET,
+				  nullptr, 0);
+	  return (size_t) 1;
+	});
+
+      bench.phase ("index", [&] ()
+	{
+	  size_t n = 0;
+	  for (objfile *o : objf->separate_debug_objfiles ())
+	    {
+	      o->require_partial_symbols (false);
+	      ++n;
+	    }
+	  return n;
+	});
+
+      /* The first lookup waits for whatever indexing work was left to
+	 background threads.  */
+      bench.phase ("first-lookup", [&] ()
+	{
+	  lookup_global_symbol_from_objfile (objf, GLOBAL_BLOCK,
+					     "__gdb_benchmark_no_such_symbol",
+					     VAR_DOMAIN);
+	  return (size_t) 1;
+	});
+    });
+}
+
+/* The "maintenance benchmark lookup" command.  */
+
+static void
+maintenance_benchmark_lookup (const char *args, int from_tty)
+{
+  benchmark_opts opts;
+  parse_benchmark_options (&args, &opts,
+			   gdb::option::PROCESS_OPTIONS_UNKNOWN_IS_OPERAND);
+
+  /* Look up the given names, or the name of every minimal symbol.  */
+  std::vector<std::string> names;
+  if (args != nullptr)
+    {
+      gdb_argv argv (args);
+      for (const char *arg : argv)
+	names.emplace_back (arg);
+    }
+  else
+    {
+      for (objfile *objfile : current_program_space->objfiles ())
+	for (minimal_symbol *msym : objfile->msymbols ())
+	  names.emplace_back (msym->linkage_name ());
+      if (names.empty ())
+	error (_("No symbols to look up."));
+    }
+
+  benchmark bench ("lookup");
+  bench.run (opts.repeat, [&] ()
+    {
+      bench.phase ("minimal-symbols", [&] ()
+	{
+	  for (const std::string &name : names)
+	    lookup_minimal_symbol (name.c_str (), nullptr, nullptr);
+	  return names.size ();
+	});
+
+      bench.phase ("symbols", [&] ()
+	{
+	  for (const std::string &name : names)
+	    {
+	      lookup_symbol (name.c_str (), nullptr, VAR_DOMAIN, nullptr);
+	      QUIT;
+	    }
+	  return names.size ();
+	});
+    });
+}
+
+/* The "maintenance benchmark expand" command.  Symbol tables can't be
+   unexpanded, so only a first run would have work to do, and this
+   command doesn't take the -repeat option.  */
+
+static void
+maintenance_benchmark_expand (const char *args, int from_tty)
+{
+  if (args != nullptr && *skip_spaces (args) != '\0')
+    error (_("Junk at end of arguments."));
+
+  benchmark bench ("expand");
+  bench.run (1, [&] ()
+    {
+      bench.phase ("expand", [&] ()
+	{
+	  size_t n = 0;
+	  for (objfile *objfile : current_program_space->objfiles ())
+	    {
+	      objfile->expand_all_symtabs ();
+	      ++n;
+	    }
+	  return n;
+	});
+    });
+}
+
+/* The "maintenance benchmark unwind" command.  */
+
+static void
+maintenance_benchmark_unwind (const char *args, int from_tty)
+{
+  benchmark_opts opts;
+  parse_benchmark_options (&args, &opts,
+			   gdb::option::PROCESS_OPTIONS_UNKNOWN_IS_OPERAND);
+
+  /* The number of frames to unwind, or 0 for all of them.  */
+  ULONGEST limit = 0;
+  if (args != nullptr)
+    limit = parse_and_eval_long (args);
+
+  if (!has_stack_frames ())
+    error (_("No stack."));
+
+  benchmark bench ("unwind");
+  bench.run (opts.repeat, [&] ()
+    {
+      /* Start from scratch each time, so that every iteration does
+	 the same work.  */
+      reinit_frame_cache ();
+
+      std::vector<frame_info *> frames;
+      bench.phase ("unwind", [&] ()
+	{
+	  for (frame_info *frame = get_current_frame ();
+	       frame != nullptr && (limit == 0 || frames.size () < limit);
+	       frame = get_prev_frame (frame))
+	    {
+	      frames.push_back (frame);
+	      QUIT;
+	    }
+	  return frames.size ();
+	});
+
+      /* What "backtrace" then does with each frame.  */
+      bench.phase ("symbolize", [&] ()
+	{
+	  for (frame_info *frame : frames)
+	    {
+	      enum language funlang;
+	      gdb::unique_xmalloc_ptr<char> funname
+		= find_frame_funname (frame, &funlang, nullptr);
+	      find_frame_sal (frame);
+	      QUIT;
+	    }
+	  return frames.size ();
+	});
+    });
+}
+
+/* The "maintenance benchmark print" command.  */
+
+static void
+maintenance_benchmark_print (const char *args, int from_tty)
+{
+  benchmark_opts opts;
+  parse_benchmark_options (&args, &opts,
+			   gdb::option::PROCESS_OPTIONS_REQUIRE_DELIMITER);
+  if (args == nullptr)
+    error_no_arg (_("expression to print"));
+
+  benchmark bench ("print");
+  bench.run (opts.repeat, [&] ()
+    {
+      expression_up expr;
+      bench.phase ("parse", [&] ()
+	{
+	  expr = parse_expression (args);
+	  return (size_t) 1;
+	});
+
+      value *val = nullptr;
+      bench.phase ("evaluate", [&] ()
+	{
+	  val = evaluate_expression (expr.get ());
+	  return (size_t) 1;
+	});
+
+      /* Format the value like "print" would, including any
+	 pretty-printers, but discard the output.  */
+      bench.phase ("format", [&] ()
+	{
+	  value_print_options print_opts;
+	  get_user_print_options (&print_opts);
+	  string_file stream;
+	  value_print (val, &stream, &print_opts);
+	  return stream.size ();
+	});
+    });
+}
+
+void _initialize_maint_benchmark ();
+void
+_initialize_maint_benchmark ()
+{
+  cmd_list_element *c;
+
+  add_basic_prefix_cmd ("benchmark", class_maintenance, _("\
+Run a GDB benchmark workload and report its timings as JSON.\n\
+Each workload is split in phases.  The report gives the wall clock and\n\
+CPU time of the whole run, of each iteration and of each phase, as well\n\
+as GDB's peak resident set size, when the host can tell.\n\
+Every subcommand but \"expand\" accepts a \"-repeat N\" option, to run\n\
+the workload N times."),
+			&maint_benchmark_list, 0, &maintenancelist);
+
+  c = add_cmd ("index", class_maintenance, maintenance_benchmark_index, _("\
+Benchmark loading a file and building its symbol index.\n\
+Usage: maintenance benchmark index [-repeat N] FILE\n\
+FILE is loaded next to the current symbol files, and discarded again\n\
+after each iteration."),
+	       &maint_benchmark_list);
+  set_cmd_completer_handle_brkchars (c, benchmark_index_completer);
+
+  c = add_cmd ("lookup", class_maintenance, maintenance_benchmark_lookup, _("\
+Benchmark symbol lookups.\n\
+Usage: maintenance benchmark lookup [-repeat N] [NAME]...\n\
+Look up each NAME as a minimal symbol and then as a symbol.  Without\n\
+NAME, look up the name of every minimal symbol of the program."),
+	       &maint_benchmark_list);
+  set_cmd_completer_handle_brkchars (c, benchmark_options_completer);
+
+  c = add_cmd ("expand", class_maintenance, maintenance_benchmark_expand, _("\
+Benchmark the expansion of all the symbol tables.\n\
+Usage: maintenance benchmark expand\n\
+Expanded symbol tables stay expanded, so this runs the workload once."),
+	       &maint_benchmark_list);
+  set_cmd_completer (c, noop_completer);
+
+  c = add_cmd ("unwind", class_maintenance, maintenance_benchmark_unwind, _("\
+Benchmark unwinding the stack.\n\
+Usage: maintenance benchmark unwind [-repeat N] [COUNT]\n\
+Unwind COUNT frames, or the whole stack, starting from an empty frame\n\
+cache, and then find the function and source line of each frame."),
+	       &maint_benchmark_list);
+  set_cmd_completer_handle_brkchars (c, benchmark_options_completer);
+
+  c = add_cmd ("print", class_maintenance, maintenance_benchmark_print, _("\
+Benchmark printing an expression.\n\
+Usage: maintenance benchmark print [-repeat N --] EXPRESSION\n\
+Parse and evaluate EXPRESSION, and format its value as \"print\" would,\n\
+using any pretty-printers, without displaying it."),
+	       &maint_benchmark_list);
+  set_cmd_completer (c, expression_completer);
+}
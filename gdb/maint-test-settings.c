@@ -44,6 +44,8 @@ static unsigned int maintenance_test_settings_zuinteger;
 
 static int maintenance_test_settings_zuinteger_unlimited;
 
+static ULONGEST maintenance_test_settings_zulongest_unlimited;
+
 static std::string maintenance_test_settings_string;
 
 static std::string maintenance_test_settings_string_noescape;
@@ -200,6 +202,17 @@ command used for internal testing."),
     ("zuinteger-unlimited", class_maintenance,
      &maintenance_test_settings_zuinteger_unlimited, _("\
 command used for internal testing."), _("\
+command used for internal testing."),
+     nullptr, /* help_doc */
+     nullptr, /* set_cmd */
+     maintenance_show_test_settings_value_cmd,
+     &maintenance_set_test_settings_list,
+     &maintenance_show_test_settings_list);
+
+  add_setshow_zulongest_unlimited_cmd
+    ("zulongest-unlimited", class_maintenance,
+     &maintenance_test_settings_zulongest_unlimited, _("\
+command used for internal testing."), _("\
 command used for internal testing."),
      nullptr, /* help_doc */
      nullptr, /* set_cmd */
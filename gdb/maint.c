@@ -36,6 +36,7 @@
 #include "language.h"
 #include "symfile.h"
 #include "objfiles.h"
+#include "cp-support.h"
 #include "value.h"
 #include "top.h"
 #include "maint.h"
@@ -515,6 +516,7 @@ static void
 maintenance_print_statistics (const char *args, int from_tty)
 {
   print_objfile_statistics ();
+  cp_print_canonicalize_statistics ();
 }
 
 static void
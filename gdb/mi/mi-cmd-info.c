@@ -21,6 +21,7 @@
 #include "mi-cmds.h"
 #include "ada-lang.h"
 #include "arch-utils.h"
+#include "perf-counter.h"
 
 /* Implement the "-info-ada-exceptions" GDB/MI command.  */
 
@@ -104,3 +105,14 @@ mi_cmd_info_os (const char *command, char **argv, int argc)
       break;
     }
 }
+
+/* Implement the "-info-perf" GDB/MI command.  */
+
+void
+mi_cmd_info_perf (const char *command, char **argv, int argc)
+{
+  if (argc != 0)
+    error (_("Usage: -info-perf"));
+
+  print_perf_counters (current_uiout);
+}
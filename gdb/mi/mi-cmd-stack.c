@@ -34,6 +34,7 @@
 #include "extension.h"
 #include <ctype.h>
 #include "mi-parse.h"
+#include "mi-main.h"
 #include "gdbsupport/gdb_optional.h"
 #include "safe-ctype.h"
 #include "inferior.h"
@@ -147,6 +148,8 @@ mi_cmd_stack_list_frames (const char *command, char **argv, int argc)
   if (fi == NULL)
     error (_("-stack-list-frames: Not enough frames in stack."));
 
+  mi_stream_result ();
+
   ui_out_emit_list list_emitter (current_uiout, "stack");
 
   if (! raw_arg && frame_filters)
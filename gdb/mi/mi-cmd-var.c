@@ -32,6 +32,7 @@
 #include "mi-parse.h"
 #include "gdbsupport/gdb_optional.h"
 #include "inferior.h"
+#include "target-dcache.h"
 
 static void varobj_update_one (struct varobj *var,
 			       enum print_values print_values,
@@ -643,6 +644,11 @@ mi_cmd_var_update (const char *command, char **argv, int argc)
   else
     list_emitter.emplace (uiout, "changelist");
 
+  /* Varobjs often overlap, for instance a root and the root for one of
+     its children, or several pointers to the same object; read each
+     piece of memory only once.  */
+  scoped_all_memory_cache memory_cache;
+
   /* Check if the parameter is a "*", which means that we want to
      update all variables.  */
 
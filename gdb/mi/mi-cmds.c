@@ -294,6 +294,7 @@ add_builtin_mi_commands ()
   add_mi_cmd_mi ("info-ada-exceptions", mi_cmd_info_ada_exceptions);
   add_mi_cmd_mi ("info-gdb-mi-command", mi_cmd_info_gdb_mi_command);
   add_mi_cmd_mi ("info-os", mi_cmd_info_os);
+  add_mi_cmd_mi ("info-perf", mi_cmd_info_perf);
   add_mi_cmd_mi ("interpreter-exec", mi_cmd_interpreter_exec);
   add_mi_cmd_mi ("list-features", mi_cmd_list_features);
   add_mi_cmd_mi ("list-target-features", mi_cmd_list_target_features);
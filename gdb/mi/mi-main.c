@@ -137,6 +137,44 @@ mi_async_p (void)
   return mi_async && target_can_async_p ();
 }
 
+/* Size in bytes at which a streamed result record is flushed to the
+   frontend, or -1 if results are never streamed.  */
+static int mi_stream_threshold = -1;
+
+static void
+show_mi_stream_threshold (struct ui_file *file, int from_tty,
+			  struct cmd_list_element *c, const char *value)
+{
+  gdb_printf (file,
+	      _("The threshold for streaming MI result records is %s.\n"),
+	      value);
+}
+
+/* See mi-main.h.  */
+
+void
+mi_stream_result ()
+{
+  if (mi_stream_threshold < 0 || running_result_record_printed)
+    return;
+
+  /* Only stream when the result is going straight to the MI
+     interpreter's own output, and not e.g. into a CLI command's
+     buffer.  */
+  mi_interp *mi = dynamic_cast<mi_interp *> (command_interp ());
+  if (mi == nullptr || current_uiout != mi->mi_uiout)
+    return;
+
+  mi_ui_out *uiout = dynamic_cast<mi_ui_out *> (mi->mi_uiout);
+  if (uiout == nullptr || uiout->streaming ())
+    return;
+
+  if (current_token != nullptr)
+    gdb_puts (current_token, mi->raw_stdout);
+  gdb_puts ("^done", mi->raw_stdout);
+  uiout->start_streaming (mi->raw_stdout, mi_stream_threshold);
+}
+
 /* Command implementations.  FIXME: Is this libgdb?  No.  This is the MI
    layer that calls libgdb.  Any operation used in the below should be
    formalized.  */
@@ -1452,6 +1490,8 @@ mi_cmd_data_read_memory_bytes (const char *command, char **argv, int argc)
   if (result.size () == 0)
     error (_("Unable to read memory."));
 
+  mi_stream_result ();
+
   ui_out_emit_list list_emitter (uiout, "memory");
   for (const memory_read_result &read_result : result)
     {
@@ -1830,12 +1870,18 @@ captured_mi_execute_command (struct ui_out *uiout, struct mi_parse *context)
 	 uiout will most likely crash in the mi_out_* routines.  */
       if (!running_result_record_printed)
 	{
-	  gdb_puts (context->token, mi->raw_stdout);
-	  /* There's no particularly good reason why target-connect results
-	     in not ^done.  Should kill ^connected for MI3.  */
-	  gdb_puts (strcmp (context->command, "target-select") == 0
-		    ? "^connected" : "^done", mi->raw_stdout);
+	  /* If the command streamed its result, the prefix and some of
+	     the output have already been printed.  */
+	  if (!mi_out_streaming_p (uiout))
+	    {
+	      gdb_puts (context->token, mi->raw_stdout);
+	      /* There's no particularly good reason why target-connect
+		 results in not ^done.  Should kill ^connected for MI3.  */
+	      gdb_puts (strcmp (context->command, "target-select") == 0
+			? "^connected" : "^done", mi->raw_stdout);
+	    }
 	  mi_out_put (uiout, mi->raw_stdout);
+	  mi_out_stop_streaming (uiout);
 	  mi_out_rewind (uiout);
 	  mi_print_timing_maybe (mi->raw_stdout);
 	  gdb_puts ("\n", mi->raw_stdout);
@@ -1955,6 +2001,20 @@ mi_execute_command (const char *cmd, int from_tty)
 	  async_enable_stdin ();
 	  current_ui->prompt_state = PROMPT_NEEDED;
 
+	  /* If part of the result was already streamed, terminate that
+	     record before reporting the error.  The ui_out emitters
+	     have closed any open tuples and lists while unwinding, so
+	     what is buffered is well-formed.  */
+	  if (mi_out_streaming_p (current_uiout))
+	    {
+	      struct mi_interp *mi
+		= (struct mi_interp *) current_interpreter ();
+
+	      mi_out_put (current_uiout, mi->raw_stdout);
+	      gdb_puts ("\n", mi->raw_stdout);
+	      mi_out_stop_streaming (current_uiout);
+	    }
+
 	  /* The command execution failed and error() was called
 	     somewhere.  */
 	  mi_print_exception (command->token, result);
@@ -2777,4 +2837,17 @@ Tells GDB whether MI should be in asynchronous mode."),
     = add_alias_cmd ("target-async", mi_async_cmds.show, class_run, 0,
 		     &showlist);
   deprecate_cmd (show_target_async_cmd, "show mi-async");
+
+  add_setshow_zuinteger_unlimited_cmd ("mi-stream-threshold", class_support,
+				       &mi_stream_threshold, _("\
+Set the threshold for streaming large MI result records."), _("\
+Show the threshold for streaming large MI result records."), _("\
+Some MI commands, such as -stack-list-frames and -data-read-memory-bytes,\n\
+can produce very large results.  When this is set, such a result is\n\
+written to the frontend in pieces of about this many bytes as it is\n\
+produced, instead of being built in full before being printed.\n\
+\"unlimited\" (the default) disables streaming."),
+				       nullptr,
+				       show_mi_stream_threshold,
+				       &setlist, &showlist);
 }
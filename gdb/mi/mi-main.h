@@ -30,6 +30,14 @@ extern void mi_load_progress (const char *section_name,
 
 extern void mi_print_timing_maybe (struct ui_file *file);
 
+/* Called by MI commands that may produce a very large result, once
+   they can no longer fail before starting to emit it.  If "set
+   mi-stream-threshold" is in effect, the "^done" result record prefix
+   is printed immediately and the rest of the result is written to the
+   frontend as it is produced.  Otherwise, this does nothing.  */
+
+extern void mi_stream_result ();
+
 /* Whether MI is in async mode.  */
 
 extern int mi_async_p (void);
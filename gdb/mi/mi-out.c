@@ -137,6 +137,7 @@ mi_ui_out::do_field_string (int fldno, int width, ui_align align,
   if (string)
     stream->putstr (string, '"');
   gdb_printf (stream, "\"");
+  maybe_flush_stream ();
 }
 
 void
@@ -153,6 +154,7 @@ mi_ui_out::do_field_fmt (int fldno, int width, ui_align align,
     gdb_puts ("\"", stream);
   gdb_vprintf (stream, format, args);
   gdb_puts ("\"", stream);
+  maybe_flush_stream ();
 }
 
 void
@@ -248,6 +250,33 @@ mi_ui_out::close (ui_out_type type)
     }
 
   m_suppress_field_separator = false;
+  maybe_flush_stream ();
+}
+
+void
+mi_ui_out::maybe_flush_stream ()
+{
+  /* Output redirected elsewhere (e.g. to a CLI command's buffer) is
+     never streamed.  */
+  if (m_stream_to == nullptr || m_streams.size () != 1)
+    return;
+
+  string_file *mi_stream = main_stream ();
+  if (mi_stream->size () < m_stream_threshold)
+    return;
+
+  m_stream_to->write (mi_stream->data (), mi_stream->size ());
+  mi_stream->clear ();
+  gdb_flush (m_stream_to);
+}
+
+/* See mi-out.h.  */
+
+void
+mi_ui_out::start_streaming (ui_file *dest, size_t threshold)
+{
+  m_stream_to = dest;
+  m_stream_threshold = threshold;
 }
 
 string_file *
@@ -349,3 +378,19 @@ mi_out_rewind (ui_out *uiout)
 {
   return as_mi_ui_out (uiout)->rewind ();
 }
+
+/* See mi-out.h.  */
+
+bool
+mi_out_streaming_p (ui_out *uiout)
+{
+  return as_mi_ui_out (uiout)->streaming ();
+}
+
+/* See mi-out.h.  */
+
+void
+mi_out_stop_streaming (ui_out *uiout)
+{
+  as_mi_ui_out (uiout)->stop_streaming ();
+}
@@ -40,6 +40,22 @@ class mi_ui_out : public ui_out
   /* Return the version number of the current MI.  */
   int version ();
 
+  /* Start streaming the result to DEST.  From now on, whenever the
+     buffered output reaches THRESHOLD bytes it is written to DEST and
+     the buffer is cleared, instead of accumulating the whole result
+     in memory.  The caller is responsible for having already written
+     the result record prefix to DEST.  */
+  void start_streaming (ui_file *dest, size_t threshold);
+
+  /* Stop streaming.  Any output still in the buffer is left there, to
+     be written by put.  */
+  void stop_streaming ()
+  { m_stream_to = nullptr; }
+
+  /* Return true if output is currently being streamed.  */
+  bool streaming () const
+  { return m_stream_to != nullptr; }
+
   bool can_emit_style_escape () const override
   {
     return false;
@@ -101,6 +117,10 @@ class mi_ui_out : public ui_out
   void open (const char *name, ui_out_type type);
   void close (ui_out_type type);
 
+  /* If streaming, and the buffer has grown past the threshold, write
+     it out to the streaming destination.  */
+  void maybe_flush_stream ();
+
   /* Convenience method that returns the MI out's string stream cast
      to its appropriate type.  Assumes/asserts that output was not
      redirected.  */
@@ -110,6 +130,13 @@ class mi_ui_out : public ui_out
   bool m_suppress_output;
   int m_mi_version;
   std::vector<ui_file *> m_streams;
+
+  /* Where buffered output is written when streaming, or nullptr if
+     the result is being accumulated in full.  */
+  ui_file *m_stream_to = nullptr;
+
+  /* Buffer size at which streamed output is flushed.  */
+  size_t m_stream_threshold = 0;
 };
 
 /* Create an MI ui-out object with MI version MI_VERSION, which should be equal
@@ -122,4 +149,11 @@ int mi_version (ui_out *uiout);
 void mi_out_put (ui_out *uiout, struct ui_file *stream);
 void mi_out_rewind (ui_out *uiout);
 
+/* Return true if UIOUT, which must be an MI ui-out, is streaming its
+   result.  */
+bool mi_out_streaming_p (ui_out *uiout);
+
+/* Stop streaming UIOUT's result; see mi_ui_out::stop_streaming.  */
+void mi_out_stop_streaming (ui_out *uiout);
+
 #endif /* MI_MI_OUT_H */
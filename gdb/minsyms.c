@@ -54,6 +54,7 @@
 #include <algorithm>
 #include "safe-ctype.h"
 #include "gdbsupport/parallel-for.h"
+#include "gdbsupport/thread-pool.h"
 #include "inferior.h"
 
 #if CXX_STD_THREAD
@@ -731,9 +732,7 @@ lookup_minimal_symbol_by_pc_section (CORE_ADDR pc_in, struct obj_section *sectio
 				     lookup_msym_prefer prefer,
 				     bound_minimal_symbol *previous)
 {
-  int lo;
   int hi;
-  int newobj;
   struct minimal_symbol *msymbol;
   struct minimal_symbol *best_symbol = NULL;
   struct objfile *best_objfile = NULL;
@@ -777,8 +776,10 @@ lookup_minimal_symbol_by_pc_section (CORE_ADDR pc_in, struct obj_section *sectio
 	  int best_zero_sized = -1;
 
 	  msymbol = objfile->per_bfd->msymbols.get ();
-	  lo = 0;
-	  hi = objfile->per_bfd->minimal_symbol_count - 1;
+	  const std::vector<CORE_ADDR> &addresses
+	    = objfile->per_bfd->msymbol_addresses;
+	  gdb_assert (addresses.size ()
+		      == objfile->per_bfd->minimal_symbol_count);
 
 	  /* This code assumes that the minimal symbols are sorted by
 	     ascending address values.  If the pc value is greater than or
@@ -787,43 +788,17 @@ lookup_minimal_symbol_by_pc_section (CORE_ADDR pc_in, struct obj_section *sectio
 	     "best" symbol.  This includes the last real symbol, for cases
 	     where the pc value is larger than any address in this vector.
 
-	     By iterating until the address associated with the current
-	     hi index (the endpoint of the test interval) is less than
-	     or equal to the desired pc value, we accomplish two things:
-	     (1) the case where the pc value is larger than any minimal
-	     symbol address is trivially solved, (2) the address associated
-	     with the hi index is always the one we want when the iteration
-	     terminates.  In essence, we are iterating the test interval
-	     down until the pc value is pushed out of it from the high end.
-
-	     Warning: this code is trickier than it would appear at first.  */
+	     Start with HI being the last symbol whose address is less
+	     than or equal to PC.  If we have multiple symbols at the same
+	     address, this is the last one; that way we can find the right
+	     symbol if it has an index greater than the first.  */
 
 	  if (frob_address (objfile, &pc)
-	      && pc >= msymbol[lo].value_raw_address ())
+	      && pc >= addresses[0])
 	    {
-	      while (msymbol[hi].value_raw_address () > pc)
-		{
-		  /* pc is still strictly less than highest address.  */
-		  /* Note "new" will always be >= lo.  */
-		  newobj = (lo + hi) / 2;
-		  if ((msymbol[newobj].value_raw_address () >= pc)
-		      || (lo == newobj))
-		    {
-		      hi = newobj;
-		    }
-		  else
-		    {
-		      lo = newobj;
-		    }
-		}
-
-	      /* If we have multiple symbols at the same address, we want
-		 hi to point to the last one.  That way we can find the
-		 right symbol if it has an index greater than hi.  */
-	      while (hi < objfile->per_bfd->minimal_symbol_count - 1
-		     && (msymbol[hi].value_raw_address ()
-			 == msymbol[hi + 1].value_raw_address ()))
-		hi++;
+	      hi = (std::upper_bound (addresses.begin (), addresses.end (),
+				      pc)
+		    - addresses.begin ()) - 1;
 
 	      /* Skip various undesirable symbols.  */
 	      while (hi >= 0)
@@ -1354,6 +1329,23 @@ build_minimal_symbol_hash_tables
 
   /* (Re)insert the actual entries.  */
   int mcount = objfile->per_bfd->minimal_symbol_count;
+
+  /* The two tables are independent of each other; they use different
+     fields of the minimal symbols.  So, fill in the demangled table in
+     the background while this thread does the linkage name one.  */
+  gdb::future<void> demangled_done
+    = gdb::thread_pool::g_thread_pool->post_task ([&] ()
+      {
+	minimal_symbol *dmsym = objfile->per_bfd->msymbols.get ();
+	for (int j = 0; j < mcount; j++, dmsym++)
+	  {
+	    dmsym->demangled_hash_next = 0;
+	    if (dmsym->search_name () != dmsym->linkage_name ())
+	      add_minsym_to_demangled_hash_table
+		(dmsym, objfile, hash_values[j].minsym_demangled_hash);
+	  }
+      });
+
   for ((i = 0,
 	msym = objfile->per_bfd->msymbols.get ());
        i < mcount;
@@ -1362,12 +1354,9 @@ build_minimal_symbol_hash_tables
       msym->hash_next = 0;
       add_minsym_to_hash_table (msym, objfile->per_bfd->msymbol_hash,
 				hash_values[i].minsym_hash);
-
-      msym->demangled_hash_next = 0;
-      if (msym->search_name () != msym->linkage_name ())
-	add_minsym_to_demangled_hash_table
-	  (msym, objfile, hash_values[i].minsym_demangled_hash);
     }
+
+  demangled_done.wait ();
 }
 
 /* Add the minimal symbols in the existing bunches to the objfile's official
@@ -1451,6 +1440,13 @@ minimal_symbol_reader::install ()
       m_objfile->per_bfd->minimal_symbol_count = mcount;
       m_objfile->per_bfd->msymbols = std::move (msym_holder);
 
+      msymbols = m_objfile->per_bfd->msymbols.get ();
+      std::vector<CORE_ADDR> &addresses
+	= m_objfile->per_bfd->msymbol_addresses;
+      addresses.resize (mcount);
+      for (int i = 0; i < mcount; ++i)
+	addresses[i] = msymbols[i].value_raw_address ();
+
 #if CXX_STD_THREAD
       /* Mutex that is used when modifying or accessing the demangled
 	 hash table.  */
@@ -642,6 +642,8 @@ objfile_relocate1 (struct objfile *objfile,
   if (!something_changed)
     return 0;
 
+  objfile->compunits_changed ();
+
   /* OK, get all the symtabs.  */
   {
     for (compunit_symtab *cust : objfile->compunits ())
@@ -807,6 +809,36 @@ objfile_has_full_symbols (struct objfile *objfile)
   return objfile->compunit_symtabs != NULL;
 }
 
+/* See objfiles.h.  */
+
+bool
+objfile::compunits_may_contain_pc (CORE_ADDR pc)
+{
+  if (!compunits_range_valid)
+    {
+      bool empty = true;
+
+      compunits_low = 0;
+      compunits_high = 0;
+      for (compunit_symtab *cust : compunits ())
+	{
+	  const struct block *global_block
+	    = cust->blockvector ()->global_block ();
+
+	  if (global_block->start () >= global_block->end ())
+	    continue;
+	  if (empty || global_block->start () < compunits_low)
+	    compunits_low = global_block->start ();
+	  if (empty || global_block->end () > compunits_high)
+	    compunits_high = global_block->end ();
+	  empty = false;
+	}
+      compunits_range_valid = true;
+    }
+
+  return compunits_low <= pc && pc < compunits_high;
+}
+
 /* Return non-zero if OBJFILE has full or partial symbols, either directly
    or through a separate debug file.  */
 
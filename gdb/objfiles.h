@@ -33,6 +33,7 @@
 #include <vector>
 #include "gdbsupport/next-iterator.h"
 #include "gdbsupport/safe-iterator.h"
+#include "gdbsupport/hash-table.h"
 #include "bcache.h"
 #include "gdbarch.h"
 #include "gdbsupport/refcounted-object.h"
@@ -226,6 +227,19 @@ struct minimal_symbol_iterator
   struct minimal_symbol *m_msym;
 };
 
+struct demangled_name_entry;
+
+/* Traits for objfile_per_bfd_storage::demangled_names_hash.  These are
+   defined in symtab.c.  */
+
+struct demangled_name_traits
+{
+  static hashval_t hash (demangled_name_entry *const &entry);
+  static bool equal (demangled_name_entry *const &entry,
+		     gdb::string_view mangled);
+  static void remove (demangled_name_entry *&entry);
+};
+
 /* Some objfile data is hung off the BFD.  This enables sharing of the
    data across all objfiles using the BFD.  The data is stored in an
    instance of this structure, and associated with the BFD using the
@@ -240,7 +254,8 @@ struct objfile_per_bfd_storage
   ~objfile_per_bfd_storage ();
 
   /* Intern STRING in this object's string cache and return the unique copy.
-     The copy has the same lifetime as this object.
+     The copy has the same lifetime as this object.  This may be called
+     from worker threads.
 
      STRING must be null-terminated.  */
 
@@ -269,7 +284,7 @@ struct objfile_per_bfd_storage
 
   /* String cache.  */
 
-  gdb::bcache string_cache;
+  gdb::concurrent_bcache string_cache;
 
   /* The gdbarch associated with the BFD.  Note that this gdbarch is
      determined solely from BFD information, without looking at target
@@ -280,11 +295,12 @@ struct objfile_per_bfd_storage
 
   /* Hash table for mapping symbol names to demangled names.  Each
      entry in the hash table is a demangled_name_entry struct, storing the
-     language and two consecutive strings, both null-terminated; the first one
-     is a mangled or linkage name, and the second is the demangled name or just
-     a zero byte if the name doesn't demangle.  */
+     language, the mangled or linkage name, and the demangled name, or
+     nullptr if the name doesn't demangle.  The table is searched with
+     the linkage name, as a gdb::string_view.  */
 
-  htab_up demangled_names_hash;
+  gdb::hash_table<demangled_name_entry *, demangled_name_traits>
+    demangled_names_hash;
 
   /* The per-objfile information about the entry point, the scope (file/func)
      containing the entry point, and the scope of the user's main() func.  */
@@ -309,6 +325,11 @@ struct objfile_per_bfd_storage
   gdb::unique_xmalloc_ptr<minimal_symbol> msymbols;
   int minimal_symbol_count = 0;
 
+  /* The raw addresses of MSYMBOLS, in the same order.  Searching this
+     compact array by PC touches far fewer cache lines than searching
+     MSYMBOLS itself.  */
+  std::vector<CORE_ADDR> msymbol_addresses;
+
   /* The number of minimal symbols read, before any minimal symbol
      de-duplication is applied.  Note in particular that this has only
      a passing relationship with the actual size of the table above;
@@ -431,6 +452,20 @@ struct objfile
     return compunit_symtab_range (compunit_symtabs);
   }
 
+  /* Return false if PC is outside the global block of every compunit
+     of this objfile, so that a search for the compunit containing PC
+     can skip it.  */
+
+  bool compunits_may_contain_pc (CORE_ADDR pc);
+
+  /* Forget the address range of the compunits, after a compunit is
+     added or the blocks are relocated.  */
+
+  void compunits_changed ()
+  {
+    compunits_range_valid = false;
+  }
+
   /* A range adapter that makes it possible to iterate over all
      minimal symbols of an objfile.  */
 
@@ -648,6 +683,15 @@ struct objfile
 
   struct compunit_symtab *compunit_symtabs = nullptr;
 
+  /* The lowest start and the highest end address of the global blocks
+     of COMPUNIT_SYMTABS, when COMPUNITS_RANGE_VALID.  They are
+     computed on demand by compunits_may_contain_pc, because some
+     readers fill in the blocks after adding the compunit.  */
+
+  CORE_ADDR compunits_low = 0;
+  CORE_ADDR compunits_high = 0;
+  bool compunits_range_valid = false;
+
   /* The object file's BFD.  Can be null if the objfile contains only
      minimal symbols, e.g. the run time common symbols for SunOS4.  */
 
@@ -0,0 +1,140 @@
+/* Performance counters for GDB.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include "defs.h"
+#include "perf-counter.h"
+#include "gdbcmd.h"
+#include "ui-out.h"
+#include <algorithm>
+
+/* Return the list of registered counters.  This is a function so that
+   counters defined as static objects in other files can be registered
+   whatever the order of the static constructors.  */
+
+static std::vector<perf_counter *> &
+perf_counter_registry ()
+{
+  static std::vector<perf_counter *> registry;
+  return registry;
+}
+
+perf_counter::perf_counter (const char *name, perf_counter_unit unit,
+			    const char *doc)
+  : m_name (name),
+    m_unit (unit),
+    m_doc (doc)
+{
+  perf_counter_registry ().push_back (this);
+}
+
+/* See perf-counter.h.  */
+
+std::vector<perf_counter *>
+all_perf_counters ()
+{
+  std::vector<perf_counter *> result = perf_counter_registry ();
+  std::sort (result.begin (), result.end (),
+	     [] (const perf_counter *a, const perf_counter *b)
+	     {
+	       return strcmp (a->name (), b->name ()) < 0;
+	     });
+  return result;
+}
+
+/* See perf-counter.h.  */
+
+const char *
+perf_counter_unit_name (perf_counter_unit unit)
+{
+  switch (unit)
+    {
+    case perf_counter_unit::count:
+      return "count";
+    case perf_counter_unit::bytes:
+      return "bytes";
+    case perf_counter_unit::nanoseconds:
+      return "ns";
+    }
+
+  gdb_assert_not_reached ("unknown perf_counter_unit");
+}
+
+/* See perf-counter.h.  */
+
+void
+print_perf_counters (struct ui_out *uiout)
+{
+  std::vector<perf_counter *> counters = all_perf_counters ();
+
+  size_t name_width = strlen ("Name");
+  for (const perf_counter *counter : counters)
+    name_width = std::max (name_width, strlen (counter->name ()));
+
+  ui_out_emit_table table_emitter (uiout, 4, counters.size (), "counters");
+  uiout->table_header (name_width, ui_left, "name", "Name");
+  uiout->table_header (20, ui_right, "value", "Value");
+  uiout->table_header (5, ui_left, "unit", "Unit");
+  uiout->table_header (1, ui_noalign, "description", "Description");
+  uiout->table_body ();
+
+  for (const perf_counter *counter : counters)
+    {
+      ui_out_emit_tuple tuple_emitter (uiout, "counter");
+      uiout->field_string ("name", counter->name ());
+      uiout->field_string ("value", pulongest (counter->value ()));
+      uiout->field_string ("unit", perf_counter_unit_name (counter->unit ()));
+      uiout->field_string ("description", counter->doc ());
+      uiout->text ("\n");
+    }
+}
+
+/* The "maintenance print counters" command.  */
+
+static void
+maintenance_print_counters (const char *args, int from_tty)
+{
+  print_perf_counters (current_uiout);
+}
+
+/* The "maintenance flush counters" command.  */
+
+static void
+maintenance_flush_counters (const char *args, int from_tty)
+{
+  for (perf_counter *counter : perf_counter_registry ())
+    counter->reset ();
+}
+
+void _initialize_perf_counter ();
+void
+_initialize_perf_counter ()
+{
+  add_cmd ("counters", class_maintenance, maintenance_print_counters, _("\
+Print GDB's performance counters.\n\
+Usage: maintenance print counters\n\
+The counters record how often GDB went through some of its hot paths,\n\
+and how much time it spent there, since GDB started or since they were\n\
+last reset with \"maintenance flush counters\"."),
+	   &maintenanceprintlist);
+
+  add_cmd ("counters", class_maintenance, maintenance_flush_counters, _("\
+Reset GDB's performance counters to zero.\n\
+Usage: maintenance flush counters"),
+	   &maintenanceflushlist);
+}
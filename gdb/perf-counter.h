@@ -0,0 +1,144 @@
+/* Performance counters for GDB.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#ifndef PERF_COUNTER_H
+#define PERF_COUNTER_H
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+/* The unit of a perf_counter's value.  */
+
+enum class perf_counter_unit
+{
+  /* A number of events.  */
+  count,
+
+  /* A number of bytes.  */
+  bytes,
+
+  /* A time, in nanoseconds.  */
+  nanoseconds,
+};
+
+/* A named counter, incremented by some GDB subsystem whenever an event
+   of interest happens on one of its hot paths.  Counters are meant to
+   be defined as static objects; they register themselves on
+   construction, and are then listed by "maint print counters", the
+   MI -info-perf command and gdb.perf_counters.
+
+   Updating a counter is a relaxed atomic addition, so that counters
+   can be updated from worker threads, and are cheap enough to be left
+   enabled all the time.  */
+
+class perf_counter
+{
+public:
+
+  /* Create and register a counter.  NAME and DOC must be static
+     strings.  By convention, NAME is made of lowercase words separated
+     by dashes, the first of which names the subsystem.  */
+  perf_counter (const char *name, perf_counter_unit unit, const char *doc);
+
+  DISABLE_COPY_AND_ASSIGN (perf_counter);
+
+  /* Add N to the counter.  */
+  void add (unsigned long long n = 1)
+  {
+    m_value.fetch_add (n, std::memory_order_relaxed);
+  }
+
+  /* Return the value of the counter.  */
+  unsigned long long value () const
+  {
+    return m_value.load (std::memory_order_relaxed);
+  }
+
+  /* Reset the counter to zero.  */
+  void reset ()
+  {
+    m_value.store (0, std::memory_order_relaxed);
+  }
+
+  const char *name () const
+  {
+    return m_name;
+  }
+
+  perf_counter_unit unit () const
+  {
+    return m_unit;
+  }
+
+  const char *doc () const
+  {
+    return m_doc;
+  }
+
+private:
+
+  const char *m_name;
+  perf_counter_unit m_unit;
+  const char *m_doc;
+  std::atomic<unsigned long long> m_value { 0 };
+};
+
+/* Add the time spent between its construction and its destruction to
+   a perf_counter whose unit is perf_counter_unit::nanoseconds.  */
+
+class scoped_perf_timer
+{
+public:
+
+  explicit scoped_perf_timer (perf_counter *counter)
+    : m_counter (counter),
+      m_start (std::chrono::steady_clock::now ())
+  {
+  }
+
+  ~scoped_perf_timer ()
+  {
+    using namespace std::chrono;
+
+    m_counter->add (duration_cast<nanoseconds>
+		    (steady_clock::now () - m_start).count ());
+  }
+
+  DISABLE_COPY_AND_ASSIGN (scoped_perf_timer);
+
+private:
+
+  perf_counter *m_counter;
+  std::chrono::steady_clock::time_point m_start;
+};
+
+/* Return all the counters, sorted by name.  */
+
+extern std::vector<perf_counter *> all_perf_counters ();
+
+/* Return the name of UNIT, as shown to the user.  */
+
+extern const char *perf_counter_unit_name (perf_counter_unit unit);
+
+/* Print all the counters to UIOUT, as a table called "counters".  */
+
+extern void print_perf_counters (struct ui_out *uiout);
+
+#endif /* PERF_COUNTER_H */
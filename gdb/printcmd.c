@@ -1242,7 +1242,16 @@ print_command_parse_format (const char **expp, const char *cmdname,
 void
 print_value (value *val, const value_print_options &opts)
 {
-  int histindex = record_latest_value (val);
+  /* Of an array too large to be printed in full, only read the
+     elements that are printed; the others are unavailable in the value
+     history.  */
+  bool partial = val_print_fetch_array_part (val, &opts);
+  int histindex = record_latest_value (val, partial);
+  SCOPE_EXIT
+    {
+      if (partial)
+	value_finish_partial_fetch (val);
+    };
 
   annotate_value_history_begin (histindex, value_type (val));
 
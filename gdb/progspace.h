@@ -363,6 +363,11 @@ struct program_space
   /* Number of calls to solib_add.  */
   unsigned int solib_add_generation = 0;
 
+  /* True if reading the symbols of shared libraries loaded into this
+     program space was put off until the next stop reported to the
+     user.  See "set defer-solib-symbols".  Managed by solib.c.  */
+  bool solib_symbols_deferred = false;
+
   /* When an solib is added, it is also added to this vector.  This
      is so we can properly report solib changes to the user.  */
   std::vector<struct so_list *> added_solibs;
@@ -1288,8 +1288,7 @@ partial_symtab::add_psymbol (gdb::string_view name, bool copy_name,
 			     psymtab_storage *partial_symtabs,
 			     struct objfile *objfile)
 {
-  struct partial_symbol psymbol;
-  memset (&psymbol, 0, sizeof (psymbol));
+  struct partial_symbol psymbol {};
 
   psymbol.set_unrelocated_address (coreaddr);
   psymbol.ginfo.set_section_index (section);
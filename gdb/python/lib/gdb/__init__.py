@@ -253,3 +253,26 @@ def with_parameter(name, value):
         yield None
     finally:
         set_parameter(name, old_value)
+
+
+def post_to_worker(function, callback=None):
+    """Run FUNCTION, a callable taking no arguments, in a worker thread.
+    If CALLBACK is given, it is then called in GDB's thread with the
+    result of FUNCTION.  If FUNCTION raises an exception, it is reported
+    in GDB's thread instead."""
+
+    def task():
+        try:
+            result = function()
+        except BaseException as e:
+            exception = e
+
+            def report():
+                raise exception
+
+            post_event(report)
+            return
+        if callback is not None:
+            post_event(lambda: callback(result))
+
+    _gdb._post_to_worker(task)
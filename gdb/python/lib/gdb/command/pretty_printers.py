@@ -318,6 +318,8 @@ def do_enable_pretty_printer(arg, flag):
                 objfile.pretty_printers, name_re, subname_re, flag
             )
 
+    gdb.invalidate_cached_pretty_printers()
+
     if flag:
         state = "enabled"
     else:
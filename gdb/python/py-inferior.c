@@ -531,6 +531,7 @@ infpy_read_memory (PyObject *self, PyObject *args, PyObject *kw)
     {
       buffer.reset ((gdb_byte *) xmalloc (length));
 
+      gdbpy_allow_threads allow_threads;
       read_memory (addr, buffer.get (), length);
     }
   catch (const gdb_exception &except)
@@ -542,6 +543,87 @@ infpy_read_memory (PyObject *self, PyObject *args, PyObject *kw)
   return gdbpy_buffer_to_membuf (std::move (buffer), addr, length);
 }
 
+/* Implementation of Inferior.read_memory_batch (ranges).  RANGES is an
+   iterable of (address, length) pairs.  Returns a list holding one
+   buffer object per pair, in the same order, as Inferior.read_memory
+   would.  The reads are handed to the target together, so it can serve
+   them with fewer round trips.  Returns NULL on error, with a python
+   exception set.  */
+static PyObject *
+infpy_read_memory_batch (PyObject *self, PyObject *args, PyObject *kw)
+{
+  PyObject *ranges_obj;
+  static const char *keywords[] = { "ranges", NULL };
+
+  if (!gdb_PyArg_ParseTupleAndKeywords (args, kw, "O", keywords,
+					&ranges_obj))
+    return NULL;
+
+  gdbpy_ref<> iter (PyObject_GetIter (ranges_obj));
+  if (iter == NULL)
+    return NULL;
+
+  std::vector<memory_read_request> requests;
+  std::vector<gdb::unique_xmalloc_ptr<gdb_byte>> buffers;
+  while (true)
+    {
+      gdbpy_ref<> item (PyIter_Next (iter.get ()));
+      if (item == NULL)
+	{
+	  if (PyErr_Occurred ())
+	    return NULL;
+	  break;
+	}
+
+      PyObject *addr_obj, *length_obj;
+      if (!PyArg_ParseTuple (item.get (), "OO", &addr_obj, &length_obj))
+	return NULL;
+
+      memory_read_request req;
+      CORE_ADDR length;
+      if (get_addr_from_python (addr_obj, &req.addr) < 0
+	  || get_addr_from_python (length_obj, &length) < 0)
+	return NULL;
+
+      buffers.emplace_back ((gdb_byte *) xmalloc (length));
+      req.buf = buffers.back ().get ();
+      req.len = length;
+      requests.push_back (req);
+    }
+
+  try
+    {
+      gdbpy_allow_threads allow_threads;
+
+      /* If the batch could not be read in full, redo the reads one by
+	 one, so that the first failing one raises the same error as
+	 Inferior.read_memory would.  */
+      if (!target_read_raw_memory_batch (requests))
+	for (const memory_read_request &req : requests)
+	  read_memory (req.addr, req.buf, req.len);
+    }
+  catch (const gdb_exception &except)
+    {
+      GDB_PY_HANDLE_EXCEPTION (except);
+    }
+
+  gdbpy_ref<> list (PyList_New (requests.size ()));
+  if (list == NULL)
+    return NULL;
+
+  for (size_t i = 0; i < requests.size (); i++)
+    {
+      PyObject *membuf = gdbpy_buffer_to_membuf (std::move (buffers[i]),
+						 requests[i].addr,
+						 requests[i].len);
+      if (membuf == NULL)
+	return NULL;
+      PyList_SET_ITEM (list.get (), i, membuf);
+    }
+
+  return list.release ();
+}
+
 /* Implementation of Inferior.write_memory (address, buffer [, length]).
    Writes the contents of BUFFER (a Python object supporting the read
    buffer protocol) at ADDRESS in the inferior's memory.  Write LENGTH
@@ -642,6 +724,7 @@ infpy_search_memory (PyObject *self, PyObject *args, PyObject *kw)
 
   try
     {
+      gdbpy_allow_threads allow_threads;
       found = target_search_memory (start_addr, length,
 				    buffer, pattern_size,
 				    &found_addr);
@@ -886,6 +969,10 @@ Return true if this inferior is valid, false if not." },
     METH_VARARGS | METH_KEYWORDS,
     "read_memory (address, length) -> buffer\n\
 Return a buffer object for reading from the inferior's memory." },
+  { "read_memory_batch", (PyCFunction) infpy_read_memory_batch,
+    METH_VARARGS | METH_KEYWORDS,
+    "read_memory_batch (ranges) -> list\n\
+Return a list of buffer objects, one per (address, length) pair in RANGES." },
   { "write_memory", (PyCFunction) infpy_write_memory,
     METH_VARARGS | METH_KEYWORDS,
     "write_memory (address, buffer [, length])\n\
@@ -26,6 +26,9 @@
 #include "python.h"
 #include "python-internal.h"
 #include "cli/cli-style.h"
+#include "observable.h"
+#include "progspace.h"
+#include <unordered_map>
 
 /* Return type of print_string_repr.  */
 
@@ -41,12 +44,12 @@ enum gdbpy_string_repr_result
 
 /* Helper function for find_pretty_printer which iterates over a list,
    calls each function and inspects output.  This will return a
-   printer object if one recognizes VALUE.  If no printer is found, it
-   will return None.  On error, it will set the Python error and
-   return NULL.  */
+   printer object if one recognizes VALUE, and store the function that
+   did in *FUNCTION.  If no printer is found, it will return None.  On
+   error, it will set the Python error and return NULL.  */
 
 static gdbpy_ref<>
-search_pp_list (PyObject *list, PyObject *value)
+search_pp_list (PyObject *list, PyObject *value, gdbpy_ref<> *function_out)
 {
   Py_ssize_t pp_list_size, list_index;
 
@@ -78,7 +81,10 @@ search_pp_list (PyObject *list, PyObject *value)
       if (printer == NULL)
 	return NULL;
       else if (printer != Py_None)
-	return printer;
+	{
+	  *function_out = gdbpy_ref<>::new_reference (function);
+	  return printer;
+	}
     }
 
   return gdbpy_ref<>::new_reference (Py_None);
@@ -91,7 +97,7 @@ search_pp_list (PyObject *list, PyObject *value)
    Otherwise the result is the pretty-printer function, suitably inc-ref'd.  */
 
 static PyObject *
-find_pretty_printer_from_objfiles (PyObject *value)
+find_pretty_printer_from_objfiles (PyObject *value, gdbpy_ref<> *function_out)
 {
   for (objfile *obj : current_program_space->objfiles ())
     {
@@ -104,7 +110,8 @@ find_pretty_printer_from_objfiles (PyObject *value)
 	}
 
       gdbpy_ref<> pp_list (objfpy_get_printers (objf.get (), NULL));
-      gdbpy_ref<> function (search_pp_list (pp_list.get (), value));
+      gdbpy_ref<> function (search_pp_list (pp_list.get (), value,
+					    function_out));
 
       /* If there is an error in any objfile list, abort the search and exit.  */
       if (function == NULL)
@@ -124,14 +131,14 @@ find_pretty_printer_from_objfiles (PyObject *value)
    Otherwise the result is the pretty-printer function, suitably inc-ref'd.  */
 
 static gdbpy_ref<>
-find_pretty_printer_from_progspace (PyObject *value)
+find_pretty_printer_from_progspace (PyObject *value, gdbpy_ref<> *function_out)
 {
   gdbpy_ref<> obj = pspace_to_pspace_object (current_program_space);
 
   if (obj == NULL)
     return NULL;
   gdbpy_ref<> pp_list (pspy_get_printers (obj.get (), NULL));
-  return search_pp_list (pp_list.get (), value);
+  return search_pp_list (pp_list.get (), value, function_out);
 }
 
 /* Subroutine of find_pretty_printer to simplify it.
@@ -141,7 +148,7 @@ find_pretty_printer_from_progspace (PyObject *value)
    Otherwise the result is the pretty-printer function, suitably inc-ref'd.  */
 
 static gdbpy_ref<>
-find_pretty_printer_from_gdb (PyObject *value)
+find_pretty_printer_from_gdb (PyObject *value, gdbpy_ref<> *function_out)
 {
   /* Fetch the global pretty printer list.  */
   if (gdb_python_module == NULL
@@ -152,29 +159,128 @@ find_pretty_printer_from_gdb (PyObject *value)
   if (pp_list == NULL || ! PyList_Check (pp_list.get ()))
     return gdbpy_ref<>::new_reference (Py_None);
 
-  return search_pp_list (pp_list.get (), value);
+  return search_pp_list (pp_list.get (), value, function_out);
 }
 
-/* Find the pretty-printing constructor function for VALUE.  If no
-   pretty-printer exists, return None.  If one exists, return a new
-   reference.  On error, set the Python error and return NULL.  */
+/* Search all the pretty-printer lists for a printer for VALUE, in
+   order.  The result is as for search_pp_list.  */
 
 static gdbpy_ref<>
-find_pretty_printer (PyObject *value)
+search_pretty_printers (PyObject *value, gdbpy_ref<> *function_out)
 {
   /* Look at the pretty-printer list for each objfile
      in the current program-space.  */
-  gdbpy_ref<> function (find_pretty_printer_from_objfiles (value));
+  gdbpy_ref<> function (find_pretty_printer_from_objfiles (value,
+							   function_out));
   if (function == NULL || function != Py_None)
     return function;
 
   /* Look at the pretty-printer list for the current program-space.  */
-  function = find_pretty_printer_from_progspace (value);
+  function = find_pretty_printer_from_progspace (value, function_out);
   if (function == NULL || function != Py_None)
     return function;
 
   /* Look at the pretty-printer list in the gdb module.  */
-  return find_pretty_printer_from_gdb (value);
+  return find_pretty_printer_from_gdb (value, function_out);
+}
+
+/* The pretty-printer lookups done by find_pretty_printer, keyed by the
+   type of the value.  The mapped object is the lookup function that
+   recognized a value of that type, or None if no function did.
+
+   Printing a container calls find_pretty_printer for each of its
+   elements, all of the same type, and each search calls every
+   registered lookup function until one matches.  With this cache,
+   only the matching function is called again.  */
+
+static std::unordered_map<struct type *, gdbpy_ref<>> pp_lookup_cache;
+
+/* The program space whose printers PP_LOOKUP_CACHE was filled from.  */
+
+static program_space *pp_lookup_cache_pspace;
+
+/* Set when the printer lists may have changed, or when types may have
+   been freed.  PP_LOOKUP_CACHE holds Python objects, so it is only
+   cleared with the GIL held, the next time it is used.  */
+
+static bool pp_lookup_cache_stale;
+
+/* The maximum number of entries of PP_LOOKUP_CACHE.  This is only a
+   safety net against types created on the fly, such as resolved
+   dynamic types.  */
+
+static const size_t pp_lookup_cache_max = 4096;
+
+/* See python-internal.h.  */
+
+void
+gdbpy_invalidate_pretty_printer_cache ()
+{
+  pp_lookup_cache_stale = true;
+}
+
+/* See python-internal.h.  */
+
+void
+gdbpy_finalize_prettyprint ()
+{
+  pp_lookup_cache.clear ();
+}
+
+/* Find the pretty-printing constructor function for VALUE.  If no
+   pretty-printer exists, return None.  If one exists, return a new
+   reference.  On error, set the Python error and return NULL.  */
+
+static gdbpy_ref<>
+find_pretty_printer (PyObject *value)
+{
+  struct type *type = nullptr;
+
+  if (gdbpy_cache_pretty_printers)
+    {
+      if (pp_lookup_cache_stale
+	  || pp_lookup_cache_pspace != current_program_space
+	  || pp_lookup_cache.size () >= pp_lookup_cache_max)
+	{
+	  pp_lookup_cache.clear ();
+	  pp_lookup_cache_pspace = current_program_space;
+	  pp_lookup_cache_stale = false;
+	}
+
+      type = value_type (value_object_to_value (value));
+      auto iter = pp_lookup_cache.find (type);
+      if (iter != pp_lookup_cache.end ())
+	{
+	  if (iter->second == Py_None)
+	    return iter->second;
+
+	  gdbpy_ref<> printer
+	    (PyObject_CallFunctionObjArgs (iter->second.get (), value, NULL));
+
+	  /* If the function does not recognize this value after all,
+	     fall back to a full search.  */
+	  if (printer == NULL || printer != Py_None)
+	    return printer;
+	}
+    }
+  else
+    {
+      /* Printers may be changed while the cache is off.  */
+      pp_lookup_cache_stale = true;
+    }
+
+  gdbpy_ref<> function;
+  gdbpy_ref<> printer = search_pretty_printers (value, &function);
+
+  if (type != nullptr && printer != NULL)
+    {
+      if (printer == Py_None)
+	pp_lookup_cache[type] = printer;
+      else
+	pp_lookup_cache[type] = std::move (function);
+    }
+
+  return printer;
 }
 
 /* Pretty-print a single value, via the printer object PRINTER.
@@ -688,3 +794,42 @@ gdbpy_default_visualizer (PyObject *self, PyObject *args)
 
   return find_pretty_printer (val_obj).release ();
 }
+
+/* Implementation of gdb.invalidate_cached_pretty_printers.  */
+
+PyObject *
+gdbpy_invalidate_cached_pretty_printers (PyObject *self, PyObject *args)
+{
+  gdbpy_invalidate_pretty_printer_cache ();
+  Py_RETURN_NONE;
+}
+
+/* Called when an objfile is loaded or freed.  The printer lists may
+   have changed, and types that are keys of the cache may be gone.  */
+
+static void
+pp_lookup_cache_objfile_changed (struct objfile *objfile)
+{
+  gdbpy_invalidate_pretty_printer_cache ();
+}
+
+/* Called before the prompt is displayed.  Python code run by the user's
+   command may have changed the printer lists.  */
+
+static void
+pp_lookup_cache_before_prompt (const char *prompt)
+{
+  gdbpy_invalidate_pretty_printer_cache ();
+}
+
+void _initialize_py_prettyprint ();
+void
+_initialize_py_prettyprint ()
+{
+  gdb::observers::new_objfile.attach (pp_lookup_cache_objfile_changed,
+				      "py-prettyprint");
+  gdb::observers::free_objfile.attach (pp_lookup_cache_objfile_changed,
+				       "py-prettyprint");
+  gdb::observers::before_prompt.attach (pp_lookup_cache_before_prompt,
+					"py-prettyprint");
+}
@@ -401,6 +401,7 @@ gdbpy_lookup_symbol (PyObject *self, PyObject *args, PyObject *kw)
 
   try
     {
+      gdbpy_allow_threads allow_threads;
       symbol = lookup_symbol (name, block, (domain_enum) domain,
 			      &is_a_field_of_this).symbol;
     }
@@ -450,6 +451,7 @@ gdbpy_lookup_global_symbol (PyObject *self, PyObject *args, PyObject *kw)
 
   try
     {
+      gdbpy_allow_threads allow_threads;
       symbol = lookup_global_symbol (name, NULL, (domain_enum) domain).symbol;
     }
   catch (const gdb_exception &except)
@@ -507,6 +509,8 @@ gdbpy_lookup_static_symbol (PyObject *self, PyObject *args, PyObject *kw)
 
   try
     {
+      gdbpy_allow_threads allow_threads;
+
       if (block != nullptr)
 	symbol
 	  = lookup_symbol_in_static_block (name, block,
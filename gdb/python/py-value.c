@@ -1244,6 +1244,153 @@ valpy_fetch_lazy (PyObject *self, PyObject *args)
   Py_RETURN_NONE;
 }
 
+/* An object exporting the contents of a gdb.Value through the buffer
+   protocol, without copying them.  It holds a reference to the
+   gdb.Value, which keeps the contents alive.  */
+
+struct value_contents_object {
+  PyObject_HEAD
+  PyObject *value;
+};
+
+extern PyTypeObject value_contents_object_type
+    CPYCHECKER_TYPE_OBJECT_FOR_TYPEDEF ("value_contents_object");
+
+/* Destructor for value_contents_object.  */
+
+static void
+valpy_contents_dealloc (PyObject *self)
+{
+  Py_XDECREF (((value_contents_object *) self)->value);
+  Py_TYPE (self)->tp_free (self);
+}
+
+/* Implement the buffer protocol for value_contents_object.  The
+   contents were fetched by valpy_bytes_view, so this cannot throw.  */
+
+static int
+valpy_contents_get_buffer (PyObject *self, Py_buffer *buf, int flags)
+{
+  value_contents_object *obj = (value_contents_object *) self;
+  struct value *value = ((value_object *) obj->value)->value;
+  gdb::array_view<const gdb_byte> contents
+    = value_contents_for_printing (value);
+
+  return PyBuffer_FillInfo (buf, self, (void *) contents.data (),
+			    contents.size (), 1, flags);
+}
+
+/* Implements gdb.Value.bytes_view ().  Return a read-only memoryview
+   of the value's contents, fetching them if the value is lazy.  */
+
+static PyObject *
+valpy_bytes_view (PyObject *self, PyObject *args)
+{
+  struct value *value = ((value_object *) self)->value;
+
+  try
+    {
+      /* This also checks that none of the contents are optimized out
+	 or unavailable.  */
+      value_contents (value);
+    }
+  catch (const gdb_exception &except)
+    {
+      GDB_PY_HANDLE_EXCEPTION (except);
+    }
+
+  gdbpy_ref<value_contents_object> contents_obj
+    (PyObject_New (value_contents_object, &value_contents_object_type));
+  if (contents_obj == nullptr)
+    return nullptr;
+
+  Py_INCREF (self);
+  contents_obj->value = self;
+
+  return PyMemoryView_FromObject ((PyObject *) contents_obj.get ());
+}
+
+/* Implements gdb.Value.to_list ([count]).  Return the elements of an
+   array value, or the COUNT elements a pointer value points to, as a
+   list of gdb.Value objects.  The elements are read from the inferior
+   with a single memory access.  */
+
+static PyObject *
+valpy_to_list (PyObject *self, PyObject *args, PyObject *kw)
+{
+  gdb_py_longest count = -1;
+  struct value *value = ((value_object *) self)->value;
+  static const char *keywords[] = { "count", NULL };
+
+  if (!gdb_PyArg_ParseTupleAndKeywords (args, kw, "|" GDB_PY_LL_ARG,
+					keywords, &count))
+    return NULL;
+
+  if (count < -1)
+    {
+      PyErr_SetString (PyExc_ValueError, _("Invalid count."));
+      return NULL;
+    }
+
+  gdbpy_ref<> list (PyList_New (0));
+  if (list == NULL)
+    return NULL;
+
+  try
+    {
+      scoped_value_mark free_values;
+      struct value *array = coerce_ref (value);
+      struct type *type = check_typedef (value_type (array));
+      LONGEST low_bound = 0;
+
+      if (type->code () == TYPE_CODE_ARRAY)
+	{
+	  LONGEST high_bound;
+
+	  if (!get_array_bounds (type, &low_bound, &high_bound))
+	    error (_("Could not determine the array bounds."));
+	  if (count == -1 || count > high_bound - low_bound + 1)
+	    count = high_bound - low_bound + 1;
+	}
+      else if (type->code () == TYPE_CODE_PTR)
+	{
+	  struct type *elttype = TYPE_TARGET_TYPE (type);
+
+	  if (count == -1)
+	    error (_("A count is required to convert a pointer to a list."));
+	  if (check_typedef (elttype)->code () == TYPE_CODE_VOID)
+	    error (_("Cannot convert a void pointer to a list."));
+	  if (count == 0)
+	    return list.release ();
+
+	  array = value_at_lazy (lookup_array_range_type (elttype, 0,
+							  count - 1),
+				 value_as_address (array));
+	}
+      else
+	error (_("Cannot convert a value of this type to a list."));
+
+      /* Fetch the whole array at once; the elements are then created
+	 from its contents instead of being read one by one.  */
+      if (value_lazy (array))
+	value_fetch_lazy (array);
+
+      for (LONGEST i = 0; i < count; i++)
+	{
+	  gdbpy_ref<> elt
+	    (value_to_value_object (value_subscript (array, low_bound + i)));
+	  if (elt == NULL || PyList_Append (list.get (), elt.get ()) < 0)
+	    return NULL;
+	}
+    }
+  catch (const gdb_exception &except)
+    {
+      GDB_PY_HANDLE_EXCEPTION (except);
+    }
+
+  return list.release ();
+}
+
 /* Calculate and return the address of the PyObject as the value of
    the builtin __hash__ call.  */
 static Py_hash_t
@@ -2059,6 +2206,8 @@ gdbpy_initialize_values (void)
 {
   if (PyType_Ready (&value_object_type) < 0)
     return -1;
+  if (PyType_Ready (&value_contents_object_type) < 0)
+    return -1;
 
   return gdb_pymodule_addobject (gdb_module, "Value",
 				 (PyObject *) &value_object_type);
@@ -2112,6 +2261,13 @@ Return a lazy string representation of the value." },
 Return Unicode string representation of the value." },
   { "fetch_lazy", valpy_fetch_lazy, METH_NOARGS,
     "Fetches the value from the inferior, if it was lazy." },
+  { "bytes_view", valpy_bytes_view, METH_NOARGS,
+    "bytes_view () -> memoryview\n\
+Return a read-only view of the contents of the value." },
+  { "to_list", (PyCFunction) valpy_to_list, METH_VARARGS | METH_KEYWORDS,
+    "to_list ([count]) -> list\n\
+Return the elements of an array, or of the memory a pointer points to,\n\
+as a list of values." },
   { "format_string", (PyCFunction) valpy_format_string,
     METH_VARARGS | METH_KEYWORDS,
     "format_string (...) -> string\n\
@@ -2204,3 +2360,32 @@ PyTypeObject value_object_type = {
   0,				  /* tp_alloc */
   PyType_GenericNew,		  /* tp_new */
 };
+
+static PyBufferProcs value_contents_buffer_procs =
+{
+  valpy_contents_get_buffer
+};
+
+PyTypeObject value_contents_object_type = {
+  PyVarObject_HEAD_INIT (NULL, 0)
+  "gdb.ValueContents",		  /*tp_name*/
+  sizeof (value_contents_object), /*tp_basicsize*/
+  0,				  /*tp_itemsize*/
+  valpy_contents_dealloc,	  /*tp_dealloc*/
+  0,				  /*tp_print*/
+  0,				  /*tp_getattr*/
+  0,				  /*tp_setattr*/
+  0,				  /*tp_compare*/
+  0,				  /*tp_repr*/
+  0,				  /*tp_as_number*/
+  0,				  /*tp_as_sequence*/
+  0,				  /*tp_as_mapping*/
+  0,				  /*tp_hash */
+  0,				  /*tp_call*/
+  0,				  /*tp_str*/
+  0,				  /*tp_getattro*/
+  0,				  /*tp_setattro*/
+  &value_contents_buffer_procs,	  /*tp_as_buffer*/
+  Py_TPFLAGS_DEFAULT,		  /*tp_flags*/
+  "GDB value contents object",	  /*tp_doc*/
+};
@@ -750,6 +750,20 @@ gdbpy_ref<> apply_varobj_pretty_printer (PyObject *print_obj,
 gdbpy_ref<> gdbpy_get_varobj_pretty_printer (struct value *value);
 gdb::unique_xmalloc_ptr<char> gdbpy_get_display_hint (PyObject *printer);
 PyObject *gdbpy_default_visualizer (PyObject *self, PyObject *args);
+PyObject *gdbpy_invalidate_cached_pretty_printers (PyObject *self,
+						   PyObject *args);
+
+/* Whether find_pretty_printer caches which lookup function recognizes
+   the values of each type; see "set python pretty-printer-cache".  */
+extern bool gdbpy_cache_pretty_printers;
+
+/* Forget the pretty-printer lookups cached so far, as the printer
+   lists may have changed.  */
+void gdbpy_invalidate_pretty_printer_cache ();
+
+/* Release the Python objects held by the pretty-printer lookup cache.
+   This is called before the interpreter is finalized.  */
+void gdbpy_finalize_prettyprint ();
 
 void bpfinishpy_pre_stop_hook (struct gdbpy_breakpoint_object *bp_obj);
 void bpfinishpy_post_stop_hook (struct gdbpy_breakpoint_object *bp_obj);
@@ -73,6 +73,12 @@ static const char *gdbpy_should_print_stack = python_excp_message;
 #include "interps.h"
 #include "event-top.h"
 #include "py-event.h"
+#include "gdbsupport/thread-pool.h"
+#include "perf-counter.h"
+#if CXX_STD_THREAD
+#include <mutex>
+#include <condition_variable>
+#endif
 
 /* True if Python has been successfully initialized, false
    otherwise.  */
@@ -335,6 +341,7 @@ python_interactive_command (const char *arg, int from_tty)
   arg = skip_spaces (arg);
 
   gdbpy_enter enter_py;
+  gdbpy_invalidate_pretty_printer_cache ();
 
   if (arg && *arg)
     {
@@ -429,6 +436,7 @@ gdbpy_eval_from_control_command (const struct extension_language_defn *extlang,
     error (_("Invalid \"python\" block structure."));
 
   gdbpy_enter enter_py;
+  gdbpy_invalidate_pretty_printer_cache ();
 
   std::string script = compute_python_string (cmd->body_list_0.get ());
   ret = PyRun_SimpleString (script.c_str ());
@@ -443,6 +451,9 @@ python_command (const char *arg, int from_tty)
 {
   gdbpy_enter enter_py;
 
+  /* The Python code may change the pretty-printer lists.  */
+  gdbpy_invalidate_pretty_printer_cache ();
+
   scoped_restore save_async = make_scoped_restore (&current_ui->async, 0);
 
   arg = skip_spaces (arg);
@@ -526,6 +537,15 @@ gdbpy_parameter_value (const setting &var)
 	unsigned int val = var.get<unsigned int> ();
 	return gdb_py_object_from_ulongest (val).release ();
       }
+
+    case var_zulongest_unlimited:
+      {
+	ULONGEST val = var.get<ULONGEST> ();
+
+	if (val == ULONGEST_MAX)
+	  return gdb_py_object_from_longest (-1).release ();
+	return gdb_py_object_from_ulongest (val).release ();
+      }
     }
 
   return PyErr_Format (PyExc_RuntimeError,
@@ -597,6 +617,27 @@ gdbpy_host_charset (PyObject *self, PyObject *args)
   return PyUnicode_Decode (cset, strlen (cset), host_charset (), NULL);
 }
 
+/* Implement gdb.perf_counters().  */
+
+static PyObject *
+gdbpy_perf_counters (PyObject *self, PyObject *args)
+{
+  gdbpy_ref<> result (PyDict_New ());
+  if (result == nullptr)
+    return nullptr;
+
+  for (const perf_counter *counter : all_perf_counters ())
+    {
+      gdbpy_ref<> value = gdb_py_object_from_ulongest (counter->value ());
+      if (value == nullptr
+	  || PyDict_SetItemString (result.get (), counter->name (),
+				   value.get ()) < 0)
+	return nullptr;
+    }
+
+  return result.release ();
+}
+
 /* A Python function which evaluates a string using the gdb CLI.  */
 
 static PyObject *
@@ -989,6 +1030,7 @@ gdbpy_source_script (const struct extension_language_defn *extlang,
 		     FILE *file, const char *filename)
 {
   gdbpy_enter enter_py;
+  gdbpy_invalidate_pretty_printer_cache ();
   python_run_simple_file (file, filename);
 }
 
@@ -1065,6 +1107,124 @@ gdbpy_post_event (PyObject *self, PyObject *args)
   Py_RETURN_NONE;
 }
 
+/* The thread pool running the tasks posted by gdb._post_to_worker.
+   These tasks wait for the GIL, so they must not run in GDB's own
+   worker threads: the main thread could be waiting for those, for
+   instance to finish indexing DWARF, while it holds the GIL.  Like
+   the global pool, this is allocated on the heap and leaked.  */
+
+static gdb::thread_pool *python_worker_pool;
+
+#if CXX_STD_THREAD
+/* Protects the two variables below.  */
+static std::mutex python_worker_mutex;
+
+/* Notified when PYTHON_WORKER_RUNNING drops to zero.  */
+static std::condition_variable python_worker_cv;
+#endif
+
+/* The number of tasks currently running Python code.  */
+static unsigned int python_worker_running;
+
+/* Set when the interpreter is about to be finalized.  Tasks that have
+   not started by then are dropped.  */
+static bool python_worker_stopping;
+
+/* Run FUNC, a new reference to a callable object, in the Python worker
+   thread pool.  */
+
+static void
+python_worker_task (PyObject *func)
+{
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (python_worker_mutex);
+#endif
+    /* The interpreter may already be gone, so FUNC is leaked.  */
+    if (python_worker_stopping)
+      return;
+    ++python_worker_running;
+  }
+
+  {
+    gdbpy_gil gil;
+
+    gdbpy_ref<> result (PyObject_CallObject (func, NULL));
+    /* gdb.post_to_worker reports the exceptions of the user's code on
+       the main thread; printing anything here would not be safe.  */
+    if (result == NULL)
+      PyErr_Clear ();
+    Py_DECREF (func);
+  }
+
+#if CXX_STD_THREAD
+  std::lock_guard<std::mutex> guard (python_worker_mutex);
+#endif
+  if (--python_worker_running == 0)
+    {
+#if CXX_STD_THREAD
+      python_worker_cv.notify_all ();
+#endif
+    }
+}
+
+/* Wait for the running worker tasks to finish, and drop the others.
+   This is called before finalizing the interpreter, without the
+   GIL.  */
+
+static void
+python_worker_shutdown ()
+{
+#if CXX_STD_THREAD
+  std::unique_lock<std::mutex> lock (python_worker_mutex);
+  python_worker_stopping = true;
+  python_worker_cv.wait (lock, [] { return python_worker_running == 0; });
+#else
+  python_worker_stopping = true;
+#endif
+}
+
+/* Implementation of gdb._post_to_worker (function).  Run FUNCTION,
+   which takes no arguments, in a worker thread.  The gdb.post_to_worker
+   wrapper takes care of results and exceptions.  */
+
+static PyObject *
+gdbpy_post_to_worker (PyObject *self, PyObject *args)
+{
+  PyObject *func;
+
+  if (!PyArg_ParseTuple (args, "O", &func))
+    return NULL;
+
+  if (!PyCallable_Check (func))
+    {
+      PyErr_SetString (PyExc_RuntimeError,
+		       _("Posted task is not callable"));
+      return NULL;
+    }
+
+  if (python_worker_pool == nullptr)
+    {
+      python_worker_pool = new gdb::thread_pool;
+      python_worker_pool->set_thread_count
+	(gdb::thread_pool::g_thread_pool->thread_count ());
+    }
+
+  Py_INCREF (func);
+  if (python_worker_pool->thread_count () == 0)
+    {
+      /* Without threads, the task runs right away, in this thread.  */
+      python_worker_task (func);
+    }
+  else
+    python_worker_pool->post_task ([=] ()
+      {
+	python_worker_task (func);
+      });
+
+  Py_RETURN_NONE;
+}
+
 
 
 /* This is the extension_language_ops.before_prompt "method".  */
@@ -1870,6 +2030,20 @@ set_python_dont_write_bytecode (const char *args, int from_tty,
 }
 
 
+/* See python-internal.h.  */
+bool gdbpy_cache_pretty_printers = true;
+
+/* Implement 'show python pretty-printer-cache'.  */
+
+static void
+show_python_pretty_printer_cache (struct ui_file *file, int from_tty,
+				  struct cmd_list_element *c,
+				  const char *value)
+{
+  gdb_printf (file, _("Caching of pretty-printer lookups is %s.\n"),
+	      value);
+}
+
 
 /* Lists for 'set python' commands.  */
 
@@ -1898,10 +2072,13 @@ finalize_python (void *ignore)
      SIGINT handler is gdb's.  We still need to tell it to notify Python.  */
   previous_active = set_active_ext_lang (&extension_language_python);
 
+  python_worker_shutdown ();
+
   (void) PyGILState_Ensure ();
   gdbpy_enter::finalize ();
 
   gdbpy_finalize_micommands ();
+  gdbpy_finalize_prettyprint ();
 
   Py_Finalize ();
 
@@ -2299,6 +2476,20 @@ python executable."),
 				&user_set_python_list,
 				&user_show_python_list);
 
+  add_setshow_boolean_cmd ("pretty-printer-cache", no_class,
+			   &gdbpy_cache_pretty_printers, _("\
+Set whether pretty-printer lookups are cached."), _("\
+Show whether pretty-printer lookups are cached."), _("\
+When on, GDB remembers which pretty-printer lookup function recognizes\n\
+the values of each type, and calls only that function for the next\n\
+value of the same type.  This assumes that the lookup functions decide\n\
+based on the type of the value.  The cache is discarded whenever the\n\
+printers may have changed, for instance when Python code is run."),
+			   NULL,
+			   show_python_pretty_printer_cache,
+			   &user_set_python_list,
+			   &user_show_python_list);
+
 #ifdef HAVE_PYTHON
 #if GDB_SELF_TEST
   selftests::register_test ("python", selftests::test_python);
@@ -2416,6 +2607,10 @@ set to True." },
 
   { "default_visualizer", gdbpy_default_visualizer, METH_VARARGS,
     "Find the default visualizer for a Value." },
+  { "invalidate_cached_pretty_printers",
+    gdbpy_invalidate_cached_pretty_printers, METH_NOARGS,
+    "invalidate_cached_pretty_printers () -> None.\n\
+Forget which pretty-printer lookup functions recognized which types." },
 
   { "progspaces", gdbpy_progspaces, METH_NOARGS,
     "Return a sequence of all progspaces." },
@@ -2489,6 +2684,8 @@ Parse String as an expression, evaluate it, and return the result as a Value."
 
   { "post_event", gdbpy_post_event, METH_VARARGS,
     "Post an event into gdb's event loop." },
+  { "_post_to_worker", gdbpy_post_to_worker, METH_VARARGS,
+    "Run a callable in a worker thread." },
 
   { "target_charset", gdbpy_target_charset, METH_NOARGS,
     "target_charset () -> string.\n\
@@ -2541,6 +2738,11 @@ Set the value of the convenience variable $NAME." },
 Register a TUI window constructor." },
 #endif	/* TUI */
 
+  { "perf_counters", gdbpy_perf_counters, METH_NOARGS,
+    "perf_counters () -> Dictionary.\n\
+Return a dictionary mapping the name of each of GDB's performance\n\
+counters to its current value." },
+
   { "architecture_names", gdbpy_all_architecture_names, METH_NOARGS,
     "architecture_names () -> List.\n\
 Return a list of all the architecture names GDB understands." },
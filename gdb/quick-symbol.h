@@ -25,7 +25,11 @@
 enum block_search_flag_values
 {
   SEARCH_GLOBAL_BLOCK = 1,
-  SEARCH_STATIC_BLOCK = 2
+  SEARCH_STATIC_BLOCK = 2,
+  /* Not a block; this says that the symbol matcher passed to
+     expand_symtabs_matching may be called from several worker threads
+     at once.  */
+  SEARCH_PARALLEL_MATCHER = 4
 };
 
 DEF_ENUM_FLAGS_TYPE (enum block_search_flag_values, block_search_flags);
@@ -168,7 +172,9 @@ struct quick_symbol_functions
 
      If SYMBOL_MATCHER returns false, then the symbol is skipped.
      Note that if SYMBOL_MATCHER is non-NULL, then LOOKUP_NAME must
-     also be provided.
+     also be provided.  If SEARCH_FLAGS includes SEARCH_PARALLEL_MATCHER,
+     SYMBOL_MATCHER may be called concurrently from worker threads;
+     symbol tables are still only expanded in the main thread.
 
      Otherwise, the symbol's symbol table is expanded and the
      notification function is called.  If the notification function
@@ -596,7 +596,7 @@ record_btrace_target::info_record ()
 
       /* If the last instruction is not a gap, it is the current instruction
 	 that is not actually part of the record.  */
-      if (btrace_insn_get (&insn) != NULL)
+      if (btrace_insn_get (&insn).has_value ())
 	insns -= 1;
 
       gaps = btinfo->ngaps;
@@ -800,12 +800,10 @@ btrace_insn_history (struct ui_out *uiout,
   for (btrace_insn_iterator it = *begin; btrace_insn_cmp (&it, end) != 0;
 	 btrace_insn_next (&it, 1))
     {
-      const struct btrace_insn *insn;
+      gdb::optional<btrace_insn> insn = btrace_insn_get (&it);
 
-      insn = btrace_insn_get (&it);
-
-      /* A NULL instruction indicates a gap in the trace.  */
-      if (insn == NULL)
+      /* An empty instruction indicates a gap in the trace.  */
+      if (!insn.has_value ())
 	{
 	  const struct btrace_config *conf;
 
@@ -1549,7 +1547,6 @@ record_btrace_target::fetch_registers (struct regcache *regcache, int regno)
 
   if (replay != nullptr && !record_btrace_generating_corefile)
     {
-      const struct btrace_insn *insn;
       struct gdbarch *gdbarch;
       int pcreg;
 
@@ -1562,8 +1559,8 @@ record_btrace_target::fetch_registers (struct regcache *regcache, int regno)
       if (regno >= 0 && regno != pcreg)
 	return;
 
-      insn = btrace_insn_get (replay);
-      gdb_assert (insn != NULL);
+      gdb::optional<btrace_insn> insn = btrace_insn_get (replay);
+      gdb_assert (insn.has_value ());
 
       regcache->raw_supply (regno, &insn->pc);
     }
@@ -2044,7 +2041,7 @@ record_btrace_start_replaying (struct thread_info *tp)
       btrace_insn_end (replay, btinfo);
 
       /* Skip gaps at the end of the trace.  */
-      while (btrace_insn_get (replay) == NULL)
+      while (!btrace_insn_get (replay).has_value ())
 	{
 	  unsigned int steps;
 
@@ -2304,7 +2301,6 @@ record_btrace_replay_at_breakpoint (struct thread_info *tp)
 {
   struct btrace_insn_iterator *replay;
   struct btrace_thread_info *btinfo;
-  const struct btrace_insn *insn;
 
   btinfo = &tp->btrace;
   replay = btinfo->replay;
@@ -2312,8 +2308,8 @@ record_btrace_replay_at_breakpoint (struct thread_info *tp)
   if (replay == NULL)
     return 0;
 
-  insn = btrace_insn_get (replay);
-  if (insn == NULL)
+  gdb::optional<btrace_insn> insn = btrace_insn_get (replay);
+  if (!insn.has_value ())
     return 0;
 
   return record_check_stopped_by_breakpoint (tp->inf->aspace, insn->pc,
@@ -2355,7 +2351,7 @@ record_btrace_single_step_forward (struct thread_info *tp)
 	  return btrace_step_no_history ();
 	}
     }
-  while (btrace_insn_get (replay) == NULL);
+  while (!btrace_insn_get (replay).has_value ());
 
   /* Determine the end of the instruction trace.  */
   btrace_insn_end (&end, btinfo);
@@ -2399,7 +2395,7 @@ record_btrace_single_step_backward (struct thread_info *tp)
 	  return btrace_step_no_history ();
 	}
     }
-  while (btrace_insn_get (replay) == NULL);
+  while (!btrace_insn_get (replay).has_value ());
 
   /* Check if we're stepping a breakpoint.
 
@@ -2794,7 +2790,7 @@ record_btrace_target::goto_record_begin ()
   btrace_insn_begin (&begin, &tp->btrace);
 
   /* Skip gaps at the beginning of the trace.  */
-  while (btrace_insn_get (&begin) == NULL)
+  while (!btrace_insn_get (&begin).has_value ())
     {
       unsigned int steps;
 
@@ -2839,7 +2835,7 @@ record_btrace_target::goto_record (ULONGEST insn)
   found = btrace_find_insn_by_number (&it, &tp->btrace, number);
 
   /* Check if the instruction could not be found or is a gap.  */
-  if (found == 0 || btrace_insn_get (&it) == NULL)
+  if (found == 0 || !btrace_insn_get (&it).has_value ())
     error (_("No such instruction."));
 
   record_btrace_set_replay (tp, &it);
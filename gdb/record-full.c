@@ -377,6 +377,151 @@ static struct cmd_list_element *record_full_cmdlist;
 static void record_full_goto_insn (struct record_full_entry *entry,
 				   enum exec_direction_kind dir);
 
+/* A pool of memory blocks of a single size.  The execution log
+   allocates and frees entries at a high rate, so rather than going
+   through malloc for each of them, with its per-block overhead, blocks
+   are carved out of large chunks and recycled through a free list.
+   The chunks are released when no block is in use anymore.  */
+
+class record_full_pool
+{
+public:
+  record_full_pool (size_t block_size)
+    : m_block_size (std::max (block_size, sizeof (void *)))
+  {
+  }
+
+  DISABLE_COPY_AND_ASSIGN (record_full_pool);
+
+  /* Return the size of the blocks.  */
+  size_t block_size () const
+  { return m_block_size; }
+
+  /* Return a new block.  */
+  void *alloc ()
+  {
+    if (m_free == nullptr)
+      {
+	m_chunks.emplace_back (new gdb_byte[m_block_size * BLOCKS_PER_CHUNK]);
+	gdb_byte *chunk = m_chunks.back ().get ();
+	for (size_t i = BLOCKS_PER_CHUNK; i > 0; --i)
+	  {
+	    void *block = chunk + (i - 1) * m_block_size;
+	    *(void **) block = m_free;
+	    m_free = block;
+	  }
+      }
+
+    void *block = m_free;
+    m_free = *(void **) block;
+    ++m_in_use;
+    return block;
+  }
+
+  /* Release BLOCK, which was returned by alloc.  */
+  void release (void *block)
+  {
+    gdb_assert (m_in_use > 0);
+
+    *(void **) block = m_free;
+    m_free = block;
+
+    if (--m_in_use == 0)
+      {
+	m_chunks.clear ();
+	m_free = nullptr;
+      }
+  }
+
+  /* Return the number of bytes allocated by the pool.  */
+  size_t memory_used () const
+  { return m_chunks.size () * m_block_size * BLOCKS_PER_CHUNK; }
+
+private:
+  /* The number of blocks allocated at once.  */
+  static constexpr size_t BLOCKS_PER_CHUNK = 4096;
+
+  /* The size of the blocks.  */
+  const size_t m_block_size;
+
+  /* The chunks blocks are allocated from.  */
+  std::vector<std::unique_ptr<gdb_byte[]>> m_chunks;
+
+  /* The list of free blocks, linked through their first word.  */
+  void *m_free = nullptr;
+
+  /* The number of blocks in use.  */
+  size_t m_in_use = 0;
+};
+
+/* The pool of log entries.  */
+static record_full_pool record_full_entry_pool
+  (sizeof (struct record_full_entry));
+
+/* The pools of the register and memory contents too large to be kept
+   in the entries themselves, which are mostly vector registers and
+   small memory blocks, by size class.  Contents larger than the last
+   class are allocated with xmalloc.  */
+static record_full_pool record_full_payload_pools[] = { {32}, {64} };
+
+/* The number of bytes of contents allocated with xmalloc.  */
+static size_t record_full_payload_malloced;
+
+/* Allocate the LEN bytes of contents of an entry.  */
+
+static gdb_byte *
+record_full_payload_alloc (size_t len)
+{
+  for (record_full_pool &pool : record_full_payload_pools)
+    if (len <= pool.block_size ())
+      return (gdb_byte *) pool.alloc ();
+
+  record_full_payload_malloced += len;
+  return (gdb_byte *) xmalloc (len);
+}
+
+/* Release the LEN bytes of contents PTR of an entry.  */
+
+static void
+record_full_payload_release (gdb_byte *ptr, size_t len)
+{
+  for (record_full_pool &pool : record_full_payload_pools)
+    if (len <= pool.block_size ())
+      {
+	pool.release (ptr);
+	return;
+      }
+
+  record_full_payload_malloced -= len;
+  xfree (ptr);
+}
+
+/* Return the number of bytes of memory used by the execution log.  */
+
+static size_t
+record_full_log_memory_used ()
+{
+  size_t result = record_full_entry_pool.memory_used ();
+
+  for (const record_full_pool &pool : record_full_payload_pools)
+    result += pool.memory_used ();
+
+  return result + record_full_payload_malloced;
+}
+
+/* Return a new, cleared, log entry of type TYPE.  */
+
+static struct record_full_entry *
+record_full_entry_alloc (enum record_full_type type)
+{
+  struct record_full_entry *rec
+    = (struct record_full_entry *) record_full_entry_pool.alloc ();
+
+  memset (rec, 0, sizeof (*rec));
+  rec->type = type;
+  return rec;
+}
+
 /* Alloc and free functions for record_full_reg, record_full_mem, and
    record_full_end entries.  */
 
@@ -388,12 +533,11 @@ record_full_reg_alloc (struct regcache *regcache, int regnum)
   struct record_full_entry *rec;
   struct gdbarch *gdbarch = regcache->arch ();
 
-  rec = XCNEW (struct record_full_entry);
-  rec->type = record_full_reg;
+  rec = record_full_entry_alloc (record_full_reg);
   rec->u.reg.num = regnum;
   rec->u.reg.len = register_size (gdbarch, regnum);
   if (rec->u.reg.len > sizeof (rec->u.reg.u.buf))
-    rec->u.reg.u.ptr = (gdb_byte *) xmalloc (rec->u.reg.len);
+    rec->u.reg.u.ptr = record_full_payload_alloc (rec->u.reg.len);
 
   return rec;
 }
@@ -405,8 +549,8 @@ record_full_reg_release (struct record_full_entry *rec)
 {
   gdb_assert (rec->type == record_full_reg);
   if (rec->u.reg.len > sizeof (rec->u.reg.u.buf))
-    xfree (rec->u.reg.u.ptr);
-  xfree (rec);
+    record_full_payload_release (rec->u.reg.u.ptr, rec->u.reg.len);
+  record_full_entry_pool.release (rec);
 }
 
 /* Alloc a record_full_mem record entry.  */
@@ -416,12 +560,11 @@ record_full_mem_alloc (CORE_ADDR addr, int len)
 {
   struct record_full_entry *rec;
 
-  rec = XCNEW (struct record_full_entry);
-  rec->type = record_full_mem;
+  rec = record_full_entry_alloc (record_full_mem);
   rec->u.mem.addr = addr;
   rec->u.mem.len = len;
   if (rec->u.mem.len > sizeof (rec->u.mem.u.buf))
-    rec->u.mem.u.ptr = (gdb_byte *) xmalloc (len);
+    rec->u.mem.u.ptr = record_full_payload_alloc (len);
 
   return rec;
 }
@@ -433,8 +576,8 @@ record_full_mem_release (struct record_full_entry *rec)
 {
   gdb_assert (rec->type == record_full_mem);
   if (rec->u.mem.len > sizeof (rec->u.mem.u.buf))
-    xfree (rec->u.mem.u.ptr);
-  xfree (rec);
+    record_full_payload_release (rec->u.mem.u.ptr, rec->u.mem.len);
+  record_full_entry_pool.release (rec);
 }
 
 /* Alloc a record_full_end record entry.  */
@@ -442,12 +585,7 @@ record_full_mem_release (struct record_full_entry *rec)
 static inline struct record_full_entry *
 record_full_end_alloc (void)
 {
-  struct record_full_entry *rec;
-
-  rec = XCNEW (struct record_full_entry);
-  rec->type = record_full_end;
-
-  return rec;
+  return record_full_entry_alloc (record_full_end);
 }
 
 /* Free a record_full_end record entry.  */
@@ -455,7 +593,7 @@ record_full_end_alloc (void)
 static inline void
 record_full_end_release (struct record_full_entry *rec)
 {
-  xfree (rec);
+  record_full_entry_pool.release (rec);
 }
 
 /* Free one record entry, any type.
@@ -1925,6 +2063,14 @@ record_full_base_target::info_record ()
       /* Display log count.  */
       gdb_printf (_("Log contains %u instructions.\n"),
 		  record_full_insn_num);
+
+      /* Display the memory used by the log.  */
+      size_t memory = record_full_log_memory_used ();
+      gdb_printf (_("Log uses %s bytes"), pulongest (memory));
+      if (record_full_insn_num > 0)
+	gdb_printf (_(", %s bytes per instruction"),
+		    pulongest (memory / record_full_insn_num));
+      gdb_printf (_(".\n"));
     }
   else
     gdb_printf (_("No instructions have been logged.\n"));
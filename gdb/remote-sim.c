@@ -45,6 +45,17 @@
 #include "memory-map.h"
 #include "remote.h"
 #include "gdbsupport/buildargv.h"
+#include "gdbsupport/event-loop.h"
+#include "gdbcmd.h"
+#include "inf-loop.h"
+#include "ser-event.h"
+#include "run-on-main-thread.h"
+#if CXX_STD_THREAD
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include "gdbsupport/block-signals.h"
+#endif
 
 /* Prototypes */
 
@@ -113,6 +124,34 @@ struct sim_inferior_data {
 
   /* Flag which indicates whether resume should step or not.  */
   int resume_step = 0;
+
+#if CXX_STD_THREAD
+  /* When the target is asynchronous, the thread that calls sim_resume
+     for this inferior.  */
+  std::thread runner;
+
+  /* Set by RUNNER once sim_resume has returned.  */
+  std::atomic<bool> runner_done {false};
+
+  /* Set by RUNNER while it is inside sim_resume.  */
+  std::atomic<bool> runner_in_resume {false};
+
+  /* Set by the main thread to ask RUNNER to stop the simulator, which
+     it notices through gdb_os_poll_quit, or not to start it at all if
+     it is still waiting for its turn.  */
+  std::atomic<bool> runner_stop_requested {false};
+
+  /* An error thrown by the simulator while RUNNER was running it, to
+     be rethrown by gdbsim_target::wait.  */
+  gdb_exception runner_error;
+
+  /* Return true if RUNNER is still running the simulator.  */
+  bool running () const
+  { return runner.joinable () && !runner_done; }
+
+  void start_runner ();
+  void stop_runner ();
+#endif
 };
 
 static const target_info gdbsim_target_info = {
@@ -161,6 +200,11 @@ struct gdbsim_target final
 
   void interrupt () override;
 
+  bool can_async_p () override;
+  bool is_async_p () override;
+  void async (int) override;
+  int async_wait_fd () override;
+
   bool thread_alive (ptid_t ptid) override;
 
   std::string pid_to_str (ptid_t) override;
@@ -194,6 +238,31 @@ static char **sim_argv = NULL;
 static host_callback gdb_callback;
 static int callbacks_initialized = 0;
 
+/* Whether to run each simulator on its own thread and report its stops
+   through the event loop ("set sim-async").  */
+static bool sim_async = false;
+
+/* Set by the runner threads when a simulator stops, and waited for by
+   the event loop while the target is asynchronous.  */
+static struct serial_event *gdbsim_async_event;
+
+/* Whether the target is currently asynchronous.  */
+static bool gdbsim_is_async = false;
+
+#if CXX_STD_THREAD
+/* Held by a runner thread while it calls sim_resume.  Simulators are
+   not generally re-entrant (many keep their state in globals), so
+   only one of them runs at a time.  */
+static std::mutex gdbsim_resume_mutex;
+
+/* Set on the main thread when the user interrupts the program, and
+   reported to the running simulator by gdb_os_poll_quit.  */
+static std::atomic<bool> gdbsim_quit_requested {false};
+
+/* On a runner thread, the inferior data of the simulator it runs.  */
+static thread_local sim_inferior_data *gdbsim_current_runner;
+#endif
+
 /* Flags indicating whether or not a sim instance is needed.  One of these
    flags should be passed to get_sim_inferior_data().  */
 
@@ -287,10 +356,83 @@ gdbsim_target::get_inferior_data_by_ptid (ptid_t ptid,
 
 sim_inferior_data::~sim_inferior_data ()
 {
+#if CXX_STD_THREAD
+  stop_runner ();
+#endif
   if (gdbsim_desc)
     sim_close (gdbsim_desc, 0);
 }
 
+#if CXX_STD_THREAD
+
+/* Call sim_resume on a new thread, which sets GDBSIM_ASYNC_EVENT when
+   the simulator stops.  */
+
+void
+sim_inferior_data::start_runner ()
+{
+  gdb_assert (!runner.joinable ());
+
+  if (gdbsim_async_event == nullptr)
+    gdbsim_async_event = make_serial_event ();
+
+  runner_done = false;
+  runner_in_resume = false;
+  runner_stop_requested = false;
+  gdbsim_quit_requested = false;
+  runner_error = gdb_exception ();
+
+  /* Leave the signals, SIGINT in particular, to the main thread.  */
+  gdb::block_signals blocker;
+
+  runner = std::thread ([this] ()
+    {
+      gdbsim_current_runner = this;
+
+      try
+	{
+	  std::lock_guard<std::mutex> guard (gdbsim_resume_mutex);
+
+	  /* Another simulator may have stopped while this one waited
+	     for its turn.  */
+	  if (!runner_stop_requested)
+	    {
+	      runner_in_resume = true;
+	      sim_resume (gdbsim_desc, resume_step, resume_siggnal);
+	    }
+	}
+      catch (gdb_exception &ex)
+	{
+	  runner_error = std::move (ex);
+	}
+      runner_in_resume = false;
+      runner_done = true;
+      serial_event_set (gdbsim_async_event);
+    });
+}
+
+/* Stop the simulator if RUNNER is still running it, and wait for
+   RUNNER to finish.  Any stop it reports is discarded.  */
+
+void
+sim_inferior_data::stop_runner ()
+{
+  if (!runner.joinable ())
+    return;
+
+  /* Simulators that don't poll for quit requests are stopped with
+     sim_stop, but only once they run: a stop requested before that
+     would be kept for their next resume.  */
+  runner_stop_requested = true;
+  if (runner_in_resume)
+    sim_stop (gdbsim_desc);
+  runner.join ();
+  runner_done = false;
+  runner_error = gdb_exception ();
+}
+
+#endif
+
 static void
 dump_mem (const gdb_byte *buf, int len)
 {
@@ -356,6 +498,18 @@ end_callbacks (void)
 static int
 gdb_os_write_stdout (host_callback *p, const char *buf, int len)
 {
+  if (!is_main_thread ())
+    {
+      /* A simulator running asynchronously; GDB's output streams
+	 belong to the main thread.  */
+      std::string text (buf, len);
+      run_on_main_thread ([text] ()
+	{
+	  gdb_stdtarg->write (text.data (), text.size ());
+	});
+      return len;
+    }
+
   gdb_stdtarg->write (buf, len);
   return len;
 }
@@ -365,6 +519,12 @@ gdb_os_write_stdout (host_callback *p, const char *buf, int len)
 static void
 gdb_os_flush_stdout (host_callback *p)
 {
+  if (!is_main_thread ())
+    {
+      run_on_main_thread ([] () { gdb_stdtarg->flush (); });
+      return;
+    }
+
   gdb_stdtarg->flush ();
 }
 
@@ -376,6 +536,13 @@ gdb_os_write_stderr (host_callback *p, const char *buf, int len)
   int i;
   char b[2];
 
+  if (!is_main_thread ())
+    {
+      std::string text (buf, len);
+      run_on_main_thread ([text] () { gdb_stdtargerr->puts (text.c_str ()); });
+      return len;
+    }
+
   for (i = 0; i < len; i++)
     {
       b[0] = buf[i];
@@ -390,6 +557,12 @@ gdb_os_write_stderr (host_callback *p, const char *buf, int len)
 static void
 gdb_os_flush_stderr (host_callback *p)
 {
+  if (!is_main_thread ())
+    {
+      run_on_main_thread ([] () { gdb_stdtargerr->flush (); });
+      return;
+    }
+
   gdb_stdtargerr->flush ();
 }
 
@@ -401,7 +574,7 @@ gdb_os_printf_filtered (host_callback * p, const char *format, ...)
   va_list args;
 
   va_start (args, format);
-  gdb_vprintf (gdb_stdout, format, args);
+  gdb_os_vprintf_filtered (p, format, args);
   va_end (args);
 }
 
@@ -410,6 +583,13 @@ gdb_os_printf_filtered (host_callback * p, const char *format, ...)
 static void ATTRIBUTE_PRINTF (2, 0)
 gdb_os_vprintf_filtered (host_callback * p, const char *format, va_list ap)
 {
+  if (!is_main_thread ())
+    {
+      std::string text = string_vprintf (format, ap);
+      run_on_main_thread ([text] () { gdb_puts (text.c_str ()); });
+      return;
+    }
+
   gdb_vprintf (gdb_stdout, format, ap);
 }
 
@@ -418,6 +598,13 @@ gdb_os_vprintf_filtered (host_callback * p, const char *format, va_list ap)
 static void ATTRIBUTE_PRINTF (2, 0)
 gdb_os_evprintf_filtered (host_callback * p, const char *format, va_list ap)
 {
+  if (!is_main_thread ())
+    {
+      std::string text = string_vprintf (format, ap);
+      run_on_main_thread ([text] () { gdb_puts (text.c_str (), gdb_stderr); });
+      return;
+    }
+
   gdb_vprintf (gdb_stderr, format, ap);
 }
 
@@ -449,6 +636,11 @@ gdbsim_target::fetch_registers (struct regcache *regcache, int regno)
   struct sim_inferior_data *sim_data
     = get_sim_inferior_data (inf, SIM_INSTANCE_NEEDED);
 
+#if CXX_STD_THREAD
+  if (sim_data->running ())
+    error (_("Cannot access registers while the simulator is running."));
+#endif
+
   if (regno == -1)
     {
       for (regno = 0; regno < gdbarch_num_regs (gdbarch); regno++)
@@ -518,6 +710,11 @@ gdbsim_target::store_registers (struct regcache *regcache, int regno)
   struct sim_inferior_data *sim_data
     = get_sim_inferior_data (inf, SIM_INSTANCE_NEEDED);
 
+#if CXX_STD_THREAD
+  if (sim_data->running ())
+    error (_("Cannot access registers while the simulator is running."));
+#endif
+
   if (regno == -1)
     {
       for (regno = 0; regno < gdbarch_num_regs (gdbarch); regno++)
@@ -566,6 +763,11 @@ gdbsim_target::kill ()
 
   /* There is no need to `kill' running simulator - the simulator is
      not running.  Mourning it is enough.  */
+#if CXX_STD_THREAD
+  struct sim_inferior_data *sim_data
+    = get_sim_inferior_data (current_inferior (), SIM_INSTANCE_NOT_NEEDED);
+  sim_data->stop_runner ();
+#endif
   target_mourn_inferior (inferior_ptid);
 }
 
@@ -806,6 +1008,9 @@ gdbsim_target::close ()
   if (remote_debug)
     gdb_printf (gdb_stdlog, "gdbsim_close\n");
 
+  if (gdbsim_is_async)
+    async (0);
+
   for (inferior *inf : all_inferiors (this))
     close_one_inferior (inf);
 
@@ -859,6 +1064,13 @@ gdbsim_target::resume_one_inferior (inferior *inf, bool step,
 	gdb_printf (gdb_stdlog,
 		    _("gdbsim_resume: pid %d, step %d, signal %d\n"),
 		    inf->pid, step, siggnal);
+
+#if CXX_STD_THREAD
+      /* When asynchronous, every resumed simulator runs on its own
+	 thread; otherwise gdbsim_target::wait runs it.  */
+      if (target_can_async_p (this) && sim_data->gdbsim_desc != NULL)
+	sim_data->start_runner ();
+#endif
     }
 }
 
@@ -898,22 +1110,99 @@ gdbsim_target::resume (ptid_t ptid, int step, enum gdb_signal siggnal)
 void
 gdbsim_target::interrupt ()
 {
+#if CXX_STD_THREAD
+  /* Simulators running on runner threads poll this through
+     gdb_os_poll_quit.  */
+  gdbsim_quit_requested = true;
+#endif
+
   for (inferior *inf : all_inferiors ())
     {
       sim_inferior_data *sim_data
 	= get_sim_inferior_data (inf, SIM_INSTANCE_NEEDED);
 
-      if (sim_data != nullptr && !sim_stop (sim_data->gdbsim_desc))
-	  quit ();
+      if (sim_data == nullptr)
+	continue;
+
+#if CXX_STD_THREAD
+      /* A runner that hasn't entered sim_resume yet stops as soon as
+	 it polls for quit; a sim_stop now would be kept for the
+	 simulator's next resume instead.  */
+      if (sim_data->runner.joinable () && !sim_data->runner_in_resume)
+	continue;
+#endif
+
+      if (!sim_stop (sim_data->gdbsim_desc))
+	quit ();
     }
 }
 
+/* Event loop handler for GDBSIM_ASYNC_EVENT.  */
+
+static void
+gdbsim_async_event_handler (int error, gdb_client_data client_data)
+{
+  inferior_event_handler (INF_REG_EVENT);
+}
+
+bool
+gdbsim_target::can_async_p ()
+{
+#if CXX_STD_THREAD
+  return sim_async;
+#else
+  return false;
+#endif
+}
+
+bool
+gdbsim_target::is_async_p ()
+{
+  return gdbsim_is_async;
+}
+
+void
+gdbsim_target::async (int enable)
+{
+  if (enable == gdbsim_is_async)
+    return;
+
+  if (enable)
+    {
+      if (gdbsim_async_event == nullptr)
+	gdbsim_async_event = make_serial_event ();
+      add_file_handler (serial_event_fd (gdbsim_async_event),
+			gdbsim_async_event_handler, nullptr, "sim");
+    }
+  else
+    delete_file_handler (serial_event_fd (gdbsim_async_event));
+
+  gdbsim_is_async = enable;
+}
+
+int
+gdbsim_target::async_wait_fd ()
+{
+  gdb_assert (gdbsim_async_event != nullptr);
+  return serial_event_fd (gdbsim_async_event);
+}
+
 /* GDB version of os_poll_quit callback.
    Taken from gdb/util.c - should be in a library.  */
 
 static int
 gdb_os_poll_quit (host_callback *p)
 {
+#if CXX_STD_THREAD
+  /* A simulator running on its own thread must not look at GDB's quit
+     flag, which belongs to the main thread.  The main thread forwards
+     interrupts and stop requests through atomic flags instead.  */
+  if (!is_main_thread ())
+    return (gdbsim_quit_requested
+	    || (gdbsim_current_runner != nullptr
+		&& gdbsim_current_runner->runner_stop_requested));
+#endif
+
   if (deprecated_ui_loop_hook != NULL)
     deprecated_ui_loop_hook (0);
 
@@ -932,15 +1221,128 @@ gdbsim_cntrl_c (int signo)
   gdbsim_ops.interrupt ();
 }
 
+/* Translate the stop REASON and SIGRC of the simulator of SIM_DATA into
+   STATUS, and return the ptid that stopped.  */
+
+static ptid_t
+gdbsim_stop_status (struct sim_inferior_data *sim_data,
+		    enum sim_stop reason, int sigrc,
+		    struct target_waitstatus *status)
+{
+  switch (reason)
+    {
+    case sim_exited:
+      status->set_exited (sigrc);
+      break;
+    case sim_stopped:
+      switch (sigrc)
+	{
+	case GDB_SIGNAL_ABRT:
+	  quit ();
+	  break;
+	case GDB_SIGNAL_INT:
+	case GDB_SIGNAL_TRAP:
+	default:
+	  status->set_stopped ((gdb_signal) sigrc);
+	  break;
+	}
+      break;
+    case sim_signalled:
+      status->set_signalled ((gdb_signal) sigrc);
+      break;
+    case sim_running:
+    case sim_polling:
+      /* FIXME: Is this correct?  */
+      break;
+    }
+
+  return sim_data->remote_sim_ptid;
+}
+
 ptid_t
 gdbsim_target::wait (ptid_t ptid, struct target_waitstatus *status,
 		     target_wait_flags options)
 {
-  struct sim_inferior_data *sim_data;
+  struct sim_inferior_data *sim_data = NULL;
   static sighandler_t prev_sigint;
   int sigrc = 0;
   enum sim_stop reason = sim_running;
 
+#if CXX_STD_THREAD
+  if (target_can_async_p (this))
+    {
+      sim_inferior_data *busy = NULL;
+
+      if (gdbsim_async_event != nullptr)
+	serial_event_clear (gdbsim_async_event);
+
+      /* Look for a simulator whose runner has finished.  */
+      for (inferior *inf : all_inferiors (this))
+	{
+	  sim_inferior_data *d = sim_inferior_data_key.get (inf);
+
+	  if (d == NULL
+	      || !d->runner.joinable ()
+	      || (ptid != minus_one_ptid && ptid.pid () != inf->pid))
+	    continue;
+	  if (d->runner_done)
+	    {
+	      sim_data = d;
+	      break;
+	    }
+	  if (busy == NULL)
+	    busy = d;
+	}
+
+      /* If the caller is prepared to block, wait for a simulator
+	 that is still running.  */
+      if (sim_data == NULL
+	  && !is_async_p ()
+	  && (options & TARGET_WNOHANG) == 0)
+	sim_data = busy;
+
+      if (sim_data == NULL
+	  && (is_async_p () || (options & TARGET_WNOHANG) != 0))
+	{
+	  status->set_ignore ();
+	  return minus_one_ptid;
+	}
+    }
+
+  /* Report the stop of a simulator that ran on its own thread.  */
+  if (sim_data != NULL)
+    {
+      if (remote_debug)
+	gdb_printf (gdb_stdlog, "gdbsim_wait: pid %d stopped\n",
+		    sim_data->remote_sim_ptid.pid ());
+
+      sim_data->runner.join ();
+      sim_data->resume_step = 0;
+
+      /* GDB expects all the inferiors to be stopped when one of them
+	 reports an event.  Any stop the others report at the same
+	 time is lost, but a breakpoint is hit again on the next
+	 resume.  */
+      for (inferior *inf : all_inferiors (this))
+	{
+	  sim_inferior_data *d = sim_inferior_data_key.get (inf);
+
+	  if (d != NULL && d != sim_data)
+	    d->stop_runner ();
+	}
+
+      if (sim_data->runner_error.reason != 0)
+	{
+	  gdb_exception ex (std::move (sim_data->runner_error));
+	  sim_data->runner_error = gdb_exception ();
+	  throw_exception (std::move (ex));
+	}
+
+      sim_stop_reason (sim_data->gdbsim_desc, &reason, &sigrc);
+      return gdbsim_stop_status (sim_data, reason, sigrc, status);
+    }
+#endif
+
   /* This target isn't able to (yet) resume more than one inferior at a time.
      When ptid is minus_one_ptid, just use the current inferior.  If we're
      given an explicit pid, we'll try to find it and use that instead.  */
@@ -977,35 +1379,7 @@ gdbsim_target::wait (ptid_t ptid, struct target_waitstatus *status,
   sim_data->resume_step = 0;
 
   sim_stop_reason (sim_data->gdbsim_desc, &reason, &sigrc);
-
-  switch (reason)
-    {
-    case sim_exited:
-      status->set_exited (sigrc);
-      break;
-    case sim_stopped:
-      switch (sigrc)
-	{
-	case GDB_SIGNAL_ABRT:
-	  quit ();
-	  break;
-	case GDB_SIGNAL_INT:
-	case GDB_SIGNAL_TRAP:
-	default:
-	  status->set_stopped ((gdb_signal) sigrc);
-	  break;
-	}
-      break;
-    case sim_signalled:
-      status->set_signalled ((gdb_signal) sigrc);
-      break;
-    case sim_running:
-    case sim_polling:
-      /* FIXME: Is this correct?  */
-      break;
-    }
-
-  return sim_data->remote_sim_ptid;
+  return gdbsim_stop_status (sim_data, reason, sigrc, status);
 }
 
 /* Get ready to modify the registers array.  On machines which store
@@ -1297,4 +1671,13 @@ _initialize_remote_sim ()
   c = add_com ("sim", class_obscure, simulator_command,
 	       _("Send a command to the simulator."));
   set_cmd_completer (c, sim_command_completer);
+
+  add_setshow_boolean_cmd ("sim-async", class_run, &sim_async, _("\
+Set whether simulators run on their own threads."), _("\
+Show whether simulators run on their own threads."), _("\
+When on, each inferior's simulator runs on a separate host thread while\n\
+it is resumed, and GDB reports its stops through the event loop, so that\n\
+GDB stays responsive.  Simulators are not re-entrant, so when several\n\
+inferiors are resumed, their simulators still run one at a time."),
+			   NULL, NULL, &setlist, &showlist);
 }
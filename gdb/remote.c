@@ -80,6 +80,7 @@
 #include <unordered_map>
 #include "async-event.h"
 #include "gdbsupport/selftest.h"
+#include "perf-counter.h"
 
 /* The remote target.  */
 
@@ -302,6 +303,23 @@ class remote_state
   ptid_t general_thread = null_ptid;
   ptid_t continue_thread = null_ptid;
 
+  /* Set when an all-stop stop reply is processed, and cleared once
+     the registers of all the stopped threads have been fetched with
+     qfThreadRegisters.  THREAD_REGISTERS_EVENT_PTID is the thread that
+     reported the stop; its registers alone don't trigger the fetch, as
+     the stop reply usually expedites the ones GDB needs.  */
+  bool thread_registers_pending = false;
+  ptid_t thread_registers_event_ptid = null_ptid;
+
+  /* The generation of the stub's thread list, as reported by
+     qThreadListGeneration, when the thread list was last fetched, and
+     the number of threads GDB then knew of for this target.
+     THREAD_LIST_GENERATION_P is false if no generation was recorded
+     yet.  */
+  bool thread_list_generation_p = false;
+  ULONGEST thread_list_generation = 0;
+  int thread_list_count = 0;
+
   /* This is the traceframe which we last selected on the remote system.
      It will be -1 if no traceframe is selected.  */
   int remote_traceframe_number = -1;
@@ -817,6 +835,8 @@ class remote_target : public process_stratum_target
   int remote_get_threads_with_ql (threads_listing_context *context);
   int remote_get_threads_with_qxfer (threads_listing_context *context);
   int remote_get_threads_with_qthreadinfo (threads_listing_context *context);
+  gdb::optional<ULONGEST> remote_get_thread_list_generation ();
+  int remote_count_threads ();
 
   void extended_remote_restart ();
 
@@ -850,8 +870,9 @@ class remote_target : public process_stratum_target
   int fetch_register_using_p (struct regcache *regcache,
 			      packet_reg *reg);
   int send_g_packet ();
-  void process_g_packet (struct regcache *regcache);
+  void process_g_packet (struct regcache *regcache, const char *buf);
   void fetch_registers_using_g (struct regcache *regcache);
+  bool fetch_thread_registers (ptid_t ptid);
   int store_register_using_P (const struct regcache *regcache,
 			      packet_reg *reg);
   void store_registers_using_G (const struct regcache *regcache);
@@ -877,6 +898,19 @@ class remote_target : public process_stratum_target
 					  ULONGEST len_units,
 					  int unit_size, ULONGEST *xfered_len_units);
 
+  target_xfer_status remote_read_bytes_pipelined (CORE_ADDR memaddr,
+						  gdb_byte *myaddr,
+						  ULONGEST len_units,
+						  int unit_size,
+						  ULONGEST *xfered_len_units);
+
+  ULONGEST memory_read_packet_units (int unit_size);
+
+  void build_memory_read_packet (CORE_ADDR memaddr, ULONGEST todo_units);
+
+  int decode_memory_read_reply (int packet_len, gdb_byte *myaddr,
+				ULONGEST todo_units, int unit_size);
+
   target_xfer_status remote_xfer_live_readonly_partial (gdb_byte *readbuf,
 							ULONGEST memaddr,
 							ULONGEST len,
@@ -2134,6 +2168,9 @@ enum {
   /* Support for target-side breakpoint conditions.  */
   PACKET_ConditionalBreakpoints,
 
+  /* Support for target-side read and access watchpoint conditions.  */
+  PACKET_ConditionalWatchpoints,
+
   /* Support for target-side breakpoint commands.  */
   PACKET_BreakpointCommands,
 
@@ -2220,6 +2257,20 @@ enum {
      packets and the tag violation stop replies.  */
   PACKET_memory_tagging_feature,
 
+  /* Support for sending several memory read packets before waiting
+     for their replies.  */
+  PACKET_pipelined_memory_reads,
+
+  /* Support for the binary memory read packet.  */
+  PACKET_x,
+
+  /* Support for fetching the registers of all stopped threads with
+     qfThreadRegisters and qsThreadRegisters.  */
+  PACKET_qThreadRegisters,
+
+  /* Support for the qThreadListGeneration packet.  */
+  PACKET_qThreadListGeneration,
+
   PACKET_MAX
 };
 
@@ -3921,6 +3972,46 @@ remote_target::remote_get_threads_with_qthreadinfo (threads_listing_context *con
   return 0;
 }
 
+/* Return the generation of the remote thread list using
+   qThreadListGeneration, or an empty optional if the stub doesn't
+   support it.  */
+
+gdb::optional<ULONGEST>
+remote_target::remote_get_thread_list_generation ()
+{
+  struct remote_state *rs = get_remote_state ();
+  ULONGEST generation;
+
+  if (packet_support (PACKET_qThreadListGeneration) == PACKET_DISABLE)
+    return {};
+
+  putpkt ("qThreadListGeneration");
+  getpkt (&rs->buf, 0);
+  if (packet_ok (rs->buf,
+		 &remote_protocol_packets[PACKET_qThreadListGeneration])
+      != PACKET_OK)
+    return {};
+
+  const char *p = unpack_varlen_hex (rs->buf.data (), &generation);
+  if (p == rs->buf.data () || *p != '\0')
+    return {};
+
+  return generation;
+}
+
+/* Return the number of non-exited threads of this target.  */
+
+int
+remote_target::remote_count_threads ()
+{
+  int count = 0;
+
+  for (thread_info *tp ATTRIBUTE_UNUSED : all_non_exited_threads (this))
+    count++;
+
+  return count;
+}
+
 /* Return true if INF only has one non-exited thread.  */
 
 static bool
@@ -3939,9 +4030,21 @@ has_single_non_exited_thread (inferior *inf)
 void
 remote_target::update_thread_list ()
 {
+  struct remote_state *rs = get_remote_state ();
   struct threads_listing_context context;
   int got_list = 0;
 
+  /* If neither the stub's thread list nor GDB's view of it changed
+     since the list was last fetched, there is nothing to update.  This
+     spares processes with many threads a full thread list transfer on
+     every stop.  */
+  gdb::optional<ULONGEST> generation = remote_get_thread_list_generation ();
+  if (generation.has_value ()
+      && rs->thread_list_generation_p
+      && *generation == rs->thread_list_generation
+      && remote_count_threads () == rs->thread_list_count)
+    return;
+
   /* We have a few different mechanisms to fetch the thread list.  Try
      them all, starting with the most preferred one first, falling
      back to older methods.  */
@@ -4011,6 +4114,13 @@ remote_target::update_thread_list ()
 	      info->thread_handle = std::move (item.thread_handle);
 	    }
 	}
+
+      if (generation.has_value ())
+	{
+	  rs->thread_list_generation_p = true;
+	  rs->thread_list_generation = *generation;
+	  rs->thread_list_count = remote_count_threads ();
+	}
     }
 
   if (!got_list)
@@ -5373,6 +5483,8 @@ static const struct protocol_feature remote_protocol_features[] = {
     PACKET_ConditionalTracepoints },
   { "ConditionalBreakpoints", PACKET_DISABLE, remote_supported_packet,
     PACKET_ConditionalBreakpoints },
+  { "ConditionalWatchpoints", PACKET_DISABLE, remote_supported_packet,
+    PACKET_ConditionalWatchpoints },
   { "BreakpointCommands", PACKET_DISABLE, remote_supported_packet,
     PACKET_BreakpointCommands },
   { "FastTracepoints", PACKET_DISABLE, remote_supported_packet,
@@ -5427,6 +5539,13 @@ static const struct protocol_feature remote_protocol_features[] = {
   { "no-resumed", PACKET_DISABLE, remote_supported_packet, PACKET_no_resumed },
   { "memory-tagging", PACKET_DISABLE, remote_supported_packet,
     PACKET_memory_tagging_feature },
+  { "pipelined-memory-reads", PACKET_DISABLE, remote_supported_packet,
+    PACKET_pipelined_memory_reads },
+  { "binary-upload", PACKET_DISABLE, remote_supported_packet, PACKET_x },
+  { "qThreadRegisters", PACKET_DISABLE, remote_supported_packet,
+    PACKET_qThreadRegisters },
+  { "qThreadListGeneration", PACKET_DISABLE, remote_supported_packet,
+    PACKET_qThreadListGeneration },
 };
 
 static char *remote_support_xml;
@@ -8102,6 +8221,10 @@ remote_target::process_stop_reply (struct stop_reply *stop_reply,
 	     all the target's threads stopped.  */
 	  for (thread_info *tp : all_non_exited_threads (this))
 	    get_remote_thread_info (tp)->set_not_resumed ();
+
+	  struct remote_state *rs = get_remote_state ();
+	  rs->thread_registers_pending = true;
+	  rs->thread_registers_event_ptid = ptid;
 	}
     }
 
@@ -8466,24 +8589,28 @@ remote_target::send_g_packet ()
   return buf_len / 2;
 }
 
+/* Supply to REGCACHE the registers in BUF, the contents of a 'g'
+   packet reply.  */
+
 void
-remote_target::process_g_packet (struct regcache *regcache)
+remote_target::process_g_packet (struct regcache *regcache,
+				const char *buf)
 {
   struct gdbarch *gdbarch = regcache->arch ();
   struct remote_state *rs = get_remote_state ();
   remote_arch_state *rsa = rs->get_remote_arch_state (gdbarch);
   int i, buf_len;
-  char *p;
+  const char *p;
   char *regs;
 
-  buf_len = strlen (rs->buf.data ());
+  buf_len = strlen (buf);
 
   /* Further sanity checks, with knowledge of the architecture.  */
   if (buf_len > 2 * rsa->sizeof_g_packet)
     error (_("Remote 'g' packet reply is too long (expected %ld bytes, got %d "
 	     "bytes): %s"),
 	   rsa->sizeof_g_packet, buf_len / 2,
-	   rs->buf.data ());
+	   buf);
 
   /* Save the size of the packet sent to us by the target.  It is used
      as a heuristic when determining the max size of packets that the
@@ -8533,7 +8660,7 @@ remote_target::process_g_packet (struct regcache *regcache)
      hex characters.  Suck them all up, then supply them to the
      register cacheing/storage mechanism.  */
 
-  p = rs->buf.data ();
+  p = buf;
   for (i = 0; i < rsa->sizeof_g_packet; i++)
     {
       if (p[0] == 0 || p[1] == 0)
@@ -8555,13 +8682,13 @@ remote_target::process_g_packet (struct regcache *regcache)
 
       if (r->in_g_packet)
 	{
-	  if ((r->offset + reg_size) * 2 > strlen (rs->buf.data ()))
+	  if ((r->offset + reg_size) * 2 > strlen (buf))
 	    /* This shouldn't happen - we adjusted in_g_packet above.  */
 	    internal_error (__FILE__, __LINE__,
 			    _("unexpected end of 'g' packet reply"));
-	  else if (rs->buf[r->offset * 2] == 'x')
+	  else if (buf[r->offset * 2] == 'x')
 	    {
-	      gdb_assert (r->offset * 2 < strlen (rs->buf.data ()));
+	      gdb_assert (r->offset * 2 < strlen (buf));
 	      /* The register isn't available, mark it as such (at
 		 the same time setting the value to zero).  */
 	      regcache->raw_supply (r->regnum, NULL);
@@ -8576,7 +8703,62 @@ void
 remote_target::fetch_registers_using_g (struct regcache *regcache)
 {
   send_g_packet ();
-  process_g_packet (regcache);
+  process_g_packet (regcache, get_remote_state ()->buf.data ());
+}
+
+/* Fetch the registers of all the stopped threads with
+   qfThreadRegisters and qsThreadRegisters, and supply them to the
+   threads' register caches.  Return true if the registers of PTID
+   were among them.  */
+
+bool
+remote_target::fetch_thread_registers (ptid_t ptid)
+{
+  struct remote_state *rs = get_remote_state ();
+  const char *query = "qfThreadRegisters";
+  bool found = false;
+
+  while (true)
+    {
+      putpkt (query);
+      getpkt (&rs->buf, 0);
+      if (packet_ok (rs->buf, &remote_protocol_packets[PACKET_qThreadRegisters])
+	  != PACKET_OK)
+	return found;
+
+      const char *p = rs->buf.data ();
+      if (*p != 'm' && *p != 'l')
+	return found;
+      bool more = *p++ == 'm';
+
+      while (*p != '\0')
+	{
+	  ptid_t thr_ptid = read_ptid (p, &p);
+
+	  if (*p != ':')
+	    error (_("Malformed qThreadRegisters reply: %s"),
+		   rs->buf.data ());
+
+	  const char *regs = p + 1;
+	  p = strchrnul (regs, ';');
+
+	  thread_info *tp = find_thread_ptid (this, thr_ptid);
+	  if (tp != nullptr)
+	    {
+	      process_g_packet (get_thread_regcache (tp),
+				std::string (regs, p - regs).c_str ());
+	      if (thr_ptid == ptid)
+		found = true;
+	    }
+
+	  if (*p == ';')
+	    p++;
+	}
+
+      if (!more)
+	return found;
+      query = "qsThreadRegisters";
+    }
 }
 
 /* Make the remote selected traceframe match GDB's selected
@@ -8613,6 +8795,20 @@ remote_target::fetch_registers (struct regcache *regcache, int regnum)
   set_remote_traceframe ();
   set_general_thread (regcache->ptid ());
 
+  /* The first time the registers of a thread other than the one that
+     reported the stop are needed, fetch those of all the threads at
+     once; a command that looks at one other thread is usually about to
+     look at all of them.  */
+  bool fetched = false;
+  if (rs->thread_registers_pending
+      && regcache->ptid () != rs->thread_registers_event_ptid
+      && get_traceframe_number () == -1
+      && packet_support (PACKET_qThreadRegisters) != PACKET_DISABLE)
+    {
+      rs->thread_registers_pending = false;
+      fetched = fetch_thread_registers (regcache->ptid ());
+    }
+
   if (regnum >= 0)
     {
       packet_reg *reg = packet_reg_from_regnum (gdbarch, rsa, regnum);
@@ -8625,7 +8821,8 @@ remote_target::fetch_registers (struct regcache *regcache, int regnum)
 	 contents, so fall back to 'p'.  */
       if (reg->in_g_packet)
 	{
-	  fetch_registers_using_g (regcache);
+	  if (!fetched)
+	    fetch_registers_using_g (regcache);
 	  if (reg->in_g_packet)
 	    return;
 	}
@@ -8639,7 +8836,8 @@ remote_target::fetch_registers (struct regcache *regcache, int regnum)
       return;
     }
 
-  fetch_registers_using_g (regcache);
+  if (!fetched)
+    fetch_registers_using_g (regcache);
 
   for (i = 0; i < gdbarch_num_regs (gdbarch); i++)
     if (!rsa->regs[i].in_g_packet)
@@ -9182,40 +9380,184 @@ remote_target::remote_read_bytes_1 (CORE_ADDR memaddr, gdb_byte *myaddr,
 				    int unit_size, ULONGEST *xfered_len_units)
 {
   struct remote_state *rs = get_remote_state ();
-  int buf_size_bytes;		/* Max size of packet output buffer.  */
-  char *p;
-  int todo_units;
-  int decoded_bytes;
+  ULONGEST todo_units;
+  int packet_len;
+  int decoded_units;
+
+  /* Number of units that will fit.  */
+  todo_units = std::min (len_units, memory_read_packet_units (unit_size));
+
+  /* If the transfer needs several packets, and the stub lets us, keep
+     several requests in flight, so that large reads are bound by the
+     bandwidth of the link rather than by its latency.  Without no-ack
+     mode each packet has to wait for its acknowledgment anyway.  */
+  if (todo_units < len_units
+      && rs->noack_mode
+      && packet_support (PACKET_pipelined_memory_reads) == PACKET_ENABLE)
+    return remote_read_bytes_pipelined (memaddr, myaddr, len_units,
+					unit_size, xfered_len_units);
+
+  build_memory_read_packet (memaddr, todo_units);
+  putpkt (rs->buf);
+  packet_len = getpkt_sane (&rs->buf, 0);
+  decoded_units = decode_memory_read_reply (packet_len, myaddr, todo_units,
+					    unit_size);
+  if (decoded_units < 0)
+    return TARGET_XFER_E_IO;
+  /* Return what we have.  Let higher layers handle partial reads.  */
+  *xfered_len_units = (ULONGEST) decoded_units;
+  return (*xfered_len_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
+}
+
+/* The maximum number of memory read requests remote_read_bytes_pipelined
+   sends before waiting for a reply.  */
+
+#define REMOTE_MEMORY_READ_PIPELINE_DEPTH 16
+
+/* Like remote_read_bytes_1, but send up to
+   REMOTE_MEMORY_READ_PIPELINE_DEPTH memory read packets for
+   consecutive chunks of the range before reading the replies.  The
+   stub answers packets in the order it receives them, so the replies
+   need no tagging.  */
+
+target_xfer_status
+remote_target::remote_read_bytes_pipelined (CORE_ADDR memaddr,
+					    gdb_byte *myaddr,
+					    ULONGEST len_units,
+					    int unit_size,
+					    ULONGEST *xfered_len_units)
+{
+  struct remote_state *rs = get_remote_state ();
+  ULONGEST chunk_units = memory_read_packet_units (unit_size);
+  ULONGEST n_requests
+    = std::min ((len_units + chunk_units - 1) / chunk_units,
+		(ULONGEST) REMOTE_MEMORY_READ_PIPELINE_DEPTH);
+
+  for (ULONGEST i = 0; i < n_requests; ++i)
+    {
+      ULONGEST offset = i * chunk_units;
+      ULONGEST todo_units = std::min (chunk_units, len_units - offset);
+
+      build_memory_read_packet (memaddr + offset, todo_units);
+      putpkt (rs->buf);
+    }
+
+  /* Read all the replies, even after a failed or short one, so that
+     none is left pending.  Only the contiguous data read from MEMADDR
+     on is reported; higher layers handle partial reads.  */
+  ULONGEST xfered_units = 0;
+  bool done = false;
+  bool first_failed = false;
+  for (ULONGEST i = 0; i < n_requests; ++i)
+    {
+      ULONGEST offset = i * chunk_units;
+      ULONGEST todo_units = std::min (chunk_units, len_units - offset);
+
+      int packet_len = getpkt_sane (&rs->buf, 0);
+      if (done)
+	continue;
+
+      int decoded_units
+	= decode_memory_read_reply (packet_len,
+				    myaddr + offset * unit_size,
+				    todo_units, unit_size);
+      if (decoded_units < 0)
+	{
+	  first_failed = (i == 0);
+	  done = true;
+	  continue;
+	}
+
+      xfered_units += decoded_units;
+      if (decoded_units < todo_units)
+	done = true;
+    }
 
-  buf_size_bytes = get_memory_read_packet_size ();
+  if (first_failed)
+    return TARGET_XFER_E_IO;
+
+  *xfered_len_units = xfered_units;
+  return (xfered_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
+}
+
+/* Return how many units of UNIT_SIZE bytes a reply to a single memory
+   read packet can hold.  */
+
+ULONGEST
+remote_target::memory_read_packet_units (int unit_size)
+{
   /* The packet buffer will be large enough for the payload;
      get_memory_packet_size ensures this.  */
+  int buf_size_bytes = get_memory_read_packet_size ();
 
-  /* Number of units that will fit.  */
-  todo_units = std::min (len_units,
-			 (ULONGEST) (buf_size_bytes / unit_size) / 2);
+  /* A binary reply is the 'b' marker followed by the data.  Escaped
+     bytes may make the stub return fewer units than requested, which
+     is then handled as a partial read.  */
+  if (packet_support (PACKET_x) == PACKET_ENABLE)
+    return (ULONGEST) (buf_size_bytes - 1) / unit_size;
+
+  /* Otherwise, each byte is encoded as two hex characters.  */
+  return (ULONGEST) (buf_size_bytes / unit_size) / 2;
+}
 
-  /* Construct "m"<memaddr>","<len>".  */
+/* Store in the remote buffer a request to read TODO_UNITS units at
+   MEMADDR.  */
+
+void
+remote_target::build_memory_read_packet (CORE_ADDR memaddr,
+					 ULONGEST todo_units)
+{
+  struct remote_state *rs = get_remote_state ();
+
+  /* Construct "x"<memaddr>","<len>" if the stub can reply in binary,
+     or "m"<memaddr>","<len>" otherwise.  */
   memaddr = remote_address_masked (memaddr);
-  p = rs->buf.data ();
-  *p++ = 'm';
+  char *p = rs->buf.data ();
+  *p++ = packet_support (PACKET_x) == PACKET_ENABLE ? 'x' : 'm';
   p += hexnumstr (p, (ULONGEST) memaddr);
   *p++ = ',';
-  p += hexnumstr (p, (ULONGEST) todo_units);
+  p += hexnumstr (p, todo_units);
   *p = '\0';
-  putpkt (rs->buf);
-  getpkt (&rs->buf, 0);
+}
+
+/* Decode the reply to a memory read request, PACKET_LEN bytes long,
+   from the remote buffer into MYADDR, which has room for TODO_UNITS
+   units of UNIT_SIZE bytes.  Return the number of units decoded, or
+   -1 if the read failed.  */
+
+int
+remote_target::decode_memory_read_reply (int packet_len, gdb_byte *myaddr,
+					 ULONGEST todo_units, int unit_size)
+{
+  struct remote_state *rs = get_remote_state ();
+  int decoded_bytes;
+
+  if (packet_len < 0)
+    return -1;
+
   if (rs->buf[0] == 'E'
       && isxdigit (rs->buf[1]) && isxdigit (rs->buf[2])
       && rs->buf[3] == '\0')
-    return TARGET_XFER_E_IO;
-  /* Reply describes memory byte by byte, each byte encoded as two hex
-     characters.  */
-  p = rs->buf.data ();
-  decoded_bytes = hex2bin (p, myaddr, todo_units * unit_size);
-  /* Return what we have.  Let higher layers handle partial reads.  */
-  *xfered_len_units = (ULONGEST) (decoded_bytes / unit_size);
-  return (*xfered_len_units != 0) ? TARGET_XFER_OK : TARGET_XFER_EOF;
+    return -1;
+
+  if (packet_support (PACKET_x) == PACKET_ENABLE)
+    {
+      if (packet_len < 1 || rs->buf[0] != 'b')
+	error (_("Unknown remote 'x' reply: %s"), rs->buf.data ());
+
+      decoded_bytes = remote_unescape_input ((gdb_byte *) rs->buf.data () + 1,
+					     packet_len - 1, myaddr,
+					     todo_units * unit_size);
+    }
+  else
+    {
+      /* Reply describes memory byte by byte, each byte encoded as two
+	 hex characters.  */
+      decoded_bytes = hex2bin (rs->buf.data (), myaddr,
+			       todo_units * unit_size);
+    }
+
+  return decoded_bytes / unit_size;
 }
 
 /* Using the set of read-only target sections of remote, read live
@@ -9541,6 +9883,22 @@ putpkt (remote_target *remote, const char *buf)
   return remote->putpkt (buf);
 }
 
+/* Remote protocol traffic.  Retransmissions and acks are not
+   counted.  */
+
+static perf_counter packets_sent_counter
+  ("remote-packets-sent", perf_counter_unit::count,
+   N_("Remote protocol packets sent."));
+static perf_counter packet_bytes_sent_counter
+  ("remote-bytes-sent", perf_counter_unit::bytes,
+   N_("Payload bytes of the remote protocol packets sent."));
+static perf_counter packets_received_counter
+  ("remote-packets-received", perf_counter_unit::count,
+   N_("Remote protocol packets and notifications received."));
+static perf_counter packet_bytes_received_counter
+  ("remote-bytes-received", perf_counter_unit::bytes,
+   N_("Payload bytes of the remote protocol packets received."));
+
 /* Send a packet to the remote machine, with error checking.  The data
    of the packet is in BUF.  The string in BUF can be at most
    get_remote_packet_size () - 5 to account for the $, # and checksum,
@@ -9560,6 +9918,9 @@ remote_target::putpkt_binary (const char *buf, int cnt)
   int tcount = 0;
   char *p;
 
+  packets_sent_counter.add ();
+  packet_bytes_sent_counter.add (cnt);
+
   /* Catch cases like trying to read memory or listing threads while
      we're waiting for a stop reply.  The remote server wouldn't be
      ready to handle this request, so we'd hang and timeout.  We don't
@@ -9764,6 +10125,35 @@ remote_target::read_frame (gdb::char_vector *buf_p)
 
   while (1)
     {
+      /* Copy the plain packet data that has already been received
+	 straight into BUF, up to the next character that needs the
+	 special handling below.  This avoids going through readchar
+	 for every byte of a large reply.  */
+      const unsigned char *data;
+      size_t avail = serial_buffered (rs->remote_desc, &data);
+      if (avail > 0)
+	{
+	  if (bc + avail >= buf_p->size ())
+	    {
+	      /* Make some more room in the buffer.  */
+	      buf_p->resize (std::max (buf_p->size () * 2, bc + avail + 1));
+	      buf = buf_p->data ();
+	    }
+
+	  size_t n;
+	  for (n = 0; n < avail; n++)
+	    {
+	      unsigned char ch = data[n];
+
+	      if (ch == '$' || ch == '#' || ch == '*')
+		break;
+	      buf[bc + n] = ch;
+	      csum += ch;
+	    }
+	  bc += n;
+	  serial_consume_buffered (rs->remote_desc, n);
+	}
+
       c = readchar (remote_timeout);
       switch (c)
 	{
@@ -9968,7 +10358,11 @@ remote_target::getpkt_or_notif_sane_1 (gdb::char_vector *buf,
 		 Now collect the data.  */
 	      val = read_frame (buf);
 	      if (val >= 0)
-		break;
+		{
+		  packets_received_counter.add ();
+		  packet_bytes_received_counter.add (val);
+		  break;
+		}
 	    }
 
 	  remote_serial_write ("-", 1);
@@ -10671,6 +11065,59 @@ watchpoint_to_Z_packet (int type)
     }
 }
 
+/* Append CONDS, the conditions of a read or access watchpoint and of
+   its duplicates, to the Z packet in BUF as agent expressions, if the
+   target can evaluate all of them; the target reports a hit if any is
+   true.  The watchpoint may trigger anywhere, so only conditions that
+   don't depend on registers (which includes anything involving local
+   variables) can be compiled without knowing the PC in advance.  If
+   the conditions are left out, the target reports every hit, and GDB
+   evaluates them, as usual.  */
+
+static void
+remote_add_watchpoint_conditions
+  (const std::vector<struct expression *> &conds, char *buf, char *buf_end)
+{
+  std::vector<agent_expr_up> aexprs;
+  int needed = 0;
+
+  for (struct expression *cond : conds)
+    {
+      agent_expr_up aexpr;
+
+      try
+	{
+	  aexpr = gen_eval_for_expr (0, cond);
+	}
+      catch (const gdb_exception_error &ex)
+	{
+	  return;
+	}
+
+      ax_reqs (aexpr.get ());
+      if (aexpr->flaw != agent_flaw_none)
+	return;
+      for (int i = 0; i < aexpr->reg_mask_len; ++i)
+	if (aexpr->reg_mask[i] != 0)
+	  return;
+
+      needed += 2 * aexpr->len + 16;
+      aexprs.push_back (std::move (aexpr));
+    }
+
+  buf += strlen (buf);
+  if (buf_end - buf < needed)
+    return;
+
+  for (const agent_expr_up &aexpr : aexprs)
+    {
+      buf += xsnprintf (buf, buf_end - buf, ";X%x,", aexpr->len);
+      for (int i = 0; i < aexpr->len; ++i)
+	buf = pack_hex_byte (buf, aexpr->buf[i]);
+    }
+  *buf = '\0';
+}
+
 int
 remote_target::insert_watchpoint (CORE_ADDR addr, int len,
 				  enum target_hw_bp_type type, struct expression *cond)
@@ -10694,6 +11141,16 @@ remote_target::insert_watchpoint (CORE_ADDR addr, int len,
   p += hexnumstr (p, (ULONGEST) addr);
   xsnprintf (p, endbuf - p, ",%x", len);
 
+  /* Write watchpoints are left out: GDB only reports them when the
+     value changes, which it can only tell if it sees every hit.  */
+  std::vector<struct expression *> conds;
+  if (cond != nullptr
+      && (type == hw_read || type == hw_access)
+      && !gdb_evaluates_breakpoint_condition_p ()
+      && packet_support (PACKET_ConditionalWatchpoints) == PACKET_ENABLE
+      && watchpoint_target_conditions (addr, len, type, &conds))
+    remote_add_watchpoint_conditions (conds, rs->buf.data (), endbuf);
+
   putpkt (rs->buf);
   getpkt (&rs->buf, 0);
 
@@ -15258,6 +15715,10 @@ Show the maximum size of the address (in bits) in a memory packet."), NULL,
 			 "ConditionalBreakpoints",
 			 "conditional-breakpoints", 0);
 
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_ConditionalWatchpoints],
+			 "ConditionalWatchpoints",
+			 "conditional-watchpoints", 0);
+
   add_packet_config_cmd (&remote_protocol_packets[PACKET_BreakpointCommands],
 			 "BreakpointCommands",
 			 "breakpoint-commands", 0);
@@ -15346,6 +15807,18 @@ Show the maximum size of the address (in bits) in a memory packet."), NULL,
   add_packet_config_cmd (&remote_protocol_packets[PACKET_memory_tagging_feature],
 			 "memory-tagging-feature", "memory-tagging-feature", 0);
 
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_pipelined_memory_reads],
+			 "pipelined-memory-reads", "pipelined-memory-reads", 0);
+
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_x],
+			 "x", "binary-upload", 0);
+
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_qThreadRegisters],
+			 "qThreadRegisters", "thread-registers", 0);
+
+  add_packet_config_cmd (&remote_protocol_packets[PACKET_qThreadListGeneration],
+			 "qThreadListGeneration", "thread-list-generation", 0);
+
   /* Assert that we've registered "set remote foo-packet" commands
      for all packet configs.  */
   {
@@ -410,6 +410,46 @@ serial_readchar (struct serial *scb, int timeout)
   return (ch);
 }
 
+/* See serial.h.  */
+
+size_t
+serial_buffered (struct serial *scb, const unsigned char **data)
+{
+  if (scb->bufcnt <= 0)
+    return 0;
+
+  *data = scb->bufp;
+  return scb->bufcnt;
+}
+
+/* See serial.h.  */
+
+void
+serial_consume_buffered (struct serial *scb, size_t count)
+{
+  gdb_assert (scb->bufcnt >= 0 && count <= scb->bufcnt);
+
+  if (serial_logfp != NULL)
+    {
+      for (size_t i = 0; i < count; i++)
+	serial_logchar (serial_logfp, 'r', scb->bufp[i], 0);
+      gdb_flush (serial_logfp);
+    }
+  if (serial_debug_p (scb))
+    {
+      for (size_t i = 0; i < count; i++)
+	{
+	  gdb_printf (gdb_stdlog, "[");
+	  serial_logchar (gdb_stdlog, 'r', scb->bufp[i], 0);
+	  gdb_printf (gdb_stdlog, "]");
+	}
+      gdb_flush (gdb_stdlog);
+    }
+
+  scb->bufp += count;
+  scb->bufcnt -= count;
+}
+
 int
 serial_write (struct serial *scb, const void *buf, size_t count)
 {
@@ -119,6 +119,19 @@ enum serial_rc {
 
 extern int serial_readchar (struct serial *scb, int timeout);
 
+/* Set *DATA to the bytes that SCB has already received but that
+   haven't been read yet, and return how many there are.  This never
+   blocks, and returns 0 if nothing is buffered.  The bytes stay in
+   the buffer until consumed with serial_consume_buffered.  */
+
+extern size_t serial_buffered (struct serial *scb,
+			       const unsigned char **data);
+
+/* Consume the first COUNT bytes returned by serial_buffered, as if
+   they had been read one at a time with serial_readchar.  */
+
+extern void serial_consume_buffered (struct serial *scb, size_t count);
+
 /* Write COUNT bytes from BUF to the port SCB.  Returns 0 for
    success, non-zero for failure.  */
 
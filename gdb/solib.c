@@ -38,6 +38,7 @@
 #include "completer.h"
 #include "elf/external.h"
 #include "elf/common.h"
+#include "debuginfod-support.h"
 #include "filenames.h"		/* for DOSish file names */
 #include "exec.h"
 #include "solist.h"
@@ -53,6 +54,7 @@
 #include "debuginfod-support.h"
 #include "source.h"
 #include "cli/cli-style.h"
+#include "breakpoint.h"
 
 /* Architecture-specific operations.  */
 
@@ -1015,6 +1017,37 @@ libpthread_solib_p (struct so_list *so)
 
    FROM_TTY is described for update_solib_list, above.  */
 
+/* Ask debuginfod for the separate debug info of all the shared
+   libraries solib_add is about to read symbols from, and that have
+   neither DWARF of their own nor a debug file on the local disk, all
+   at once, instead of one at a time as their symbols are read.
+   PATTERN and READSYMS are as for solib_add; PATTERN has already been
+   compiled.  */
+
+static void
+solib_prefetch_debuginfo (const char *pattern, int readsyms)
+{
+  std::vector<const bfd_build_id *> build_ids;
+
+  for (struct so_list *so : current_program_space->solibs ())
+    {
+      if (so->symbols_loaded || so->abfd == nullptr
+	  || (pattern != nullptr && !re_exec (so->so_name))
+	  || !(readsyms || libpthread_solib_p (so)))
+	continue;
+
+      const bfd_build_id *build_id = build_id_bfd_get (so->abfd);
+      if (build_id == nullptr
+	  || bfd_get_section_by_name (so->abfd, ".debug_info") != nullptr
+	  || build_id_to_debug_bfd (build_id->size, build_id->data) != nullptr)
+	continue;
+
+      build_ids.push_back (build_id);
+    }
+
+  debuginfod_debuginfo_prefetch (build_ids);
+}
+
 void
 solib_add (const char *pattern, int from_tty, int readsyms)
 {
@@ -1041,6 +1074,8 @@ solib_add (const char *pattern, int from_tty, int readsyms)
 
   update_solib_list (from_tty);
 
+  solib_prefetch_debuginfo (pattern, readsyms);
+
   /* Walk the list of currently loaded shared libraries, and read
      symbols for any that match the pattern --- or any whose symbols
      aren't already loaded, if no pattern was given.  */
@@ -1332,6 +1367,74 @@ update_solib_breakpoints (void)
     ops->update_breakpoints ();
 }
 
+/* If true, handle_solib_event doesn't read the symbols of new shared
+   libraries, leaving that to the next stop reported to the user.  */
+
+static bool defer_solib_symbols = false;
+
+static void
+show_defer_solib_symbols (struct ui_file *file, int from_tty,
+			  struct cmd_list_element *c, const char *value)
+{
+  gdb_printf (file, _("Deferring of shared library symbol loading "
+		      "is %s.\n"), value);
+}
+
+/* Return true if SO is the dynamic linker.  Since glibc 2.34,
+   libthread_db looks up some of the variables it needs (_rtld_global
+   among them) in the dynamic linker rather than in the threads
+   library.  This matches the usual GNU/Linux names; as with
+   libpthread_name_p, false positives are harmless.  */
+
+static bool
+dynamic_linker_solib_p (struct so_list *so)
+{
+  return (strstr (so->so_name, "/ld-linux") != NULL
+	  || strstr (so->so_name, "/ld64.so.") != NULL
+	  || strstr (so->so_name, "/ld.so.") != NULL);
+}
+
+/* Read the symbols of the dynamic linker, if they haven't been read
+   yet.  Used when the symbols of the other libraries are deferred, so
+   that libthread_db can find what it needs in it once the threads
+   library is read.  */
+
+static void
+solib_read_dynamic_linker_symbols ()
+{
+  bool loaded_any_symbols = false;
+
+  for (struct so_list *so : current_program_space->solibs ())
+    if (!so->symbols_loaded && dynamic_linker_solib_p (so)
+	&& solib_read_symbols (so, SYMFILE_DEFER_BP_RESET))
+      loaded_any_symbols = true;
+
+  if (loaded_any_symbols)
+    {
+      breakpoint_re_set ();
+      reinit_frame_cache ();
+    }
+}
+
+/* Return true if handle_solib_event may put off reading the symbols
+   of new libraries.  This is only safe while no user breakpoint is
+   pending: a pending breakpoint could be resolved by one of the new
+   libraries, and must be inserted before the inferior runs into
+   it.  */
+
+static bool
+solib_symbols_deferrable_p ()
+{
+  if (!defer_solib_symbols)
+    return false;
+
+  for (breakpoint *b : all_breakpoints ())
+    if (user_breakpoint_p (b) && pending_breakpoint_p (b))
+      return false;
+
+  return true;
+}
+
 /* See solib.h.  */
 
 void
@@ -1348,10 +1451,37 @@ handle_solib_event (void)
      be adding them automatically.  Switch terminal for any messages
      produced by breakpoint_re_set.  */
   target_terminal::ours_for_output ();
-  solib_add (NULL, 0, auto_solib_add);
+  if (auto_solib_add && solib_symbols_deferrable_p ())
+    {
+      /* Only update the list of libraries now; the symbols are read
+	 in one go at the next stop the user sees.  The exceptions are
+	 the libraries thread debugging needs right away: the dynamic
+	 linker, read first so that it is there when libthread_db is
+	 loaded, and the threads library (libc as of glibc 2.34), which
+	 solib_add always reads.  */
+      update_solib_list (0);
+      solib_read_dynamic_linker_symbols ();
+      solib_add (NULL, 0, 0);
+      current_program_space->solib_symbols_deferred = true;
+    }
+  else
+    solib_add (NULL, 0, auto_solib_add);
   target_terminal::inferior ();
 }
 
+/* See solib.h.  */
+
+void
+load_deferred_solib_symbols ()
+{
+  if (!current_program_space->solib_symbols_deferred)
+    return;
+
+  current_program_space->solib_symbols_deferred = false;
+  if (auto_solib_add && target_has_execution ())
+    solib_add (NULL, 0, auto_solib_add);
+}
+
 /* Reload shared libraries, but avoid reloading the same symbol file
    we already have loaded.  */
 
@@ -1814,6 +1944,19 @@ inferior.  Otherwise, symbols must be loaded manually, using \
 			   show_auto_solib_add,
 			   &setlist, &showlist);
 
+  add_setshow_boolean_cmd ("defer-solib-symbols", class_support,
+			   &defer_solib_symbols, _("\
+Set deferring of shared library symbol loading."), _("\
+Show deferring of shared library symbol loading."), _("\
+If \"on\", and no breakpoint is pending, symbols of shared libraries loaded\n\
+while the inferior runs are not read when the dynamic linker reports them,\n\
+but only at the next stop, all at once.  This speeds up programs that load\n\
+many libraries, at the cost of not inserting breakpoint locations in those\n\
+libraries until then.  The default is \"off\"."),
+			   NULL,
+			   show_defer_solib_symbols,
+			   &setlist, &showlist);
+
   set_show_commands sysroot_cmds
     = add_setshow_optional_filename_cmd ("sysroot", class_support,
 					 &gdb_sysroot, _("\
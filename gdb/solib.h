@@ -133,6 +133,12 @@ extern void update_solib_breakpoints (void);
 
 extern void handle_solib_event (void);
 
+/* Read the symbols of the shared libraries whose loading was deferred
+   by handle_solib_event, if any.  Called before a stop is presented
+   to the user.  */
+
+extern void load_deferred_solib_symbols ();
+
 /* Associate SONAME with BUILD_ID in ABFD's registry so that it can be
    retrieved with get_cbfd_soname_build_id.  */
 
@@ -26,6 +26,13 @@
 #include "objfiles.h"
 #include "exec.h"
 #include "cli/cli-cmds.h"
+#include "observable.h"
+#include "run-on-main-thread.h"
+#include "gdbsupport/thread-pool.h"
+#include <algorithm>
+#if CXX_STD_THREAD
+#include <mutex>
+#endif
 
 #ifdef HAVE_SOURCE_HIGHLIGHT
 /* If Gnulib redirects 'open' and 'close' to its replacements
@@ -39,9 +46,14 @@
 #include <srchilite/langmap.h>
 #endif
 
-/* The number of source files we'll cache.  */
+/* The maximum number of bytes used by the source files we cache, or
+   -1 for no limit.  The most recently used file is always kept.  */
+
+static int source_cache_max_size = 10 * 1024 * 1024;
+
+/* Files at least this large are highlighted in the background.  */
 
-#define MAX_ENTRIES 5
+#define ASYNC_HIGHLIGHT_SIZE (256 * 1024)
 
 /* See source-cache.h.  */
 
@@ -87,6 +99,29 @@ set_use_gnu_source_highlight_enabled (const char *ignore_args,
 #endif
 }
 
+/* The "maint show source-cache max-size" command.  */
+
+static void
+show_source_cache_max_size (struct ui_file *file, int from_tty,
+			    struct cmd_list_element *c, const char *value)
+{
+  gdb_printf (file,
+	      _("The upper bound on the memory used by cached source "
+		"files is %s.\n"),
+	      value);
+}
+
+/* The "maint set source-cache max-size" command.  */
+
+static void
+set_source_cache_max_size (const char *ignore_args, int from_tty,
+			   struct cmd_list_element *c)
+{
+  /* Drop everything rather than trimming, like the other settings
+     affecting the cache.  */
+  forget_cached_source_info ();
+}
+
 /* See source-cache.h.  */
 
 std::string
@@ -189,10 +224,118 @@ get_language_name (enum language lang)
   return nullptr;
 }
 
+/* Highlight CONTENTS, the text of the file FULLNAME written in the
+   Source Highlight language LANG_NAME.  Return the highlighted text,
+   or an empty optional if highlighting fails.  This may be called
+   from any thread.  */
+
+static gdb::optional<std::string>
+highlight_source (const std::string &contents, const char *lang_name,
+		  const std::string &fullname)
+{
+  /* The global source highlight object, or null if one was never
+     constructed.  This is stored here rather than in the class so
+     that we don't need to include anything or do conditional
+     compilation in source-cache.h.  */
+  static srchilite::SourceHighlight *highlighter;
+
+#if CXX_STD_THREAD
+  /* The highlighter can only be used by one thread at a time.  */
+  static std::mutex highlighter_lock;
+  std::lock_guard<std::mutex> guard (highlighter_lock);
+#endif
+
+  try
+    {
+      if (highlighter == nullptr)
+	{
+	  highlighter = new srchilite::SourceHighlight ("esc.outlang");
+	  highlighter->setStyleFile ("esc.style");
+	}
+
+      std::istringstream input (contents);
+      std::ostringstream output;
+      highlighter->highlight (input, output, lang_name, fullname);
+      return output.str ();
+    }
+  catch (...)
+    {
+      /* Source Highlight will throw an exception if highlighting
+	 fails.  One possible reason it can fail is if the language is
+	 unknown -- which matters to gdb because Rust support wasn't
+	 added until after 3.1.8.  Ignore exceptions here and fall
+	 back to un-highlighted text. */
+    }
+
+  return {};
+}
+
 #endif /* HAVE_SOURCE_HIGHLIGHT */
 
 /* See source-cache.h.  */
 
+size_t
+source_cache::entry_size (const source_text &text) const
+{
+  size_t result = text.fullname.size () + text.contents.size ();
+
+  auto iter = m_offset_cache.find (text.fullname);
+  if (iter != m_offset_cache.end ())
+    result += iter->second.size () * sizeof (off_t);
+
+  return result;
+}
+
+/* See source-cache.h.  */
+
+void
+source_cache::trim ()
+{
+  while (m_source_map.size () > 1
+	 && source_cache_max_size >= 0
+	 && m_total_size > (size_t) source_cache_max_size)
+    {
+      auto iter = m_source_map.begin ();
+      m_total_size -= entry_size (*iter);
+      m_offset_cache.erase (iter->fullname);
+      m_source_map.erase (iter);
+    }
+}
+
+/* See source-cache.h.  */
+
+void
+source_cache::highlighting_done (const std::string &fullname,
+				 unsigned int generation,
+				 gdb::optional<std::string> &&styled)
+{
+  for (source_text &text : m_source_map)
+    if (text.pending == generation && text.fullname == fullname)
+      {
+	m_total_size -= entry_size (text);
+	if (styled.has_value ())
+	  text.contents = std::move (*styled);
+	else
+	  {
+	    gdb::optional<std::string> ext_contents
+	      = ext_lang_colorize (fullname, text.contents);
+	    if (ext_contents.has_value ())
+	      text.contents = std::move (*ext_contents);
+	  }
+	text.pending = 0;
+	m_total_size += entry_size (text);
+	trim ();
+
+	/* Let the TUI redisplay the file, now highlighted.  */
+	gdb::observers::styling_changed.notify ();
+	return;
+      }
+
+  /* The entry was removed from the cache in the meantime.  */
+}
+
+/* See source-cache.h.  */
+
 bool
 source_cache::ensure (struct symtab *s)
 {
@@ -207,12 +350,13 @@ source_cache::ensure (struct symtab *s)
 	     when reading the file.  */
 	  gdb_assert (m_offset_cache.find (fullname)
 		      != m_offset_cache.end ());
-	  /* Not strictly LRU, but at least ensure that the most
-	     recently used entry is always the last candidate for
-	     deletion.  Note that this property is relied upon by at
-	     least one caller.  */
-	  if (i != size - 1)
-	    std::swap (m_source_map[i], m_source_map[size - 1]);
+	  /* Keep the entries ordered from the least to the most
+	     recently used.  Note that the most recently used entry
+	     being the last one is relied upon by at least one
+	     caller.  */
+	  std::rotate (m_source_map.begin () + i,
+		       m_source_map.begin () + i + 1,
+		       m_source_map.end ());
 	  return true;
 	}
     }
@@ -228,6 +372,7 @@ source_cache::ensure (struct symtab *s)
       return false;
     }
 
+  unsigned int pending = 0;
   if (source_styling && gdb_stdout->can_emit_style_escape ())
     {
 #ifdef HAVE_SOURCE_HIGHLIGHT
@@ -235,34 +380,37 @@ source_cache::ensure (struct symtab *s)
       const char *lang_name = get_language_name (s->language ());
       if (lang_name != nullptr && use_gnu_source_highlight)
 	{
-	  /* The global source highlight object, or null if one was
-	     never constructed.  This is stored here rather than in
-	     the class so that we don't need to include anything or do
-	     conditional compilation in source-cache.h.  */
-	  static srchilite::SourceHighlight *highlighter;
-
-	  try
+	  if (contents.size () >= ASYNC_HIGHLIGHT_SIZE)
 	    {
-	      if (highlighter == nullptr)
-		{
-		  highlighter = new srchilite::SourceHighlight ("esc.outlang");
-		  highlighter->setStyleFile ("esc.style");
-		}
-
-	      std::istringstream input (contents);
-	      std::ostringstream output;
-	      highlighter->highlight (input, output, lang_name, fullname);
-	      contents = output.str ();
+	      /* Highlighting a large file can take long enough to be
+		 noticed, so do it on a worker thread and keep the
+		 plain text until then.  */
+	      pending = ++m_generation;
+	      if (pending == 0)
+		pending = ++m_generation;
+
+	      gdb::thread_pool::g_thread_pool->post_task
+		([this, text = contents, lang_name, fullname, pending] ()
+		 {
+		   gdb::optional<std::string> styled
+		     = highlight_source (text, lang_name, fullname);
+		   run_on_main_thread ([=] () mutable
+		     {
+		       highlighting_done (fullname, pending,
+					  std::move (styled));
+		     });
+		 }, gdb::task_priority::background);
 	      already_styled = true;
 	    }
-	  catch (...)
+	  else
 	    {
-	      /* Source Highlight will throw an exception if
-		 highlighting fails.  One possible reason it can fail
-		 is if the language is unknown -- which matters to gdb
-		 because Rust support wasn't added until after 3.1.8.
-		 Ignore exceptions here and fall back to
-		 un-highlighted text. */
+	      gdb::optional<std::string> styled
+		= highlight_source (contents, lang_name, fullname);
+	      if (styled.has_value ())
+		{
+		  contents = std::move (*styled);
+		  already_styled = true;
+		}
 	    }
 	}
 
@@ -276,15 +424,11 @@ source_cache::ensure (struct symtab *s)
 	}
     }
 
-  source_text result = { std::move (fullname), std::move (contents) };
+  source_text result = { std::move (fullname), std::move (contents),
+			 pending };
+  m_total_size += entry_size (result);
   m_source_map.push_back (std::move (result));
-
-  if (m_source_map.size () > MAX_ENTRIES)
-    {
-      auto iter = m_source_map.begin ();
-      m_offset_cache.erase (iter->fullname);
-      m_source_map.erase (iter);
-    }
+  trim ();
 
   return true;
 }
@@ -429,6 +573,30 @@ styling to source code lines that are shown."),
 			   &maint_set_gnu_source_highlight_cmdlist,
 			   &maint_show_gnu_source_highlight_cmdlist);
 
+  /* All the 'maint set|show source-cache' sub-commands.  */
+  static struct cmd_list_element *maint_set_source_cache_cmdlist;
+  static struct cmd_list_element *maint_show_source_cache_cmdlist;
+
+  add_setshow_prefix_cmd ("source-cache", class_maintenance,
+			  _("Set source-cache specific variables."),
+			  _("Show source-cache specific variables."),
+			  &maint_set_source_cache_cmdlist,
+			  &maint_show_source_cache_cmdlist,
+			  &maintenance_set_cmdlist,
+			  &maintenance_show_cmdlist);
+
+  add_setshow_zuinteger_unlimited_cmd ("max-size", class_maintenance,
+				       &source_cache_max_size, _("\
+Set the upper bound on the memory used by cached source files."), _("\
+Show the upper bound on the memory used by cached source files."), _("\
+When the source files cached in memory, including their styled text and\n\
+their line offsets, use more than this many bytes, the least recently used\n\
+ones are released.  The most recently used file is always kept."),
+				       set_source_cache_max_size,
+				       show_source_cache_max_size,
+				       &maint_set_source_cache_cmdlist,
+				       &maint_show_source_cache_cmdlist);
+
   /* Enable use of GNU Source Highlight library, if we have it.  */
 #ifdef HAVE_SOURCE_HIGHLIGHT
   use_gnu_source_highlight = true;
@@ -21,18 +21,23 @@
 
 #include <unordered_map>
 #include <unordered_set>
+#include "gdbsupport/gdb_optional.h"
 
 /* This caches two things related to source files.
 
    First, it caches highlighted source text, keyed by the source
-   file's full name.  A size-limited LRU cache is used.
+   file's full name.  An LRU cache limited to a number of bytes is
+   used.
 
    Highlighting depends on the GNU Source Highlight library.  When not
    available or when highlighting fails for some reason, this cache
-   will instead store the un-highlighted source text.
+   will instead store the un-highlighted source text.  Large files are
+   highlighted in the background, their un-highlighted text being
+   returned until that is done.
 
    Second, this will cache the file offsets corresponding to the start
-   of each line of a source file.  This cache is not size-limited.  */
+   of each line of a source file.  Entries are removed from this cache
+   along with the text they were computed from.  */
 class source_cache
 {
 public:
@@ -66,6 +71,7 @@ class source_cache
   {
     m_source_map.clear ();
     m_offset_cache.clear ();
+    m_total_size = 0;
   }
 
 private:
@@ -77,8 +83,25 @@ class source_cache
     std::string fullname;
     /* The contents of the file.  */
     std::string contents;
+    /* The generation of the highlighting of CONTENTS in progress in
+       the background, or 0 if there is none.  */
+    unsigned int pending = 0;
   };
 
+  /* Return the number of bytes used by the cached data of TEXT.  */
+  size_t entry_size (const source_text &text) const;
+
+  /* Remove the least recently used entries until the cache fits its
+     size limit, always keeping the most recently used one.  */
+  void trim ();
+
+  /* Called on the main thread when the background highlighting of
+     FULLNAME, started with the generation number GENERATION, is done.
+     STYLED holds the highlighted text, if highlighting succeeded.  */
+  void highlighting_done (const std::string &fullname,
+			  unsigned int generation,
+			  gdb::optional<std::string> &&styled);
+
   /* A helper function for get_source_lines reads a source file.
      Returns the contents of the file; or throws an exception on
      error.  This also updates m_offset_cache.  */
@@ -95,6 +118,12 @@ class source_cache
   /* The file offset cache.  The key is the full name of the source
      file.  */
   std::unordered_map<std::string, std::vector<off_t>> m_offset_cache;
+
+  /* The sum of entry_size for all the elements of M_SOURCE_MAP.  */
+  size_t m_total_size = 0;
+
+  /* Incremented whenever background highlighting starts.  */
+  unsigned int m_generation = 0;
 };
 
 /* The global source cache.  */
@@ -2533,6 +2533,7 @@ reread_symbols (int from_tty)
 	  objfile->sect_index_rodata = -1;
 	  objfile->sect_index_text = -1;
 	  objfile->compunit_symtabs = NULL;
+	  objfile->compunits_changed ();
 	  objfile->template_symbols = NULL;
 	  objfile->static_links.reset (nullptr);
 
@@ -2851,6 +2852,7 @@ add_compunit_symtab_to_objfile (struct compunit_symtab *cu)
 {
   cu->next = cu->objfile ()->compunit_symtabs;
   cu->objfile ()->compunit_symtabs = cu;
+  cu->objfile ()->compunits_changed ();
 }
 
 
@@ -89,6 +89,41 @@ print_objfile_statistics (void)
 	gdb_printf (_("  Number of symbol tables with blockvectors: %d\n"),
 		    blockvectors);
 
+	mdict_hash_stats dict_stats;
+	for (compunit_symtab *cu : objfile->compunits ())
+	  {
+	    const blockvector *bv = cu->blockvector ();
+	    if (bv == nullptr)
+	      continue;
+	    for (int b = 0; b < bv->num_blocks (); b++)
+	      mdict_add_hash_stats (bv->block (b)->multidict (), &dict_stats);
+	  }
+	if (dict_stats.n_buckets > 0)
+	  {
+	    gdb_printf (_("  Block dictionary hash buckets: %s, %s used\n"),
+			pulongest (dict_stats.n_buckets),
+			pulongest (dict_stats.n_used_buckets));
+	    gdb_printf (_("  Block dictionary hashed symbols: %s, "
+			  "longest chain: %s\n"),
+			pulongest (dict_stats.n_symbols),
+			pulongest (dict_stats.max_chain));
+	  }
+
+	gdb::hash_table_statistics names_stats
+	  = objfile->per_bfd->demangled_names_hash.statistics ();
+	if (names_stats.capacity > 0)
+	  {
+	    gdb_printf (_("  Demangled name hash table: %s entries, "
+			  "%s slots\n"),
+			pulongest (names_stats.elements),
+			pulongest (names_stats.capacity));
+	    gdb_printf (_("  Demangled name hash lookups: %s, "
+			  "groups probed: %s, rebuilds: %s\n"),
+			pulongest (names_stats.searches),
+			pulongest (names_stats.probes),
+			pulongest (names_stats.rebuilds));
+	  }
+
 	objfile->print_stats (false);
 
 	if (OBJSTAT (objfile, sz_strtab) > 0)
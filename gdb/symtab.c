@@ -72,6 +72,13 @@
 #include "gdbsupport/gdb_string_view.h"
 #include "gdbsupport/pathstuff.h"
 #include "gdbsupport/common-utils.h"
+#include <unordered_map>
+#if CXX_STD_THREAD
+#include <mutex>
+#include "perf-counter.h"
+#endif
+#include <atomic>
+#include "gdbsupport/parallel-for.h"
 
 /* Forward declarations for local functions.  */
 
@@ -135,6 +142,11 @@ static const program_space_key<main_info> main_progspace_key;
    there's no point in allowing a user typo to make gdb consume all memory.  */
 #define MAX_SYMBOL_CACHE_SIZE (1024*1024)
 
+/* The associativity of the symbol cache.  Each entry can live in any
+   of this many slots, so that two hot symbols whose hashes collide do
+   not keep evicting each other.  */
+#define SYMBOL_CACHE_WAYS 2
+
 /* symbol_cache_lookup returns this if a previous lookup failed to find the
    symbol in any objfile.  */
 #define SYMBOL_LOOKUP_FAILED \
@@ -209,6 +221,11 @@ struct block_symbol_cache
      on which to decide.  */
   unsigned int size;
 
+  /* The number of slots in each set.  This is SYMBOL_CACHE_WAYS,
+     unless SIZE is too small for that.  The slots of a set are
+     adjacent, and kept ordered from most to least recently used.  */
+  unsigned int ways;
+
   struct symbol_cache_slot symbols[1];
 };
 
@@ -253,6 +270,24 @@ struct symbol_cache
 
 static const program_space_key<symbol_cache> symbol_cache_key;
 
+/* The results of basic_lookup_transparent_type, keyed by type name.
+   A null type records that no definition was found.  check_typedef
+   looks up the definition of an opaque type every time it sees one
+   whose definition is missing or lives in another objfile, and each
+   lookup walks every compunit of every objfile, so remembering the
+   answers matters.  The cache is cleared along with the symbol
+   cache.  */
+
+struct transparent_type_cache
+{
+  std::unordered_map<std::string, struct type *> types;
+};
+
+/* Program space key for finding its transparent type cache.  */
+
+static const program_space_key<transparent_type_cache>
+  transparent_type_cache_key;
+
 /* When non-zero, print debugging messages related to symtab creation.  */
 unsigned int symtab_create_debug = 0;
 
@@ -804,48 +839,39 @@ struct demangled_name_entry
   gdb::unique_xmalloc_ptr<char> demangled;
 };
 
-/* Hash function for the demangled name hash.  */
+/* See objfiles.h.  */
 
-static hashval_t
-hash_demangled_name_entry (const void *data)
+hashval_t
+demangled_name_traits::hash (demangled_name_entry *const &entry)
 {
-  const struct demangled_name_entry *e
-    = (const struct demangled_name_entry *) data;
-
-  return fast_hash (e->mangled.data (), e->mangled.length ());
+  return fast_hash (entry->mangled.data (), entry->mangled.length ());
 }
 
-/* Equality function for the demangled name hash.  */
+/* See objfiles.h.  */
 
-static int
-eq_demangled_name_entry (const void *a, const void *b)
+bool
+demangled_name_traits::equal (demangled_name_entry *const &entry,
+			      gdb::string_view mangled)
 {
-  const struct demangled_name_entry *da
-    = (const struct demangled_name_entry *) a;
-  const struct demangled_name_entry *db
-    = (const struct demangled_name_entry *) b;
-
-  return da->mangled == db->mangled;
+  return entry->mangled == mangled;
 }
 
-static void
-free_demangled_name_entry (void *data)
-{
-  struct demangled_name_entry *e
-    = (struct demangled_name_entry *) data;
+/* See objfiles.h.  */
 
-  e->~demangled_name_entry();
+void
+demangled_name_traits::remove (demangled_name_entry *&entry)
+{
+  /* The entry itself lives on the storage obstack.  */
+  entry->~demangled_name_entry ();
 }
 
-/* Create the hash table used for demangled names.  Each hash entry is
-   a pair of strings; one for the mangled name and one for the demangled
-   name.  The entry is hashed via just the mangled name.  */
+/* Size the hash table used for demangled names before its first use.
+   The entries are hashed via just the mangled name.  */
 
 static void
 create_demangled_names_hash (struct objfile_per_bfd_storage *per_bfd)
 {
   /* Choose 256 as the starting size of the hash table, somewhat arbitrarily.
-     The hash table code will round this up to the next prime number.
      Choosing a much larger table size wastes memory, and saves only about
      1% in symbol reading.  However, if the minsym count is already
      initialized (e.g. because symbol name setting was deferred to
@@ -853,50 +879,148 @@ create_demangled_names_hash (struct objfile_per_bfd_storage *per_bfd)
      based on that, because we will almost certainly have at least that
      many entries.  If we have a nonzero number but less than 256,
      we still stay with 256 to have some space for psymbols, etc.  */
+  per_bfd->demangled_names_hash.reserve
+    (std::max (per_bfd->minimal_symbol_count, 256));
+}
 
-  /* htab will expand the table when it is 3/4th full, so we account for that
-     here.  +2 to round up.  */
-  int minsym_based_count = (per_bfd->minimal_symbol_count + 2) / 3 * 4;
-  int count = std::max (per_bfd->minimal_symbol_count, minsym_based_count);
+/* A process-wide cache of the results of symbol_find_demangled_name.
+   The same mangled names often appear in many objfiles -- template
+   instances and inline functions are emitted in every shared library
+   that uses them -- and demangling them is expensive.  The cache is
+   split into shards, each with its own lock, so that the threads that
+   demangle minimal symbols in parallel rarely contend.  */
+
+struct demangle_cache_result
+{
+  /* The language that was found for the name.  */
+  enum language lang;
+  /* The demangled name, or empty if it did not demangle.  */
+  std::string demangled;
+  bool has_demangled;
+};
 
-  per_bfd->demangled_names_hash.reset (htab_create_alloc
-    (count, hash_demangled_name_entry, eq_demangled_name_entry,
-     free_demangled_name_entry, xcalloc, xfree));
+struct demangle_cache_shard
+{
+#if CXX_STD_THREAD
+  std::mutex lock;
+#endif
+  std::unordered_map<std::string, demangle_cache_result> map;
+};
+
+/* The number of shards of the demangle cache.  */
+#define DEMANGLE_CACHE_SHARDS 16
+
+/* When a shard holds more entries than this, it is emptied, so that
+   the cache cannot grow without bound as objfiles come and go.  */
+#define DEMANGLE_CACHE_SHARD_LIMIT 32768
+
+static demangle_cache_shard demangle_cache[DEMANGLE_CACHE_SHARDS];
+
+/* Return the key used in the demangle cache for MANGLED, when the
+   symbol's language is LANG.  The demangling style is also part of
+   the key, as it affects the result.  */
+
+static std::string
+demangle_cache_key (enum language lang, const char *mangled)
+{
+  std::string key;
+  key += (char) lang;
+  key += (char) current_demangling_style;
+  key += mangled;
+  return key;
 }
 
-/* See symtab.h  */
+/* The part of symbol_find_demangled_name that does the demangling.
+   Return the demangled name, if any, and set *LANG to the language
+   that was found, which is unchanged if LANG was not
+   language_auto.  */
 
-gdb::unique_xmalloc_ptr<char>
-symbol_find_demangled_name (struct general_symbol_info *gsymbol,
-			    const char *mangled)
+static gdb::unique_xmalloc_ptr<char>
+symbol_find_demangled_name_1 (enum language *lang, const char *mangled)
 {
   gdb::unique_xmalloc_ptr<char> demangled;
-  int i;
 
-  if (gsymbol->language () == language_unknown)
-    gsymbol->m_language = language_auto;
-
-  if (gsymbol->language () != language_auto)
+  if (*lang != language_auto)
     {
-      const struct language_defn *lang = language_def (gsymbol->language ());
-
-      lang->sniff_from_mangled_name (mangled, &demangled);
+      language_def (*lang)->sniff_from_mangled_name (mangled, &demangled);
       return demangled;
     }
 
-  for (i = language_unknown; i < nr_languages; ++i)
+  for (int i = language_unknown; i < nr_languages; ++i)
     {
       enum language l = (enum language) i;
-      const struct language_defn *lang = language_def (l);
+      const struct language_defn *langdef = language_def (l);
 
-      if (lang->sniff_from_mangled_name (mangled, &demangled))
+      if (langdef->sniff_from_mangled_name (mangled, &demangled))
 	{
-	  gsymbol->m_language = l;
+	  *lang = l;
 	  return demangled;
 	}
     }
 
-  return NULL;
+  return nullptr;
+}
+
+/* See symtab.h  */
+
+gdb::unique_xmalloc_ptr<char>
+symbol_find_demangled_name (struct general_symbol_info *gsymbol,
+			    const char *mangled)
+{
+  if (gsymbol->language () == language_unknown)
+    gsymbol->m_language = language_auto;
+
+  enum language lang = gsymbol->language ();
+
+  /* Names that no compiler mangles into are cheap to reject, so they
+     are not worth a trip through the cache.  */
+  if (mangled[0] != '_')
+    {
+      gdb::unique_xmalloc_ptr<char> demangled
+	= symbol_find_demangled_name_1 (&lang, mangled);
+      gsymbol->m_language = lang;
+      return demangled;
+    }
+
+  std::string key = demangle_cache_key (lang, mangled);
+  demangle_cache_shard &shard
+    = demangle_cache[std::hash<std::string> () (key) % DEMANGLE_CACHE_SHARDS];
+
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (shard.lock);
+#endif
+    auto iter = shard.map.find (key);
+    if (iter != shard.map.end ())
+      {
+	gsymbol->m_language = iter->second.lang;
+	if (!iter->second.has_demangled)
+	  return nullptr;
+	return make_unique_xstrdup (iter->second.demangled.c_str ());
+      }
+  }
+
+  /* Demangle without holding the lock.  */
+  gdb::unique_xmalloc_ptr<char> demangled
+    = symbol_find_demangled_name_1 (&lang, mangled);
+  gsymbol->m_language = lang;
+
+  demangle_cache_result result;
+  result.lang = lang;
+  result.has_demangled = demangled != nullptr;
+  if (demangled != nullptr)
+    result.demangled = demangled.get ();
+
+  {
+#if CXX_STD_THREAD
+    std::lock_guard<std::mutex> guard (shard.lock);
+#endif
+    if (shard.map.size () >= DEMANGLE_CACHE_SHARD_LIMIT)
+      shard.map.clear ();
+    shard.map.emplace (std::move (key), std::move (result));
+  }
+
+  return demangled;
 }
 
 /* Set both the mangled and demangled (if any) names for GSYMBOL based
@@ -916,7 +1040,7 @@ general_symbol_info::compute_and_set_names (gdb::string_view linkage_name,
 					    objfile_per_bfd_storage *per_bfd,
 					    gdb::optional<hashval_t> hash)
 {
-  struct demangled_name_entry **slot;
+  demangled_name_entry **slot;
 
   if (language () == language_ada)
     {
@@ -933,15 +1057,12 @@ general_symbol_info::compute_and_set_names (gdb::string_view linkage_name,
       return;
     }
 
-  if (per_bfd->demangled_names_hash == NULL)
+  if (per_bfd->demangled_names_hash.empty ())
     create_demangled_names_hash (per_bfd);
 
-  struct demangled_name_entry entry (linkage_name);
   if (!hash.has_value ())
-    hash = hash_demangled_name_entry (&entry);
-  slot = ((struct demangled_name_entry **)
-	  htab_find_slot_with_hash (per_bfd->demangled_names_hash.get (),
-				    &entry, *hash, INSERT));
+    hash = fast_hash (linkage_name.data (), linkage_name.length ());
+  slot = &per_bfd->demangled_names_hash.find_or_insert (linkage_name, *hash);
 
   /* The const_cast is safe because the only reason it is already
      initialized is if we purposefully set it from a background
@@ -1331,6 +1452,11 @@ resize_symbol_cache (struct symbol_cache *cache, unsigned int new_size)
 	= (struct block_symbol_cache *) xcalloc (1, total_size);
       cache->global_symbols->size = new_size;
       cache->static_symbols->size = new_size;
+
+      unsigned int ways = (new_size >= SYMBOL_CACHE_WAYS
+			   ? SYMBOL_CACHE_WAYS : 1);
+      cache->global_symbols->ways = ways;
+      cache->static_symbols->ways = ways;
     }
 }
 
@@ -1391,8 +1517,9 @@ set_symbol_cache_size_handler (const char *args, int from_tty,
    The result is the symbol if found, SYMBOL_LOOKUP_FAILED if a previous lookup
    failed (and thus this one will too), or NULL if the symbol is not present
    in the cache.
-   *BSC_PTR and *SLOT_PTR are set to the cache and slot of the symbol, which
-   can be used to save the result of a full lookup attempt.  */
+   *BSC_PTR and *SLOT_PTR are set to the cache and the first slot of the
+   set of the symbol, which can be used to save the result of a full
+   lookup attempt.  */
 
 static struct block_symbol
 symbol_cache_lookup (struct symbol_cache *cache,
@@ -1417,13 +1544,22 @@ symbol_cache_lookup (struct symbol_cache *cache,
     }
 
   hash = hash_symbol_entry (objfile_context, name, domain);
-  slot = bsc->symbols + hash % bsc->size;
+  slot = bsc->symbols + (hash % (bsc->size / bsc->ways)) * bsc->ways;
 
   *bsc_ptr = bsc;
   *slot_ptr = slot;
 
-  if (eq_symbol_entry (slot, objfile_context, name, domain))
+  unsigned int way;
+  for (way = 0; way < bsc->ways; ++way)
+    if (eq_symbol_entry (&slot[way], objfile_context, name, domain))
+      break;
+
+  if (way < bsc->ways)
     {
+      /* Move the entry to the front of its set.  */
+      if (way > 0)
+	std::swap (slot[0], slot[way]);
+
       if (symbol_lookup_debug)
 	gdb_printf (gdb_stdlog,
 		    "%s block symbol cache hit%s for %s, %s\n",
@@ -1455,6 +1591,29 @@ symbol_cache_lookup (struct symbol_cache *cache,
    if it's not needed to distinguish lookups (STATIC_BLOCK).  It is *not*
    necessarily the objfile the symbol was found in.  */
 
+/* Make room for a new entry at the front of the set of BSC that starts
+   at SLOT, evicting the least recently used entry if the set is full.
+   Return the slot to fill in.  */
+
+static struct symbol_cache_slot *
+symbol_cache_make_room (struct block_symbol_cache *bsc,
+			struct symbol_cache_slot *slot)
+{
+  struct symbol_cache_slot *last = &slot[bsc->ways - 1];
+
+  if (last->state != SYMBOL_SLOT_UNUSED)
+    {
+      ++bsc->collisions;
+      symbol_cache_clear_slot (last);
+    }
+
+  for (; last > slot; --last)
+    *last = last[-1];
+  slot->state = SYMBOL_SLOT_UNUSED;
+
+  return slot;
+}
+
 static void
 symbol_cache_mark_found (struct block_symbol_cache *bsc,
 			 struct symbol_cache_slot *slot,
@@ -1464,11 +1623,7 @@ symbol_cache_mark_found (struct block_symbol_cache *bsc,
 {
   if (bsc == NULL)
     return;
-  if (slot->state != SYMBOL_SLOT_UNUSED)
-    {
-      ++bsc->collisions;
-      symbol_cache_clear_slot (slot);
-    }
+  slot = symbol_cache_make_room (bsc, slot);
   slot->state = SYMBOL_SLOT_FOUND;
   slot->objfile_context = objfile_context;
   slot->value.found.symbol = symbol;
@@ -1487,11 +1642,7 @@ symbol_cache_mark_not_found (struct block_symbol_cache *bsc,
 {
   if (bsc == NULL)
     return;
-  if (slot->state != SYMBOL_SLOT_UNUSED)
-    {
-      ++bsc->collisions;
-      symbol_cache_clear_slot (slot);
-    }
+  slot = symbol_cache_make_room (bsc, slot);
   slot->state = SYMBOL_SLOT_NOT_FOUND;
   slot->objfile_context = objfile_context;
   slot->value.not_found.name = xstrdup (name);
@@ -1506,6 +1657,8 @@ symbol_cache_flush (struct program_space *pspace)
   struct symbol_cache *cache = symbol_cache_key.get (pspace);
   int pass;
 
+  transparent_type_cache_key.clear (pspace);
+
   if (cache == NULL)
     return;
   if (cache->global_symbols == NULL)
@@ -1660,6 +1813,7 @@ symbol_cache_stats (struct symbol_cache *cache)
 	gdb_printf ("Static block cache stats:\n");
 
       gdb_printf ("  size:       %u\n", bsc->size);
+      gdb_printf ("  ways:       %u\n", bsc->ways);
       gdb_printf ("  hits:       %u\n", bsc->hits);
       gdb_printf ("  misses:     %u\n", bsc->misses);
       gdb_printf ("  collisions: %u\n", bsc->collisions);
@@ -1690,6 +1844,8 @@ maintenance_print_symbol_cache_statistics (const char *args, int from_tty)
     }
 }
 
+static void reset_completion_candidates ();
+
 /* This module's 'new_objfile' observer.  */
 
 static void
@@ -1697,6 +1853,7 @@ symtab_new_objfile_observer (struct objfile *objfile)
 {
   /* Ideally we'd use OBJFILE->pspace, but OBJFILE may be NULL.  */
   symbol_cache_flush (current_program_space);
+  reset_completion_candidates ();
 }
 
 /* This module's 'free_objfile' observer.  */
@@ -1705,6 +1862,7 @@ static void
 symtab_free_objfile_observer (struct objfile *objfile)
 {
   symbol_cache_flush (objfile->pspace);
+  reset_completion_candidates ();
 }
 
 /* Debug symbols usually don't have section information.  We need to dig that
@@ -1939,6 +2097,15 @@ search_name_hash (enum language language, const char *search_name)
   return language_def (language)->search_name_hash (search_name);
 }
 
+/* Symbol lookups by name, and the time they took.  */
+
+static perf_counter symbol_lookups_counter
+  ("symbol-lookups", perf_counter_unit::count,
+   N_("Symbol lookups by name."));
+static perf_counter symbol_lookup_time_counter
+  ("symbol-lookup-time", perf_counter_unit::nanoseconds,
+   N_("Time spent looking up symbols by name."));
+
 /* See symtab.h.
 
    This function (or rather its subordinates) have a bunch of loops and
@@ -1956,6 +2123,9 @@ lookup_symbol_in_language (const char *name, const struct block *block,
 			   const domain_enum domain, enum language lang,
 			   struct field_of_this_result *is_a_field_of_this)
 {
+  symbol_lookups_counter.add ();
+  scoped_perf_timer timer (&symbol_lookup_time_counter);
+
   demangle_result_storage storage;
   const char *modified_name = demangle_for_lookup (name, lang, storage);
 
@@ -2805,14 +2975,14 @@ basic_lookup_transparent_type_1 (struct objfile *objfile,
   return NULL;
 }
 
-/* The standard implementation of lookup_transparent_type.  This code
+/* The search done by basic_lookup_transparent_type.  This code
    was modeled on lookup_symbol -- the parts not relevant to looking
    up types were just left out.  In particular it's assumed here that
    types are available in STRUCT_DOMAIN and only in file-static or
    global blocks.  */
 
-struct type *
-basic_lookup_transparent_type (const char *name)
+static struct type *
+basic_lookup_transparent_type_uncached (const char *name)
 {
   struct type *t;
 
@@ -2861,6 +3031,30 @@ basic_lookup_transparent_type (const char *name)
 
 /* See symtab.h.  */
 
+struct type *
+basic_lookup_transparent_type (const char *name)
+{
+  transparent_type_cache *cache
+    = transparent_type_cache_key.get (current_program_space);
+  if (cache != nullptr)
+    {
+      auto iter = cache->types.find (name);
+      if (iter != cache->types.end ())
+	return iter->second;
+    }
+
+  struct type *t = basic_lookup_transparent_type_uncached (name);
+
+  /* Look the cache up again, since reading symbols can flush it.  */
+  cache = transparent_type_cache_key.get (current_program_space);
+  if (cache == nullptr)
+    cache = transparent_type_cache_key.emplace (current_program_space);
+  cache->types.emplace (name, t);
+  return t;
+}
+
+/* See symtab.h.  */
+
 bool
 iterate_over_symbols (const struct block *block,
 		      const lookup_name_info &name,
@@ -2934,6 +3128,9 @@ find_pc_sect_compunit_symtab (CORE_ADDR pc, struct obj_section *section)
 
   for (objfile *obj_file : current_program_space->objfiles ())
     {
+      if (!obj_file->compunits_may_contain_pc (pc))
+	continue;
+
       for (compunit_symtab *cust : obj_file->compunits ())
 	{
 	  const struct blockvector *bv = cust->blockvector ();
@@ -4724,11 +4921,112 @@ global_symbol_searcher::is_suitable_msymbol
     }
 }
 
+/* A symbol name regexp that can be matched from several threads at
+   once.  A compiled pattern can't safely be shared between threads, so
+   each thread compiles its own copy the first time it matches against
+   a given search_regex.  */
+
+class search_regex
+{
+public:
+  search_regex (const char *regex, int cflags)
+    : m_regex (regex),
+      m_cflags (cflags),
+      m_id (++next_id)
+  {
+    /* Compile the main thread's copy now, so that an invalid regexp
+       is reported here rather than from a worker thread.  */
+    get ();
+  }
+
+  DISABLE_COPY_AND_ASSIGN (search_regex);
+
+  /* Return true if NAME matches.  */
+  bool exec (const char *name) const
+  {
+    return get ().exec (name, 0, NULL, 0) == 0;
+  }
+
+private:
+
+  /* Return the calling thread's copy of the pattern.  */
+  const compiled_regex &get () const
+  {
+    struct cached_regex
+    {
+      unsigned int id = 0;
+      gdb::optional<compiled_regex> regex;
+    };
+    static thread_local cached_regex cache;
+
+    if (cache.id != m_id)
+      {
+	cache.regex.reset ();
+	cache.regex.emplace (m_regex.c_str (), m_cflags,
+			     _("Invalid regexp"));
+	cache.id = m_id;
+      }
+    return *cache.regex;
+  }
+
+  std::string m_regex;
+  int m_cflags;
+
+  /* Identifies this object in the per-thread caches.  */
+  unsigned int m_id;
+
+  static std::atomic<unsigned int> next_id;
+};
+
+std::atomic<unsigned int> search_regex::next_id;
+
+/* See symtab.h.  */
+
+std::vector<minimal_symbol *>
+global_symbol_searcher::matching_msymbols (objfile *objfile,
+					   const search_regex *preg) const
+{
+  enum search_domain kind = m_kind;
+  minimal_symbol *msymbols = objfile->per_bfd->msymbols.get ();
+  int count = objfile->per_bfd->minimal_symbol_count;
+
+  using msym_vector = std::vector<minimal_symbol *>;
+  std::vector<msym_vector> results
+    = gdb::parallel_for_each (1000, msymbols, msymbols + count,
+			      [&] (minimal_symbol *iter, minimal_symbol *end)
+      {
+	msym_vector result;
+	for (; iter < end; ++iter)
+	  {
+	    if (iter->created_by_gdb || !is_suitable_msymbol (kind, iter))
+	      continue;
+
+	    /* Ada names are decoded lazily, which isn't safe to do
+	       here; those are matched below.  */
+	    if (preg == nullptr
+		|| iter->language () == language_ada
+		|| preg->exec (iter->natural_name ()))
+	      result.push_back (iter);
+	  }
+	return result;
+      });
+
+  msym_vector matches;
+  for (const msym_vector &result : results)
+    for (minimal_symbol *msymbol : result)
+      if (preg == nullptr
+	  || msymbol->language () != language_ada
+	  || preg->exec (msymbol->natural_name ()))
+	matches.push_back (msymbol);
+
+  return matches;
+}
+
 /* See symtab.h.  */
 
 bool
 global_symbol_searcher::expand_symtabs
-	(objfile *objfile, const gdb::optional<compiled_regex> &preg) const
+	(objfile *objfile, const search_regex *preg) const
 {
   enum search_domain kind = m_kind;
   bool found_msymbol = false;
@@ -4746,11 +5044,10 @@ global_symbol_searcher::expand_symtabs
      &lookup_name_info::match_any (),
      [&] (const char *symname)
      {
-       return (!preg.has_value ()
-	       || preg->exec (symname, 0, NULL, 0) == 0);
+       return preg == nullptr || preg->exec (symname);
      },
      NULL,
-     SEARCH_GLOBAL_BLOCK | SEARCH_STATIC_BLOCK,
+     SEARCH_GLOBAL_BLOCK | SEARCH_STATIC_BLOCK | SEARCH_PARALLEL_MATCHER,
      UNDEF_DOMAIN,
      kind);
 
@@ -4771,34 +5068,23 @@ global_symbol_searcher::expand_symtabs
   if (filenames.empty ()
       && (kind == VARIABLES_DOMAIN || kind == FUNCTIONS_DOMAIN))
     {
-      for (minimal_symbol *msymbol : objfile->msymbols ())
+      for (minimal_symbol *msymbol : matching_msymbols (objfile, preg))
 	{
 	  QUIT;
 
-	  if (msymbol->created_by_gdb)
-	    continue;
-
-	  if (is_suitable_msymbol (kind, msymbol))
-	    {
-	      if (!preg.has_value ()
-		  || preg->exec (msymbol->natural_name (), 0,
-				 NULL, 0) == 0)
-		{
-		  /* An important side-effect of these lookup functions is
-		     to expand the symbol table if msymbol is found, later
-		     in the process we will add matching symbols or
-		     msymbols to the results list, and that requires that
-		     the symbols tables are expanded.  */
-		  if (kind == FUNCTIONS_DOMAIN
-		      ? (find_pc_compunit_symtab
-			 (msymbol->value_address (objfile)) == NULL)
-		      : (lookup_symbol_in_objfile_from_linkage_name
-			 (objfile, msymbol->linkage_name (),
-			  VAR_DOMAIN)
-			 .symbol == NULL))
-		    found_msymbol = true;
-		}
-	    }
+	  /* An important side-effect of these lookup functions is
+	     to expand the symbol table if msymbol is found, later
+	     in the process we will add matching symbols or
+	     msymbols to the results list, and that requires that
+	     the symbols tables are expanded.  */
+	  if (kind == FUNCTIONS_DOMAIN
+	      ? (find_pc_compunit_symtab
+		 (msymbol->value_address (objfile)) == NULL)
+	      : (lookup_symbol_in_objfile_from_linkage_name
+		 (objfile, msymbol->linkage_name (),
+		  VAR_DOMAIN)
+		 .symbol == NULL))
+	    found_msymbol = true;
 	}
     }
 
@@ -4810,7 +5096,7 @@ global_symbol_searcher::expand_symtabs
 bool
 global_symbol_searcher::add_matching_symbols
 	(objfile *objfile,
-	 const gdb::optional<compiled_regex> &preg,
+	 const search_regex *preg,
 	 const gdb::optional<compiled_regex> &treg,
 	 std::set<symbol_search> *result_set) const
 {
@@ -4842,9 +5128,8 @@ global_symbol_searcher::add_matching_symbols
 					 filenames, true))
 		       && file_matches (symtab_to_fullname (real_symtab),
 					filenames, false)))
-		  && ((!preg.has_value ()
-		       || preg->exec (sym->natural_name (), 0,
-				      NULL, 0) == 0)
+		  && ((preg == nullptr
+		       || preg->exec (sym->natural_name ()))
 		      && ((kind == VARIABLES_DOMAIN
 			   && sym->aclass () != LOC_TYPEDEF
 			   && sym->aclass () != LOC_UNRESOLVED
@@ -4891,41 +5176,30 @@ global_symbol_searcher::add_matching_symbols
 
 bool
 global_symbol_searcher::add_matching_msymbols
-	(objfile *objfile, const gdb::optional<compiled_regex> &preg,
+	(objfile *objfile, const search_regex *preg,
 	 std::vector<symbol_search> *results) const
 {
   enum search_domain kind = m_kind;
 
-  for (minimal_symbol *msymbol : objfile->msymbols ())
+  for (minimal_symbol *msymbol : matching_msymbols (objfile, preg))
     {
       QUIT;
 
-      if (msymbol->created_by_gdb)
-	continue;
-
-      if (is_suitable_msymbol (kind, msymbol))
+      /* For functions we can do a quick check of whether the
+	 symbol might be found via find_pc_symtab.  */
+      if (kind != FUNCTIONS_DOMAIN
+	  || (find_pc_compunit_symtab
+	      (msymbol->value_address (objfile)) == NULL))
 	{
-	  if (!preg.has_value ()
-	      || preg->exec (msymbol->natural_name (), 0,
-			     NULL, 0) == 0)
+	  if (lookup_symbol_in_objfile_from_linkage_name
+	      (objfile, msymbol->linkage_name (),
+	       VAR_DOMAIN).symbol == NULL)
 	    {
-	      /* For functions we can do a quick check of whether the
-		 symbol might be found via find_pc_symtab.  */
-	      if (kind != FUNCTIONS_DOMAIN
-		  || (find_pc_compunit_symtab
-		      (msymbol->value_address (objfile)) == NULL))
-		{
-		  if (lookup_symbol_in_objfile_from_linkage_name
-		      (objfile, msymbol->linkage_name (),
-		       VAR_DOMAIN).symbol == NULL)
-		    {
-		      /* Matching msymbol, add it to the results list.  */
-		      if (results->size () < m_max_search_results)
-			results->emplace_back (GLOBAL_BLOCK, msymbol, objfile);
-		      else
-			return false;
-		    }
-		}
+	      /* Matching msymbol, add it to the results list.  */
+	      if (results->size () < m_max_search_results)
+		results->emplace_back (GLOBAL_BLOCK, msymbol, objfile);
+	      else
+		return false;
 	    }
 	}
     }
@@ -4938,7 +5212,7 @@ global_symbol_searcher::add_matching_msymbols
 std::vector<symbol_search>
 global_symbol_searcher::search () const
 {
-  gdb::optional<compiled_regex> preg;
+  gdb::optional<search_regex> preg;
   gdb::optional<compiled_regex> treg;
 
   gdb_assert (m_kind != ALL_DOMAIN);
@@ -4983,8 +5257,7 @@ global_symbol_searcher::search () const
 
       int cflags = REG_NOSUB | (case_sensitivity == case_sensitive_off
 				? REG_ICASE : 0);
-      preg.emplace (symbol_name_regexp, cflags,
-		    _("Invalid regexp"));
+      preg.emplace (symbol_name_regexp, cflags);
     }
 
   if (m_symbol_type_regexp != NULL)
@@ -4995,19 +5268,20 @@ global_symbol_searcher::search () const
 		    _("Invalid regexp"));
     }
 
+  const search_regex *name_regex = preg.has_value () ? &*preg : nullptr;
   bool found_msymbol = false;
   std::set<symbol_search> result_set;
   for (objfile *objfile : current_program_space->objfiles ())
     {
       /* Expand symtabs within objfile that possibly contain matching
 	 symbols.  */
-      found_msymbol |= expand_symtabs (objfile, preg);
+      found_msymbol |= expand_symtabs (objfile, name_regex);
 
       /* Find matching symbols within OBJFILE and add them in to the
 	 RESULT_SET set.  Use a set here so that we can easily detect
 	 duplicates as we go, and can therefore track how many unique
 	 matches we have found so far.  */
-      if (!add_matching_symbols (objfile, preg, treg, &result_set))
+      if (!add_matching_symbols (objfile, name_regex, treg, &result_set))
 	break;
     }
 
@@ -5025,7 +5299,7 @@ global_symbol_searcher::search () const
     {
       gdb_assert (m_kind == VARIABLES_DOMAIN || m_kind == FUNCTIONS_DOMAIN);
       for (objfile *objfile : current_program_space->objfiles ())
-	if (!add_matching_msymbols (objfile, preg, &result))
+	if (!add_matching_msymbols (objfile, name_regex, &result))
 	  break;
     }
 
@@ -5520,9 +5794,10 @@ completion_list_add_name (completion_tracker &tracker,
   return true;
 }
 
-/* completion_list_add_name wrapper for struct symbol.  */
+/* completion_list_add_name wrapper for struct symbol.  Return true if
+   SYM matched.  */
 
-static void
+static bool
 completion_list_add_symbol (completion_tracker &tracker,
 			    symbol *sym,
 			    const lookup_name_info &lookup_name,
@@ -5531,7 +5806,7 @@ completion_list_add_symbol (completion_tracker &tracker,
   if (!completion_list_add_name (tracker, sym->language (),
 				 sym->natural_name (),
 				 lookup_name, text, word))
-    return;
+    return false;
 
   /* C++ function symbols include the parameters within both the msymbol
      name and the symbol name.  The problem is that the msymbol name will
@@ -5553,26 +5828,30 @@ completion_list_add_symbol (completion_tracker &tracker,
       if (str != nullptr)
 	tracker.remove_completion (str.get ());
     }
+
+  return true;
 }
 
-/* completion_list_add_name wrapper for struct minimal_symbol.  */
+/* completion_list_add_name wrapper for struct minimal_symbol.  Return
+   true if SYM matched.  */
 
-static void
+static bool
 completion_list_add_msymbol (completion_tracker &tracker,
 			     minimal_symbol *sym,
 			     const lookup_name_info &lookup_name,
 			     const char *text, const char *word)
 {
-  completion_list_add_name (tracker, sym->language (),
-			    sym->natural_name (),
-			    lookup_name, text, word);
+  return completion_list_add_name (tracker, sym->language (),
+				   sym->natural_name (),
+				   lookup_name, text, word);
 }
 
 
 /* ObjC: In case we are completing on a selector, look as the msymbol
-   again and feed all the selectors into the mill.  */
+   again and feed all the selectors into the mill.  Return true if
+   any of the selectors matched.  */
 
-static void
+static bool
 completion_list_objc_symbol (completion_tracker &tracker,
 			     struct minimal_symbol *msymbol,
 			     const lookup_name_info &lookup_name,
@@ -5583,19 +5862,20 @@ completion_list_objc_symbol (completion_tracker &tracker,
 
   const char *method, *category, *selector;
   char *tmp2 = NULL;
+  bool matched = false;
 
   method = msymbol->natural_name ();
 
   /* Is it a method?  */
   if ((method[0] != '-') && (method[0] != '+'))
-    return;
+    return false;
 
   if (text[0] == '[')
     /* Complete on shortened method method.  */
-    completion_list_add_name (tracker, language_objc,
-			      method + 1,
-			      lookup_name,
-			      text, word);
+    matched |= completion_list_add_name (tracker, language_objc,
+					 method + 1,
+					 lookup_name,
+					 text, word);
 
   while ((strlen (method) + 1) >= tmplen)
     {
@@ -5616,11 +5896,11 @@ completion_list_objc_symbol (completion_tracker &tracker,
       memcpy (tmp, method, (category - method));
       tmp[category - method] = ' ';
       memcpy (tmp + (category - method) + 1, selector, strlen (selector) + 1);
-      completion_list_add_name (tracker, language_objc, tmp,
-				lookup_name, text, word);
+      matched |= completion_list_add_name (tracker, language_objc, tmp,
+					   lookup_name, text, word);
       if (text[0] == '[')
-	completion_list_add_name (tracker, language_objc, tmp + 1,
-				  lookup_name, text, word);
+	matched |= completion_list_add_name (tracker, language_objc, tmp + 1,
+					     lookup_name, text, word);
     }
 
   if (selector != NULL)
@@ -5631,9 +5911,11 @@ completion_list_objc_symbol (completion_tracker &tracker,
       if (tmp2 != NULL)
 	*tmp2 = '\0';
 
-      completion_list_add_name (tracker, language_objc, tmp,
-				lookup_name, text, word);
+      matched |= completion_list_add_name (tracker, language_objc, tmp,
+					   lookup_name, text, word);
     }
+
+  return matched;
 }
 
 /* Break the non-quoted text based on the characters which are in
@@ -5777,7 +6059,9 @@ find_gnu_ifunc (const symbol *sym)
   return {};
 }
 
-/* Add matching symbols from SYMTAB to the current completion list.  */
+/* Add matching symbols from SYMTAB to the current completion list.
+   If MATCHES is not NULL, the symbols that matched are also appended
+   to it.  */
 
 static void
 add_symtab_completions (struct compunit_symtab *cust,
@@ -5785,7 +6069,8 @@ add_symtab_completions (struct compunit_symtab *cust,
 			complete_symbol_mode mode,
 			const lookup_name_info &lookup_name,
 			const char *text, const char *word,
-			enum type_code code)
+			enum type_code code,
+			std::vector<symbol *> *matches = nullptr)
 {
   struct symbol *sym;
   struct block_iterator iter;
@@ -5804,16 +6089,113 @@ add_symtab_completions (struct compunit_symtab *cust,
 	  if (completion_skip_symbol (mode, sym))
 	    continue;
 
-	  if (code == TYPE_CODE_UNDEF
-	      || (sym->domain () == STRUCT_DOMAIN
-		  && sym->type ()->code () == code))
-	    completion_list_add_symbol (tracker, sym,
-					lookup_name,
-					text, word);
+	  if ((code == TYPE_CODE_UNDEF
+	       || (sym->domain () == STRUCT_DOMAIN
+		   && sym->type ()->code () == code))
+	      && completion_list_add_symbol (tracker, sym,
+					     lookup_name,
+					     text, word)
+	      && matches != nullptr)
+	    matches->push_back (sym);
 	}
     }
 }
 
+/* The state of an objfile when a set of completion candidates was
+   computed.  If any of this changed, the candidates can't be
+   reused.  */
+
+struct completion_objfile_state
+{
+  struct objfile *objfile;
+
+  /* The objfile's minimal symbols.  */
+  const minimal_symbol *msymbols;
+  int msymbol_count;
+
+  /* The first compunit_symtab of the objfile.  New compunits are
+     added to the front of the list, so the ones appearing before this
+     one were expanded later on.  */
+  compunit_symtab *first_compunit;
+};
+
+/* The minimal symbols and symbols that matched the last symbol
+   completion.  When the user extends the word being completed, the
+   new matches can only be found among these, so that we don't have
+   to go through all the symbols again on every TAB.  */
+
+struct completion_candidates
+{
+  /* Whether this holds the result of a completion.  */
+  bool valid = false;
+
+  /* The parameters of the completion.  */
+  std::string sym_text;
+  complete_symbol_mode mode = complete_symbol_mode::EXPRESSION;
+  symbol_name_match_type name_match_type = symbol_name_match_type::WILD;
+  enum type_code code = TYPE_CODE_UNDEF;
+  enum case_sensitivity case_sensitivity = case_sensitive_on;
+  struct program_space *pspace = nullptr;
+
+  /* The state of the program space's objfiles, in order.  */
+  std::vector<completion_objfile_state> objfiles;
+
+  /* The matches themselves.  */
+  std::vector<minimal_symbol *> msymbols;
+  std::vector<symbol *> symbols;
+};
+
+/* The candidates of the last symbol completion.  */
+
+static completion_candidates last_completion_candidates;
+
+/* Forget about the candidates of the last completion.  */
+
+static void
+reset_completion_candidates ()
+{
+  last_completion_candidates = {};
+}
+
+/* Return true if the matches recorded in PREV are a superset of the
+   matches of the completion described by CUR -- that is, if CUR
+   completes a longer word than PREV, in the same conditions.  The
+   symbol name matchers used in completion mode all match on a prefix
+   of the lookup name, so any symbol matching the longer word also
+   matched the shorter one.  */
+
+static bool
+completion_candidates_narrow_p (const completion_candidates &prev,
+				const completion_candidates &cur)
+{
+  /* An empty word matches everything and is special-cased by the
+     Objective-C code, so don't bother.  */
+  if (!prev.valid
+      || prev.sym_text.empty ()
+      || !startswith (cur.sym_text.c_str (), prev.sym_text.c_str ())
+      || prev.mode != cur.mode
+      || prev.name_match_type != cur.name_match_type
+      || prev.code != cur.code
+      || prev.case_sensitivity != cur.case_sensitivity
+      || prev.pspace != cur.pspace)
+    return false;
+
+  size_t i = 0;
+  for (objfile *objfile : cur.pspace->objfiles ())
+    {
+      if (i == prev.objfiles.size ())
+	return false;
+
+      const completion_objfile_state &state = prev.objfiles[i++];
+      if (state.objfile != objfile
+	  || state.msymbols != objfile->per_bfd->msymbols.get ()
+	  || state.msymbol_count != objfile->per_bfd->minimal_symbol_count)
+	return false;
+    }
+
+  return i == prev.objfiles.size ();
+}
+
 void
 default_collect_symbol_completion_matches_break_on
   (completion_tracker &tracker, complete_symbol_mode mode,
@@ -5888,6 +6270,19 @@ default_collect_symbol_completion_matches_break_on
 
   lookup_name_info lookup_name (sym_text, name_match_type, true);
 
+  /* If the user just extended the word completed last time, only the
+     symbols that matched then need to be considered.  */
+  completion_candidates candidates;
+  candidates.sym_text = sym_text;
+  candidates.mode = mode;
+  candidates.name_match_type = name_match_type;
+  candidates.code = code;
+  candidates.case_sensitivity = case_sensitivity;
+  candidates.pspace = current_program_space;
+
+  const completion_candidates &prev = last_completion_candidates;
+  bool narrowing = completion_candidates_narrow_p (prev, candidates);
+
   /* At this point scan through the misc symbol vectors and add each
      symbol you find to the list.  Eventually we want to ignore
      anything that isn't a text symbol (everything else will be
@@ -5895,30 +6290,75 @@ default_collect_symbol_completion_matches_break_on
 
   if (code == TYPE_CODE_UNDEF)
     {
-      for (objfile *objfile : current_program_space->objfiles ())
+      auto add_msymbol = [&] (minimal_symbol *msymbol)
 	{
-	  for (minimal_symbol *msymbol : objfile->msymbols ())
-	    {
-	      QUIT;
+	  QUIT;
 
-	      if (completion_skip_symbol (mode, msymbol))
-		continue;
+	  if (completion_skip_symbol (mode, msymbol))
+	    return;
 
-	      completion_list_add_msymbol (tracker, msymbol, lookup_name,
-					   sym_text, word);
+	  bool matched = completion_list_add_msymbol (tracker, msymbol,
+						      lookup_name,
+						      sym_text, word);
 
-	      completion_list_objc_symbol (tracker, msymbol, lookup_name,
-					   sym_text, word);
-	    }
+	  if (completion_list_objc_symbol (tracker, msymbol, lookup_name,
+					   sym_text, word))
+	    matched = true;
+
+	  if (matched)
+	    candidates.msymbols.push_back (msymbol);
+	};
+
+      if (narrowing)
+	{
+	  for (minimal_symbol *msymbol : prev.msymbols)
+	    add_msymbol (msymbol);
+	}
+      else
+	{
+	  for (objfile *objfile : current_program_space->objfiles ())
+	    for (minimal_symbol *msymbol : objfile->msymbols ())
+	      add_msymbol (msymbol);
 	}
     }
 
   /* Add completions for all currently loaded symbol tables.  */
-  for (objfile *objfile : current_program_space->objfiles ())
+  if (narrowing)
+    {
+      for (symbol *candidate : prev.symbols)
+	{
+	  QUIT;
+
+	  if (completion_list_add_symbol (tracker, candidate, lookup_name,
+					  sym_text, word))
+	    candidates.symbols.push_back (candidate);
+	}
+
+      /* Symbol tables expanded since then still have to be searched
+	 in full.  */
+      size_t i = 0;
+      for (objfile *objfile : current_program_space->objfiles ())
+	{
+	  compunit_symtab *first = prev.objfiles[i++].first_compunit;
+	  for (compunit_symtab *cust : objfile->compunits ())
+	    {
+	      if (cust == first)
+		break;
+	      add_symtab_completions (cust, tracker, mode, lookup_name,
+				      sym_text, word, code,
+				      &candidates.symbols);
+	    }
+	}
+    }
+  else
     {
-      for (compunit_symtab *cust : objfile->compunits ())
-	add_symtab_completions (cust, tracker, mode, lookup_name,
-				sym_text, word, code);
+      for (objfile *objfile : current_program_space->objfiles ())
+	{
+	  for (compunit_symtab *cust : objfile->compunits ())
+	    add_symtab_completions (cust, tracker, mode, lookup_name,
+				    sym_text, word, code,
+				    &candidates.symbols);
+	}
     }
 
   /* Look through the partial symtabs for all symbols which begin by
@@ -5930,12 +6370,24 @@ default_collect_symbol_completion_matches_break_on
 			     {
 			       add_symtab_completions (symtab,
 						       tracker, mode, lookup_name,
-						       sym_text, word, code);
+						       sym_text, word, code,
+						       &candidates.symbols);
 			       return true;
 			     },
 			   SEARCH_GLOBAL_BLOCK | SEARCH_STATIC_BLOCK,
 			   ALL_DOMAIN);
 
+  /* All the matching symbols were found, so the candidates can be
+     recorded -- if too many completions were found, we don't get
+     here.  */
+  for (objfile *objfile : current_program_space->objfiles ())
+    candidates.objfiles.push_back ({ objfile,
+				     objfile->per_bfd->msymbols.get (),
+				     objfile->per_bfd->minimal_symbol_count,
+				     objfile->compunit_symtabs });
+  candidates.valid = true;
+  last_completion_candidates = std::move (candidates);
+
   /* Search upwards from currently selected frame (so that we can
      complete on local vars).  Also catch fields of types defined in
      this places which match our text string.  Only complete on types
@@ -584,12 +584,22 @@ struct general_symbol_info
      valid.  */
   unsigned int ada_mangled : 1;
 
+protected:
+
   /* Which section is this symbol in?  This is an index into
      section_offsets for this objfile.  Negative means that the symbol
-     does not get relocated relative to a section.  */
+     does not get relocated relative to a section.
+
+     This is protected, rather than public like the other members, so
+     that general_symbol_info is not a POD for the purpose of layout:
+     that lets derived classes place their first members in its tail
+     padding.  Both symbol and minimal_symbol start with bitfields for
+     that reason, which saves a word in each of them.  */
 
   short m_section;
 
+public:
+
   /* Set the index into the obj_section list (within the containing
      objfile) for the section that contains this symbol.  See M_SECTION
      for more details.  */
@@ -801,15 +811,6 @@ struct minimal_symbol : public general_symbol_info
     m_target_flag_2 = target_flag_2;
   }
 
-  /* Size of this symbol.  dbx_end_psymtab in dbxread.c uses this
-     information to calculate the end of the partial symtab based on the
-     address of the last symbol plus the size of the last symbol.  */
-
-  unsigned long m_size;
-
-  /* Which source file is this symbol in?  Only relevant for mst_file_*.  */
-  const char *filename;
-
   /* Classification type for this minimal symbol.  */
 
   ENUM_BITFIELD(minimal_symbol_type) m_type : MINSYM_TYPE_BITS;
@@ -839,6 +840,15 @@ struct minimal_symbol : public general_symbol_info
      it was set to NULL).  */
   unsigned int name_set : 1;
 
+  /* Size of this symbol.  dbx_end_psymtab in dbxread.c uses this
+     information to calculate the end of the partial symtab based on the
+     address of the last symbol plus the size of the last symbol.  */
+
+  unsigned long m_size;
+
+  /* Which source file is this symbol in?  Only relevant for mst_file_*.  */
+  const char *filename;
+
   /* Minimal symbols with the same hash key are kept on a linked
      list.  This is the link.  */
 
@@ -1207,7 +1217,7 @@ struct symbol : public general_symbol_info, public allocate_on_obstack
       m_artificial (false)
     {
       /* We can't use an initializer list for members of a base class, and
-	 general_symbol_info needs to stay a POD type.  */
+	 general_symbol_info needs to stay a trivial type.  */
       m_name = nullptr;
       m_value.ivalue = 0;
       language_specific.obstack = nullptr;
@@ -1399,24 +1409,6 @@ struct symbol : public general_symbol_info, public allocate_on_obstack
 
   void set_symtab (struct symtab *symtab);
 
-  /* Data type of value */
-
-  struct type *m_type = nullptr;
-
-  /* The owner of this symbol.
-     Which one to use is defined by symbol.is_objfile_owned.  */
-
-  union
-  {
-    /* The symbol table containing this symbol.  This is the file associated
-       with LINE.  It can be NULL during symbols read-in but it is never NULL
-       during normal operation.  */
-    struct symtab *symtab;
-
-    /* For types defined by the architecture.  */
-    struct gdbarch *arch;
-  } owner;
-
   /* Domain code.  */
 
   ENUM_BITFIELD(domain_enum) m_domain : SYMBOL_DOMAIN_BITS;
@@ -1468,6 +1460,24 @@ struct symbol : public general_symbol_info, public allocate_on_obstack
 
   unsigned short m_line = 0;
 
+  /* Data type of value */
+
+  struct type *m_type = nullptr;
+
+  /* The owner of this symbol.
+     Which one to use is defined by symbol.is_objfile_owned.  */
+
+  union
+  {
+    /* The symbol table containing this symbol.  This is the file associated
+       with LINE.  It can be NULL during symbols read-in but it is never NULL
+       during normal operation.  */
+    struct symtab *symtab;
+
+    /* For types defined by the architecture.  */
+    struct gdbarch *arch;
+  } owner;
+
   /* An arbitrary data pointer, allowing symbol readers to record
      additional information on a per-symbol basis.  Note that this data
      must be allocated using the same obstack as the symbol itself.  */
@@ -2201,6 +2211,9 @@ extern void reread_symbols (int from_tty);
 
 extern struct type *lookup_transparent_type (const char *);
 
+/* The standard implementation of lookup_transparent_type.  Results
+   are cached per program space until the set of objfiles changes.  */
+
 extern struct type *basic_lookup_transparent_type (const char *);
 
 /* Macro for name of symbol to indicate a file compiled with gcc.  */
@@ -2445,6 +2458,8 @@ struct symbol_search
 				  const symbol_search &sym_b);
 };
 
+class search_regex;
+
 /* In order to search for global symbols of a particular kind matching
    particular regular expressions, create an instance of this structure and
    call the SEARCH member function.  */
@@ -2520,8 +2535,7 @@ class global_symbol_searcher
   /* Expand symtabs in OBJFILE that match PREG, are of type M_KIND.  Return
      true if any msymbols were seen that we should later consider adding to
      the results list.  */
-  bool expand_symtabs (objfile *objfile,
-		       const gdb::optional<compiled_regex> &preg) const;
+  bool expand_symtabs (objfile *objfile, const search_regex *preg) const;
 
   /* Add symbols from symtabs in OBJFILE that match PREG, and TREG, and are
      of type M_KIND, to the results set RESULTS_SET.  Return false if we
@@ -2530,7 +2544,7 @@ class global_symbol_searcher
      Returning true does not indicate that any results were added, just
      that we didn't _not_ add a result due to reaching MAX_SEARCH_RESULTS.  */
   bool add_matching_symbols (objfile *objfile,
-			     const gdb::optional<compiled_regex> &preg,
+			     const search_regex *preg,
 			     const gdb::optional<compiled_regex> &treg,
 			     std::set<symbol_search> *result_set) const;
 
@@ -2541,9 +2555,14 @@ class global_symbol_searcher
      does not indicate that any results were added, just that we didn't
      _not_ add a result due to reaching MAX_SEARCH_RESULTS.  */
   bool add_matching_msymbols (objfile *objfile,
-			      const gdb::optional<compiled_regex> &preg,
+			      const search_regex *preg,
 			      std::vector<symbol_search> *results) const;
 
+  /* Return the msymbols of OBJFILE that are of type M_KIND and match
+     PREG, in table order.  The names are matched on worker threads.  */
+  std::vector<minimal_symbol *> matching_msymbols
+    (objfile *objfile, const search_regex *preg) const;
+
   /* Return true if MSYMBOL is of type KIND.  */
   static bool is_suitable_msymbol (const enum search_domain kind,
 				   const minimal_symbol *msymbol);
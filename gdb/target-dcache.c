@@ -153,6 +153,33 @@ code_cache_enabled_p (void)
   return code_cache_enabled;
 }
 
+/* The number of live scoped_all_memory_cache instances.  */
+
+static int all_memory_cache_depth;
+
+/* See target-dcache.h.  */
+
+bool
+all_memory_cache_enabled_p ()
+{
+  return all_memory_cache_depth > 0;
+}
+
+scoped_all_memory_cache::scoped_all_memory_cache ()
+{
+  ++all_memory_cache_depth;
+}
+
+scoped_all_memory_cache::~scoped_all_memory_cache ()
+{
+  /* Memory writes only update the lines of the dcache while the stack
+     or code caches are enabled.  Otherwise, the lines read in this
+     scope would go stale; drop them.  */
+  if (--all_memory_cache_depth == 0
+      && !stack_cache_enabled_p () && !code_cache_enabled_p ())
+    target_dcache_invalidate ();
+}
+
 /* Implement the 'maint flush dcache' command.  */
 
 static void
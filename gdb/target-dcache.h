@@ -32,4 +32,25 @@ extern int stack_cache_enabled_p (void);
 
 extern int code_cache_enabled_p (void);
 
+/* Return true if all memory reads currently go through the dcache; see
+   scoped_all_memory_cache.  */
+
+extern bool all_memory_cache_enabled_p ();
+
+/* While an instance of this class is alive, all the memory reads of the
+   current inferior go through the dcache, not only those of the stack
+   and code.  This is meant for bursts of reads done while the inferior
+   is stopped, such as updating many variable objects, where the same
+   memory is often read more than once.  The dcache is flushed whenever
+   the inferior resumes.  */
+
+class scoped_all_memory_cache
+{
+public:
+  scoped_all_memory_cache ();
+  ~scoped_all_memory_cache ();
+
+  DISABLE_COPY_AND_ASSIGN (scoped_all_memory_cache);
+};
+
 #endif /* TARGET_DCACHE_H */
@@ -54,6 +54,7 @@
 #include "target-connection.h"
 #include "valprint.h"
 #include "cli/cli-decode.h"
+#include "perf-counter.h"
 
 static void generic_tls_error (void) ATTRIBUTE_NORETURN;
 
@@ -1521,7 +1522,8 @@ raw_memory_xfer_partial (struct target_ops *ops, gdb_byte *readbuf,
   if (writebuf != NULL
       && inferior_ptid != null_ptid
       && target_dcache_init_p ()
-      && (stack_cache_enabled_p () || code_cache_enabled_p ()))
+      && (stack_cache_enabled_p () || code_cache_enabled_p ()
+	  || all_memory_cache_enabled_p ()))
     {
       DCACHE *dcache = target_dcache_get ();
 
@@ -1603,13 +1605,15 @@ memory_xfer_partial_1 (struct target_ops *ops, enum target_object object,
 	 the collected memory range fails.  */
       && get_traceframe_number () == -1
       && (region->attrib.cache
+	  || all_memory_cache_enabled_p ()
 	  || (stack_cache_enabled_p () && object == TARGET_OBJECT_STACK_MEMORY)
 	  || (code_cache_enabled_p () && object == TARGET_OBJECT_CODE_MEMORY)))
     {
       DCACHE *dcache = target_dcache_get_or_init ();
 
       return dcache_read_memory_partial (ops, dcache, memaddr, readbuf,
-					 reg_len, xfered_len);
+					 reg_len, xfered_len,
+					 object == TARGET_OBJECT_STACK_MEMORY);
     }
 
   /* If none of those methods found the memory we wanted, fall back
@@ -1682,6 +1686,15 @@ make_scoped_restore_show_memory_breakpoints (int show)
   return make_scoped_restore (&show_memory_breakpoints, show);
 }
 
+/* Bytes of target memory transferred by target_xfer_partial.  */
+
+static perf_counter memory_bytes_read_counter
+  ("target-memory-bytes-read", perf_counter_unit::bytes,
+   N_("Bytes of target memory read, including from the data cache."));
+static perf_counter memory_bytes_written_counter
+  ("target-memory-bytes-written", perf_counter_unit::bytes,
+   N_("Bytes of target memory written."));
+
 /* For docs see target.h, to_xfer_partial.  */
 
 enum target_xfer_status
@@ -1730,6 +1743,18 @@ target_xfer_partial (struct target_ops *ops,
     retval = ops->xfer_partial (object, annex, readbuf,
 				writebuf, offset, len, xfered_len);
 
+  if (retval == TARGET_XFER_OK
+      && (object == TARGET_OBJECT_MEMORY
+	  || object == TARGET_OBJECT_STACK_MEMORY
+	  || object == TARGET_OBJECT_CODE_MEMORY
+	  || object == TARGET_OBJECT_RAW_MEMORY))
+    {
+      if (readbuf != nullptr)
+	memory_bytes_read_counter.add (*xfered_len);
+      else
+	memory_bytes_written_counter.add (*xfered_len);
+    }
+
   if (targetdebug)
     {
       const unsigned char *myaddr = NULL;
@@ -1836,6 +1861,27 @@ target_read_raw_memory (CORE_ADDR memaddr, gdb_byte *myaddr, ssize_t len)
     return -1;
 }
 
+/* See target.h.  */
+
+bool
+target_read_raw_memory_batch
+  (gdb::array_view<const memory_read_request> requests)
+{
+  size_t done = 0;
+
+  /* While replaying, the record targets decide what memory can be
+     read, so go through xfer_partial for everything.  */
+  if (!requests.empty () && !target_record_is_replaying (inferior_ptid))
+    done = current_inferior ()->top_target ()->read_memory_batch (requests);
+
+  for (size_t i = done; i < requests.size (); i++)
+    if (target_read_raw_memory (requests[i].addr, requests[i].buf,
+				requests[i].len) != 0)
+      return false;
+
+  return true;
+}
+
 /* Like target_read_memory, but specify explicitly that this is a read from
    the target's stack.  This may trigger different cache behavior.  */
 
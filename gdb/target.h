@@ -296,6 +296,18 @@ struct memory_read_result
 extern std::vector<memory_read_result> read_memory_robust
     (struct target_ops *ops, const ULONGEST offset, const LONGEST len);
 
+/* Describes one of the reads of a batch; see
+   target_read_raw_memory_batch.  */
+struct memory_read_request
+{
+  /* Address to read from.  */
+  CORE_ADDR addr;
+  /* Where to store the data.  */
+  gdb_byte *buf;
+  /* Number of bytes to read.  */
+  ULONGEST len;
+};
+
 /* Request that OPS transfer up to LEN addressable units from BUF to the
    target's OBJECT.  When writing to a memory object, the addressable unit
    size is architecture dependent and can be found using
@@ -805,6 +817,14 @@ struct target_ops
     virtual ULONGEST get_memory_xfer_limit ()
       TARGET_DEFAULT_RETURN (ULONGEST_MAX);
 
+    /* Read the raw memory described by REQUESTS, which need not be
+       contiguous, with as few requests to the inferior as possible.
+       Return the number of leading requests that were read in full;
+       the caller reads the others with xfer_partial.  */
+    virtual size_t read_memory_batch
+      (gdb::array_view<const memory_read_request> requests)
+      TARGET_DEFAULT_RETURN (0);
+
     /* Returns the memory map for the target.  A return value of NULL
        means that no memory map is available.  If a memory address
        does not fall within any returned regions, it's assumed to be
@@ -1581,6 +1601,13 @@ extern bool target_can_run_breakpoint_commands ();
 extern int target_read_raw_memory (CORE_ADDR memaddr, gdb_byte *myaddr,
 				   ssize_t len);
 
+/* Read the raw memory described by REQUESTS, as target_read_raw_memory
+   would for each of them, but letting the target serve them all at
+   once if it can.  Return true if all of them were read.  */
+
+extern bool target_read_raw_memory_batch
+  (gdb::array_view<const memory_read_request> requests);
+
 extern int target_read_stack (CORE_ADDR memaddr, gdb_byte *myaddr, ssize_t len);
 
 extern int target_read_code (CORE_ADDR memaddr, gdb_byte *myaddr, ssize_t len);
@@ -0,0 +1,37 @@
+/* This testcase is part of GDB, the GNU debugger.
+
+   Copyright 2022 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+int narrow_alpha;
+int narrow_alpha_beta;
+int narrow_alpha_gamma;
+int narrow_beta;
+
+extern int narrow_other_func (int);
+
+int
+narrow_func (int narrow_arg)
+{
+  int narrow_local = narrow_arg + 1;
+
+  return narrow_local;
+}
+
+int
+main (void)
+{
+  return narrow_func (narrow_other_func (0));
+}
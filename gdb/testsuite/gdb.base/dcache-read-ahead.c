@@ -0,0 +1,44 @@
+/* This testcase is part of GDB, the GNU debugger.
+
+   Copyright 2022 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+/* Each frame has some padding, so that the frames of the recursion
+   span several dcache lines.  */
+
+void
+done (void)
+{
+}
+
+int
+recurse (int depth)
+{
+  volatile char pad[200];
+
+  pad[0] = depth;
+  if (depth == 0)
+    {
+      done ();
+      return pad[0];
+    }
+  return recurse (depth - 1) + pad[0];
+}
+
+int
+main (void)
+{
+  return recurse (20) == 210 ? 0 : 1;
+}
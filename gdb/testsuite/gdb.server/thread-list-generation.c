@@ -0,0 +1,67 @@
+/* This testcase is part of GDB, the GNU debugger.
+
+   Copyright 2022 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+static void *
+thread_func (void *arg)
+{
+  pthread_barrier_wait ((pthread_barrier_t *) arg);
+
+  while (1)
+    sleep (1);
+
+  return NULL;
+}
+
+/* Create COUNT threads, and wait until they have all started.  */
+
+static void
+create_threads (int count)
+{
+  pthread_barrier_t *barrier = malloc (sizeof (pthread_barrier_t));
+  pthread_t thread;
+  int i;
+
+  pthread_barrier_init (barrier, NULL, count + 1);
+  for (i = 0; i < count; i++)
+    if (pthread_create (&thread, NULL, thread_func, barrier) != 0)
+      abort ();
+  pthread_barrier_wait (barrier);
+}
+
+void
+stop_here (void)
+{
+}
+
+int
+main (void)
+{
+  /* Ensure the test doesn't run forever.  */
+  alarm (99);
+
+  create_threads (2);
+  stop_here ();		/* Threads created.  */
+  stop_here ();		/* Nothing changed.  */
+  create_threads (2);
+  stop_here ();		/* More threads created.  */
+
+  return 0;
+}
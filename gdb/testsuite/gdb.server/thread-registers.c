@@ -0,0 +1,60 @@
+/* This testcase is part of GDB, the GNU debugger.
+
+   Copyright 2022 Free Software Foundation, Inc.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define NUM_THREADS 4
+
+static pthread_barrier_t barrier;
+
+void
+all_started (void)
+{
+}
+
+static void *
+thread_func (void *arg)
+{
+  pthread_barrier_wait (&barrier);
+
+  while (1)
+    sleep (1);
+
+  return NULL;
+}
+
+int
+main (void)
+{
+  pthread_t threads[NUM_THREADS];
+  int i;
+
+  /* Ensure the test doesn't run forever.  */
+  alarm (99);
+
+  pthread_barrier_init (&barrier, NULL, NUM_THREADS + 1);
+  for (i = 0; i < NUM_THREADS; i++)
+    if (pthread_create (&threads[i], NULL, thread_func, NULL) != 0)
+      abort ();
+
+  pthread_barrier_wait (&barrier);
+  all_started ();
+
+  return 0;
+}
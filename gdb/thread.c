@@ -71,6 +71,11 @@ static int highest_thread_num;
 /* The current/selected thread.  */
 static thread_info *current_thread_;
 
+/* Incremented whenever a thread is marked executing.  Lets "thread
+   apply all" tell whether any thread may have run (and exited) since
+   it fetched the thread list.  */
+static unsigned int thread_resume_generation;
+
 /* Returns true if THR is the current thread.  */
 
 static bool
@@ -343,7 +348,10 @@ thread_info::set_executing (bool executing)
 {
   m_executing = executing;
   if (executing)
-    this->clear_stop_pc ();
+    {
+      this->clear_stop_pc ();
+      thread_resume_generation++;
+    }
 }
 
 /* See gdbthread.h.  */
@@ -1467,14 +1475,19 @@ thread_try_catch_cmd (thread_info *thr, gdb::optional<int> ada_task,
 
   /* The thread header is computed before running the command since
      the command can change the inferior, which is not permitted
-     by thread_target_id_str.  */
+     by thread_target_id_str.  It is not needed at all with -q, and
+     computing it may cost the target a round trip or two per thread
+     to fetch the thread's name and extra info.  */
   std::string thr_header;
-  if (ada_task.has_value ())
-    thr_header = string_printf (_("\nTask ID %d:\n"), *ada_task);
-  else
-    thr_header = string_printf (_("\nThread %s (%s):\n"),
-				print_thread_id (thr),
-				thread_target_id_str (thr).c_str ());
+  if (!flags.quiet)
+    {
+      if (ada_task.has_value ())
+	thr_header = string_printf (_("\nTask ID %d:\n"), *ada_task);
+      else
+	thr_header = string_printf (_("\nThread %s (%s):\n"),
+				    print_thread_id (thr),
+				    thread_target_id_str (thr).c_str ());
+    }
 
   try
     {
@@ -1604,9 +1617,28 @@ thread_apply_all_command (const char *cmd, int from_tty)
 
       scoped_restore_current_thread restore_thread;
 
+      unsigned int generation = thread_resume_generation;
       for (thread_info_ref &thr : thr_list_cpy)
-	if (switch_to_thread_if_alive (thr.get ()))
-	  thread_try_catch_cmd (thr.get (), {}, cmd, from_tty, flags);
+	{
+	  /* The thread list was just refreshed from the target.  As
+	     long as nothing has been resumed since, a thread that was
+	     stopped then is still around, so avoid asking the target
+	     again; with remote targets that is a round trip per
+	     thread.  */
+	  bool alive;
+	  if (generation == thread_resume_generation
+	      && thr->state == THREAD_STOPPED
+	      && !thr->executing ())
+	    {
+	      switch_to_thread (thr.get ());
+	      alive = true;
+	    }
+	  else
+	    alive = switch_to_thread_if_alive (thr.get ());
+
+	  if (alive)
+	    thread_try_catch_cmd (thr.get (), {}, cmd, from_tty, flags);
+	}
     }
 }
 
@@ -33,7 +33,10 @@
 #include "target-descriptions.h"
 #include "gdbsupport/buffer.h"
 #include "gdbsupport/pathstuff.h"
+#include "gdbsupport/scoped_mmap.h"
+#include "gdbsupport/gdb_optional.h"
 #include <algorithm>
+#include <map>
 
 #ifndef O_LARGEFILE
 #define O_LARGEFILE 0
@@ -421,12 +424,52 @@ static tfile_target tfile_ops;
 
 static char *trace_filename;
 static int trace_fd = -1;
+static off_t trace_file_size;
 static off_t trace_frames_offset;
 static off_t cur_offset;
 static int cur_data_size;
 int trace_regblock_size;
 static struct buffer trace_tdesc;
 
+#ifdef HAVE_SYS_MMAN_H
+/* The whole trace file, mapped in memory, if that could be done.
+   Otherwise the file is read with read(2).  */
+static gdb::optional<scoped_mmap> trace_mapping;
+#endif
+
+/* The position of the next tfile_read in the mapped trace file.  When
+   the file isn't mapped, TRACE_FD's seek position is used instead.  */
+static off_t trace_pos;
+
+/* A traceframe of the trace file, as recorded in the traceframe
+   index.  */
+
+struct tfile_traceframe
+{
+  /* The offset in the file of the traceframe's data, just after its
+     header.  */
+  off_t data_offset;
+
+  /* The size of the traceframe's data.  */
+  unsigned int data_size;
+
+  /* The number of the tracepoint that collected it, on the target.  */
+  short tpnum;
+};
+
+/* All the traceframes of the trace file, indexed by traceframe
+   number.  This is built the first time a traceframe is looked up, so
+   that tfind doesn't have to scan the file each time.  */
+static std::vector<tfile_traceframe> traceframe_index;
+
+/* For each tracepoint number on the target, the sorted numbers of the
+   traceframes it collected.  */
+static std::map<short, std::vector<int>> traceframes_by_tracepoint;
+
+/* Whether TRACEFRAME_INDEX and TRACEFRAMES_BY_TRACEPOINT have been
+   built.  */
+static bool traceframe_index_built;
+
 static void tfile_append_tdesc_line (const char *line);
 static void tfile_interp_line (char *line,
 			       struct uploaded_tp **utpp,
@@ -441,6 +484,18 @@ static void tfile_interp_line (char *line,
 static void
 tfile_read (gdb_byte *readbuf, int size)
 {
+#ifdef HAVE_SYS_MMAN_H
+  if (trace_mapping.has_value ())
+    {
+      if (trace_pos < 0 || trace_pos + size > trace_file_size)
+	error (_("Premature end of file while reading trace file"));
+
+      memcpy (readbuf, (gdb_byte *) trace_mapping->get () + trace_pos, size);
+      trace_pos += size;
+      return;
+    }
+#endif
+
   int gotten;
 
   gotten = read (trace_fd, readbuf, size);
@@ -450,6 +505,86 @@ tfile_read (gdb_byte *readbuf, int size)
     error (_("Premature end of file while reading trace file"));
 }
 
+/* Set the position of the next tfile_read, like lseek.  */
+
+static void
+tfile_seek (off_t offset, int whence)
+{
+#ifdef HAVE_SYS_MMAN_H
+  if (trace_mapping.has_value ())
+    {
+      gdb_assert (whence == SEEK_SET || whence == SEEK_CUR);
+      trace_pos = whence == SEEK_SET ? offset : trace_pos + offset;
+      return;
+    }
+#endif
+
+  lseek (trace_fd, offset, whence);
+}
+
+/* Forget about the traceframe index of the current trace file.  */
+
+static void
+tfile_reset_traceframe_index ()
+{
+  traceframe_index.clear ();
+  traceframe_index.shrink_to_fit ();
+  traceframes_by_tracepoint.clear ();
+  traceframe_index_built = false;
+}
+
+/* Build the traceframe index of the current trace file, if not done
+   yet.  This only reads the headers of the traceframes.  */
+
+static void
+tfile_build_traceframe_index ()
+{
+  if (traceframe_index_built)
+    return;
+
+  enum bfd_endian byte_order = gdbarch_byte_order (target_gdbarch ());
+  off_t offset = trace_frames_offset;
+
+  tfile_reset_traceframe_index ();
+  while (1)
+    {
+      gdb_byte buf[4];
+
+      /* A traceframe header is a 2-byte tracepoint number, 0 for the
+	 end of the traceframes, followed by the 4-byte data size.  */
+      if (offset + 2 > trace_file_size)
+	{
+	  warning (_("Trace file \"%s\" is truncated after %zu traceframes"),
+		   trace_filename, traceframe_index.size ());
+	  break;
+	}
+
+      tfile_seek (offset, SEEK_SET);
+      tfile_read (buf, 2);
+      short tpnum = (short) extract_signed_integer (buf, 2, byte_order);
+      if (tpnum == 0)
+	break;
+
+      if (offset + 6 > trace_file_size)
+	{
+	  warning (_("Trace file \"%s\" is truncated after %zu traceframes"),
+		   trace_filename, traceframe_index.size ());
+	  break;
+	}
+
+      tfile_read (buf, 4);
+      unsigned int data_size
+	= (unsigned int) extract_unsigned_integer (buf, 4, byte_order);
+      offset += 6;
+
+      traceframes_by_tracepoint[tpnum].push_back (traceframe_index.size ());
+      traceframe_index.push_back ({ offset, data_size, tpnum });
+      offset += data_size;
+    }
+
+  traceframe_index_built = true;
+}
+
 /* Open the tfile target.  */
 
 static void
@@ -485,6 +620,26 @@ tfile_target_open (const char *arg, int from_tty)
 
   trace_filename = filename.release ();
   trace_fd = scratch_chan;
+  trace_pos = 0;
+  tfile_reset_traceframe_index ();
+
+  struct stat st;
+  if (fstat (trace_fd, &st) < 0)
+    perror_with_name (trace_filename);
+  trace_file_size = st.st_size;
+
+#ifdef HAVE_SYS_MMAN_H
+  /* Map the file if possible, so that looking at traceframes doesn't
+     need any system call.  */
+  if (trace_file_size > 0
+      && (off_t) (size_t) trace_file_size == trace_file_size)
+    {
+      trace_mapping.emplace (nullptr, trace_file_size, PROT_READ,
+			     MAP_PRIVATE, trace_fd, 0);
+      if (trace_mapping->get () == MAP_FAILED)
+	trace_mapping.reset ();
+    }
+#endif
 
   /* Make sure this is clear.  */
   buffer_free (&trace_tdesc);
@@ -622,6 +777,10 @@ tfile_target::close ()
   switch_to_no_thread ();	/* Avoid confusion from thread stuff.  */
   exit_inferior_silent (current_inferior ());
 
+#ifdef HAVE_SYS_MMAN_H
+  trace_mapping.reset ();
+#endif
+  tfile_reset_traceframe_index ();
   ::close (trace_fd);
   trace_fd = -1;
   xfree (trace_filename);
@@ -644,138 +803,126 @@ tfile_target::get_tracepoint_status (struct breakpoint *tp, struct uploaded_tp *
      trace files, so nothing to do here.  */
 }
 
-/* Given the position of a traceframe in the file, figure out what
-   address the frame was collected at.  This would normally be the
-   value of a collected PC register, but if not available, we
-   improvise.  */
+/* Given the number on the target of the tracepoint that collected a
+   traceframe, figure out what address the frame was collected at.
+   This would normally be the value of a collected PC register, but if
+   not available, we improvise.  */
 
 static CORE_ADDR
-tfile_get_traceframe_address (off_t tframe_offset)
+tfile_get_traceframe_address (short tpnum)
 {
   CORE_ADDR addr = 0;
-  short tpnum;
   struct tracepoint *tp;
-  off_t saved_offset = cur_offset;
 
   /* FIXME dig pc out of collected registers.  */
 
   /* Fall back to using tracepoint address.  */
-  lseek (trace_fd, tframe_offset, SEEK_SET);
-  tfile_read ((gdb_byte *) &tpnum, 2);
-  tpnum = (short) extract_signed_integer ((gdb_byte *) &tpnum, 2,
-					  gdbarch_byte_order
-					      (target_gdbarch ()));
-
   tp = get_tracepoint_by_number_on_target (tpnum);
   /* FIXME this is a poor heuristic if multiple locations.  */
   if (tp && tp->loc)
     addr = tp->loc->address;
 
-  /* Restore our seek position.  */
-  cur_offset = saved_offset;
-  lseek (trace_fd, cur_offset, SEEK_SET);
   return addr;
 }
 
-/* Given a type of search and some parameters, scan the collection of
-   traceframes in the file looking for a match.  When found, return
-   both the traceframe and tracepoint number, otherwise -1 for
-   each.  */
+/* Return the number of the first traceframe in FRAMES, a sorted list
+   of traceframe numbers, that is at least START.  Return -1 if there
+   is none.  */
+
+static int
+tfile_next_traceframe (const std::vector<int> &frames, int start)
+{
+  auto it = std::lower_bound (frames.begin (), frames.end (), start);
+  if (it == frames.end ())
+    return -1;
+  return *it;
+}
+
+/* Given a type of search and some parameters, look for a matching
+   traceframe in the traceframe index.  When found, return both the
+   traceframe and tracepoint number, otherwise -1 for each.  */
 
 int
 tfile_target::trace_find (enum trace_find_type type, int num,
 			  CORE_ADDR addr1, CORE_ADDR addr2, int *tpp)
 {
-  short tpnum;
-  int tfnum = 0, found = 0;
-  unsigned int data_size;
-  struct tracepoint *tp;
-  off_t offset, tframe_offset;
-  CORE_ADDR tfaddr;
+  int tfnum = -1;
 
-  if (num == -1)
+  if (num != -1)
     {
-      if (tpp)
-	*tpp = -1;
-      return -1;
-    }
-
-  lseek (trace_fd, trace_frames_offset, SEEK_SET);
-  offset = trace_frames_offset;
-  while (1)
-    {
-      tframe_offset = offset;
-      tfile_read ((gdb_byte *) &tpnum, 2);
-      tpnum = (short) extract_signed_integer ((gdb_byte *) &tpnum, 2,
-					      gdbarch_byte_order
-						  (target_gdbarch ()));
-      offset += 2;
-      if (tpnum == 0)
-	break;
-      tfile_read ((gdb_byte *) &data_size, 4);
-      data_size = (unsigned int) extract_unsigned_integer
-				     ((gdb_byte *) &data_size, 4,
-				      gdbarch_byte_order (target_gdbarch ()));
-      offset += 4;
+      tfile_build_traceframe_index ();
 
       if (type == tfind_number)
 	{
 	  /* Looking for a specific trace frame.  */
-	  if (tfnum == num)
-	    found = 1;
+	  if (num >= 0 && num < (int) traceframe_index.size ())
+	    tfnum = num;
 	}
-      else
+      else if (type == tfind_tp)
 	{
 	  /* Start from the _next_ trace frame.  */
-	  if (tfnum > get_traceframe_number ())
+	  struct tracepoint *tp = get_tracepoint (num);
+
+	  if (tp != nullptr)
+	    {
+	      auto it = traceframes_by_tracepoint.find (tp->number_on_target);
+	      if (it != traceframes_by_tracepoint.end ())
+		tfnum = tfile_next_traceframe (it->second,
+					       get_traceframe_number () + 1);
+	    }
+	}
+      else
+	{
+	  /* All the traceframes of a tracepoint have the same address,
+	     so only look at the first matching traceframe of each
+	     tracepoint whose address matches, starting from the _next_
+	     trace frame.  */
+	  for (const auto &item : traceframes_by_tracepoint)
 	    {
+	      CORE_ADDR tfaddr = tfile_get_traceframe_address (item.first);
+	      bool match;
+
 	      switch (type)
 		{
 		case tfind_pc:
-		  tfaddr = tfile_get_traceframe_address (tframe_offset);
-		  if (tfaddr == addr1)
-		    found = 1;
-		  break;
-		case tfind_tp:
-		  tp = get_tracepoint (num);
-		  if (tp && tpnum == tp->number_on_target)
-		    found = 1;
+		  match = tfaddr == addr1;
 		  break;
 		case tfind_range:
-		  tfaddr = tfile_get_traceframe_address (tframe_offset);
-		  if (addr1 <= tfaddr && tfaddr <= addr2)
-		    found = 1;
+		  match = addr1 <= tfaddr && tfaddr <= addr2;
 		  break;
 		case tfind_outside:
-		  tfaddr = tfile_get_traceframe_address (tframe_offset);
-		  if (!(addr1 <= tfaddr && tfaddr <= addr2))
-		    found = 1;
+		  match = !(addr1 <= tfaddr && tfaddr <= addr2);
 		  break;
 		default:
 		  internal_error (__FILE__, __LINE__, _("unknown tfind type"));
 		}
-	    }
-	}
 
-      if (found)
-	{
-	  if (tpp)
-	    *tpp = tpnum;
-	  cur_offset = offset;
-	  cur_data_size = data_size;
+	      if (!match)
+		continue;
 
-	  return tfnum;
+	      int n = tfile_next_traceframe (item.second,
+					     get_traceframe_number () + 1);
+	      if (n != -1 && (tfnum == -1 || n < tfnum))
+		tfnum = n;
+	    }
 	}
-      /* Skip past the traceframe's data.  */
-      lseek (trace_fd, data_size, SEEK_CUR);
-      offset += data_size;
-      /* Update our own count of traceframes.  */
-      ++tfnum;
     }
-  /* Did not find what we were looking for.  */
+
+  if (tfnum == -1)
+    {
+      /* Did not find what we were looking for.  */
+      if (tpp)
+	*tpp = -1;
+      return -1;
+    }
+
+  const tfile_traceframe &frame = traceframe_index[tfnum];
   if (tpp)
-    *tpp = -1;
-  return -1;
+    *tpp = frame.tpnum;
+  cur_offset = frame.data_offset;
+  cur_data_size = frame.data_size;
+
+  return tfnum;
 }
 
 /* Prototype of the callback passed to tframe_walk_blocks.  */
@@ -809,7 +956,7 @@ traceframe_walk_blocks (walk_blocks_callback_func callback,
   /* Iterate through a traceframe's blocks, looking for a block of the
      requested type.  */
 
-  lseek (trace_fd, cur_offset + pos, SEEK_SET);
+  tfile_seek (cur_offset + pos, SEEK_SET);
   while (pos < cur_data_size)
     {
       unsigned short mlen;
@@ -825,21 +972,21 @@ traceframe_walk_blocks (walk_blocks_callback_func callback,
       switch (block_type)
 	{
 	case 'R':
-	  lseek (trace_fd, cur_offset + pos + trace_regblock_size, SEEK_SET);
+	  tfile_seek (cur_offset + pos + trace_regblock_size, SEEK_SET);
 	  pos += trace_regblock_size;
 	  break;
 	case 'M':
-	  lseek (trace_fd, cur_offset + pos + 8, SEEK_SET);
+	  tfile_seek (cur_offset + pos + 8, SEEK_SET);
 	  tfile_read ((gdb_byte *) &mlen, 2);
 	  mlen = (unsigned short)
 		extract_unsigned_integer ((gdb_byte *) &mlen, 2,
 					  gdbarch_byte_order
 					      (target_gdbarch ()));
-	  lseek (trace_fd, mlen, SEEK_CUR);
+	  tfile_seek (mlen, SEEK_CUR);
 	  pos += (8 + 2 + mlen);
 	  break;
 	case 'V':
-	  lseek (trace_fd, cur_offset + pos + 4 + 8, SEEK_SET);
+	  tfile_seek (cur_offset + pos + 4 + 8, SEEK_SET);
 	  pos += (4 + 8);
 	  break;
 	default:
@@ -987,7 +1134,7 @@ tfile_target::xfer_partial (enum target_object object,
 		amt = len;
 
 	      if (maddr != offset)
-		lseek (trace_fd, offset - maddr, SEEK_CUR);
+		tfile_seek (offset - maddr, SEEK_CUR);
 	      tfile_read (readbuf, amt);
 	      *xfered_len = amt;
 	      return TARGET_XFER_OK;
@@ -39,11 +39,16 @@
 #include "tui/tui-source.h"
 #include "progspace.h"
 #include "objfiles.h"
+#include "observable.h"
+#include "target.h"
 #include "cli/cli-style.h"
 #include "tui/tui-location.h"
+#include "gdbsupport/byte-vector.h"
 
 #include "gdb_curses.h"
 
+#include <unordered_map>
+
 struct tui_asm_line
 {
   CORE_ADDR addr;
@@ -52,6 +57,92 @@ struct tui_asm_line
   std::string insn;
 };
 
+/* A cache of disassembled instructions, keyed by address.  A stop or
+   a scroll usually leaves most of the instructions in the disassembly
+   window where they were, and disassembling them again, including the
+   symbol lookups for their addresses, is most of the cost of redrawing
+   the window.  Each entry keeps the bytes of its instruction, which
+   are compared with memory before the entry is used, so code rewritten
+   by the inferior or by GDB is noticed.  Anything else that can change
+   the output -- symbols, styling or a setting -- clears the whole
+   cache.  */
+
+class tui_disasm_cache
+{
+public:
+
+  struct entry
+  {
+    tui_asm_line line;
+    CORE_ADDR next_pc;
+    gdb::byte_vector bytes;
+  };
+
+  /* Return the entry for the instruction at PC, as disassembled for
+     GDBARCH with styling enabled or not according to TERM_OUT, or
+     nullptr if there is no valid entry.  */
+  const entry *lookup (struct gdbarch *gdbarch, bool term_out, CORE_ADDR pc)
+  {
+    if (gdbarch != m_gdbarch || term_out != m_term_out
+	|| current_program_space != m_pspace)
+      return nullptr;
+
+    auto iter = m_entries.find (pc);
+    if (iter == m_entries.end ())
+      return nullptr;
+
+    const entry &e = iter->second;
+    gdb::byte_vector bytes (e.bytes.size ());
+    if (target_read_code (pc, bytes.data (), bytes.size ()) != 0
+	|| bytes != e.bytes)
+      {
+	m_entries.erase (iter);
+	return nullptr;
+      }
+    return &e;
+  }
+
+  /* Record LINE, the disassembly of the instruction at LINE.addr that
+     ends at NEXT_PC.  */
+  void insert (struct gdbarch *gdbarch, bool term_out,
+	       const tui_asm_line &line, CORE_ADDR next_pc)
+  {
+    if (gdbarch != m_gdbarch || term_out != m_term_out
+	|| current_program_space != m_pspace
+	|| m_entries.size () >= max_entries)
+      {
+	clear ();
+	m_gdbarch = gdbarch;
+	m_term_out = term_out;
+	m_pspace = current_program_space;
+      }
+
+    gdb::byte_vector bytes (next_pc - line.addr);
+    if (target_read_code (line.addr, bytes.data (), bytes.size ()) != 0)
+      return;
+
+    m_entries[line.addr] = { line, next_pc, std::move (bytes) };
+  }
+
+  void clear ()
+  {
+    m_entries.clear ();
+  }
+
+private:
+
+  /* Enough for scrolling back and forth over a few screens of code
+     without the cache growing without bound.  */
+  static constexpr size_t max_entries = 4096;
+
+  struct gdbarch *m_gdbarch = nullptr;
+  bool m_term_out = false;
+  struct program_space *m_pspace = nullptr;
+  std::unordered_map<CORE_ADDR, entry> m_entries;
+};
+
+static tui_disasm_cache disasm_cache;
+
 /* Helper function to find the number of characters in STR, skipping
    any ANSI escape sequences.  */
 static size_t
@@ -89,9 +180,8 @@ len_without_escapes (const std::string &str)
    PC into the ASM_LINES vector (which will be emptied of any previous
    contents).  Return the address of the COUNT'th instruction after pc.
    When ADDR_SIZE is non-null then place the maximum size of an address and
-   label into the value pointed to by ADDR_SIZE, and set the addr_size
-   field on each item in ASM_LINES, otherwise the addr_size fields within
-   ASM_LINES are undefined.
+   label into the value pointed to by ADDR_SIZE.  The addr_size field of
+   each item in ASM_LINES is always set.
 
    It is worth noting that ASM_LINES might not have COUNT entries when this
    function returns.  If the disassembly is truncated for some other
@@ -115,6 +205,17 @@ tui_disassemble (struct gdbarch *gdbarch,
       tui_asm_line tal;
       CORE_ADDR orig_pc = pc;
 
+      const tui_disasm_cache::entry *cached
+	= disasm_cache.lookup (gdbarch, term_out, pc);
+      if (cached != nullptr)
+	{
+	  if (addr_size != nullptr)
+	    *addr_size = std::max (*addr_size, cached->line.addr_size);
+	  asm_lines.push_back (cached->line);
+	  pc = cached->next_pc;
+	  continue;
+	}
+
       try
 	{
 	  pc = pc + gdb_print_insn (gdbarch, pc, &gdb_dis_out, NULL);
@@ -137,18 +238,16 @@ tui_disassemble (struct gdbarch *gdbarch,
       print_address (gdbarch, orig_pc, &gdb_dis_out);
       tal.addr_string = gdb_dis_out.release ();
 
+      /* The address size is always computed, so that the line can be
+	 cached for any caller.  */
+      if (term_out)
+	tal.addr_size = len_without_escapes (tal.addr_string);
+      else
+	tal.addr_size = tal.addr_string.size ();
       if (addr_size != nullptr)
-	{
-	  size_t new_size;
-
-	  if (term_out)
-	    new_size = len_without_escapes (tal.addr_string);
-	  else
-	    new_size = tal.addr_string.size ();
-	  *addr_size = std::max (*addr_size, new_size);
-	  tal.addr_size = new_size;
-	}
+	*addr_size = std::max (*addr_size, tal.addr_size);
 
+      disasm_cache.insert (gdbarch, term_out, tal, pc);
       asm_lines.push_back (std::move (tal));
     }
   return pc;
@@ -522,3 +621,26 @@ tui_disasm_window::display_start_addr (struct gdbarch **gdbarch_p,
   *gdbarch_p = m_gdbarch;
   *addr_p = m_start_line_or_addr.u.addr;
 }
+
+/* Clear the disassembly cache; used as an observer callback.  */
+
+static void
+tui_disasm_cache_clear ()
+{
+  disasm_cache.clear ();
+}
+
+void _initialize_tui_disasm ();
+void
+_initialize_tui_disasm ()
+{
+  gdb::observers::new_objfile.attach
+    ([] (struct objfile *) { tui_disasm_cache_clear (); }, "tui-disasm");
+  gdb::observers::free_objfile.attach
+    ([] (struct objfile *) { tui_disasm_cache_clear (); }, "tui-disasm");
+  gdb::observers::styling_changed.attach (tui_disasm_cache_clear,
+					  "tui-disasm");
+  gdb::observers::command_param_changed.attach
+    ([] (const char *, const char *) { tui_disasm_cache_clear (); },
+     "tui-disasm");
+}
@@ -239,6 +239,10 @@ tui_source_window_base::show_source_line (int lineno)
   struct tui_source_element *line;
 
   line = &m_content[lineno];
+
+  /* Lines are drawn independently of each other, so don't let a style
+     left over from whatever was drawn last bleed into this one.  */
+  tui_apply_style (m_pad.get (), ui_file_style ());
   if (line->is_exec_point)
     tui_set_reverse_mode (m_pad.get (), true);
 
@@ -246,6 +250,7 @@ tui_source_window_base::show_source_line (int lineno)
   tui_puts (line->line.c_str (), m_pad.get ());
   if (line->is_exec_point)
     tui_set_reverse_mode (m_pad.get (), false);
+  wclrtoeol (m_pad.get ());
 }
 
 /* See tui-winsource.h.  */
@@ -278,11 +283,30 @@ tui_source_window_base::show_source_content ()
   int pad_width = std::max (m_max_length, width);
   if (m_pad == nullptr || pad_width > getmaxx (m_pad.get ())
       || m_content.size () > getmaxy (m_pad.get ()))
-    m_pad.reset (newpad (m_content.size (), pad_width));
+    {
+      m_pad.reset (newpad (m_content.size (), pad_width));
+      m_drawn.clear ();
+    }
 
-  werase (m_pad.get ());
+  /* Only redraw the lines that differ from what the pad already holds,
+     so that stepping or scrolling by a few lines doesn't re-render, and
+     make curses re-examine, the whole window.  */
+  m_drawn.resize (m_content.size ());
   for (int lineno = 0; lineno < m_content.size (); lineno++)
-    show_source_line (lineno);
+    {
+      const tui_source_element &elt = m_content[lineno];
+      tui_drawn_line &drawn = m_drawn[lineno];
+
+      if (drawn.valid
+	  && drawn.is_exec_point == elt.is_exec_point
+	  && drawn.line == elt.line)
+	continue;
+
+      show_source_line (lineno);
+      drawn.line = elt.line;
+      drawn.is_exec_point = elt.is_exec_point;
+      drawn.valid = true;
+    }
 
   refresh_window ();
 }
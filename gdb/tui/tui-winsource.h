@@ -189,6 +189,19 @@ struct tui_source_window_base : public tui_win_info
 
   /* Pad used to display fixme mumble  */
   std::unique_ptr<WINDOW, curses_deleter> m_pad;
+
+  /* What was last drawn on a line of the pad.  */
+  struct tui_drawn_line
+  {
+    std::string line;
+    bool is_exec_point = false;
+    bool valid = false;
+  };
+
+  /* The lines currently drawn on the pad, indexed like M_CONTENT.  Used
+     to redraw only the lines that changed.  Cleared whenever the pad is
+     recreated.  */
+  std::vector<tui_drawn_line> m_drawn;
 };
 
 
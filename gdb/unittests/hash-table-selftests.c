@@ -0,0 +1,182 @@
+/* Self tests for gdb::hash_table for GDB, the GNU debugger.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#include "defs.h"
+#include "gdbsupport/selftest.h"
+#include "gdbsupport/hash-table.h"
+#include <map>
+
+namespace selftests {
+namespace hash_table_tests {
+
+/* The elements of the tables tested.  */
+
+struct element
+{
+  int key;
+  int value;
+};
+
+/* The number of elements not yet passed to Traits::remove.  */
+
+static int live_elements;
+
+struct element_traits : public gdb::default_hash_table_traits<element *>
+{
+  static hashval_t hash (element *const &elt)
+  {
+    return elt->key;
+  }
+
+  static bool equal (element *const &elt, int key)
+  {
+    return elt->key == key;
+  }
+
+  static void remove (element *&elt)
+  {
+    --live_elements;
+    delete elt;
+  }
+};
+
+using table_type = gdb::hash_table<element *, element_traits>;
+
+/* Insert KEY in TABLE, and record it in REFERENCE.  */
+
+static void
+insert (table_type &table, std::map<int, int> &reference, int key, int value)
+{
+  bool inserted;
+  element *&slot = table.find_or_insert (key, key, &inserted);
+  SELF_CHECK (inserted == (reference.count (key) == 0));
+  if (inserted)
+    {
+      slot = new element { key, value };
+      ++live_elements;
+      reference[key] = value;
+    }
+}
+
+/* Check that TABLE holds exactly the contents of REFERENCE.  */
+
+static void
+check_contents (table_type &table, const std::map<int, int> &reference)
+{
+  SELF_CHECK (table.size () == reference.size ());
+  for (const auto &item : reference)
+    {
+      element **elt = table.find (item.first, item.first);
+      SELF_CHECK (elt != nullptr);
+      SELF_CHECK ((*elt)->value == item.second);
+    }
+
+  size_t count = 0;
+  table.for_each ([&] (element *elt)
+    {
+      SELF_CHECK (reference.count (elt->key) == 1);
+      ++count;
+    });
+  SELF_CHECK (count == reference.size ());
+}
+
+static void
+test_hash_table ()
+{
+  live_elements = 0;
+
+  {
+    table_type table;
+    std::map<int, int> reference;
+
+    SELF_CHECK (table.empty ());
+    SELF_CHECK (table.find (1, 1) == nullptr);
+    SELF_CHECK (!table.erase (1, 1));
+
+    /* Enough to grow the table several times.  */
+    for (int i = 0; i < 1000; ++i)
+      insert (table, reference, i * 7, i);
+    check_contents (table, reference);
+
+    /* Inserting again finds the existing elements.  */
+    for (int i = 0; i < 1000; i += 3)
+      insert (table, reference, i * 7, -i);
+    check_contents (table, reference);
+
+    /* Erase some, leaving deleted slots behind, then insert new
+       elements that reuse them.  */
+    for (int i = 0; i < 1000; i += 2)
+      {
+	SELF_CHECK (table.erase (i * 7, i * 7));
+	reference.erase (i * 7);
+      }
+    SELF_CHECK (table.find (0, 0) == nullptr);
+    check_contents (table, reference);
+    for (int i = 0; i < 2000; ++i)
+      insert (table, reference, i * 7 + 1, i);
+    check_contents (table, reference);
+
+    /* Keys whose hashes only differ in their high bits.  */
+    size_t before = table.size ();
+    for (int i = 0; i < 100; ++i)
+      insert (table, reference, 1 << 20 | i << 24, i);
+    SELF_CHECK (table.size () == before + 100);
+    check_contents (table, reference);
+
+    table.clear ();
+    reference.clear ();
+    SELF_CHECK (live_elements == 0);
+    check_contents (table, reference);
+
+    for (int i = 0; i < 10; ++i)
+      insert (table, reference, i, i);
+    check_contents (table, reference);
+
+    gdb::hash_table_statistics stats = table.statistics ();
+    SELF_CHECK (stats.elements == 10);
+    SELF_CHECK (stats.capacity >= 16);
+    SELF_CHECK (stats.searches > 0);
+  }
+
+  /* The destructor removes the remaining elements.  */
+  SELF_CHECK (live_elements == 0);
+
+  /* A table reserved in advance is not rebuilt while filling it.  */
+  {
+    table_type table (500);
+    std::map<int, int> reference;
+    unsigned long rebuilds = table.statistics ().rebuilds;
+    for (int i = 0; i < 500; ++i)
+      insert (table, reference, i, i);
+    SELF_CHECK (table.statistics ().rebuilds == rebuilds);
+    check_contents (table, reference);
+  }
+  SELF_CHECK (live_elements == 0);
+}
+
+} /* namespace hash_table_tests */
+} /* namespace selftests */
+
+void _initialize_hash_table_selftests ();
+void
+_initialize_hash_table_selftests ()
+{
+  selftests::register_test ("hash_table",
+			    selftests::hash_table_tests::test_hash_table);
+}
@@ -60,6 +60,22 @@ test (int n_threads)
 
   SELF_CHECK (counter == NUMBER);
 
+  /* Elements get more expensive along the range; check that the
+     weighted split still covers every element exactly once.  */
+  counter = 0;
+  auto task_size = [] (int iter)
+    {
+      return (size_t) iter + 1;
+    };
+  gdb::parallel_for_each (1, 0, NUMBER,
+			  [&] (int start, int end)
+			  {
+			    counter += end - start;
+			  },
+			  gdb::function_view<size_t (int)> (task_size));
+
+  SELF_CHECK (counter == NUMBER);
+
 #undef NUMBER
 }
 
@@ -45,6 +45,7 @@
 #include "inferior.h"
 #include "gdbsupport/selftest.h"
 #include "selftest-arch.h"
+#include "tracepoint.h"
 
 /* Maximum number of wchars returned from wchar_iterate.  */
 #define MAX_WCHARS 4
@@ -1004,6 +1005,50 @@ generic_value_print (struct value *val, struct ui_file *stream, int recurse,
     }
 }
 
+/* Return true if VAL is a lazy array in memory, whose elements
+   value_print_array_elements can read as it prints them rather than
+   all at once.  Such a value can't be optimized out, and outside of a
+   traceframe it can't be unavailable either, so whether it can be
+   printed doesn't depend on its contents.  */
+
+static bool
+val_print_array_on_demand_p (struct value *val)
+{
+  return (value_lazy (val)
+	  && VALUE_LVAL (val) == lval_memory
+	  && value_bitsize (val) == 0
+	  && value_embedded_offset (val) == 0
+	  && check_typedef (value_type (val))->code () == TYPE_CODE_ARRAY
+	  && get_traceframe_number () < 0);
+}
+
+/* See valprint.h.  */
+
+bool
+val_print_fetch_array_part (struct value *val,
+			    const struct value_print_options *options)
+{
+  if (!val_print_array_on_demand_p (val))
+    return false;
+
+  struct type *type = check_typedef (value_type (val));
+  LONGEST low_bound, high_bound;
+
+  if (!get_array_bounds (type, &low_bound, &high_bound)
+      || low_bound > high_bound)
+    return false;
+
+  ULONGEST len = high_bound - low_bound + 1;
+  ULONGEST eltlen = type_length_units (check_typedef (TYPE_TARGET_TYPE (type)));
+
+  if (eltlen == 0 || len <= options->print_max)
+    return false;
+
+  value_fetch_lazy_part (val, value_embedded_offset (val),
+			 options->print_max * eltlen);
+  return value_lazy (val);
+}
+
 /* Print using the given LANGUAGE the value VAL onto stream STREAM according
    to OPTIONS.
 
@@ -1022,7 +1067,7 @@ common_val_print (struct value *value, struct ui_file *stream, int recurse,
        get a fixed representation of our value.  */
     value = ada_to_fixed_value (value);
 
-  if (value_lazy (value))
+  if (value_lazy (value) && !val_print_array_on_demand_p (value))
     value_fetch_lazy (value);
 
   struct value_print_options local_opts = *options;
@@ -1111,7 +1156,11 @@ value_check_printable (struct value *val, struct ui_file *stream,
       return 0;
     }
 
-  if (value_entirely_optimized_out (val))
+  /* Don't read all of a large array just to find out whether it is
+     all there.  */
+  if (val_print_array_on_demand_p (val))
+    ;
+  else if (value_entirely_optimized_out (val))
     {
       if (options->summary && !val_print_scalar_type_p (value_type (val)))
 	gdb_printf (stream, "...");
@@ -1119,8 +1168,7 @@ value_check_printable (struct value *val, struct ui_file *stream,
 	val_print_optimized_out (val, stream);
       return 0;
     }
-
-  if (value_entirely_unavailable (val))
+  else if (value_entirely_unavailable (val))
     {
       if (options->summary && !val_print_scalar_type_p (value_type (val)))
 	gdb_printf (stream, "...");
@@ -1951,12 +1999,32 @@ value_print_array_elements (struct value *val, struct ui_file *stream,
       len = 0;
     }
 
+  /* If VAL is still lazy, read its elements as they are needed rather
+     than all at once: first as many as can be printed, then, if
+     repeated elements were elided, in chunks doubling in size.  */
+  unsigned int fetched_end = 0;
+  ULONGEST chunk = std::max (1u, std::min (len, options->print_max));
+  auto fetch_element = [&] (unsigned int n)
+    {
+      if (n < fetched_end || !value_lazy (val))
+	return;
+
+      ULONGEST count = std::min<ULONGEST> (len - n, chunk);
+      value_fetch_lazy_part (val,
+			     value_embedded_offset (val) + (LONGEST) n * eltlen,
+			     count * eltlen);
+      fetched_end = n + count;
+      chunk *= 2;
+    };
+
   annotate_array_section_begin (i, elttype);
 
   for (; i < len && things_printed < options->print_max; i++)
     {
       scoped_value_mark free_values;
 
+      fetch_element (i);
+
       if (i != 0)
 	{
 	  if (options->prettyformat_arrays)
@@ -1983,9 +2051,10 @@ value_print_array_elements (struct value *val, struct ui_file *stream,
       if (options->repeat_count_threshold < UINT_MAX)
 	{
 	  while (rep1 < len
-		 && value_contents_eq (val, i * eltlen,
-				       val, rep1 * eltlen,
-				       eltlen))
+		 && (fetch_element (rep1),
+		     value_contents_eq (val, i * eltlen,
+					val, rep1 * eltlen,
+					eltlen)))
 	    {
 	      ++reps;
 	      ++rep1;
@@ -132,7 +132,15 @@ extern void maybe_print_array_index (struct type *index_type, LONGEST index,
 				     const struct value_print_options *);
 
 
-/* Print elements of an array.  */
+/* If VAL is a lazy array in memory that would not be printed in full
+   according to OPTIONS, read only the elements that will be printed
+   and return true.  Otherwise, leave VAL alone and return false.  */
+
+extern bool val_print_fetch_array_part
+  (struct value *val, const struct value_print_options *options);
+
+/* Print elements of an array.  If VAL is lazy, only the elements that
+   are printed are read.  */
 
 extern void value_print_array_elements (struct value *, struct ui_file *, int,
 					const struct value_print_options *,
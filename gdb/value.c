@@ -168,6 +168,27 @@ ranges_contain (const std::vector<range> &ranges, LONGEST offset,
   return 0;
 }
 
+/* Returns true if RANGES covers all of [OFFSET, OFFSET+LENGTH).  */
+
+static bool
+ranges_cover (const std::vector<range> &ranges, LONGEST offset,
+	      LONGEST length)
+{
+  range what;
+
+  what.offset = offset;
+  what.length = length;
+
+  /* Since the ranges are sorted and coalesced, only the last range
+     starting at or before OFFSET can cover it.  */
+  auto i = std::upper_bound (ranges.begin (), ranges.end (), what);
+  if (i == ranges.begin ())
+    return false;
+
+  --i;
+  return i->offset + i->length >= offset + length;
+}
+
 static struct cmd_list_element *functionlist;
 
 /* Note that the fields in this structure are arranged to save a bit
@@ -365,8 +386,31 @@ struct value
      treated pretty much the same, except not-saved registers have a
      different string representation and related error strings.  */
   std::vector<range> optimized_out;
+
+  /* For a lazy value in memory of which only parts were needed so
+     far, the ranges of CONTENTS that were already read, in
+     addressable units.  See value_fetch_lazy_part.  Empty if the value
+     is not lazy or no part of it was read yet.  */
+  std::vector<range> fetched;
 };
 
+/* Return true if the LENGTH bits of VALUE's contents starting at
+   OFFSET bits can be looked at: VALUE is not lazy, or those bits were
+   read by value_fetch_lazy_part already.  */
+
+static bool
+value_bits_fetched_p (const struct value *value, LONGEST offset,
+		      LONGEST length)
+{
+  if (!value->lazy)
+    return true;
+
+  LONGEST first = offset / TARGET_CHAR_BIT;
+  LONGEST last = (offset + length + TARGET_CHAR_BIT - 1) / TARGET_CHAR_BIT;
+
+  return ranges_cover (value->fetched, first, last - first);
+}
+
 /* See value.h.  */
 
 struct gdbarch *
@@ -850,7 +894,8 @@ value_contents_bits_eq (const struct value *val1, int offset1,
   struct ranges_and_idx rp1[2], rp2[2];
 
   /* See function description in value.h.  */
-  gdb_assert (!val1->lazy && !val2->lazy);
+  gdb_assert (value_bits_fetched_p (val1, offset1, length)
+	      && value_bits_fetched_p (val2, offset2, length));
 
   /* We shouldn't be trying to compare past the end of the values.  */
   gdb_assert (offset1 + length
@@ -1334,8 +1379,11 @@ value_contents_copy_raw (struct value *dst, LONGEST dst_offset,
   /* A lazy DST would make that this copy operation useless, since as
      soon as DST's contents were un-lazied (by a later value_contents
      call, say), the contents would be overwritten.  A lazy SRC would
-     mean we'd be copying garbage.  */
-  gdb_assert (!dst->lazy && !src->lazy);
+     mean we'd be copying garbage, unless the part being copied was
+     read already.  */
+  gdb_assert (!dst->lazy);
+  gdb_assert (value_bits_fetched_p (src, src_offset * unit_size * HOST_CHAR_BIT,
+				    length * unit_size * HOST_CHAR_BIT));
 
   /* The overwritten DST range gets unavailability ORed in, not
      replaced.  Make sure to remember to implement replacing if it
@@ -1378,7 +1426,10 @@ void
 value_contents_copy (struct value *dst, LONGEST dst_offset,
 		     struct value *src, LONGEST src_offset, LONGEST length)
 {
-  if (src->lazy)
+  int unit_size = gdbarch_addressable_memory_unit_size (get_value_arch (src));
+
+  if (!value_bits_fetched_p (src, src_offset * unit_size * HOST_CHAR_BIT,
+			     length * unit_size * HOST_CHAR_BIT))
     value_fetch_lazy (src);
 
   value_contents_copy_raw (dst, dst_offset, src, src_offset, length);
@@ -1727,8 +1778,13 @@ value_copy (const value *arg)
   val->stack = arg->stack;
   val->is_zero = arg->is_zero;
   val->initialized = arg->initialized;
-  val->unavailable = arg->unavailable;
-  val->optimized_out = arg->optimized_out;
+  if (!value_lazy (val))
+    {
+      /* Any ranges of a partly read lazy value are read again by the
+	 copy.  */
+      val->unavailable = arg->unavailable;
+      val->optimized_out = arg->optimized_out;
+    }
 
   if (!value_lazy (val) && !value_entirely_optimized_out (val))
     {
@@ -1868,16 +1924,17 @@ set_value_component_location (struct value *component,
 /* Access to the value history.  */
 
 /* Record a new value in the value history.
-   Returns the absolute history index of the entry.  */
+   Returns the absolute history index of the entry.  If PARTIAL, VAL
+   may still be lazy; see record_latest_value in value.h.  */
 
 int
-record_latest_value (struct value *val)
+record_latest_value (struct value *val, bool partial)
 {
   /* We don't want this value to have anything to do with the inferior anymore.
      In particular, "set $1 = 50" should not affect the variable from which
      the value was taken, and fast watchpoints should be able to assume that
      a value on the value history never changes.  */
-  if (value_lazy (val))
+  if (value_lazy (val) && !partial)
     value_fetch_lazy (val);
   /* We preserve VALUE_LVAL so that the user can find out where it was fetched
      from.  This is a bit dubious, because then *&$1 does not just return $1
@@ -3730,7 +3787,9 @@ value_from_component (struct value *whole, struct type *type, LONGEST offset)
 {
   struct value *v;
 
-  if (VALUE_LVAL (whole) == lval_memory && value_lazy (whole))
+  if (VALUE_LVAL (whole) == lval_memory && value_lazy (whole)
+      && !ranges_cover (whole->fetched, value_embedded_offset (whole) + offset,
+			type_length_units (type)))
     v = allocate_value_lazy (type);
   else
     {
@@ -3908,6 +3967,42 @@ value_fetch_lazy_bitfield (struct value *val)
 			 value_offset (val), parent);
 }
 
+/* Read the LENGTH addressable units of the contents of VAL, a lazy
+   value in memory, starting at OFFSET, skipping those that were
+   already read.  Record them in VAL's fetched ranges.  */
+
+static void
+value_fetch_memory_range (struct value *val, LONGEST offset, LONGEST length)
+{
+  CORE_ADDR addr = value_address (val);
+  int unit_size = gdbarch_addressable_memory_unit_size (get_value_arch (val));
+  gdb_byte *buf = value_contents_all_raw (val).data ();
+  LONGEST end = offset + length;
+  std::vector<range> gaps;
+
+  /* Find the parts of the range not read yet.  */
+  for (const range &r : val->fetched)
+    {
+      if (r.offset + r.length <= offset)
+	continue;
+      if (r.offset >= end)
+	break;
+      if (r.offset > offset)
+	gaps.push_back ({offset, r.offset - offset});
+      offset = std::max (offset, r.offset + r.length);
+    }
+  if (offset < end)
+    gaps.push_back ({offset, end - offset});
+
+  for (const range &gap : gaps)
+    {
+      read_value_memory (val, gap.offset * unit_size * HOST_CHAR_BIT,
+			 value_stack (val), addr + gap.offset,
+			 buf + gap.offset * unit_size, gap.length);
+      insert_into_bit_range_vector (&val->fetched, gap.offset, gap.length);
+    }
+}
+
 /* Helper for value_fetch_lazy when the value is in memory.  */
 
 static void
@@ -3915,13 +4010,78 @@ value_fetch_lazy_memory (struct value *val)
 {
   gdb_assert (VALUE_LVAL (val) == lval_memory);
 
-  CORE_ADDR addr = value_address (val);
   struct type *type = check_typedef (value_enclosing_type (val));
 
   if (TYPE_LENGTH (type))
-      read_value_memory (val, 0, value_stack (val),
-			 addr, value_contents_all_raw (val).data (),
-			 type_length_units (type));
+    value_fetch_memory_range (val, 0, type_length_units (type));
+  val->fetched.clear ();
+}
+
+/* See value.h.  */
+
+void
+value_fetch_lazy_part (struct value *val, LONGEST offset, LONGEST length)
+{
+  if (!value_lazy (val))
+    return;
+
+  struct type *type = check_typedef (value_enclosing_type (val));
+  LONGEST total = type_length_units (type);
+
+  offset = std::max<LONGEST> (offset, 0);
+  length = std::min (length, total - offset);
+
+  /* Only plain values in memory can be read in parts.  */
+  if (VALUE_LVAL (val) != lval_memory
+      || val->is_zero
+      || value_bitsize (val) != 0
+      || length >= total)
+    {
+      value_fetch_lazy (val);
+      return;
+    }
+
+  if (length <= 0)
+    return;
+
+  allocate_value_contents (val);
+  value_fetch_memory_range (val, offset, length);
+
+  if (ranges_cover (val->fetched, 0, total))
+    {
+      val->fetched.clear ();
+      set_value_lazy (val, 0);
+    }
+}
+
+/* See value.h.  */
+
+void
+value_finish_partial_fetch (struct value *val)
+{
+  if (!value_lazy (val) || val->fetched.empty ())
+    return;
+
+  struct type *type = check_typedef (value_enclosing_type (val));
+  int unit_size = gdbarch_addressable_memory_unit_size (get_value_arch (val));
+  LONGEST total = type_length_units (type);
+  LONGEST offset = 0;
+
+  /* Mark everything between the fetched ranges unavailable.  */
+  for (const range &r : val->fetched)
+    {
+      if (r.offset > offset)
+	mark_value_bits_unavailable (val, offset * unit_size * HOST_CHAR_BIT,
+				     ((r.offset - offset)
+				      * unit_size * HOST_CHAR_BIT));
+      offset = r.offset + r.length;
+    }
+  if (offset < total)
+    mark_value_bits_unavailable (val, offset * unit_size * HOST_CHAR_BIT,
+				 (total - offset) * unit_size * HOST_CHAR_BIT);
+
+  val->fetched.clear ();
+  set_value_lazy (val, 0);
 }
 
 /* Helper for value_fetch_lazy when the value is in a register.  */
@@ -4058,9 +4218,9 @@ value_fetch_lazy (struct value *val)
   allocate_value_contents (val);
   /* A value is either lazy, or fully fetched.  The
      availability/validity is only established as we try to fetch a
-     value.  */
+     value, or parts of it (see value_fetch_lazy_part).  */
   gdb_assert (val->optimized_out.empty ());
-  gdb_assert (val->unavailable.empty ());
+  gdb_assert (val->unavailable.empty () || !val->fetched.empty ());
   if (val->is_zero)
     {
       /* Nothing.  */
@@ -390,6 +390,22 @@ extern gdb::array_view<const gdb_byte>
 
 extern void value_fetch_lazy (struct value *val);
 
+/* Read the LENGTH addressable units of the contents of the lazy value
+   VAL starting at OFFSET (both relative to the start of VAL's
+   enclosing type), rather than all of VAL.  Nothing is read twice;
+   once all of VAL was read this way, VAL is no longer lazy.  Only
+   plain values in memory can be read in parts; other values are read
+   in full.  Does nothing if VAL is not lazy.  */
+
+extern void value_fetch_lazy_part (struct value *val, LONGEST offset,
+				   LONGEST length);
+
+/* If parts of the lazy value VAL were read by value_fetch_lazy_part,
+   make VAL no longer lazy, with the parts that were not read marked
+   unavailable.  */
+
+extern void value_finish_partial_fetch (struct value *val);
+
 /* If nonzero, this is the value of a variable which does not actually
    exist in the program, at least partially.  If the value is lazy,
    this may fetch it now.  */
@@ -593,7 +609,8 @@ extern void mark_value_bits_unavailable (struct value *value,
    if we've tried to read it.  As this routine is used by printing
    routines, which may be printing values in the value history, long
    after the inferior is gone, it works with const values.  Therefore,
-   this routine must not be called with lazy values.  */
+   this routine must not be called with lazy values, unless the parts
+   being compared were read by value_fetch_lazy_part.  */
 
 extern bool value_contents_eq (const struct value *val1, LONGEST offset1,
 			       const struct value *val2, LONGEST offset2,
@@ -1066,7 +1083,13 @@ extern int destructor_name_p (const char *name, struct type *type);
 
 extern value_ref_ptr release_value (struct value *val);
 
-extern int record_latest_value (struct value *val);
+/* Record VAL in the value history and return its index there.  VAL
+   is read in full first, unless PARTIAL is true: then VAL may stay
+   lazy, or partly read, until value_finish_partial_fetch is called on
+   it, which the caller must do before anything else looks at the
+   value history.  */
+
+extern int record_latest_value (struct value *val, bool partial = false);
 
 extern void modify_field (struct type *type, gdb_byte *addr,
 			  LONGEST fieldval, LONGEST bitpos, LONGEST bitsize);
@@ -31,6 +31,7 @@
 #include "varobj-iter.h"
 #include "parser-defs.h"
 #include "gdbarch.h"
+#include "observable.h"
 #include <algorithm>
 
 #if HAVE_PYTHON
@@ -1182,6 +1183,53 @@ update_type_if_necessary (struct varobj *var, struct value *new_value)
 
    The VALUE parameter should not be released -- the function will
    take care of releasing it when needed.  */
+/* Incremented whenever a setting changes, as that may change how
+   values are printed.  */
+
+static unsigned int varobj_print_generation;
+
+/* Called when the setting PARAM changes.  */
+
+static void
+varobj_command_param_changed (const char *param, const char *value)
+{
+  ++varobj_print_generation;
+}
+
+/* Return true if VALUE, the new value of VAR, has the same type and
+   contents as its current value, and would be printed the same way.
+   This is only known for scalars: pointers, for instance, may print the
+   string or the symbol they point to, which may have changed.  */
+
+static bool
+varobj_value_contents_unchanged (const struct varobj *var,
+				 struct value *value)
+{
+  struct value *old = var->value.get ();
+
+  if (old == nullptr || value_lazy (old) || var->print_value.empty ()
+      || var->print_value_generation != varobj_print_generation
+      || value_type (old) != value_type (value))
+    return false;
+
+  struct type *type = check_typedef (value_type (value));
+
+  switch (type->code ())
+    {
+    case TYPE_CODE_INT:
+    case TYPE_CODE_CHAR:
+    case TYPE_CODE_BOOL:
+    case TYPE_CODE_ENUM:
+    case TYPE_CODE_FLT:
+    case TYPE_CODE_DECFLOAT:
+      break;
+    default:
+      return false;
+    }
+
+  return value_contents_eq (old, 0, value, 0, TYPE_LENGTH (type));
+}
+
 static bool
 install_new_value (struct varobj *var, struct value *value, bool initial)
 { 
@@ -1269,11 +1317,18 @@ install_new_value (struct varobj *var, struct value *value, bool initial)
   /* Below, we'll be comparing string rendering of old and new
      values.  Don't get string rendering if the value is
      lazy -- if it is, the code above has decided that the value
-     should not be fetched.  */
+     should not be fetched.  Rendering is the most expensive part of
+     an update, so reuse the old string if the value did not change.  */
   std::string print_value;
   if (value != NULL && !value_lazy (value)
       && var->dynamic->pretty_printer == NULL)
-    print_value = varobj_value_get_print_value (value, var->format, var);
+    {
+      if (!initial && !var->updated
+	  && varobj_value_contents_unchanged (var, value))
+	print_value = var->print_value;
+      else
+	print_value = varobj_value_get_print_value (value, var->format, var);
+    }
 
   /* If the type is changeable, compare the old and the new values.
      If this is the initial assignment, we don't have any old value
@@ -1348,6 +1403,7 @@ install_new_value (struct varobj *var, struct value *value, bool initial)
 	changed = true;
     }
   var->print_value = print_value;
+  var->print_value_generation = varobj_print_generation;
 
   gdb_assert (var->value == nullptr || value_type (var->value.get ()));
 
@@ -2400,6 +2456,9 @@ _initialize_varobj ()
   varobj_table = htab_create_alloc (5, hash_varobj, eq_varobj_and_string,
 				    nullptr, xcalloc, xfree);
 
+  gdb::observers::command_param_changed.attach (varobj_command_param_changed,
+						"varobj");
+
   add_setshow_zuinteger_cmd ("varobj", class_maintenance,
 			     &varobjdebug,
 			     _("Set varobj debugging."),
@@ -84,6 +84,11 @@ struct thread_info
 
 extern std::list<thread_info *> all_threads;
 
+/* Incremented whenever a thread is added to or removed from
+   ALL_THREADS, or the properties reported for the threads may have
+   changed.  Reported by the qThreadListGeneration packet.  */
+extern unsigned int thread_list_generation;
+
 void remove_thread (struct thread_info *thread);
 struct thread_info *add_thread (ptid_t ptid, void *target_data);
 
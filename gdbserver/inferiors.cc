@@ -25,6 +25,7 @@
 
 std::list<process_info *> all_processes;
 std::list<thread_info *> all_threads;
+unsigned int thread_list_generation;
 
 /* The current process.  */
 static process_info *current_process_;
@@ -44,6 +45,7 @@ add_thread (ptid_t thread_id, void *target_data)
   thread_info *new_thread = new thread_info (thread_id, target_data);
 
   all_threads.push_back (new_thread);
+  thread_list_generation++;
 
   if (current_thread == NULL)
     switch_to_thread (new_thread);
@@ -103,6 +105,7 @@ remove_thread (struct thread_info *thread)
 
   discard_queued_stop_replies (ptid_of (thread));
   all_threads.remove (thread);
+  thread_list_generation++;
   if (current_thread == thread)
     switch_to_thread (nullptr);
   free_one_thread (thread);
@@ -131,6 +134,7 @@ clear_inferiors (void)
 {
   for_each_thread (free_one_thread);
   all_threads.clear ();
+  thread_list_generation++;
 
   clear_dlls ();
 
@@ -53,6 +53,7 @@
 #include "gdbsupport/environ.h"
 #include "gdbsupport/gdb-sigmask.h"
 #include "gdbsupport/scoped_restore.h"
+#include <unordered_map>
 #ifndef ELFMAG0
 /* Don't include <linux/elf.h> here.  If it got included by gdb_proc_service.h
    then ELFMAG0 will have been defined.  If it didn't get included by
@@ -381,6 +382,12 @@ linux_pid_exe_is_elf_64_file (int pid, unsigned int *machine)
   return elf_64_file_p (file, machine);
 }
 
+/* All the LWPs, indexed by LWP id.  find_lwp_pid is called for every
+   wait status we collect, so with thousands of LWPs a linear search of
+   the thread list would make stopping and resuming all of them
+   quadratic.  */
+static std::unordered_map<int, lwp_info *> lwps_by_lwpid;
+
 void
 linux_process_target::delete_lwp (lwp_info *lwp)
 {
@@ -388,6 +395,7 @@ linux_process_target::delete_lwp (lwp_info *lwp)
 
   threads_debug_printf ("deleting %ld", lwpid_of (thr));
 
+  lwps_by_lwpid.erase (lwpid_of (thr));
   remove_thread (thr);
 
   low_delete_thread (lwp->arch_private);
@@ -910,6 +918,7 @@ linux_process_target::add_lwp (ptid_t ptid)
   lwp_info *lwp = new lwp_info;
 
   lwp->thread = add_thread (ptid, lwp);
+  lwps_by_lwpid[ptid.lwp ()] = lwp;
 
   low_new_thread (lwp);
 
@@ -1731,16 +1740,13 @@ linux_process_target::status_pending_p_callback (thread_info *thread,
 struct lwp_info *
 find_lwp_pid (ptid_t ptid)
 {
-  thread_info *thread = find_thread ([&] (thread_info *thr_arg)
-    {
-      int lwp = ptid.lwp () != 0 ? ptid.lwp () : ptid.pid ();
-      return thr_arg->id.lwp () == lwp;
-    });
+  int lwp = ptid.lwp () != 0 ? ptid.lwp () : ptid.pid ();
+  auto it = lwps_by_lwpid.find (lwp);
 
-  if (thread == NULL)
+  if (it == lwps_by_lwpid.end ())
     return NULL;
 
-  return get_thread_lwp (thread);
+  return it->second;
 }
 
 /* Return the number of known LWPs in the tgid given by PID.  */
@@ -3288,7 +3294,8 @@ linux_process_target::wait_1 (ptid_t ptid, target_waitstatus *ourstatus,
 
   /* If GDB wanted this thread to single step, and the thread is out
      of the step range, we always want to report the SIGTRAP, and let
-     GDB handle it.  Watchpoints should always be reported.  So should
+     GDB handle it.  Watchpoints should always be reported, unless GDB
+     gave us a condition for them and it is false.  So should
      signals we can't explain.  A SIGTRAP we can't explain could be a
      GDB breakpoint --- we may or not support Z0 breakpoints.  If we
      do, we're be able to handle GDB breakpoints on top of internal
@@ -3299,14 +3306,21 @@ linux_process_target::wait_1 (ptid_t ptid, target_waitstatus *ourstatus,
      That indicates that we had previously finished a single-step but
      left the single-step pending -- see
      complete_ongoing_step_over.  */
+  bool watchpoint_filtered
+    = (event_child->stop_reason == TARGET_STOPPED_BY_WATCHPOINT
+       && !gdb_condition_true_at_watchpoint
+	     (event_child->stopped_data_address));
+
   report_to_gdb = (!maybe_internal_trap
 		   || (current_thread->last_resume_kind == resume_step
 		       && !in_step_range)
-		   || event_child->stop_reason == TARGET_STOPPED_BY_WATCHPOINT
+		   || (event_child->stop_reason == TARGET_STOPPED_BY_WATCHPOINT
+		       && !watchpoint_filtered)
 		   || (!in_step_range
 		       && !bp_explains_trap
 		       && !trace_event
 		       && !step_over_finished
+		       && !watchpoint_filtered
 		       && !(current_thread->last_resume_kind == resume_continue
 			    && event_child->stop_reason == TARGET_STOPPED_BY_SINGLE_STEP))
 		   || (gdb_breakpoint_here (event_child->stop_pc)
@@ -3330,6 +3344,9 @@ linux_process_target::wait_1 (ptid_t ptid, target_waitstatus *ourstatus,
       if (trace_event)
 	threads_debug_printf ("Tracepoint event.");
 
+      if (watchpoint_filtered)
+	threads_debug_printf ("Watchpoint condition false.");
+
       if (lwp_in_step_range (event_child))
 	threads_debug_printf ("Range stepping pc 0x%s [0x%s, 0x%s).",
 			      paddress (event_child->stop_pc),
@@ -5375,6 +5392,23 @@ proc_xfer_memory (CORE_ADDR memaddr, unsigned char *readbuf,
 
   process_info *proc = current_process ();
 
+#ifdef __NR_process_vm_readv
+  /* Try reading with a single process_vm_readv call first.  It copies
+     straight from the inferior's address space without going through
+     the /proc file.  Unlike /proc/PID/mem, it honours the page
+     protections, so fall back to the file for anything it can't read
+     in full, such as PROT_NONE pages.  */
+  if (readbuf != nullptr && memaddr == (uintptr_t) memaddr)
+    {
+      struct iovec local_iov = { readbuf, (size_t) len };
+      struct iovec remote_iov = { (void *) (uintptr_t) memaddr, (size_t) len };
+
+      if (syscall (__NR_process_vm_readv, proc->pid, &local_iov, 1UL,
+		   &remote_iov, 1UL, 0UL) == len)
+	return 0;
+    }
+#endif
+
   int fd = proc->priv->mem_fd;
   if (fd == -1)
     return EIO;
@@ -6459,13 +6493,11 @@ struct link_map_offsets
     int l_prev_offset;
   };
 
-/* Construct qXfer:libraries-svr4:read reply.  */
+/* Build the qXfer:libraries-svr4 document described by ANNEX into
+   DOCUMENT.  Return false if the inferior has no r_debug.  */
 
-int
-linux_process_target::qxfer_libraries_svr4 (const char *annex,
-					    unsigned char *readbuf,
-					    unsigned const char *writebuf,
-					    CORE_ADDR offset, int len)
+static bool
+build_libraries_svr4_document (const char *annex, std::string &document)
 {
   struct process_info_private *const priv = current_process ()->priv;
   char filename[PATH_MAX];
@@ -6499,11 +6531,6 @@ linux_process_target::qxfer_libraries_svr4 (const char *annex,
   CORE_ADDR l_name, l_addr, l_ld, l_next, l_prev;
   int header_done = 0;
 
-  if (writebuf != NULL)
-    return -2;
-  if (readbuf == NULL)
-    return -1;
-
   pid = lwpid_of (current_thread);
   xsnprintf (filename, sizeof filename, "/proc/%d/exe", pid);
   is_elf64 = elf_64_file_p (filename, &machine);
@@ -6548,7 +6575,7 @@ linux_process_target::qxfer_libraries_svr4 (const char *annex,
 	 for this inferior - do not retry it.  Report it to GDB as
 	 E01, see for the reasons at the GDB solib-svr4.c side.  */
       if (priv->r_debug == (CORE_ADDR) -1)
-	return -1;
+	return false;
 
       if (priv->r_debug != 0)
 	{
@@ -6568,7 +6595,7 @@ linux_process_target::qxfer_libraries_svr4 (const char *annex,
 	}
     }
 
-  std::string document = "<library-list-svr4 version=\"1.0\"";
+  document = "<library-list-svr4 version=\"1.0\"";
 
   while (lm_addr
 	 && read_one_ptr (lm_addr + lmo->l_name_offset,
@@ -6636,6 +6663,42 @@ linux_process_target::qxfer_libraries_svr4 (const char *annex,
   else
     document += "</library-list-svr4>";
 
+  return true;
+}
+
+/* Construct qXfer:libraries-svr4:read reply.  */
+
+int
+linux_process_target::qxfer_libraries_svr4 (const char *annex,
+					    unsigned char *readbuf,
+					    unsigned const char *writebuf,
+					    CORE_ADDR offset, int len)
+{
+  /* The document built for the last transfer, and the process and
+     annex it was built for.  */
+  static std::string document;
+  static std::string document_annex;
+  static int document_pid = -1;
+
+  if (writebuf != NULL)
+    return -2;
+  if (readbuf == NULL)
+    return -1;
+
+  /* With hundreds of libraries the document spans many packets.  Walk
+     the link map only when a transfer starts, and serve the remaining
+     chunks from the saved document instead of re-reading every
+     link_map entry for each packet.  */
+  int pid = pid_of (current_process ());
+  if (offset == 0 || pid != document_pid || document_annex != annex)
+    {
+      document_pid = -1;
+      if (!build_libraries_svr4_document (annex, document))
+	return -1;
+      document_pid = pid;
+      document_annex = annex;
+    }
+
   int document_len = document.length ();
   if (offset < document_len)
     document_len -= offset;
@@ -106,6 +106,8 @@ public:
 
   bool supports_z_point_type (char z_type) override;
 
+  bool supports_conditional_watchpoints () override;
+
   void process_qsupported (gdb::array_view<const char * const> features) override;
 
   bool supports_tracepoints () override;
@@ -646,6 +648,15 @@ x86_target::supports_z_point_type (char z_type)
     }
 }
 
+/* x86 watchpoints trigger after the access, so a thread that hit one
+   can be resumed as is.  */
+
+bool
+x86_target::supports_conditional_watchpoints ()
+{
+  return true;
+}
+
 int
 x86_target::low_insert_point (raw_bkpt_type type, CORE_ADDR addr,
 			      int size, raw_breakpoint *bp)
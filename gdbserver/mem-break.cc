@@ -379,6 +379,7 @@ insert_memory_breakpoint (struct raw_breakpoint *bp)
     {
       memcpy (bp->old_data, buf, bp_size (bp));
 
+      invalidate_memory_cache ();
       err = the_target->write_memory (bp->pc, bp_opcode (bp),
 				      bp_size (bp));
       if (err != 0)
@@ -1208,22 +1209,18 @@ add_breakpoint_condition (struct gdb_breakpoint *bp, const char **condition)
   return 1;
 }
 
-/* Evaluate condition (if any) at breakpoint BP.  Return 1 if
-   true and 0 otherwise.  */
+/* Evaluate the conditions (if any) of GDB breakpoint BP in the
+   context of the current thread.  Return 1 if true and 0
+   otherwise.  */
 
 static int
-gdb_condition_true_at_breakpoint_z_type (char z_type, CORE_ADDR addr)
+gdb_breakpoint_condition_true (struct gdb_breakpoint *bp)
 {
-  /* Fetch registers for the current inferior.  */
-  struct gdb_breakpoint *bp = find_gdb_breakpoint (z_type, addr, -1);
   ULONGEST value = 0;
   struct point_cond_list *cl;
   int err = 0;
   struct eval_agent_expr_context ctx;
 
-  if (bp == NULL)
-    return 0;
-
   /* Check if the breakpoint is unconditional.  If it is,
      the condition always evaluates to TRUE.  */
   if (bp->cond_list == NULL)
@@ -1251,6 +1248,56 @@ gdb_condition_true_at_breakpoint_z_type (char z_type, CORE_ADDR addr)
   return (value != 0);
 }
 
+/* Evaluate condition (if any) at breakpoint BP.  Return 1 if
+   true and 0 otherwise.  */
+
+static int
+gdb_condition_true_at_breakpoint_z_type (char z_type, CORE_ADDR addr)
+{
+  struct gdb_breakpoint *bp = find_gdb_breakpoint (z_type, addr, -1);
+
+  if (bp == NULL)
+    return 0;
+
+  return gdb_breakpoint_condition_true (bp);
+}
+
+/* See mem-break.h.  */
+
+int
+gdb_condition_true_at_watchpoint (CORE_ADDR data_addr)
+{
+  struct process_info *proc = current_process ();
+  int found = 0;
+
+  /* We don't know which address was accessed; let GDB sort it
+     out.  */
+  if (data_addr == 0)
+    return 1;
+
+  for (struct breakpoint *bp = proc->breakpoints; bp != NULL; bp = bp->next)
+    {
+      if (bp->type != gdb_breakpoint_Z2
+	  && bp->type != gdb_breakpoint_Z3
+	  && bp->type != gdb_breakpoint_Z4)
+	continue;
+
+      /* For watchpoints, the kind is the length of the watched
+	 range.  */
+      if (data_addr < bp->raw->pc
+	  || data_addr - bp->raw->pc >= (CORE_ADDR) bp->raw->kind)
+	continue;
+
+      found = 1;
+      if (gdb_breakpoint_condition_true ((struct gdb_breakpoint *) bp))
+	return 1;
+    }
+
+  /* If none of our watchpoints covers the address, GDB knows better
+     what it is.  */
+  return !found;
+}
+
 int
 gdb_condition_true_at_breakpoint (CORE_ADDR where)
 {
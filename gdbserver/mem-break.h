@@ -133,6 +133,13 @@ bool any_persistent_commands (process_info *proc);
 
 int gdb_condition_true_at_breakpoint (CORE_ADDR where);
 
+/* Evaluate the conditions of the GDB watchpoints covering DATA_ADDR,
+   the address that the current thread accessed.  Return 1 if any of
+   them is true or unconditional, or if no watchpoint covers
+   DATA_ADDR, and 0 otherwise.  */
+
+int gdb_condition_true_at_watchpoint (CORE_ADDR data_addr);
+
 int gdb_no_commands_at_breakpoint (CORE_ADDR where);
 
 void run_breakpoint_commands (CORE_ADDR where);
@@ -1030,6 +1030,10 @@ monitor_show_help (void)
   monitor_output ("    Options: all, none");
   monitor_output (", timestamp");
   monitor_output ("\n");
+  monitor_output ("  set memory-cache <0|1>\n");
+  monitor_output ("    Enable caching of inferior memory while stopped\n");
+  monitor_output ("  show memory-cache\n");
+  monitor_output ("    Show inferior memory cache statistics\n");
   monitor_output ("  exit\n");
   monitor_output ("    Quit GDBserver\n");
 }
@@ -1394,6 +1398,29 @@ handle_monitor_command (char *mon, char *own_buf)
     debug_set_output (nullptr);
   else if (startswith (mon, "set debug-file "))
     debug_set_output (mon + sizeof ("set debug-file ") - 1);
+  else if (strcmp (mon, "set memory-cache 1") == 0)
+    {
+      memory_cache_enabled = true;
+      monitor_output ("Memory caching enabled.\n");
+    }
+  else if (strcmp (mon, "set memory-cache 0") == 0)
+    {
+      memory_cache_enabled = false;
+      invalidate_memory_cache ();
+      monitor_output ("Memory caching disabled.\n");
+    }
+  else if (strcmp (mon, "show memory-cache") == 0)
+    {
+      unsigned long hits, misses, flushes;
+
+      memory_cache_stats (&hits, &misses, &flushes);
+      std::string msg
+	= string_printf ("Memory caching is %s.\n"
+			 "Hits: %lu, misses: %lu, flushes: %lu\n",
+			 memory_cache_enabled ? "enabled" : "disabled",
+			 hits, misses, flushes);
+      monitor_output (msg.c_str ());
+    }
   else if (strcmp (mon, "help") == 0)
     monitor_show_help ();
   else if (strcmp (mon, "exit") == 0)
@@ -2167,6 +2194,62 @@ supported_btrace_packets (char *buf)
   strcat (buf, ";qXfer:btrace-conf:read+");
 }
 
+/* Position of the next thread whose registers qsThreadRegisters
+   reports.  */
+static std::list<thread_info *>::const_iterator thread_regs_iter;
+
+/* Write into OWN_BUF the reply to a qfThreadRegisters or
+   qsThreadRegisters packet: the registers of as many of the stopped
+   threads starting at THREAD_REGS_ITER as fit in the packet, in 'g'
+   packet format, each preceded by the thread's id and a colon and
+   separated by semicolons.  The reply starts with 'm' if more threads
+   remain to be reported, and with 'l' otherwise.  */
+
+static void
+write_thread_registers (char *own_buf)
+{
+  char *p = own_buf + 1;
+
+  for (; thread_regs_iter != all_threads.end (); thread_regs_iter++)
+    {
+      thread_info *thread = *thread_regs_iter;
+
+      if (non_stop
+	  && the_target->supports_thread_stopped ()
+	  && !target_thread_stopped (thread))
+	continue;
+
+      struct regcache *regcache = get_thread_regcache (thread, 1);
+
+      /* Room for the separator, the thread id, the colon, the
+	 registers, and the terminating NUL.  */
+      int needed = 1 + 64 + 1 + 2 * regcache->tdesc->registers_size + 1;
+
+      if ((p - own_buf) + needed > PBUFSIZ)
+	{
+	  if (p == own_buf + 1)
+	    {
+	      /* Not even a single thread fits.  */
+	      write_enn (own_buf);
+	      return;
+	    }
+
+	  own_buf[0] = 'm';
+	  return;
+	}
+
+      if (p != own_buf + 1)
+	*p++ = ';';
+      p = write_ptid (p, thread->id);
+      *p++ = ':';
+      registers_to_string (regcache, p);
+      p += strlen (p);
+    }
+
+  own_buf[0] = 'l';
+  *p = '\0';
+}
+
 /* Handle all of the extended 'q' packets.  */
 
 static void
@@ -2237,6 +2320,10 @@ handle_query (char *own_buf, int packet_len, int *new_packet_len_p)
       if (current_thread != NULL)
 	the_target->look_up_symbols ();
 
+      /* Looking up symbols may have enabled libthread_db, which
+	 provides the thread handles.  */
+      thread_list_generation++;
+
       strcpy (own_buf, "OK");
       return;
     }
@@ -2274,6 +2361,28 @@ handle_query (char *own_buf, int packet_len, int *new_packet_len_p)
 	}
     }
 
+  if (strcmp ("qThreadListGeneration", own_buf) == 0)
+    {
+      sprintf (own_buf, "%x", thread_list_generation);
+      return;
+    }
+
+  if (strcmp ("qfThreadRegisters", own_buf) == 0
+      || strcmp ("qsThreadRegisters", own_buf) == 0)
+    {
+      require_running_or_return (own_buf);
+      if (cs.current_traceframe >= 0)
+	{
+	  write_enn (own_buf);
+	  return;
+	}
+
+      if (own_buf[1] == 'f')
+	thread_regs_iter = all_threads.begin ();
+      write_thread_registers (own_buf);
+      return;
+    }
+
   if (the_target->supports_read_offsets ()
       && strcmp ("qOffsets", own_buf) == 0)
     {
@@ -2470,6 +2579,8 @@ handle_query (char *own_buf, int packet_len, int *new_packet_len_p)
 	{
 	  strcat (own_buf, ";ConditionalBreakpoints+");
 	}
+      if (the_target->supports_conditional_watchpoints ())
+	strcat (own_buf, ";ConditionalWatchpoints+");
       strcat (own_buf, ";BreakpointCommands+");
 
       if (target_supports_agent ())
@@ -2492,6 +2603,17 @@ handle_query (char *own_buf, int packet_len, int *new_packet_len_p)
 
       strcat (own_buf, ";no-resumed+");
 
+      /* Packets are read into a buffer and handled in order, so GDB
+	 can send several memory reads before waiting for the
+	 replies.  */
+      strcat (own_buf, ";pipelined-memory-reads+");
+
+      strcat (own_buf, ";binary-upload+");
+
+      strcat (own_buf, ";qThreadRegisters+");
+
+      strcat (own_buf, ";qThreadListGeneration+");
+
       if (target_supports_memory_tagging ())
 	strcat (own_buf, ";memory-tagging+");
 
@@ -2907,6 +3029,7 @@ resume (struct thread_resume *actions, size_t num_actions)
       enable_async_io ();
     }
 
+  invalidate_memory_cache ();
   the_target->resume (actions, num_actions);
 
   if (non_stop)
@@ -4311,6 +4434,29 @@ process_serial_event (void)
 	  bin2hex (mem_buf, cs.own_buf, res);
       }
       break;
+    case 'x':
+      {
+	require_running_or_break (cs.own_buf);
+	decode_m_packet (&cs.own_buf[1], &mem_addr, &len);
+	/* The reply can't hold more than a packet's worth of data.  */
+	len = std::min (len, (unsigned int) PBUFSIZ - 1);
+	int res = gdb_read_memory (mem_addr, mem_buf, len);
+	if (res < 0)
+	  write_enn (cs.own_buf);
+	else
+	  {
+	    int out_len_units;
+
+	    /* Send as much of the data as fits once escaped; GDB
+	       handles the rest as a partial read.  */
+	    cs.own_buf[0] = 'b';
+	    new_packet_len
+	      = 1 + remote_escape_output (mem_buf, res, 1,
+					  (gdb_byte *) cs.own_buf + 1,
+					  &out_len_units, PBUFSIZ - 1);
+	  }
+      }
+      break;
     case 'M':
       require_running_or_break (cs.own_buf);
       decode_M_packet (&cs.own_buf[1], &mem_addr, &len, &mem_buf);
@@ -21,6 +21,8 @@
 #include "server.h"
 #include "tracepoint.h"
 #include "gdbsupport/byte-vector.h"
+#include <bitset>
+#include <unordered_map>
 #include "hostio.h"
 #include <fcntl.h>
 #include <unistd.h>
@@ -79,6 +81,157 @@ set_desired_process ()
   return proc != nullptr;
 }
 
+/* The inferior memory cache.  While all threads are stopped, memory
+   read from the inferior is kept in MEMORY_CACHE_LINE_SIZE lines, so
+   that the same stack and heap memory read again by the different
+   parts of GDB is not fetched from the system again.  Only the bytes
+   that were asked for are read and cached, so that no memory beyond
+   the requested range is touched.  The cache holds the raw target
+   memory, with any inserted breakpoints; shadowing is applied after
+   reading from it.  It is flushed whenever a thread is resumed or
+   waited for, and whenever memory is written.  */
+
+#define MEMORY_CACHE_LINE_SIZE 4096
+
+/* The maximum number of lines cached before the whole cache is
+   flushed.  */
+#define MEMORY_CACHE_MAX_LINES 1024
+
+/* A line of the memory cache.  */
+
+struct memory_cache_line
+{
+  memory_cache_line ()
+    : data (MEMORY_CACHE_LINE_SIZE)
+  {}
+
+  /* The cached bytes.  */
+  gdb::byte_vector data;
+
+  /* Which bytes of DATA have been read from the inferior.  */
+  std::bitset<MEMORY_CACHE_LINE_SIZE> valid;
+};
+
+/* Whether the memory cache may be used.  Changed by "monitor set
+   memory-cache".  It is off by default, as memory that changes
+   without any thread running, such as memory-mapped device
+   registers, must not be cached.  */
+bool memory_cache_enabled = false;
+
+/* True between a stop in all-stop mode and the next resume or
+   wait.  */
+static bool memory_cache_active;
+
+/* The process whose memory is cached.  */
+static int memory_cache_pid;
+
+/* The cached lines, indexed by address.  */
+static std::unordered_map<CORE_ADDR, memory_cache_line> memory_cache_lines;
+
+/* Statistics, shown by "monitor show memory-cache".  */
+static unsigned long memory_cache_hits;
+static unsigned long memory_cache_misses;
+static unsigned long memory_cache_flushes;
+
+/* See target.h.  */
+
+void
+invalidate_memory_cache ()
+{
+  if (!memory_cache_lines.empty ())
+    {
+      memory_cache_lines.clear ();
+      memory_cache_flushes++;
+    }
+}
+
+/* Flush the memory cache and stop using it until the next stop.  */
+
+static void
+deactivate_memory_cache ()
+{
+  invalidate_memory_cache ();
+  memory_cache_active = false;
+}
+
+/* See target.h.  */
+
+void
+memory_cache_stats (unsigned long *hits, unsigned long *misses,
+		    unsigned long *flushes)
+{
+  *hits = memory_cache_hits;
+  *misses = memory_cache_misses;
+  *flushes = memory_cache_flushes;
+}
+
+/* Read LEN bytes at MEMADDR into MYADDR through the memory cache.
+   Return 0 on success, and an error code if the bytes missing from
+   the cache can't be read; then the caller reads the range
+   directly.  */
+
+static int
+memory_cache_read (CORE_ADDR memaddr, unsigned char *myaddr, int len)
+{
+  int pid = current_process ()->pid;
+
+  if (pid != memory_cache_pid)
+    {
+      invalidate_memory_cache ();
+      memory_cache_pid = pid;
+    }
+
+  while (len > 0)
+    {
+      CORE_ADDR line_addr
+	= memaddr & ~(CORE_ADDR) (MEMORY_CACHE_LINE_SIZE - 1);
+      int offset = memaddr - line_addr;
+      int chunk = std::min (len, MEMORY_CACHE_LINE_SIZE - offset);
+
+      auto it = memory_cache_lines.find (line_addr);
+      if (it == memory_cache_lines.end ())
+	{
+	  if (memory_cache_lines.size () >= MEMORY_CACHE_MAX_LINES)
+	    invalidate_memory_cache ();
+	  it = memory_cache_lines.emplace (line_addr,
+					   memory_cache_line ()).first;
+	}
+      memory_cache_line &line = it->second;
+
+      /* Find the first and last requested bytes that aren't cached,
+	 and read just those, and whatever lies in between.  */
+      int first = offset;
+      while (first < offset + chunk && line.valid[first])
+	first++;
+
+      if (first == offset + chunk)
+	memory_cache_hits++;
+      else
+	{
+	  int last = offset + chunk;
+	  while (line.valid[last - 1])
+	    last--;
+
+	  int res = the_target->read_memory (line_addr + first,
+					     line.data.data () + first,
+					     last - first);
+	  if (res != 0)
+	    return res;
+
+	  memory_cache_misses++;
+	  for (int i = first; i < last; i++)
+	    line.valid[i] = true;
+	}
+
+      memcpy (myaddr, line.data.data () + offset, chunk);
+      memaddr += chunk;
+      myaddr += chunk;
+      len -= chunk;
+    }
+
+  return 0;
+}
+
 int
 read_inferior_memory (CORE_ADDR memaddr, unsigned char *myaddr, int len)
 {
@@ -89,7 +242,12 @@ read_inferior_memory (CORE_ADDR memaddr, unsigned char *myaddr, int len)
   if (len == 0)
     return 0;
 
-  int res = the_target->read_memory (memaddr, myaddr, len);
+  int res = -1;
+  if (memory_cache_enabled && memory_cache_active
+      && current_process () != NULL)
+    res = memory_cache_read (memaddr, myaddr, len);
+  if (res != 0)
+    res = the_target->read_memory (memaddr, myaddr, len);
   check_mem_read (memaddr, myaddr, len);
   return res;
 }
@@ -127,6 +285,7 @@ target_write_memory (CORE_ADDR memaddr, const unsigned char *myaddr,
      update it.  */
   gdb::byte_vector buffer (myaddr, myaddr + len);
   check_mem_write (memaddr, buffer.data (), myaddr, len);
+  invalidate_memory_cache ();
   return the_target->write_memory (memaddr, buffer.data (), len);
 }
 
@@ -139,8 +298,15 @@ mywait (ptid_t ptid, struct target_waitstatus *ourstatus,
   if (connected_wait)
     server_waiting = 1;
 
+  deactivate_memory_cache ();
   ret = target_wait (ptid, ourstatus, options);
 
+  /* In all-stop mode, everything is stopped until the next resume, so
+     memory can be cached.  */
+  memory_cache_active = (!non_stop
+			 && ourstatus->kind () != TARGET_WAITKIND_EXITED
+			 && ourstatus->kind () != TARGET_WAITKIND_SIGNALLED);
+
   /* We don't expose _LOADED events to gdbserver core.  See the
      `dlls_changed' global.  */
   if (ourstatus->kind () == TARGET_WAITKIND_LOADED)
@@ -181,6 +347,7 @@ target_stop_and_wait (ptid_t ptid)
   resume_info.thread = ptid;
   resume_info.kind = resume_stop;
   resume_info.sig = GDB_SIGNAL_0;
+  deactivate_memory_cache ();
   the_target->resume (&resume_info, 1);
 
   non_stop = true;
@@ -215,6 +382,7 @@ target_continue_no_signal (ptid_t ptid)
   resume_info.thread = ptid;
   resume_info.kind = resume_continue;
   resume_info.sig = GDB_SIGNAL_0;
+  deactivate_memory_cache ();
   the_target->resume (&resume_info, 1);
 }
 
@@ -228,6 +396,7 @@ target_continue (ptid_t ptid, enum gdb_signal signal)
   resume_info.thread = ptid;
   resume_info.kind = resume_continue;
   resume_info.sig = gdb_signal_to_host (signal);
+  deactivate_memory_cache ();
   the_target->resume (&resume_info, 1);
 }
 
@@ -270,6 +439,7 @@ int
 kill_inferior (process_info *proc)
 {
   gdb_agent_about_to_close (proc->pid);
+  deactivate_memory_cache ();
 
   return the_target->kill (proc);
 }
@@ -372,6 +542,12 @@ process_stratum_target::remove_point (enum raw_bkpt_type type,
   return 1;
 }
 
+bool
+process_stratum_target::supports_conditional_watchpoints ()
+{
+  return false;
+}
+
 bool
 process_stratum_target::stopped_by_sw_breakpoint ()
 {
@@ -196,6 +196,12 @@ class process_stratum_target
   virtual int remove_point (enum raw_bkpt_type type, CORE_ADDR addr,
 			    int size, raw_breakpoint *bp);
 
+  /* Returns true if the target can evaluate the conditions of read
+     and access watchpoints, and silently resume threads for which
+     they are false.  This requires watchpoints to trigger after the
+     access, so that the thread can simply be resumed.  */
+  virtual bool supports_conditional_watchpoints ();
+
   /* Returns true if the target stopped because it executed a software
      breakpoint instruction, false otherwise.  */
   virtual bool stopped_by_sw_breakpoint ();
@@ -699,6 +705,21 @@ target_thread_pending_child (thread_info *thread)
 
 int read_inferior_memory (CORE_ADDR memaddr, unsigned char *myaddr, int len);
 
+/* Whether read_inferior_memory may cache memory while all threads are
+   stopped.  */
+extern bool memory_cache_enabled;
+
+/* Flush the inferior memory cache.  This must be called before
+   writing inferior memory other than through target_write_memory,
+   and before resuming threads other than through the functions of
+   this file.  */
+void invalidate_memory_cache ();
+
+/* Return in *HITS, *MISSES and *FLUSHES the inferior memory cache
+   statistics.  */
+void memory_cache_stats (unsigned long *hits, unsigned long *misses,
+			 unsigned long *flushes);
+
 /* Set GDBserver's current thread to the thread the client requested
    via Hg.  Also switches the current process to the requested
    process.  If the requested thread is not found in the thread list,
@@ -6302,6 +6302,61 @@ download_trace_state_variables (void)
    `trace_alloc_trace_buffer'.  See its description of the atomic
    syncing mechanism.  */
 
+/* The smallest amount of the IP agent's trace buffer that
+   ipa_trace_buffer_reader reads at a time.  */
+#define IPA_TRACE_BUFFER_READ_CHUNK 65536
+
+/* Reads of the IP agent's trace buffer for upload_fast_traceframes.
+   Traceframes are usually small and packed back to back, so rather
+   than reading each header and data block from the inferior
+   separately, this reads a large chunk at once and serves the
+   following reads from it.  The committed traceframes don't change
+   until the IP agent's buffer control is written back, so the copy
+   stays valid for the whole upload.  */
+
+struct ipa_trace_buffer_reader
+{
+  explicit ipa_trace_buffer_reader (CORE_ADDR hi)
+    : m_hi (hi)
+  {}
+
+  /* Read LEN bytes at ADDR into BUF.  Return 0 on success, and
+     non-zero on failure, like read_inferior_memory.  */
+  int read (CORE_ADDR addr, unsigned char *buf, ULONGEST len)
+  {
+    if (addr < m_base || addr + len > m_base + m_data.size ())
+      {
+	ULONGEST chunk = IPA_TRACE_BUFFER_READ_CHUNK;
+
+	if (addr < m_hi && chunk > m_hi - addr)
+	  chunk = m_hi - addr;
+	if (chunk < len)
+	  chunk = len;
+
+	m_data.resize (chunk);
+	if (read_inferior_memory (addr, m_data.data (), chunk) != 0)
+	  {
+	    m_data.clear ();
+	    return read_inferior_memory (addr, buf, len);
+	  }
+	m_base = addr;
+      }
+
+    memcpy (buf, m_data.data () + (addr - m_base), len);
+    return 0;
+  }
+
+private:
+  /* The end of the IP agent's trace buffer.  */
+  CORE_ADDR m_hi;
+
+  /* The inferior address of the first byte of M_DATA.  */
+  CORE_ADDR m_base = 0;
+
+  /* The copy of the last chunk read.  */
+  std::vector<unsigned char> m_data;
+};
+
 static void
 upload_fast_traceframes (void)
 {
@@ -6445,6 +6500,8 @@ upload_fast_traceframes (void)
 
   tf = IPA_FIRST_TRACEFRAME ();
 
+  ipa_trace_buffer_reader reader (ipa_trace_buffer_hi);
+
   while (ipa_traceframe_write_count - ipa_traceframe_read_count)
     {
       struct tracepoint *tpoint;
@@ -6452,8 +6509,8 @@ upload_fast_traceframes (void)
       unsigned char *block;
       struct traceframe ipa_tframe;
 
-      if (read_inferior_memory (tf, (unsigned char *) &ipa_tframe,
-				offsetof (struct traceframe, data)))
+      if (reader.read (tf, (unsigned char *) &ipa_tframe,
+		       offsetof (struct traceframe, data)))
 	error ("Uploading: couldn't read traceframe at %s\n", paddress (tf));
 
       if (ipa_tframe.tpnum == 0)
@@ -6483,9 +6540,8 @@ upload_fast_traceframes (void)
 					ipa_tframe.data_size);
 	  if (block != NULL)
 	    {
-	      if (read_inferior_memory (tf
-					+ offsetof (struct traceframe, data),
-					block, ipa_tframe.data_size))
+	      if (reader.read (tf + offsetof (struct traceframe, data),
+			       block, ipa_tframe.data_size))
 		error ("Uploading: Couldn't read traceframe data at %s\n",
 		       paddress (tf + offsetof (struct traceframe, data)));
 	    }
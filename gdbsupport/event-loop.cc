@@ -96,7 +96,12 @@ static bool use_poll = true;
    that have the POLL function, the other for those that don't, and
    only support SELECT.  Each of the elements in the gdb_notifier list is
    basically a description of what kind of events gdb is interested
-   in, for each fd.  */
+   in, for each fd.
+
+   The list stays short even when debugging many inferiors: GDBserver's
+   Linux backend, for instance, reports the events of all its processes
+   through a single event pipe.  So poll and select are not a
+   bottleneck here, and there is no epoll variant.  */
 
 static struct
   {
@@ -45,3 +45,26 @@ obconcat (struct obstack *obstackp, ...)
 
   return (char *) obstack_finish (obstackp);
 }
+
+/* See gdb_obstack.h.  */
+
+void
+obstack_transfer (struct obstack *dest, struct obstack *src)
+{
+  gdb_assert (dest != src);
+  gdb_assert (obstack_object_size (src) == 0);
+
+  /* Chunks are linked from the current one back to the first one.
+     Splice SRC's whole list in just behind DEST's current chunk, so
+     that DEST keeps allocating where it was.  */
+  struct _obstack_chunk *newest = src->chunk;
+  struct _obstack_chunk *oldest = newest;
+  while (oldest->prev != nullptr)
+    oldest = oldest->prev;
+
+  oldest->prev = dest->chunk->prev;
+  dest->chunk->prev = newest;
+
+  /* SRC no longer owns any memory.  */
+  obstack_init (src);
+}
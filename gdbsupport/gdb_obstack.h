@@ -116,6 +116,24 @@ obstack_strndup (struct obstack *obstackp, const char *string, size_t n)
   return (char *) obstack_copy0 (obstackp, string, n);
 }
 
+/* Move all the memory of SRC to DEST, without copying it.  Objects
+   allocated on SRC remain where they are, but are now owned by DEST,
+   and are freed along with DEST's own objects.  SRC is left empty and
+   ready for new allocations.  This is meant for handing off the
+   results of work done on a worker thread, with an obstack of its
+   own, to a longer-lived owner.
+
+   Both obstacks must use the default allocation functions, and SRC
+   must not have an object under construction.  The cost is linear
+   in the number of chunks of SRC, not in the amount of data.
+
+   For obstack_free, the adopted objects are considered older than
+   those in DEST's current chunk, but newer than everything else in
+   DEST; so freeing DEST back to an object allocated before its
+   current chunk also frees them.  */
+
+extern void obstack_transfer (struct obstack *dest, struct obstack *src);
+
 /* An obstack that frees itself on scope exit.  */
 struct auto_obstack : obstack
 {
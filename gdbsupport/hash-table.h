@@ -0,0 +1,455 @@
+/* A typed open-addressing hash table for GDB.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GDB.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+#ifndef GDBSUPPORT_HASH_TABLE_H
+#define GDBSUPPORT_HASH_TABLE_H
+
+#include <stdint.h>
+#include <new>
+#include <utility>
+#include "hashtab.h"
+
+namespace gdb
+{
+
+/* Statistics about a hash_table, as returned by
+   hash_table::statistics.  The same structure is used by every
+   table, so that they can all be reported the same way.  */
+
+struct hash_table_statistics
+{
+  /* The number of elements.  */
+  size_t elements = 0;
+
+  /* The number of slots.  */
+  size_t capacity = 0;
+
+  /* The number of slots left unusable by erased elements, until the
+     table is next rebuilt.  */
+  size_t deleted = 0;
+
+  /* The number of lookups and insertions done, and the number of
+     groups of slots they examined in total.  */
+  unsigned long searches = 0;
+  unsigned long probes = 0;
+
+  /* The number of times the table was rebuilt.  */
+  unsigned long rebuilds = 0;
+};
+
+/* A base for the traits of a hash_table, providing default versions
+   of the optional members.  */
+
+template<typename T>
+struct default_hash_table_traits
+{
+  /* Called on an element when it is erased from the table, or when
+     the table is cleared or destroyed, before the element itself is
+     destroyed.  */
+  static void remove (T &elt)
+  {
+  }
+};
+
+/* A hash table of elements of type T, using open addressing.  T is
+   usually a pointer to an object allocated elsewhere.
+
+   Unlike libiberty's htab_t, the hash and equality functions are
+   provided by a TRAITS class, so the compiler can inline them into
+   the table's code.  TRAITS must provide:
+
+     static hashval_t hash (const T &elt);
+       Return the hash of ELT.  This is only called when the table is
+       rebuilt; lookups are given the hash of the key by the caller.
+
+     static bool equal (const T &elt, const K &key);
+       Return true if ELT matches KEY.  This can be overloaded for
+       each type of key used to search the table.
+
+   and can derive from default_hash_table_traits to get the default
+   versions of the optional members.
+
+   The table is inspired by Abseil's "Swiss tables": a byte of
+   metadata is kept for each slot, holding 7 bits of the hash of the
+   element there, or marking the slot as empty or deleted.  A probe
+   loads the metadata of 8 consecutive slots as one 64-bit word and
+   finds the candidate slots in it with a few arithmetic operations,
+   so that the elements themselves are only looked at when their
+   hash matches.
+
+   This class is not thread-safe.  */
+
+template<typename T, typename Traits>
+class hash_table
+{
+public:
+
+  hash_table () = default;
+
+  /* Create a table with room for at least N elements.  */
+  explicit hash_table (size_t n)
+  {
+    reserve (n);
+  }
+
+  ~hash_table ()
+  {
+    destroy_elements ();
+    xfree (m_ctrl);
+    xfree (m_slots);
+  }
+
+  DISABLE_COPY_AND_ASSIGN (hash_table);
+
+  /* Return the number of elements in the table.  */
+  size_t size () const
+  {
+    return m_size;
+  }
+
+  /* Return true if the table has no elements.  */
+  bool empty () const
+  {
+    return m_size == 0;
+  }
+
+  /* Make sure the table can hold N elements without being
+     rebuilt.  */
+  void reserve (size_t n)
+  {
+    size_t capacity = group_width;
+    while (max_load (capacity) < n)
+      capacity *= 2;
+    if (capacity > m_capacity)
+      rebuild (capacity);
+  }
+
+  /* Remove all the elements, keeping the memory for reuse.  */
+  void clear ()
+  {
+    destroy_elements ();
+    if (m_ctrl != nullptr)
+      memset (m_ctrl, ctrl_empty, m_capacity);
+    m_size = 0;
+    m_deleted = 0;
+  }
+
+  /* Return the element matching KEY, whose hash is HASH, or nullptr
+     if there is none.  */
+  template<typename K>
+  T *find (const K &key, hashval_t hash)
+  {
+    size_t idx = find_index (key, hash);
+    return idx == not_found ? nullptr : &m_slots[idx];
+  }
+
+  /* Return the element matching KEY, whose hash is HASH.  If there is
+     none, a new value-initialized element is created for it; the
+     caller must then store into it an element matching KEY before
+     doing anything else with the table.  If INSERTED is not nullptr,
+     set *INSERTED to whether a new element was created.  */
+  template<typename K>
+  T &find_or_insert (const K &key, hashval_t hash, bool *inserted = nullptr)
+  {
+    size_t idx = find_index (key, hash);
+    if (idx != not_found)
+      {
+	if (inserted != nullptr)
+	  *inserted = false;
+	return m_slots[idx];
+      }
+
+    if (m_size + m_deleted + 1 > max_load (m_capacity))
+      {
+	/* If many slots are only taken by deleted elements, rebuilding
+	   at the same size is enough.  */
+	if (m_capacity != 0 && m_size < max_load (m_capacity) / 2)
+	  rebuild (m_capacity);
+	else
+	  rebuild (m_capacity == 0 ? group_width : m_capacity * 2);
+      }
+
+    uint64_t mixed = mix (hash);
+    idx = find_free_index (mixed);
+    if (m_ctrl[idx] == ctrl_deleted)
+      --m_deleted;
+    m_ctrl[idx] = h2 (mixed);
+    new (&m_slots[idx]) T ();
+    ++m_size;
+
+    if (inserted != nullptr)
+      *inserted = true;
+    return m_slots[idx];
+  }
+
+  /* Erase the element matching KEY, whose hash is HASH.  Return true
+     if there was one.  */
+  template<typename K>
+  bool erase (const K &key, hashval_t hash)
+  {
+    size_t idx = find_index (key, hash);
+    if (idx == not_found)
+      return false;
+
+    Traits::remove (m_slots[idx]);
+    m_slots[idx].~T ();
+    m_ctrl[idx] = ctrl_deleted;
+    --m_size;
+    ++m_deleted;
+    return true;
+  }
+
+  /* Call FUNC on each element of the table, in no particular order.
+     FUNC must not modify the table.  */
+  template<typename F>
+  void for_each (F func)
+  {
+    for (size_t i = 0; i < m_capacity; ++i)
+      if (is_full (m_ctrl[i]))
+	func (m_slots[i]);
+  }
+
+  /* Return statistics about this table.  */
+  hash_table_statistics statistics () const
+  {
+    hash_table_statistics result;
+    result.elements = m_size;
+    result.capacity = m_capacity;
+    result.deleted = m_deleted;
+    result.searches = m_searches;
+    result.probes = m_probes;
+    result.rebuilds = m_rebuilds;
+    return result;
+  }
+
+private:
+
+  /* The number of slots whose metadata is examined at once.  */
+  enum : size_t { group_width = 8 };
+
+  /* The metadata byte of a slot is either one of these, or, for a
+     slot holding an element, 7 bits of that element's hash.  */
+  enum : uint8_t
+  {
+    ctrl_empty = 0x80,
+    ctrl_deleted = 0xfe,
+  };
+
+  /* Returned by find_index when there is no match.  */
+  enum : size_t { not_found = (size_t) -1 };
+
+  /* Constants for working on all the bytes of a group at once.  */
+  static constexpr uint64_t lsbs = 0x0101010101010101ULL;
+  static constexpr uint64_t msbs = 0x8080808080808080ULL;
+
+  static bool is_full (uint8_t ctrl)
+  {
+    return (ctrl & 0x80) == 0;
+  }
+
+  /* The maximum number of elements, including deleted ones, in a
+     table with CAPACITY slots: 7/8 of them.  */
+  static size_t max_load (size_t capacity)
+  {
+    return capacity - capacity / 8;
+  }
+
+  /* Spread the bits of HASH, since many GDB hash functions, such as
+     the ones based on section offsets, have poorly distributed low
+     bits.  The top 7 bits of the result are stored in the metadata,
+     and the bits below are used to pick the first group to probe.  */
+  static uint64_t mix (hashval_t hash)
+  {
+    return (uint64_t) hash * 0x9e3779b97f4a7c15ULL;
+  }
+
+  static uint8_t h2 (uint64_t mixed)
+  {
+    return mixed >> 57;
+  }
+
+  size_t first_group (uint64_t mixed) const
+  {
+    return (mixed >> 24) & (m_capacity / group_width - 1);
+  }
+
+  /* Load the metadata of the group starting at slot IDX.  The bytes
+     are assembled explicitly, so that slot IDX + N is always in byte
+     N of the result, whatever the host's byte order; compilers turn
+     this into a single load on little-endian hosts.  */
+  uint64_t load_group (size_t idx) const
+  {
+    const uint8_t *p = &m_ctrl[idx];
+    uint64_t result = 0;
+    for (int i = 0; i < group_width; ++i)
+      result |= (uint64_t) p[i] << (8 * i);
+    return result;
+  }
+
+  /* Return a mask with the top bit of each byte of GROUP that equals
+     H2 set.  This can have false positives, but only for slots that
+     hold an element, so they are weeded out by Traits::equal.  */
+  static uint64_t match (uint64_t group, uint8_t h2)
+  {
+    uint64_t x = group ^ (lsbs * h2);
+    return (x - lsbs) & ~x & msbs;
+  }
+
+  /* Return a mask with the top bit of each empty slot of GROUP
+     set.  */
+  static uint64_t match_empty (uint64_t group)
+  {
+    return group & ~(group << 6) & msbs;
+  }
+
+  /* Likewise for slots that are either empty or deleted.  */
+  static uint64_t match_free (uint64_t group)
+  {
+    return group & ~(group << 7) & msbs;
+  }
+
+  /* Return the index of the lowest byte of MASK that has its top bit
+     set.  MASK must not be zero.  */
+  static int lowest_byte (uint64_t mask)
+  {
+#ifdef __GNUC__
+    return __builtin_ctzll (mask) / 8;
+#else
+    int result = 0;
+    while ((mask & 0x80) == 0)
+      {
+	mask >>= 8;
+	++result;
+      }
+    return result;
+#endif
+  }
+
+  /* Return the index of the element matching KEY, whose hash is
+     HASH, or not_found.  */
+  template<typename K>
+  size_t find_index (const K &key, hashval_t hash)
+  {
+    ++m_searches;
+    if (m_size == 0)
+      return not_found;
+
+    uint64_t mixed = mix (hash);
+    uint8_t tag = h2 (mixed);
+    size_t mask = m_capacity / group_width - 1;
+    size_t group = first_group (mixed);
+
+    /* Triangular probing over the groups; as their number is a power
+       of two, this visits each of them once.  */
+    for (size_t step = 1; ; ++step)
+      {
+	++m_probes;
+	size_t base = group * group_width;
+	uint64_t ctrl = load_group (base);
+
+	for (uint64_t m = match (ctrl, tag); m != 0; m &= m - 1)
+	  {
+	    size_t idx = base + lowest_byte (m);
+	    if (Traits::equal (m_slots[idx], key))
+	      return idx;
+	  }
+
+	if (match_empty (ctrl) != 0 || step > mask)
+	  return not_found;
+
+	group = (group + step) & mask;
+      }
+  }
+
+  /* Return the index of the first free slot in the probe sequence of
+     MIXED.  The table must have one.  */
+  size_t find_free_index (uint64_t mixed) const
+  {
+    size_t mask = m_capacity / group_width - 1;
+    size_t group = first_group (mixed);
+
+    for (size_t step = 1; ; ++step)
+      {
+	size_t base = group * group_width;
+	uint64_t free_slots = match_free (load_group (base));
+	if (free_slots != 0)
+	  return base + lowest_byte (free_slots);
+	group = (group + step) & mask;
+      }
+  }
+
+  /* Rebuild the table with CAPACITY slots, which must be a power of
+     two, at least group_width, and enough for the elements.  */
+  void rebuild (size_t capacity)
+  {
+    uint8_t *old_ctrl = m_ctrl;
+    T *old_slots = m_slots;
+    size_t old_capacity = m_capacity;
+
+    m_ctrl = (uint8_t *) xmalloc (capacity);
+    memset (m_ctrl, ctrl_empty, capacity);
+    m_slots = (T *) xmalloc (capacity * sizeof (T));
+    m_capacity = capacity;
+    m_deleted = 0;
+    ++m_rebuilds;
+
+    for (size_t i = 0; i < old_capacity; ++i)
+      if (is_full (old_ctrl[i]))
+	{
+	  uint64_t mixed = mix (Traits::hash (old_slots[i]));
+	  size_t idx = find_free_index (mixed);
+	  m_ctrl[idx] = h2 (mixed);
+	  new (&m_slots[idx]) T (std::move (old_slots[i]));
+	  old_slots[i].~T ();
+	}
+
+    xfree (old_ctrl);
+    xfree (old_slots);
+  }
+
+  /* Call Traits::remove on, and destroy, each element.  */
+  void destroy_elements ()
+  {
+    for (size_t i = 0; i < m_capacity; ++i)
+      if (is_full (m_ctrl[i]))
+	{
+	  Traits::remove (m_slots[i]);
+	  m_slots[i].~T ();
+	}
+  }
+
+  /* The metadata and the slots.  M_CAPACITY is zero, or a power of
+     two that is at least group_width.  */
+  uint8_t *m_ctrl = nullptr;
+  T *m_slots = nullptr;
+  size_t m_capacity = 0;
+
+  /* The number of elements, and of deleted slots.  */
+  size_t m_size = 0;
+  size_t m_deleted = 0;
+
+  /* Statistics; see hash_table_statistics.  */
+  unsigned long m_searches = 0;
+  unsigned long m_probes = 0;
+  unsigned long m_rebuilds = 0;
+};
+
+} /* namespace gdb */
+
+#endif /* GDBSUPPORT_HASH_TABLE_H */
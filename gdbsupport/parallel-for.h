@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <type_traits>
 #include "gdbsupport/thread-pool.h"
+#include "gdbsupport/function-view.h"
 
 namespace gdb
 {
@@ -127,14 +128,20 @@ struct par_for_accumulator<void>
 
    If the function returns a non-void type, then a vector of the
    results is returned.  The size of the resulting vector depends on
-   the number of threads that were used.  */
+   the number of threads that were used.
+
+   If TASK_SIZE is given, it returns the cost of processing an element,
+   in arbitrary units; it must be non-zero.  The range is then split so
+   that each subrange has about the same total cost, rather than the
+   same number of elements.  */
 
 template<class RandomIt, class RangeFunction>
 typename gdb::detail::par_for_accumulator<
     typename std::result_of<RangeFunction (RandomIt, RandomIt)>::type
   >::result_type
 parallel_for_each (unsigned n, RandomIt first, RandomIt last,
-		   RangeFunction callback)
+		   RangeFunction callback,
+		   gdb::function_view<size_t (RandomIt)> task_size = nullptr)
 {
   using result_type
     = typename std::result_of<RangeFunction (RandomIt, RandomIt)>::type;
@@ -142,6 +149,7 @@ parallel_for_each (unsigned n, RandomIt first, RandomIt last,
   size_t n_threads = thread_pool::g_thread_pool->thread_count ();
   size_t n_elements = last - first;
   size_t elts_per_thread = 0;
+  size_t size_per_thread = 0;
   if (n_threads > 1)
     {
       /* Require that there should be at least N elements in a
@@ -150,6 +158,18 @@ parallel_for_each (unsigned n, RandomIt first, RandomIt last,
       if (n_elements / n_threads < n)
 	n_threads = std::max (n_elements / n, (size_t) 1);
       elts_per_thread = n_elements / n_threads;
+
+      if (task_size != nullptr)
+	{
+	  size_t total_size = 0;
+	  for (RandomIt iter = first; iter != last; ++iter)
+	    {
+	      size_t element_size = task_size (iter);
+	      gdb_assert (element_size > 0);
+	      total_size += element_size;
+	    }
+	  size_per_thread = total_size / n_threads;
+	}
     }
 
   size_t count = n_threads == 0 ? 0 : n_threads - 1;
@@ -157,7 +177,20 @@ parallel_for_each (unsigned n, RandomIt first, RandomIt last,
 
   for (int i = 0; i < count; ++i)
     {
-      RandomIt end = first + elts_per_thread;
+      RandomIt end;
+      if (task_size == nullptr)
+	end = first + elts_per_thread;
+      else
+	{
+	  /* Take elements until this subrange has its share of the
+	     total cost, leaving at least one element for each of the
+	     remaining subranges, including the one processed in this
+	     thread.  */
+	  size_t chunk_size = 0;
+	  RandomIt limit = last - (count - i);
+	  for (end = first; end < limit && chunk_size < size_per_thread; ++end)
+	    chunk_size += task_size (end);
+	}
       results.post (i, [=] ()
         {
 	  return callback (first, end);
@@ -24,7 +24,13 @@
 
 /* This implements a basic search of memory, reading target memory and
    performing the search here (as opposed to performing the search in on the
-   target side with, for example, gdbserver).  */
+   target side with, for example, gdbserver).
+
+   Memory is read in chunks that start at SEARCH_CHUNK_SIZE bytes and
+   double after each read, up to SEARCH_MAX_CHUNK_SIZE.  A search that
+   finds its pattern quickly doesn't read much more than it needs to,
+   while a search of a large range isn't dominated by the cost of each
+   read.  */
 
 int
 simple_search_memory
@@ -33,85 +39,58 @@ simple_search_memory
    const gdb_byte *pattern, ULONGEST pattern_len,
    CORE_ADDR *found_addrp)
 {
-  const unsigned chunk_size = SEARCH_CHUNK_SIZE;
-  /* Buffer to hold memory contents for searching.  */
-  unsigned search_buf_size;
-
-  search_buf_size = chunk_size + pattern_len - 1;
-
-  /* No point in trying to allocate a buffer larger than the search space.  */
-  if (search_space_len < search_buf_size)
-    search_buf_size = search_space_len;
-
-  gdb::byte_vector search_buf (search_buf_size);
-
-  /* Prime the search buffer.  */
-
-  if (!read_memory (start_addr, search_buf.data (), search_buf_size))
-    {
-      warning (_("Unable to access %s bytes of target "
-		 "memory at %s, halting search."),
-	       pulongest (search_buf_size), hex_string (start_addr));
-      return -1;
-    }
-
-  /* Perform the search.
-
-     The loop is kept simple by allocating [N + pattern-length - 1] bytes.
-     When we've scanned N bytes we copy the trailing bytes to the start and
-     read in another N bytes.  */
-
-  while (search_space_len >= pattern_len)
+  size_t chunk_size = SEARCH_CHUNK_SIZE;
+  /* Buffer to hold memory contents for searching.  The first KEEP_LEN
+     bytes are the tail of the previous chunk, which BUF_ADDR is the
+     address of; a match may start there.  */
+  gdb::byte_vector search_buf;
+  size_t keep_len = 0;
+  CORE_ADDR buf_addr = start_addr;
+  /* The next address to read, and how much is left to read.  */
+  CORE_ADDR read_addr = start_addr;
+  ULONGEST left = search_space_len;
+
+  while (left > 0 && keep_len + left >= pattern_len)
     {
-      gdb_byte *found_ptr;
-      unsigned nr_search_bytes
-	= std::min (search_space_len, (ULONGEST) search_buf_size);
-
-      found_ptr = (gdb_byte *) memmem (search_buf.data (), nr_search_bytes,
-				       pattern, pattern_len);
+      size_t nr_to_read = std::min (left, (ULONGEST) chunk_size);
 
-      if (found_ptr != NULL)
+      search_buf.resize (keep_len + nr_to_read);
+      if (!read_memory (read_addr, &search_buf[keep_len], nr_to_read))
 	{
-	  CORE_ADDR found_addr = start_addr + (found_ptr - search_buf.data ());
-
-	  *found_addrp = found_addr;
-	  return 1;
+	  warning (_("Unable to access %s bytes of target "
+		     "memory at %s, halting search."),
+		   pulongest (nr_to_read), hex_string (read_addr));
+	  return -1;
 	}
+      read_addr += nr_to_read;
+      left -= nr_to_read;
 
-      /* Not found in this chunk, skip to next chunk.  */
-
-      /* Don't let search_space_len wrap here, it's unsigned.  */
-      if (search_space_len >= chunk_size)
-	search_space_len -= chunk_size;
-      else
-	search_space_len = 0;
-
-      if (search_space_len >= pattern_len)
+      size_t nr_search_bytes = keep_len + nr_to_read;
+      if (nr_search_bytes >= pattern_len)
 	{
-	  unsigned keep_len = search_buf_size - chunk_size;
-	  CORE_ADDR read_addr = start_addr + chunk_size + keep_len;
-	  int nr_to_read;
-
-	  /* Copy the trailing part of the previous iteration to the front
-	     of the buffer for the next iteration.  */
-	  gdb_assert (keep_len == pattern_len - 1);
-	  if (keep_len > 0)
-	    memcpy (&search_buf[0], &search_buf[chunk_size], keep_len);
-
-	  nr_to_read = std::min (search_space_len - keep_len,
-				 (ULONGEST) chunk_size);
+	  gdb_byte *found_ptr
+	    = (gdb_byte *) memmem (search_buf.data (), nr_search_bytes,
+				   pattern, pattern_len);
 
-	  if (!read_memory (read_addr, &search_buf[keep_len], nr_to_read))
+	  if (found_ptr != NULL)
 	    {
-	      warning (_("Unable to access %s bytes of target "
-			 "memory at %s, halting search."),
-		       plongest (nr_to_read),
-		       hex_string (read_addr));
-	      return -1;
+	      *found_addrp = buf_addr + (found_ptr - search_buf.data ());
+	      return 1;
 	    }
 
-	  start_addr += chunk_size;
+	  /* Not found in this chunk.  Keep the trailing bytes that could
+	     be the start of a match spanning into the next one.  */
+	  size_t new_keep_len = pattern_len - 1;
+	  memmove (search_buf.data (),
+		   search_buf.data () + nr_search_bytes - new_keep_len,
+		   new_keep_len);
+	  buf_addr += nr_search_bytes - new_keep_len;
+	  keep_len = new_keep_len;
 	}
+      else
+	keep_len = nr_search_bytes;
+
+      chunk_size = std::min (chunk_size * 2, (size_t) SEARCH_MAX_CHUNK_SIZE);
     }
 
   /* Not found.  */
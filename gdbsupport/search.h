@@ -23,6 +23,9 @@
 /* This is needed by the unit test, so appears here.  */
 #define SEARCH_CHUNK_SIZE 16000
 
+/* The largest amount of memory read at once when searching.  */
+#define SEARCH_MAX_CHUNK_SIZE (1024 * 1024)
+
 /* The type of a callback function that can be used to read memory.
    Note that target_read_memory is not used here, because gdbserver
    wants to be able to examine trace data when searching, and
@@ -143,12 +143,37 @@ thread_pool *thread_pool::g_thread_pool = new thread_pool ();
 
 thread_pool::~thread_pool ()
 {
-  /* Because this is a singleton, we don't need to clean up.  The
+  /* Thread pools are never destroyed, so we don't need to clean up.  The
      threads are detached so that they won't prevent process exit.
      And, cleaning up here would be actively harmful in at least one
      case -- see the comment by the definition of g_thread_pool.  */
 }
 
+#if CXX_STD_THREAD
+
+/* The state of a worker thread.  */
+
+struct thread_pool::worker
+{
+  explicit worker (thread_pool *pool)
+    : pool (pool)
+  {
+  }
+
+  /* The pool this worker belongs to.  */
+  thread_pool *pool;
+
+  /* The tasks posted by this worker, one queue per priority.  The
+     worker itself takes tasks from the back, while other workers
+     steal from the front.  Guarded by MUTEX.  */
+  std::deque<task_t> tasks[n_priorities];
+  std::mutex mutex;
+};
+
+thread_local thread_pool::worker *thread_pool::s_current_worker;
+
+#endif /* CXX_STD_THREAD */
+
 void
 thread_pool::set_thread_count (size_t num_threads)
 {
@@ -163,16 +188,19 @@ thread_pool::set_thread_count (size_t num_threads)
       block_signals blocker;
       for (size_t i = m_thread_count; i < num_threads; ++i)
 	{
+	  worker *w = new worker (this);
 	  try
 	    {
-	      std::thread thread (&thread_pool::thread_function, this);
+	      std::thread thread (&thread_pool::thread_function, this, w);
 	      thread.detach ();
+	      m_workers.push_back (w);
 	    }
 	  catch (const std::system_error &)
 	    {
 	      /* libstdc++ may not implement std::thread, and will
 		 throw an exception on use.  It seems fine to ignore
 		 this, and any other sort of startup failure here.  */
+	      delete w;
 	      num_threads = i;
 	      break;
 	    }
@@ -181,8 +209,7 @@ thread_pool::set_thread_count (size_t num_threads)
   /* If the new size is smaller, terminate some existing threads.  */
   if (num_threads < m_thread_count)
     {
-      for (size_t i = num_threads; i < m_thread_count; ++i)
-	m_tasks.emplace ();
+      m_n_exiting += m_thread_count - num_threads;
       m_tasks_cv.notify_all ();
     }
 
@@ -195,25 +222,164 @@ thread_pool::set_thread_count (size_t num_threads)
 #if CXX_STD_THREAD
 
 void
-thread_pool::do_post_task (std::packaged_task<void ()> &&func)
+thread_pool::do_post_task (std::packaged_task<void ()> &&func,
+			   task_priority priority)
 {
   std::packaged_task<void ()> t (std::move (func));
+  int prio = static_cast<int> (priority);
+
+  if (m_thread_count == 0)
+    {
+      /* Just execute it now.  */
+      t ();
+      return;
+    }
+
+  worker *self = s_current_worker;
+  if (self != nullptr && self->pool == this)
+    {
+      /* A task posted by a worker, typically one part of a bigger
+	 job, is kept by that worker; the others can steal it if they
+	 run out of work.  */
+      {
+	std::lock_guard<std::mutex> guard (self->mutex);
+	self->tasks[prio].push_back (std::move (t));
+	++m_n_local[prio];
+      }
 
-  if (m_thread_count != 0)
+      /* A waiting worker counts itself idle before checking for
+	 tasks, and that check and its wait are done with
+	 m_tasks_mutex held; so if it missed this task, it is either
+	 seen here or is already waiting when notified.  */
+      if (m_n_idle > 0)
+	{
+	  std::lock_guard<std::mutex> guard (m_tasks_mutex);
+	  m_tasks_cv.notify_one ();
+	}
+    }
+  else
     {
       std::lock_guard<std::mutex> guard (m_tasks_mutex);
-      m_tasks.emplace (std::move (t));
+      m_tasks[prio].push_back (std::move (t));
+      ++m_n_shared[prio];
       m_tasks_cv.notify_one ();
     }
-  else
+}
+
+bool
+thread_pool::tasks_available () const
+{
+  for (int prio = 0; prio < n_priorities; ++prio)
+    if (m_n_shared[prio] > 0 || m_n_local[prio] > 0)
+      return true;
+  return false;
+}
+
+bool
+thread_pool::steal_task (worker *self, int prio, task_t *result)
+{
+  std::lock_guard<std::mutex> guard (m_tasks_mutex);
+
+  /* Start with the worker after SELF, so that the workers do not all
+     go after the same victim.  */
+  size_t n_workers = m_workers.size ();
+  size_t start = 0;
+  for (size_t i = 0; i < n_workers; ++i)
+    if (m_workers[i] == self)
+      {
+	start = i + 1;
+	break;
+      }
+
+  for (size_t i = 0; i < n_workers; ++i)
     {
-      /* Just execute it now.  */
-      t ();
+      worker *victim = m_workers[(start + i) % n_workers];
+      if (victim == self)
+	continue;
+
+      std::lock_guard<std::mutex> victim_guard (victim->mutex);
+      std::deque<task_t> &tasks = victim->tasks[prio];
+      if (!tasks.empty ())
+	{
+	  *result = std::move (tasks.front ());
+	  tasks.pop_front ();
+	  --m_n_local[prio];
+	  return true;
+	}
+    }
+
+  return false;
+}
+
+void
+thread_pool::retire_worker (worker *self)
+{
+  m_workers.erase (std::find (m_workers.begin (), m_workers.end (), self));
+  delete self;
+}
+
+bool
+thread_pool::find_task (worker *self, task_t *result)
+{
+  while (true)
+    {
+      for (int prio = 0; prio < n_priorities; ++prio)
+	{
+	  /* Our own most recently posted task first, as its data is
+	     the most likely to still be in the cache.  */
+	  {
+	    std::lock_guard<std::mutex> guard (self->mutex);
+	    std::deque<task_t> &tasks = self->tasks[prio];
+	    if (!tasks.empty ())
+	      {
+		*result = std::move (tasks.back ());
+		tasks.pop_back ();
+		--m_n_local[prio];
+		return true;
+	      }
+	  }
+
+	  if (m_n_shared[prio] > 0)
+	    {
+	      std::lock_guard<std::mutex> guard (m_tasks_mutex);
+	      std::deque<task_t> &tasks = m_tasks[prio];
+	      if (!tasks.empty ())
+		{
+		  *result = std::move (tasks.front ());
+		  tasks.pop_front ();
+		  --m_n_shared[prio];
+		  return true;
+		}
+	    }
+
+	  if (m_n_local[prio] > 0 && steal_task (self, prio, result))
+	    return true;
+	}
+
+      std::unique_lock<std::mutex> guard (m_tasks_mutex);
+
+      /* Only exit once every queued task has been taken, including
+	 those in our own queue, so that shrinking the pool, even to
+	 no threads at all, never strands a task whose future someone
+	 waits for.  Tasks posted to the shared queue are posted with
+	 m_tasks_mutex held, and nothing but this thread posts to our
+	 own queue, so none can be missed here.  */
+      if (m_n_exiting > 0 && !tasks_available ())
+	{
+	  --m_n_exiting;
+	  retire_worker (self);
+	  return false;
+	}
+
+      ++m_n_idle;
+      while (m_n_exiting == 0 && !tasks_available ())
+	m_tasks_cv.wait (guard);
+      --m_n_idle;
     }
 }
 
 void
-thread_pool::thread_function ()
+thread_pool::thread_function (worker *self)
 {
   /* This must be done here, because on macOS one can only set the
      name of the current thread.  */
@@ -223,24 +389,20 @@ thread_pool::thread_function ()
      stack.  */
   gdb::alternate_signal_stack signal_stack;
 
+  s_current_worker = self;
+
   while (true)
     {
-      optional<task_t> t;
-
-      {
-	/* We want to hold the lock while examining the task list, but
-	   not while invoking the task function.  */
-	std::unique_lock<std::mutex> guard (m_tasks_mutex);
-	while (m_tasks.empty ())
-	  m_tasks_cv.wait (guard);
-	t = std::move (m_tasks.front());
-	m_tasks.pop ();
-      }
+      task_t t;
 
-      if (!t.has_value ())
+      /* SELF must not be used once this returns false, as it has
+	 been destroyed.  */
+      if (!find_task (self, &t))
 	break;
-      (*t) ();
+      t ();
     }
+
+  s_current_worker = nullptr;
 }
 
 #endif /* CXX_STD_THREAD */
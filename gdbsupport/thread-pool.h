@@ -20,7 +20,7 @@
 #ifndef GDBSUPPORT_THREAD_POOL_H
 #define GDBSUPPORT_THREAD_POOL_H
 
-#include <queue>
+#include <deque>
 #include <vector>
 #include <functional>
 #if CXX_STD_THREAD
@@ -28,6 +28,7 @@
 #include <mutex>
 #include <condition_variable>
 #include <future>
+#include <atomic>
 #endif
 #include "gdbsupport/gdb_optional.h"
 
@@ -91,17 +92,45 @@ class future<void>
 #endif /* CXX_STD_THREAD */
 
 
+/* The priority of a task posted to a thread pool.  A worker thread
+   always prefers an available task of a higher priority over one of a
+   lower priority.  */
+
+enum class task_priority
+{
+  /* Work that the user is waiting for right now.  */
+  interactive,
+
+  /* The default.  */
+  normal,
+
+  /* Work whose result is not needed right away, such as styling
+     source text ahead of time.  */
+  background,
+};
+
 /* A thread pool.
 
    There is a single global thread pool, see g_thread_pool.  Tasks can
    be submitted to the thread pool.  They will be processed in worker
-   threads as time allows.  */
+   threads as time allows.
+
+   Each worker thread has its own queue of tasks.  A task posted from
+   a worker thread goes to that thread's queue, and the thread runs
+   the most recently posted one first; other tasks go to a queue
+   shared by the whole pool.  A worker that runs out of tasks takes
+   the oldest task from the shared queue or, failing that, steals the
+   oldest task from another worker.  */
 class thread_pool
 {
 public:
-  /* The sole global thread pool.  */
+  /* The global thread pool, used by GDB's own tasks.  */
   static thread_pool *g_thread_pool;
 
+  /* Other pools can be created for tasks that must not compete with
+     GDB's own for threads.  Like the global pool, they should be
+     allocated on the heap and never destroyed; see thread-pool.cc.  */
+  thread_pool () = default;
   ~thread_pool ();
   DISABLE_COPY_AND_ASSIGN (thread_pool);
 
@@ -119,14 +148,15 @@ class thread_pool
 #endif
   }
 
-  /* Post a task to the thread pool.  A future is returned, which can
-     be used to wait for the result.  */
-  future<void> post_task (std::function<void ()> &&func)
+  /* Post a task to the thread pool, with priority PRIORITY.  A future
+     is returned, which can be used to wait for the result.  */
+  future<void> post_task (std::function<void ()> &&func,
+			  task_priority priority = task_priority::normal)
   {
 #if CXX_STD_THREAD
     std::packaged_task<void ()> task (std::move (func));
     future<void> result = task.get_future ();
-    do_post_task (std::packaged_task<void ()> (std::move (task)));
+    do_post_task (std::packaged_task<void ()> (std::move (task)), priority);
     return result;
 #else
     func ();
@@ -134,15 +164,16 @@ class thread_pool
 #endif /* CXX_STD_THREAD */
   }
 
-  /* Post a task to the thread pool.  A future is returned, which can
-     be used to wait for the result.  */
+  /* Post a task to the thread pool, with priority PRIORITY.  A future
+     is returned, which can be used to wait for the result.  */
   template<typename T>
-  future<T> post_task (std::function<T ()> &&func)
+  future<T> post_task (std::function<T ()> &&func,
+		       task_priority priority = task_priority::normal)
   {
 #if CXX_STD_THREAD
     std::packaged_task<T ()> task (std::move (func));
     future<T> result = task.get_future ();
-    do_post_task (std::packaged_task<void ()> (std::move (task)));
+    do_post_task (std::packaged_task<void ()> (std::move (task)), priority);
     return result;
 #else
     return future<T> (func ());
@@ -151,27 +182,69 @@ class thread_pool
 
 private:
 
-  thread_pool () = default;
-
 #if CXX_STD_THREAD
-  /* The callback for each worker thread.  */
-  void thread_function ();
+  /* The number of task priorities.  */
+  static constexpr int n_priorities = 3;
+
+  /* A convenience typedef for the type of a task.  */
+  typedef std::packaged_task<void ()> task_t;
 
-  /* Post a task to the thread pool.  A future is returned, which can
-     be used to wait for the result.  */
-  void do_post_task (std::packaged_task<void ()> &&func);
+  /* The state of a single worker thread; see thread-pool.cc.  */
+  struct worker;
+
+  /* The callback for each worker thread.  SELF is the thread's
+     state.  */
+  void thread_function (worker *self);
+
+  /* Wait for a task for SELF to run, and store it in RESULT.  Return
+     false, without storing a task, if the thread should exit
+     instead.  */
+  bool find_task (worker *self, task_t *result);
+
+  /* Try to take a task of priority PRIORITY from a worker other than
+     SELF, storing it in RESULT.  Return true if one was found.  */
+  bool steal_task (worker *self, int priority, task_t *result);
+
+  /* Return true if any task is queued anywhere in the pool.  */
+  bool tasks_available () const;
+
+  /* Remove SELF, whose queue must be empty, from the pool.
+     m_tasks_mutex must be held.  */
+  void retire_worker (worker *self);
+
+  /* Post a task to the thread pool, with priority PRIORITY.  */
+  void do_post_task (std::packaged_task<void ()> &&func,
+		     task_priority priority);
 
   /* The current thread count.  */
   size_t m_thread_count = 0;
 
-  /* A convenience typedef for the type of a task.  */
-  typedef std::packaged_task<void ()> task_t;
+  /* The state of the worker thread running on this thread, if any.  */
+  static thread_local worker *s_current_worker;
+
+  /* The workers of this pool, owned by the pool.  A worker is deleted
+     when its thread exits.  Guarded by m_tasks_mutex.  */
+  std::vector<worker *> m_workers;
+
+  /* The tasks posted from outside the worker threads that have not
+     been processed yet, one queue per priority.  Guarded by
+     m_tasks_mutex.  */
+  std::deque<task_t> m_tasks[n_priorities];
+
+  /* The number of tasks of each priority in m_tasks, and in the
+     queues of all the workers.  These are kept up to date under the
+     mutex guarding the corresponding queue, but can be read without
+     it, so that a worker can see where there is work without taking
+     every lock in the pool.  */
+  std::atomic<size_t> m_n_shared[n_priorities] {};
+  std::atomic<size_t> m_n_local[n_priorities] {};
+
+  /* The number of workers waiting on m_tasks_cv.  */
+  std::atomic<size_t> m_n_idle {0};
 
-  /* The tasks that have not been processed yet.  An optional is used
-     to represent a task.  If the optional is empty, then this means
-     that the receiving thread should terminate.  If the optional is
-     non-empty, then it is an actual task to evaluate.  */
-  std::queue<optional<task_t>> m_tasks;
+  /* The number of workers that have been asked to exit, but have not
+     done so yet.  Only modified with m_tasks_mutex held.  */
+  std::atomic<size_t> m_n_exiting {0};
 
   /* A condition variable and mutex that are used for communication
      between the main thread and the worker threads.  */
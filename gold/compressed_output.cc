@@ -22,6 +22,9 @@
 
 #include "gold.h"
 #include <zlib.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 #include "parameters.h"
 #include "options.h"
 #include "compressed_output.h"
@@ -72,6 +75,69 @@ zlib_compress(int header_size,
     }
 }
 
+#ifdef HAVE_ZSTD
+
+// Like zlib_compress, but compress with zstd.  zstd is only used with
+// the ELF compression header, so there is no "ZLIB" header to write.
+
+static bool
+zstd_compress(int header_size,
+	      const unsigned char* uncompressed_data,
+	      unsigned long uncompressed_size,
+	      unsigned char** compressed_data,
+	      unsigned long* compressed_size)
+{
+  size_t size = ZSTD_compressBound(uncompressed_size);
+  *compressed_data = new unsigned char[size + header_size];
+
+  int compress_level;
+  if (parameters->options().optimize() >= 1)
+    compress_level = 19;
+  else
+    compress_level = ZSTD_CLEVEL_DEFAULT;
+
+#if ZSTD_VERSION_NUMBER >= 10400
+  // When linking with threads, let zstd split the section into jobs
+  // and compress them in parallel.  The output for any number of
+  // workers is the same, so this does not make the link depend on the
+  // thread count.  If libzstd was built without ZSTD_MULTITHREAD,
+  // setting ZSTD_c_nbWorkers fails and we compress in this thread.
+  ZSTD_CCtx* cctx = ZSTD_createCCtx();
+  if (cctx == NULL)
+    {
+      delete[] *compressed_data;
+      *compressed_data = NULL;
+      return false;
+    }
+  ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, compress_level);
+  if (parameters->options().threads())
+    {
+      int workers = parameters->options().thread_count_final();
+      if (workers <= 0)
+	workers = 4;
+      ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, workers);
+    }
+  size = ZSTD_compress2(cctx, *compressed_data + header_size, size,
+			uncompressed_data, uncompressed_size);
+  ZSTD_freeCCtx(cctx);
+#else
+  size = ZSTD_compress(*compressed_data + header_size, size,
+		       uncompressed_data, uncompressed_size,
+		       compress_level);
+#endif
+  if (!ZSTD_isError(size))
+    {
+      *compressed_size = size + header_size;
+      return true;
+    }
+
+  delete[] *compressed_data;
+  *compressed_data = NULL;
+  return false;
+}
+
+#endif // HAVE_ZSTD
+
 // Decompress COMPRESSED_DATA of size COMPRESSED_SIZE, into a buffer
 // UNCOMPRESSED_DATA of size UNCOMPRESSED_SIZE.  Returns TRUE if it
 // decompressed successfully, false if it failed.  The buffer, of
@@ -115,6 +181,24 @@ zlib_decompress(const unsigned char* compressed_data,
   return true;
 }
 
+#ifdef HAVE_ZSTD
+
+// Like zlib_decompress, but for zstd compressed data.
+
+static bool
+zstd_decompress(const unsigned char* compressed_data,
+		unsigned long compressed_size,
+		unsigned char* uncompressed_data,
+		unsigned long uncompressed_size)
+{
+  // ZSTD_decompress handles several concatenated frames.
+  size_t ret = ZSTD_decompress(uncompressed_data, uncompressed_size,
+			       compressed_data, compressed_size);
+  return !ZSTD_isError(ret) && ret == uncompressed_size;
+}
+
+#endif // HAVE_ZSTD
+
 // Read the compression header of a compressed debug section and return
 // the uncompressed size.
 
@@ -148,20 +232,19 @@ decompress_input_section(const unsigned char* compressed_data,
   if ((sh_flags & elfcpp::SHF_COMPRESSED) != 0)
     {
       unsigned int compression_header_size;
+      elfcpp::Elf_Word ch_type;
       if (size == 32)
 	{
 	  compression_header_size = elfcpp::Elf_sizes<32>::chdr_size;
 	  if (big_endian)
 	    {
 	      elfcpp::Chdr<32, true> chdr(compressed_data);
-	      if (chdr.get_ch_type() != elfcpp::ELFCOMPRESS_ZLIB)
-		return false;
+	      ch_type = chdr.get_ch_type();
 	    }
 	  else
 	    {
 	      elfcpp::Chdr<32, false> chdr(compressed_data);
-	      if (chdr.get_ch_type() != elfcpp::ELFCOMPRESS_ZLIB)
-		return false;
+	      ch_type = chdr.get_ch_type();
 	    }
 	}
       else if (size == 64)
@@ -170,23 +253,30 @@ decompress_input_section(const unsigned char* compressed_data,
 	  if (big_endian)
 	    {
 	      elfcpp::Chdr<64, true> chdr(compressed_data);
-	      if (chdr.get_ch_type() != elfcpp::ELFCOMPRESS_ZLIB)
-		return false;
+	      ch_type = chdr.get_ch_type();
 	    }
 	  else
 	    {
 	      elfcpp::Chdr<64, false> chdr(compressed_data);
-	      if (chdr.get_ch_type() != elfcpp::ELFCOMPRESS_ZLIB)
-		return false;
+	      ch_type = chdr.get_ch_type();
 	    }
 	}
       else
 	gold_unreachable();
 
-      return zlib_decompress(compressed_data + compression_header_size,
-			     compressed_size - compression_header_size,
-			     uncompressed_data,
-			     uncompressed_size);
+      if (ch_type == elfcpp::ELFCOMPRESS_ZLIB)
+	return zlib_decompress(compressed_data + compression_header_size,
+			       compressed_size - compression_header_size,
+			       uncompressed_data,
+			       uncompressed_size);
+#ifdef HAVE_ZSTD
+      if (ch_type == elfcpp::ELFCOMPRESS_ZSTD)
+	return zstd_decompress(compressed_data + compression_header_size,
+			       compressed_size - compression_header_size,
+			       uncompressed_data,
+			       uncompressed_size);
+#endif
+      return false;
     }
 
   const unsigned int zlib_header_size = 12;
@@ -230,15 +320,19 @@ Output_compressed_section::set_final_data_size()
   this->write_to_postprocessing_buffer();
 
   bool success = false;
-  enum { none, gnu_zlib, gabi_zlib } compress;
+  enum { none, gnu_zlib, gabi_zlib, zstd } compress;
   int compression_header_size = 12;
   const int size = parameters->target().get_size();
   if (strcmp(this->options_->compress_debug_sections(), "zlib-gnu") == 0)
     compress = gnu_zlib;
   else if (strcmp(this->options_->compress_debug_sections(), "zlib-gabi") == 0
-	   || strcmp(this->options_->compress_debug_sections(), "zlib") == 0)
+	   || strcmp(this->options_->compress_debug_sections(), "zlib") == 0
+	   || strcmp(this->options_->compress_debug_sections(), "zstd") == 0)
     {
-      compress = gabi_zlib;
+      if (strcmp(this->options_->compress_debug_sections(), "zstd") == 0)
+	compress = zstd;
+      else
+	compress = gabi_zlib;
       if (size == 32)
 	compression_header_size = elfcpp::Elf_sizes<32>::chdr_size;
       else if (size == 64)
@@ -248,6 +342,13 @@ Output_compressed_section::set_final_data_size()
     }
   else
     compress = none;
+#ifdef HAVE_ZSTD
+  if (compress == zstd)
+    success = zstd_compress(compression_header_size, uncompressed_data,
+			    uncompressed_size, &this->data_,
+			    &compressed_size);
+  else
+#endif
   if (compress != none)
     success = zlib_compress(compression_header_size, uncompressed_data,
 			    uncompressed_size, &this->data_,
@@ -255,8 +356,11 @@ Output_compressed_section::set_final_data_size()
   if (success)
     {
       elfcpp::Elf_Xword flags = this->flags();
-      if (compress == gabi_zlib)
+      if (compress == gabi_zlib || compress == zstd)
 	{
+	  const elfcpp::Elf_Word ch_type = (compress == zstd
+					    ? elfcpp::ELFCOMPRESS_ZSTD
+					    : elfcpp::ELFCOMPRESS_ZLIB);
 	  // Set the SHF_COMPRESSED bit.
 	  flags |= elfcpp::SHF_COMPRESSED;
 	  const bool is_big_endian = parameters->target().is_big_endian();
@@ -266,14 +370,14 @@ Output_compressed_section::set_final_data_size()
 	      if (is_big_endian)
 		{
 		  elfcpp::Chdr_write<32, true> chdr(this->data_);
-		  chdr.put_ch_type(elfcpp::ELFCOMPRESS_ZLIB);
+		  chdr.put_ch_type(ch_type);
 		  chdr.put_ch_size(uncompressed_size);
 		  chdr.put_ch_addralign(addralign);
 		}
 	      else
 		{
 		  elfcpp::Chdr_write<32, false> chdr(this->data_);
-		  chdr.put_ch_type(elfcpp::ELFCOMPRESS_ZLIB);
+		  chdr.put_ch_type(ch_type);
 		  chdr.put_ch_size(uncompressed_size);
 		  chdr.put_ch_addralign(addralign);
 		}
@@ -283,7 +387,7 @@ Output_compressed_section::set_final_data_size()
 	      if (is_big_endian)
 		{
 		  elfcpp::Chdr_write<64, true> chdr(this->data_);
-		  chdr.put_ch_type(elfcpp::ELFCOMPRESS_ZLIB);
+		  chdr.put_ch_type(ch_type);
 		  chdr.put_ch_size(uncompressed_size);
 		  chdr.put_ch_addralign(addralign);
 		  // Clear the reserved field.
@@ -292,7 +396,7 @@ Output_compressed_section::set_final_data_size()
 	      else
 		{
 		  elfcpp::Chdr_write<64, false> chdr(this->data_);
-		  chdr.put_ch_type(elfcpp::ELFCOMPRESS_ZLIB);
+		  chdr.put_ch_type(ch_type);
 		  chdr.put_ch_size(uncompressed_size);
 		  chdr.put_ch_addralign(addralign);
 		  // Clear the reserved field.
@@ -317,7 +421,10 @@ Output_compressed_section::set_final_data_size()
     }
   else
     {
-      gold_warning(_("not compressing section data: zlib error"));
+      if (compress == zstd)
+	gold_warning(_("not compressing section data: zstd error"));
+      else
+	gold_warning(_("not compressing section data: zlib error"));
       gold_assert(this->data_ == NULL);
       this->set_data_size(uncompressed_size);
     }
@@ -1424,6 +1424,19 @@ Dwo_file::copy_section(Dwp_output_file* output_file, unsigned int shndx,
   bool is_new;
   const unsigned char* contents = this->section_contents(shndx, &len, &is_new);
 
+  // The .debug_info.dwo contributions are written to the output file
+  // immediately, so there is no need to copy them.
+  if (section_id == elfcpp::DW_SECT_INFO)
+    {
+      section_offset_type off =
+	  output_file->add_contribution(section_id, contents, len, 1);
+      if (is_new)
+	delete[] contents;
+      Section_bounds bounds(off, len);
+      this->sect_offsets_[shndx] = bounds;
+      return bounds;
+    }
+
   if (section_id == elfcpp::DW_SECT_STR_OFFSETS)
     {
       const unsigned char* remapped = this->remap_str_offsets(contents, len);
@@ -1617,6 +1630,8 @@ Dwp_output_file::add_output_section(const char* section_name, int align)
 // section directly to the output file as we receive contributions, allowing
 // us to free that memory as soon as possible. We will save the remaining
 // contributions until we finalize the layout of the output file.
+// The output file takes ownership of CONTENTS, except for .debug_info.dwo,
+// where the caller keeps it.
 
 section_offset_type
 Dwp_output_file::add_contribution(elfcpp::DW_SECT section_id,
@@ -1668,7 +1683,12 @@ Dwp_output_file::add_contribution(elfcpp::DW_SECT section_id,
       section_offset = file_offset - section.offset;
       section.size = file_offset + len - section.offset;
 
-      ::fseek(this->fd_, file_offset, SEEK_SET);
+      // Until we finalize, the only writes are the placeholder ELF
+      // header and these contributions, so the file is already
+      // positioned at NEXT_FILE_OFFSET_.  Avoid the fseek, which would
+      // flush the stdio buffer for every contribution.
+      if (file_offset != this->next_file_offset_)
+	::fseek(this->fd_, file_offset, SEEK_SET);
       if (::fwrite(contents, 1, len, this->fd_) < len)
 	gold_fatal(_("%s: error writing section '%s'"), this->name_,
 		   section_name);
@@ -1932,10 +1952,16 @@ Dwp_output_file::finalize()
 void
 Dwp_output_file::write_contributions(const Section& sect)
 {
+  // Only seek when there is a gap between contributions, so that
+  // adjacent contributions go through the stdio buffer together.
+  off_t file_pos = -1;
   for (unsigned int i = 0; i < sect.contributions.size(); ++i)
     {
       const Contribution& c = sect.contributions[i];
-      ::fseek(this->fd_, sect.offset + c.output_offset, SEEK_SET);
+      off_t file_offset = sect.offset + c.output_offset;
+      if (file_offset != file_pos)
+	::fseek(this->fd_, file_offset, SEEK_SET);
+      file_pos = file_offset + c.size;
       if (::fwrite(c.contents, 1, c.size, this->fd_) < c.size)
 	gold_fatal(_("%s: error writing section '%s'"), this->name_, sect.name);
       delete[] c.contents;
@@ -36,6 +36,10 @@
 #include <sys/uio.h>
 #endif
 
+#ifdef HAVE_GETRUSAGE
+#include <sys/resource.h>
+#endif
+
 #include <sys/stat.h>
 #include "filenames.h"
 
@@ -535,6 +539,34 @@ File_read::make_view(off_t start, section_size_type size,
   return v;
 }
 
+// Ask the kernel to start reading in the pages of the mmapped view V
+// which hold SIZE bytes at file offset START.  This is most useful for
+// the large section contents read during relocation and when copying
+// debug sections, which otherwise take one page fault after another.
+// The hint is only advisory, so failures are ignored.
+
+void
+File_read::advise_willneed(const View* v, off_t start,
+			   section_size_type size)
+{
+#if defined(HAVE_MADVISE) && defined(MADV_WILLNEED)
+  if (size < File_read::willneed_min_size || !v->is_mmapped())
+    return;
+  gold_assert(v->byteshift() == 0 && start >= v->start());
+  off_t poff = File_read::page_offset(start);
+  section_size_type psize = File_read::pages(size + (start - poff));
+  if (poff - v->start() + static_cast<off_t>(psize)
+      > static_cast<off_t>(v->size()))
+    psize = v->size() - (poff - v->start());
+  void* p = const_cast<unsigned char*>(v->data() + (poff - v->start()));
+  ::madvise(p, psize, MADV_WILLNEED);
+#else
+  (void) v;
+  (void) start;
+  (void) size;
+#endif
+}
+
 // Find a View or make a new one, shifted as required by the file
 // offset OFFSET and ALIGNED.
 
@@ -587,6 +619,7 @@ File_read::find_or_make_view(off_t offset, off_t start,
     {
       if (cache)
 	v->set_cache();
+      File_read::advise_willneed(v, offset + start, size);
       return v;
     }
 
@@ -614,9 +647,9 @@ File_read::find_or_make_view(off_t offset, off_t start,
 
   // Make a new view.  If we don't need an aligned view, use a
   // byteshift of 0, so that we can use mmap.
-  return this->make_view(offset + start, size,
-			 aligned ? byteshift : 0,
-			 cache);
+  v = this->make_view(offset + start, size, aligned ? byteshift : 0, cache);
+  File_read::advise_willneed(v, offset + start, size);
+  return v;
 }
 
 // Get a view into the file.
@@ -866,6 +899,13 @@ File_read::print_stats()
 	  program_name, File_read::total_mapped_bytes);
   fprintf(stderr, _("%s: maximum bytes mapped for read at one time: %llu\n"),
 	  program_name, File_read::maximum_mapped_bytes);
+#ifdef HAVE_GETRUSAGE
+  struct rusage ru;
+  if (::getrusage(RUSAGE_SELF, &ru) == 0)
+    fprintf(stderr, _("%s: page faults: %ld minor, %ld major\n"),
+	    program_name, static_cast<long>(ru.ru_minflt),
+	    static_cast<long>(ru.ru_majflt));
+#endif
 }
 
 // Class File_view.
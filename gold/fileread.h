@@ -339,6 +339,11 @@ class File_read
     is_permanent_view() const
     { return this->data_ownership_ == DATA_NOT_OWNED; }
 
+    // Returns TRUE if this view is mmapped from the file.
+    bool
+    is_mmapped() const
+    { return this->data_ownership_ == DATA_MMAPPED; }
+
    private:
     View(const View&);
     View& operator=(const View&);
@@ -400,6 +405,11 @@ class File_read
   find_or_make_view(off_t offset, off_t start, section_size_type size,
 		    bool aligned, bool cache);
 
+  // Tell the system that we are about to read SIZE bytes at file
+  // offset START through the view V.
+  static void
+  advise_willneed(const View* v, off_t start, section_size_type size);
+
   // Clear the file views.
   void
   clear_views(Clear_views_mode);
@@ -407,6 +417,10 @@ class File_read
   // The size of a file page for buffering data.
   static const off_t page_size = 8192;
 
+  // Requests at least this large get an madvise hint; the kernel's
+  // own readahead is good enough for smaller ones.
+  static const section_size_type willneed_min_size = 1024 * 1024;
+
   // Given a file offset, return the page offset.
   static off_t
   page_offset(off_t file_offset)
@@ -1125,31 +1125,32 @@ Gdb_index::scan_debug_info(bool is_type_unit,
 void
 Gdb_index::add_symbol(int cu_index, const char* sym_name, uint8_t flags)
 {
-  unsigned int hash = mapped_index_string_hash(
-      reinterpret_cast<const unsigned char*>(sym_name));
-  Gdb_symbol* sym = new Gdb_symbol();
-  this->stringpool_.add(sym_name, true, &sym->name_key);
-  sym->hashval = hash;
-  sym->cu_vector_index = 0;
-
-  Gdb_symbol* found = this->gdb_symtab_->add(sym);
-  if (found == sym)
+  // The string pool holds only symbol names, and hands out keys
+  // 1, 2, 3... in the order names are first added.  Each new symbol
+  // also gets the next CU vector, so a name's key identifies its CU
+  // vector and we only need to build a symbol table entry, and hash
+  // the name for it, for names we have not seen before.
+  Stringpool::Key name_key;
+  this->stringpool_.add(sym_name, true, &name_key);
+  unsigned int cu_vector_index = name_key - 1;
+  if (cu_vector_index == this->cu_vector_list_.size())
     {
       // New symbol -- allocate a new CU index vector.
-      found->cu_vector_index = this->cu_vector_list_.size();
+      Gdb_symbol* sym = new Gdb_symbol();
+      sym->name_key = name_key;
+      sym->hashval = mapped_index_string_hash(
+	  reinterpret_cast<const unsigned char*>(sym_name));
+      sym->cu_vector_index = cu_vector_index;
+      Gdb_symbol* found = this->gdb_symtab_->add(sym);
+      gold_assert(found == sym);
       this->cu_vector_list_.push_back(new Cu_vector());
     }
-  else
-    {
-      // Found an existing symbol -- append to the existing
-      // CU index vector.
-      delete sym;
-    }
+  gold_assert(cu_vector_index < this->cu_vector_list_.size());
 
   // Add the CU index to the vector list for this symbol,
   // if it's not already on the list.  We only need to
   // check the last added entry.
-  Cu_vector* cu_vec = this->cu_vector_list_[found->cu_vector_index];
+  Cu_vector* cu_vec = this->cu_vector_list_[cu_vector_index];
   if (cu_vec->size() == 0
       || cu_vec->back().first != cu_index
       || cu_vec->back().second != flags)
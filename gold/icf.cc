@@ -669,6 +669,10 @@ get_section_contents(bool first_iteration,
 //                            sections is already known to be unique.
 // SECTION_CONTENTS   : Store the section's text and relocs to non-ICF
 //                      sections.
+// FIXED_CKSUMS       : The checksum of each section's SECTION_CONTENTS,
+//                      which is the start of its full contents.  It is
+//                      computed in the first iteration and continued
+//                      over the remaining contents in later ones.
 
 static bool
 match_sections(unsigned int iteration_num,
@@ -678,7 +682,8 @@ match_sections(unsigned int iteration_num,
                const std::vector<Section_id>& id_section,
 	       const std::vector<uint64_t>& section_addraligns,
                std::vector<bool>* is_secn_or_group_unique,
-               std::vector<std::string>* section_contents)
+               std::vector<std::string>* section_contents,
+               std::vector<uint32_t>* fixed_cksums)
 {
   Unordered_multimap<uint32_t, unsigned int> section_cksum;
   std::pair<Unordered_multimap<uint32_t, unsigned int>::iterator,
@@ -735,15 +740,23 @@ match_sections(unsigned int iteration_num,
 
       const unsigned char* this_secn_contents_array =
             reinterpret_cast<const unsigned char*>(this_secn_contents.c_str());
-      cksum = xcrc32(this_secn_contents_array, this_secn_contents.length(),
-                     0xffffffff);
+      // The section text and relocs to non-ICF sections come first and
+      // do not change between iterations, so only checksum them once.
+      size_t fixed_len = this_secn_cache->length();
+      gold_assert(fixed_len <= this_secn_contents.length());
+      if (iteration_num == 1)
+        (*fixed_cksums)[i] = xcrc32(this_secn_contents_array, fixed_len,
+                                    0xffffffff);
+      cksum = xcrc32(this_secn_contents_array + fixed_len,
+                     this_secn_contents.length() - fixed_len,
+                     (*fixed_cksums)[i]);
       size_t count = section_cksum.count(cksum);
 
       if (count == 0)
         {
           // Start a group with this cksum.
           section_cksum.insert(std::make_pair(cksum, i));
-          full_section_contents[i] = this_secn_contents;
+          full_section_contents[i].swap(this_secn_contents);
         }
       else
         {
@@ -786,7 +799,7 @@ match_sections(unsigned int iteration_num,
             {
               // Create a new group for this cksum.
               section_cksum.insert(std::make_pair(cksum, i));
-              full_section_contents[i] = this_secn_contents;
+              full_section_contents[i].swap(this_secn_contents);
             }
         }
       // If there are no relocs to foldable sections do not process
@@ -956,6 +969,8 @@ Icf::find_identical_sections(const Input_objects* input_objects,
   std::vector<uint64_t> section_addraligns;
   std::vector<bool> is_secn_or_group_unique;
   std::vector<std::string> section_contents;
+  std::vector<uint32_t> fixed_cksums;
+  std::vector<uint64_t> section_sizes;
   const Target& target = parameters->target();
 
   // Decide which sections are possible candidates first.
@@ -1005,6 +1020,8 @@ Icf::find_identical_sections(const Input_objects* input_objects,
 	  section_addraligns.push_back((*p)->section_addralign(i));
           is_secn_or_group_unique.push_back(false);
           section_contents.push_back("");
+          fixed_cksums.push_back(0);
+          section_sizes.push_back((*p)->section_size(i));
           section_num++;
         }
 
@@ -1049,7 +1066,8 @@ Icf::find_identical_sections(const Input_objects* input_objects,
       converged = match_sections(num_iterations, symtab,
                                  &num_tracked_relocs, &this->kept_section_id_,
                                  this->id_section_, section_addraligns,
-                                 &is_secn_or_group_unique, &section_contents);
+                                 &is_secn_or_group_unique, &section_contents,
+                                 &fixed_cksums);
     }
 
   if (parameters->options().print_icf_sections())
@@ -1088,6 +1106,22 @@ Icf::find_identical_sections(const Input_objects* input_objects,
 
     }
 
+  if (parameters->options().stats())
+    {
+      unsigned int folded = 0;
+      unsigned long long folded_bytes = 0;
+      for (unsigned int i = 0; i < this->kept_section_id_.size(); i++)
+        if (this->kept_section_id_[i] != i)
+          {
+            folded++;
+            folded_bytes += section_sizes[i];
+          }
+      fprintf(stderr, _("%s: ICF iterations: %u; sections folded: %u of %u; "
+                        "bytes folded: %llu\n"),
+              program_name, num_iterations, folded, section_num,
+              folded_bytes);
+    }
+
   this->icf_ready();
 }
 
@@ -6075,11 +6075,12 @@ Write_symbols_task::locks(Task_locker* tl)
 // Run the task--write out the symbols.
 
 void
-Write_symbols_task::run(Workqueue*)
+Write_symbols_task::run(Workqueue* workqueue)
 {
   this->symtab_->write_globals(this->sympool_, this->dynpool_,
 			       this->layout_->symtab_xindex(),
-			       this->layout_->dynsym_xindex(), this->of_);
+			       this->layout_->dynsym_xindex(), this->of_,
+			       workqueue, this->final_blocker_);
 }
 
 // Write_after_input_sections_task methods.
@@ -920,6 +920,51 @@ Sized_relobj_file<size, big_endian>::base_read_symbols(Read_symbols_data* sd)
   sd->symbol_names = fvstrtab;
   sd->symbol_names_size =
     convert_to_section_size_type(strtabshdr.get_sh_size());
+
+  this->compute_symbol_name_info(sd);
+}
+
+// Compute the length and hash code of the name of each external
+// symbol, for use by Symbol_table::add_from_relobj.  This is done
+// here because symbols are read in parallel, while they are added to
+// the symbol table one object at a time.
+
+template<int size, bool big_endian>
+void
+Sized_relobj_file<size, big_endian>::compute_symbol_name_info(
+    Read_symbols_data* sd)
+{
+  const int sym_size = This::sym_size;
+  size_t symcount = ((sd->symbols_size - sd->external_symbols_offset)
+		     / sym_size);
+  const unsigned char* p = (sd->symbols->data()
+			    + sd->external_symbols_offset);
+  const char* sym_names =
+    reinterpret_cast<const char*>(sd->symbol_names->data());
+  section_size_type sym_names_size = sd->symbol_names_size;
+
+  // An unterminated string table is diagnosed when the symbols are
+  // added; leave it to the slow path.
+  if (sym_names_size == 0 || sym_names[sym_names_size - 1] != '\0')
+    return;
+
+  sd->symbol_name_info.resize(symcount);
+  for (size_t i = 0; i < symcount; ++i, p += sym_size)
+    {
+      elfcpp::Sym<size, big_endian> sym(p);
+      unsigned int st_name = sym.get_st_name();
+      Symbol_name_info* info = &sd->symbol_name_info[i];
+      if (st_name >= sym_names_size)
+	{
+	  info->hash_code = 0;
+	  info->length = 0;
+	  continue;
+	}
+      const char* name = sym_names + st_name;
+      const char* ver = strchr(name, '@');
+      info->length = ver != NULL ? ver - name : strlen(name);
+      info->hash_code = string_hash<char>(name, info->length);
+    }
 }
 
 // Return the section index of symbol SYM.  Set *VALUE to its value in
@@ -2144,10 +2189,14 @@ Sized_relobj_file<size, big_endian>::do_add_symbols(Symbol_table* symtab,
 
   const char* sym_names =
     reinterpret_cast<const char*>(sd->symbol_names->data());
+  const Symbol_name_info* name_info = NULL;
+  if (symcount != 0 && sd->symbol_name_info.size() == symcount)
+    name_info = &sd->symbol_name_info[0];
   symtab->add_from_relobj(this,
 			  sd->symbols->data() + sd->external_symbols_offset,
 			  symcount, this->local_symbol_count_,
 			  sym_names, sd->symbol_names_size,
+			  name_info,
 			  &this->symbols_,
 			  &this->defined_count_);
 
@@ -2155,6 +2204,7 @@ Sized_relobj_file<size, big_endian>::do_add_symbols(Symbol_table* symtab,
   sd->symbols = NULL;
   delete sd->symbol_names;
   sd->symbol_names = NULL;
+  std::vector<Symbol_name_info>().swap(sd->symbol_name_info);
 }
 
 // Find out if this object, that is a member of a lib group, should be included
@@ -54,6 +54,17 @@ struct Symbols_data;
 template<typename Stringpool_char>
 class Stringpool_template;
 
+// The length and hash code of the name of a global symbol, up to
+// any '@' version separator.  These are computed by read_symbols(),
+// which runs in parallel, so that add_symbols(), which does not, can
+// skip scanning and hashing the name.
+
+struct Symbol_name_info
+{
+  size_t hash_code;
+  size_t length;
+};
+
 // Data to pass from read_symbols() to add_symbols().
 
 struct Read_symbols_data
@@ -83,6 +94,8 @@ struct Read_symbols_data
   File_view* symbol_names;
   // Size of symbol name data in bytes.
   section_size_type symbol_names_size;
+  // Name lengths and hash codes of the external symbols, or empty.
+  std::vector<Symbol_name_info> symbol_name_info;
 
   // Version information.  This is only used on dynamic objects.
   // Version symbol data (from SHT_GNU_versym section).
@@ -2387,6 +2400,11 @@ class Sized_relobj_file : public Sized_relobj<size, big_endian>
   void
   base_read_symbols(Read_symbols_data*);
 
+  // Compute the name lengths and hash codes of the external symbols
+  // read by base_read_symbols.
+  void
+  compute_symbol_name_info(Read_symbols_data*);
+
   // Return the value of a local symbol.
   uint64_t
   do_local_symbol_value(unsigned int symndx, uint64_t addend) const
@@ -178,6 +178,9 @@ register_new_input(ld_plugin_new_input_handler handler);
 static enum ld_plugin_status
 get_wrap_symbols(uint64_t *num_symbols, const char ***wrap_symbol_list);
 
+static enum ld_plugin_status
+allow_concurrent_claim_file();
+
 };
 
 #endif // ENABLE_PLUGINS
@@ -223,7 +226,7 @@ Plugin::load()
   sscanf(ver, "%d.%d", &major, &minor);
 
   // Allocate and populate a transfer vector.
-  const int tv_fixed_size = 31;
+  const int tv_fixed_size = 32;
 
   int tv_size = this->args_.size() + tv_fixed_size;
   ld_plugin_tv* tv = new ld_plugin_tv[tv_size];
@@ -365,6 +368,10 @@ Plugin::load()
   tv[i].tv_tag = LDPT_GET_WRAP_SYMBOLS;
   tv[i].tv_u.tv_get_wrap_symbols = get_wrap_symbols;
 
+  ++i;
+  tv[i].tv_tag = LDPT_ALLOW_CONCURRENT_CLAIM_FILE;
+  tv[i].tv_u.tv_allow_concurrent_claim_file = allow_concurrent_claim_file;
+
   ++i;
   tv[i].tv_tag = LDPT_NULL;
   tv[i].tv_u.tv_val = 0;
@@ -731,6 +738,22 @@ Plugin_manager::load_plugins(Layout* layout)
        this->current_ != this->plugins_.end();
        ++this->current_)
     (*this->current_)->load();
+
+  // We can only call the claim-file handlers concurrently if every
+  // plugin allows it.  The plugin recorder expects the files in order.
+  this->concurrent_claim_file_ = (parameters->options().threads()
+				  && this->recorder_ == NULL
+				  && !this->plugins_.empty());
+  for (Plugin_list::const_iterator p = this->plugins_.begin();
+       p != this->plugins_.end();
+       ++p)
+    if (!(*p)->concurrent_claim_file())
+      this->concurrent_claim_file_ = false;
+  if (this->concurrent_claim_file_)
+    {
+      bool lock_initialized = this->initialize_lock_.initialize();
+      gold_assert(lock_initialized);
+    }
 }
 
 // Call the plugin claim-file handlers in turn to see if any claim the file.
@@ -739,6 +762,10 @@ Pluginobj*
 Plugin_manager::claim_file(Input_file* input_file, off_t offset,
                            off_t filesize, Object* elf_object)
 {
+  if (this->claiming_concurrently())
+    return this->claim_file_concurrently(input_file, offset, filesize,
+					 elf_object);
+
   bool lock_initialized = this->initialize_lock_.initialize();
 
   gold_assert(lock_initialized);
@@ -802,6 +829,82 @@ Plugin_manager::claim_file(Input_file* input_file, off_t offset,
   return NULL;
 }
 
+// Call the plugin claim-file handlers in turn to see if any claim the
+// file, when every plugin allows us to do that for several files at
+// once.  We only hold the lock while allocating the handle and while
+// recording the result, not while the plugins read the file.
+
+Pluginobj*
+Plugin_manager::claim_file_concurrently(Input_file* input_file, off_t offset,
+					off_t filesize, Object* elf_object)
+{
+  Claim claim;
+  claim.input_file = input_file;
+  claim.plugin_input_file.name = input_file->filename().c_str();
+  claim.plugin_input_file.fd = input_file->file().descriptor();
+  claim.plugin_input_file.offset = offset;
+  claim.plugin_input_file.filesize = filesize;
+
+  // Reserve a handle for this file.  If there is no ELF object, this
+  // leaves a NULL entry in objects_ unless the file is claimed.
+  unsigned int handle;
+  {
+    Hold_lock hl(*this->lock_);
+    handle = this->objects_.size();
+    this->objects_.push_back(elf_object);
+    this->claims_[handle] = &claim;
+  }
+  claim.plugin_input_file.handle = reinterpret_cast<void*>(handle);
+
+  bool claimed = false;
+  for (Plugin_list::iterator p = this->plugins_.begin();
+       p != this->plugins_.end();
+       ++p)
+    {
+      if ((*p)->claim_file(&claim.plugin_input_file))
+	{
+	  claimed = true;
+	  break;
+	}
+    }
+
+  Hold_lock hl(*this->lock_);
+  this->claims_.erase(handle);
+
+  if (!claimed)
+    return NULL;
+
+  this->any_claimed_ = true;
+
+  Object* obj = this->objects_[handle];
+  if (obj != NULL && obj->pluginobj() != NULL)
+    return obj->pluginobj();
+
+  // If the plugin claimed the file but did not call the add_symbols
+  // callback, we need to create the Pluginobj now.
+  Pluginobj* pluginobj =
+    make_sized_plugin_object(elf_object != NULL
+			     ? elf_object->name()
+			     : input_file->filename(),
+			     input_file, offset, filesize);
+  this->objects_[handle] = pluginobj;
+  return pluginobj;
+}
+
+// Return TRUE if the claim-file handlers are being called for the file
+// with HANDLE.
+
+bool
+Plugin_manager::in_claim_file_handler(const void* handle)
+{
+  if (!this->claiming_concurrently())
+    return this->in_claim_file_handler_;
+
+  Hold_lock hl(*this->lock_);
+  return this->find_claim(static_cast<unsigned int>(
+	     reinterpret_cast<intptr_t>(handle))) != NULL;
+}
+
 // Save an archive.  This is used so that a plugin can add a file
 // which refers to a symbol which was not previously referenced.  In
 // that case we want to pretend that the symbol was referenced before,
@@ -810,7 +913,7 @@ Plugin_manager::claim_file(Input_file* input_file, off_t offset,
 void
 Plugin_manager::save_archive(Archive* archive)
 {
-  if (this->in_replacement_phase_ || !this->any_claimed_)
+  if (this->in_replacement_phase_ || !this->any_claimed())
     delete archive;
   else
     this->rescannable_.push_back(Rescannable(archive));
@@ -821,7 +924,7 @@ Plugin_manager::save_archive(Archive* archive)
 void
 Plugin_manager::save_input_group(Input_group* input_group)
 {
-  if (this->in_replacement_phase_ || !this->any_claimed_)
+  if (this->in_replacement_phase_ || !this->any_claimed())
     delete input_group;
   else
     this->rescannable_.push_back(Rescannable(input_group));
@@ -1040,6 +1143,28 @@ Plugin_manager::cleanup()
 Pluginobj*
 Plugin_manager::make_plugin_object(unsigned int handle)
 {
+  if (this->claiming_concurrently())
+    {
+      // This may only be called from the claim-file handler, for the
+      // file being claimed.
+      Hold_lock hl(*this->lock_);
+      const Claim* claim = this->find_claim(handle);
+      if (claim == NULL)
+	return NULL;
+      Object* elf_object = this->objects_[handle];
+      if (elf_object != NULL && elf_object->pluginobj() != NULL)
+	return NULL;
+      Pluginobj* obj =
+	make_sized_plugin_object(elf_object != NULL
+				 ? elf_object->name()
+				 : claim->input_file->filename(),
+				 claim->input_file,
+				 claim->plugin_input_file.offset,
+				 claim->plugin_input_file.filesize);
+      this->objects_[handle] = obj;
+      return obj;
+    }
+
   // Make sure we aren't asked to make an object for the same handle twice.
   if (this->objects_.size() != handle
       && this->objects_[handle]->pluginobj() != NULL)
@@ -1074,6 +1199,9 @@ ld_plugin_status
 Plugin_manager::get_input_file(unsigned int handle,
                                struct ld_plugin_input_file* file)
 {
+  if (this->object(handle) == NULL)
+    return LDPS_BAD_HANDLE;
+
   Pluginobj* obj = this->object(handle)->pluginobj();
   if (obj == NULL)
     return LDPS_BAD_HANDLE;
@@ -1127,7 +1255,20 @@ Plugin_manager::get_view(unsigned int handle, const void **viewp)
   off_t offset;
   size_t filesize;
   Input_file *input_file;
-  if (this->in_claim_file_handler_)
+  const Claim* claim = NULL;
+  if (this->claiming_concurrently())
+    {
+      Hold_lock hl(*this->lock_);
+      claim = this->find_claim(handle);
+    }
+  if (claim != NULL)
+    {
+      // We are being called from the claim_file hook for this file.
+      offset = claim->plugin_input_file.offset;
+      filesize = claim->plugin_input_file.filesize;
+      input_file = claim->input_file;
+    }
+  else if (this->in_claim_file_handler_)
     {
       // We are being called from the claim_file hook.
       const struct ld_plugin_input_file &f = this->plugin_input_file_;
@@ -1399,7 +1540,10 @@ Sized_pluginobj<size, big_endian>::do_add_symbols(Symbol_table* symtab,
   unsigned char symbuf[sym_size];
   elfcpp::Sym_write<size, big_endian> osym(symbuf);
 
-  Plugin_recorder* recorder = parameters->options().plugins()->recorder();
+  Plugin_manager* plugins = parameters->options().plugins();
+  plugins->set_claimed_file_added();
+
+  Plugin_recorder* recorder = plugins->recorder();
   if (recorder != NULL)
     recorder->record_symbols(this, this->nsyms_, this->syms_);
 
@@ -1980,7 +2124,7 @@ get_input_section_count(const void* handle, unsigned int* count)
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(handle))
     return LDPS_ERR;
 
   Object* obj = parameters->options().plugins()->get_elf_object(handle);
@@ -2002,7 +2146,8 @@ get_input_section_type(const struct ld_plugin_section section,
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(
+	  section.handle))
     return LDPS_ERR;
 
   Object* obj
@@ -2025,7 +2170,8 @@ get_input_section_name(const struct ld_plugin_section section,
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(
+	  section.handle))
     return LDPS_ERR;
 
   Object* obj
@@ -2054,7 +2200,8 @@ get_input_section_contents(const struct ld_plugin_section section,
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(
+	  section.handle))
     return LDPS_ERR;
 
   Object* obj
@@ -2083,7 +2230,8 @@ get_input_section_alignment(const struct ld_plugin_section section,
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(
+	  section.handle))
     return LDPS_ERR;
 
   Object* obj
@@ -2106,7 +2254,8 @@ get_input_section_size(const struct ld_plugin_section section,
 {
   gold_assert(parameters->options().has_plugins());
 
-  if (!parameters->options().plugins()->in_claim_file_handler())
+  if (!parameters->options().plugins()->in_claim_file_handler(
+	  section.handle))
     return LDPS_ERR;
 
   Object* obj
@@ -2256,6 +2405,17 @@ register_new_input(ld_plugin_new_input_handler handler)
   return LDPS_OK;
 }
 
+// Let the linker know that the claim-file handler may be called for
+// several files at once.
+
+static enum ld_plugin_status
+allow_concurrent_claim_file()
+{
+  gold_assert(parameters->options().has_plugins());
+  parameters->options().plugins()->set_concurrent_claim_file();
+  return LDPS_OK;
+}
+
 #endif // ENABLE_PLUGINS
 
 // Allocate a Pluginobj object of the appropriate size and endianness.
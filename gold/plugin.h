@@ -24,6 +24,7 @@
 #define GOLD_PLUGIN_H
 
 #include <list>
+#include <map>
 #include <string>
 
 #include "object.h"
@@ -62,7 +63,8 @@ class Plugin
       all_symbols_read_handler_(NULL),
       cleanup_handler_(NULL),
       new_input_handler_(NULL),
-      cleanup_done_(false)
+      cleanup_done_(false),
+      concurrent_claim_file_(false)
   { }
 
   ~Plugin()
@@ -108,6 +110,16 @@ class Plugin
   set_new_input_handler(ld_plugin_new_input_handler handler)
   { this->new_input_handler_ = handler; }
 
+  // Record that the claim-file handler may be called concurrently.
+  void
+  set_concurrent_claim_file()
+  { this->concurrent_claim_file_ = true; }
+
+  // Return TRUE if the claim-file handler may be called concurrently.
+  bool
+  concurrent_claim_file() const
+  { return this->concurrent_claim_file_; }
+
   // Add an argument
   void
   add_option(const char* arg)
@@ -136,6 +148,8 @@ class Plugin
   ld_plugin_new_input_handler new_input_handler_;
   // TRUE if the cleanup handlers have been called.
   bool cleanup_done_;
+  // TRUE if the plugin allows concurrent calls to its claim-file handler.
+  bool concurrent_claim_file_;
 };
 
 // A manager class for plugins.
@@ -147,7 +161,8 @@ class Plugin_manager
     : plugins_(), objects_(), deferred_layout_objects_(), input_file_(NULL),
       plugin_input_file_(), rescannable_(), undefined_symbols_(),
       any_claimed_(false), in_replacement_phase_(false), any_added_(false),
-      in_claim_file_handler_(false),
+      in_claim_file_handler_(false), concurrent_claim_file_(false), claims_(),
+      claimed_file_added_(false),
       options_(options), workqueue_(NULL), task_(NULL), input_objects_(NULL),
       symtab_(NULL), layout_(NULL), dirpath_(NULL), mapfile_(NULL),
       this_blocker_(NULL), extra_search_path_(), lock_(NULL),
@@ -191,10 +206,10 @@ class Plugin_manager
   Object*
   get_elf_object(const void* handle);
 
-  // True if the claim_file handler of the plugins is being called.
+  // True if the claim_file handler of the plugins is being called for
+  // the file with HANDLE.
   bool
-  in_claim_file_handler()
-  { return in_claim_file_handler_; }
+  in_claim_file_handler(const void* handle);
 
   // Let the plugin manager save an archive for later rescanning.
   // This takes ownership of the Archive pointer.
@@ -258,6 +273,15 @@ class Plugin_manager
     (*this->current_)->set_cleanup_handler(handler);
   }
 
+  // Record that the current plugin's claim-file handler may be called
+  // concurrently.
+  void
+  set_concurrent_claim_file()
+  {
+    gold_assert(this->current_ != plugins_.end());
+    (*this->current_)->set_concurrent_claim_file();
+  }
+
   // Make a new Pluginobj object.  This is called when the plugin calls
   // the add_symbols API.
   Pluginobj*
@@ -267,6 +291,7 @@ class Plugin_manager
   Object*
   object(unsigned int handle) const
   {
+    Hold_optional_lock hl(this->claiming_concurrently() ? this->lock_ : NULL);
     if (handle >= this->objects_.size())
       return NULL;
     return this->objects_[handle];
@@ -276,7 +301,12 @@ class Plugin_manager
   // and we are still in the initial input phase.
   bool
   should_defer_layout() const
-  { return this->any_claimed_ && !this->in_replacement_phase_; }
+  { return this->any_claimed() && !this->in_replacement_phase_; }
+
+  // Record that the symbols of a claimed file have been added.
+  void
+  set_claimed_file_added()
+  { this->claimed_file_added_ = true; }
 
   // Add a regular object to the deferred layout list.  These are
   // objects whose layout has been deferred until after the
@@ -359,6 +389,50 @@ class Plugin_manager
   typedef std::vector<Rescannable> Rescannable_list;
   typedef std::vector<Symbol*> Undefined_symbol_list;
 
+  // A file which is up for claim by the plugins, when the claim-file
+  // handlers are called concurrently.
+  struct Claim
+  {
+    Input_file* input_file;
+    struct ld_plugin_input_file plugin_input_file;
+  };
+
+  typedef std::map<unsigned int, const Claim*> Claim_map;
+
+  // Return TRUE if any input files have been claimed.  When the
+  // claim-file handlers are called concurrently, a file may be claimed
+  // after a later file has been added, so we only look at the claimed
+  // files whose symbols have been added, which happens in command line
+  // order.  Otherwise the output would depend on thread timing.
+  bool
+  any_claimed() const
+  {
+    return (this->concurrent_claim_file_
+	    ? this->claimed_file_added_
+	    : this->any_claimed_);
+  }
+
+  // Return TRUE if the claim-file handlers are called concurrently.
+  // Files added in the replacement phase are still handled serially.
+  bool
+  claiming_concurrently() const
+  { return this->concurrent_claim_file_ && !this->in_replacement_phase_; }
+
+  // Like claim_file, but without holding the lock while calling the
+  // claim-file handlers.
+  Pluginobj*
+  claim_file_concurrently(Input_file* input_file, off_t offset,
+			  off_t filesize, Object* elf_object);
+
+  // Return the file being claimed with HANDLE when claiming files
+  // concurrently, or NULL.  The caller must hold the lock.
+  const Claim*
+  find_claim(unsigned int handle) const
+  {
+    Claim_map::const_iterator p = this->claims_.find(handle);
+    return p == this->claims_.end() ? NULL : p->second;
+  }
+
   // Rescan archives for undefined symbols.
   void
   rescan(Task*);
@@ -404,6 +478,16 @@ class Plugin_manager
   // Set to true when the claim_file handler of a plugin is called.
   bool in_claim_file_handler_;
 
+  // Set to true if every plugin allows concurrent calls to its
+  // claim_file handler.  In that case the files up for claim are
+  // recorded in CLAIMS_, by handle, rather than in INPUT_FILE_ and
+  // PLUGIN_INPUT_FILE_, and IN_CLAIM_FILE_HANDLER_ is not used.
+  bool concurrent_claim_file_;
+  Claim_map claims_;
+
+  // Set to true when the symbols of a claimed file have been added.
+  bool claimed_file_added_;
+
   const General_options& options_;
   Workqueue* workqueue_;
   Task* task_;
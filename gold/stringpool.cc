@@ -24,6 +24,7 @@
 
 #include <cstring>
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 #include "output.h"
@@ -241,6 +242,25 @@ Stringpool_template<Stringpool_char>::add_with_length(const Stringpool_char* s,
 						      size_t length,
 						      bool copy,
 						      Key* pkey)
+{
+  return this->add_hashkey(Hashkey(s, length), copy, pkey);
+}
+
+template<typename Stringpool_char>
+const Stringpool_char*
+Stringpool_template<Stringpool_char>::add_with_hash(const Stringpool_char* s,
+						    size_t length,
+						    size_t hash_code,
+						    bool copy,
+						    Key* pkey)
+{
+  return this->add_hashkey(Hashkey(s, length, hash_code), copy, pkey);
+}
+
+template<typename Stringpool_char>
+const Stringpool_char*
+Stringpool_template<Stringpool_char>::add_hashkey(Hashkey hk, bool copy,
+						  Key* pkey)
 {
   typedef std::pair<typename String_set_type::iterator, bool> Insert_type;
 
@@ -252,7 +272,7 @@ Stringpool_template<Stringpool_char>::add_with_length(const Stringpool_char* s,
       // When we don't need to copy the string, we can call insert
       // directly.
 
-      std::pair<Hashkey, Hashval> element(Hashkey(s, length), k);
+      std::pair<Hashkey, Hashval> element(hk, k);
 
       Insert_type ins = this->string_set_.insert(element);
 
@@ -262,7 +282,7 @@ Stringpool_template<Stringpool_char>::add_with_length(const Stringpool_char* s,
 	{
 	  // We just added the string.  The key value has now been
 	  // used.
-	  this->new_key_offset(length);
+	  this->new_key_offset(hk.length);
 	}
       else
 	{
@@ -274,34 +294,32 @@ Stringpool_template<Stringpool_char>::add_with_length(const Stringpool_char* s,
       return p->first.string;
     }
 
-  // When we have to copy the string, we look it up twice in the hash
-  // table.  The problem is that we can't insert S before we
-  // canonicalize it by copying it into the canonical list. The hash
-  // code will only be computed once.
+  // When we have to copy the string, insert the caller's string and,
+  // if it was not already present, then point the new entry at a
+  // canonical copy.  This looks up the string once rather than doing
+  // a find followed by an insert.
 
-  Hashkey hk(s, length);
-  typename String_set_type::const_iterator p = this->string_set_.find(hk);
-  if (p != this->string_set_.end())
+  std::pair<Hashkey, Hashval> element(hk, k);
+
+  Insert_type ins = this->string_set_.insert(element);
+  if (!ins.second)
     {
+      gold_assert(k != ins.first->second);
       if (pkey != NULL)
-	*pkey = p->second;
-      return p->first.string;
+	*pkey = ins.first->second;
+      return ins.first->first.string;
     }
 
-  this->new_key_offset(length);
+  this->new_key_offset(hk.length);
 
-  hk.string = this->add_string(s, length);
-  // The contents of the string stay the same, so we don't need to
-  // adjust hk.hash_code or hk.length.
-
-  std::pair<Hashkey, Hashval> element(hk, k);
-
-  Insert_type ins = this->string_set_.insert(element);
-  gold_assert(ins.second);
+  // The contents of the string stay the same, so the entry's hash
+  // code and length, and its position in the table, remain valid.
+  const Hashkey& entry(ins.first->first);
+  entry.string = this->add_string(hk.string, hk.length);
 
   if (pkey != NULL)
     *pkey = k;
-  return hk.string;
+  return entry.string;
 }
 
 template<typename Stringpool_char>
@@ -354,6 +372,101 @@ Stringpool_template<Stringpool_char>::Stringpool_sort_comparison::operator()(
   return len1 > len2;
 }
 
+// The key of the character DEPTH characters from the end of the
+// string in INFO, for sort_for_suffixes.  Keys order characters the
+// same way as Stringpool_sort_comparison; past the start of the
+// string the key is 0, below any character.
+
+template<typename Stringpool_char>
+inline long long
+Stringpool_template<Stringpool_char>::sort_key(
+    const Stringpool_sort_info& info,
+    size_t depth)
+{
+  const Hashkey& hk(info->first);
+  if (depth >= hk.length)
+    return 0;
+  return (static_cast<long long>(hk.string[hk.length - 1 - depth])
+	  - std::numeric_limits<Stringpool_char>::min() + 1);
+}
+
+// Sort V into the order given by Stringpool_sort_comparison.  Since
+// the comparison looks at the strings from the end, and strings that
+// share a suffix share many characters, a comparison sort spends most
+// of its time rescanning those characters.  Instead use a multikey
+// quicksort (Bentley and Sedgewick), which partitions on one
+// character at a time and never looks at a character twice.  Small
+// ranges are finished with std::sort.
+
+template<typename Stringpool_char>
+void
+Stringpool_template<Stringpool_char>::sort_for_suffixes(
+    std::vector<Stringpool_sort_info>* v)
+{
+  struct Range
+  {
+    size_t lo;
+    size_t hi;
+    size_t depth;
+  };
+
+  std::vector<Range> stack;
+  Range all = { 0, v->size(), 0 };
+  stack.push_back(all);
+  while (!stack.empty())
+    {
+      Range r = stack.back();
+      stack.pop_back();
+
+      size_t n = r.hi - r.lo;
+      if (n < 16)
+	{
+	  std::sort(v->begin() + r.lo, v->begin() + r.hi,
+		    Stringpool_sort_comparison());
+	  continue;
+	}
+
+      // Median of three as the pivot.
+      long long a = sort_key((*v)[r.lo], r.depth);
+      long long b = sort_key((*v)[r.lo + n / 2], r.depth);
+      long long c = sort_key((*v)[r.hi - 1], r.depth);
+      long long pivot;
+      if (a < b)
+	pivot = b < c ? b : (a < c ? c : a);
+      else
+	pivot = a < c ? a : (b < c ? c : b);
+
+      // Partition so that larger keys come first, as
+      // Stringpool_sort_comparison puts them first.
+      size_t gt = r.lo;
+      size_t i = r.lo;
+      size_t lt = r.hi;
+      while (i < lt)
+	{
+	  long long k = sort_key((*v)[i], r.depth);
+	  if (k > pivot)
+	    std::swap((*v)[gt++], (*v)[i++]);
+	  else if (k < pivot)
+	    std::swap((*v)[i], (*v)[--lt]);
+	  else
+	    ++i;
+	}
+
+      Range greater = { r.lo, gt, r.depth };
+      Range less = { lt, r.hi, r.depth };
+      if (greater.hi - greater.lo > 1)
+	stack.push_back(greater);
+      if (less.hi - less.lo > 1)
+	stack.push_back(less);
+      // Strings which ended at this depth are all equal.
+      if (pivot != 0 && lt - gt > 1)
+	{
+	  Range equal = { gt, lt, r.depth + 1 };
+	  stack.push_back(equal);
+	}
+    }
+}
+
 // Return whether s1 is a suffix of s2.
 
 template<typename Stringpool_char>
@@ -408,7 +521,7 @@ Stringpool_template<Stringpool_char>::set_string_offsets()
            ++p)
         v.push_back(Stringpool_sort_info(p));
 
-      std::sort(v.begin(), v.end(), Stringpool_sort_comparison());
+      sort_for_suffixes(&v);
 
       section_offset_type last_offset = -1;
       for (typename std::vector<Stringpool_sort_info>::iterator last = v.end(),
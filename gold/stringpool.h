@@ -229,6 +229,12 @@ class Stringpool_template
   const Stringpool_char*
   add_with_length(const Stringpool_char* s, size_t len, bool copy, Key* pkey);
 
+  // Add string S of length LEN characters to the pool, where
+  // HASH_CODE is string_hash(S, LEN) computed by the caller.
+  const Stringpool_char*
+  add_with_hash(const Stringpool_char* s, size_t len, size_t hash_code,
+		bool copy, Key* pkey);
+
   // If the string S is present in the pool, return the canonical
   // string pointer.  Otherwise, return NULL.  If PKEY is not NULL,
   // set *PKEY to the key.
@@ -321,6 +327,12 @@ class Stringpool_template
   const Stringpool_char*
   add_string(const Stringpool_char*, size_t);
 
+  struct Hashkey;
+
+  // Add the string described by a hash table key to the pool.
+  const Stringpool_char*
+  add_hashkey(Hashkey hk, bool copy, Key* pkey);
+
   // Return whether s1 is a suffix of s2.
   static bool
   is_suffix(const Stringpool_char* s1, size_t len1,
@@ -333,7 +345,9 @@ class Stringpool_template
   // hash code is a significant user of CPU time in the linker.
   struct Hashkey
   {
-    const Stringpool_char* string;
+    // This is mutable so that add_hashkey can point a newly inserted
+    // entry at the canonical copy of the string.
+    mutable const Stringpool_char* string;
     // Length is in characters, not bytes.
     size_t length;
     size_t hash_code;
@@ -353,6 +367,10 @@ class Stringpool_template
     Hashkey(const Stringpool_char* s, size_t len)
       : string(s), length(len), hash_code(string_hash(s, len))
     { }
+
+    Hashkey(const Stringpool_char* s, size_t len, size_t hash)
+      : string(s), length(len), hash_code(hash)
+    { }
   };
 
   // Hash function.  This is trivial, since we have already computed
@@ -388,6 +406,15 @@ class Stringpool_template
     operator()(const Stringpool_sort_info&, const Stringpool_sort_info&) const;
   };
 
+  // Return the key used by sort_for_suffixes for the character DEPTH
+  // characters from the end of the string in INFO.
+  static long long
+  sort_key(const Stringpool_sort_info& info, size_t depth);
+
+  // Sort V into the order given by Stringpool_sort_comparison.
+  static void
+  sort_for_suffixes(std::vector<Stringpool_sort_info>* v);
+
   // Keys map to offsets via a Chunked_vector.  We only use the
   // offsets if we turn this into an string table section.
   typedef Chunked_vector<section_offset_type> Key_to_offset;
@@ -1182,6 +1182,7 @@ Symbol_table::add_from_relobj(
     size_t symndx_offset,
     const char* sym_names,
     size_t sym_name_size,
+    const Symbol_name_info* name_info,
     typename Sized_relobj_file<size, big_endian>::Symbols* sympointers,
     size_t* defined)
 {
@@ -1243,7 +1244,13 @@ Symbol_table::add_from_relobj(
       // In an object file, an '@' in the name separates the symbol
       // name from the version name.  If there are two '@' characters,
       // this is the default version.
-      const char* ver = strchr(name, '@');
+      const char* ver;
+      if (name_info != NULL)
+	ver = (name[name_info[i].length] == '@'
+	       ? name + name_info[i].length
+	       : NULL);
+      else
+	ver = strchr(name, '@');
       Stringpool::Key ver_key = 0;
       int namelen = 0;
       // IS_DEFAULT_VERSION: is the version default?
@@ -1276,7 +1283,7 @@ Symbol_table::add_from_relobj(
       // about a common symbol?
       else
 	{
-	  namelen = strlen(name);
+	  namelen = name_info != NULL ? name_info[i].length : strlen(name);
 	  if (!this->version_script_.empty()
 	      && st_shndx != elfcpp::SHN_UNDEF)
 	    {
@@ -1348,8 +1355,13 @@ Symbol_table::add_from_relobj(
         }
 
       Stringpool::Key name_key;
-      name = this->namepool_.add_with_length(name, namelen, true,
+      if (name_info != NULL)
+	name = this->namepool_.add_with_hash(name, namelen,
+					     name_info[i].hash_code, true,
 					     &name_key);
+      else
+	name = this->namepool_.add_with_length(name, namelen, true,
+					       &name_key);
 
       Sized_symbol<size>* res;
       res = this->add_from_object(relobj, name, name_key, ver, ver_key,
@@ -3015,6 +3027,120 @@ Symbol_table::sized_finalize_symbol(Symbol* unsized_sym)
   return true;
 }
 
+// Data shared by the tasks which write out the global symbols.
+
+struct Symbol_table::Write_globals_data
+{
+  const Stringpool* sympool;
+  const Stringpool* dynpool;
+  Output_symtab_xindex* symtab_xindex;
+  Output_symtab_xindex* dynsym_xindex;
+  Output_file* of;
+  // The views of the symbol table and the dynamic symbol table.
+  unsigned char* psyms;
+  unsigned char* dynamic_view;
+  // The global symbols to write.
+  std::vector<Symbol*> syms;
+  // The extended section indexes found by each chunk.
+  std::vector<Xindex_list> symtab_xindex_lists;
+  std::vector<Xindex_list> dynsym_xindex_lists;
+};
+
+// The number of global symbols written by each Write_globals_task.
+
+static const size_t write_globals_chunk_size = 16384;
+
+// A task which writes out one chunk of the global symbols.
+
+template<int size, bool big_endian>
+class Write_globals_task : public Task
+{
+ public:
+  Write_globals_task(const Symbol_table* symtab,
+		     Symbol_table::Write_globals_data* data,
+		     unsigned int chunk, Task_token* chunks_blocker)
+    : symtab_(symtab), data_(data), chunk_(chunk),
+      chunks_blocker_(chunks_blocker)
+  { }
+
+  // The standard Task methods.
+
+  Task_token*
+  is_runnable()
+  { return NULL; }
+
+  void
+  locks(Task_locker* tl)
+  { tl->add(this, this->chunks_blocker_); }
+
+  void
+  run(Workqueue*)
+  {
+    this->symtab_->sized_write_globals_chunk<size, big_endian>(this->data_,
+							       this->chunk_);
+  }
+
+  std::string
+  get_name() const
+  { return "Write_globals_task"; }
+
+ private:
+  const Symbol_table* symtab_;
+  Symbol_table::Write_globals_data* data_;
+  unsigned int chunk_;
+  Task_token* chunks_blocker_;
+};
+
+// A task which runs after all the Write_globals_tasks, to write out
+// the target-specific symbols and release the output views.
+
+template<int size, bool big_endian>
+class Write_globals_final_task : public Task
+{
+ public:
+  Write_globals_final_task(const Symbol_table* symtab,
+			   Symbol_table::Write_globals_data* data,
+			   Task_token* chunks_blocker,
+			   Task_token* final_blocker)
+    : symtab_(symtab), data_(data), chunks_blocker_(chunks_blocker),
+      final_blocker_(final_blocker)
+  { }
+
+  ~Write_globals_final_task()
+  {
+    delete this->data_;
+    delete this->chunks_blocker_;
+  }
+
+  // The standard Task methods.
+
+  Task_token*
+  is_runnable()
+  {
+    if (this->chunks_blocker_->is_blocked())
+      return this->chunks_blocker_;
+    return NULL;
+  }
+
+  void
+  locks(Task_locker* tl)
+  { tl->add(this, this->final_blocker_); }
+
+  void
+  run(Workqueue*)
+  { this->symtab_->sized_write_globals_finish<size, big_endian>(this->data_); }
+
+  std::string
+  get_name() const
+  { return "Write_globals_final_task"; }
+
+ private:
+  const Symbol_table* symtab_;
+  Symbol_table::Write_globals_data* data_;
+  Task_token* chunks_blocker_;
+  Task_token* final_blocker_;
+};
+
 // Write out the global symbols.
 
 void
@@ -3022,32 +3148,37 @@ Symbol_table::write_globals(const Stringpool* sympool,
 			    const Stringpool* dynpool,
 			    Output_symtab_xindex* symtab_xindex,
 			    Output_symtab_xindex* dynsym_xindex,
-			    Output_file* of) const
+			    Output_file* of, Workqueue* workqueue,
+			    Task_token* final_blocker) const
 {
   switch (parameters->size_and_endianness())
     {
 #ifdef HAVE_TARGET_32_LITTLE
     case Parameters::TARGET_32_LITTLE:
       this->sized_write_globals<32, false>(sympool, dynpool, symtab_xindex,
-					   dynsym_xindex, of);
+					   dynsym_xindex, of, workqueue,
+					   final_blocker);
       break;
 #endif
 #ifdef HAVE_TARGET_32_BIG
     case Parameters::TARGET_32_BIG:
       this->sized_write_globals<32, true>(sympool, dynpool, symtab_xindex,
-					  dynsym_xindex, of);
+					  dynsym_xindex, of, workqueue,
+					  final_blocker);
       break;
 #endif
 #ifdef HAVE_TARGET_64_LITTLE
     case Parameters::TARGET_64_LITTLE:
       this->sized_write_globals<64, false>(sympool, dynpool, symtab_xindex,
-					   dynsym_xindex, of);
+					   dynsym_xindex, of, workqueue,
+					   final_blocker);
       break;
 #endif
 #ifdef HAVE_TARGET_64_BIG
     case Parameters::TARGET_64_BIG:
       this->sized_write_globals<64, true>(sympool, dynpool, symtab_xindex,
-					  dynsym_xindex, of);
+					  dynsym_xindex, of, workqueue,
+					  final_blocker);
       break;
 #endif
     default:
@@ -3055,7 +3186,12 @@ Symbol_table::write_globals(const Stringpool* sympool,
     }
 }
 
-// Write out the global symbols.
+// Write out the global symbols.  The symbols are split into chunks of
+// write_globals_chunk_size.  When using threads, each chunk is written
+// by a separate task, and a final task, which holds FINAL_BLOCKER,
+// finishes up once they are all done.  Each symbol has its own slot
+// in the output, so the result does not depend on the order in which
+// the chunks run.
 
 template<int size, bool big_endian>
 void
@@ -3063,210 +3199,327 @@ Symbol_table::sized_write_globals(const Stringpool* sympool,
 				  const Stringpool* dynpool,
 				  Output_symtab_xindex* symtab_xindex,
 				  Output_symtab_xindex* dynsym_xindex,
-				  Output_file* of) const
+				  Output_file* of, Workqueue* workqueue,
+				  Task_token* final_blocker) const
 {
-  const Target& target = parameters->target();
-
   const int sym_size = elfcpp::Elf_sizes<size>::sym_size;
 
+  Write_globals_data* data = new Write_globals_data;
+  data->sympool = sympool;
+  data->dynpool = dynpool;
+  data->symtab_xindex = symtab_xindex;
+  data->dynsym_xindex = dynsym_xindex;
+  data->of = of;
+
   const unsigned int output_count = this->output_count_;
-  const section_size_type oview_size = output_count * sym_size;
-  const unsigned int first_global_index = this->first_global_index_;
-  unsigned char* psyms;
   if (this->offset_ == 0 || output_count == 0)
-    psyms = NULL;
+    data->psyms = NULL;
   else
-    psyms = of->get_output_view(this->offset_, oview_size);
+    data->psyms = of->get_output_view(this->offset_, output_count * sym_size);
 
   const unsigned int dynamic_count = this->dynamic_count_;
-  const section_size_type dynamic_size = dynamic_count * sym_size;
-  const unsigned int first_dynamic_global_index =
-    this->first_dynamic_global_index_;
-  unsigned char* dynamic_view;
   if (this->dynamic_offset_ == 0 || dynamic_count == 0)
-    dynamic_view = NULL;
+    data->dynamic_view = NULL;
   else
-    dynamic_view = of->get_output_view(this->dynamic_offset_, dynamic_size);
+    data->dynamic_view = of->get_output_view(this->dynamic_offset_,
+					     dynamic_count * sym_size);
 
+  // Issue any warnings here, so that they come out in a consistent
+  // order.
+  data->syms.reserve(this->table_.size());
   for (Symbol_table_type::const_iterator p = this->table_.begin();
        p != this->table_.end();
        ++p)
     {
-      Sized_symbol<size>* sym = static_cast<Sized_symbol<size>*>(p->second);
-
       // Possibly warn about unresolved symbols in shared libraries.
-      this->warn_about_undefined_dynobj_symbol(sym);
+      this->warn_about_undefined_dynobj_symbol(p->second);
+      data->syms.push_back(p->second);
+    }
 
-      unsigned int sym_index = sym->symtab_index();
-      unsigned int dynsym_index;
-      if (dynamic_view == NULL)
-	dynsym_index = -1U;
-      else
-	dynsym_index = sym->dynsym_index();
+  const unsigned int chunk_count =
+    ((data->syms.size() + write_globals_chunk_size - 1)
+     / write_globals_chunk_size);
+  data->symtab_xindex_lists.resize(chunk_count);
+  data->dynsym_xindex_lists.resize(chunk_count);
 
-      if (sym_index == -1U && dynsym_index == -1U)
-	{
-	  // This symbol is not included in the output file.
-	  continue;
-	}
+  if (chunk_count <= 1 || !parameters->options().threads())
+    {
+      for (unsigned int i = 0; i < chunk_count; ++i)
+	this->sized_write_globals_chunk<size, big_endian>(data, i);
+      this->sized_write_globals_finish<size, big_endian>(data);
+      delete data;
+      return;
+    }
 
-      unsigned int shndx;
-      typename elfcpp::Elf_types<size>::Elf_Addr sym_value = sym->value();
-      typename elfcpp::Elf_types<size>::Elf_Addr dynsym_value = sym_value;
-      elfcpp::STB binding = sym->binding();
-
-      // If --weak-unresolved-symbols is set, change binding of unresolved
-      // global symbols to STB_WEAK.
-      if (parameters->options().weak_unresolved_symbols()
-	  && binding == elfcpp::STB_GLOBAL
-	  && sym->is_undefined())
-	binding = elfcpp::STB_WEAK;
-
-      // If --no-gnu-unique is set, change STB_GNU_UNIQUE to STB_GLOBAL.
-      if (binding == elfcpp::STB_GNU_UNIQUE
-	  && !parameters->options().gnu_unique())
-	binding = elfcpp::STB_GLOBAL;
+  Task_token* chunks_blocker = new Task_token(true);
+  chunks_blocker->add_blockers(chunk_count);
+  for (unsigned int i = 0; i < chunk_count; ++i)
+    workqueue->queue(new Write_globals_task<size, big_endian>(this, data, i,
+							      chunks_blocker));
+
+  // Write_symbols_task releases FINAL_BLOCKER when it completes, so
+  // add another blocker for the final task to release.
+  workqueue->add_blocker(final_blocker);
+  workqueue->queue(new Write_globals_final_task<size, big_endian>(
+      this, data, chunks_blocker, final_blocker));
+}
 
-      switch (sym->source())
-	{
-	case Symbol::FROM_OBJECT:
-	  {
-	    bool is_ordinary;
-	    unsigned int in_shndx = sym->shndx(&is_ordinary);
+// Write out one chunk of the global symbols.  Extended section
+// indexes are collected in per-chunk lists, so that chunks may run in
+// parallel.
+
+template<int size, bool big_endian>
+void
+Symbol_table::sized_write_globals_chunk(Write_globals_data* data,
+				       unsigned int chunk) const
+{
+  size_t begin = chunk * write_globals_chunk_size;
+  size_t end = std::min(begin + write_globals_chunk_size, data->syms.size());
+  Xindex_list* symtab_xindex = &data->symtab_xindex_lists[chunk];
+  Xindex_list* dynsym_xindex = &data->dynsym_xindex_lists[chunk];
+  for (size_t i = begin; i < end; ++i)
+    {
+      Sized_symbol<size>* sym =
+	static_cast<Sized_symbol<size>*>(data->syms[i]);
+      this->sized_write_global<size, big_endian>(sym, data->sympool,
+						 data->dynpool, data->psyms,
+						 data->dynamic_view,
+						 symtab_xindex, dynsym_xindex);
+    }
+}
+
+// Write out the global symbol SYM.  Extended section indexes are added
+// to SYMTAB_XINDEX and DYNSYM_XINDEX.
+
+template<int size, bool big_endian>
+void
+Symbol_table::sized_write_global(Sized_symbol<size>* sym,
+				 const Stringpool* sympool,
+				 const Stringpool* dynpool,
+				 unsigned char* psyms,
+				 unsigned char* dynamic_view,
+				 Xindex_list* symtab_xindex,
+				 Xindex_list* dynsym_xindex) const
+{
+  const Target& target = parameters->target();
+
+  const int sym_size = elfcpp::Elf_sizes<size>::sym_size;
+
+  const unsigned int output_count = this->output_count_;
+  const unsigned int first_global_index = this->first_global_index_;
+  const unsigned int dynamic_count = this->dynamic_count_;
+  const unsigned int first_dynamic_global_index =
+    this->first_dynamic_global_index_;
+
+  unsigned int sym_index = sym->symtab_index();
+  unsigned int dynsym_index;
+  if (dynamic_view == NULL)
+    dynsym_index = -1U;
+  else
+    dynsym_index = sym->dynsym_index();
+
+  if (sym_index == -1U && dynsym_index == -1U)
+    {
+      // This symbol is not included in the output file.
+      return;
+    }
+
+  unsigned int shndx;
+  typename elfcpp::Elf_types<size>::Elf_Addr sym_value = sym->value();
+  typename elfcpp::Elf_types<size>::Elf_Addr dynsym_value = sym_value;
+  elfcpp::STB binding = sym->binding();
+
+  // If --weak-unresolved-symbols is set, change binding of unresolved
+  // global symbols to STB_WEAK.
+  if (parameters->options().weak_unresolved_symbols()
+      && binding == elfcpp::STB_GLOBAL
+      && sym->is_undefined())
+    binding = elfcpp::STB_WEAK;
+
+  // If --no-gnu-unique is set, change STB_GNU_UNIQUE to STB_GLOBAL.
+  if (binding == elfcpp::STB_GNU_UNIQUE
+      && !parameters->options().gnu_unique())
+    binding = elfcpp::STB_GLOBAL;
 
-	    if (!is_ordinary
-		&& in_shndx != elfcpp::SHN_ABS
-		&& !Symbol::is_common_shndx(in_shndx))
+  switch (sym->source())
+    {
+    case Symbol::FROM_OBJECT:
+      {
+	bool is_ordinary;
+	unsigned int in_shndx = sym->shndx(&is_ordinary);
+
+	if (!is_ordinary
+	    && in_shndx != elfcpp::SHN_ABS
+	    && !Symbol::is_common_shndx(in_shndx))
+	  {
+	    gold_error(_("%s: unsupported symbol section 0x%x"),
+		       sym->demangled_name().c_str(), in_shndx);
+	    shndx = in_shndx;
+	  }
+	else
+	  {
+	    Object* symobj = sym->object();
+	    if (symobj->is_dynamic())
 	      {
-		gold_error(_("%s: unsupported symbol section 0x%x"),
-			   sym->demangled_name().c_str(), in_shndx);
-		shndx = in_shndx;
+		if (sym->needs_dynsym_value())
+		  dynsym_value = target.dynsym_value(sym);
+		shndx = elfcpp::SHN_UNDEF;
+		if (sym->is_undef_binding_weak())
+		  binding = elfcpp::STB_WEAK;
+		else
+		  binding = elfcpp::STB_GLOBAL;
 	      }
+	    else if (symobj->pluginobj() != NULL)
+	      shndx = elfcpp::SHN_UNDEF;
+	    else if (in_shndx == elfcpp::SHN_UNDEF
+		     || (!is_ordinary
+			 && (in_shndx == elfcpp::SHN_ABS
+			     || Symbol::is_common_shndx(in_shndx))))
+	      shndx = in_shndx;
 	    else
 	      {
-		Object* symobj = sym->object();
-		if (symobj->is_dynamic())
-		  {
-		    if (sym->needs_dynsym_value())
-		      dynsym_value = target.dynsym_value(sym);
-		    shndx = elfcpp::SHN_UNDEF;
-		    if (sym->is_undef_binding_weak())
-		      binding = elfcpp::STB_WEAK;
-		    else
-		      binding = elfcpp::STB_GLOBAL;
-		  }
-		else if (symobj->pluginobj() != NULL)
-		  shndx = elfcpp::SHN_UNDEF;
-		else if (in_shndx == elfcpp::SHN_UNDEF
-			 || (!is_ordinary
-			     && (in_shndx == elfcpp::SHN_ABS
-				 || Symbol::is_common_shndx(in_shndx))))
-		  shndx = in_shndx;
-		else
+		Relobj* relobj = static_cast<Relobj*>(symobj);
+		Output_section* os = relobj->output_section(in_shndx);
+                if (this->is_section_folded(relobj, in_shndx))
+                  {
+                    // This global symbol must be written out even though
+                    // it is folded.
+                    // Get the os of the section it is folded onto.
+                    Section_id folded =
+                         this->icf_->get_folded_section(relobj, in_shndx);
+                    gold_assert(folded.first !=NULL);
+                    Relobj* folded_obj = 
+                      reinterpret_cast<Relobj*>(folded.first);
+                    os = folded_obj->output_section(folded.second);  
+                    gold_assert(os != NULL);
+                  }
+		gold_assert(os != NULL);
+		shndx = os->out_shndx();
+
+		if (shndx >= elfcpp::SHN_LORESERVE)
 		  {
-		    Relobj* relobj = static_cast<Relobj*>(symobj);
-		    Output_section* os = relobj->output_section(in_shndx);
-                    if (this->is_section_folded(relobj, in_shndx))
-                      {
-                        // This global symbol must be written out even though
-                        // it is folded.
-                        // Get the os of the section it is folded onto.
-                        Section_id folded =
-                             this->icf_->get_folded_section(relobj, in_shndx);
-                        gold_assert(folded.first !=NULL);
-                        Relobj* folded_obj = 
-                          reinterpret_cast<Relobj*>(folded.first);
-                        os = folded_obj->output_section(folded.second);  
-                        gold_assert(os != NULL);
-                      }
-		    gold_assert(os != NULL);
-		    shndx = os->out_shndx();
-
-		    if (shndx >= elfcpp::SHN_LORESERVE)
-		      {
-			if (sym_index != -1U)
-			  symtab_xindex->add(sym_index, shndx);
-			if (dynsym_index != -1U)
-			  dynsym_xindex->add(dynsym_index, shndx);
-			shndx = elfcpp::SHN_XINDEX;
-		      }
-
-		    // In object files symbol values are section
-		    // relative.
-		    if (parameters->options().relocatable())
-		      sym_value -= os->address();
+		    if (sym_index != -1U)
+		      symtab_xindex->push_back(std::make_pair(sym_index, shndx));
+		    if (dynsym_index != -1U)
+		      dynsym_xindex->push_back(std::make_pair(dynsym_index,
+							      shndx));
+		    shndx = elfcpp::SHN_XINDEX;
 		  }
+
+		// In object files symbol values are section
+		// relative.
+		if (parameters->options().relocatable())
+		  sym_value -= os->address();
 	      }
 	  }
-	  break;
-
-	case Symbol::IN_OUTPUT_DATA:
-	  {
-	    Output_data* od = sym->output_data();
+      }
+      break;
 
-	    shndx = od->out_shndx();
-	    if (shndx >= elfcpp::SHN_LORESERVE)
-	      {
-		if (sym_index != -1U)
-		  symtab_xindex->add(sym_index, shndx);
-		if (dynsym_index != -1U)
-		  dynsym_xindex->add(dynsym_index, shndx);
-		shndx = elfcpp::SHN_XINDEX;
-	      }
+    case Symbol::IN_OUTPUT_DATA:
+      {
+	Output_data* od = sym->output_data();
 
-	    // In object files symbol values are section
-	    // relative.
-	    if (parameters->options().relocatable())
-	      {
-		Output_section* os = od->output_section();
-		gold_assert(os != NULL);
-		sym_value -= os->address();
-	      }
+	shndx = od->out_shndx();
+	if (shndx >= elfcpp::SHN_LORESERVE)
+	  {
+	    if (sym_index != -1U)
+	      symtab_xindex->push_back(std::make_pair(sym_index, shndx));
+	    if (dynsym_index != -1U)
+	      dynsym_xindex->push_back(std::make_pair(dynsym_index,
+						      shndx));
+	    shndx = elfcpp::SHN_XINDEX;
 	  }
-	  break;
 
-	case Symbol::IN_OUTPUT_SEGMENT:
+	// In object files symbol values are section
+	// relative.
+	if (parameters->options().relocatable())
 	  {
-	    Output_segment* oseg = sym->output_segment();
-	    Output_section* osect = oseg->first_section();
-	    if (osect == NULL)
-	      shndx = elfcpp::SHN_ABS;
-	    else
-	      shndx = osect->out_shndx();
+	    Output_section* os = od->output_section();
+	    gold_assert(os != NULL);
+	    sym_value -= os->address();
 	  }
-	  break;
+      }
+      break;
 
-	case Symbol::IS_CONSTANT:
+    case Symbol::IN_OUTPUT_SEGMENT:
+      {
+	Output_segment* oseg = sym->output_segment();
+	Output_section* osect = oseg->first_section();
+	if (osect == NULL)
 	  shndx = elfcpp::SHN_ABS;
-	  break;
+	else
+	  shndx = osect->out_shndx();
+      }
+      break;
 
-	case Symbol::IS_UNDEFINED:
-	  shndx = elfcpp::SHN_UNDEF;
-	  break;
+    case Symbol::IS_CONSTANT:
+      shndx = elfcpp::SHN_ABS;
+      break;
 
-	default:
-	  gold_unreachable();
-	}
+    case Symbol::IS_UNDEFINED:
+      shndx = elfcpp::SHN_UNDEF;
+      break;
 
-      if (sym_index != -1U)
-	{
-	  sym_index -= first_global_index;
-	  gold_assert(sym_index < output_count);
-	  unsigned char* ps = psyms + (sym_index * sym_size);
-	  this->sized_write_symbol<size, big_endian>(sym, sym_value, shndx,
-						     binding, sympool, ps);
-	}
+    default:
+      gold_unreachable();
+    }
 
-      if (dynsym_index != -1U)
-	{
-	  dynsym_index -= first_dynamic_global_index;
-	  gold_assert(dynsym_index < dynamic_count);
-	  unsigned char* pd = dynamic_view + (dynsym_index * sym_size);
-	  this->sized_write_symbol<size, big_endian>(sym, dynsym_value, shndx,
-						     binding, dynpool, pd);
-          // Allow a target to adjust dynamic symbol value.
-          parameters->target().adjust_dyn_symbol(sym, pd);
-	}
+  if (sym_index != -1U)
+    {
+      sym_index -= first_global_index;
+      gold_assert(sym_index < output_count);
+      unsigned char* ps = psyms + (sym_index * sym_size);
+      this->sized_write_symbol<size, big_endian>(sym, sym_value, shndx,
+						 binding, sympool, ps);
+    }
+
+  if (dynsym_index != -1U)
+    {
+      dynsym_index -= first_dynamic_global_index;
+      gold_assert(dynsym_index < dynamic_count);
+      unsigned char* pd = dynamic_view + (dynsym_index * sym_size);
+      this->sized_write_symbol<size, big_endian>(sym, dynsym_value, shndx,
+						 binding, dynpool, pd);
+      // Allow a target to adjust dynamic symbol value.
+      parameters->target().adjust_dyn_symbol(sym, pd);
+    }
+}
+
+// Write out the target-specific symbols, record the extended section
+// indexes, and release the output views.
+
+template<int size, bool big_endian>
+void
+Symbol_table::sized_write_globals_finish(Write_globals_data* data) const
+{
+  const int sym_size = elfcpp::Elf_sizes<size>::sym_size;
+
+  const unsigned int output_count = this->output_count_;
+  const section_size_type oview_size = output_count * sym_size;
+  const unsigned int first_global_index = this->first_global_index_;
+  unsigned char* psyms = data->psyms;
+
+  const unsigned int dynamic_count = this->dynamic_count_;
+  const section_size_type dynamic_size = dynamic_count * sym_size;
+  const unsigned int first_dynamic_global_index =
+    this->first_dynamic_global_index_;
+  unsigned char* dynamic_view = data->dynamic_view;
+
+  const Stringpool* sympool = data->sympool;
+  const Stringpool* dynpool = data->dynpool;
+
+  for (size_t i = 0; i < data->symtab_xindex_lists.size(); ++i)
+    {
+      const Xindex_list& symtab_list(data->symtab_xindex_lists[i]);
+      for (Xindex_list::const_iterator p = symtab_list.begin();
+	   p != symtab_list.end();
+	   ++p)
+	data->symtab_xindex->add(p->first, p->second);
+      const Xindex_list& dynsym_list(data->dynsym_xindex_lists[i]);
+      for (Xindex_list::const_iterator p = dynsym_list.begin();
+	   p != dynsym_list.end();
+	   ++p)
+	data->dynsym_xindex->add(p->first, p->second);
     }
 
   // Write the target-specific symbols.
@@ -3316,7 +3569,7 @@ Symbol_table::sized_write_globals(const Stringpool* sympool,
 						     pd);
 	}
     }
-
+  Output_file* of = data->of;
   of->write_output_view(this->offset_, oview_size, psyms);
   if (dynamic_view != NULL)
     of->write_output_view(this->dynamic_offset_, dynamic_size, dynamic_view);
@@ -3736,6 +3989,7 @@ Symbol_table::add_from_relobj<32, false>(
     size_t symndx_offset,
     const char* sym_names,
     size_t sym_name_size,
+    const Symbol_name_info* name_info,
     Sized_relobj_file<32, false>::Symbols* sympointers,
     size_t* defined);
 #endif
@@ -3750,6 +4004,7 @@ Symbol_table::add_from_relobj<32, true>(
     size_t symndx_offset,
     const char* sym_names,
     size_t sym_name_size,
+    const Symbol_name_info* name_info,
     Sized_relobj_file<32, true>::Symbols* sympointers,
     size_t* defined);
 #endif
@@ -3764,6 +4019,7 @@ Symbol_table::add_from_relobj<64, false>(
     size_t symndx_offset,
     const char* sym_names,
     size_t sym_name_size,
+    const Symbol_name_info* name_info,
     Sized_relobj_file<64, false>::Symbols* sympointers,
     size_t* defined);
 #endif
@@ -3778,6 +4034,7 @@ Symbol_table::add_from_relobj<64, true>(
     size_t symndx_offset,
     const char* sym_names,
     size_t sym_name_size,
+    const Symbol_name_info* name_info,
     Sized_relobj_file<64, true>::Symbols* sympointers,
     size_t* defined);
 #endif
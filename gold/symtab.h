@@ -60,6 +60,12 @@ class Output_file;
 class Output_symtab_xindex;
 class Garbage_collection;
 class Icf;
+class Workqueue;
+class Task_token;
+template<int size, bool big_endian>
+class Write_globals_task;
+template<int size, bool big_endian>
+class Write_globals_final_task;
 
 // The base class of an entry in the symbol table.  The symbol table
 // can have a lot of entries, so we don't want this class too big.
@@ -1465,15 +1471,17 @@ class Symbol_table
   // Add COUNT external symbols from the relocatable object RELOBJ to
   // the symbol table.  SYMS is the symbols, SYMNDX_OFFSET is the
   // offset in the symbol table of the first symbol, SYM_NAMES is
-  // their names, SYM_NAME_SIZE is the size of SYM_NAMES.  This sets
-  // SYMPOINTERS to point to the symbols in the symbol table.  It sets
-  // *DEFINED to the number of defined symbols.
+  // their names, SYM_NAME_SIZE is the size of SYM_NAMES.  NAME_INFO,
+  // if not NULL, holds the precomputed length and hash code of each
+  // name.  This sets SYMPOINTERS to point to the symbols in the
+  // symbol table.  It sets *DEFINED to the number of defined symbols.
   template<int size, bool big_endian>
   void
   add_from_relobj(Sized_relobj_file<size, big_endian>* relobj,
 		  const unsigned char* syms, size_t count,
 		  size_t symndx_offset, const char* sym_names,
 		  size_t sym_name_size,
+		  const Symbol_name_info* name_info,
 		  typename Sized_relobj_file<size, big_endian>::Symbols*,
 		  size_t* defined);
 
@@ -1682,11 +1690,13 @@ class Symbol_table
   output_count() const
   { return this->output_count_; }
 
-  // Write out the global symbols.
+  // Write out the global symbols.  When using threads, this may
+  // queue tasks to do the work; FINAL_BLOCKER is then held until
+  // they have all completed.
   void
   write_globals(const Stringpool*, const Stringpool*,
 		Output_symtab_xindex*, Output_symtab_xindex*,
-		Output_file*) const;
+		Output_file*, Workqueue*, Task_token* final_blocker) const;
 
   // Write out a section symbol.  Return the updated offset.
   void
@@ -1729,6 +1739,18 @@ class Symbol_table
   Symbol_table(const Symbol_table&);
   Symbol_table& operator=(const Symbol_table&);
 
+  template<int size, bool big_endian>
+  friend class Write_globals_task;
+  template<int size, bool big_endian>
+  friend class Write_globals_final_task;
+
+  // A list of extended section indexes, as pairs of symbol index and
+  // section index.
+  typedef std::vector<std::pair<unsigned int, unsigned int> > Xindex_list;
+
+  // Data shared by the tasks which write out the global symbols.
+  struct Write_globals_data;
+
   // The type of the list of common symbols.
   typedef std::vector<Symbol*> Commons_type;
 
@@ -1941,7 +1963,27 @@ class Symbol_table
   void
   sized_write_globals(const Stringpool*, const Stringpool*,
 		      Output_symtab_xindex*, Output_symtab_xindex*,
-		      Output_file*) const;
+		      Output_file*, Workqueue*, Task_token*) const;
+
+  // Write out a single global symbol to PSYMS and DYNAMIC_VIEW,
+  // recording extended section indexes in the lists.
+  template<int size, bool big_endian>
+  void
+  sized_write_global(Sized_symbol<size>*, const Stringpool*,
+		     const Stringpool*, unsigned char* psyms,
+		     unsigned char* dynamic_view, Xindex_list*,
+		     Xindex_list*) const;
+
+  // Write out one chunk of the global symbols.
+  template<int size, bool big_endian>
+  void
+  sized_write_globals_chunk(Write_globals_data*, unsigned int chunk) const;
+
+  // Write out the target-specific symbols, and the output views,
+  // once the global symbols have been written.
+  template<int size, bool big_endian>
+  void
+  sized_write_globals_finish(Write_globals_data*) const;
 
   // Write out a symbol to P.
   template<int size, bool big_endian>
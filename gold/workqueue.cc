@@ -22,6 +22,10 @@
 
 #include "gold.h"
 
+#ifdef ENABLE_THREADS
+#include <sys/time.h>
+#endif
+
 #include "debug.h"
 #include "options.h"
 #include "timer.h"
@@ -114,6 +118,52 @@ class Workqueue_threader_single : public Workqueue_threader
   { return false; }
 };
 
+// Return the current time in microseconds, for thread statistics.
+
+static inline long long
+workqueue_time_usec()
+{
+#ifdef ENABLE_THREADS
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return static_cast<long long>(tv.tv_sec) * 1000000 + tv.tv_usec;
+#else
+  return 0;
+#endif
+}
+
+// Class Workqueue::Hold_thread_lock.  This holds the workqueue lock
+// like Hold_lock, and when collecting statistics records how long the
+// thread waited for it.
+
+class Workqueue::Hold_thread_lock
+{
+ public:
+  Hold_thread_lock(Workqueue* workqueue, int thread_number)
+    : workqueue_(workqueue)
+  {
+    if (!workqueue->collect_stats_)
+      workqueue->lock_.acquire();
+    else
+      {
+	long long start = workqueue_time_usec();
+	workqueue->lock_.acquire();
+	Thread_stats* stats = workqueue->thread_stats(thread_number);
+	stats->lock_wait_usec += workqueue_time_usec() - start;
+      }
+  }
+
+  ~Hold_thread_lock()
+  { this->workqueue_->lock_.release(); }
+
+ private:
+  // This class can not be copied.
+  Hold_thread_lock(const Hold_thread_lock&);
+  Hold_thread_lock& operator=(const Hold_thread_lock&);
+
+  Workqueue* workqueue_;
+};
+
 // Workqueue methods.
 
 Workqueue::Workqueue(const General_options& options)
@@ -123,6 +173,8 @@ Workqueue::Workqueue(const General_options& options)
     running_(0),
     waiting_(0),
     condvar_(this->lock_),
+    collect_stats_(false),
+    thread_stats_(),
     threader_(NULL)
 {
   bool threads = options.threads();
@@ -135,6 +187,7 @@ Workqueue::Workqueue(const General_options& options)
     {
 #ifdef ENABLE_THREADS
       this->threader_ = new Workqueue_threader_threadpool(this);
+      this->collect_stats_ = options.stats();
 #else
       gold_unreachable();
 #endif
@@ -207,6 +260,18 @@ Workqueue::should_cancel_thread(int thread_number)
   return this->threader_->should_cancel_thread(thread_number);
 }
 
+// Return the statistics for thread THREAD_NUMBER.  The workqueue lock
+// must be held when this is called.
+
+Workqueue::Thread_stats*
+Workqueue::thread_stats(int thread_number)
+{
+  gold_assert(thread_number >= 0);
+  if (static_cast<size_t>(thread_number) >= this->thread_stats_.size())
+    this->thread_stats_.resize(thread_number + 1);
+  return &this->thread_stats_[thread_number];
+}
+
 // Find a runnable task in TASKS.  Return NULL if none could be found.
 // If we find a Task waiting for a Token, add it to the list for that
 // Token.  The workqueue lock must be held when this is called.
@@ -269,7 +334,15 @@ Workqueue::find_runnable_or_wait(int thread_number)
 
       gold_debug(DEBUG_TASK, "%3d sleeping", thread_number);
 
-      this->condvar_.wait();
+      if (!this->collect_stats_)
+	this->condvar_.wait();
+      else
+	{
+	  long long start = workqueue_time_usec();
+	  this->condvar_.wait();
+	  Thread_stats* stats = this->thread_stats(thread_number);
+	  stats->idle_usec += workqueue_time_usec() - start;
+	}
 
       gold_debug(DEBUG_TASK, "%3d awake", thread_number);
 
@@ -292,7 +365,7 @@ Workqueue::find_and_run_task(int thread_number)
   Task_locker tl;
 
   {
-    Hold_lock hl(this->lock_);
+    Hold_thread_lock hl(this, thread_number);
 
     // Find a runnable task.
     t = this->find_runnable_or_wait(thread_number);
@@ -333,9 +406,11 @@ Workqueue::find_and_run_task(int thread_number)
 
       Task* next;
       {
-	Hold_lock hl(this->lock_);
+	Hold_thread_lock hl(this, thread_number);
 
 	--this->running_;
+	if (this->collect_stats_)
+	  ++this->thread_stats(thread_number)->tasks;
 
 	// Release the locks for the task.  This must be done with the
 	// workqueue lock held.  Get the next Task to run if any.
@@ -518,4 +593,22 @@ Workqueue::add_blocker(Task_token* token)
   token->add_blocker();
 }
 
+// Print statistics about the worker threads.  This is only called
+// after all tasks have completed.
+
+void
+Workqueue::print_stats() const
+{
+  for (size_t i = 0; i < this->thread_stats_.size(); ++i)
+    {
+      const Thread_stats& stats(this->thread_stats_[i]);
+      fprintf(stderr,
+	      _("%s: workqueue thread %d: %lu tasks, idle %lld.%06lld, "
+		"lock wait %lld.%06lld\n"),
+	      program_name, static_cast<int>(i), stats.tasks,
+	      stats.idle_usec / 1000000, stats.idle_usec % 1000000,
+	      stats.lock_wait_usec / 1000000, stats.lock_wait_usec % 1000000);
+    }
+}
+
 } // End namespace gold.
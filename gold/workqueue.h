@@ -28,6 +28,7 @@
 #define GOLD_WORKQUEUE_H
 
 #include <string>
+#include <vector>
 
 #include "gold-threads.h"
 #include "token.h"
@@ -233,7 +234,30 @@ class Workqueue
   void
   add_blocker(Task_token*);
 
+  // Print statistics about the worker threads to stderr.
+  void
+  print_stats() const;
+
  private:
+  // Per-thread statistics, collected when using threads with --stats.
+  struct Thread_stats
+  {
+    Thread_stats()
+      : tasks(0), idle_usec(0), lock_wait_usec(0)
+    { }
+
+    // Number of tasks run.
+    unsigned long tasks;
+    // Time spent waiting for a runnable task, in microseconds.
+    long long idle_usec;
+    // Time spent waiting to acquire the workqueue lock, in
+    // microseconds.
+    long long lock_wait_usec;
+  };
+
+  // RAII class which holds the workqueue lock on behalf of a thread.
+  class Hold_thread_lock;
+
   // This class can not be copied.
   Workqueue(const Workqueue&);
   Workqueue& operator=(const Workqueue&);
@@ -270,6 +294,11 @@ class Workqueue
   bool
   should_cancel_thread(int thread_number);
 
+  // Return the statistics for a thread.  The workqueue lock must be
+  // held.
+  Thread_stats*
+  thread_stats(int thread_number);
+
   // Master Workqueue lock.  This controls access to the following
   // member variables.
   Lock lock_;
@@ -284,6 +313,10 @@ class Workqueue
   // Condition variable associated with lock_.  This is signalled when
   // there may be a new Task to execute.
   Condvar condvar_;
+  // Whether to collect thread statistics.
+  bool collect_stats_;
+  // Statistics for each thread, indexed by thread number.
+  std::vector<Thread_stats> thread_stats_;
 
   // The threading implementation.  This is set at construction time
   // and not changed thereafter.
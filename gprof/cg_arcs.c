@@ -28,6 +28,7 @@
  */
 #include "gprof.h"
 #include "libiberty.h"
+#include "hashtab.h"
 #include "search_list.h"
 #include "source.h"
 #include "symtab.h"
@@ -51,6 +52,66 @@ unsigned int num_cycles;
 Arc **arcs;
 unsigned int numarcs;
 
+/*
+ * Arcs between two symtab symbols are also kept in a hash table
+ * keyed by the (parent, child) pair.  As long as the symtab address
+ * ranges don't overlap and no symtab parent has an arc to a symbol
+ * outside the symtab (like the indirect child of some targets), an
+ * arc covers CHILD only if it points to CHILD itself, so the table
+ * answers arc_lookup without walking the children list.  That list
+ * can get very long for functions calling many others.
+ */
+static htab_t arc_table;
+static int symtab_disjoint = -1;	/* -1 until computed */
+static bool arc_table_usable = true;
+
+static hashval_t
+arc_hash (const void *p)
+{
+  const Arc *arc = (const Arc *) p;
+
+  return htab_hash_pointer (arc->parent) * 31 + htab_hash_pointer (arc->child);
+}
+
+static int
+arc_eq (const void *p1, const void *p2)
+{
+  const Arc *a1 = (const Arc *) p1;
+  const Arc *a2 = (const Arc *) p2;
+
+  return a1->parent == a2->parent && a1->child == a2->child;
+}
+
+static bool
+in_symtab (const Sym *sym)
+{
+  return sym >= symtab.base && sym < symtab.limit;
+}
+
+/*
+ * Return TRUE iff the arc table can be used to look up arcs
+ * from PARENT to CHILD.
+ */
+static bool
+arc_table_covers (Sym *parent, Sym *child)
+{
+  if (!arc_table_usable || !in_symtab (parent) || !in_symtab (child))
+    return false;
+  if (symtab_disjoint < 0)
+    {
+      Sym *sym;
+
+      symtab_disjoint = 1;
+      for (sym = symtab.base; sym + 1 < symtab.limit; ++sym)
+	if (sym->end_addr >= sym[1].addr)
+	  {
+	    symtab_disjoint = 0;
+	    break;
+	  }
+    }
+  return symtab_disjoint != 0;
+}
+
 /*
  * Return TRUE iff PARENT has an arc to covers the address
  * range covered by CHILD.
@@ -67,6 +128,14 @@ arc_lookup (Sym *parent, Sym *child)
     }
   DBG (LOOKUPDEBUG, printf ("[arc_lookup] parent %s child %s\n",
 			    parent->name, child->name));
+  if (arc_table_covers (parent, child))
+    {
+      Arc key;
+
+      key.parent = parent;
+      key.child = child;
+      return arc_table ? (Arc *) htab_find (arc_table, &key) : 0;
+    }
   for (arc = parent->cg.children; arc; arc = arc->next_child)
     {
       DBG (LOOKUPDEBUG, printf ("[arc_lookup]\t parent %s child %s\n",
@@ -140,6 +209,18 @@ arc_add (Sym *parent, Sym *child, unsigned long count)
       arcs[numarcs++] = arc;
     }
 
+  if (arc_table_covers (parent, child))
+    {
+      if (!arc_table)
+	arc_table = htab_create (1024, arc_hash, arc_eq, NULL);
+      *htab_find_slot (arc_table, arc, INSERT) = arc;
+    }
+  else if (in_symtab (parent))
+    {
+      /* An arc from a symtab symbol that the table can't describe.  */
+      arc_table_usable = false;
+    }
+
   /* prepend this child to the children of this parent: */
   arc->next_child = parent->cg.children;
   parent->cg.children = arc;
@@ -622,6 +703,7 @@ cg_assemble (void)
       parent->cg.cyc.num = 0;
       parent->cg.cyc.head = parent;
       parent->cg.cyc.next = 0;
+      parent->cg.cyc.tail = 0;
       if (ignore_direct_calls)
 	find_call (parent, parent->addr, (parent + 1)->addr);
     }
@@ -147,9 +147,13 @@ find_cycle (Sym *child)
        * Glom intervening functions that aren't already glommed into
        * this cycle.  Things have been glommed when their cyclehead
        * field points to the head of the cycle they are glommed
-       * into.
+       * into.  The head remembers the tail of its cycle, so that
+       * large cycles aren't walked again for every new member.
        */
-      for (tail = head; tail->cg.cyc.next; tail = tail->cg.cyc.next)
+      tail = head->cg.cyc.head->cg.cyc.tail;
+      if (!tail || tail->cg.cyc.next)
+	tail = head;
+      for (; tail->cg.cyc.next; tail = tail->cg.cyc.next)
 	{
 	  /* void: chase down to tail of things already glommed */
 	  DBG (DFNDEBUG,
@@ -201,6 +205,7 @@ find_cycle (Sym *child)
 	      done (1);
 	    }
 	}
+      head->cg.cyc.tail = tail;
     }
 }
 
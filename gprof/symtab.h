@@ -91,6 +91,7 @@ typedef struct sym
 	    int num;		/* Internal number of cycle on.  */
 	    struct sym *head;	/* Head of cycle.  */
 	    struct sym *next;	/* Next member of cycle.  */
+	    struct sym *tail;	/* Last member, if known (heads only).  */
 	  }
 	cyc;
 	struct arc *parents;	/* List of caller arcs.  */
@@ -84,6 +84,12 @@ typedef struct DataHandle
   uint32_t nblk;            /* number of blocks in data file */
   int exempt;               /* if exempt from experiment size limit */
 
+  /* IO_BLK, IO_SEQ write statistics, reported when the handle is deleted */
+  uint64_t *blkpckts;       /* packets written, nflow*NCHUNKS array */
+  hrtime_t *blkremap;       /* time spent remapping, nflow*NCHUNKS array */
+  uint32_t nspill;          /* packets written to a foreign flow */
+  uint32_t ndrop;           /* packets dropped, all blocks busy */
+
   /* IO_TXT */
   Buffer *buffers;          /* array of text buffers */
   uint64_t curpos;          /* current buffer and file offset */
@@ -106,6 +112,8 @@ static uint8_t *getBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk);
 static int remapBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk);
 static int newBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk);
 static void deleteBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk);
+static uint32_t acquireBlock (DataHandle *hndl, unsigned iflow, unsigned *ichunk);
+static void reportStats (DataHandle *hndl);
 
 /* IO_TXT */
 static int is_not_the_log_file (char *fname);
@@ -321,6 +329,19 @@ __collector_create_handle (char *descp)
       hndl->blkoff = (uint32_t*) __collector_allocCSize (__collector_heap, hndl->nflow * NCHUNKS * sizeof (uint32_t), 1);
       if (hndl->blkoff == NULL)
 	return NULL;
+      hndl->blkpckts = (uint64_t*) __collector_allocCSize (__collector_heap, hndl->nflow * NCHUNKS * sizeof (uint64_t), 1);
+      if (hndl->blkpckts == NULL)
+	return NULL;
+      hndl->blkremap = (hrtime_t*) __collector_allocCSize (__collector_heap, hndl->nflow * NCHUNKS * sizeof (hrtime_t), 1);
+      if (hndl->blkremap == NULL)
+	return NULL;
+      for (int j = 0; j < hndl->nflow * NCHUNKS; ++j)
+	{
+	  hndl->blkpckts[j] = 0;
+	  hndl->blkremap[j] = 0;
+	}
+      hndl->nspill = 0;
+      hndl->ndrop = 0;
       hndl->nchnk = 0;
       for (int j = 0; j < NCHUNKS; ++j)
 	{
@@ -437,9 +458,45 @@ __collector_delete_handle (DataHandle *hndl)
 {
   if (hndl == NULL)
     return;
+  if (hndl->active && (hndl->iotype == IO_BLK || hndl->iotype == IO_SEQ))
+    reportStats (hndl);
   deleteHandle (hndl);
 }
 
+/*
+ * Report the write statistics of an IO_BLK or IO_SEQ handle in the log.
+ * The per-block counters are only updated by the owner of the block,
+ * so they are summed here without synchronization; the totals may miss
+ * a few packets written concurrently with the close.
+ */
+static void
+reportStats (DataHandle *hndl)
+{
+  uint64_t npckts = 0;
+  hrtime_t remap = 0;
+  for (int j = 0; j < hndl->nflow * NCHUNKS; ++j)
+    {
+      npckts += hndl->blkpckts[j];
+      remap += hndl->blkremap[j];
+    }
+  if (npckts == 0 && hndl->ndrop == 0)
+    return;
+  char *fname = hndl->fname;
+  char *s = __collector_strrchr (fname, '/');
+  if (s != NULL)
+    fname = s + 1;
+  char msg[MAXPATHLEN + 100];
+  CALL_UTIL (snprintf) (msg, sizeof (msg), "%s: %llu packets, %u blocks, %u spilled, %3.6f ms. remapping",
+			fname, (unsigned long long) npckts, (unsigned) hndl->nblk,
+			(unsigned) hndl->nspill, (double) remap / 1000000.);
+  __collector_log_write ("<event kind=\"%s\" id=\"%d\">%s</event>\n",
+			 SP_JCMD_COMMENT, COL_COMMENT_NONE, msg);
+  if (hndl->ndrop != 0)
+    __collector_log_write ("<event kind=\"%s\" id=\"%d\">%s: %u packets dropped, all blocks busy</event>\n",
+			   SP_JCMD_COMMENT, COL_COMMENT_NONE, fname,
+			   (unsigned) hndl->ndrop);
+}
+
 static int
 exp_size_ck (int nblocks, char *fname)
 {
@@ -596,6 +653,7 @@ remapBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk)
   /* Open the file. */
   int iter = 0;
   hrtime_t tso = __collector_gethrtime ();
+  hndl->blkremap[iflow * NCHUNKS + ichunk] -= tso;
   for (;;)
     {
       fd = CALL_UTIL (open)(hndl->fname, O_RDWR, 0);
@@ -691,6 +749,8 @@ remapBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk)
     Tprintf (DBG_LT1, "exp_size_ck() bypassed for %d block(s); exempt fname = %s\n",
 	       1, hndl->fname);
 exit:
+  hndl->blkremap[iflow * NCHUNKS + ichunk] += __collector_gethrtime ();
+
   /* Restore the previous cancellation state */
   pthread_setcancelstate (old_cstate, NULL);
 
@@ -721,6 +781,38 @@ deleteBlock (DataHandle *hndl, unsigned iflow, unsigned ichunk)
   __collector_dec_32 (hndl->chblk + ichunk);
 }
 
+/*
+ * Acquire a block of flow IFLOW.  Return the previous state of the block
+ * (ST_INIT or ST_FREE) and its chunk in *ICHUNK, or ST_BUSY if all
+ * blocks of the flow are in use.
+ */
+static uint32_t
+acquireBlock (DataHandle *hndl, unsigned iflow, unsigned *ichunk)
+{
+  uint32_t *sptr = &hndl->blkstate[iflow * NCHUNKS];
+  for (unsigned i = 0; i < NCHUNKS; ++i)
+    {
+      uint32_t oldstate = sptr[i];
+      if (oldstate == ST_BUSY)
+	continue;
+      /* Mark as busy */
+      uint32_t state = __collector_cas_32 (sptr + i, oldstate, ST_BUSY);
+      if (state == ST_BUSY)
+	continue;
+      if (state != oldstate)
+	{
+	  /* It's possible the state changed from ST_INIT to ST_FREE */
+	  oldstate = state;
+	  state = __collector_cas_32 (sptr + i, oldstate, ST_BUSY);
+	  if (state != oldstate)
+	    continue;
+	}
+      *ichunk = i;
+      return oldstate;
+    }
+  return ST_BUSY;
+}
+
 int
 __collector_write_record (DataHandle *hndl, Common_packet *pckt)
 {
@@ -788,36 +880,29 @@ __collector_write_packet (DataHandle *hndl, CM_Packet *pckt)
   unsigned iflow = tid % hndl->nflow;
 
   /* Acquire block */
-  uint32_t *sptr = &hndl->blkstate[iflow * NCHUNKS];
-  uint32_t state = ST_BUSY;
-  unsigned ichunk;
-  for (ichunk = 0; ichunk < NCHUNKS; ++ichunk)
-    {
-      uint32_t oldstate = sptr[ichunk];
-      if (oldstate == ST_BUSY)
-	continue;
-      /* Mark as busy */
-      state = __collector_cas_32 (sptr + ichunk, oldstate, ST_BUSY);
-      if (state == oldstate)
-	break;
-      if (state == ST_BUSY)
-	continue;
-      /* It's possible the state changed from ST_INIT to ST_FREE */
-      oldstate = state;
-      state = __collector_cas_32 (sptr + ichunk, oldstate, ST_BUSY);
-      if (state == oldstate)
-	break;
-    }
-
-  if (state == ST_BUSY || ichunk == NCHUNKS)
+  unsigned ichunk = 0;
+  uint32_t state = acquireBlock (hndl, iflow, &ichunk);
+  if (state == ST_BUSY)
     {
       /* We are out of blocks for this data flow.
-       * We might switch to another flow but for now report and return.
+       * Spill over to the other flows before dropping the packet.
        */
-      TprintfT (0, "collector_write_packet: all %d blocks on flow %d for %s are busy\n",
-		NCHUNKS, iflow, hndl->fname);
-      return 1;
+      unsigned home = iflow;
+      for (unsigned i = 1; i < hndl->nflow && state == ST_BUSY; ++i)
+	{
+	  iflow = (home + i) % hndl->nflow;
+	  state = acquireBlock (hndl, iflow, &ichunk);
+	}
+      if (state == ST_BUSY)
+	{
+	  TprintfT (0, "collector_write_packet: all %d blocks on all %d flows for %s are busy\n",
+		    NCHUNKS, hndl->nflow, hndl->fname);
+	  __collector_inc_32 (&hndl->ndrop);
+	  return 1;
+	}
+      __collector_inc_32 (&hndl->nspill);
     }
+  uint32_t *sptr = &hndl->blkstate[iflow * NCHUNKS];
 
   if (state == ST_INIT && newBlock (hndl, iflow, ichunk) != 0)
       return 1;
@@ -852,6 +937,7 @@ __collector_write_packet (DataHandle *hndl, CM_Packet *pckt)
       return 0;
     }
   hndl->blkoff[iflow * NCHUNKS + ichunk] += recsz;
+  hndl->blkpckts[iflow * NCHUNKS + ichunk]++;
   sptr[ichunk] = ST_FREE;
   return 0;
 }
@@ -285,6 +285,20 @@ static int omp_no_walk = 0;
 #define OmpValTableSize 65536
 static unsigned long *AddrTable_RA_FROMFP = NULL; // Cache for RA_FROMFP pcs
 static unsigned long *AddrTable_RA_EOSTCK = NULL; // Cache for RA_EOSTCK pcs
+#if WSIZE(64)
+/*
+ * Cache for pcs whose RA is at a fixed offset from sp.
+ * An entry is (pc << RA_SPOFF_BITS | fpdist << RA_SPOFF_RABITS | raoff):
+ * the RA is at sp[raoff], and the caller's fp is either the current fp
+ * (fpdist == 0) or was saved at sp[raoff - fpdist].
+ */
+#define RA_SPOFF_RABITS 11
+#define RA_SPOFF_FPBITS 6
+#define RA_SPOFF_BITS   (RA_SPOFF_RABITS + RA_SPOFF_FPBITS)
+#define RA_SPOFF_RAOFF(x)   ((x) & ((1UL << RA_SPOFF_RABITS) - 1))
+#define RA_SPOFF_FPDIST(x)  (((x) >> RA_SPOFF_RABITS) & ((1UL << RA_SPOFF_FPBITS) - 1))
+static unsigned long *AddrTable_RA_SPOFF = NULL;
+#endif
 static struct WalkContext *OmpCurCtxs = NULL;
 static struct WalkContext *OmpCtxs = NULL;
 static uint32_t *OmpVals = NULL;
@@ -436,6 +450,10 @@ __collector_ext_unwind_init (int record)
   AddrTable_RA_FROMFP = (unsigned long*) __collector_allocCSize (__collector_heap, sz, 1);
   sz = ValTableSize * sizeof (*AddrTable_RA_EOSTCK);
   AddrTable_RA_EOSTCK = (unsigned long*) __collector_allocCSize (__collector_heap, sz, 1);
+#if WSIZE(64)
+  sz = ValTableSize * sizeof (*AddrTable_RA_SPOFF);
+  AddrTable_RA_SPOFF = (unsigned long*) __collector_allocCSize (__collector_heap, sz, 1);
+#endif
   if (omp_no_walk && (__collector_omp_stack_trace != NULL || __collector_mpi_stack_trace != NULL))
     {
       sz = OmpValTableSize * sizeof (*OmpCurCtxs);
@@ -1483,6 +1501,8 @@ struct AdvWalkContext
   unsigned long *fp;
   unsigned long *fp_sav;
   unsigned long *fp_loc;
+  unsigned long *fp_src;     /* slot fp was reloaded from, NULL if fp is unchanged */
+  unsigned long *fp_src_sav; /* fp_src when fp was saved at fp_loc */
   unsigned long rax;
   unsigned long rdx;
   unsigned long ra_sav;
@@ -1490,8 +1510,11 @@ struct AdvWalkContext
   unsigned long regs[16];
   int tidx;         /* targets table index */
   uint32_t cval;    /* cache value */
+  int sp_var;       /* sp is not at a fixed offset from the initial sp */
 };
 
+#define FP_SRC_UNKNOWN  ((unsigned long *) -1)
+
 static unsigned long
 getRegVal (struct AdvWalkContext *cur, int r, int *undefRez)
 {
@@ -1571,7 +1594,7 @@ static const uint32_t RA_EOSTCK = (uint32_t) - 2; /* end-of-stack */
 #define DELETE_CURCTX()  __collector_memcpy (cur, buf + (--nctx), sizeof (*cur))
 
 /**
- * Look for pc in AddrTable_RA_FROMFP and in AddrTable_RA_EOSTCK
+ * Look for pc in AddrTable_RA_FROMFP, AddrTable_RA_EOSTCK and AddrTable_RA_SPOFF
  * @param wctx
  * @return
  */
@@ -1610,14 +1633,55 @@ cache_get (struct WalkContext *wctx)
 	  return RA_SUCCESS;
 	}
     }
-  if (NULL == AddrTable_RA_EOSTCK)
-    return RA_FAILURE;
-  uint64_t idx = wctx->pc % ValTableSize;
-  addr = AddrTable_RA_EOSTCK[ idx ];
-  if (addr != wctx->pc)
-    return RA_FAILURE;
-  DprintfT (SP_DUMP_UNWIND, "unwind.c:%d cached RA_END_OF_STACK\n", __LINE__);
-  return RA_END_OF_STACK;
+  if (AddrTable_RA_EOSTCK != NULL)
+    {
+      uint64_t idx = wctx->pc % ValTableSize;
+      addr = AddrTable_RA_EOSTCK[ idx ];
+      if (addr == wctx->pc)
+	{
+	  DprintfT (SP_DUMP_UNWIND, "unwind.c:%d cached RA_END_OF_STACK\n", __LINE__);
+	  return RA_END_OF_STACK;
+	}
+    }
+#if WSIZE(64)
+  if (AddrTable_RA_SPOFF != NULL)
+    {
+      /*
+       * The entry is a single word, so a racing update can't give us
+       * the offset of another pc.  The RA is validated as in the
+       * RA_FROMFP case; on failure we fall back to the walk.
+       */
+      uint64_t idx = wctx->pc % ValTableSize;
+      addr = AddrTable_RA_SPOFF[ idx ];
+      if ((addr >> RA_SPOFF_BITS) == wctx->pc)
+	{
+	  unsigned long *sp = (unsigned long *) wctx->sp + RA_SPOFF_RAOFF (addr);
+	  unsigned long fp = wctx->fp;
+	  if ((unsigned long) sp >= wctx->sbase - sizeof (*sp))
+	    return RA_FAILURE;
+	  if (RA_SPOFF_FPDIST (addr) != 0)
+	    fp = *(sp - RA_SPOFF_FPDIST (addr));
+	  unsigned long ra = *sp++;
+	  unsigned long tbgn = wctx->tbgn;
+	  unsigned long tend = wctx->tend;
+	  if (ra < tbgn || ra >= tend)
+	    if (!__collector_check_segment (ra, &tbgn, &tend, 0))
+	      return RA_FAILURE;
+	  unsigned long npc = adjust_ret_addr (ra, ra - tbgn, tend);
+	  if (npc == 0)
+	    return RA_FAILURE;
+	  DprintfT (SP_DUMP_UNWIND, "unwind.c:%d cached sp offset %ld pc=0x%lX\n",
+		    __LINE__, (long) RA_SPOFF_RAOFF (addr), npc);
+	  wctx->pc = npc;
+	  wctx->sp = (unsigned long) sp;
+	  wctx->fp = fp;
+	  wctx->tbgn = tbgn;
+	  wctx->tend = tend;
+	  return RA_SUCCESS;
+	}
+    }
+#endif
+  return RA_FAILURE;
 }
 /**
  * Save pc in RA_FROMFP or RA_EOSTCK cache depending on val
@@ -1732,7 +1796,30 @@ process_return_real (struct WalkContext *wctx, struct AdvWalkContext *cur, int c
 	}
     }
   else
-    wctx->pc = npc;
+    {
+#if WSIZE(64)
+      /*
+       * If the walk only moved sp by constants and took the RA and fp
+       * from stack slots (or left fp alone), remember the slots so the
+       * next sample at this pc can skip the walk.
+       */
+      if (cache_on && cur->cval != RA_FROMFP && !cur->sp_var
+	  && cur->ra_loc == NULL && cur->fp_src != FP_SRC_UNKNOWN
+	  && AddrTable_RA_SPOFF != NULL)
+	{
+	  unsigned long *ra_slot = cur->sp - 1;
+	  unsigned long raoff = ra_slot - (unsigned long *) wctx->sp;
+	  unsigned long fpdist = cur->fp_src ? ra_slot - cur->fp_src : 0;
+	  if ((long) raoff >= 0 && raoff == RA_SPOFF_RAOFF (raoff)
+	      && (long) fpdist >= 0 && fpdist == RA_SPOFF_FPDIST (fpdist << RA_SPOFF_RABITS)
+	      && (cur->fp_src == NULL || (fpdist != 0 && fpdist <= raoff))
+	      && (wctx->pc >> (8 * sizeof (long) - RA_SPOFF_BITS)) == 0)
+	    AddrTable_RA_SPOFF[ wctx->pc % ValTableSize ] = (wctx->pc << RA_SPOFF_BITS)
+		    | (fpdist << RA_SPOFF_RABITS) | raoff;
+	}
+#endif
+      wctx->pc = npc;
+    }
   wctx->sp = (unsigned long) cur->sp;
   wctx->fp = (unsigned long) cur->fp;
   wctx->tbgn = tbgn;
@@ -2773,6 +2860,7 @@ startWalk:
 		{
 		  cur->fp_loc = cur->sp;
 		  cur->fp_sav = cur->fp;
+		  cur->fp_src_sav = cur->fp_src;
 		}
 	    }
 	  break;
@@ -2801,11 +2889,15 @@ startWalk:
 	      if (cur->fp_loc == cur->sp)
 		{
 		  cur->fp = cur->fp_sav;
+		  cur->fp_src = cur->fp_src_sav;
 		  cur->fp_loc = NULL;
 		}
 	      else if (cur->sp >= cur->sp_safe &&
 		       (unsigned long) cur->sp < wctx->sbase)
-		cur->fp = (unsigned long*) (*cur->sp);
+		{
+		  cur->fp = (unsigned long*) (*cur->sp);
+		  cur->fp_src = cur->sp;
+		}
 	    }
 	  else if (reg == RSP)
 	    {
@@ -2816,6 +2908,7 @@ startWalk:
 		  if (nsp >= cur->sp && nsp <= cur->fp)
 		    {
 		      cur->sp = nsp;
+		      cur->sp_var = 1;
 		    }
 		  else
 		    {
@@ -2955,7 +3048,10 @@ startWalk:
 	      if (extop == 0) /* add  imm32,%esp */
 		cur->sp = (unsigned long*) ((long) cur->sp + immz);
 	      else if (extop == 4) /* and imm32,%esp */
-		cur->sp = (unsigned long*) ((long) cur->sp & immz);
+		{
+		  cur->sp = (unsigned long*) ((long) cur->sp & immz);
+		  cur->sp_var = 1;
+		}
 	      else if (extop == 5) /* sub imm32,%esp */
 		cur->sp = (unsigned long*) ((long) cur->sp - immz);
 	      if (cur->sp - RED_ZONE > cur->sp_safe)
@@ -2977,7 +3073,10 @@ startWalk:
 	      if (extop == 0) /* add  imm8,%esp */
 		cur->sp = (unsigned long*) ((long) cur->sp + imm8);
 	      else if (extop == 4) /* and imm8,%esp */
+		{
 		  cur->sp = (unsigned long*) ((long) cur->sp & imm8);
+		  cur->sp_var = 1;
+		}
 	      else if (extop == 5) /* sub imm8,%esp */
 		cur->sp = (unsigned long*) ((long) cur->sp - imm8);
 	      if (cur->sp - RED_ZONE > cur->sp_safe)
@@ -3001,10 +3100,14 @@ startWalk:
 	    {
 	      if (MRM_REGS (modrm) == RBP && MRM_REGD (modrm) == RSP)
 		/* movl %esp,%ebp */
-		cur->fp = cur->sp;
+		{
+		  cur->fp = cur->sp;
+		  cur->fp_src = FP_SRC_UNKNOWN;
+		}
 	      else if (MRM_REGS (modrm) == RSP && MRM_REGD (modrm) == RBP)
 		{ /* mov %ebp,%esp */
 		  cur->sp = cur->fp;
+		  cur->sp_var = 1;
 		  if (cur->sp - RED_ZONE > cur->sp_safe)
 		    cur->sp_safe = cur->sp - RED_ZONE;
 		  if (wctx->fp == (unsigned long) cur->sp)
@@ -3020,6 +3123,7 @@ startWalk:
 		      immv = read_int (cur->pc + 2, 4);
 		      cur->fp_loc = (unsigned long*) ((char*) cur->sp + immv);
 		      cur->fp_sav = cur->fp;
+		      cur->fp_src_sav = cur->fp_src;
 		    }
 		}
 	    }
@@ -3040,6 +3144,7 @@ startWalk:
 		      imm8 = ((char*) (cur->pc))[2];
 		      cur->fp_loc = (unsigned long*) ((char*) cur->sp + imm8);
 		      cur->fp_sav = cur->fp;
+		      cur->fp_src_sav = cur->fp_src;
 		    }
 		}
 	    }
@@ -3051,6 +3156,7 @@ startWalk:
 		    { /* mov %ebp,(%esp) */
 		      cur->fp_loc = cur->sp;
 		      cur->fp_sav = cur->fp;
+		      cur->fp_src_sav = cur->fp_src;
 		    }
 		}
 	      else if (MRM_REGS (modrm) == RSP && MRM_REGD (modrm) == RDX)
@@ -3073,10 +3179,14 @@ startWalk:
 	    {
 	      if (MRM_REGS (modrm) == RSP && MRM_REGD (modrm) == RBP)
 		/* mov %esp,%ebp */
-		cur->fp = cur->sp;
+		{
+		  cur->fp = cur->sp;
+		  cur->fp_src = FP_SRC_UNKNOWN;
+		}
 	      else if (MRM_REGS (modrm) == RBP && MRM_REGD (modrm) == RSP)
 		{ /* mov %ebp,%esp */
 		  cur->sp = cur->fp;
+		  cur->sp_var = 1;
 		  if (cur->sp - RED_ZONE > cur->sp_safe)
 		    cur->sp_safe = cur->sp - RED_ZONE;
 		  if (wctx->fp == (unsigned long) cur->sp)
@@ -3094,10 +3204,14 @@ startWalk:
 		      if (cur->fp_loc == ptr)
 			{
 			  cur->fp = cur->fp_sav;
+			  cur->fp_src = cur->fp_src_sav;
 			  cur->fp_loc = NULL;
 			}
 		      else if (ptr >= cur->sp_safe && (unsigned long) ptr < wctx->sbase)
-			cur->fp = (unsigned long*) (*ptr);
+			{
+			  cur->fp = (unsigned long*) (*ptr);
+			  cur->fp_src = ptr;
+			}
 		    }
 		}
 	    }
@@ -3112,10 +3226,14 @@ startWalk:
 		      if (cur->fp_loc == ptr)
 			{
 			  cur->fp = cur->fp_sav;
+			  cur->fp_src = cur->fp_src_sav;
 			  cur->fp_loc = NULL;
 			}
 		      else if (ptr >= cur->sp_safe && (unsigned long) ptr < wctx->sbase)
-			cur->fp = (unsigned long*) (*ptr);
+			{
+			  cur->fp = (unsigned long*) (*ptr);
+			  cur->fp_src = ptr;
+			}
 		    }
 		}
 	    }
@@ -3128,11 +3246,15 @@ startWalk:
 		      if (cur->fp_loc == cur->sp)
 			{
 			  cur->fp = cur->fp_sav;
+			  cur->fp_src = cur->fp_src_sav;
 			  cur->fp_loc = NULL;
 			}
 		      else if (cur->sp >= cur->sp_safe &&
 			       (unsigned long) cur->sp < wctx->sbase)
-			cur->fp = (unsigned long*) *cur->sp;
+			{
+			  cur->fp = (unsigned long*) *cur->sp;
+			  cur->fp_src = cur->sp;
+			}
 		    }
 		}
 	    }
@@ -3243,6 +3365,7 @@ startWalk:
 		      goto checkFP;
 		    }
 		  cur->sp = (unsigned long *) val;
+		  cur->sp_var = 1;
 		  if (cur->sp - RED_ZONE > cur->sp_safe)
 		    cur->sp_safe = cur->sp - RED_ZONE;
 		}
@@ -3439,16 +3562,19 @@ startWalk:
 	case 0xc9: /* leave */
 	  /* mov %ebp,%esp */
 	  cur->sp = cur->fp;
+	  cur->sp_var = 1;
 	  /* pop %ebp */
 	  if (cur->fp_loc == cur->sp)
 	    {
 	      cur->fp = cur->fp_sav;
+	      cur->fp_src = cur->fp_src_sav;
 	      cur->fp_loc = NULL;
 	    }
 	  else if (cur->sp >= cur->sp_safe &&
 		   (unsigned long) cur->sp < wctx->sbase)
 	    {
 	      cur->fp = (unsigned long*) (*cur->sp);
+	      cur->fp_src = cur->sp;
 	      if (wctx->fp == (unsigned long) cur->sp)
 		cur->cval = RA_FROMFP;
 	    }
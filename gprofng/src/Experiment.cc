@@ -28,6 +28,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/param.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
 #include <set>
 
 #include "util.h"
@@ -88,6 +91,45 @@ struct Experiment::RawFramePacket
   uint32_t omp_state;
 };
 
+// The part of a data file decoded by one worker of
+// read_data_file_in_parallel(), or a data file read back from its cache.
+// Data records are decoded into 'vals': a header word (packet type in the
+// low 32 bits, mstate property in the high 32 bits) followed by one value
+// per packet field.  Frame and uid packets update shared tables, so they
+// are only copied to 'raw' (header word RAW_PCKT, then the offset and size
+// of the copy) and processed during the merge.  String values point to
+// StringBuilders, or for a cache are 1 + their offset in 'strs'.
+struct Experiment::PacketChunk
+{
+  static const uint32_t RAW_PCKT = 0xffffffff;
+
+  void
+  append (uint64_t val)
+  {
+    if (nvals == vals_limit)
+      {
+	vals_limit = vals_limit ? 2 * vals_limit : 4096;
+	vals = (uint64_t *) realloc (vals, vals_limit * sizeof (uint64_t));
+      }
+    vals[nvals++] = val;
+  }
+
+  Experiment *exp;
+  char *fname;
+  int64_t offset;       // first packet of the chunk
+  int64_t end;          // the chunk ends at the first packet past 'end'
+  int64_t next;         // where the worker stopped, or -1 on error
+  int invalid_packet;
+  uint64_t *vals;
+  long nvals;
+  long vals_limit;
+  char *raw;
+  int64_t raw_size;
+  int64_t raw_limit;
+  char *strs;
+  int64_t str_size;
+};
+
 static hrtime_t
 parseTStamp (const char *s)
 {
@@ -4460,6 +4502,21 @@ check_mstate (char *ptr, PacketDescriptor *pDscr, int arg)
 uint64_t
 Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
 {
+  char *rcp;
+  uint64_t size = bindPacket (dwin, span, &rcp, &invalid_packet);
+  if (rcp != NULL)
+    processPacket (dwin, rcp, size);
+  return size;
+}
+
+// Map the packet at the start of SPAN.  Return the number of bytes to
+// skip to the next packet (0 at the end of the data) and set *PCKT to
+// the packet, or to NULL if there is nothing to process.
+uint64_t
+Experiment::bindPacket (Data_window *dwin, Data_window::Span *span,
+			char **pckt, int *ninvalid)
+{
+  *pckt = NULL;
   Common_packet *rcp = (Common_packet *) dwin->bind (span,
 						    sizeof (CommonHead_packet));
   uint16_t v16;
@@ -4468,7 +4525,7 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
     {
       if ((((long) rcp) % PACKET_ALIGNMENT) != 0)
 	{
-	  invalid_packet++;
+	  (*ninvalid)++;
 	  size = PROFILE_BUFFER_CHUNK - span->offset % PROFILE_BUFFER_CHUNK;
 	  return size;
 	}
@@ -4486,14 +4543,22 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
 
   if ((((long) rcp) % PACKET_ALIGNMENT) != 0)
     {
-      invalid_packet++;
+      (*ninvalid)++;
       size = PROFILE_BUFFER_CHUNK - span->offset % PROFILE_BUFFER_CHUNK;
       return size;
     }
-  v16 = (uint16_t) rcp->type;
+  *pckt = (char *) rcp;
+  return size;
+}
+
+void
+Experiment::processPacket (Data_window *dwin, char *pckt, uint64_t size)
+{
+  Common_packet *rcp = (Common_packet *) pckt;
+  uint16_t v16 = (uint16_t) rcp->type;
   uint32_t rcptype = dwin->decode (v16);
   if (rcptype == EMPTY_PCKT)
-    return size;
+    return;
   if (rcptype == FRAME_PCKT)
     {
       RawFramePacket *fp = new RawFramePacket;
@@ -4507,7 +4572,7 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
 	{
 	  invalid_packet++;
 	  delete fp;
-	  return size;
+	  return;
 	}
       v16 = (uint16_t) ((Frame_packet*) rcp)->tsize;
       char *end = (char*) rcp + dwin->decode (v16);
@@ -4630,7 +4695,7 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
 	  ptr += hsize;
 	}
       frmpckts->append (fp);
-      return size;
+      return;
     }
   else if (rcptype == UID_PCKT)
     {
@@ -4640,7 +4705,7 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
       v16 = (uint16_t) rcp->tsize;
       size_t arr_length = dwin->decode (v16) - sizeof (Uid_packet);
       if (arr_length <= 0)
-	return size;
+	return;
       uint64_t link_uid = (uint64_t) 0;
       if (dwin->decode (uidp->flags) & COMPRESSED_INFO)
 	{
@@ -4659,15 +4724,15 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
       else
 	add_uid (dwin, uid, (int) (arr_length / sizeof (uint64_t)),
 		 (uint64_t*) arr_bytes, link_uid);
-      return size;
+      return;
     }
 
   PacketDescriptor *pcktDescr = getPacketDescriptor (rcptype);
   if (pcktDescr == NULL)
-    return size;
+    return;
   DataDescriptor *dataDescr = pcktDescr->getDataDescriptor ();
   if (dataDescr == NULL)
-    return size;
+    return;
 
   /* omazur: TBR START -- old experiment */
   if (rcptype == PROF_PCKT)
@@ -4683,7 +4748,6 @@ Experiment::readPacket (Data_window *dwin, Data_window::Span *span)
     }
   else
     readPacket (dwin, (char*) rcp, pcktDescr, dataDescr, 0, size);
-  return size;
 }
 
 void
@@ -4772,6 +4836,542 @@ Experiment::readPacket (Data_window *dwin, char *ptr, PacketDescriptor *pDscr,
     }
 }
 
+/*
+ *    Data file cache
+ *
+ * The records decoded from a data file by read_data_file_in_parallel are
+ * saved in <experiment>/cache/<data file>, so that later loads of the
+ * experiment only have to merge them into the DataDescriptors.  The cache
+ * file is a DataCacheHeader followed by the 'vals', 'raw' and 'strs'
+ * arrays of a PacketChunk that covers the whole data file, and is mapped
+ * when it is read.  It is only used if the data file still has the size
+ * and modification time recorded in the header.  Setting the environment
+ * variable GPROFNG_DATA_CACHE to 0 disables the cache.
+ */
+#define DATA_CACHE_MAGIC    0x67706463  // "gpdc" in host byte order
+#define DATA_CACHE_VERSION  1
+
+struct DataCacheHeader
+{
+  uint32_t magic;
+  uint32_t version;
+  int64_t data_size;    // size of the data file
+  int64_t data_mtime;   // modification time of the data file
+  int64_t nvals;
+  int64_t raw_size;
+  int64_t str_size;
+  int64_t invalid_packet;
+};
+
+class DataCache
+{
+public:
+  DataCache (const char *dir, const char *fname);
+  ~DataCache ();
+
+  bool
+  opened ()
+  {
+    return fd != -1;
+  }
+
+  void
+  append (uint64_t val)
+  {
+    if (nbuf == BUFSZ)
+      flush ();
+    buf[nbuf++] = val;
+  }
+
+  uint64_t add_raw (char *pckt, uint64_t size);
+  uint64_t add_string (StringBuilder *sb);
+  void commit (struct stat64 *st, int invalid_packet);
+
+  static bool enabled ();
+
+private:
+  static const int BUFSZ = 8192;
+
+  void flush ();
+  void grow (char **p, int64_t *limit, int64_t size);
+
+  int fd;
+  bool failed;
+  char *path;
+  char *tmp_path;
+  uint64_t buf[BUFSZ];
+  int nbuf;
+  int64_t nvals;
+  char *raw;
+  int64_t raw_size;
+  int64_t raw_limit;
+  char *strs;
+  int64_t str_size;
+  int64_t str_limit;
+};
+
+/*
+ *    Parallel reading of data files
+ *
+ * A large data file is cut into PACKET_CHUNK_SIZE pieces which are
+ * decoded by a thread pool, each into the buffers of its PacketChunk,
+ * and then merged into the DataDescriptors in file order.  The collector
+ * never lets a packet cross one of its blocks, so a chunk normally starts
+ * with a packet.  A worker reads past the end of its chunk up to the next
+ * packet boundary; if that is not where the next chunk starts, the merge
+ * stops there and read_data_file reads the rest of the file sequentially.
+ */
+#define PACKET_CHUNK_SIZE   (1 << 20)
+#define PACKET_CHUNK_MIN    4   // don't bother for smaller files
+#define PACKET_CHUNK_WAVE   64  // chunks decoded before they are merged
+
+void
+Experiment::decodeRecord (Data_window *dwin, PacketChunk *chunk, char *ptr,
+			  PacketDescriptor *pDscr, uint32_t rcptype, int arg,
+			  uint64_t pktsz)
+{
+  chunk->append (((uint64_t) arg << 32) | rcptype);
+  Vector<FieldDescr*> *fields = pDscr->getFields ();
+  for (int i = 0, sz = fields->size (); i < sz; i++)
+    {
+      FieldDescr *field = fields->fetch (i);
+      char *v = ptr + field->offset;
+      if (field->propID == arg)
+	chunk->append (dwin->decode (*(uint32_t *) v));
+      uint64_t val = 0;
+      switch (field->vtype)
+	{
+	case TYPE_INT32:
+	case TYPE_UINT32:
+	  val = dwin->decode (*(uint32_t *) v);
+	  break;
+	case TYPE_INT64:
+	case TYPE_UINT64:
+	  val = dwin->decode (*(uint64_t *) v);
+	  break;
+	case TYPE_STRING:
+	  {
+	    if (field->propID == PROP_THRID || field->propID == PROP_LWPID
+		|| field->propID == PROP_CPUID)
+	      break;
+	    int len = (int) (pktsz - field->offset);
+	    if ((len > 0) && (*v != 0))
+	      {
+		StringBuilder *sb = new StringBuilder ();
+		sb->append (v, 0, len);
+		val = (uint64_t) sb;
+	      }
+	    break;
+	  }
+	default:
+	  break;
+	}
+      chunk->append (val);
+    }
+}
+
+// Runs on a worker thread: only reads the experiment.
+void
+Experiment::decodePacket (Data_window *dwin, PacketChunk *chunk, char *pckt,
+			  uint64_t size)
+{
+  Common_packet *rcp = (Common_packet *) pckt;
+  uint16_t v16 = (uint16_t) rcp->type;
+  uint32_t rcptype = dwin->decode (v16);
+  if (rcptype == EMPTY_PCKT)
+    return;
+  if (rcptype == FRAME_PCKT || rcptype == UID_PCKT)
+    {
+      // Keep the copies aligned as the packets were in the file
+      int64_t raw_size = chunk->raw_size + ((size + 7) & ~((uint64_t) 7));
+      if (raw_size > chunk->raw_limit)
+	{
+	  chunk->raw_limit = 2 * chunk->raw_limit;
+	  if (chunk->raw_limit < raw_size)
+	    chunk->raw_limit = raw_size;
+	  chunk->raw = (char *) realloc (chunk->raw, chunk->raw_limit);
+	}
+      memcpy (chunk->raw + chunk->raw_size, pckt, size);
+      chunk->append (PacketChunk::RAW_PCKT);
+      chunk->append (chunk->raw_size);
+      chunk->append (size);
+      chunk->raw_size = raw_size;
+      return;
+    }
+
+  PacketDescriptor *pcktDescr = getPacketDescriptor (rcptype);
+  if (pcktDescr == NULL || pcktDescr->getDataDescriptor () == NULL)
+    return;
+  if (rcptype == PROF_PCKT)
+    {
+      // See processPacket
+      int numstates = get_params ()->lms_magic_id;
+      if (numstates > LMS_NUM_SOLARIS_MSTATES)
+	numstates = LMS_NUM_SOLARIS_MSTATES;
+      for (int i = 0; i < numstates; i++)
+	if (check_mstate (pckt, pcktDescr, PROP_UCPU + i))
+	  decodeRecord (dwin, chunk, pckt, pcktDescr, rcptype, PROP_UCPU + i,
+			size);
+    }
+  else
+    decodeRecord (dwin, chunk, pckt, pcktDescr, rcptype, 0, size);
+}
+
+int
+Experiment::read_packet_chunk (void *arg)
+{
+  PacketChunk *chunk = (PacketChunk *) arg;
+  Experiment *exp = chunk->exp;
+  // Each worker needs its own window into the file
+  Data_window *dwin = new Data_window (chunk->fname);
+  if (dwin->not_opened ())
+    {
+      chunk->next = -1;
+      delete dwin;
+      return 0;
+    }
+  dwin->need_swap_endian = exp->need_swap_endian;
+
+  Data_window::Span span;
+  span.offset = chunk->offset;
+  span.length = dwin->get_fsize () - span.offset;
+  while (span.offset < chunk->end)
+    {
+      char *rcp;
+      uint64_t pcktsz = exp->bindPacket (dwin, &span, &rcp,
+					 &chunk->invalid_packet);
+      if (pcktsz == 0)
+	break;
+      if (rcp != NULL)
+	exp->decodePacket (dwin, chunk, rcp, pcktsz);
+      span.length -= pcktsz;
+      span.offset += pcktsz;
+    }
+  chunk->next = span.offset;
+  delete dwin;
+  return 0;
+}
+
+// Add the records decoded into CHUNK to the DataDescriptors, or just
+// free them if DISCARD.  Also copy them to CACHE if it is not NULL.
+// Stop at anything inconsistent, which can only come from a stale cache.
+void
+Experiment::mergePacketChunk (Data_window *dwin, PacketChunk *chunk,
+			      bool discard, DataCache *cache)
+{
+  uint64_t *vals = chunk->vals;
+  for (long i = 0, sz = chunk->nvals; i < sz;)
+    {
+      uint64_t hdr = vals[i++];
+      uint32_t rcptype = (uint32_t) hdr;
+      if (rcptype == PacketChunk::RAW_PCKT)
+	{
+	  if (i + 2 > sz || vals[i] + vals[i + 1] > (uint64_t) chunk->raw_size)
+	    break;
+	  char *pckt = chunk->raw + vals[i];
+	  uint64_t size = vals[i + 1];
+	  i += 2;
+	  if (discard)
+	    continue;
+	  processPacket (dwin, pckt, size);
+	  if (cache)
+	    {
+	      cache->append (PacketChunk::RAW_PCKT);
+	      cache->append (cache->add_raw (pckt, size));
+	      cache->append (size);
+	    }
+	  continue;
+	}
+      int arg = (int) (hdr >> 32);
+      PacketDescriptor *pDscr = getPacketDescriptor (rcptype);
+      if (pDscr == NULL || pDscr->getDataDescriptor () == NULL)
+	break;
+      DataDescriptor *dDscr = pDscr->getDataDescriptor ();
+      Vector<FieldDescr*> *fields = pDscr->getFields ();
+      int fsz = fields->size ();
+      if (i + fsz + (arg != 0) > sz)
+	break;
+      long recn = discard ? 0 : dDscr->addRecord ();
+      if (cache)
+	cache->append (hdr);
+      for (int j = 0; j < fsz; j++)
+	{
+	  FieldDescr *field = fields->fetch (j);
+	  if (field->propID == arg)
+	    {
+	      uint64_t ntick = vals[i++];
+	      if (discard)
+		continue;
+	      dDscr->setValue (PROP_NTICK, recn, ntick);
+	      dDscr->setValue (PROP_MSTATE, recn,
+			       (uint32_t) (field->propID - PROP_UCPU));
+	      if (cache)
+		cache->append (ntick);
+	    }
+	  uint64_t val = vals[i++];
+	  if (field->propID == PROP_THRID || field->propID == PROP_LWPID
+	      || field->propID == PROP_CPUID)
+	    {
+	      // Keep the raw value in the cache; tags depend on load order
+	      if (!discard)
+		dDscr->setValue (field->propID, recn,
+				 mapTagValue ((Prop_type) field->propID, val));
+	    }
+	  else if (field->vtype == TYPE_STRING && val != 0)
+	    {
+	      StringBuilder *sb = (StringBuilder *) val;
+	      if (chunk->strs)
+		{
+		  // A cached string: see DataCache::add_string
+		  uint64_t off = val - 1;
+		  uint32_t len = 0;
+		  if (off + sizeof (len) <= (uint64_t) chunk->str_size)
+		    memcpy (&len, chunk->strs + off, sizeof (len));
+		  if (off + sizeof (len) + len > (uint64_t) chunk->str_size)
+		    {
+		      i = sz;
+		      break;
+		    }
+		  sb = new StringBuilder ();
+		  sb->append (chunk->strs + off + sizeof (len), 0, len);
+		}
+	      if (discard)
+		delete sb;
+	      else if (sb)
+		{
+		  dDscr->setObjValue (field->propID, recn, sb);
+		  if (cache)
+		    val = cache->add_string (sb);
+		}
+	    }
+	  else if (!discard && field->vtype >= TYPE_INT32
+		   && field->vtype <= TYPE_UINT64)
+	    dDscr->setValue (field->propID, recn, val);
+	  if (cache && !discard)
+	    cache->append (val);
+	}
+    }
+}
+
+// Read DWIN in parallel as far as possible, copying the records to CACHE
+// if it is not NULL.  Return the offset at which the caller has to
+// continue reading sequentially.
+int64_t
+Experiment::read_data_file_in_parallel (Data_window *dwin,
+					const char *progress_bar_msg,
+					DataCache *cache)
+{
+  int64_t fsize = dwin->get_fsize ();
+  long nchunks = (long) ((fsize + PACKET_CHUNK_SIZE - 1) / PACKET_CHUNK_SIZE);
+  if (nchunks < PACKET_CHUNK_MIN)
+    return 0;
+
+  int64_t offset = 0;
+  for (long first = 0; first < nchunks; first += PACKET_CHUNK_WAVE)
+    {
+      long cnt = nchunks - first;
+      if (cnt > PACKET_CHUNK_WAVE)
+	cnt = PACKET_CHUNK_WAVE;
+      PacketChunk *chunks = new PacketChunk[cnt];
+      DbeThreadPool *threadPool = new DbeThreadPool (-1);
+      for (long k = 0; k < cnt; k++)
+	{
+	  PacketChunk *chunk = chunks + k;
+	  memset (chunk, 0, sizeof (PacketChunk));
+	  chunk->exp = this;
+	  chunk->fname = dwin->fname;
+	  chunk->offset = (first + k) * (int64_t) PACKET_CHUNK_SIZE;
+	  chunk->end = chunk->offset + PACKET_CHUNK_SIZE;
+	  if (chunk->end > fsize)
+	    chunk->end = fsize;
+	  chunk->next = -1;
+	  threadPool->put_queue (new DbeQueue (read_packet_chunk, chunk));
+	}
+      threadPool->wait_queues ();
+      delete threadPool;
+
+      // Merge in file order while the chunks join up
+      bool joined = true;
+      for (long k = 0; k < cnt; k++)
+	{
+	  PacketChunk *chunk = chunks + k;
+	  if (chunk->offset != offset || chunk->next < 0)
+	    joined = false;
+	  mergePacketChunk (dwin, chunk, !joined, cache);
+	  if (joined)
+	    {
+	      invalid_packet += chunk->invalid_packet;
+	      offset = chunk->next;
+	      theApplication->set_progress ((int) (100 * chunk->end / fsize),
+					    progress_bar_msg);
+	    }
+	  free (chunk->vals);
+	  free (chunk->raw);
+	}
+      delete[] chunks;
+      if (!joined)
+	break;
+    }
+  return offset;
+}
+
+bool
+DataCache::enabled ()
+{
+  char *s = getenv ("GPROFNG_DATA_CACHE");
+  return s == NULL || strcmp (s, "0") != 0;
+}
+
+DataCache::DataCache (const char *dir, const char *fname)
+{
+  nbuf = 0;
+  nvals = 0;
+  raw = strs = NULL;
+  raw_size = raw_limit = str_size = str_limit = 0;
+  failed = false;
+  path = dbe_sprintf (NTXT ("%s/%s"), dir, fname);
+  // Use temporary file to avoid synchronization problems
+  tmp_path = dbe_sprintf (NTXT ("%s/.%s_%llx"), dir, fname,
+			  (unsigned long long) gethrtime ());
+  mkdir (dir, 0755);
+  fd = open (tmp_path, O_WRONLY | O_CREAT | O_EXCL, 0644);
+  if (fd != -1)
+    {
+      // Room for the header, which is written last
+      DataCacheHeader hdr;
+      memset (&hdr, 0, sizeof (hdr));
+      failed = write (fd, &hdr, sizeof (hdr)) != (ssize_t) sizeof (hdr);
+    }
+}
+
+DataCache::~DataCache ()
+{
+  if (fd != -1)
+    {
+      close (fd);
+      unlink (tmp_path);
+    }
+  free (path);
+  free (tmp_path);
+  free (raw);
+  free (strs);
+}
+
+void
+DataCache::flush ()
+{
+  ssize_t sz = nbuf * sizeof (uint64_t);
+  if (!failed && write (fd, buf, sz) != sz)
+    failed = true;
+  nvals += nbuf;
+  nbuf = 0;
+}
+
+void
+DataCache::grow (char **p, int64_t *limit, int64_t size)
+{
+  if (size <= *limit)
+    return;
+  *limit = 2 * *limit;
+  if (*limit < size)
+    *limit = size;
+  *p = (char *) realloc (*p, *limit);
+}
+
+uint64_t
+DataCache::add_raw (char *pckt, uint64_t size)
+{
+  uint64_t off = raw_size;
+  int64_t new_size = raw_size + ((size + 7) & ~((uint64_t) 7));
+  grow (&raw, &raw_limit, new_size);
+  memcpy (raw + off, pckt, size);
+  raw_size = new_size;
+  return off;
+}
+
+// Strings are saved with their length, as they may contain NULs.
+uint64_t
+DataCache::add_string (StringBuilder *sb)
+{
+  uint64_t off = str_size;
+  uint32_t len = sb->length ();
+  str_size += sizeof (len) + len;
+  grow (&strs, &str_limit, str_size);
+  memcpy (strs + off, &len, sizeof (len));
+  sb->getChars (0, len, strs, off + sizeof (len));
+  return off + 1;
+}
+
+void
+DataCache::commit (struct stat64 *st, int invalid_packet)
+{
+  flush ();
+  DataCacheHeader hdr;
+  hdr.magic = DATA_CACHE_MAGIC;
+  hdr.version = DATA_CACHE_VERSION;
+  hdr.data_size = st->st_size;
+  hdr.data_mtime = st->st_mtime;
+  hdr.nvals = nvals;
+  hdr.raw_size = raw_size;
+  hdr.str_size = str_size;
+  hdr.invalid_packet = invalid_packet;
+  if (failed
+      || write (fd, raw, raw_size) != raw_size
+      || write (fd, strs, str_size) != str_size
+      || pwrite (fd, &hdr, sizeof (hdr), 0) != (ssize_t) sizeof (hdr))
+    return;
+  close (fd);
+  fd = -1;
+  if (rename (tmp_path, path) != 0)
+    unlink (tmp_path);
+}
+
+// Merge the records of data file FNAME from its cache.  Return false if
+// there is no valid cache.
+bool
+Experiment::read_data_cache (Data_window *dwin, const char *fname)
+{
+  struct stat64 st;
+  if (dbe_stat_file (dwin->fname, &st) != 0)
+    return false;
+  char *cache_name = dbe_sprintf (NTXT ("%s/%s/%s"), expt_name, SP_CACHE_DIR,
+				  fname);
+  int fd = ::open (cache_name, O_RDONLY);
+  free (cache_name);
+  if (fd == -1)
+    return false;
+  DataCacheHeader hdr;
+  int64_t fsize = lseek (fd, 0, SEEK_END);
+  if (pread (fd, &hdr, sizeof (hdr), 0) != (ssize_t) sizeof (hdr)
+      || hdr.magic != DATA_CACHE_MAGIC || hdr.version != DATA_CACHE_VERSION
+      || hdr.data_size != st.st_size || hdr.data_mtime != st.st_mtime
+      || hdr.nvals < 0 || hdr.raw_size < 0 || hdr.str_size < 0
+      || fsize != (int64_t) (sizeof (hdr) + hdr.nvals * sizeof (uint64_t)
+			     + hdr.raw_size + hdr.str_size))
+    {
+      close (fd);
+      return false;
+    }
+  void *base = mmap (NULL, (size_t) fsize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (base == MAP_FAILED)
+    return false;
+
+  PacketChunk chunk;
+  memset (&chunk, 0, sizeof (chunk));
+  chunk.exp = this;
+  chunk.vals = (uint64_t *) ((char *) base + sizeof (hdr));
+  chunk.nvals = hdr.nvals;
+  chunk.raw = (char *) (chunk.vals + hdr.nvals);
+  chunk.raw_size = hdr.raw_size;
+  chunk.strs = chunk.raw + hdr.raw_size;
+  chunk.str_size = hdr.str_size;
+  mergePacketChunk (dwin, &chunk, false, NULL);
+  invalid_packet = (int) hdr.invalid_packet;
+  munmap (base, (size_t) fsize);
+  return true;
+}
+
 #define PROG_BYTE 102400 // update progress bar every PROG_BYTE bytes
 
 void
@@ -4799,11 +5399,40 @@ Experiment::read_data_file (const char *fname, const char *msg)
   total_len = remain_len = span.length;
   progress_bar_msg = dbe_sprintf (NTXT ("%s %s"), NTXT ("  "), msg);
   invalid_packet = 0;
+  if (DataCache::enabled () && read_data_cache (dwin, fname))
+    span.length = 0;
+
+  // Only files read entirely in parallel are cached
+  DataCache *cache = NULL;
+  struct stat64 st;
+  if (span.length >= PACKET_CHUNK_MIN * PACKET_CHUNK_SIZE
+      && DataCache::enabled () && dbe_stat_file (dwin->fname, &st) == 0)
+    {
+      char *cache_dir = dbe_sprintf (NTXT ("%s/%s"), expt_name, SP_CACHE_DIR);
+      cache = new DataCache (cache_dir, fname);
+      free (cache_dir);
+      if (!cache->opened ())
+	{
+	  delete cache;
+	  cache = NULL;
+	}
+    }
+  if (span.length > 0)
+    {
+      span.offset = read_data_file_in_parallel (dwin, progress_bar_msg, cache);
+      span.length -= span.offset;
+      remain_len = span.length;
+    }
   for (;;)
     {
       uint64_t pcktsz = readPacket (dwin, &span);
       if (pcktsz == 0)
 	break;
+      if (cache)
+	{
+	  delete cache;
+	  cache = NULL;
+	}
       // Update progress bar
       if ((span.length <= remain_len) && (remain_len > 0))
 	{
@@ -4819,6 +5448,11 @@ Experiment::read_data_file (const char *fname, const char *msg)
       span.offset += pcktsz;
     }
   delete dwin;
+  if (cache)
+    {
+      cache->commit (&st, invalid_packet);
+      delete cache;
+    }
 
   if (invalid_packet)
     {
@@ -31,6 +31,7 @@
 #include "HeapMap.h"
 
 class Data_window;
+class DataCache;
 class DbeFile;
 class CallStack;
 class JMethod;
@@ -502,6 +503,24 @@ protected:
   uint64_t readPacket (Data_window *dwin, Data_window::Span *span);
   void readPacket (Data_window *dwin, char *ptr, PacketDescriptor *pDscr,
 		   DataDescriptor *dDscr, int arg, uint64_t pktsz);
+  uint64_t bindPacket (Data_window *dwin, Data_window::Span *span,
+		       char **pckt, int *ninvalid);
+  void processPacket (Data_window *dwin, char *rcp, uint64_t size);
+
+  // Parallel reading of large data files
+  struct PacketChunk;
+  static int read_packet_chunk (void *arg);
+  void decodePacket (Data_window *dwin, PacketChunk *chunk, char *rcp,
+		     uint64_t size);
+  void decodeRecord (Data_window *dwin, PacketChunk *chunk, char *ptr,
+		     PacketDescriptor *pDscr, uint32_t rcptype, int arg,
+		     uint64_t pktsz);
+  void mergePacketChunk (Data_window *dwin, PacketChunk *chunk, bool discard,
+			 DataCache *cache);
+  int64_t read_data_file_in_parallel (Data_window *dwin,
+				      const char *progress_bar_msg,
+				      DataCache *cache);
+  bool read_data_cache (Data_window *dwin, const char *fname);
 
   // read data
   DataDescriptor *get_profile_events ();
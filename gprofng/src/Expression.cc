@@ -1259,6 +1259,58 @@ Expression::verifyObjectInExpr (Histable *obj)
   return false;
 }
 
+// Return true if evaluating this expression only reads event data and
+// experiment parameters, so that copies of it can be evaluated on
+// several threads at once.  Call stacks and data objects are mapped to
+// Histables, which are created on demand.
+bool
+Expression::isThreadSafe ()
+{
+  switch (op)
+    {
+    case OP_NAME:
+      if (arg0 == NULL || arg0->op != OP_NUM)
+	return false;
+      switch ((int) arg0->v.val)
+	{
+	case PROP_SAMPLE_MAP:
+	case PROP_GCEVENT_MAP:
+	case PROP_LEAF:
+	case PROP_STACKID:
+	case PROP_STACK:
+	case PROP_STACKL:
+	case PROP_STACKI:
+	case PROP_MSTACK:
+	case PROP_MSTACKL:
+	case PROP_MSTACKI:
+	case PROP_XSTACK:
+	case PROP_XSTACKL:
+	case PROP_XSTACKI:
+	case PROP_USTACK:
+	case PROP_USTACKL:
+	case PROP_USTACKI:
+	case PROP_DOBJ:
+	case PROP_CPRID:
+	case PROP_TSKID:
+	case PROP_JTHREAD:
+	  return false;
+	default:
+	  return true;
+	}
+    case OP_LIBRARY_IN:
+    case OP_LIBRARY_SOMEIN:
+    case OP_LIBRARY_ORDRIN:
+      return false;
+    default:
+      break;
+    }
+  if (arg0 && !arg0->isThreadSafe ())
+    return false;
+  if (arg1 && !arg1->isThreadSafe ())
+    return false;
+  return true;
+}
+
 bool
 Expression::hasLoadObject ()
 {
@@ -147,6 +147,7 @@ public:
   };
 
   bool verifyObjectInExpr (Histable *obj);
+  bool isThreadSafe ();
   Expression *
   pEval (Context *ctx); // Partial evaluation to simplify expression
 
@@ -27,6 +27,7 @@
 #include "CacheMap.h"
 
 #include "DbeSession.h"
+#include "DbeThread.h"
 #include "Application.h"
 #include "CallStack.h"
 #include "Emsg.h"
@@ -535,6 +536,68 @@ PathTree::find_desc_node (NodeIdx node_idx, Histable *instr, bool leaf)
   return dsc_idx;
 }
 
+#define PTREE_EVAL_BLOCK    (1 << 18)  // packets evaluated at a time
+#define PTREE_EVAL_TASKS    16         // parallel tasks per block
+
+typedef struct
+{
+  DbeView *dbev;
+  Experiment *exp;
+  DataView *packets;
+  Vector<BaseMetric*> *mlist;
+  long begin;       // packets to evaluate
+  long end;
+  long base;        // first packet of the block
+  long blksz;
+  int64_t *vals;    // value of metric m for packet i: vals[m * blksz + i - base]
+  bool copy_exprs;  // evaluate copies of the metric expressions
+} metric_eval_ctx;
+
+static int
+eval_metrics_in_chunks (void *arg)
+{
+  metric_eval_ctx *ectx = (metric_eval_ctx *) arg;
+  Expression::Context ctx (ectx->dbev, ectx->exp);
+  int nmetrics = ectx->mlist->size ();
+  Expression **val_exprs = new Expression*[nmetrics];
+  Expression **cond_exprs = new Expression*[nmetrics];
+  for (int midx = 0; midx < nmetrics; ++midx)
+    {
+      // Expressions keep intermediate values in their nodes
+      BaseMetric *mtr = ectx->mlist->fetch (midx);
+      val_exprs[midx] = mtr->get_val ();
+      cond_exprs[midx] = mtr->get_cond ();
+      if (ectx->copy_exprs)
+	{
+	  val_exprs[midx] = val_exprs[midx]->copy ();
+	  if (cond_exprs[midx])
+	    cond_exprs[midx] = cond_exprs[midx]->copy ();
+	}
+    }
+  for (long i = ectx->begin; i < ectx->end; ++i)
+    {
+      ctx.put (ectx->packets, i);
+      int64_t *vals = ectx->vals + i - ectx->base;
+      for (int midx = 0; midx < nmetrics; ++midx)
+	{
+	  Expression *cond = cond_exprs[midx];
+	  if (cond != NULL && !cond->passes (&ctx))
+	    vals[midx * ectx->blksz] = 0;
+	  else
+	    vals[midx * ectx->blksz] = val_exprs[midx]->eval (&ctx);
+	}
+    }
+  if (ectx->copy_exprs)
+    for (int midx = 0; midx < nmetrics; ++midx)
+      {
+	delete val_exprs[midx];
+	delete cond_exprs[midx];
+      }
+  delete[] val_exprs;
+  delete[] cond_exprs;
+  return 0;
+}
+
 PtreePhaseStatus
 PathTree::process_packets (Experiment *exp, DataView *packets, int data_type)
 {
@@ -594,61 +657,145 @@ PathTree::process_packets (Experiment *exp, DataView *packets, int data_type)
 	}
     }
 
-  Slot **mslots = new Slot*[mlist2.size ()];
-  for (int midx = 0, mlist_sz = mlist2.size (); midx < mlist_sz; ++midx)
+  int nmetrics = mlist2.size ();
+  Slot **mslots = new Slot*[nmetrics];
+  bool par_eval = true;
+  for (int midx = 0; midx < nmetrics; ++midx)
     {
       BaseMetric *mtr = mlist2.fetch (midx);
       int id = mtr->get_id ();
       int slot_ind = find_slot (id);
       mslots[midx] = SLOT_IDX (slot_ind);
-    }
-
-  for (long i = 0, packets_sz = packets->getSize (); i < packets_sz; ++i)
-    {
-      if (dbeSession->is_interactive ())
+      if (!mtr->get_val ()->isThreadSafe ()
+	  || (mtr->get_cond () != NULL && !mtr->get_cond ()->isThreadSafe ()))
+	par_eval = false;
+    }
+
+  // Metric values are evaluated a block of packets at a time, in parallel
+  // if the metric expressions allow it.  They are summed per path here and
+  // added to the ancestors of each path once at the end.
+  long packets_sz = packets->getSize ();
+  long blksz = packets_sz < PTREE_EVAL_BLOCK ? packets_sz : PTREE_EVAL_BLOCK;
+  if (packets_sz <= PTREE_EVAL_BLOCK)
+    par_eval = false;
+  int64_t *vals = new int64_t[nmetrics * blksz + 1];
+  int64_t **sums = new int64_t*[nmetrics];
+  long sums_size = 0;
+  for (int midx = 0; midx < nmetrics; ++midx)
+    sums[midx] = NULL;
+
+  metric_eval_ctx ectx;
+  ectx.dbev = dbev;
+  ectx.exp = exp;
+  ectx.packets = packets;
+  ectx.mlist = &mlist2;
+  ectx.blksz = blksz;
+  ectx.vals = vals;
+  ectx.copy_exprs = par_eval;
+  PtreePhaseStatus ret = NORMAL;
+  for (long base = 0; base < packets_sz && ret == NORMAL; base += blksz)
+    {
+      long end = base + blksz < packets_sz ? base + blksz : packets_sz;
+      ectx.base = base;
+      if (par_eval)
 	{
-	  if (NULL == progress_bar_msg)
-	    progress_bar_msg = dbe_sprintf (GTXT ("Processing Experiment: %s"),
-					  get_basename (exp->get_expt_name ()));
-	  int val = (int) (100 * i / packets_sz);
-	  if (val > progress_bar_percent)
+	  long tasksz = (end - base + PTREE_EVAL_TASKS - 1) / PTREE_EVAL_TASKS;
+	  metric_eval_ctx *tasks = new metric_eval_ctx[PTREE_EVAL_TASKS];
+	  DbeThreadPool *threadPool = new DbeThreadPool (-1);
+	  for (int k = 0; k < PTREE_EVAL_TASKS; k++)
 	    {
-	      progress_bar_percent += 10;
-	      if (theApplication->set_progress (val, progress_bar_msg)
-		  && cancel_ok)
-		{
-		  delete[] mslots;
-		  return CANCELED;
-		}
+	      tasks[k] = ectx;
+	      tasks[k].begin = base + k * tasksz;
+	      tasks[k].end = tasks[k].begin + tasksz < end ?
+		      tasks[k].begin + tasksz : end;
+	      if (tasks[k].begin < tasks[k].end)
+		threadPool->put_queue (new DbeQueue (eval_metrics_in_chunks,
+						     tasks + k));
 	    }
+	  threadPool->wait_queues ();
+	  delete threadPool;
+	  delete[] tasks;
+	}
+      else
+	{
+	  ectx.begin = base;
+	  ectx.end = end;
+	  eval_metrics_in_chunks (&ectx);
 	}
 
-      NodeIdx path_idx = 0;
-      ctx.put (packets, i);
-
-      for (int midx = 0, mlist_sz = mlist2.size (); midx < mlist_sz; ++midx)
+      for (long i = base; i < end; ++i)
 	{
-	  BaseMetric *mtr = mlist2.fetch (midx);
-	  if (mtr->get_cond () != NULL && !mtr->get_cond ()->passes (&ctx))
-	    continue;
+	  if (dbeSession->is_interactive ())
+	    {
+	      if (NULL == progress_bar_msg)
+		progress_bar_msg = dbe_sprintf (GTXT ("Processing Experiment: %s"),
+					    get_basename (exp->get_expt_name ()));
+	      int val = (int) (100 * i / packets_sz);
+	      if (val > progress_bar_percent)
+		{
+		  progress_bar_percent += 10;
+		  if (theApplication->set_progress (val, progress_bar_msg)
+		      && cancel_ok)
+		    {
+		      ret = CANCELED;
+		      break;
+		    }
+		}
+	    }
 
-	  int64_t mval = mtr->get_val ()->eval (&ctx);
-	  if (mval == 0)
-	    continue;
-	  if (path_idx == 0)
-	    path_idx = find_path (exp, packets, i);
-	  NodeIdx node_idx = path_idx;
-	  Slot *mslot = mslots[midx];
-	  while (node_idx)
+	  NodeIdx path_idx = 0;
+	  for (int midx = 0; midx < nmetrics; ++midx)
 	    {
-	      INCREMENT_METRIC (mslot, node_idx, mval);
-	      node_idx = NODE_IDX (node_idx)->ancestor;
+	      int64_t mval = vals[midx * blksz + i - base];
+	      if (mval == 0)
+		continue;
+	      if (path_idx == 0)
+		{
+		  path_idx = find_path (exp, packets, i);
+		  if (nodes > sums_size)
+		    {
+		      long new_size = 2 * nodes;
+		      for (int m = 0; m < nmetrics; m++)
+			{
+			  sums[m] = (int64_t *) realloc (sums[m],
+						new_size * sizeof (int64_t));
+			  memset (sums[m] + sums_size, 0,
+				  (new_size - sums_size) * sizeof (int64_t));
+			}
+		      sums_size = new_size;
+		    }
+		}
+	      sums[midx][path_idx] += mval;
 	    }
 	}
     }
+
+  // Children are always created after their ancestors, so one pass
+  // from the last node back accumulates the inclusive values.
+  if (ret == NORMAL)
+    for (NodeIdx node_idx = (nodes < sums_size ? nodes : sums_size) - 1;
+	 node_idx > 0; node_idx--)
+      {
+	NodeIdx anc = NODE_IDX (node_idx)->ancestor;
+	for (int midx = 0; midx < nmetrics; ++midx)
+	  {
+	    int64_t mval = sums[midx][node_idx];
+	    if (mval == 0)
+	      continue;
+	    INCREMENT_METRIC (mslots[midx], node_idx, mval);
+	    if (anc)
+	      sums[midx][anc] += mval;
+	  }
+      }
+  for (int midx = 0; midx < nmetrics; ++midx)
+    free (sums[midx]);
+  delete[] sums;
+  delete[] vals;
   if (dbeSession->is_interactive ())
     free (progress_bar_msg);
   delete[] mslots;
+  if (ret == CANCELED)
+    return CANCELED;
   if (indx_expr != NULL)
     root->descendants->sort ((CompareFunc) desc_node_comp, this);
   return NORMAL;
@@ -23,6 +23,7 @@
 
 #include "IndexMap2D.h"
 #include "DbeSession.h"
+#include "DbeThread.h"
 #include "FilterExp.h"
 #include "Table.h"
 #include "util.h"
@@ -1354,9 +1355,14 @@ DataView::getProp (int prop_id)
   return ddscr->getProp (prop_id);
 };
 
-void
-DataView::filter_in_chunks (fltr_dbe_ctx *dctx)
+// Filtering and sorting of large views is split into this many tasks
+#define DV_PAR_TASKS    16
+#define DV_PAR_MIN      (1 << 16)   // minimum number of records
+
+int
+DataView::filter_in_chunks (void *arg)
 {
+  fltr_dbe_ctx *dctx = (fltr_dbe_ctx *) arg;
   Expression::Context *e_ctx = new Expression::Context (dctx->fltr->ctx->dbev, dctx->fltr->ctx->exp);
   Expression *n_expr = dctx->fltr->expr->copy ();
   bool noParFilter = dctx->fltr->noParFilter;
@@ -1371,7 +1377,111 @@ DataView::filter_in_chunks (fltr_dbe_ctx *dctx)
 	dctx->idxArr[iter - orig_ddsize] = 1;
       iter += 1;
     }
+  delete n_expr;
   delete nFilter;
+  return 0;
+}
+
+// Evaluate the filter on records [ddsize, newSize) in parallel.  Each task
+// uses its own copy of the expression and marks passing records in idxArr;
+// the index is then appended to in record order.
+void
+DataView::filter_in_parallel (DataView *tmpView, long newSize)
+{
+  long nrecs = newSize - ddsize;
+  long tasksz = (nrecs + DV_PAR_TASKS - 1) / DV_PAR_TASKS;
+  char *idxArr = new char[nrecs];
+  memset (idxArr, 0, nrecs);
+  fltr_dbe_ctx *tasks = new fltr_dbe_ctx[DV_PAR_TASKS];
+  DbeThreadPool *threadPool = new DbeThreadPool (-1);
+  for (int k = 0; k < DV_PAR_TASKS; k++)
+    {
+      fltr_dbe_ctx *dctx = tasks + k;
+      dctx->begin = ddsize + k * tasksz;
+      dctx->end = dctx->begin + tasksz < newSize ? dctx->begin + tasksz : newSize;
+      dctx->orig_ddsize = ddsize;
+      dctx->tmpView = tmpView;
+      dctx->idxArr = idxArr;
+      dctx->fltr = filter;
+      if (dctx->begin < dctx->end)
+	threadPool->put_queue (new DbeQueue (filter_in_chunks, dctx));
+    }
+  threadPool->wait_queues ();
+  delete threadPool;
+  delete[] tasks;
+  for (long i = 0; i < nrecs; i++)
+    if (idxArr[i])
+      index->append (ddsize + i);
+  ddsize = newSize;
+  delete[] idxArr;
+}
+
+typedef struct
+{
+  long *base;
+  long nelem;
+  Data **sortedBy;
+} sort_dbe_ctx;
+
+int
+DataView::sort_in_chunks (void *arg)
+{
+  sort_dbe_ctx *sctx = (sort_dbe_ctx *) arg;
+  qsort (sctx->base, sctx->nelem, (ExtCompareFunc) pcmp, sctx->sortedBy);
+  return 0;
+}
+
+// Sort the index in DV_PAR_TASKS slices in parallel and merge the slices.
+// pcmp() is a total order, so the result is the same as index->sort().
+void
+DataView::sort_in_parallel ()
+{
+  long nelem = index->size ();
+  long *src = new long[nelem];
+  long *dst = new long[nelem];
+  for (long i = 0; i < nelem; i++)
+    src[i] = index->fetch (i);
+
+  long tasksz = (nelem + DV_PAR_TASKS - 1) / DV_PAR_TASKS;
+  sort_dbe_ctx *tasks = new sort_dbe_ctx[DV_PAR_TASKS];
+  DbeThreadPool *threadPool = new DbeThreadPool (-1);
+  for (int k = 0; k < DV_PAR_TASKS; k++)
+    {
+      long begin = k * tasksz;
+      long end = begin + tasksz < nelem ? begin + tasksz : nelem;
+      tasks[k].base = src + begin;
+      tasks[k].nelem = end - begin;
+      tasks[k].sortedBy = sortedBy;
+      if (begin < end)
+	threadPool->put_queue (new DbeQueue (sort_in_chunks, tasks + k));
+    }
+  threadPool->wait_queues ();
+  delete threadPool;
+  delete[] tasks;
+
+  // Merge sorted runs pairwise until one is left
+  for (long run = tasksz; run < nelem; run *= 2)
+    {
+      for (long lo = 0; lo < nelem; lo += 2 * run)
+	{
+	  long mid = lo + run < nelem ? lo + run : nelem;
+	  long hi = mid + run < nelem ? mid + run : nelem;
+	  long i = lo, j = mid, k = lo;
+	  while (i < mid && j < hi)
+	    dst[k++] = pcmp (src + j, src + i, sortedBy) < 0 ? src[j++] : src[i++];
+	  while (i < mid)
+	    dst[k++] = src[i++];
+	  while (j < hi)
+	    dst[k++] = src[j++];
+	}
+      long *tmp = src;
+      src = dst;
+      dst = tmp;
+    }
+  for (long i = 0; i < nelem; i++)
+    index->store (i, src[i]);
+  delete[] src;
+  delete[] dst;
 }
 
 bool
@@ -1389,6 +1499,9 @@ DataView::checkUpdate ()
     {
       DataView *tmpView = ddscr->createImmutableView ();
       assert (tmpView->getSize () == newSize);
+      if (newSize - ddsize >= DV_PAR_MIN && !filter->noParFilter
+	  && filter->expr != NULL && filter->expr->isThreadSafe ())
+	filter_in_parallel (tmpView, newSize);
       while (ddsize < newSize)
 	{
 	  filter->put (tmpView, ddsize);
@@ -1488,7 +1601,10 @@ DataView::sort (const int props[], int prop_count)
     }
   if (!checkUpdate () && !sort_changed)
     return;
-  index->sort ((CompareFunc) pcmp, sortedBy);
+  if (index->size () >= DV_PAR_MIN)
+    sort_in_parallel ();
+  else
+    index->sort ((CompareFunc) pcmp, sortedBy);
 }
 
 void
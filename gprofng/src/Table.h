@@ -522,7 +522,7 @@ typedef struct
   long end;
   long orig_ddsize;
   DataView *tmpView;
-  long *idxArr;
+  char *idxArr;
   FilterExp *fltr;
 } fltr_dbe_ctx;
 
@@ -604,7 +604,10 @@ private:
   bool checkUpdate ();
   void init (DataDescriptor*, DataViewType);
 
-  static void filter_in_chunks (fltr_dbe_ctx *dctx);
+  static int filter_in_chunks (void *arg);
+  static int sort_in_chunks (void *arg);
+  void filter_in_parallel (DataView *tmpView, long newSize);
+  void sort_in_parallel ();
   DataDescriptor *ddscr;
   long ddsize;
   Vector<long> *index; // sorted vector of data_id (index into dDscr)
@@ -287,6 +287,15 @@ enum textrel_check_method
 #define bfd_link_textrel_check(info) \
   (info->textrel_check != textrel_check_none)
 
+/* How to fold identical input sections (--icf).  */
+
+enum icf_method
+{
+  icf_none,
+  icf_safe,
+  icf_all
+};
+
 typedef enum {with_flags, without_flags} flag_type;
 
 /* A section flag list.  */
@@ -430,6 +439,9 @@ struct bfd_link_info
   /* What to do with DT_TEXTREL in output.  */
   ENUM_BITFIELD (textrel_check_method) textrel_check: 2;
 
+  /* Which identical sections should be folded.  */
+  ENUM_BITFIELD (icf_method) icf: 2;
+
   /* TRUE if .hash section should be created.  */
   unsigned int emit_hash: 1;
 
@@ -515,6 +527,9 @@ struct bfd_link_info
   /* TRUE if user should be informed of removed unreferenced sections.  */
   unsigned int print_gc_sections: 1;
 
+  /* TRUE if user should be informed of folded identical sections.  */
+  unsigned int print_icf_sections: 1;
+
   /* TRUE if we should warn alternate ELF machine code.  */
   unsigned int warn_alternate_em: 1;
 
@@ -733,6 +748,10 @@ struct bfd_link_info
   /* The maximum cache size.  Backend can use cache_size and and
      max_cache_size to decide if keep_memory should be honored.  */
   bfd_size_type max_cache_size;
+
+  /* The size of the cache of decoded relocations used when relocations
+     are not kept in memory, or zero for no cache.  */
+  bfd_size_type reloc_cache_size;
 };
 
 /* Some forward-definitions used by some callbacks.  */
@@ -114,6 +114,23 @@ typedef struct ctf_link_sym
    the only likely case.)  */
 #define CTF_LINK_NO_FILTER_REPORTED_SYMS 0x10
 
+/* Identify types during deduplication with a fast 128-bit non-cryptographic
+   hash rather than SHA-1.  Hash collisions are detected and resolved, so the
+   output is the same either way.  */
+#define CTF_LINK_FAST_HASH 0x20
+
+/* Statistics about the deduplication done by the last call to ctf_link.  In
+   CU-mapped links, the types going into and out of both deduplication passes
+   are counted.  */
+
+typedef struct ctf_link_stats
+{
+  size_t cls_types_in;		/* Number of types in the inputs.  */
+  size_t cls_types_out;		/* Number of types in the outputs.  */
+  size_t cls_hash_collisions;	/* Number of type hash collisions resolved.  */
+  double cls_hash_time;		/* Seconds of CPU time spent hashing types.  */
+} ctf_link_stats_t;
+
 /* Symbolic names for CTF sections.  */
 
 typedef enum ctf_sect_names
@@ -533,6 +550,7 @@ typedef int ctf_link_variable_filter_f (ctf_dict_t *, const char *, ctf_id_t,
 extern int ctf_link_set_variable_filter (ctf_dict_t *,
 					 ctf_link_variable_filter_f *, void *);
 extern int ctf_link (ctf_dict_t *, int flags);
+extern int ctf_link_stats (ctf_dict_t *, ctf_link_stats_t *);
 typedef const char *ctf_link_strtab_string_f (uint32_t *offset, void *arg);
 extern int ctf_link_add_strtab (ctf_dict_t *, ctf_link_strtab_string_f *,
 				void *);
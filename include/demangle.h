@@ -146,6 +146,22 @@ cplus_demangle_v3_callback (const char *mangled, int options,
 extern char*
 cplus_demangle_v3 (const char *mangled, int options);
 
+/* A context for demangling many names with cplus_demangle_v3_ctx.
+   It keeps the memory used for one name to be used for the next.  */
+struct cplus_demangle_ctx;
+
+extern struct cplus_demangle_ctx *
+cplus_demangle_ctx_new (void);
+
+extern void
+cplus_demangle_ctx_free (struct cplus_demangle_ctx *ctx);
+
+/* Like cplus_demangle_v3, but the result is held in CTX.  It must not
+   be freed, and is only valid until CTX is next used.  */
+extern const char *
+cplus_demangle_v3_ctx (const char *mangled, int options,
+                       struct cplus_demangle_ctx *ctx);
+
 extern int
 java_demangle_v3_callback (const char *mangled,
                            demangle_callbackref callback, void *opaque);
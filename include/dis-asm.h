@@ -402,6 +402,17 @@ extern disassembler_ftype disassembler (enum bfd_architecture arc,
 					bool big, unsigned long mach,
 					bfd *abfd);
 
+/* Like disassembler, but fetch a function which only decodes an
+   instruction, returning its length and filling in the insn_info fields
+   of the disassemble_info, without printing anything.  This is much
+   cheaper when only instruction boundaries are wanted.  Mapping symbols
+   are not consulted, so the bytes must be known to be code.  Returns NULL
+   if the architecture has no such function, in which case callers should
+   fall back to the function returned by disassembler.  */
+extern disassembler_ftype disassembler_length (enum bfd_architecture arc,
+					       bool big, unsigned long mach,
+					       bfd *abfd);
+
 /* Amend the disassemble_info structure as necessary for the target architecture.
    Should only be called after initialising the info->arch field.  */
 extern void disassemble_init_for_target (struct disassemble_info *);
@@ -134,8 +134,21 @@ struct htab {
   /* Current size (in entries) of the hash table, as an index into the
      table of primes.  */
   unsigned int size_prime_index;
+
+  /* The HTAB_* flags given to htab_create_alloc_flags, or zero.  This
+     member is appended to the layout that GCC's copy of this header
+     shares; what the flags enable is kept in the allocation of ENTRIES
+     rather than in further members.  */
+  unsigned int flags;
 };
 
+/* Flags for htab_create_alloc_flags.  */
+
+/* Store the hash value of each element next to the entries, so that a
+   search need only compare elements whose hashes match, and the table
+   can be expanded without hashing the elements again.  */
+#define HTAB_STORE_HASHES 1
+
 typedef struct htab *htab_t;
 
 /* An enum saying whether we insert into the hash table or not.  */
@@ -155,6 +168,9 @@ extern htab_t	htab_create_alloc_ex (size_t, htab_hash,
 extern htab_t  htab_create_typed_alloc (size_t, htab_hash, htab_eq, htab_del,
 					htab_alloc, htab_alloc, htab_free);
 
+extern htab_t  htab_create_alloc_flags (size_t, htab_hash, htab_eq, htab_del,
+					htab_alloc, htab_free, unsigned int);
+
 /* Backward-compatibility functions.  */
 extern htab_t htab_create (size_t, htab_hash, htab_eq, htab_del);
 extern htab_t htab_try_create (size_t, htab_hash, htab_eq, htab_del);
@@ -475,6 +475,18 @@ enum ld_plugin_status
 (*ld_plugin_get_wrap_symbols) (uint64_t *num_symbols,
                                const char ***wrap_symbol_list);
 
+/* The linker's interface for declaring that the plugin's claim_file
+   handler may be called for several input files at the same time, from
+   different threads.  The handler, and the linker interfaces it calls,
+   must then not rely on being called serially; each call is identified
+   by the handle in its ld_plugin_input_file.  This must be called from
+   the onload entry point.  The linker only calls the claim_file handlers
+   concurrently if every loaded plugin has called this function.  */
+
+typedef
+enum ld_plugin_status
+(*ld_plugin_allow_concurrent_claim_file) (void);
+
 enum ld_plugin_level
 {
   LDPL_INFO,
@@ -521,6 +533,7 @@ enum ld_plugin_tag
   LDPT_REGISTER_NEW_INPUT_HOOK,
   LDPT_GET_WRAP_SYMBOLS,
   LDPT_ADD_SYMBOLS_V2,
+  LDPT_ALLOW_CONCURRENT_CLAIM_FILE,
 };
 
 /* The plugin transfer vector.  */
@@ -556,6 +569,7 @@ struct ld_plugin_tv
     ld_plugin_get_input_section_size tv_get_input_section_size;
     ld_plugin_register_new_input tv_register_new_input;
     ld_plugin_get_wrap_symbols tv_get_wrap_symbols;
+    ld_plugin_allow_concurrent_claim_file tv_allow_concurrent_claim_file;
   } tv_u;
 };
 
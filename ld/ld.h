@@ -100,6 +100,12 @@ struct wildcard_spec
   struct name_list *exclude_name_list;
   sort_type sorted;
   struct flag_info *section_flag_list;
+  /* For section name specs, the length of NAME and of its literal
+     prefix and suffix around any wildcard characters.  Set by
+     lang_add_wild.  */
+  unsigned int namelen;
+  unsigned int prefixlen;
+  unsigned int suffixlen;
 };
 
 struct wildcard_list
@@ -192,6 +198,10 @@ typedef struct
 
   /* Default linker script.  */
   char *default_script;
+
+  /* File listing input sections to place first in their output
+     sections, from --section-ordering-file.  */
+  char *section_ordering_file;
 } args_type;
 
 extern args_type command_line;
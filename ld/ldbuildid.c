@@ -35,6 +35,7 @@ bool
 validate_build_id_style (const char *style)
 {
   if ((streq (style, "md5")) || (streq (style, "sha1"))
+      || (streq (style, "fast"))
       || (streq (style, "uuid")) || (startswith (style, "0x")))
     return true;
 
@@ -50,6 +51,9 @@ compute_build_id_size (const char *style)
   if (streq (style, "sha1"))
     return 160 / 8;
 
+  if (streq (style, "fast"))
+    return 64 / 8;
+
   if (startswith (style, "0x"))
     {
       bfd_size_type size = 0;
@@ -93,6 +97,154 @@ read_hex (const char xdigit)
   return 0;
 }
 
+/* The "fast" style uses the 64-bit xxHash (XXH64) of the output, with
+   a seed of zero.  It is not a cryptographic hash, but like md5 and
+   sha1 gives the same id for identical output, and is many times
+   quicker to compute.  */
+
+#define XXH_PRIME64_1 0x9e3779b185ebca87ULL
+#define XXH_PRIME64_2 0xc2b2ae3d27d4eb4fULL
+#define XXH_PRIME64_3 0x165667b19e3779f9ULL
+#define XXH_PRIME64_4 0x85ebca77c2b2ae63ULL
+#define XXH_PRIME64_5 0x27d4eb2f165667c5ULL
+
+struct xxh64_ctx
+{
+  uint64_t v[4];
+  uint64_t total_len;
+  unsigned char buf[32];
+  size_t buflen;
+};
+
+static inline uint64_t
+xxh64_rotl (uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t
+xxh64_read64 (const unsigned char *p)
+{
+  return ((uint64_t) p[0] | (uint64_t) p[1] << 8 | (uint64_t) p[2] << 16
+	  | (uint64_t) p[3] << 24 | (uint64_t) p[4] << 32
+	  | (uint64_t) p[5] << 40 | (uint64_t) p[6] << 48
+	  | (uint64_t) p[7] << 56);
+}
+
+static inline uint64_t
+xxh64_round (uint64_t acc, uint64_t input)
+{
+  acc += input * XXH_PRIME64_2;
+  acc = xxh64_rotl (acc, 31);
+  return acc * XXH_PRIME64_1;
+}
+
+static inline uint64_t
+xxh64_merge_round (uint64_t acc, uint64_t val)
+{
+  acc ^= xxh64_round (0, val);
+  return acc * XXH_PRIME64_1 + XXH_PRIME64_4;
+}
+
+static void
+xxh64_init_ctx (struct xxh64_ctx *ctx)
+{
+  ctx->v[0] = XXH_PRIME64_1 + XXH_PRIME64_2;
+  ctx->v[1] = XXH_PRIME64_2;
+  ctx->v[2] = 0;
+  ctx->v[3] = -XXH_PRIME64_1;
+  ctx->total_len = 0;
+  ctx->buflen = 0;
+}
+
+static void
+xxh64_stripe (struct xxh64_ctx *ctx, const unsigned char *p)
+{
+  ctx->v[0] = xxh64_round (ctx->v[0], xxh64_read64 (p));
+  ctx->v[1] = xxh64_round (ctx->v[1], xxh64_read64 (p + 8));
+  ctx->v[2] = xxh64_round (ctx->v[2], xxh64_read64 (p + 16));
+  ctx->v[3] = xxh64_round (ctx->v[3], xxh64_read64 (p + 24));
+}
+
+static void
+xxh64_process_bytes (const void *buffer, size_t len, void *data)
+{
+  struct xxh64_ctx *ctx = (struct xxh64_ctx *) data;
+  const unsigned char *p = (const unsigned char *) buffer;
+
+  ctx->total_len += len;
+  if (ctx->buflen != 0)
+    {
+      size_t n = sizeof (ctx->buf) - ctx->buflen;
+
+      if (n > len)
+	n = len;
+      memcpy (ctx->buf + ctx->buflen, p, n);
+      ctx->buflen += n;
+      p += n;
+      len -= n;
+      if (ctx->buflen < sizeof (ctx->buf))
+	return;
+      xxh64_stripe (ctx, ctx->buf);
+      ctx->buflen = 0;
+    }
+
+  for (; len >= 32; p += 32, len -= 32)
+    xxh64_stripe (ctx, p);
+
+  memcpy (ctx->buf, p, len);
+  ctx->buflen = len;
+}
+
+static uint64_t
+xxh64_finish_ctx (struct xxh64_ctx *ctx)
+{
+  const unsigned char *p = ctx->buf;
+  size_t len = ctx->buflen;
+  uint64_t h;
+
+  if (ctx->total_len >= 32)
+    {
+      h = (xxh64_rotl (ctx->v[0], 1) + xxh64_rotl (ctx->v[1], 7)
+	   + xxh64_rotl (ctx->v[2], 12) + xxh64_rotl (ctx->v[3], 18));
+      h = xxh64_merge_round (h, ctx->v[0]);
+      h = xxh64_merge_round (h, ctx->v[1]);
+      h = xxh64_merge_round (h, ctx->v[2]);
+      h = xxh64_merge_round (h, ctx->v[3]);
+    }
+  else
+    h = XXH_PRIME64_5;
+  h += ctx->total_len;
+
+  for (; len >= 8; p += 8, len -= 8)
+    {
+      h ^= xxh64_round (0, xxh64_read64 (p));
+      h = xxh64_rotl (h, 27) * XXH_PRIME64_1 + XXH_PRIME64_4;
+    }
+  if (len >= 4)
+    {
+      uint64_t k = ((uint64_t) p[0] | (uint64_t) p[1] << 8
+		    | (uint64_t) p[2] << 16 | (uint64_t) p[3] << 24);
+
+      h ^= k * XXH_PRIME64_1;
+      h = xxh64_rotl (h, 23) * XXH_PRIME64_2 + XXH_PRIME64_3;
+      p += 4;
+      len -= 4;
+    }
+  for (; len > 0; p++, len--)
+    {
+      h ^= *p * XXH_PRIME64_5;
+      h = xxh64_rotl (h, 11) * XXH_PRIME64_1;
+    }
+
+  h ^= h >> 33;
+  h *= XXH_PRIME64_2;
+  h ^= h >> 29;
+  h *= XXH_PRIME64_3;
+  h ^= h >> 32;
+  return h;
+}
+
 bool
 generate_build_id (bfd *abfd,
 		   const char *style,
@@ -118,6 +270,20 @@ generate_build_id (bfd *abfd,
 	return false;
       sha1_finish_ctx (&ctx, id_bits);
     }
+  else if (streq (style, "fast"))
+    {
+      struct xxh64_ctx ctx;
+      uint64_t h;
+      int i;
+
+      xxh64_init_ctx (&ctx);
+      if (!(*checksum_contents) (abfd, &xxh64_process_bytes, &ctx))
+	return false;
+      h = xxh64_finish_ctx (&ctx);
+      /* Store the hash in its canonical, big-endian, form.  */
+      for (i = 7; i >= 0; i--, h >>= 8)
+	id_bits[i] = h & 0xff;
+    }
   else if (streq (style, "uuid"))
     {
 #ifndef __MINGW32__
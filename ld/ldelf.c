@@ -610,7 +610,8 @@ ldelf_search_needed (const char *path, struct dt_needed *n, int force,
 
       needed.name = filename;
 
-      if (ldelf_try_needed (&needed, force, is_linux))
+      if (ldfile_search_file_may_exist (filename)
+	  && ldelf_try_needed (&needed, force, is_linux))
 	return true;
 
       free (filename);
@@ -1172,7 +1173,8 @@ ldelf_handle_dt_needed (struct elf_link_hash_table *htab,
 	      filename = (char *) xmalloc (strlen (search->name) + len + 2);
 	      sprintf (filename, "%s/%s", search->name, l->name);
 	      nn.name = filename;
-	      if (ldelf_try_needed (&nn, force, is_linux))
+	      if (ldfile_search_file_may_exist (filename)
+		  && ldelf_try_needed (&nn, force, is_linux))
 		break;
 	      free (filename);
 	    }
@@ -1953,13 +1955,16 @@ ldelf_open_dynamic_archive (const char *arch, search_dirs_type *search,
 #ifdef EXTRA_SHLIB_EXTENSION
       /* Try the .so extension first.  If that fails build a new filename
 	 using EXTRA_SHLIB_EXTENSION.  */
-      opened = ldfile_try_open_bfd (string, entry);
+      opened = (ldfile_search_file_may_exist (string)
+		&& ldfile_try_open_bfd (string, entry));
       if (!opened)
 	strcpy (string + len - 4, EXTRA_SHLIB_EXTENSION);
 #endif
     }
 
-  if (!opened && !ldfile_try_open_bfd (string, entry))
+  if (!opened
+      && (!ldfile_search_file_may_exist (string)
+	  || !ldfile_try_open_bfd (string, entry)))
     {
       free (string);
       return false;
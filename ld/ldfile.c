@@ -34,6 +34,11 @@
 #include "ldemul.h"
 #include "libiberty.h"
 #include "filenames.h"
+#include "hashtab.h"
+#if defined (HAVE_DIRENT_H) && !defined (HAVE_DOS_BASED_FILE_SYSTEM)
+#include <dirent.h>
+#define USE_DIR_CACHE 1
+#endif
 #if BFD_SUPPORTS_PLUGINS
 #include "plugin-api.h"
 #include "plugin.h"
@@ -92,6 +97,109 @@ is_sysrooted_pathname (const char *name)
   return result;
 }
 
+#ifdef USE_DIR_CACHE
+/* The contents of each directory probed while searching for
+   libraries, so that every -l and DT_NEEDED lookup does not have to
+   try to open each candidate in each search directory.  */
+
+struct dir_cache_entry
+{
+  /* Directory name, as it appears in the probed path.  */
+  char *name;
+  /* Names of the files in the directory, or NULL if the directory
+     could not be read.  */
+  htab_t files;
+};
+
+static htab_t dir_cache;
+
+static hashval_t
+dir_cache_hash (const void *p)
+{
+  const struct dir_cache_entry *e = (const struct dir_cache_entry *) p;
+  return htab_hash_string (e->name);
+}
+
+static int
+dir_cache_eq (const void *p1, const void *p2)
+{
+  const struct dir_cache_entry *e1 = (const struct dir_cache_entry *) p1;
+  const struct dir_cache_entry *e2 = (const struct dir_cache_entry *) p2;
+  return strcmp (e1->name, e2->name) == 0;
+}
+
+/* Read the names of the files in directory NAME.  */
+
+static htab_t
+read_dir_contents (const char *name)
+{
+  DIR *dir;
+  struct dirent *d;
+  htab_t files;
+
+  dir = opendir (*name == '\0' ? "." : name);
+  if (dir == NULL)
+    return NULL;
+
+  files = htab_create_alloc (64, htab_hash_string, htab_eq_string, free,
+			     xcalloc, free);
+  while ((d = readdir (dir)) != NULL)
+    {
+      void **slot = htab_find_slot (files, d->d_name, INSERT);
+      if (*slot == NULL)
+	*slot = xstrdup (d->d_name);
+    }
+  closedir (dir);
+  return files;
+}
+#endif
+
+/* Return false if the file NAME, a candidate built from a search
+   directory, is known not to exist.  The contents of each directory
+   are read once and cached.  Return true if the file might exist.  */
+
+bool
+ldfile_search_file_may_exist (const char *name)
+{
+#ifdef USE_DIR_CACHE
+  const char *base = lbasename (name);
+  struct dir_cache_entry key, *entry;
+  void **slot;
+
+  if (*base == '\0')
+    return true;
+
+  if (dir_cache == NULL)
+    dir_cache = htab_create_alloc (16, dir_cache_hash, dir_cache_eq,
+				   NULL, xcalloc, free);
+
+  key.name = xmemdup (name, base - name, base - name + 1);
+  slot = htab_find_slot (dir_cache, &key, INSERT);
+  if (*slot != NULL)
+    {
+      free (key.name);
+      entry = (struct dir_cache_entry *) *slot;
+    }
+  else
+    {
+      entry = (struct dir_cache_entry *) xmalloc (sizeof (*entry));
+      entry->name = key.name;
+      entry->files = read_dir_contents (key.name);
+      *slot = entry;
+    }
+
+  if (entry->files == NULL
+      || htab_find (entry->files, base) != NULL)
+    return true;
+
+  if (verbose)
+    info_msg (_("attempt to open %s failed\n"), name);
+  return false;
+#else
+  return true;
+#endif
+}
+
 /* Adds NAME to the library search path.
    Makes a copy of NAME using xmalloc().  */
 
@@ -375,7 +483,8 @@ ldfile_open_file_search (const char *arch,
 	string = concat (search->name, slash, entry->filename,
 			 (const char *) 0);
 
-      if (ldfile_try_open_bfd (string, entry))
+      if (ldfile_search_file_may_exist (string)
+	  && ldfile_try_open_bfd (string, entry))
 	{
 	  entry->filename = string;
 	  return true;
@@ -54,6 +54,8 @@ extern void ldfile_open_file
   (struct lang_input_statement_struct *);
 extern bool ldfile_try_open_bfd
   (const char *, struct lang_input_statement_struct *);
+extern bool ldfile_search_file_may_exist
+  (const char *);
 extern void ldfile_set_output_arch
   (const char *, enum bfd_architecture);
 extern bool ldfile_open_file_search
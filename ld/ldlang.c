@@ -79,7 +79,7 @@ static unsigned int opb_shift = 0;
 static void exp_init_os (etree_type *);
 static lang_input_statement_type *lookup_name (const char *);
 static void insert_undefined (const char *);
-static bool sort_def_symbol (struct bfd_link_hash_entry *, void *);
+static void sort_def_symbols (void);
 static void print_statement (lang_statement_union_type *,
 			     lang_output_section_statement_type *);
 static void print_statement_list (lang_statement_union_type *,
@@ -177,6 +177,61 @@ name_match (const char *pattern, const char *name)
   return strcmp (pattern, name);
 }
 
+/* Set up the lengths used by spec_match for section name SPEC.  */
+
+static void
+init_spec_match (struct wildcard_spec *spec)
+{
+  const char *p;
+
+  if (spec->name == NULL)
+    return;
+
+  spec->namelen = strlen (spec->name);
+  if (!wildcardp (spec->name))
+    {
+      spec->prefixlen = spec->namelen;
+      spec->suffixlen = 0;
+      return;
+    }
+
+  /* Backslash quotes the next character for fnmatch, so it ends the
+     literal parts too.  */
+  spec->prefixlen = strcspn (spec->name, "?*[\\");
+  for (p = spec->name + spec->namelen; p > spec->name + spec->prefixlen; p--)
+    if (strchr ("?*[]\\", p[-1]) != NULL)
+      break;
+  spec->suffixlen = spec->name + spec->namelen - p;
+}
+
+/* Like name_match, but for the section name spec SPEC and section
+   name NAME of length NAMELEN.  Most sections are rejected by a
+   comparison of the literal prefix or suffix of the spec, and a spec
+   whose only wildcard is a single '*' needs nothing more, so fnmatch
+   is rarely called.  */
+
+static int
+spec_match (const struct wildcard_spec *spec, const char *name,
+	    size_t namelen)
+{
+  size_t wildlen;
+
+  if (spec->prefixlen == spec->namelen)
+    return strcmp (spec->name, name);
+
+  if (namelen < spec->prefixlen + spec->suffixlen
+      || memcmp (spec->name, name, spec->prefixlen) != 0
+      || memcmp (spec->name + spec->namelen - spec->suffixlen,
+		 name + namelen - spec->suffixlen, spec->suffixlen) != 0)
+    return 1;
+
+  wildlen = spec->namelen - spec->prefixlen - spec->suffixlen;
+  if (wildlen == 1 && spec->name[spec->prefixlen] == '*')
+    return 0;
+
+  return fnmatch (spec->name, name, 0);
+}
+
 static char *
 ldirname (const char *name)
 {
@@ -337,6 +392,9 @@ walk_wild_section_general (lang_wild_statement_type *ptr,
 
   for (s = file->the_bfd->sections; s != NULL; s = s->next)
     {
+      const char *sname = bfd_section_name (s);
+      size_t snamelen = strlen (sname);
+
       sec = ptr->section_list;
       if (sec == NULL)
 	(*callback) (ptr, sec, s, file, data);
@@ -346,11 +404,7 @@ walk_wild_section_general (lang_wild_statement_type *ptr,
 	  bool skip = false;
 
 	  if (sec->spec.name != NULL)
-	    {
-	      const char *sname = bfd_section_name (s);
-
-	      skip = name_match (sec->spec.name, sname) != 0;
-	    }
+	    skip = spec_match (&sec->spec, sname, snamelen) != 0;
 
 	  if (!skip)
 	    walk_wild_consider_section (ptr, file, s, sec, callback, data);
@@ -1213,6 +1267,10 @@ lang_add_input_file (const char *name,
 struct out_section_hash_entry
 {
   struct bfd_hash_entry root;
+  /* In the first entry for a name, the last entry with the same name,
+     or NULL if there is only one.  Duplicates are chained after the
+     first entry, so this lets us append one without walking them.  */
+  struct out_section_hash_entry *last_dup;
   lang_statement_union_type s;
 };
 
@@ -1244,6 +1302,7 @@ output_section_statement_newfunc (struct bfd_hash_entry *entry,
     return entry;
 
   ret = (struct out_section_hash_entry *) entry;
+  ret->last_dup = NULL;
   memset (&ret->s, 0, sizeof (ret->s));
   ret->s.header.type = lang_output_section_statement_enum;
   ret->s.output_section_statement.subsection_alignment = NULL;
@@ -1489,25 +1548,30 @@ lang_output_section_statement_lookup (const char *name,
     {
       /* We have a section of this name, but it might not have the correct
 	 constraint.  */
+      struct out_section_hash_entry *first_ent = entry;
       struct out_section_hash_entry *last_ent;
 
       name = entry->s.output_section_statement.name;
-      do
+      if (create == 2 || (create && constraint == SPECIAL))
+	/* We always want a new entry, so go straight to the end.  */
+	last_ent = first_ent->last_dup != NULL ? first_ent->last_dup : entry;
+      else
 	{
-	  if (create != 2
-	      && !(create && constraint == SPECIAL)
-	      && (constraint == entry->s.output_section_statement.constraint
+	  do
+	    {
+	      if (constraint == entry->s.output_section_statement.constraint
 		  || (constraint == 0
-		      && entry->s.output_section_statement.constraint >= 0)))
-	    return &entry->s.output_section_statement;
-	  last_ent = entry;
-	  entry = (struct out_section_hash_entry *) entry->root.next;
-	}
-      while (entry != NULL
-	     && name == entry->s.output_section_statement.name);
+		      && entry->s.output_section_statement.constraint >= 0))
+		return &entry->s.output_section_statement;
+	      last_ent = entry;
+	      entry = (struct out_section_hash_entry *) entry->root.next;
+	    }
+	  while (entry != NULL
+		 && name == entry->s.output_section_statement.name);
 
-      if (!create)
-	return NULL;
+	  if (!create)
+	    return NULL;
+	}
 
       entry
 	= ((struct out_section_hash_entry *)
@@ -1521,6 +1585,7 @@ lang_output_section_statement_lookup (const char *name,
 	}
       entry->root = last_ent->root;
       last_ent->root.next = &entry->root;
+      first_ent->last_dup = entry;
     }
 
   entry->s.output_section_statement.name = name;
@@ -1864,6 +1929,58 @@ insert_os_after (lang_output_section_statement_type *after)
   return where;
 }
 
+/* While orphans are being placed, the output sections which are known
+   to have no loadable note section after them in the output section
+   list.  A non-note orphan placed after the note sections is added
+   here, so that the next orphan following it need not search the rest
+   of the list for notes.  The set is emptied whenever an output
+   section becomes a loadable note section.  */
+static htab_t orphan_no_notes_after;
+
+/* Return whether output section SEC is a loadable ELF note section.  */
+
+static bool
+orphan_load_note_p (asection *sec)
+{
+  return (bfd_get_flavour (link_info.output_bfd) == bfd_target_elf_flavour
+	  && elf_section_type (sec) == SHT_NOTE
+	  && (sec->flags & SEC_LOAD) != 0);
+}
+
+/* Return whether there are known to be no loadable note sections
+   after output section SEC.  */
+
+static bool
+orphan_no_notes_after_p (asection *sec)
+{
+  return (orphan_no_notes_after != NULL
+	  && (htab_find (orphan_no_notes_after, sec) != NULL
+	      || (sec->prev != NULL
+		  && htab_find (orphan_no_notes_after, sec->prev) != NULL)));
+}
+
+/* Find the output section statement for output section SEC, searching
+   forwards and then backwards from AFTER.  Return NULL if there is
+   none.  */
+
+static lang_output_section_statement_type *
+orphan_find_os (lang_output_section_statement_type *after, asection *sec)
+{
+  lang_output_section_statement_type *stmt;
+
+  stmt = lang_output_section_get (sec);
+  if (stmt != NULL && stmt->bfd_section == sec)
+    return stmt;
+
+  for (stmt = after; stmt != NULL; stmt = stmt->next)
+    if (stmt->bfd_section == sec)
+      return stmt;
+  for (stmt = after; stmt != NULL; stmt = stmt->prev)
+    if (stmt->bfd_section == sec)
+      return stmt;
+  return NULL;
+}
+
 lang_output_section_statement_type *
 lang_insert_orphan (asection *s,
 		    const char *secname,
@@ -1922,6 +2039,7 @@ lang_insert_orphan (asection *s,
       asection *snew, *as;
       bool place_after = place->stmt == NULL;
       bool insert_after = true;
+      bool no_notes_after = false;
 
       snew = os->bfd_section;
 
@@ -2029,76 +2147,34 @@ lang_insert_orphan (asection *s,
 	         note sections.  */
 	      after_sec_note = true;
 	      after_sec = as;
-	      for (sec = as->next;
-		   (sec != NULL
-		    && !bfd_is_abs_section (sec));
-		   sec = sec->next)
-		if (elf_section_type (sec) == SHT_NOTE
-		    && (sec->flags & SEC_LOAD) != 0)
-		  after_sec = sec;
+	      if (!orphan_no_notes_after_p (as))
+		for (sec = as->next;
+		     (sec != NULL
+		      && !bfd_is_abs_section (sec));
+		     sec = sec->next)
+		  if (elf_section_type (sec) == SHT_NOTE
+		      && (sec->flags & SEC_LOAD) != 0)
+		    after_sec = sec;
+	      no_notes_after = true;
 	    }
 
 	  if (after_sec_note)
 	    {
 	      if (after_sec)
 		{
-		  /* Search forward to insert OS after AFTER_SEC output
-		     statement.  */
-		  lang_output_section_statement_type *stmt, *next;
-		  bool found = false;
-		  for (stmt = after; stmt != NULL; stmt = next)
+		  /* Find the output statement to insert OS after.  If
+		     INSERT_AFTER is FALSE, OS goes before AFTER_SEC's
+		     output statement.  */
+		  lang_output_section_statement_type *stmt;
+
+		  stmt = orphan_find_os (after, after_sec);
+		  if (stmt != NULL && !insert_after)
+		    stmt = stmt->prev;
+		  if (stmt != NULL)
 		    {
-		      next = stmt->next;
-		      if (insert_after)
-			{
-			  if (stmt->bfd_section == after_sec)
-			    {
-			      place_after = true;
-			      found = true;
-			      after = stmt;
-			      break;
-			    }
-			}
-		      else
-			{
-			  /* If INSERT_AFTER is FALSE, place OS before
-			     AFTER_SEC output statement.  */
-			  if (next && next->bfd_section == after_sec)
-			    {
-			      place_after = true;
-			      found = true;
-			      after = stmt;
-			      break;
-			    }
-			}
+		      place_after = true;
+		      after = stmt;
 		    }
-
-		  /* Search backward to insert OS after AFTER_SEC output
-		     statement.  */
-		  if (!found)
-		    for (stmt = after; stmt != NULL; stmt = stmt->prev)
-		      {
-			if (insert_after)
-			  {
-			    if (stmt->bfd_section == after_sec)
-			      {
-				place_after = true;
-				after = stmt;
-				break;
-			      }
-			  }
-			else
-			  {
-			    /* If INSERT_AFTER is FALSE, place OS before
-			       AFTER_SEC output statement.  */
-			    if (stmt->next->bfd_section == after_sec)
-			      {
-				place_after = true;
-				after = stmt;
-				break;
-			      }
-			  }
-		      }
 		}
 
 	      if (after_sec == NULL
@@ -2122,6 +2198,10 @@ lang_insert_orphan (asection *s,
 		  else
 		    bfd_section_list_prepend (link_info.output_bfd, snew);
 		}
+
+	      /* SNEW now follows the last note section after AS.  */
+	      if (no_notes_after && orphan_no_notes_after != NULL)
+		*htab_find_slot (orphan_no_notes_after, snew, INSERT) = snew;
 	    }
 	  else if (as != snew && as->prev != snew)
 	    {
@@ -2338,7 +2418,7 @@ lang_map (void)
   if (!link_info.reduce_memory_overheads)
     {
       obstack_begin (&map_obstack, 1000);
-      bfd_link_hash_traverse (link_info.hash, sort_def_symbol, 0);
+      sort_def_symbols ();
     }
   expld.phase = lang_fixed_phase_enum;
   lang_statement_iteration++;
@@ -2348,36 +2428,96 @@ lang_map (void)
 			      config.map_file);
 }
 
+/* Symbols defined in input sections, collected by
+   collect_def_symbol.  */
+
+struct map_symbol_defs
+{
+  struct map_symbol_def *defs;
+  unsigned long count;
+};
+
 static bool
-sort_def_symbol (struct bfd_link_hash_entry *hash_entry,
-		 void *info ATTRIBUTE_UNUSED)
+collect_def_symbol (struct bfd_link_hash_entry *hash_entry, void *info)
 {
+  struct map_symbol_defs *syms = (struct map_symbol_defs *) info;
+
   if ((hash_entry->type == bfd_link_hash_defined
        || hash_entry->type == bfd_link_hash_defweak)
       && hash_entry->u.def.section->owner != link_info.output_bfd
       && hash_entry->u.def.section->owner != NULL)
     {
+      if (syms->defs != NULL)
+	{
+	  syms->defs[syms->count].entry = hash_entry;
+	  syms->defs[syms->count].index = syms->count;
+	}
+      syms->count++;
+    }
+  return true;
+}
+
+/* Sort symbols by section, then by value, then by hash table order.  */
+
+static int
+map_symbol_def_cmp (const void *a, const void *b)
+{
+  const struct map_symbol_def *l = (const struct map_symbol_def *) a;
+  const struct map_symbol_def *r = (const struct map_symbol_def *) b;
+  unsigned int lid = l->entry->u.def.section->id;
+  unsigned int rid = r->entry->u.def.section->id;
+
+  if (lid != rid)
+    return lid < rid ? -1 : 1;
+  if (l->entry->u.def.value != r->entry->u.def.value)
+    return l->entry->u.def.value < r->entry->u.def.value ? -1 : 1;
+  if (l->index != r->index)
+    return l->index < r->index ? -1 : 1;
+  return 0;
+}
+
+/* Attach to each input section the symbols defined in it, sorted by
+   value, for printing in the map file.  All symbols are gathered into
+   one array and sorted once, so that each section's symbols form a
+   contiguous run.  */
+
+static void
+sort_def_symbols (void)
+{
+  struct map_symbol_defs syms;
+  unsigned long i, j;
+
+  syms.defs = NULL;
+  syms.count = 0;
+  bfd_link_hash_traverse (link_info.hash, collect_def_symbol, &syms);
+  if (syms.count == 0)
+    return;
+
+  syms.defs = (struct map_symbol_def *)
+    obstack_alloc (&map_obstack, syms.count * sizeof (*syms.defs));
+  syms.count = 0;
+  bfd_link_hash_traverse (link_info.hash, collect_def_symbol, &syms);
+
+  qsort (syms.defs, syms.count, sizeof (*syms.defs), map_symbol_def_cmp);
+
+  for (i = 0; i < syms.count; i = j)
+    {
+      asection *sec = syms.defs[i].entry->u.def.section;
       input_section_userdata_type *ud;
-      struct map_symbol_def *def;
 
-      ud = bfd_section_userdata (hash_entry->u.def.section);
+      for (j = i + 1; j < syms.count; j++)
+	if (syms.defs[j].entry->u.def.section != sec)
+	  break;
+
+      ud = bfd_section_userdata (sec);
       if (!ud)
 	{
 	  ud = stat_alloc (sizeof (*ud));
-	  bfd_set_section_userdata (hash_entry->u.def.section, ud);
-	  ud->map_symbol_def_tail = &ud->map_symbol_def_head;
-	  ud->map_symbol_def_count = 0;
+	  bfd_set_section_userdata (sec, ud);
 	}
-      else if (!ud->map_symbol_def_tail)
-	ud->map_symbol_def_tail = &ud->map_symbol_def_head;
-
-      def = (struct map_symbol_def *) obstack_alloc (&map_obstack, sizeof *def);
-      def->entry = hash_entry;
-      *(ud->map_symbol_def_tail) = def;
-      ud->map_symbol_def_tail = &def->next;
-      ud->map_symbol_def_count++;
+      ud->map_symbols = syms.defs + i;
+      ud->map_symbol_count = j - i;
     }
-  return true;
 }
 
 /* Initialize an output section.  */
@@ -2543,6 +2683,7 @@ lang_add_section (lang_statement_list_type *ptr,
   flagword flags = section->flags;
 
   bool discard;
+  bool was_note;
   lang_input_section_type *new_section;
   bfd *abfd = link_info.output_bfd;
 
@@ -2657,6 +2798,12 @@ lang_add_section (lang_statement_list_type *ptr,
       break;
     }
 
+  /* Whether lang_insert_orphan needs telling if OUTPUT becomes a
+     loadable note section.  */
+  was_note = (orphan_no_notes_after == NULL
+	      || (output->bfd_section != NULL
+		  && orphan_load_note_p (output->bfd_section)));
+
   if (output->bfd_section == NULL)
     init_os (output, flags);
 
@@ -2695,6 +2842,9 @@ lang_add_section (lang_statement_list_type *ptr,
 	output->bfd_section->entsize = section->entsize;
     }
 
+  if (!was_note && orphan_load_note_p (output->bfd_section))
+    htab_empty (orphan_no_notes_after);
+
   if ((flags & SEC_TIC54X_BLOCK) != 0
       && bfd_get_arch (section->owner) == bfd_arch_tic54x)
     {
@@ -4809,10 +4959,7 @@ print_one_symbol (struct bfd_link_hash_entry *hash_entry, void *ptr)
        || hash_entry->type == bfd_link_hash_defweak)
       && sec == hash_entry->u.def.section)
     {
-      int i;
-
-      for (i = 0; i < SECTION_NAME_MAP_LENGTH; i++)
-	print_space ();
+      fprintf (config.map_file, "%*s", SECTION_NAME_MAP_LENGTH, "");
       minfo ("0x%V   ",
 	     (hash_entry->u.def.value
 	      + hash_entry->u.def.section->output_offset
@@ -4824,49 +4971,20 @@ print_one_symbol (struct bfd_link_hash_entry *hash_entry, void *ptr)
   return true;
 }
 
-static int
-hash_entry_addr_cmp (const void *a, const void *b)
-{
-  const struct bfd_link_hash_entry *l = *(const struct bfd_link_hash_entry **)a;
-  const struct bfd_link_hash_entry *r = *(const struct bfd_link_hash_entry **)b;
-
-  if (l->u.def.value < r->u.def.value)
-    return -1;
-  else if (l->u.def.value > r->u.def.value)
-    return 1;
-  else
-    return 0;
-}
+/* Print the symbols defined in SEC, already sorted by
+   sort_def_symbols.  */
 
 static void
 print_all_symbols (asection *sec)
 {
   input_section_userdata_type *ud = bfd_section_userdata (sec);
-  struct map_symbol_def *def;
-  struct bfd_link_hash_entry **entries;
-  unsigned int i;
+  unsigned long i;
 
   if (!ud)
     return;
 
-  *ud->map_symbol_def_tail = 0;
-
-  /* Sort the symbols by address.  */
-  entries = (struct bfd_link_hash_entry **)
-      obstack_alloc (&map_obstack,
-		     ud->map_symbol_def_count * sizeof (*entries));
-
-  for (i = 0, def = ud->map_symbol_def_head; def; def = def->next, i++)
-    entries[i] = def->entry;
-
-  qsort (entries, ud->map_symbol_def_count, sizeof (*entries),
-	 hash_entry_addr_cmp);
-
-  /* Print the symbols.  */
-  for (i = 0; i < ud->map_symbol_def_count; i++)
-    ldemul_print_symbol (entries[i], sec);
-
-  obstack_free (&map_obstack, entries);
+  for (i = 0; i < ud->map_symbol_count; i++)
+    ldemul_print_symbol (ud->map_symbols[i].entry, sec);
 }
 
 /* Print information about an input section to the map file.  */
@@ -7391,6 +7509,9 @@ ldlang_place_orphan (asection *s)
 static void
 lang_place_orphans (void)
 {
+  orphan_no_notes_after = htab_create (1024, htab_hash_pointer,
+				       htab_eq_pointer, NULL);
+
   LANG_FOR_EACH_INPUT_STATEMENT (file)
     {
       asection *s;
@@ -7426,6 +7547,331 @@ lang_place_orphans (void)
 	    }
 	}
     }
+
+  htab_delete (orphan_no_notes_after);
+  orphan_no_notes_after = NULL;
+}
+
+/* Input section ordering from --section-ordering-file.  Each entry of
+   the file names an input section or a symbol, and may contain
+   wildcards.  Sections matching an entry are placed first in their
+   output section, in the order of the entries.  Entries without
+   wildcards are looked up in hash tables, so that large profile-derived
+   files can be applied without comparing every section with every
+   entry.  */
+
+struct section_ordering_entry
+{
+  const void *key;
+  unsigned int rank;
+};
+
+/* Literal names, keyed by string.  */
+static htab_t section_ordering_names;
+
+/* Sections defining a symbol named in the file, keyed by section.  */
+static htab_t section_ordering_sections;
+
+/* Entries containing wildcards, in file order.  */
+static struct section_ordering_entry *section_ordering_globs;
+static size_t section_ordering_glob_count;
+
+/* The number of ordered sections collected so far, used to keep the
+   sort stable.  */
+static size_t section_ordering_seq;
+
+static hashval_t
+section_ordering_name_hash (const void *p)
+{
+  const struct section_ordering_entry *e = p;
+
+  return htab_hash_string (e->key);
+}
+
+static int
+section_ordering_name_eq (const void *p1, const void *p2)
+{
+  const struct section_ordering_entry *e1 = p1;
+  const struct section_ordering_entry *e2 = p2;
+
+  return strcmp (e1->key, e2->key) == 0;
+}
+
+static hashval_t
+section_ordering_section_hash (const void *p)
+{
+  const struct section_ordering_entry *e = p;
+
+  return htab_hash_pointer (e->key);
+}
+
+static int
+section_ordering_section_eq (const void *p1, const void *p2)
+{
+  const struct section_ordering_entry *e1 = p1;
+  const struct section_ordering_entry *e2 = p2;
+
+  return e1->key == e2->key;
+}
+
+/* Record RANK for the section KEY in TAB, keeping the lowest rank.  */
+
+static void
+section_ordering_add (htab_t tab, const void *key, unsigned int rank)
+{
+  struct section_ordering_entry e, **slot;
+
+  e.key = key;
+  slot = (struct section_ordering_entry **) htab_find_slot (tab, &e, INSERT);
+  if (*slot == NULL)
+    {
+      *slot = stat_alloc (sizeof (**slot));
+      (*slot)->key = key;
+      (*slot)->rank = rank;
+    }
+  else if (rank < (*slot)->rank)
+    (*slot)->rank = rank;
+}
+
+/* Read the --section-ordering-file.  Entries are separated by white
+   space, and '#' starts a comment that runs to the end of the line.  */
+
+static void
+section_ordering_read (const char *filename)
+{
+  FILE *file;
+  char *buf;
+  size_t bufsize, alloc = 0;
+  unsigned int rank = 0;
+  int c;
+
+  file = fopen (filename, "r");
+  if (file == NULL)
+    {
+      bfd_set_error (bfd_error_system_call);
+      einfo (_("%F%P: %s: %E\n"), filename);
+    }
+
+  section_ordering_names = htab_create (1024, section_ordering_name_hash,
+					section_ordering_name_eq, NULL);
+  section_ordering_sections
+    = htab_create (1024, section_ordering_section_hash,
+		   section_ordering_section_eq, NULL);
+
+  bufsize = 100;
+  buf = (char *) xmalloc (bufsize);
+
+  c = getc (file);
+  while (c != EOF)
+    {
+      size_t len = 0;
+
+      while (ISSPACE (c))
+	c = getc (file);
+      if (c == '#')
+	{
+	  while (c != '\n' && c != EOF)
+	    c = getc (file);
+	  continue;
+	}
+      if (c == EOF)
+	break;
+
+      while (!ISSPACE (c) && c != EOF)
+	{
+	  buf[len] = c;
+	  ++len;
+	  if (len >= bufsize)
+	    {
+	      bufsize *= 2;
+	      buf = (char *) xrealloc (buf, bufsize);
+	    }
+	  c = getc (file);
+	}
+      buf[len] = '\0';
+
+      if (wildcardp (buf))
+	{
+	  if (section_ordering_glob_count == alloc)
+	    {
+	      alloc = alloc ? alloc * 2 : 16;
+	      section_ordering_globs
+		= xrealloc (section_ordering_globs,
+			    alloc * sizeof (*section_ordering_globs));
+	    }
+	  section_ordering_globs[section_ordering_glob_count].key
+	    = xstrdup (buf);
+	  section_ordering_globs[section_ordering_glob_count++].rank = rank;
+	}
+      else
+	section_ordering_add (section_ordering_names, xstrdup (buf), rank);
+      rank++;
+    }
+
+  free (buf);
+  fclose (file);
+}
+
+/* Note the sections that define the symbols named in the ordering
+   file.  Called via htab_traverse.  */
+
+static int
+section_ordering_find_symbol (void **slot, void *data ATTRIBUTE_UNUSED)
+{
+  const struct section_ordering_entry *e = *slot;
+  struct bfd_link_hash_entry *h;
+
+  h = bfd_link_hash_lookup (link_info.hash, e->key, false, false, true);
+  if (h != NULL
+      && (h->type == bfd_link_hash_defined
+	  || h->type == bfd_link_hash_defweak)
+      && h->u.def.section->owner != link_info.output_bfd
+      && !bfd_is_abs_section (h->u.def.section))
+    section_ordering_add (section_ordering_sections, h->u.def.section,
+			  e->rank);
+  return 1;
+}
+
+/* Return the rank of input section SEC in the ordering file, or
+   UINT_MAX if no entry matches it.  */
+
+static unsigned int
+section_ordering_rank (asection *sec)
+{
+  struct section_ordering_entry e, *found;
+  unsigned int rank = UINT_MAX;
+  size_t i;
+
+  e.key = sec->name;
+  found = htab_find (section_ordering_names, &e);
+  if (found != NULL)
+    rank = found->rank;
+
+  e.key = sec;
+  found = htab_find (section_ordering_sections, &e);
+  if (found != NULL && found->rank < rank)
+    rank = found->rank;
+
+  for (i = 0;
+       i < section_ordering_glob_count
+       && section_ordering_globs[i].rank < rank;
+       i++)
+    if (fnmatch (section_ordering_globs[i].key, sec->name, 0) == 0)
+      {
+	rank = section_ordering_globs[i].rank;
+	break;
+      }
+
+  return rank;
+}
+
+/* An input section statement taken out of its list to be reordered.  */
+
+struct ordered_section
+{
+  lang_statement_union_type *s;
+  unsigned int rank;
+  size_t seq;
+};
+
+static int
+ordered_section_cmp (const void *a, const void *b)
+{
+  const struct ordered_section *oa = a;
+  const struct ordered_section *ob = b;
+
+  if (oa->rank != ob->rank)
+    return oa->rank < ob->rank ? -1 : 1;
+  return oa->seq < ob->seq ? -1 : oa->seq > ob->seq;
+}
+
+/* Remove the input sections of LIST, and of the wild statements in
+   it, that match the ordering file, appending them to *VEC.  */
+
+static void
+section_ordering_extract (lang_statement_list_type *list,
+			  struct ordered_section **vec, size_t *count,
+			  size_t *alloc)
+{
+  lang_statement_union_type **pp = &list->head;
+
+  while (*pp != NULL)
+    {
+      lang_statement_union_type *s = *pp;
+
+      if (s->header.type == lang_input_section_enum)
+	{
+	  unsigned int rank = section_ordering_rank (s->input_section.section);
+
+	  if (rank != UINT_MAX)
+	    {
+	      if (*count == *alloc)
+		{
+		  *alloc = *alloc ? *alloc * 2 : 64;
+		  *vec = xrealloc (*vec, *alloc * sizeof (**vec));
+		}
+	      (*vec)[*count].s = s;
+	      (*vec)[*count].rank = rank;
+	      (*vec)[*count].seq = section_ordering_seq++;
+	      ++*count;
+	      *pp = s->header.next;
+	      continue;
+	    }
+	}
+      else if (s->header.type == lang_wild_statement_enum)
+	section_ordering_extract (&s->wild_statement.children,
+				  vec, count, alloc);
+      pp = &s->header.next;
+    }
+  list->tail = pp;
+}
+
+/* Apply the --section-ordering-file.  */
+
+static void
+lang_order_sections_from_file (void)
+{
+  lang_output_section_statement_type *os;
+  struct ordered_section *vec = NULL;
+  size_t alloc = 0;
+
+  if (command_line.section_ordering_file == NULL)
+    return;
+
+  section_ordering_read (command_line.section_ordering_file);
+  htab_traverse (section_ordering_names, section_ordering_find_symbol, NULL);
+
+  for (os = (void *) lang_os_list.head; os != NULL; os = os->next)
+    {
+      lang_statement_union_type **pp, *s;
+      size_t count = 0, i;
+
+      if (os->constraint < 0 || os->bfd_section == NULL)
+	continue;
+
+      section_ordering_extract (&os->children, &vec, &count, &alloc);
+      if (count == 0)
+	continue;
+      qsort (vec, count, sizeof (*vec), ordered_section_cmp);
+
+      /* Put the sections before the first statement that adds input
+	 sections, after any leading assignments.  */
+      for (pp = &os->children.head; (s = *pp) != NULL; pp = &s->header.next)
+	if (s->header.type == lang_wild_statement_enum
+	    || s->header.type == lang_input_section_enum)
+	  break;
+
+      for (i = 0; i < count; i++)
+	{
+	  vec[i].s->header.next = *pp;
+	  *pp = vec[i].s;
+	  pp = &vec[i].s->header.next;
+	}
+      if (s == NULL)
+	os->children.tail = pp;
+    }
+
+  free (vec);
 }
 
 void
@@ -7673,6 +8119,29 @@ lang_gc_sections_1 (lang_statement_union_type *s)
     }
 }
 
+/* Return the number of input sections marked SEC_EXCLUDE, and set
+   *TOTAL to the number of input sections, for --stats.  */
+
+static unsigned long
+count_excluded_sections (unsigned long *total)
+{
+  unsigned long excluded = 0;
+
+  *total = 0;
+  LANG_FOR_EACH_INPUT_STATEMENT (f)
+    {
+      asection *sec;
+
+      for (sec = f->the_bfd->sections; sec != NULL; sec = sec->next)
+	{
+	  ++*total;
+	  if ((sec->flags & SEC_EXCLUDE) != 0)
+	    ++excluded;
+	}
+    }
+  return excluded;
+}
+
 static void
 lang_gc_sections (void)
 {
@@ -7699,7 +8168,70 @@ lang_gc_sections (void)
     }
 
   if (link_info.gc_sections)
-    bfd_gc_sections (link_info.output_bfd, &link_info);
+    {
+      unsigned long total = 0, excluded = 0;
+      long run_time = 0;
+
+      if (config.stats)
+	{
+	  excluded = count_excluded_sections (&total);
+	  run_time = get_run_time ();
+	}
+      bfd_gc_sections (link_info.output_bfd, &link_info);
+      if (config.stats)
+	{
+	  run_time = get_run_time () - run_time;
+	  excluded = count_excluded_sections (&total) - excluded;
+	  fflush (stdout);
+	  fprintf (stderr, _("%s: gc-sections: removed %lu of %lu input "
+			     "sections, time %ld.%06ld\n"),
+		   program_name, excluded, total,
+		   run_time / 1000000, run_time % 1000000);
+	  fflush (stderr);
+	}
+    }
+}
+
+/* Fold identical input sections if asked to.  This runs after section
+   garbage collection, so only live sections are compared, and before
+   relocations are checked, so that folded sections do not allocate
+   GOT, PLT or dynamic relocation entries.  */
+
+static void
+lang_icf_sections (void)
+{
+  unsigned long total = 0, excluded = 0;
+  long run_time = 0;
+
+  if (link_info.icf == icf_none)
+    return;
+
+  if (bfd_link_relocatable (&link_info)
+      || !is_elf_hash_table (link_info.hash)
+      || !link_info.check_relocs_after_open_input)
+    {
+      einfo (_("%P: warning: --icf ignored for this link\n"));
+      return;
+    }
+
+  if (config.stats)
+    {
+      excluded = count_excluded_sections (&total);
+      run_time = get_run_time ();
+    }
+  if (!bfd_elf_icf_sections (link_info.output_bfd, &link_info))
+    einfo (_("%F%P: identical code folding failed: %E\n"));
+  if (config.stats)
+    {
+      run_time = get_run_time () - run_time;
+      excluded = count_excluded_sections (&total) - excluded;
+      fflush (stdout);
+      fprintf (stderr, _("%s: icf: folded %lu of %lu input "
+			 "sections, time %ld.%06ld\n"),
+	       program_name, excluded, total,
+	       run_time / 1000000, run_time % 1000000);
+      fflush (stderr);
+    }
 }
 
 /* Worker for lang_find_relro_sections_1.  */
@@ -8039,6 +8571,35 @@ lang_propagate_lma_regions (void)
     }
 }
 
+/* Report the effect of merging SEC_MERGE sections for --stats,
+   along with the time RUN_TIME (in microseconds) it took.  */
+
+static void
+print_merge_stats (long run_time)
+{
+  bfd_size_type before = 0, after = 0;
+
+  LANG_FOR_EACH_INPUT_STATEMENT (f)
+    {
+      asection *s;
+
+      for (s = f->the_bfd->sections; s != NULL; s = s->next)
+	if (s->sec_info_type == SEC_INFO_TYPE_MERGE)
+	  {
+	    before += s->rawsize;
+	    if ((s->flags & SEC_EXCLUDE) == 0)
+	      after += s->size;
+	  }
+    }
+
+  fflush (stdout);
+  fprintf (stderr, _("%s: merged sections: %" BFD_VMA_FMT "u bytes in, %"
+		     BFD_VMA_FMT "u bytes out, time %ld.%06ld\n"),
+	   program_name, before, after,
+	   run_time / 1000000, run_time % 1000000);
+  fflush (stderr);
+}
+
 void
 lang_process (void)
 {
@@ -8245,6 +8806,9 @@ lang_process (void)
   /* Remove unreferenced sections if asked to.  */
   lang_gc_sections ();
 
+  /* Fold identical sections if asked to.  */
+  lang_icf_sections ();
+
   lang_mark_undefineds ();
 
   /* Check relocations.  */
@@ -8269,15 +8833,23 @@ lang_process (void)
   /* Find any sections not attached explicitly and handle them.  */
   lang_place_orphans ();
 
+  /* Put sections named in --section-ordering-file first.  */
+  lang_order_sections_from_file ();
+
   if (!bfd_link_relocatable (&link_info))
     {
       asection *found;
+      long merge_time = 0;
 
       /* Merge SEC_MERGE sections.  This has to be done after GC of
 	 sections, so that GCed sections are not merged, but before
 	 assigning dynamic symbols, since removing whole input sections
 	 is hard then.  */
+      if (config.stats)
+	merge_time = get_run_time ();
       bfd_merge_sections (link_info.output_bfd, &link_info);
+      if (config.stats)
+	print_merge_stats (get_run_time () - merge_time);
 
       /* Look for a text section and set the readonly attribute in it.  */
       found = bfd_get_section_by_name (link_info.output_bfd, ".text");
@@ -8374,6 +8946,7 @@ lang_add_wild (struct wildcard_spec *filespec,
     {
       next = curr->next;
       curr->next = section_list;
+      init_spec_match (&curr->spec);
     }
 
   if (filespec != NULL && filespec->name != NULL)
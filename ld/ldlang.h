@@ -335,16 +335,17 @@ typedef struct
 
 struct map_symbol_def {
   struct bfd_link_hash_entry *entry;
-  struct map_symbol_def *next;
+  /* Order of the symbol in the hash table, to keep sorting stable.  */
+  unsigned long index;
 };
 
-/* For input sections, when writing a map file: head / tail of a linked
-   list of hash table entries for symbols defined in this section.  */
+/* For input sections, when writing a map file: the hash table entries
+   for symbols defined in this section, sorted by value.  The entries
+   are part of one array covering all input sections.  */
 typedef struct input_section_userdata_struct
 {
-  struct map_symbol_def *map_symbol_def_head;
-  struct map_symbol_def **map_symbol_def_tail;
-  unsigned long map_symbol_def_count;
+  struct map_symbol_def *map_symbols;
+  unsigned long map_symbol_count;
 } input_section_userdata_type;
 
 static inline bool
@@ -141,6 +141,7 @@ enum option_values
   OPTION_WARN_ALTERNATE_EM,
   OPTION_REDUCE_MEMORY_OVERHEADS,
   OPTION_MAX_CACHE_SIZE,
+  OPTION_RELOC_CACHE_SIZE,
 #if BFD_SUPPORTS_PLUGINS
   OPTION_PLUGIN,
   OPTION_PLUGIN_OPT,
@@ -168,6 +169,11 @@ enum option_values
   OPTION_NO_WARN_EXECSTACK,
   OPTION_WARN_RWX_SEGMENTS,
   OPTION_NO_WARN_RWX_SEGMENTS,
+  OPTION_INCREMENTAL,
+  OPTION_ICF,
+  OPTION_PRINT_ICF_SECTIONS,
+  OPTION_NO_PRINT_ICF_SECTIONS,
+  OPTION_SECTION_ORDERING_FILE,
 };
 
 /* The initial parser states.  */
@@ -490,6 +490,9 @@ main (int argc, char **argv)
 	      einfo (_("%F%P: cannot open map file %s: %E\n"),
 		     config.map_filename);
 	    }
+	  /* Map files of large links run to many megabytes, written a
+	     few bytes at a time.  Use a larger buffer than stdio's.  */
+	  setvbuf (config.map_file, NULL, _IOFBF, 1024 * 1024);
 	}
       link_info.has_map_file = true;
     }
@@ -508,6 +511,8 @@ main (int argc, char **argv)
       link_info.output_bfd->flags |= BFD_COMPRESS;
       if (link_info.compress_debug == COMPRESS_DEBUG_GABI_ZLIB)
 	link_info.output_bfd->flags |= BFD_COMPRESS_GABI;
+      else if (link_info.compress_debug == COMPRESS_DEBUG_ZSTD)
+	link_info.output_bfd->flags |= BFD_COMPRESS_GABI | BFD_COMPRESS_ZSTD;
     }
 
   ldwrite ();
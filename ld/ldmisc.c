@@ -667,13 +667,13 @@ lfinfo (FILE *file, const char *fmt, ...)
 void
 print_space (void)
 {
-  fprintf (config.map_file, " ");
+  putc (' ', config.map_file);
 }
 
 void
 print_nl (void)
 {
-  fprintf (config.map_file, "\n");
+  putc ('\n', config.map_file);
 }
 
 /* A more or less friendly abort message.  In ld.h abort is defined to
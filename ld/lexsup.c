@@ -204,6 +204,16 @@ static const struct ld_option ld_options[] =
   { {"no-map-whole-files", optional_argument, NULL, OPTION_IGNORE},
     '\0', NULL, N_("Ignored for gold option compatibility"),
     TWO_DASHES },
+  { {"incremental", no_argument, NULL, OPTION_INCREMENTAL},
+    '\0', NULL, N_("Accepted for gold option compatibility; always does"
+		   " a full link"), TWO_DASHES },
+  { {"incremental-full", no_argument, NULL, OPTION_INCREMENTAL},
+    '\0', NULL, NULL, TWO_DASHES },
+  { {"incremental-update", no_argument, NULL, OPTION_INCREMENTAL},
+    '\0', NULL, NULL, TWO_DASHES },
+  { {"no-incremental", no_argument, NULL, OPTION_IGNORE},
+    '\0', NULL, N_("Ignored for gold option compatibility"),
+    TWO_DASHES },
   { {"Qy", no_argument, NULL, OPTION_IGNORE},
     '\0', NULL, N_("Ignored for SVR4 compatibility"), ONE_DASH },
   { {"emit-relocs", no_argument, NULL, 'q'},
@@ -360,6 +370,16 @@ static const struct ld_option ld_options[] =
   { {"no-print-gc-sections", no_argument, NULL, OPTION_NO_PRINT_GC_SECTIONS},
     '\0', NULL, N_("Do not list removed unused sections"),
     TWO_DASHES },
+  { {"icf", required_argument, NULL, OPTION_ICF},
+    '\0', N_("[none|safe|all]"),
+    N_("Fold identical code sections (on some targets)"), TWO_DASHES },
+  { {"print-icf-sections", no_argument, NULL, OPTION_PRINT_ICF_SECTIONS},
+    '\0', NULL, N_("List folded identical sections on stderr"),
+    TWO_DASHES },
+  { {"no-print-icf-sections", no_argument, NULL,
+     OPTION_NO_PRINT_ICF_SECTIONS},
+    '\0', NULL, N_("Do not list folded identical sections"),
+    TWO_DASHES },
   { {"gc-keep-exported", no_argument, NULL, OPTION_GC_KEEP_EXPORTED},
     '\0', NULL, N_("Keep exported symbols when removing unused sections"),
     TWO_DASHES },
@@ -438,6 +458,11 @@ static const struct ld_option ld_options[] =
     OPTION_MAX_CACHE_SIZE},
     '\0', NULL, N_("Set the maximum cache size to SIZE bytes"),
     TWO_DASHES },
+  { {"reloc-cache-size=SIZE", required_argument, NULL,
+    OPTION_RELOC_CACHE_SIZE},
+    '\0', NULL, N_("Cache up to SIZE bytes of relocations that are not\n"
+		    "                                kept in memory"),
+    TWO_DASHES },
   { {"relax", no_argument, NULL, OPTION_RELAX},
     '\0', NULL, N_("Reduce code size by using target specific optimizations"), TWO_DASHES },
   { {"no-relax", no_argument, NULL, OPTION_NO_RELAX},
@@ -466,6 +491,11 @@ static const struct ld_option ld_options[] =
     TWO_DASHES },
   { {"sort_common", no_argument, NULL, OPTION_SORT_COMMON},
     '\0', NULL, NULL, NO_HELP },
+  { {"section-ordering-file", required_argument, NULL,
+     OPTION_SECTION_ORDERING_FILE},
+    '\0', N_("FILE"),
+    N_("Place the input sections or symbols listed in FILE first"),
+    TWO_DASHES },
   { {"sort-section", required_argument, NULL, OPTION_SORT_SECTION},
     '\0', N_("name|alignment"),
     N_("Sort sections by name or maximum alignment"), TWO_DASHES },
@@ -817,6 +847,16 @@ parse_args (unsigned argc, char **argv)
 
 	case OPTION_IGNORE:
 	  break;
+	case OPTION_INCREMENTAL:
+	  {
+	    static bool warned;
+
+	    if (!warned)
+	      einfo (_("%P: warning: incremental linking is not supported;"
+		       " doing a full link\n"));
+	    warned = true;
+	  }
+	  break;
 	case 'a':
 	  /* For HP/UX compatibility.  Actually -a shared should mean
 	     ``use only shared libraries'' but, then, we don't
@@ -987,6 +1027,22 @@ parse_args (unsigned argc, char **argv)
 	case OPTION_GC_KEEP_EXPORTED:
 	  link_info.gc_keep_exported = true;
 	  break;
+	case OPTION_ICF:
+	  if (strcmp (optarg, "none") == 0)
+	    link_info.icf = icf_none;
+	  else if (strcmp (optarg, "safe") == 0)
+	    link_info.icf = icf_safe;
+	  else if (strcmp (optarg, "all") == 0)
+	    link_info.icf = icf_all;
+	  else
+	    einfo (_("%F%P: invalid argument to option \"--icf\"\n"));
+	  break;
+	case OPTION_PRINT_ICF_SECTIONS:
+	  link_info.print_icf_sections = true;
+	  break;
+	case OPTION_NO_PRINT_ICF_SECTIONS:
+	  link_info.print_icf_sections = false;
+	  break;
 	case OPTION_HELP:
 	  help ();
 	  xexit (0);
@@ -1321,6 +1377,12 @@ parse_args (unsigned argc, char **argv)
 	    einfo (_("%F%P: invalid common section sorting option: %s\n"),
 		   optarg);
 	  break;
+	case OPTION_SECTION_ORDERING_FILE:
+	  if (command_line.section_ordering_file != NULL)
+	    einfo (_("%P: warning: more than one section ordering file "
+		     "given; using %s\n"), optarg);
+	  command_line.section_ordering_file = optarg;
+	  break;
 	case OPTION_SORT_SECTION:
 	  if (strcmp (optarg, N_("name")) == 0)
 	    sort_section = by_name;
@@ -1667,6 +1729,17 @@ parse_args (unsigned argc, char **argv)
 	  }
 	  break;
 
+	case OPTION_RELOC_CACHE_SIZE:
+	  {
+	    char *end;
+	    bfd_size_type cache_size = strtoul (optarg, &end, 0);
+	    if (*end != '\0')
+	      einfo (_("%F%P: invalid cache memory size: %s\n"),
+		     optarg);
+	    link_info.reloc_cache_size = cache_size;
+	  }
+	  break;
+
 	case OPTION_HASH_SIZE:
 	  {
 	    bfd_size_type new_size;
@@ -2146,8 +2219,8 @@ elf_static_list_options (FILE *file)
   fprintf (file, _("\
   --package-metadata[=JSON]   Generate package metadata note\n"));
   fprintf (file, _("\
-  --compress-debug-sections=[none|zlib|zlib-gnu|zlib-gabi]\n\
-                              Compress DWARF debug sections using zlib\n"));
+  --compress-debug-sections=[none|zlib|zlib-gnu|zlib-gabi|zstd]\n\
+                              Compress DWARF debug sections\n"));
 #ifdef DEFAULT_FLAG_COMPRESS_DEBUG
   fprintf (file, _("\
                                 Default: zlib-gabi\n"));
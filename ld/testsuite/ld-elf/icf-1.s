@@ -0,0 +1,14 @@
+	.section .text.f1,"ax","progbits"
+	.globl f1
+f1:
+	.byte 1, 2, 3, 4, 5, 6, 7, 8
+
+	.section .text.f2,"ax","progbits"
+	.globl f2
+f2:
+	.byte 1, 2, 3, 4, 5, 6, 7, 8
+
+	.section .text.f3,"ax","progbits"
+	.globl f3
+f3:
+	.byte 1, 2, 3, 4, 5, 6, 7, 9
@@ -0,0 +1,14 @@
+	.section .text._ZN1AC2Ev,"ax","progbits"
+	.globl _ZN1AC2Ev
+_ZN1AC2Ev:
+	.byte 1, 2, 3, 4, 5, 6, 7, 8
+
+	.section .text._ZN1BC2Ev,"ax","progbits"
+	.globl _ZN1BC2Ev
+_ZN1BC2Ev:
+	.byte 1, 2, 3, 4, 5, 6, 7, 8
+
+	.section .text.f1,"ax","progbits"
+	.globl f1
+f1:
+	.byte 1, 2, 3, 4, 5, 6, 7, 8
@@ -0,0 +1,23 @@
+	.section .data.a,"aw"
+	.globl data_a
+data_a:
+	.dc.a data_b
+	.dc.a data_c
+	.dc.a _start
+
+	.section .data.b,"aw"
+	.globl data_b
+data_b:
+	.dc.a data_a
+	.dc.a data_c
+
+	.section .data.c,"aw"
+	.globl data_c
+data_c:
+	.dc.a data_a
+	.dc.a data_b
+
+	.section .data.unused,"aw"
+unused:
+	.dc.a data_a
+	.dc.a unused
@@ -173,6 +173,20 @@ extern int backtrace_pcinfo (struct backtrace_state *state, uintptr_t pc,
 			     backtrace_error_callback error_callback,
 			     void *data);
 
+/* Read the file/line information for the current program now, rather
+   than on demand.  backtrace_pcinfo and backtrace_full normally read
+   the debug information for a compilation unit the first time a PC
+   in that unit is looked up, which can take a long time for a large
+   program.  A program that wants to symbolize a backtrace from a
+   signal handler can call this once at startup, so that later
+   lookups only have to search tables that have already been built.
+   This will call ERROR_CALLBACK for any errors; it returns 1 on
+   success, 0 on failure.  */
+
+extern int backtrace_pcinfo_preload (struct backtrace_state *state,
+				     backtrace_error_callback error_callback,
+				     void *data);
+
 /* The type of the callback argument to backtrace_syminfo.  DATA and
    PC are the arguments passed to backtrace_syminfo.  SYMNAME is the
    name of the symbol for the corresponding code.  SYMVAL is the
@@ -3621,6 +3621,66 @@ report_inlined_functions (uintptr_t pc, struct function *function,
   return 0;
 }
 
+/* Read the line number and function information for U, and store it
+   into U.  Return the new value of U->LINES, which is -1 if the
+   information could not be read.  */
+
+static struct line *
+read_unit_lines (struct backtrace_state *state, struct dwarf_data *ddata,
+		 struct unit *u, backtrace_error_callback error_callback,
+		 void *data)
+{
+  struct function_addrs *function_addrs;
+  size_t function_addrs_count;
+  struct line_header lhdr;
+  struct line *lines;
+  size_t count;
+
+  function_addrs = NULL;
+  function_addrs_count = 0;
+  if (read_line_info (state, ddata, error_callback, data, u, &lhdr,
+		      &lines, &count))
+    {
+      struct function_vector *pfvec;
+
+      /* If not threaded, reuse DDATA->FVEC for better memory
+	 consumption.  */
+      if (state->threaded)
+	pfvec = NULL;
+      else
+	pfvec = &ddata->fvec;
+      read_function_info (state, ddata, &lhdr, error_callback, data,
+			  u, pfvec, &function_addrs,
+			  &function_addrs_count);
+      free_line_header (state, &lhdr, error_callback, data);
+    }
+
+  /* Atomically store the information we just read into the unit.
+     If another thread is simultaneously writing, it presumably read
+     the same information, and we don't care which one we wind up
+     with; we just leak the other one.  We do have to write the lines
+     field last, so that the acquire-loads in dwarf_lookup_pc ensure
+     that the other fields are set.  */
+
+  if (!state->threaded)
+    {
+      u->lines_count = count;
+      u->function_addrs = function_addrs;
+      u->function_addrs_count = function_addrs_count;
+      u->lines = lines;
+    }
+  else
+    {
+      backtrace_atomic_store_size_t (&u->lines_count, count);
+      backtrace_atomic_store_pointer (&u->function_addrs, function_addrs);
+      backtrace_atomic_store_size_t (&u->function_addrs_count,
+				     function_addrs_count);
+      backtrace_atomic_store_pointer (&u->lines, lines);
+    }
+
+  return lines;
+}
+
 /* Look for a PC in the DWARF mapping for one module.  On success,
    call CALLBACK and return whatever it returns.  On error, call
    ERROR_CALLBACK and return 0.  Sets *FOUND to 1 if the PC is found,
@@ -3722,56 +3782,11 @@ dwarf_lookup_pc (struct backtrace_state *state, struct dwarf_data *ddata,
   new_data = 0;
   if (lines == NULL)
     {
-      struct function_addrs *function_addrs;
-      size_t function_addrs_count;
-      struct line_header lhdr;
-      size_t count;
-
       /* We have never read the line information for this unit.  Read
 	 it now.  */
-
-      function_addrs = NULL;
-      function_addrs_count = 0;
-      if (read_line_info (state, ddata, error_callback, data, entry->u, &lhdr,
-			  &lines, &count))
-	{
-	  struct function_vector *pfvec;
-
-	  /* If not threaded, reuse DDATA->FVEC for better memory
-	     consumption.  */
-	  if (state->threaded)
-	    pfvec = NULL;
-	  else
-	    pfvec = &ddata->fvec;
-	  read_function_info (state, ddata, &lhdr, error_callback, data,
-			      entry->u, pfvec, &function_addrs,
-			      &function_addrs_count);
-	  free_line_header (state, &lhdr, error_callback, data);
-	  new_data = 1;
-	}
-
-      /* Atomically store the information we just read into the unit.
-	 If another thread is simultaneously writing, it presumably
-	 read the same information, and we don't care which one we
-	 wind up with; we just leak the other one.  We do have to
-	 write the lines field last, so that the acquire-loads above
-	 ensure that the other fields are set.  */
-
-      if (!state->threaded)
-	{
-	  u->lines_count = count;
-	  u->function_addrs = function_addrs;
-	  u->function_addrs_count = function_addrs_count;
-	  u->lines = lines;
-	}
-      else
-	{
-	  backtrace_atomic_store_size_t (&u->lines_count, count);
-	  backtrace_atomic_store_pointer (&u->function_addrs, function_addrs);
-	  backtrace_atomic_store_size_t (&u->function_addrs_count,
-					 function_addrs_count);
-	  backtrace_atomic_store_pointer (&u->lines, lines);
-	}
+      lines = read_unit_lines (state, ddata, u, error_callback, data);
+      if (lines != (struct line *) (uintptr_t) -1)
+	new_data = 1;
     }
 
   /* Now all fields of U have been initialized.  */
@@ -4054,3 +4069,59 @@ backtrace_dwarf_add (struct backtrace_state *state,
 
   return 1;
 }
+
+/* Read the line number and function information for every
+   compilation unit of every module that backtrace_dwarf_add has
+   seen, so that later lookups do not have to.  Return 1 on success,
+   0 on failure.  */
+
+int
+backtrace_dwarf_preload (struct backtrace_state *state,
+			 backtrace_error_callback error_callback,
+			 void *data)
+{
+  fileline fileline_fn;
+  struct dwarf_data **pp;
+
+  if (!state->threaded)
+    fileline_fn = state->fileline_fn;
+  else
+    fileline_fn = backtrace_atomic_load_pointer (&state->fileline_fn);
+
+  /* The fileline data only holds a list of dwarf_data if we are the
+     ones who set it up.  */
+  if (fileline_fn != dwarf_fileline)
+    return 1;
+
+  pp = (struct dwarf_data **) (void *) &state->fileline_data;
+  while (1)
+    {
+      struct dwarf_data *ddata;
+      size_t i;
+
+      if (!state->threaded)
+	ddata = *pp;
+      else
+	ddata = backtrace_atomic_load_pointer (pp);
+      if (ddata == NULL)
+	break;
+
+      for (i = 0; i < ddata->units_count; ++i)
+	{
+	  struct unit *u;
+	  struct line *lines;
+
+	  u = ddata->units[i];
+	  if (!state->threaded)
+	    lines = u->lines;
+	  else
+	    lines = backtrace_atomic_load_pointer (&u->lines);
+	  if (lines == NULL)
+	    read_unit_lines (state, ddata, u, error_callback, data);
+	}
+
+      pp = &ddata->next;
+    }
+
+  return 1;
+}
@@ -301,6 +301,21 @@ backtrace_pcinfo (struct backtrace_state *state, uintptr_t pc,
   return state->fileline_fn (state, pc, callback, error_callback, data);
 }
 
+/* Read all the file/line information now.  */
+
+int
+backtrace_pcinfo_preload (struct backtrace_state *state,
+			  backtrace_error_callback error_callback, void *data)
+{
+  if (!fileline_initialize (state, error_callback, data))
+    return 0;
+
+  if (state->fileline_initialization_failed)
+    return 0;
+
+  return backtrace_dwarf_preload (state, error_callback, data);
+}
+
 /* Given a PC, find the symbol for it, and its value.  */
 
 int
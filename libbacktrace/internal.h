@@ -334,6 +334,13 @@ extern int backtrace_dwarf_add (struct backtrace_state *state,
 				void *data, fileline *fileline_fn,
 				struct dwarf_data **fileline_entry);
 
+/* Read all the line number information that backtrace_dwarf_add
+   deferred.  */
+
+extern int backtrace_dwarf_preload (struct backtrace_state *state,
+				    backtrace_error_callback error_callback,
+				    void *data);
+
 /* A data structure to pass to backtrace_syminfo_to_full.  */
 
 struct backtrace_call_full
@@ -21,6 +21,7 @@
 #include <string.h>
 #include <errno.h>
 #include <assert.h>
+#include <time.h>
 #include "hashtab.h"
 
 /* (In the below, relevant functions are named in square brackets.)  */
@@ -465,24 +466,285 @@ ctf_decorate_type_name (ctf_dict_t *fp, const char *name, int kind)
   return NULL;
 }
 
+/* Type hashing.
+
+   Types are identified by the SHA-1 of a description of their content, unless
+   the link flags ask for CTF_LINK_FAST_HASH, in which case the description is
+   accumulated in a buffer and hashed in one go by ctf_dedup_hash_fini, using a
+   128-bit variant of MurmurHash3.  That hash is much cheaper, but it is not
+   collision-resistant, so the description behind every distinct hash value is
+   kept in cd_hash_inputs: if two different descriptions hash to the same value,
+   the later one is rehashed with different seeds until it finds a value of its
+   own.  Equal descriptions always end up with the same value.  */
+
+typedef struct ctf_dedup_hash
+{
+  ctf_sha1_t cdh_sha1;		/* SHA-1 state, if not CTF_LINK_FAST_HASH.  */
+  int cdh_fast;			/* Nonzero if CTF_LINK_FAST_HASH.  */
+  int cdh_err;			/* Allocation failure while adding.  */
+  unsigned char *cdh_buf;	/* Description, if CTF_LINK_FAST_HASH.  */
+  size_t cdh_len;		/* Length of description.  */
+  size_t cdh_size;		/* Allocated size of cdh_buf.  */
+  unsigned char cdh_inline_buf[256]; /* Initial cdh_buf.  */
+} ctf_dedup_hash_t;
+
+/* The description a fast hash value was computed from: the values of
+   cd_hash_inputs.  */
+typedef struct ctf_dedup_hash_input
+{
+  size_t cdhi_len;
+  unsigned char cdhi_data[];
+} ctf_dedup_hash_input_t;
+
+static inline uint64_t
+ctf_dedup_rotl64 (uint64_t x, int r)
+{
+  return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t
+ctf_dedup_fmix64 (uint64_t k)
+{
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+  k *= 0xc4ceb9fe1a85ec53ULL;
+  k ^= k >> 33;
+  return k;
+}
+
+/* Hash LEN bytes at DATA with SEED into the 128-bit HASH, using the algorithm
+   of MurmurHash3_x64_128.  The input is read in host byte order, which is
+   harmless, since the description being hashed is in host byte order
+   anyway.  */
+
+static void
+ctf_dedup_fast_hash (const unsigned char *data, size_t len, uint32_t seed,
+		     uint64_t hash[2])
+{
+  const uint64_t c1 = 0x87c37b91114253d5ULL;
+  const uint64_t c2 = 0x4cf5ad432745937fULL;
+  uint64_t h1 = seed, h2 = seed;
+  uint64_t k1, k2;
+  size_t i;
+
+  for (i = 0; i + 16 <= len; i += 16)
+    {
+      memcpy (&k1, data + i, sizeof (k1));
+      memcpy (&k2, data + i + 8, sizeof (k2));
+
+      k1 *= c1; k1 = ctf_dedup_rotl64 (k1, 31); k1 *= c2; h1 ^= k1;
+      h1 = ctf_dedup_rotl64 (h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+      k2 *= c2; k2 = ctf_dedup_rotl64 (k2, 33); k2 *= c1; h2 ^= k2;
+      h2 = ctf_dedup_rotl64 (h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+    }
+
+  /* The tail is zero-padded, which is equivalent to the byte-at-a-time tail
+     handling of the original on little-endian hosts.  */
+  if (i < len)
+    {
+      unsigned char tail[16] = { 0 };
+
+      memcpy (tail, data + i, len - i);
+      memcpy (&k1, tail, sizeof (k1));
+      memcpy (&k2, tail + 8, sizeof (k2));
+
+      k2 *= c2; k2 = ctf_dedup_rotl64 (k2, 33); k2 *= c1; h2 ^= k2;
+      k1 *= c1; k1 = ctf_dedup_rotl64 (k1, 31); k1 *= c2; h1 ^= k1;
+    }
+
+  h1 ^= len;
+  h2 ^= len;
+  h1 += h2;
+  h2 += h1;
+  h1 = ctf_dedup_fmix64 (h1);
+  h2 = ctf_dedup_fmix64 (h2);
+  h1 += h2;
+  h2 += h1;
+
+  hash[0] = h1;
+  hash[1] = h2;
+}
+
+/* Format a fast hash value as a hex string in BUF, which must have room for
+   at least 33 characters.  */
+
+static void
+ctf_dedup_fast_hash_str (const uint64_t hash[2], char *buf)
+{
+  static const char hex[] = "0123456789abcdef";
+  size_t i, j;
+
+  for (i = 0; i < 2; i++)
+    for (j = 0; j < 16; j++)
+      buf[i * 16 + j] = hex[(hash[i] >> (60 - j * 4)) & 0xf];
+  buf[32] = '\0';
+}
+
+static void
+ctf_dedup_hash_init (ctf_dict_t *fp, ctf_dedup_hash_t *hash)
+{
+  hash->cdh_fast = (fp->ctf_dedup.cd_link_flags & CTF_LINK_FAST_HASH) != 0;
+  hash->cdh_err = 0;
+  if (hash->cdh_fast)
+    {
+      hash->cdh_buf = hash->cdh_inline_buf;
+      hash->cdh_len = 0;
+      hash->cdh_size = sizeof (hash->cdh_inline_buf);
+    }
+  else
+    ctf_sha1_init (&hash->cdh_sha1);
+}
+
+/* Throw away a hash in progress.  Harmless on a hash that is already
+   finished or discarded.  */
+
+static void
+ctf_dedup_hash_discard (ctf_dedup_hash_t *hash)
+{
+  if (!hash->cdh_fast)
+    ctf_sha1_fini (&hash->cdh_sha1, NULL);
+  else if (hash->cdh_buf != hash->cdh_inline_buf)
+    {
+      free (hash->cdh_buf);
+      hash->cdh_buf = hash->cdh_inline_buf;
+    }
+}
+
 /* Hash a type, possibly debugging-dumping something about it as well.  */
 static inline void
-ctf_dedup_sha1_add (ctf_sha1_t *sha1, const void *buf, size_t len,
+ctf_dedup_hash_add (ctf_dedup_hash_t *hash, const void *buf, size_t len,
 		    const char *description _libctf_unused_,
 		    unsigned long depth _libctf_unused_)
 {
-  ctf_sha1_add (sha1, buf, len);
+  if (!hash->cdh_fast)
+    ctf_sha1_add (&hash->cdh_sha1, buf, len);
+  else if (!hash->cdh_err)
+    {
+      if (hash->cdh_len + len > hash->cdh_size)
+	{
+	  size_t size = hash->cdh_size;
+	  unsigned char *nbuf;
+
+	  while (hash->cdh_len + len > size)
+	    size *= 2;
+
+	  if (hash->cdh_buf == hash->cdh_inline_buf)
+	    {
+	      if ((nbuf = malloc (size)) != NULL)
+		memcpy (nbuf, hash->cdh_buf, hash->cdh_len);
+	    }
+	  else
+	    nbuf = realloc (hash->cdh_buf, size);
+
+	  if (nbuf == NULL)
+	    {
+	      hash->cdh_err = ENOMEM;
+	      return;
+	    }
+	  hash->cdh_buf = nbuf;
+	  hash->cdh_size = size;
+	}
+      memcpy (hash->cdh_buf + hash->cdh_len, buf, len);
+      hash->cdh_len += len;
+    }
 
 #ifdef ENABLE_LIBCTF_HASH_DEBUGGING
-  ctf_sha1_t tmp;
   char tmp_hval[CTF_SHA1_SIZE];
-  tmp = *sha1;
-  ctf_sha1_fini (&tmp, tmp_hval);
+  if (!hash->cdh_fast)
+    {
+      ctf_sha1_t tmp;
+      tmp = hash->cdh_sha1;
+      ctf_sha1_fini (&tmp, tmp_hval);
+    }
+  else
+    {
+      uint64_t tmp[2];
+      ctf_dedup_fast_hash (hash->cdh_buf, hash->cdh_len, 0, tmp);
+      ctf_dedup_fast_hash_str (tmp, tmp_hval);
+    }
   ctf_dprintf ("%lu: after hash addition of %s: %s\n", depth, description,
 	       tmp_hval);
 #endif
 }
 
+/* Finish a hash, writing the hash value into BUF, which must be at least
+   CTF_SHA1_SIZE long.  Fast hashes are checked against cd_hash_inputs for
+   collisions, and rehashed if need be.  */
+
+static int
+ctf_dedup_hash_fini (ctf_dict_t *fp, ctf_dedup_hash_t *hash, char *buf)
+{
+  ctf_dedup_t *d = &fp->ctf_dedup;
+  ctf_dedup_hash_input_t *input;
+  uint32_t seed;
+  char *key;
+  int err;
+
+  if (!hash->cdh_fast)
+    {
+      ctf_sha1_fini (&hash->cdh_sha1, buf);
+      return 0;
+    }
+
+  if (hash->cdh_err)
+    {
+      err = hash->cdh_err;
+      goto err;
+    }
+
+  for (seed = 0;; seed++)
+    {
+      uint64_t hval[2];
+
+      ctf_dedup_fast_hash (hash->cdh_buf, hash->cdh_len, seed, hval);
+      ctf_dedup_fast_hash_str (hval, buf);
+
+      if ((input = ctf_dynhash_lookup (d->cd_hash_inputs, buf)) == NULL)
+	break;
+
+      if (input->cdhi_len == hash->cdh_len
+	  && memcmp (input->cdhi_data, hash->cdh_buf, hash->cdh_len) == 0)
+	{
+	  ctf_dedup_hash_discard (hash);
+	  return 0;
+	}
+
+      ctf_dprintf ("Hash collision on %s: rehashing.\n", buf);
+      fp->ctf_link_stats.cls_hash_collisions++;
+    }
+
+  /* A new hash value: record the description it came from.  */
+
+  err = ENOMEM;
+  if ((input = malloc (sizeof (ctf_dedup_hash_input_t)
+		       + hash->cdh_len)) == NULL)
+    goto err;
+  input->cdhi_len = hash->cdh_len;
+  memcpy (input->cdhi_data, hash->cdh_buf, hash->cdh_len);
+
+  if ((key = strdup (buf)) == NULL)
+    {
+      free (input);
+      goto err;
+    }
+
+  if (ctf_dynhash_insert (d->cd_hash_inputs, key, input) < 0)
+    {
+      free (key);
+      free (input);
+      goto err;
+    }
+
+  ctf_dedup_hash_discard (hash);
+  return 0;
+
+ err:
+  ctf_dedup_hash_discard (hash);
+  return ctf_set_errno (fp, err);
+}
+
 static const char *
 ctf_dedup_hash_type (ctf_dict_t *fp, ctf_dict_t *input,
 		     ctf_dict_t **inputs, uint32_t *parents,
@@ -567,7 +829,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 {
   ctf_dedup_t *d = &fp->ctf_dedup;
   ctf_next_t *i = NULL;
-  ctf_sha1_t hash;
+  ctf_dedup_hash_t hash;
   ctf_id_t child_type;
   char hashbuf[CTF_SHA1_SIZE];
   const char *hval = NULL;
@@ -604,12 +866,12 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 		   "stub with decorated name %s\n", decorated);
 
 #endif
-      ctf_sha1_init (&hash);
-      ctf_dedup_sha1_add (&hash, decorated, strlen (decorated) + 1,
+      ctf_dedup_hash_init (fp, &hash);
+      ctf_dedup_hash_add (&hash, decorated, strlen (decorated) + 1,
 			  "decorated struct/union/forward name", depth);
-      ctf_sha1_fini (&hash, hashbuf);
 
-      if ((hval = intern (fp, strdup (hashbuf))) == NULL)
+      if (ctf_dedup_hash_fini (fp, &hash, hashbuf) < 0
+	  || (hval = intern (fp, strdup (hashbuf))) == NULL)
 	{
 	  ctf_err_warn (fp, 0, 0, _("%s (%i): out of memory during forwarding-"
 				    "stub hashing for type with GID %p"),
@@ -669,10 +931,10 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
      *other types in the same TU* with the same name: so two types can easily
      have distinct nonroot flags, yet be exactly the same type.*/
 
-  ctf_sha1_init (&hash);
+  ctf_dedup_hash_init (fp, &hash);
   if (name)
-    ctf_dedup_sha1_add (&hash, name, strlen (name) + 1, "name", depth);
-  ctf_dedup_sha1_add (&hash, &kind, sizeof (uint32_t), "kind", depth);
+    ctf_dedup_hash_add (&hash, name, strlen (name) + 1, "name", depth);
+  ctf_dedup_hash_add (&hash, &kind, sizeof (uint32_t), "kind", depth);
 
   /* Hash content of this type.  */
   switch (kind)
@@ -683,7 +945,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
     case CTF_K_FORWARD:
 
       /* Add the forwarded kind, stored in the ctt_type.  */
-      ctf_dedup_sha1_add (&hash, &tp->ctt_type, sizeof (tp->ctt_type),
+      ctf_dedup_hash_add (&hash, &tp->ctt_type, sizeof (tp->ctt_type),
 			  "forwarded kind", depth);
       break;
     case CTF_K_INTEGER:
@@ -692,14 +954,14 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	ctf_encoding_t ep;
 	memset (&ep, 0, sizeof (ctf_encoding_t));
 
-	ctf_dedup_sha1_add (&hash, &tp->ctt_size, sizeof (uint32_t), "size",
+	ctf_dedup_hash_add (&hash, &tp->ctt_size, sizeof (uint32_t), "size",
 			    depth);
 	if (ctf_type_encoding (input, type, &ep) < 0)
 	  {
 	    whaterr = N_("error getting encoding");
 	    goto input_err;
 	  }
-	ctf_dedup_sha1_add (&hash, &ep, sizeof (ctf_encoding_t), "encoding",
+	ctf_dedup_hash_add (&hash, &ep, sizeof (ctf_encoding_t), "encoding",
 			    depth);
 	break;
       }
@@ -718,7 +980,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	  whaterr = N_("error doing referenced type hashing");
 	  goto err;
 	}
-      ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "referenced type",
+      ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "referenced type",
 			  depth);
       citer = hval;
 
@@ -738,7 +1000,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 
 	child_type = ctf_type_reference (input, type);
 	ctf_get_ctt_size (input, tp, &size, &increment);
-	ctf_dedup_sha1_add (&hash, &size, sizeof (ssize_t), "size", depth);
+	ctf_dedup_hash_add (&hash, &size, sizeof (ssize_t), "size", depth);
 
 	if ((hval = ctf_dedup_hash_type (fp, input, inputs, parents, input_num,
 					 child_type, flags, depth,
@@ -747,7 +1009,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	    whaterr = N_("error doing slice-referenced type hashing");
 	    goto err;
 	  }
-	ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "sliced type",
+	ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "sliced type",
 			    depth);
 	citer = hval;
 
@@ -756,9 +1018,9 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	else
 	  slice = (ctf_slice_t *) ((uintptr_t) tp + increment);
 
-	ctf_dedup_sha1_add (&hash, &slice->cts_offset,
+	ctf_dedup_hash_add (&hash, &slice->cts_offset,
 			    sizeof (slice->cts_offset), "slice offset", depth);
-	ctf_dedup_sha1_add (&hash, &slice->cts_bits,
+	ctf_dedup_hash_add (&hash, &slice->cts_bits,
 			    sizeof (slice->cts_bits), "slice bits", depth);
 	break;
       }
@@ -780,7 +1042,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	    whaterr = N_("error doing array contents type hashing");
 	    goto err;
 	  }
-	ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "array contents",
+	ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "array contents",
 			    depth);
 	ADD_CITER (citers, hval);
 
@@ -791,9 +1053,9 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	    whaterr = N_("error doing array index type hashing");
 	    goto err;
 	  }
-	ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "array index",
+	ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "array index",
 			    depth);
-	ctf_dedup_sha1_add (&hash, &ar.ctr_nelems, sizeof (ar.ctr_nelems),
+	ctf_dedup_hash_add (&hash, &ar.ctr_nelems, sizeof (ar.ctr_nelems),
 			    "element count", depth);
 	ADD_CITER (citers, hval);
 
@@ -818,11 +1080,11 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	    whaterr = N_("error getting func return type");
 	    goto err;
 	  }
-	ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "func return",
+	ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "func return",
 			    depth);
-	ctf_dedup_sha1_add (&hash, &fi.ctc_argc, sizeof (fi.ctc_argc),
+	ctf_dedup_hash_add (&hash, &fi.ctc_argc, sizeof (fi.ctc_argc),
 			    "func argc", depth);
-	ctf_dedup_sha1_add (&hash, &fi.ctc_flags, sizeof (fi.ctc_flags),
+	ctf_dedup_hash_add (&hash, &fi.ctc_flags, sizeof (fi.ctc_flags),
 			    "func flags", depth);
 	ADD_CITER (citers, hval);
 
@@ -849,7 +1111,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 		whaterr = N_("error doing func arg type hashing");
 		goto err;
 	      }
-	    ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "func arg type",
+	    ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "func arg type",
 				depth);
 	    ADD_CITER (citers, hval);
 	  }
@@ -861,13 +1123,13 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	int val;
 	const char *ename;
 
-	ctf_dedup_sha1_add (&hash, &tp->ctt_size, sizeof (uint32_t),
+	ctf_dedup_hash_add (&hash, &tp->ctt_size, sizeof (uint32_t),
 			    "enum size", depth);
 	while ((ename = ctf_enum_next (input, type, &i, &val)) != NULL)
 	  {
-	    ctf_dedup_sha1_add (&hash, ename, strlen (ename) + 1, "enumerator",
+	    ctf_dedup_hash_add (&hash, ename, strlen (ename) + 1, "enumerator",
 				depth);
-	    ctf_dedup_sha1_add (&hash, &val, sizeof (val), "enumerand", depth);
+	    ctf_dedup_hash_add (&hash, &val, sizeof (val), "enumerand", depth);
 	  }
 	if (ctf_errno (input) != ECTF_NEXT_END)
 	  {
@@ -886,7 +1148,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	ssize_t size;
 
 	ctf_get_ctt_size (input, tp, &size, NULL);
-	ctf_dedup_sha1_add (&hash, &size, sizeof (ssize_t), "struct size",
+	ctf_dedup_hash_add (&hash, &size, sizeof (ssize_t), "struct size",
 			    depth);
 
 	while ((offset = ctf_member_next (input, type, &i, &mname, &membtype,
@@ -894,7 +1156,7 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 	  {
 	    if (mname == NULL)
 	      mname = "";
-	    ctf_dedup_sha1_add (&hash, mname, strlen (mname) + 1,
+	    ctf_dedup_hash_add (&hash, mname, strlen (mname) + 1,
 				"member name", depth);
 
 #ifdef ENABLE_LIBCTF_HASH_DEBUGGING
@@ -908,9 +1170,9 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
 		goto iterr;
 	      }
 
-	    ctf_dedup_sha1_add (&hash, hval, strlen (hval) + 1, "member hash",
+	    ctf_dedup_hash_add (&hash, hval, strlen (hval) + 1, "member hash",
 				depth);
-	    ctf_dedup_sha1_add (&hash, &offset, sizeof (offset), "member offset",
+	    ctf_dedup_hash_add (&hash, &offset, sizeof (offset), "member offset",
 				depth);
 	    ADD_CITER (citers, hval);
 	  }
@@ -925,7 +1187,12 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
       whaterr = N_("error: unknown type kind");
       goto err;
     }
-  ctf_sha1_fini (&hash, hashbuf);
+  if (ctf_dedup_hash_fini (fp, &hash, hashbuf) < 0)
+    {
+      whaterr = N_("cannot compute hash");
+      err = ctf_errno (fp);
+      goto err;
+    }
 
   if ((hval = intern (fp, strdup (hashbuf))) == NULL)
     {
@@ -975,12 +1242,13 @@ ctf_dedup_rhash_type (ctf_dict_t *fp, ctf_dict_t *input, ctf_dict_t **inputs,
  input_err:
   err = ctf_errno (input);
  err:
-  ctf_sha1_fini (&hash, NULL);
+  ctf_dedup_hash_discard (&hash);
   ctf_err_warn (fp, 0, err, _("%s (%i): %s: during type hashing for type %lx, "
 			      "kind %i"), ctf_link_input_name (input),
 		input_num, gettext (whaterr), type, kind);
   return NULL;
  oom:
+  ctf_dedup_hash_discard (&hash);
   ctf_set_errno (fp, errno);
   ctf_err_warn (fp, 0, 0, _("%s (%i): %s: during type hashing for type %lx, "
 			    "kind %i"), ctf_link_input_name (input),
@@ -1712,6 +1980,7 @@ ctf_dedup_fini (ctf_dict_t *fp, ctf_dict_t **outputs, uint32_t noutputs)
   ctf_dynhash_destroy (d->cd_input_nums);
   ctf_dynhash_destroy (d->cd_emission_struct_members);
   ctf_dynset_destroy (d->cd_conflicting_types);
+  ctf_dynhash_destroy (d->cd_hash_inputs);
 
   /* Free the per-output state.  */
   if (outputs)
@@ -1903,6 +2172,9 @@ ctf_dedup (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
   ctf_dedup_t *d = &output->ctf_dedup;
   size_t i;
   ctf_next_t *it = NULL;
+  size_t ntypes = 0;
+  clock_t start;
+  double hash_time;
 
   if (ctf_dedup_init (output) < 0)
     return -1; 					/* errno is set for us.  */
@@ -1928,6 +2200,19 @@ ctf_dedup (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
   if (cu_mapped)
     d->cd_link_flags &= ~(CTF_LINK_SHARE_DUPLICATED);
 
+  if (d->cd_link_flags & CTF_LINK_FAST_HASH)
+    {
+      if ((d->cd_hash_inputs = ctf_dynhash_create (ctf_hash_string,
+						   ctf_hash_eq_string,
+						   free, free)) == NULL)
+	{
+	  ctf_set_errno (output, ENOMEM);
+	  ctf_err_warn (output, 0, ENOMEM, _("ctf_dedup: cannot initialize: "
+					     "out of memory"));
+	  goto err;
+	}
+    }
+
   /* Compute hash values for all types, recursively, treating child structures
      and unions equivalent to forwards, and hashing in the name of the referent
      of each such type into structures, unions, and non-opaque forwards.
@@ -1937,6 +2222,7 @@ ctf_dedup (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
      IDs in cd_output_mapping.  */
 
   ctf_dprintf ("Computing type hashes\n");
+  start = clock ();
   for (i = 0; i < ninputs; i++)
     {
       ctf_id_t id;
@@ -1947,6 +2233,7 @@ ctf_dedup (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
 				   parents, i, id, 0, 0,
 				   ctf_dedup_populate_mappings) == NULL)
 	    goto err;				/* errno is set for us.  */
+	  ntypes++;
 	}
       if (ctf_errno (inputs[i]) != ECTF_NEXT_END)
 	{
@@ -1957,6 +2244,11 @@ ctf_dedup (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
 	}
     }
 
+  hash_time = (double) (clock () - start) / CLOCKS_PER_SEC;
+  ctf_dprintf ("Hashed %zu types in %.3f seconds\n", ntypes, hash_time);
+  output->ctf_link_stats.cls_types_in += ntypes;
+  output->ctf_link_stats.cls_hash_time += hash_time;
+
   /* Go through the cd_name_counts name->hash->count mapping for all CTF
      namespaces: any name with many hashes associated with it at this stage is
      necessarily ambiguous.  Mark all the hashes except the most common as
@@ -3105,6 +3397,7 @@ ctf_dedup_emit (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
   walk = outputs;
   *walk = output;
   output->ctf_refcnt++;
+  output->ctf_link_stats.cls_types_out += output->ctf_typemax;
   walk++;
 
   for (i = 0; i < ninputs; i++)
@@ -3113,6 +3406,7 @@ ctf_dedup_emit (ctf_dict_t *output, ctf_dict_t **inputs, uint32_t ninputs,
 	{
 	  *walk = inputs[i]->ctf_dedup.cd_output;
 	  inputs[i]->ctf_dedup.cd_output = NULL;
+	  output->ctf_link_stats.cls_types_out += (*walk)->ctf_typemax;
 	  walk++;
 	}
     }
@@ -173,9 +173,13 @@ ctf_dynhash_create (ctf_hash_fun hash_fun, ctf_hash_eq_fun eq_fun,
   if (key_free == NULL && value_free == NULL)
     del = free;
 
-  /* 7 is arbitrary and untested for now.  */
-  if ((dynhash->htab = htab_create_alloc (7, (htab_hash) hash_fun, eq_fun,
-					  del, xcalloc, free)) == NULL)
+  /* 7 is arbitrary and untested for now.  The hashes are stored alongside
+     the elements: the deduplicator hashes long strings and type hashes, and
+     keeping them means neither expansion nor colliding lookups need to
+     rehash or compare them again.  */
+  if ((dynhash->htab = htab_create_alloc_flags (7, (htab_hash) hash_fun,
+						eq_fun, del, xcalloc, free,
+						HTAB_STORE_HASHES)) == NULL)
     {
       free (dynhash);
       return NULL;
@@ -573,9 +577,12 @@ ctf_dynset_t *
 ctf_dynset_create (htab_hash hash_fun, htab_eq eq_fun,
 		   ctf_hash_free_fun key_free)
 {
-  /* 7 is arbitrary and untested for now.  */
-  return (ctf_dynset_t *) htab_create_alloc (7, (htab_hash) hash_fun, eq_fun,
-					     key_free, xcalloc, free);
+  /* 7 is arbitrary and untested for now.  As for dynhashes, store the
+     hashes.  */
+  return (ctf_dynset_t *) htab_create_alloc_flags (7, (htab_hash) hash_fun,
+						   eq_fun, key_free,
+						   xcalloc, free,
+						   HTAB_STORE_HASHES);
 }
 
 /* The dynset has one complexity: the underlying implementation reserves two
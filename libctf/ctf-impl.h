@@ -334,6 +334,11 @@ typedef struct ctf_dedup
   /* A set (a hash) of hash values of conflicting types.  */
   ctf_dynset_t *cd_conflicting_types;
 
+  /* Maps type hash values to the ctf_dedup_hash_input_t they were computed
+     from.  Used to detect collisions when the link flags ask for
+     CTF_LINK_FAST_HASH; NULL otherwise.  */
+  ctf_dynhash_t *cd_hash_inputs;
+
   /* A hash mapping fp *'s of inputs to their input_nums.  Used only by
      functions outside the core ctf_dedup / ctf_dedup_emit machinery which do
      not take an inputs array.  */
@@ -472,6 +477,10 @@ struct ctf_dict
      ctf_link).  Only respected when LCTF_LINKING set in ctf_flags.  */
   int ctf_link_flags;
 
+  /* Deduplication statistics for the last link, returned by ctf_link_stats.
+     Accumulated in the parent output dict.  */
+  ctf_link_stats_t ctf_link_stats;
+
   /* Allow the caller to change the name of link archive members.  */
   ctf_link_memb_name_changer_f *ctf_link_memb_name_changer;
   void *ctf_link_memb_name_changer_arg;         /* Argument for it.  */
@@ -602,6 +611,7 @@ extern const ctf_type_t *ctf_lookup_by_id (ctf_dict_t **, ctf_id_t);
 extern ctf_id_t ctf_lookup_by_rawname (ctf_dict_t *, int, const char *);
 extern ctf_id_t ctf_lookup_by_rawhash (ctf_dict_t *, ctf_names_t *, const char *);
 extern void ctf_set_ctl_hashes (ctf_dict_t *);
+extern int ctf_init_name_tables (ctf_dict_t *);
 
 extern int ctf_symtab_skippable (ctf_link_sym_t *sym);
 extern int ctf_add_funcobjt_sym (ctf_dict_t *, int is_function,
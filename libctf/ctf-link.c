@@ -1228,6 +1228,9 @@ ctf_link_deduplicating_per_cu (ctf_dict_t *fp)
 	 dictionary.  */
       ctf_cuname_set (out, out_name);
 
+      /* Hash types the same way as in the final pass.  */
+      out->ctf_link_flags = fp->ctf_link_flags & CTF_LINK_FAST_HASH;
+
       if (ctf_dedup (out, inputs, ninputs, parents, 1) < 0)
 	{
 	  ctf_set_errno (fp, ctf_errno (out));
@@ -1263,6 +1266,12 @@ ctf_link_deduplicating_per_cu (ctf_dict_t *fp)
 
       ctf_dedup_fini (out, outputs, noutputs);
 
+      fp->ctf_link_stats.cls_types_in += out->ctf_link_stats.cls_types_in;
+      fp->ctf_link_stats.cls_types_out += out->ctf_link_stats.cls_types_out;
+      fp->ctf_link_stats.cls_hash_collisions
+	+= out->ctf_link_stats.cls_hash_collisions;
+      fp->ctf_link_stats.cls_hash_time += out->ctf_link_stats.cls_hash_time;
+
       /* For now, we omit symbol section linking for CU-mapped links, until it
 	 is clear how to unify the symbol table across such links.  (Perhaps we
 	 should emit an unconditionally indexed symtab, like the compiler
@@ -1487,6 +1496,7 @@ ctf_link (ctf_dict_t *fp, int flags)
   int err;
 
   fp->ctf_link_flags = flags;
+  memset (&fp->ctf_link_stats, 0, sizeof (ctf_link_stats_t));
 
   if (fp->ctf_link_inputs == NULL)
     return 0;					/* Nothing to do. */
@@ -1540,6 +1550,15 @@ ctf_link (ctf_dict_t *fp, int flags)
   return 0;
 }
 
+/* Return statistics about the deduplication done by the last ctf_link of FP
+   in STATS.  */
+int
+ctf_link_stats (ctf_dict_t *fp, ctf_link_stats_t *stats)
+{
+  *stats = fp->ctf_link_stats;
+  return 0;
+}
+
 typedef struct ctf_link_out_string_cb_arg
 {
   const char *str;
@@ -670,10 +670,9 @@ upgrade_types (ctf_dict_t *fp, ctf_header_t *cth)
   return 0;
 }
 
-/* Initialize the type ID translation table with the byte offset of each type,
-   and initialize the hash tables of each named type.  Upgrade the type table to
-   the latest supported representation in the process, if needed, and if this
-   recension of libctf supports upgrading.  */
+/* Initialize the type ID translation table with the byte offset of each type.
+   Upgrade the type table to the latest supported representation in the
+   process, if needed, and if this recension of libctf supports upgrading.  */
 
 static int
 init_types (ctf_dict_t *fp, ctf_header_t *cth)
@@ -681,7 +680,6 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
   const ctf_type_t *tbuf;
   const ctf_type_t *tend;
 
-  unsigned long pop[CTF_K_MAX + 1] = { 0 };
   const ctf_type_t *tp;
   uint32_t id;
   uint32_t *xp;
@@ -690,8 +688,6 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
      cth_parname.  */
 
   int child = cth->cth_parname != 0;
-  int nlstructs = 0, nlunions = 0;
-  int err;
 
   assert (!(fp->ctf_flags & LCTF_RDWR));
 
@@ -706,7 +702,7 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
   tend = (ctf_type_t *) (fp->ctf_buf + cth->cth_stroff);
 
   /* We make two passes through the entire type section.  In this first
-     pass, we count the number of each type and the total number of types.  */
+     pass, we count the total number of types.  */
 
   for (tp = tbuf; tp < tend; fp->ctf_typemax++)
     {
@@ -720,13 +716,7 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
       if (vbytes < 0)
 	return ECTF_CORRUPT;
 
-      /* For forward declarations, ctt_type is the CTF_K_* kind for the tag,
-	 so bump that population count too.  */
-      if (kind == CTF_K_FORWARD)
-	pop[tp->ctt_type]++;
-
       tp = (ctf_type_t *) ((uintptr_t) tp + increment + vbytes);
-      pop[kind]++;
     }
 
   if (child)
@@ -737,23 +727,123 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
   else
     ctf_dprintf ("CTF dict %p is a parent\n", (void *) fp);
 
-  /* Now that we've counted up the number of each type, we can allocate
-     the hash tables, type translation table, and pointer table.  */
+  /* Now that we've counted up the number of types, we can allocate the type
+     translation table and pointer table.  The name tables are populated later,
+     on first use, by ctf_init_name_tables.  */
+
+  fp->ctf_txlate = malloc (sizeof (uint32_t) * (fp->ctf_typemax + 1));
+  fp->ctf_ptrtab_len = fp->ctf_typemax + 1;
+  fp->ctf_ptrtab = malloc (sizeof (uint32_t) * fp->ctf_ptrtab_len);
+
+  if (fp->ctf_txlate == NULL || fp->ctf_ptrtab == NULL)
+    return ENOMEM;		/* Memory allocation failed.  */
+
+  xp = fp->ctf_txlate;
+  *xp++ = 0;			/* Type id 0 is used as a sentinel value.  */
+
+  memset (fp->ctf_txlate, 0, sizeof (uint32_t) * (fp->ctf_typemax + 1));
+  memset (fp->ctf_ptrtab, 0, sizeof (uint32_t) * (fp->ctf_typemax + 1));
+
+  /* In the second pass through the types, we fill in each entry of the
+     type and pointer tables.  */
+
+  for (id = 1, tp = tbuf; tp < tend; xp++, id++)
+    {
+      unsigned short kind = LCTF_INFO_KIND (fp, tp->ctt_info);
+      unsigned long vlen = LCTF_INFO_VLEN (fp, tp->ctt_info);
+      ssize_t size, increment, vbytes;
+
+      (void) ctf_get_ctt_size (fp, tp, &size, &increment);
+      /* Cannot fail: shielded by call in loop above.  */
+      vbytes = LCTF_VBYTES (fp, kind, size, vlen);
+
+      switch (kind)
+	{
+	case CTF_K_UNKNOWN:
+	case CTF_K_INTEGER:
+	case CTF_K_FLOAT:
+	case CTF_K_ARRAY:
+	case CTF_K_SLICE:
+	case CTF_K_FUNCTION:
+	case CTF_K_STRUCT:
+	case CTF_K_UNION:
+	case CTF_K_ENUM:
+	case CTF_K_TYPEDEF:
+	case CTF_K_FORWARD:
+	case CTF_K_VOLATILE:
+	case CTF_K_CONST:
+	case CTF_K_RESTRICT:
+	  break;
+
+	case CTF_K_POINTER:
+	  /* If the type referenced by the pointer is in this CTF dict, then
+	     store the index of the pointer type in fp->ctf_ptrtab[ index of
+	     referenced type ].  */
+
+	  if (LCTF_TYPE_ISCHILD (fp, tp->ctt_type) == child
+	      && LCTF_TYPE_TO_INDEX (fp, tp->ctt_type) <= fp->ctf_typemax)
+	    fp->ctf_ptrtab[LCTF_TYPE_TO_INDEX (fp, tp->ctt_type)] = id;
+	  break;
+
+	default:
+	  ctf_err_warn (fp, 0, ECTF_CORRUPT,
+			_("init_types(): unhandled CTF kind: %x"), kind);
+	  return ECTF_CORRUPT;
+	}
+
+      *xp = (uint32_t) ((uintptr_t) tp - (uintptr_t) fp->ctf_buf);
+      tp = (ctf_type_t *) ((uintptr_t) tp + increment + vbytes);
+    }
+
+  ctf_dprintf ("%lu total types processed\n", fp->ctf_typemax);
+
+  return 0;
+}
+
+/* Initialize the hash tables of each named type in a readonly dict.  Called
+   on the first lookup by name (see ctf_lookup_by_rawhash), so that dicts
+   which are opened only to be looked up by type ID or symbol never pay for
+   hashing all their names.  */
+
+int
+ctf_init_name_tables (ctf_dict_t *fp)
+{
+  unsigned long pop[CTF_K_MAX + 1] = { 0 };
+  const ctf_type_t *tp;
+  unsigned long id;
+  int child = (fp->ctf_flags & LCTF_CHILD) != 0;
+  int nlstructs = 0, nlunions = 0;
+  int err;
+
+  assert (!(fp->ctf_flags & LCTF_RDWR));
+
+  /* Count the number of each named kind, to size the hash tables.  */
+
+  for (id = 1; id <= fp->ctf_typemax; id++)
+    {
+      tp = (ctf_type_t *) (fp->ctf_buf + fp->ctf_txlate[id]);
+
+      /* For forward declarations, ctt_type is the CTF_K_* kind for the tag,
+	 so bump that population count too.  */
+      if (LCTF_INFO_KIND (fp, tp->ctt_info) == CTF_K_FORWARD)
+	pop[tp->ctt_type]++;
+      pop[LCTF_INFO_KIND (fp, tp->ctt_info)]++;
+    }
 
   if ((fp->ctf_structs.ctn_readonly
        = ctf_hash_create (pop[CTF_K_STRUCT], ctf_hash_string,
 			  ctf_hash_eq_string)) == NULL)
-    return ENOMEM;
+    goto oom;
 
   if ((fp->ctf_unions.ctn_readonly
        = ctf_hash_create (pop[CTF_K_UNION], ctf_hash_string,
 			  ctf_hash_eq_string)) == NULL)
-    return ENOMEM;
+    goto oom;
 
   if ((fp->ctf_enums.ctn_readonly
        = ctf_hash_create (pop[CTF_K_ENUM], ctf_hash_string,
 			  ctf_hash_eq_string)) == NULL)
-    return ENOMEM;
+    goto oom;
 
   if ((fp->ctf_names.ctn_readonly
        = ctf_hash_create (pop[CTF_K_UNKNOWN] +
@@ -767,38 +857,22 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
 			  pop[CTF_K_RESTRICT],
 			  ctf_hash_string,
 			  ctf_hash_eq_string)) == NULL)
-    return ENOMEM;
-
-  fp->ctf_txlate = malloc (sizeof (uint32_t) * (fp->ctf_typemax + 1));
-  fp->ctf_ptrtab_len = fp->ctf_typemax + 1;
-  fp->ctf_ptrtab = malloc (sizeof (uint32_t) * fp->ctf_ptrtab_len);
-
-  if (fp->ctf_txlate == NULL || fp->ctf_ptrtab == NULL)
-    return ENOMEM;		/* Memory allocation failed.  */
-
-  xp = fp->ctf_txlate;
-  *xp++ = 0;			/* Type id 0 is used as a sentinel value.  */
-
-  memset (fp->ctf_txlate, 0, sizeof (uint32_t) * (fp->ctf_typemax + 1));
-  memset (fp->ctf_ptrtab, 0, sizeof (uint32_t) * (fp->ctf_typemax + 1));
-
-  /* In the second pass through the types, we fill in each entry of the
-     type and pointer tables and add names to the appropriate hashes.  */
+    goto oom;
 
-  for (id = 1, tp = tbuf; tp < tend; xp++, id++)
+  for (id = 1; id <= fp->ctf_typemax; id++)
     {
-      unsigned short kind = LCTF_INFO_KIND (fp, tp->ctt_info);
-      unsigned short isroot = LCTF_INFO_ISROOT (fp, tp->ctt_info);
-      unsigned long vlen = LCTF_INFO_VLEN (fp, tp->ctt_info);
-      ssize_t size, increment, vbytes;
-
+      unsigned short kind, isroot;
+      ssize_t size, increment;
       const char *name;
 
+      tp = (ctf_type_t *) (fp->ctf_buf + fp->ctf_txlate[id]);
+      kind = LCTF_INFO_KIND (fp, tp->ctt_info);
+      isroot = LCTF_INFO_ISROOT (fp, tp->ctt_info);
+
       (void) ctf_get_ctt_size (fp, tp, &size, &increment);
       name = ctf_strptr (fp, tp->ctt_name);
-      /* Cannot fail: shielded by call in loop above.  */
-      vbytes = LCTF_VBYTES (fp, kind, size, vlen);
 
+      err = 0;
       switch (kind)
 	{
 	case CTF_K_UNKNOWN:
@@ -813,13 +887,9 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
 	  if (((ctf_hash_lookup_type (fp->ctf_names.ctn_readonly,
 				      fp, name)) == 0)
 	      || isroot)
-	    {
-	      err = ctf_hash_define_type (fp->ctf_names.ctn_readonly, fp,
-					  LCTF_INDEX_TO_TYPE (fp, id, child),
-					  tp->ctt_name);
-	      if (err != 0)
-		return err;
-	    }
+	    err = ctf_hash_define_type (fp->ctf_names.ctn_readonly, fp,
+					LCTF_INDEX_TO_TYPE (fp, id, child),
+					tp->ctt_name);
 	  break;
 
 	  /* These kinds have no name, so do not need interning into any
@@ -828,124 +898,63 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
 	case CTF_K_SLICE:
 	  break;
 
-	case CTF_K_FUNCTION:
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_insert_type (fp->ctf_names.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-	  if (err != 0)
-	    return err;
-	  break;
-
 	case CTF_K_STRUCT:
 	  if (size >= CTF_LSTRUCT_THRESH)
 	    nlstructs++;
 
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_define_type (fp->ctf_structs.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-
-	  if (err != 0)
-	    return err;
-
+	  if (isroot)
+	    err = ctf_hash_define_type (fp->ctf_structs.ctn_readonly, fp,
+					LCTF_INDEX_TO_TYPE (fp, id, child),
+					tp->ctt_name);
 	  break;
 
 	case CTF_K_UNION:
 	  if (size >= CTF_LSTRUCT_THRESH)
 	    nlunions++;
 
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_define_type (fp->ctf_unions.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-
-	  if (err != 0)
-	    return err;
+	  if (isroot)
+	    err = ctf_hash_define_type (fp->ctf_unions.ctn_readonly, fp,
+					LCTF_INDEX_TO_TYPE (fp, id, child),
+					tp->ctt_name);
 	  break;
 
 	case CTF_K_ENUM:
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_define_type (fp->ctf_enums.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-
-	  if (err != 0)
-	    return err;
-	  break;
-
-	case CTF_K_TYPEDEF:
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_insert_type (fp->ctf_names.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-	  if (err != 0)
-	    return err;
+	  if (isroot)
+	    err = ctf_hash_define_type (fp->ctf_enums.ctn_readonly, fp,
+					LCTF_INDEX_TO_TYPE (fp, id, child),
+					tp->ctt_name);
 	  break;
 
 	case CTF_K_FORWARD:
 	  {
 	    ctf_names_t *np = ctf_name_table (fp, tp->ctt_type);
 
-	    if (!isroot)
-	      break;
-
 	    /* Only insert forward tags into the given hash if the type or tag
 	       name is not already present.  */
-	    if (ctf_hash_lookup_type (np->ctn_readonly, fp, name) == 0)
-	      {
-		err = ctf_hash_insert_type (np->ctn_readonly, fp,
-					    LCTF_INDEX_TO_TYPE (fp, id, child),
-					    tp->ctt_name);
-		if (err != 0)
-		  return err;
-	      }
+	    if (isroot && ctf_hash_lookup_type (np->ctn_readonly, fp, name) == 0)
+	      err = ctf_hash_insert_type (np->ctn_readonly, fp,
+					  LCTF_INDEX_TO_TYPE (fp, id, child),
+					  tp->ctt_name);
 	    break;
 	  }
 
+	case CTF_K_FUNCTION:
+	case CTF_K_TYPEDEF:
 	case CTF_K_POINTER:
-	  /* If the type referenced by the pointer is in this CTF dict, then
-	     store the index of the pointer type in fp->ctf_ptrtab[ index of
-	     referenced type ].  */
-
-	  if (LCTF_TYPE_ISCHILD (fp, tp->ctt_type) == child
-	      && LCTF_TYPE_TO_INDEX (fp, tp->ctt_type) <= fp->ctf_typemax)
-	    fp->ctf_ptrtab[LCTF_TYPE_TO_INDEX (fp, tp->ctt_type)] = id;
-	 /*FALLTHRU*/
-
 	case CTF_K_VOLATILE:
 	case CTF_K_CONST:
 	case CTF_K_RESTRICT:
-	  if (!isroot)
-	    break;
-
-	  err = ctf_hash_insert_type (fp->ctf_names.ctn_readonly, fp,
-				      LCTF_INDEX_TO_TYPE (fp, id, child),
-				      tp->ctt_name);
-	  if (err != 0)
-	    return err;
+	  if (isroot)
+	    err = ctf_hash_insert_type (fp->ctf_names.ctn_readonly, fp,
+					LCTF_INDEX_TO_TYPE (fp, id, child),
+					tp->ctt_name);
 	  break;
-	default:
-	  ctf_err_warn (fp, 0, ECTF_CORRUPT,
-			_("init_types(): unhandled CTF kind: %x"), kind);
-	  return ECTF_CORRUPT;
 	}
 
-      *xp = (uint32_t) ((uintptr_t) tp - (uintptr_t) fp->ctf_buf);
-      tp = (ctf_type_t *) ((uintptr_t) tp + increment + vbytes);
+      if (err != 0)
+	goto err;
     }
 
-  ctf_dprintf ("%lu total types processed\n", fp->ctf_typemax);
   ctf_dprintf ("%u enum names hashed\n",
 	       ctf_hash_size (fp->ctf_enums.ctn_readonly));
   ctf_dprintf ("%u struct names hashed (%d long)\n",
@@ -956,6 +965,19 @@ init_types (ctf_dict_t *fp, ctf_header_t *cth)
 	       ctf_hash_size (fp->ctf_names.ctn_readonly));
 
   return 0;
+
+ oom:
+  err = ENOMEM;
+ err:
+  ctf_hash_destroy (fp->ctf_structs.ctn_readonly);
+  ctf_hash_destroy (fp->ctf_unions.ctn_readonly);
+  ctf_hash_destroy (fp->ctf_enums.ctn_readonly);
+  ctf_hash_destroy (fp->ctf_names.ctn_readonly);
+  fp->ctf_structs.ctn_readonly = NULL;
+  fp->ctf_unions.ctn_readonly = NULL;
+  fp->ctf_enums.ctn_readonly = NULL;
+  fp->ctf_names.ctn_readonly = NULL;
+  return err;
 }
 
 /* Endianness-flipping routines.
@@ -632,16 +632,25 @@ ctf_id_t ctf_lookup_by_rawname (ctf_dict_t *fp, int kind, const char *name)
 
 /* Look up a name in the given name table, in the appropriate hash given the
    readability state of the dictionary.  The name is a raw, undecorated
-   identifier.  */
+   identifier.  The name tables of readonly dicts are populated here, on first
+   use.  */
 
 ctf_id_t ctf_lookup_by_rawhash (ctf_dict_t *fp, ctf_names_t *np, const char *name)
 {
   ctf_id_t id;
+  int err;
 
   if (fp->ctf_flags & LCTF_RDWR)
     id = (ctf_id_t) (uintptr_t) ctf_dynhash_lookup (np->ctn_writable, name);
   else
-    id = ctf_hash_lookup_type (np->ctn_readonly, fp, name);
+    {
+      if (np->ctn_readonly == NULL && (err = ctf_init_name_tables (fp)) != 0)
+	{
+	  ctf_set_errno (fp, err);
+	  return 0;
+	}
+      id = ctf_hash_lookup_type (np->ctn_readonly, fp, name);
+    }
   return id;
 }
 
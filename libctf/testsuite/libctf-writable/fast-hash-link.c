@@ -0,0 +1,122 @@
+/* Make sure that a link with CTF_LINK_FAST_HASH deduplicates exactly like one
+   without it, and that the link statistics count the types.  */
+
+#include <ctf-api.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Make an input containing an int, a struct s containing an int, and a struct
+   t whose member has the name MEMBNAME.  */
+
+static ctf_archive_t *
+make_input (const char *membname, unsigned char **buf)
+{
+  ctf_dict_t *fp;
+  ctf_encoding_t e = { CTF_INT_SIGNED, 0, sizeof (int) * 8 };
+  ctf_id_t base, s, t;
+  ctf_sect_t sect;
+  size_t bufsiz;
+  int err;
+
+  if ((fp = ctf_create (&err)) == NULL)
+    goto create_err;
+
+  if ((base = ctf_add_integer (fp, CTF_ADD_ROOT, "int", &e)) == CTF_ERR)
+    goto add_err;
+  if ((s = ctf_add_struct (fp, CTF_ADD_ROOT, "s")) == CTF_ERR)
+    goto add_err;
+  if (ctf_add_member (fp, s, "a", base) < 0)
+    goto add_err;
+  if ((t = ctf_add_struct (fp, CTF_ADD_ROOT, "t")) == CTF_ERR)
+    goto add_err;
+  if (ctf_add_member (fp, t, membname, base) < 0)
+    goto add_err;
+
+  if ((*buf = ctf_write_mem (fp, &bufsiz, 4096)) == NULL)
+    goto write_err;
+  ctf_dict_close (fp);
+
+  memset (&sect, 0, sizeof (sect));
+  sect.cts_data = *buf;
+  sect.cts_size = bufsiz;
+  return ctf_arc_bufopen (&sect, NULL, NULL, &err);
+
+ create_err:
+  fprintf (stderr, "Cannot create: %s\n", ctf_errmsg (err));
+  exit (1);
+ add_err:
+  fprintf (stderr, "Cannot add: %s\n", ctf_errmsg (ctf_errno (fp)));
+  exit (1);
+ write_err:
+  fprintf (stderr, "Cannot serialize: %s\n", ctf_errmsg (ctf_errno (fp)));
+  exit (1);
+}
+
+static unsigned char *
+do_link (int flags, size_t *size, ctf_link_stats_t *stats)
+{
+  ctf_dict_t *out;
+  ctf_archive_t *a, *b;
+  unsigned char *abuf, *bbuf, *ret;
+  int err;
+
+  a = make_input ("x", &abuf);
+  b = make_input ("y", &bbuf);
+  if (a == NULL || b == NULL)
+    {
+      fprintf (stderr, "Cannot open inputs\n");
+      exit (1);
+    }
+
+  if ((out = ctf_create (&err)) == NULL)
+    {
+      fprintf (stderr, "Cannot create output: %s\n", ctf_errmsg (err));
+      exit (1);
+    }
+
+  if (ctf_link_add_ctf (out, a, "a") < 0
+      || ctf_link_add_ctf (out, b, "b") < 0)
+    goto link_err;
+
+  if (ctf_link (out, flags) < 0)
+    goto link_err;
+
+  if (ctf_link_stats (out, stats) < 0)
+    goto link_err;
+
+  if ((ret = ctf_link_write (out, size, 4096)) == NULL)
+    goto link_err;
+
+  ctf_dict_close (out);
+  free (abuf);
+  free (bbuf);
+  return ret;
+
+ link_err:
+  fprintf (stderr, "Cannot link: %s\n", ctf_errmsg (ctf_errno (out)));
+  exit (1);
+}
+
+int
+main (int argc, char *argv[])
+{
+  ctf_link_stats_t sha1_stats, fast_stats;
+  unsigned char *sha1_buf, *fast_buf;
+  size_t sha1_size, fast_size;
+
+  sha1_buf = do_link (0, &sha1_size, &sha1_stats);
+  fast_buf = do_link (CTF_LINK_FAST_HASH, &fast_size, &fast_stats);
+
+  printf ("%zu types in, %zu types out\n", sha1_stats.cls_types_in,
+	  sha1_stats.cls_types_out);
+  printf ("%zu types in, %zu types out with fast hashing\n",
+	  fast_stats.cls_types_in, fast_stats.cls_types_out);
+
+  if (sha1_size != fast_size || memcmp (sha1_buf, fast_buf, sha1_size) != 0)
+    printf ("Links with and without fast hashing differ\n");
+
+  free (sha1_buf);
+  free (fast_buf);
+  return 0;
+}
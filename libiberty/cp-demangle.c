@@ -373,6 +373,22 @@ struct d_print_info
   const struct demangle_component *current_template;
 };
 
+/* Arrays used while demangling a name, kept by a
+   cplus_demangle_ctx between names so that a name only needs to
+   allocate memory when it is bigger than any seen before.  */
+
+struct d_arena
+{
+  struct demangle_component *comps;
+  int num_comps;
+  struct demangle_component **subs;
+  int num_subs;
+  struct d_saved_scope *saved_scopes;
+  int num_saved_scopes;
+  struct d_print_template *copy_templates;
+  int num_copy_templates;
+};
+
 #ifdef CP_DEMANGLE_DEBUG
 static void d_dump (struct demangle_component *, int);
 #endif
@@ -568,9 +584,14 @@ static void d_print_conversion (struct d_print_info *, int,
 				struct demangle_component *);
 
 static int d_demangle_callback (const char *, int,
-                                demangle_callbackref, void *);
+                                demangle_callbackref, void *,
+                                struct d_arena *);
 static char *d_demangle (const char *, int, size_t *);
 
+static int d_print_with_arena (int, struct demangle_component *,
+			       demangle_callbackref, void *,
+			       struct d_arena *);
+
 #define FNQUAL_COMPONENT_CASE				\
     case DEMANGLE_COMPONENT_RESTRICT_THIS:		\
     case DEMANGLE_COMPONENT_VOLATILE_THIS:		\
@@ -4447,31 +4468,86 @@ int
 cplus_demangle_print_callback (int options,
                                struct demangle_component *dc,
                                demangle_callbackref callback, void *opaque)
+{
+  return d_print_with_arena (options, dc, callback, opaque, NULL);
+}
+
+/* Make sure that ARRAY, which has room for *PNUM elements of SIZE
+   bytes, has room for at least NEED.  Return the array, which may
+   have moved, or NULL on allocation failure, in which case ARRAY is
+   left alone.  */
+
+static void *
+d_arena_reserve (void *array, int *pnum, int need, size_t size)
+{
+  void *newarray;
+
+  if (need < 1)
+    need = 1;
+  if (array != NULL && need <= *pnum)
+    return array;
+
+  newarray = realloc (array, need * size);
+  if (newarray != NULL)
+    *pnum = need;
+  return newarray;
+}
+
+/* Like cplus_demangle_print_callback, but if ARENA is not NULL, take
+   the arrays needed for printing from it rather than from the
+   stack.  */
+
+static int
+d_print_with_arena (int options, struct demangle_component *dc,
+		    demangle_callbackref callback, void *opaque,
+		    struct d_arena *arena)
 {
   struct d_print_info dpi;
 
   d_print_init (&dpi, callback, opaque, dc);
 
-  {
+  if (arena != NULL)
+    {
+      void *p;
+
+      p = d_arena_reserve (arena->saved_scopes, &arena->num_saved_scopes,
+			   dpi.num_saved_scopes, sizeof (*dpi.saved_scopes));
+      if (p == NULL)
+	return 0;
+      arena->saved_scopes = (struct d_saved_scope *) p;
+      p = d_arena_reserve (arena->copy_templates,
+			   &arena->num_copy_templates,
+			   dpi.num_copy_templates,
+			   sizeof (*dpi.copy_templates));
+      if (p == NULL)
+	return 0;
+      arena->copy_templates = (struct d_print_template *) p;
+
+      dpi.saved_scopes = arena->saved_scopes;
+      dpi.copy_templates = arena->copy_templates;
+      d_print_comp (&dpi, options, dc);
+    }
+  else
+    {
 #ifdef CP_DYNAMIC_ARRAYS
-    /* Avoid zero-length VLAs, which are prohibited by the C99 standard
-       and flagged as errors by Address Sanitizer.  */
-    __extension__ struct d_saved_scope scopes[(dpi.num_saved_scopes > 0)
-                                              ? dpi.num_saved_scopes : 1];
-    __extension__ struct d_print_template temps[(dpi.num_copy_templates > 0)
-                                                ? dpi.num_copy_templates : 1];
-
-    dpi.saved_scopes = scopes;
-    dpi.copy_templates = temps;
+      /* Avoid zero-length VLAs, which are prohibited by the C99 standard
+	 and flagged as errors by Address Sanitizer.  */
+      __extension__ struct d_saved_scope scopes[(dpi.num_saved_scopes > 0)
+						? dpi.num_saved_scopes : 1];
+      __extension__ struct d_print_template temps[(dpi.num_copy_templates > 0)
+						  ? dpi.num_copy_templates : 1];
+
+      dpi.saved_scopes = scopes;
+      dpi.copy_templates = temps;
 #else
-    dpi.saved_scopes = alloca (dpi.num_saved_scopes
-			       * sizeof (*dpi.saved_scopes));
-    dpi.copy_templates = alloca (dpi.num_copy_templates
-				 * sizeof (*dpi.copy_templates));
+      dpi.saved_scopes = alloca (dpi.num_saved_scopes
+				 * sizeof (*dpi.saved_scopes));
+      dpi.copy_templates = alloca (dpi.num_copy_templates
+				   * sizeof (*dpi.copy_templates));
 #endif
 
-    d_print_comp (&dpi, options, dc);
-  }
+      d_print_comp (&dpi, options, dc);
+    }
 
   d_print_flush (&dpi);
 
@@ -6479,7 +6555,8 @@ cplus_demangle_init_info (const char *mangled, int options, size_t len,
 
 static int
 d_demangle_callback (const char *mangled, int options,
-                     demangle_callbackref callback, void *opaque)
+                     demangle_callbackref callback, void *opaque,
+                     struct d_arena *arena)
 {
   enum
     {
@@ -6528,16 +6605,41 @@ d_demangle_callback (const char *mangled, int options,
 
   {
 #ifdef CP_DYNAMIC_ARRAYS
-    __extension__ struct demangle_component comps[di.num_comps];
-    __extension__ struct demangle_component *subs[di.num_subs];
+    /* The arrays come from ARENA instead, if there is one.  */
+    __extension__ struct demangle_component comps[arena != NULL
+						  ? 1 : di.num_comps];
+    __extension__ struct demangle_component *subs[arena != NULL
+						  ? 1 : di.num_subs];
 
     di.comps = comps;
     di.subs = subs;
 #else
-    di.comps = alloca (di.num_comps * sizeof (*di.comps));
-    di.subs = alloca (di.num_subs * sizeof (*di.subs));
+    if (arena == NULL)
+      {
+	di.comps = alloca (di.num_comps * sizeof (*di.comps));
+	di.subs = alloca (di.num_subs * sizeof (*di.subs));
+      }
 #endif
 
+    if (arena != NULL)
+      {
+	void *p;
+
+	p = d_arena_reserve (arena->comps, &arena->num_comps,
+			     di.num_comps, sizeof (*di.comps));
+	if (p == NULL)
+	  return 0;
+	arena->comps = (struct demangle_component *) p;
+	p = d_arena_reserve (arena->subs, &arena->num_subs,
+			     di.num_subs, sizeof (*di.subs));
+	if (p == NULL)
+	  return 0;
+	arena->subs = (struct demangle_component **) p;
+
+	di.comps = arena->comps;
+	di.subs = arena->subs;
+      }
+
     switch (type)
       {
       case DCT_TYPE:
@@ -6580,7 +6682,7 @@ d_demangle_callback (const char *mangled, int options,
 #endif
 
     status = (dc != NULL)
-             ? cplus_demangle_print_callback (options, dc, callback, opaque)
+             ? d_print_with_arena (options, dc, callback, opaque, arena)
              : 0;
   }
 
@@ -6603,7 +6705,8 @@ d_demangle (const char *mangled, int options, size_t *palc)
   d_growable_string_init (&dgs, 0);
 
   status = d_demangle_callback (mangled, options,
-                                d_growable_string_callback_adapter, &dgs);
+                                d_growable_string_callback_adapter, &dgs,
+                                NULL);
   if (status == 0)
     {
       free (dgs.buf);
@@ -6741,7 +6844,7 @@ __gcclibcxx_demangle_callback (const char *mangled_name,
     return -3;
 
   status = d_demangle_callback (mangled_name, DMGL_PARAMS | DMGL_TYPES,
-                                callback, opaque);
+                                callback, opaque, NULL);
   if (status == 0)
     return -2;
 
@@ -6766,7 +6869,67 @@ int
 cplus_demangle_v3_callback (const char *mangled, int options,
                             demangle_callbackref callback, void *opaque)
 {
-  return d_demangle_callback (mangled, options, callback, opaque);
+  return d_demangle_callback (mangled, options, callback, opaque, NULL);
+}
+
+/* A context for demangling many names in turn.  */
+
+struct cplus_demangle_ctx
+{
+  /* The arrays used while demangling a name.  */
+  struct d_arena arena;
+  /* The result of the last call to cplus_demangle_v3_ctx.  */
+  struct d_growable_string out;
+};
+
+/* Return a new context for cplus_demangle_v3_ctx, or NULL if there is
+   no memory for one.  */
+
+struct cplus_demangle_ctx *
+cplus_demangle_ctx_new (void)
+{
+  return (struct cplus_demangle_ctx *) calloc (1,
+					       sizeof (struct cplus_demangle_ctx));
+}
+
+/* Free CTX, and the result of the last call that used it.  */
+
+void
+cplus_demangle_ctx_free (struct cplus_demangle_ctx *ctx)
+{
+  if (ctx == NULL)
+    return;
+
+  free (ctx->arena.comps);
+  free (ctx->arena.subs);
+  free (ctx->arena.saved_scopes);
+  free (ctx->arena.copy_templates);
+  free (ctx->out.buf);
+  free (ctx);
+}
+
+/* Like cplus_demangle_v3, but use the memory kept in CTX, so that
+   demangling many names needs to allocate only when a name is bigger
+   than any before it.  The result belongs to CTX, and is only valid
+   until the next call that uses CTX.  Return NULL if MANGLED could
+   not be demangled or there was not enough memory.  */
+
+const char *
+cplus_demangle_v3_ctx (const char *mangled, int options,
+		       struct cplus_demangle_ctx *ctx)
+{
+  ctx->out.len = 0;
+  if (!d_demangle_callback (mangled, options,
+			    d_growable_string_callback_adapter, &ctx->out,
+			    &ctx->arena))
+    return NULL;
+
+  if (ctx->out.allocation_failure)
+    {
+      ctx->out.allocation_failure = 0;
+      return NULL;
+    }
+  return ctx->out.buf;
 }
 
 /* Demangle a Java symbol.  Java uses a subset of the V3 ABI C++ mangling 
@@ -6789,7 +6952,7 @@ java_demangle_v3_callback (const char *mangled,
 {
   return d_demangle_callback (mangled,
                               DMGL_JAVA | DMGL_PARAMS | DMGL_RET_POSTFIX,
-                              callback, opaque);
+                              callback, opaque, NULL);
 }
 
 #endif /* IN_LIBGCC2 || IN_GLIBCPP_V3 */
@@ -273,6 +273,29 @@ htab_mod_m2 (hashval_t hash, htab_t htab)
   return 1 + htab_mod_1 (hash, p->prime - 2, p->inv_m2, p->shift);
 }
 
+/* Return the size of each of HTAB's entries, as passed to its
+   allocator.  With HTAB_STORE_HASHES, the hash values follow the
+   element pointers in the same allocation.  */
+
+static inline size_t
+htab_entry_size (htab_t htab)
+{
+  if ((htab->flags & HTAB_STORE_HASHES) != 0)
+    return sizeof (void *) + sizeof (hashval_t);
+  return sizeof (void *);
+}
+
+/* Return the stored hash values of HTAB's entries, or NULL if it does
+   not store them.  */
+
+static inline hashval_t *
+htab_hashes (htab_t htab)
+{
+  if ((htab->flags & HTAB_STORE_HASHES) != 0)
+    return (hashval_t *) (htab->entries + htab->size);
+  return NULL;
+}
+
 /* This function creates table with length slightly longer than given
    source length.  Created hash table is initiated as empty (all the
    hash table entries are HTAB_EMPTY_ENTRY).  The function returns the
@@ -374,6 +397,62 @@ htab_create_typed_alloc (size_t size, htab_hash hash_f, htab_eq eq_f,
   return result;
 }
 
+/*
+
+@deftypefn Supplemental htab_t htab_create_alloc_flags (size_t @var{size}, @
+htab_hash @var{hash_f}, htab_eq @var{eq_f}, htab_del @var{del_f}, @
+htab_alloc @var{alloc_f}, htab_free @var{free_f}, unsigned int @var{flags})
+
+This function is like @code{htab_create_alloc}, but also takes a mask
+of @code{HTAB_*} @var{flags} that select how the table works:
+
+@table @code
+@item HTAB_STORE_HASHES
+The table also stores the hash value of each element, in the same
+allocation as its entries.  Searching the table then only calls
+@var{eq_f} for elements whose hash values match, and expanding the
+table does not call @var{hash_f}.  This makes the table larger, but
+saves looking at the elements themselves.  Elements must only be
+stored in slots returned by @code{htab_find_slot} or
+@code{htab_find_slot_with_hash} for an element with the same hash
+value.
+@end table
+
+@end deftypefn
+
+*/
+
+htab_t
+htab_create_alloc_flags (size_t size, htab_hash hash_f, htab_eq eq_f,
+			 htab_del del_f, htab_alloc alloc_f,
+			 htab_free free_f, unsigned int flags)
+{
+  htab_t result;
+  unsigned int size_prime_index;
+
+  size_prime_index = higher_prime_index (size);
+  size = prime_tab[size_prime_index].prime;
+
+  result = (htab_t) (*alloc_f) (1, sizeof (struct htab));
+  if (result == NULL)
+    return NULL;
+  result->flags = flags;
+  result->entries = (void **) (*alloc_f) (size, htab_entry_size (result));
+  if (result->entries == NULL)
+    {
+      if (free_f != NULL)
+	(*free_f) (result);
+      return NULL;
+    }
+  result->size = size;
+  result->size_prime_index = size_prime_index;
+  result->hash_f = hash_f;
+  result->eq_f = eq_f;
+  result->del_f = del_f;
+  result->alloc_f = alloc_f;
+  result->free_f = free_f;
+  return result;
+}
 
 /* Update the function pointers and allocation parameter in the htab_t.  */
 
@@ -460,7 +539,8 @@ htab_empty (htab_t htab)
 	htab->entries = (void **) (*htab->alloc_with_arg_f) (htab->alloc_arg, nsize,
 							     sizeof (void *));
       else
-	htab->entries = (void **) (*htab->alloc_f) (nsize, sizeof (void *));
+	htab->entries = (void **) (*htab->alloc_f) (nsize,
+						    htab_entry_size (htab));
      htab->size = nsize;
      htab->size_prime_index = nindex;
     }
@@ -520,10 +600,12 @@ htab_expand (htab_t htab)
   void **olimit;
   void **p;
   void **nentries;
+  hashval_t *ohashes, *nhashes;
   size_t nsize, osize, elts;
   unsigned int oindex, nindex;
 
   oentries = htab->entries;
+  ohashes = htab_hashes (htab);
   oindex = htab->size_prime_index;
   osize = htab->size;
   olimit = oentries + osize;
@@ -546,11 +628,12 @@ htab_expand (htab_t htab)
     nentries = (void **) (*htab->alloc_with_arg_f) (htab->alloc_arg, nsize,
 						    sizeof (void *));
   else
-    nentries = (void **) (*htab->alloc_f) (nsize, sizeof (void *));
+    nentries = (void **) (*htab->alloc_f) (nsize, htab_entry_size (htab));
   if (nentries == NULL)
     return 0;
   htab->entries = nentries;
   htab->size = nsize;
+  nhashes = htab_hashes (htab);
   htab->size_prime_index = nindex;
   htab->n_elements -= htab->n_deleted;
   htab->n_deleted = 0;
@@ -562,9 +645,17 @@ htab_expand (htab_t htab)
 
       if (x != HTAB_EMPTY_ENTRY && x != HTAB_DELETED_ENTRY)
 	{
-	  void **q = find_empty_slot_for_expand (htab, (*htab->hash_f) (x));
-
+	  hashval_t hash;
+	  void **q;
+
+	  if (ohashes != NULL)
+	    hash = ohashes[p - oentries];
+	  else
+	    hash = (*htab->hash_f) (x);
+	  q = find_empty_slot_for_expand (htab, hash);
 	  *q = x;
+	  if (nhashes != NULL)
+	    nhashes[q - nentries] = hash;
 	}
 
       p++;
@@ -585,16 +676,20 @@ void *
 htab_find_with_hash (htab_t htab, const void *element, hashval_t hash)
 {
   hashval_t index, hash2;
+  hashval_t *hashes;
   size_t size;
   void *entry;
 
   htab->searches++;
   size = htab_size (htab);
+  hashes = htab_hashes (htab);
   index = htab_mod (hash, htab);
 
   entry = htab->entries[index];
   if (entry == HTAB_EMPTY_ENTRY
-      || (entry != HTAB_DELETED_ENTRY && (*htab->eq_f) (entry, element)))
+      || (entry != HTAB_DELETED_ENTRY
+	  && (hashes == NULL || hashes[index] == hash)
+	  && (*htab->eq_f) (entry, element)))
     return entry;
 
   hash2 = htab_mod_m2 (hash, htab);
@@ -607,7 +702,9 @@ htab_find_with_hash (htab_t htab, const void *element, hashval_t hash)
 
       entry = htab->entries[index];
       if (entry == HTAB_EMPTY_ENTRY
-	  || (entry != HTAB_DELETED_ENTRY && (*htab->eq_f) (entry, element)))
+	  || (entry != HTAB_DELETED_ENTRY
+	      && (hashes == NULL || hashes[index] == hash)
+	      && (*htab->eq_f) (entry, element)))
 	return entry;
     }
 }
@@ -635,6 +732,7 @@ htab_find_slot_with_hash (htab_t htab, const void *element,
 {
   void **first_deleted_slot;
   hashval_t index, hash2;
+  hashval_t *hashes;
   size_t size;
   void *entry;
 
@@ -645,6 +743,7 @@ htab_find_slot_with_hash (htab_t htab, const void *element,
 	return NULL;
       size = htab_size (htab);
     }
+  hashes = htab_hashes (htab);
 
   index = htab_mod (hash, htab);
 
@@ -656,7 +755,8 @@ htab_find_slot_with_hash (htab_t htab, const void *element,
     goto empty_entry;
   else if (entry == HTAB_DELETED_ENTRY)
     first_deleted_slot = &htab->entries[index];
-  else if ((*htab->eq_f) (entry, element))
+  else if ((hashes == NULL || hashes[index] == hash)
+	   && (*htab->eq_f) (entry, element))
     return &htab->entries[index];
       
   hash2 = htab_mod_m2 (hash, htab);
@@ -675,7 +775,8 @@ htab_find_slot_with_hash (htab_t htab, const void *element,
 	  if (!first_deleted_slot)
 	    first_deleted_slot = &htab->entries[index];
 	}
-      else if ((*htab->eq_f) (entry, element))
+      else if ((hashes == NULL || hashes[index] == hash)
+	       && (*htab->eq_f) (entry, element))
 	return &htab->entries[index];
     }
 
@@ -687,10 +788,14 @@ htab_find_slot_with_hash (htab_t htab, const void *element,
     {
       htab->n_deleted--;
       *first_deleted_slot = HTAB_EMPTY_ENTRY;
+      if (hashes != NULL)
+	hashes[first_deleted_slot - htab->entries] = hash;
       return first_deleted_slot;
     }
 
   htab->n_elements++;
+  if (hashes != NULL)
+    hashes[index] = hash;
   return &htab->entries[index];
 }
 
@@ -0,0 +1,147 @@
+/* Demangler benchmark.
+
+   Copyright (C) 2022 Free Software Foundation, Inc.
+
+   This file is part of GNU libiberty.
+
+   This program is free software; you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation; either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+
+/* Read mangled names from standard input, one per line, and time
+   demangling all of them with cplus_demangle_v3, which allocates the
+   result for each name, and with cplus_demangle_v3_ctx, which reuses
+   one context for them all.  Check that both give the same results.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include "demangle.h"
+
+static char *program_name;
+
+#define DEFAULT_PASSES 10
+
+static void
+print_usage (FILE *fp, int exit_value)
+{
+  fprintf (fp, "Usage: %s [OPTION]... < NAMES\n", program_name);
+  fprintf (fp, "Options:\n");
+  fprintf (fp, "  -h           Display this message.\n");
+  fprintf (fp, "  -n PASSES    Demangle the names PASSES times.\n");
+  fprintf (fp, "               The default is %d.\n", DEFAULT_PASSES);
+
+  exit (exit_value);
+}
+
+int
+main (int argc, char *argv[])
+{
+  int options = DMGL_PARAMS | DMGL_ANSI | DMGL_TYPES;
+  int passes = DEFAULT_PASSES;
+  char **names = NULL;
+  size_t count = 0, alloc = 0, i;
+  size_t demangled = 0, mismatches = 0;
+  char line[4096];
+  struct cplus_demangle_ctx *ctx;
+  clock_t start, fresh_time, ctx_time;
+  int optchr, pass;
+
+  program_name = argv[0];
+
+  do
+    {
+      optchr = getopt (argc, argv, "hn:");
+      switch (optchr)
+	{
+	case '?':  /* Unrecognized option.  */
+	  print_usage (stderr, 1);
+	  break;
+
+	case 'h':
+	  print_usage (stdout, 0);
+	  break;
+
+	case 'n':
+	  passes = atoi (optarg);
+	  break;
+	}
+    }
+  while (optchr != -1);
+
+  while (fgets (line, sizeof line, stdin) != NULL)
+    {
+      line[strcspn (line, "\r\n")] = '\0';
+      if (line[0] == '\0')
+	continue;
+      if (count == alloc)
+	{
+	  alloc = alloc ? alloc * 2 : 1024;
+	  names = (char **) realloc (names, alloc * sizeof (*names));
+	  if (names == NULL)
+	    abort ();
+	}
+      names[count] = strdup (line);
+      if (names[count] == NULL)
+	abort ();
+      count++;
+    }
+
+  ctx = cplus_demangle_ctx_new ();
+  if (ctx == NULL)
+    abort ();
+
+  for (i = 0; i < count; i++)
+    {
+      char *fresh = cplus_demangle_v3 (names[i], options);
+      const char *reused = cplus_demangle_v3_ctx (names[i], options, ctx);
+
+      if (fresh != NULL)
+	demangled++;
+      if (fresh != NULL
+	  ? reused == NULL || strcmp (fresh, reused) != 0
+	  : reused != NULL)
+	{
+	  printf ("%s: mismatch for %s\n", program_name, names[i]);
+	  mismatches++;
+	}
+      free (fresh);
+    }
+
+  start = clock ();
+  for (pass = 0; pass < passes; pass++)
+    for (i = 0; i < count; i++)
+      free (cplus_demangle_v3 (names[i], options));
+  fresh_time = clock () - start;
+
+  start = clock ();
+  for (pass = 0; pass < passes; pass++)
+    for (i = 0; i < count; i++)
+      cplus_demangle_v3_ctx (names[i], options, ctx);
+  ctx_time = clock () - start;
+
+  printf ("%s: %lu names, %lu demangled, %d passes\n", program_name,
+	  (unsigned long) count, (unsigned long) demangled, passes);
+  printf ("%s: cplus_demangle_v3:     %.3f s\n", program_name,
+	  (double) fresh_time / CLOCKS_PER_SEC);
+  printf ("%s: cplus_demangle_v3_ctx: %.3f s\n", program_name,
+	  (double) ctx_time / CLOCKS_PER_SEC);
+
+  cplus_demangle_ctx_free (ctx);
+  for (i = 0; i < count; i++)
+    free (names[i]);
+  free (names);
+
+  exit (mismatches != 0);
+}
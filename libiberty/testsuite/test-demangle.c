@@ -185,6 +185,7 @@ main(argc, argv)
   char *result;
   int failures = 0;
   int tests = 0;
+  struct cplus_demangle_ctx *ctx;
 
   if (argc > 1)
     {
@@ -195,6 +196,7 @@ main(argc, argv)
   format.data = 0;
   input.data = 0;
   expect.data = 0;
+  ctx = cplus_demangle_ctx_new ();
 
   for (;;)
     {
@@ -318,6 +320,27 @@ main(argc, argv)
 				     | (ret_postfix ? DMGL_RET_POSTFIX : 0)
 				     | (ret_drop ? DMGL_RET_DROP : 0)));
 
+      /* A context kept from one name to the next must give the same
+	 result as demangling each name afresh.  */
+      if (style == auto_demangling || style == gnu_v3_demangling)
+	{
+	  int options = (DMGL_PARAMS | DMGL_ANSI | DMGL_TYPES
+			 | (ret_postfix ? DMGL_RET_POSTFIX : 0)
+			 | (ret_drop ? DMGL_RET_DROP : 0));
+	  char *fresh = cplus_demangle_v3 (inp, options);
+	  const char *reused = cplus_demangle_v3_ctx (inp, options, ctx);
+
+	  if (fresh != NULL
+	      ? reused == NULL || strcmp (fresh, reused) != 0
+	      : reused != NULL)
+	    {
+	      fail (lineno, format.data, input.data, reused,
+		    fresh != NULL ? fresh : "(null)");
+	      failures++;
+	    }
+	  free (fresh);
+	}
+
       if (result
 	  ? strcmp (result, expect.data)
 	  : strcmp (input.data, expect.data))
@@ -346,6 +369,7 @@ main(argc, argv)
   free (format.data);
   free (input.data);
   free (expect.data);
+  cplus_demangle_ctx_free (ctx);
 
   printf ("%s: %d tests, %d failures\n", argv[0], tests, failures);
   return failures ? 1 : 0;
@@ -35,11 +35,35 @@ enum map_type
   MAP_DATA
 };
 
+/* A symbol in INFO->SYMTAB which says whether code or data follows it:
+   a mapping symbol, or a function symbol.  */
+struct aarch64_mapping_sym
+{
+  /* The id of the symbol's section plus one, or zero if mapping symbols
+     are not being kept apart by section.  */
+  unsigned int section_key;
+  bfd_vma addr;
+  int n;			/* Index in INFO->SYMTAB.  */
+  enum map_type type;
+};
+
+/* Private data for print_insn_aarch64, kept in INFO->PRIVATE_DATA.  */
+struct aarch64_private_data
+{
+  /* The symbol table that MAPPING_SYMS was built from, and whether
+     INFO->SECTION was set at the time.  */
+  asymbol **symtab;
+  int symtab_size;
+  bool by_section;
+
+  /* The mapping symbols in SYMTAB, sorted by section key, address and
+     index, so that the one in effect at an address can be found with a
+     binary search rather than by scanning the symbol table.  */
+  int mapping_sym_count;
+  struct aarch64_mapping_sym mapping_syms[];
+};
+
 static aarch64_feature_set arch_variant; /* See select_aarch64_variant.  */
-static enum map_type last_type;
-static int last_mapping_sym = -1;
-static bfd_vma last_stop_offset = 0;
-static bfd_vma last_mapping_addr = 0;
 
 /* Other options */
 static int no_aliases = 0;	/* If set disassemble as most general inst.  */
@@ -3631,6 +3655,108 @@ select_aarch64_variant (unsigned mach)
     }
 }
 
+/* qsort comparison function for struct aarch64_mapping_sym.  */
+
+static int
+compare_mapping_syms (const void *a, const void *b)
+{
+  const struct aarch64_mapping_sym *sa = a;
+  const struct aarch64_mapping_sym *sb = b;
+
+  if (sa->section_key != sb->section_key)
+    return sa->section_key < sb->section_key ? -1 : 1;
+  if (sa->addr != sb->addr)
+    return sa->addr < sb->addr ? -1 : 1;
+  return sa->n - sb->n;
+}
+
+/* Return the private data for INFO, (re)building its index of mapping
+   symbols if INFO->SYMTAB has changed since it was built.  */
+
+static struct aarch64_private_data *
+get_private_data (struct disassemble_info *info)
+{
+  struct aarch64_private_data *priv = info->private_data;
+  bool by_section = info->section != NULL;
+  enum map_type type;
+  int n, count;
+
+  if (priv != NULL
+      && priv->symtab == info->symtab
+      && priv->symtab_size == info->symtab_size
+      && priv->by_section == by_section)
+    return priv;
+
+  /* get_sym_code_type ignores symbols in other sections, so call it
+     with no section and keep the sections apart in the index instead.  */
+  asection *section = info->section;
+  info->section = NULL;
+
+  count = 0;
+  for (n = 0; n < info->symtab_size; n++)
+    if (get_sym_code_type (info, n, &type))
+      count++;
+
+  priv = xrealloc (priv, (sizeof (*priv)
+			  + count * sizeof (struct aarch64_mapping_sym)));
+  priv->symtab = info->symtab;
+  priv->symtab_size = info->symtab_size;
+  priv->by_section = by_section;
+  priv->mapping_sym_count = count;
+
+  count = 0;
+  for (n = 0; n < info->symtab_size; n++)
+    if (get_sym_code_type (info, n, &type))
+      {
+	struct aarch64_mapping_sym *ms = &priv->mapping_syms[count++];
+
+	ms->section_key = by_section ? info->symtab[n]->section->id + 1 : 0;
+	ms->addr = bfd_asymbol_value (info->symtab[n]);
+	ms->n = n;
+	ms->type = type;
+      }
+  qsort (priv->mapping_syms, count, sizeof (struct aarch64_mapping_sym),
+	 compare_mapping_syms);
+
+  info->section = section;
+  info->private_data = priv;
+  return priv;
+}
+
+/* Find the last mapping symbol at or before PC in the section being
+   disassembled.  If there is one, set *MAP_TYPE from it and return its
+   index in INFO->SYMTAB, otherwise return -1.  */
+
+static int
+find_mapping_sym (struct disassemble_info *info, bfd_vma pc,
+		  enum map_type *map_type)
+{
+  struct aarch64_private_data *priv = get_private_data (info);
+  unsigned int section_key = 0;
+  int lo = 0, hi = priv->mapping_sym_count;
+
+  if (info->section != NULL)
+    section_key = info->section->id + 1;
+
+  while (lo < hi)
+    {
+      int mid = lo + (hi - lo) / 2;
+      const struct aarch64_mapping_sym *ms = &priv->mapping_syms[mid];
+
+      if (ms->section_key < section_key
+	  || (ms->section_key == section_key && ms->addr <= pc))
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+
+  if (lo == 0 || priv->mapping_syms[lo - 1].section_key != section_key)
+    return -1;
+
+  *map_type = priv->mapping_syms[lo - 1].type;
+  return priv->mapping_syms[lo - 1].n;
+}
+
 /* Entry-point of the AArch64 disassembler.  */
 
 int
@@ -3641,7 +3767,6 @@ print_insn_aarch64 (bfd_vma pc,
   int		status;
   void		(*printer) (bfd_vma, uint32_t, struct disassemble_info *,
 			    aarch64_operand_error *);
-  bool   found = false;
   unsigned int	size = 4;
   unsigned long	data;
   aarch64_operand_error errors;
@@ -3683,85 +3808,26 @@ print_insn_aarch64 (bfd_vma pc,
   if (info->symtab_size != 0
       && bfd_asymbol_flavour (*info->symtab) == bfd_target_elf_flavour)
     {
-      int last_sym = -1;
-      bfd_vma addr, section_vma = 0;
-      bool can_use_search_opt_p;
+      int last_sym;
+      bfd_vma addr;
       int n;
 
-      if (pc <= last_mapping_addr)
-	last_mapping_sym = -1;
-
-      /* Start scanning at the start of the function, or wherever
-	 we finished last time.  */
-      n = info->symtab_pos + 1;
-
-      /* If the last stop offset is different from the current one it means we
-	 are disassembling a different glob of bytes.  As such the optimization
-	 would not be safe and we should start over.  */
-      can_use_search_opt_p = last_mapping_sym >= 0
-			     && info->stop_offset == last_stop_offset;
-
-      if (n >= last_mapping_sym && can_use_search_opt_p)
-	n = last_mapping_sym;
-
-      /* Look down while we haven't passed the location being disassembled.
-	 The reason for this is that there's no defined order between a symbol
-	 and an mapping symbol that may be at the same address.  We may have to
-	 look at least one position ahead.  */
-      for (; n < info->symtab_size; n++)
-	{
-	  addr = bfd_asymbol_value (info->symtab[n]);
-	  if (addr > pc)
-	    break;
-	  if (get_sym_code_type (info, n, &type))
-	    {
-	      last_sym = n;
-	      found = true;
-	    }
-	}
-
-      if (!found)
-	{
-	  n = info->symtab_pos;
-	  if (n >= last_mapping_sym && can_use_search_opt_p)
-	    n = last_mapping_sym;
-
-	  /* No mapping symbol found at this address.  Look backwards
-	     for a preceeding one, but don't go pass the section start
-	     otherwise a data section with no mapping symbol can pick up
-	     a text mapping symbol of a preceeding section.  The documentation
-	     says section can be NULL, in which case we will seek up all the
-	     way to the top.  */
-	  if (info->section)
-	    section_vma = info->section->vma;
-
-	  for (; n >= 0; n--)
-	    {
-	      addr = bfd_asymbol_value (info->symtab[n]);
-	      if (addr < section_vma)
-		break;
-
-	      if (get_sym_code_type (info, n, &type))
-		{
-		  last_sym = n;
-		  found = true;
-		  break;
-		}
-	    }
-	}
-
-      last_mapping_sym = last_sym;
-      last_type = type;
-      last_stop_offset = info->stop_offset;
+      last_sym = find_mapping_sym (info, pc, &type);
 
       /* Look a little bit ahead to see if we should print out
 	 less than four bytes of data.  If there's a symbol,
 	 mapping or otherwise, after two bytes then don't
 	 print more.  */
-      if (last_type == MAP_DATA)
+      if (type == MAP_DATA)
 	{
 	  size = 4 - (pc & 3);
-	  for (n = last_sym + 1; n < info->symtab_size; n++)
+
+	  /* The symbols up to the one being printed, at SYMTAB_POS,
+	     are all before PC.  */
+	  n = last_sym + 1;
+	  if (n <= info->symtab_pos)
+	    n = info->symtab_pos + 1;
+	  for (; n < info->symtab_size; n++)
 	    {
 	      addr = bfd_asymbol_value (info->symtab[n]);
 	      if (addr > pc)
@@ -3778,11 +3844,9 @@ print_insn_aarch64 (bfd_vma pc,
 	    size = (pc & 1) ? 1 : 2;
 	}
     }
-  else
-    last_type = type;
 
   /* PR 10263: Disassemble data if requested to do so by the user.  */
-  if (last_type == MAP_DATA && ((info->flags & DISASSEMBLE_DATA) == 0))
+  if (type == MAP_DATA && ((info->flags & DISASSEMBLE_DATA) == 0))
     {
       /* size was set above.  */
       info->bytes_per_chunk = size;
@@ -3810,6 +3874,62 @@ print_insn_aarch64 (bfd_vma pc,
 
   return size;
 }
+
+/* Like print_insn_aarch64, but only decode the instruction at PC to fill
+   in the branch information in INFO, and print nothing.  Mapping symbols
+   are not consulted; the bytes at PC are always taken to be an
+   instruction.  Return the length of the instruction, or -1 on error.  */
+
+int
+length_insn_aarch64 (bfd_vma pc, struct disassemble_info *info)
+{
+  bfd_byte buffer[INSNLEN];
+  aarch64_operand_error errors;
+  aarch64_inst inst;
+  int status, i;
+
+  status = (*info->read_memory_func) (pc, buffer, INSNLEN, info);
+  if (status != 0)
+    {
+      (*info->memory_error_func) (status, pc, info);
+      return -1;
+    }
+
+  info->insn_info_valid = 1;
+  info->branch_delay_insns = 0;
+  info->data_size = 0;
+  info->target = 0;
+  info->target2 = 0;
+
+  /* See print_insn_aarch64_word.  */
+  if (info->flags & INSN_HAS_RELOC)
+    pc = 0;
+
+  if (aarch64_decode_insn (bfd_getl32 (buffer), &inst, true, &errors)
+      != ERR_OK)
+    return INSNLEN;
+
+  for (i = 0; i < AARCH64_MAX_OPND_NUM; ++i)
+    switch (inst.operands[i].type)
+      {
+      case AARCH64_OPND_ADDR_ADRP:
+	info->target = (((pc + AARCH64_PCREL_OFFSET) & ~(uint64_t) 0xfff)
+			+ inst.operands[i].imm.value);
+	break;
+
+      case AARCH64_OPND_ADDR_PCREL14:
+      case AARCH64_OPND_ADDR_PCREL19:
+      case AARCH64_OPND_ADDR_PCREL21:
+      case AARCH64_OPND_ADDR_PCREL26:
+	info->target = pc + AARCH64_PCREL_OFFSET + inst.operands[i].imm.value;
+	break;
+
+      default:
+	break;
+      }
+
+  return INSNLEN;
+}
 
 void
 print_aarch64_disassembler_options (FILE *stream)
@@ -558,6 +558,32 @@ disassembler (enum bfd_architecture a,
   return disassemble;
 }
 
+disassembler_ftype
+disassembler_length (enum bfd_architecture a,
+		     bool big ATTRIBUTE_UNUSED,
+		     unsigned long mach ATTRIBUTE_UNUSED,
+		     bfd *abfd ATTRIBUTE_UNUSED)
+{
+  switch (a)
+    {
+#ifdef ARCH_aarch64
+    case bfd_arch_aarch64:
+      return length_insn_aarch64;
+#endif
+#ifdef ARCH_i386
+    case bfd_arch_i386:
+    case bfd_arch_iamcu:
+      return length_insn_i386;
+#endif
+#ifdef ARCH_riscv
+    case bfd_arch_riscv:
+      return length_insn_riscv;
+#endif
+    default:
+      return NULL;
+    }
+}
+
 void
 disassembler_usage (FILE *stream ATTRIBUTE_UNUSED)
 {
@@ -760,6 +786,10 @@ disassemble_free_target (struct disassemble_info *info)
       break;
 #endif
 
+#ifdef ARCH_aarch64
+    case bfd_arch_aarch64:
+      break;
+#endif
 #ifdef ARCH_arc
     case bfd_arch_arc:
       break;
@@ -227,6 +227,10 @@ struct instr_info
 
   bool two_source_ops;
 
+  /* Only the length and branch target of the instruction are wanted;
+     nothing is printed.  */
+  bool length_only;
+
   unsigned char op_ad;
   signed char op_index[MAX_OPERANDS];
   bool op_riprel[MAX_OPERANDS];
@@ -9278,6 +9282,9 @@ i386_dis_printf (instr_info *ins, enum disassembler_style style,
   char staging_area[100];
   int res;
 
+  if (ins->length_only)
+    return 1;
+
   va_start (ap, fmt);
   res = vsnprintf (staging_area, sizeof (staging_area), fmt, ap);
   va_end (ap);
@@ -9345,7 +9352,8 @@ i386_dis_printf (instr_info *ins, enum disassembler_style style,
 }
 
 static int
-print_insn (bfd_vma pc, disassemble_info *info, int intel_syntax)
+print_insn (bfd_vma pc, disassemble_info *info, int intel_syntax,
+	    bool length_only)
 {
   const struct dis386 *dp;
   int i;
@@ -9363,6 +9371,7 @@ print_insn (bfd_vma pc, disassemble_info *info, int intel_syntax)
 		    ? intel_syntax
 		    : (info->mach & bfd_mach_i386_intel_syntax) != 0,
     .intel_mnemonic = !SYSV386_COMPAT,
+    .length_only = length_only,
     .op_index[0 ... MAX_OPERANDS - 1] = -1,
     .start_pc = pc,
     .start_codep = priv.the_buffer,
@@ -9795,6 +9804,21 @@ print_insn (bfd_vma pc, disassemble_info *info, int intel_syntax)
       return MAX_CODE_LENGTH;
     }
 
+  /* Everything after this point is only about printing, apart from
+     recording the branch target.  */
+  if (ins.length_only)
+    {
+      if (ins.op_is_jump)
+	for (i = 0; i < MAX_OPERANDS; ++i)
+	  if (ins.op_index[i] != -1 && !ins.op_riprel[i])
+	    {
+	      info->insn_info_valid = 1;
+	      info->target = (bfd_vma) ins.op_address[ins.op_index[i]];
+	      break;
+	    }
+      return ins.codep - priv.the_buffer;
+    }
+
   /* Calculate the number of operands this instruction has.  */
   op_count = 0;
   for (i = 0; i < MAX_OPERANDS; ++i)
@@ -9909,19 +9933,28 @@ print_insn (bfd_vma pc, disassemble_info *info, int intel_syntax)
 int
 print_insn_i386_att (bfd_vma pc, disassemble_info *info)
 {
-  return print_insn (pc, info, 0);
+  return print_insn (pc, info, 0, false);
 }
 
 int
 print_insn_i386_intel (bfd_vma pc, disassemble_info *info)
 {
-  return print_insn (pc, info, 1);
+  return print_insn (pc, info, 1, false);
 }
 
 int
 print_insn_i386 (bfd_vma pc, disassemble_info *info)
 {
-  return print_insn (pc, info, -1);
+  return print_insn (pc, info, -1, false);
+}
+
+/* Like print_insn_i386, but only decode the instruction at PC to work
+   out its length and branch target, and print nothing.  */
+
+int
+length_insn_i386 (bfd_vma pc, disassemble_info *info)
+{
+  return print_insn (pc, info, -1, true);
 }
 
 static const char *float_mem[] = {
@@ -828,7 +828,7 @@ struct template {
   const struct template_param *params;
 };
 
-static const struct template *templates;
+static const struct template *template_list;
 
 static int
 compare (const void *x, const void *y)
@@ -1582,8 +1582,8 @@ parse_template (char *buf, int lineno)
     fprintf(stderr, "%s: %d: excess characters '%s'\n",
 	    filename, lineno, buf);
 
-  tmpl->next = templates;
-  templates = tmpl;
+  tmpl->next = template_list;
+  template_list = tmpl;
 }
 
 static unsigned int
@@ -1652,7 +1652,7 @@ expand_templates (char *name, const char *str, htab_t opcode_hash_table,
 
       *ptr2++ = '\0';
 
-      for ( tmpl = templates; tmpl; tmpl = tmpl->next )
+      for ( tmpl = template_list; tmpl; tmpl = tmpl->next )
 	if (!strcmp(ptr1, tmpl->name))
 	  break;
       if (!tmpl)
@@ -1736,6 +1736,127 @@ expand_templates (char *name, const char *str, htab_t opcode_hash_table,
   return idx;
 }
 
+/* Write out a perfect hash table of the N mnemonics in OPCODE_ARRAY,
+   for use by i386_mnemonic_lookup.  The templates for mnemonic J are
+   at indices START[J] up to START[J + 1] of i386_optab.
+
+   Each mnemonic is first assigned to one of a number of buckets by the
+   low bits of its hash.  The buckets are then placed, largest first,
+   by searching for a displacement which, added to the high bits of
+   the hash of each of its mnemonics, takes them all to free slots.  If
+   no displacement works for some bucket, another hash seed is tried.  */
+
+static void
+output_i386_mnemonics (FILE *table, struct opcode_hash_entry **opcode_array,
+		       const unsigned int *start, unsigned int n)
+{
+  unsigned int nbuckets, nslots, seed, i, j, k, b;
+  unsigned int *hash, *order, *bucket_size, *disp;
+  int *slot;
+
+  for (nslots = 1; nslots < n + n / 4; nslots <<= 1)
+    ;
+  for (nbuckets = 1; nbuckets < n / 4; nbuckets <<= 1)
+    ;
+  if (nslots > 0x10000)
+    fail (_("too many mnemonics (%u)\n"), n);
+
+  hash = xmalloc (sizeof (*hash) * n);
+  order = xmalloc (sizeof (*order) * nbuckets);
+  bucket_size = xmalloc (sizeof (*bucket_size) * nbuckets);
+  disp = xmalloc (sizeof (*disp) * nbuckets);
+  slot = xmalloc (sizeof (*slot) * nslots);
+
+  for (seed = 0; seed < 1000; seed++)
+    {
+      for (j = 0; j < n; j++)
+	hash[j] = i386_mnemonic_hash (opcode_array[j]->name, seed);
+
+      /* Sort the buckets by decreasing size.  */
+      memset (bucket_size, 0, sizeof (*bucket_size) * nbuckets);
+      for (j = 0; j < n; j++)
+	bucket_size[hash[j] % nbuckets]++;
+      for (b = 0; b < nbuckets; b++)
+	{
+	  for (k = b; k > 0 && bucket_size[order[k - 1]] < bucket_size[b]; k--)
+	    order[k] = order[k - 1];
+	  order[k] = b;
+	}
+
+      for (i = 0; i < nslots; i++)
+	slot[i] = -1;
+
+      for (b = 0; b < nbuckets; b++)
+	{
+	  unsigned int bucket = order[b], d;
+
+	  disp[bucket] = 0;
+	  if (bucket_size[bucket] == 0)
+	    continue;
+
+	  for (d = 0; d < nslots; d++)
+	    {
+	      for (j = 0; j < n; j++)
+		if (hash[j] % nbuckets == bucket
+		    && slot[((hash[j] >> 16) + d) % nslots] != -1)
+		  break;
+	      if (j < n)
+		continue;
+
+	      /* The mnemonics of the bucket may also collide with
+		 each other.  */
+	      for (j = 0; j < n; j++)
+		if (hash[j] % nbuckets == bucket)
+		  {
+		    i = ((hash[j] >> 16) + d) % nslots;
+		    if (slot[i] != -1)
+		      break;
+		    slot[i] = j;
+		  }
+	      if (j == n)
+		break;
+	      for (k = 0; k < j; k++)
+		if (hash[k] % nbuckets == bucket)
+		  slot[((hash[k] >> 16) + d) % nslots] = -1;
+	    }
+	  if (d == nslots)
+	    break;
+	  disp[bucket] = d;
+	}
+      if (b == nbuckets)
+	break;
+    }
+  if (seed == 1000)
+    fail (_("can't find a perfect hash for the mnemonics\n"));
+
+  fprintf (table, "\n/* i386 mnemonic perfect hash table.  */\n\n");
+  fprintf (table, "#define I386_MNEMONIC_SEED %u\n", seed);
+  fprintf (table, "#define I386_MNEMONIC_BUCKETS %u\n", nbuckets);
+  fprintf (table, "#define I386_MNEMONIC_SLOTS %u\n\n", nslots);
+
+  fprintf (table,
+	   "static const unsigned short i386_mnemonic_disp[] =\n{");
+  for (b = 0; b < nbuckets; b++)
+    fprintf (table, "%s%u,", b % 8 == 0 ? "\n  " : " ", disp[b]);
+  fprintf (table, "\n};\n\n");
+
+  fprintf (table, "static const templates i386_mnemonics[] =\n{\n");
+  for (i = 0; i < nslots; i++)
+    if (slot[i] == -1)
+      fprintf (table, "  { NULL, NULL },\n");
+    else
+      fprintf (table, "  { &i386_optab[%u], &i386_optab[%u] }, /* %s */\n",
+	       start[slot[i]], start[slot[i] + 1],
+	       opcode_array[slot[i]]->name);
+  fprintf (table, "};\n");
+
+  free (hash);
+  free (order);
+  free (bucket_size);
+  free (disp);
+  free (slot);
+}
+
 static void
 process_i386_opcodes (FILE *table)
 {
@@ -1745,6 +1866,7 @@ process_i386_opcodes (FILE *table)
   char *str, *p, *last, *name;
   htab_t opcode_hash_table;
   struct opcode_hash_entry **opcode_array = NULL;
+  unsigned int *mnemonic_start, idx = 0;
   int lineno = 0, marker = 0;
 
   filename = "i386-opc.tbl";
@@ -1821,10 +1943,12 @@ process_i386_opcodes (FILE *table)
     }
 
   /* Process opcode array.  */
+  mnemonic_start = xmalloc (sizeof (*mnemonic_start) * (i + 1));
   for (j = 0; j < i; j++)
     {
       struct opcode_hash_entry *next;
 
+      mnemonic_start[j] = idx;
       for (next = opcode_array[j]; next; next = next->next)
 	{
 	  name = next->name;
@@ -1832,8 +1956,10 @@ process_i386_opcodes (FILE *table)
 	  lineno = next->lineno;
 	  last = str + strlen (str);
 	  output_i386_opcode (table, name, str, last, lineno);
+	  idx++;
 	}
     }
+  mnemonic_start[i] = idx;
 
   fclose (fp);
 
@@ -1848,6 +1974,9 @@ process_i386_opcodes (FILE *table)
   fprintf (table, " } }\n");
 
   fprintf (table, "};\n");
+
+  output_i386_mnemonics (table, opcode_array, mnemonic_start, i);
+  free (mnemonic_start);
 }
 
 static void
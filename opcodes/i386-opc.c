@@ -23,6 +23,24 @@
 #include "i386-opc.h"
 #include "i386-tbl.h"
 
+/* Look up mnemonic NAME in the perfect hash table generated by
+   i386-gen.  Only one slot needs to be checked.  */
+
+const templates *
+i386_mnemonic_lookup (const char *name)
+{
+  unsigned int h = i386_mnemonic_hash (name, I386_MNEMONIC_SEED);
+  unsigned int slot;
+  const templates *t;
+
+  slot = ((h >> 16) + i386_mnemonic_disp[h % I386_MNEMONIC_BUCKETS])
+	 % I386_MNEMONIC_SLOTS;
+  t = &i386_mnemonics[slot];
+  if (t->start == NULL || strcmp (t->start->name, name) != 0)
+    return NULL;
+  return t;
+}
+
 /* To be indexed by segment register number.  */
 const unsigned char i386_seg_prefixes[] = {
   ES_PREFIX_OPCODE,
@@ -973,6 +973,34 @@ insn_template;
 
 extern const insn_template i386_optab[];
 
+/* 'templates' is for grouping together the 'insn_template' structures
+   of i386_optab with the same name.  The templates themselves start at
+   START and range up to (but not including) END.  */
+typedef struct
+{
+  const insn_template *start;
+  const insn_template *end;
+}
+templates;
+
+/* Return the templates for mnemonic NAME, or NULL if there is no such
+   mnemonic.  The lookup uses a perfect hash table generated by
+   i386-gen, so nothing needs to be set up at run time.  */
+extern const templates *i386_mnemonic_lookup (const char *);
+
+/* The hash function used for the table searched by
+   i386_mnemonic_lookup.  SEED is chosen by i386-gen so that the
+   table has no collisions.  */
+static inline unsigned int
+i386_mnemonic_hash (const char *name, unsigned int seed)
+{
+  unsigned int h = 2166136261u + seed * 0x9e3779b9u;
+
+  for (; *name != '\0'; name++)
+    h = ((h ^ (unsigned char) *name) * 16777619u) & 0xffffffffu;
+  return h;
+}
+
 /* these are for register name --> number & type hash lookup */
 typedef struct
 {
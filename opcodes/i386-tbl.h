@@ -58930,6 +58930,4244 @@ const insn_template i386_optab[] =
 	  0, 0, 0, 0, 0, 0 } } } }
 };
 
+/* i386 mnemonic perfect hash table.  */
+
+#define I386_MNEMONIC_SEED 1
+#define I386_MNEMONIC_BUCKETS 1024
+#define I386_MNEMONIC_SLOTS 4096
+
+static const unsigned short i386_mnemonic_disp[] =
+{
+  0, 4, 1, 1, 0, 0, 4, 0,
+  2, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 5, 1, 0, 0, 0, 0,
+  3, 2, 0, 0, 2, 0, 0, 0,
+  7, 3, 4, 0, 2, 1, 0, 2,
+  0, 0, 2, 0, 0, 0, 4, 1,
+  0, 0, 0, 4, 0, 0, 4, 1,
+  0, 1, 2, 1, 0, 0, 0, 2,
+  1, 1, 2, 3, 6, 1, 3, 0,
+  0, 4, 0, 0, 2, 2, 1, 1,
+  2, 0, 1, 2, 3, 0, 5, 2,
+  0, 1, 0, 1, 0, 14, 1, 0,
+  0, 0, 0, 0, 3, 0, 2, 0,
+  0, 7, 0, 0, 2, 9, 1, 1,
+  0, 3, 0, 3, 0, 0, 6, 3,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  2, 5, 7, 6, 0, 0, 0, 0,
+  8, 5, 2, 0, 5, 1, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0,
+  2, 0, 0, 1, 1, 0, 0, 4,
+  0, 0, 0, 0, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0,
+  5, 1, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 2, 0, 3, 0,
+  0, 1, 4, 1, 3, 4, 4, 2,
+  0, 1, 0, 0, 0, 0, 0, 0,
+  3, 2, 3, 0, 0, 1, 0, 0,
+  5, 0, 6, 0, 0, 4, 0, 0,
+  2, 0, 1, 2, 0, 1, 3, 0,
+  0, 3, 0, 1, 1, 1, 0, 0,
+  1, 1, 0, 1, 0, 0, 0, 0,
+  1, 0, 0, 0, 1, 2, 1, 3,
+  4, 0, 0, 2, 0, 1, 0, 0,
+  0, 0, 7, 1, 0, 7, 2, 0,
+  0, 0, 0, 0, 0, 5, 3, 0,
+  0, 0, 0, 0, 2, 2, 7, 0,
+  2, 1, 3, 0, 2, 10, 0, 1,
+  0, 0, 0, 3, 1, 0, 1, 7,
+  0, 0, 0, 1, 2, 3, 4, 9,
+  0, 1, 2, 0, 0, 3, 1, 1,
+  2, 1, 7, 0, 0, 1, 2, 0,
+  4, 0, 2, 2, 0, 2, 0, 0,
+  0, 6, 0, 0, 9, 2, 3, 0,
+  0, 0, 1, 0, 11, 10, 0, 7,
+  0, 0, 1, 0, 0, 0, 0, 0,
+  1, 1, 1, 0, 0, 0, 0, 1,
+  0, 1, 0, 0, 0, 1, 1, 0,
+  1, 0, 1, 2, 4, 0, 6, 0,
+  0, 4, 5, 4, 2, 1, 0, 4,
+  0, 2, 2, 0, 0, 3, 0, 1,
+  0, 1, 0, 1, 3, 0, 3, 0,
+  8, 0, 0, 0, 12, 0, 0, 0,
+  0, 0, 2, 4, 0, 2, 0, 0,
+  2, 0, 1, 0, 0, 0, 2, 6,
+  4, 0, 2, 0, 0, 0, 1, 0,
+  0, 0, 3, 2, 0, 0, 0, 0,
+  1, 4, 0, 1, 1, 0, 0, 1,
+  2, 3, 0, 0, 0, 0, 2, 0,
+  1, 0, 9, 1, 0, 0, 5, 0,
+  0, 0, 0, 0, 1, 2, 0, 2,
+  0, 0, 5, 0, 0, 0, 12, 0,
+  1, 4, 3, 3, 3, 4, 0, 0,
+  0, 0, 0, 0, 1, 0, 0, 3,
+  0, 0, 9, 1, 1, 3, 0, 5,
+  3, 6, 1, 0, 2, 0, 1, 3,
+  0, 0, 1, 0, 0, 3, 0, 0,
+  0, 0, 11, 2, 7, 0, 0, 0,
+  0, 0, 1, 0, 1, 5, 1, 0,
+  0, 2, 12, 4, 1, 3, 0, 0,
+  0, 0, 7, 3, 0, 0, 7, 3,
+  3, 0, 0, 2, 0, 0, 1, 2,
+  0, 0, 0, 0, 0, 0, 1, 1,
+  1, 7, 5, 0, 1, 1, 0, 0,
+  0, 0, 2, 0, 0, 0, 2, 0,
+  0, 1, 0, 5, 0, 0, 4, 4,
+  0, 0, 1, 0, 5, 0, 0, 0,
+  7, 9, 0, 0, 0, 2, 0, 1,
+  2, 22, 0, 0, 0, 0, 0, 0,
+  3, 4, 1, 2, 0, 0, 4, 1,
+  0, 5, 1, 0, 0, 0, 1, 3,
+  0, 0, 0, 0, 0, 0, 4, 2,
+  3, 0, 0, 1, 0, 3, 3, 2,
+  3, 8, 0, 3, 2, 0, 0, 0,
+  0, 0, 0, 2, 3, 0, 2, 1,
+  0, 0, 0, 2, 0, 0, 1, 2,
+  2, 2, 6, 0, 0, 3, 0, 0,
+  0, 2, 0, 0, 0, 1, 0, 0,
+  0, 1, 0, 2, 0, 0, 5, 0,
+  0, 3, 20, 1, 1, 2, 9, 4,
+  1, 0, 1, 1, 1, 0, 0, 0,
+  4, 1, 7, 0, 0, 5, 0, 3,
+  0, 0, 0, 0, 1, 2, 1, 0,
+  0, 0, 0, 1, 1, 1, 1, 2,
+  0, 0, 0, 3, 3, 3, 13, 0,
+  4, 1, 9, 3, 0, 0, 0, 0,
+  0, 1, 2, 1, 1, 0, 1, 0,
+  0, 3, 2, 0, 2, 0, 4, 6,
+  0, 5, 1, 0, 2, 0, 0, 3,
+  1, 5, 3, 3, 7, 0, 2, 4,
+  0, 0, 1, 15, 0, 8, 0, 0,
+  0, 0, 0, 2, 1, 0, 19, 3,
+  9, 0, 0, 2, 0, 0, 6, 2,
+  0, 2, 0, 0, 0, 0, 0, 0,
+  5, 0, 7, 0, 1, 11, 1, 5,
+  13, 0, 1, 0, 5, 3, 0, 4,
+  1, 0, 0, 3, 0, 0, 4, 0,
+  4, 0, 0, 1, 1, 5, 0, 0,
+  0, 4, 7, 0, 0, 0, 0, 0,
+  1, 5, 0, 3, 6, 0, 6, 2,
+  0, 8, 0, 18, 2, 1, 0, 7,
+  1, 6, 0, 6, 0, 1, 3, 1,
+  0, 0, 1, 0, 1, 2, 0, 1,
+  1, 2, 1, 2, 0, 0, 1, 0,
+  0, 0, 2, 0, 0, 1, 0, 0,
+  1, 1, 0, 1, 0, 1, 1, 0,
+  0, 10, 0, 0, 0, 7, 7, 7,
+  0, 1, 0, 5, 8, 0, 4, 0,
+  2, 0, 0, 0, 0, 4, 0, 4,
+  0, 5, 0, 0, 3, 0, 1, 1,
+  1, 1, 3, 11, 1, 0, 3, 0,
+  3, 0, 0, 1, 1, 0, 9, 0,
+  0, 0, 0, 7, 5, 0, 15, 0,
+  0, 0, 1, 0, 2, 0, 0, 0,
+  2, 1, 0, 4, 6, 0, 5, 4,
+  3, 0, 1, 5, 0, 2, 0, 7,
+  0, 17, 0, 2, 1, 3, 8, 11,
+  0, 2, 0, 3, 0, 0, 0, 5,
+  4, 0, 0, 2, 0, 0, 0, 0,
+};
+
+static const templates i386_mnemonics[] =
+{
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2829], &i386_optab[2830] }, /* vpshaq */
+  { &i386_optab[3359], &i386_optab[3360] }, /* vinserti32x8 */
+  { &i386_optab[2305], &i386_optab[2306] }, /* vpor */
+  { &i386_optab[505], &i386_optab[511] }, /* fdivp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2407], &i386_optab[2409] }, /* vsqrtss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3556], &i386_optab[3557] }, /* vcmpordph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1190], &i386_optab[1192] }, /* cvtsd2si */
+  { &i386_optab[686], &i386_optab[687] }, /* cmovnl */
+  { NULL, NULL },
+  { &i386_optab[377], &i386_optab[378] }, /* iret */
+  { &i386_optab[2266], &i386_optab[2271] }, /* vpmovzxbq */
+  { &i386_optab[3462], &i386_optab[3463] }, /* wbnoinvd */
+  { &i386_optab[2256], &i386_optab[2261] }, /* vpmovsxwq */
+  { &i386_optab[2391], &i386_optab[2392] }, /* vroundpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3351], &i386_optab[3354] }, /* vcvtuqq2ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2082], &i386_optab[2084] }, /* vmulpd */
+  { &i386_optab[1230], &i386_optab[1232] }, /* addsubps */
+  { &i386_optab[3685], &i386_optab[3687] }, /* vcvtusi2sh */
+  { NULL, NULL },
+  { &i386_optab[2597], &i386_optab[2599] }, /* vfmsub132ps */
+  { NULL, NULL },
+  { &i386_optab[2365], &i386_optab[2367] }, /* vpsubusb */
+  { &i386_optab[1562], &i386_optab[1564] }, /* vcmpnge_uspd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2050], &i386_optab[2051] }, /* vmovmskps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2733], &i386_optab[2734] }, /* vpcomleq */
+  { NULL, NULL },
+  { &i386_optab[2228], &i386_optab[2230] }, /* vpminuw */
+  { &i386_optab[577], &i386_optab[578] }, /* data32 */
+  { NULL, NULL },
+  { &i386_optab[627], &i386_optab[628] }, /* {disp16} */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[87], &i386_optab[88] }, /* cld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3271], &i386_optab[3272] }, /* vpcmpltub */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3625], &i386_optab[3626] }, /* vcmpnle_uqsh */
+  { &i386_optab[2222], &i386_optab[2224] }, /* vpminsw */
+  { NULL, NULL },
+  { &i386_optab[2422], &i386_optab[2424] }, /* vucomiss */
+  { &i386_optab[1139], &i386_optab[1141] }, /* movapd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3635], &i386_optab[3636] }, /* vcmpsh */
+  { &i386_optab[3083], &i386_optab[3084] }, /* vpcmpneqd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1135], &i386_optab[1137] }, /* minpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2469], &i386_optab[2471] }, /* vpsllvd */
+  { &i386_optab[98], &i386_optab[99] }, /* std */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[749], &i386_optab[752] }, /* paddd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[149], &i386_optab[151] }, /* aam */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3343], &i386_optab[3344] }, /* vcvttpd2qq */
+  { &i386_optab[2784], &i386_optab[2785] }, /* vpcomtrueud */
+  { NULL, NULL },
+  { &i386_optab[3402], &i386_optab[3403] }, /* vpopcntd */
+  { NULL, NULL },
+  { &i386_optab[2363], &i386_optab[2365] }, /* vpsubsw */
+  { &i386_optab[887], &i386_optab[890] }, /* punpcklwd */
+  { &i386_optab[2557], &i386_optab[2559] }, /* vfmadd213pd */
+  { NULL, NULL },
+  { &i386_optab[37], &i386_optab[38] }, /* movswq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[44], &i386_optab[45] }, /* movzb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[482], &i386_optab[483] }, /* fisubr */
+  { &i386_optab[1977], &i386_optab[1979] }, /* vdivss */
+  { NULL, NULL },
+  { &i386_optab[3248], &i386_optab[3249] }, /* kshiftld */
+  { &i386_optab[2110], &i386_optab[2112] }, /* vpaddsw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3644], &i386_optab[3645] }, /* vcvtudq2phx */
+  { NULL, NULL },
+  { &i386_optab[2779], &i386_optab[2780] }, /* vpcomtruew */
+  { &i386_optab[1778], &i386_optab[1780] }, /* vcmpneq_ussd */
+  { &i386_optab[1973], &i386_optab[1975] }, /* vdivps */
+  { NULL, NULL },
+  { &i386_optab[2952], &i386_optab[2955] }, /* kmovw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[39], &i386_optab[41] }, /* movsx */
+  { &i386_optab[3207], &i386_optab[3208] }, /* prefetchwt1 */
+  { NULL, NULL },
+  { &i386_optab[3382], &i386_optab[3383] }, /* vreducepd */
+  { &i386_optab[3620], &i386_optab[3621] }, /* vcmplt_oqsh */
+  { &i386_optab[3595], &i386_optab[3596] }, /* vcmpunordsh */
+  { &i386_optab[1060], &i386_optab[1062] }, /* stmxcsr */
+  { &i386_optab[932], &i386_optab[934] }, /* cmpnless */
+  { &i386_optab[3517], &i386_optab[3518] }, /* aesdec256kl */
+  { &i386_optab[304], &i386_optab[305] }, /* setbe */
+  { NULL, NULL },
+  { &i386_optab[2384], &i386_optab[2386] }, /* vpunpcklqdq */
+  { &i386_optab[953], &i386_optab[955] }, /* cvttss2si */
+  { NULL, NULL },
+  { &i386_optab[2196], &i386_optab[2198] }, /* vpinsrq */
+  { NULL, NULL },
+  { &i386_optab[916], &i386_optab[918] }, /* cmpnleps */
+  { &i386_optab[3267], &i386_optab[3268] }, /* vpcmpnltb */
+  { &i386_optab[1506], &i386_optab[1507] }, /* vaddsubps */
+  { &i386_optab[299], &i386_optab[300] }, /* setae */
+  { &i386_optab[3262], &i386_optab[3263] }, /* vpsrlvw */
+  { &i386_optab[302], &i386_optab[303] }, /* setne */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1584], &i386_optab[1586] }, /* vcmptrue_uqpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2774], &i386_optab[2775] }, /* vpcomfalseub */
+  { NULL, NULL },
+  { &i386_optab[1298], &i386_optab[1301] }, /* pmulhrsw */
+  { NULL, NULL },
+  { &i386_optab[1104], &i386_optab[1106] }, /* cmpunordsd */
+  { &i386_optab[438], &i386_optab[439] }, /* ficomp */
+  { &i386_optab[3518], &i386_optab[3519] }, /* aesencwide128kl */
+  { &i386_optab[3626], &i386_optab[3627] }, /* vcmpord_ssh */
+  { &i386_optab[3558], &i386_optab[3559] }, /* vcmpeq_uqph */
+  { &i386_optab[3247], &i386_optab[3248] }, /* kxorq */
+  { &i386_optab[3526], &i386_optab[3527] }, /* uiret */
+  { &i386_optab[3743], &i386_optab[3744] }, /* vfpclassphz */
+  { &i386_optab[2915], &i386_optab[2916] }, /* xsha256 */
+  { NULL, NULL },
+  { &i386_optab[1357], &i386_optab[1359] }, /* pblendw */
+  { NULL, NULL },
+  { &i386_optab[3076], &i386_optab[3077] }, /* vpandnq */
+  { &i386_optab[3606], &i386_optab[3607] }, /* vcmpngesh */
+  { &i386_optab[3482], &i386_optab[3483] }, /* vp2intersectq */
+  { &i386_optab[3433], &i386_optab[3434] }, /* tlbsync */
+  { &i386_optab[3741], &i386_optab[3742] }, /* vfnmsub231sh */
+  { &i386_optab[942], &i386_optab[943] }, /* cvtpi2ps */
+  { &i386_optab[367], &i386_optab[369] }, /* btc */
+  { &i386_optab[371], &i386_optab[373] }, /* bts */
+  { &i386_optab[3411], &i386_optab[3412] }, /* vpshrdvq */
+  { &i386_optab[2599], &i386_optab[2601] }, /* vfmsub213ps */
+  { &i386_optab[3431], &i386_optab[3433] }, /* invlpgb */
+  { &i386_optab[3275], &i386_optab[3276] }, /* vpcmpnleub */
+  { NULL, NULL },
+  { &i386_optab[1286], &i386_optab[1289] }, /* phsubw */
+  { &i386_optab[269], &i386_optab[270] }, /* jnp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3110], &i386_optab[3113] }, /* vpmovdb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3222], &i386_optab[3223] }, /* kaddd */
+  { &i386_optab[1214], &i386_optab[1216] }, /* pshufd */
+  { &i386_optab[1501], &i386_optab[1503] }, /* vaddsd */
+  { &i386_optab[3131], &i386_optab[3134] }, /* vpmovsqb */
+  { &i386_optab[3731], &i386_optab[3732] }, /* vfnmadd213ph */
+  { &i386_optab[3089], &i386_optab[3090] }, /* vpcmpleud */
+  { &i386_optab[3726], &i386_optab[3727] }, /* vfmsub231sh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[626], &i386_optab[627] }, /* {disp8} */
+  { NULL, NULL },
+  { &i386_optab[2057], &i386_optab[2059] }, /* vmovntps */
+  { &i386_optab[3224], &i386_optab[3225] }, /* kandnd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3293], &i386_optab[3296] }, /* vpmovswb */
+  { &i386_optab[1790], &i386_optab[1792] }, /* vcmpngt_uqsd */
+  { &i386_optab[542], &i386_optab[543] }, /* fninit */
+  { &i386_optab[977], &i386_optab[979] }, /* movlhps */
+  { &i386_optab[713], &i386_optab[716] }, /* fcompi */
+  { &i386_optab[955], &i386_optab[957] }, /* divps */
+  { &i386_optab[3714], &i386_optab[3715] }, /* vfmadd231ph */
+  { &i386_optab[3454], &i386_optab[3455] }, /* wrssq */
+  { &i386_optab[1642], &i386_optab[1644] }, /* vcmpnleps */
+  { &i386_optab[2561], &i386_optab[2563] }, /* vfmadd132ps */
+  { &i386_optab[1167], &i386_optab[1169] }, /* subsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[422], &i386_optab[424] }, /* fistp */
+  { &i386_optab[1295], &i386_optab[1298] }, /* pmaddubsw */
+  { &i386_optab[3510], &i386_optab[3511] }, /* tilezero */
+  { &i386_optab[3469], &i386_optab[3470] }, /* cldemote */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2156], &i386_optab[2158] }, /* vpcmpgtw */
+  { NULL, NULL },
+  { &i386_optab[2455], &i386_optab[2458] }, /* vpermpd */
+  { &i386_optab[3651], &i386_optab[3652] }, /* vcvtuqq2phz */
+  { &i386_optab[2231], &i386_optab[2236] }, /* vpmovsxbd */
+  { NULL, NULL },
+  { &i386_optab[3276], &i386_optab[3277] }, /* vpcmpw */
+  { NULL, NULL },
+  { &i386_optab[1994], &i386_optab[1995] }, /* vldmxcsr */
+  { NULL, NULL },
+  { &i386_optab[1574], &i386_optab[1576] }, /* vcmpgepd */
+  { &i386_optab[740], &i386_optab[743] }, /* packuswb */
+  { NULL, NULL },
+  { &i386_optab[3107], &i386_optab[3108] }, /* vptestnmd */
+  { &i386_optab[1395], &i386_optab[1397] }, /* pmovsxbw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[597], &i386_optab[598] }, /* rexy */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2837], &i386_optab[2838] }, /* lwpins */
+  { &i386_optab[294], &i386_optab[295] }, /* setb */
+  { &i386_optab[3366], &i386_optab[3368] }, /* vfpclasspd */
+  { &i386_optab[1518], &i386_optab[1519] }, /* vblendvps */
+  { &i386_optab[631], &i386_optab[632] }, /* {vex} */
+  { NULL, NULL },
+  { &i386_optab[2617], &i386_optab[2619] }, /* vfmsubadd213pd */
+  { &i386_optab[1526], &i386_optab[1528] }, /* vcmpeqpd */
+  { NULL, NULL },
+  { &i386_optab[1257], &i386_optab[1258] }, /* vmcall */
+  { &i386_optab[3044], &i386_optab[3045] }, /* vfixupimmss */
+  { &i386_optab[3503], &i386_optab[3504] }, /* tdpbuud */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2839], &i386_optab[2841] }, /* bextr */
+  { &i386_optab[3771], &i386_optab[3772] }, /* vsqrtph */
+  { &i386_optab[2688], &i386_optab[2689] }, /* shrx */
+  { &i386_optab[3043], &i386_optab[3044] }, /* vrndscalesd */
+  { NULL, NULL },
+  { &i386_optab[555], &i386_optab[556] }, /* fnstenv */
+  { NULL, NULL },
+  { &i386_optab[679], &i386_optab[680] }, /* cmovns */
+  { &i386_optab[671], &i386_optab[672] }, /* cmovz */
+  { &i386_optab[3040], &i386_optab[3041] }, /* vfixupimmps */
+  { &i386_optab[1478], &i386_optab[1481] }, /* vaesenclast */
+  { &i386_optab[668], &i386_optab[669] }, /* cmovnc */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2979], &i386_optab[2980] }, /* vpermi2d */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3724], &i386_optab[3725] }, /* vfmsub132sh */
+  { &i386_optab[151], &i386_optab[152] }, /* cbw */
+  { NULL, NULL },
+  { &i386_optab[1507], &i386_optab[1509] }, /* vandnpd */
+  { NULL, NULL },
+  { &i386_optab[1812], &i386_optab[1814] }, /* vcmple_osss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3507], &i386_optab[3508] }, /* tileloaddt1 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3054], &i386_optab[3055] }, /* vgetexpss */
+  { NULL, NULL },
+  { &i386_optab[1582], &i386_optab[1584] }, /* vcmptruepd */
+  { &i386_optab[602], &i386_optab[603] }, /* rexxyz */
+  { NULL, NULL },
+  { &i386_optab[2854], &i386_optab[2855] }, /* prefetch */
+  { &i386_optab[3544], &i386_optab[3545] }, /* vcmpltph */
+  { &i386_optab[3052], &i386_optab[3053] }, /* vgetexpps */
+  { &i386_optab[2865], &i386_optab[2866] }, /* pfmax */
+  { NULL, NULL },
+  { &i386_optab[875], &i386_optab[878] }, /* punpckhbw */
+  { &i386_optab[3101], &i386_optab[3102] }, /* vpcmpltuq */
+  { NULL, NULL },
+  { &i386_optab[1548], &i386_optab[1550] }, /* vcmpnlt_uspd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3069], &i386_optab[3070] }, /* vpabsq */
+  { &i386_optab[728], &i386_optab[734] }, /* movd */
+  { &i386_optab[2031], &i386_optab[2035] }, /* vmovhpd */
+  { NULL, NULL },
+  { &i386_optab[2727], &i386_optab[2728] }, /* vpcomltuw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[33], &i386_optab[34] }, /* movsbl */
+  { &i386_optab[767], &i386_optab[770] }, /* pand */
+  { NULL, NULL },
+  { &i386_optab[3270], &i386_optab[3271] }, /* vpcmpequb */
+  { NULL, NULL },
+  { &i386_optab[2709], &i386_optab[2710] }, /* vfrczpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2004], &i386_optab[2006] }, /* vmaxsd */
+  { &i386_optab[613], &i386_optab[614] }, /* rex.xb */
+  { &i386_optab[3260], &i386_optab[3261] }, /* vpsllvw */
+  { &i386_optab[746], &i386_optab[749] }, /* paddw */
+  { &i386_optab[1028], &i386_optab[1031] }, /* pminub */
+  { &i386_optab[2724], &i386_optab[2725] }, /* vpcomltd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3441], &i386_optab[3442] }, /* rdpkru */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2310], &i386_optab[2312] }, /* vpshufd */
+  { &i386_optab[1886], &i386_optab[1888] }, /* vcmpneq_osss */
+  { NULL, NULL },
+  { &i386_optab[1454], &i386_optab[1455] }, /* xsetbv */
+  { &i386_optab[639], &i386_optab[640] }, /* cmpxchg */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1702], &i386_optab[1704] }, /* vcmpneq_osps */
+  { &i386_optab[1037], &i386_optab[1038] }, /* prefetchnta */
+  { &i386_optab[1222], &i386_optab[1224] }, /* psrldq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1938], &i386_optab[1940] }, /* vcvtsd2si */
+  { NULL, NULL },
+  { &i386_optab[3505], &i386_optab[3506] }, /* tdpbsud */
+  { &i386_optab[3627], &i386_optab[3628] }, /* vcmpeq_ussh */
+  { &i386_optab[1975], &i386_optab[1977] }, /* vdivsd */
+  { &i386_optab[1706], &i386_optab[1708] }, /* vcmpgt_oqps */
+  { &i386_optab[578], &i386_optab[579] }, /* word */
+  { &i386_optab[2984], &i386_optab[2985] }, /* vprorvd */
+  { &i386_optab[615], &i386_optab[616] }, /* rex.rb */
+  { &i386_optab[1102], &i386_optab[1104] }, /* cmplesd */
+  { &i386_optab[857], &i386_optab[860] }, /* psubd */
+  { &i386_optab[3729], &i386_optab[3730] }, /* vfmsubadd231ph */
+  { &i386_optab[2073], &i386_optab[2077] }, /* vmovss */
+  { &i386_optab[2834], &i386_optab[2835] }, /* llwpcb */
+  { &i386_optab[1890], &i386_optab[1892] }, /* vcmpgt_oqss */
+  { &i386_optab[92], &i386_optab[93] }, /* sahf */
+  { &i386_optab[3009], &i386_optab[3012] }, /* vcvtudq2pd */
+  { &i386_optab[2703], &i386_optab[2704] }, /* vfnmaddsd */
+  { &i386_optab[3193], &i386_optab[3194] }, /* vgatherpf1dpd */
+  { NULL, NULL },
+  { &i386_optab[598], &i386_optab[599] }, /* rexyz */
+  { &i386_optab[2873], &i386_optab[2874] }, /* pfrsqit1 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[528], &i386_optab[529] }, /* fxtract */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1982], &i386_optab[1986] }, /* vextractps */
+  { &i386_optab[1965], &i386_optab[1967] }, /* vcvttps2dq */
+  { &i386_optab[1467], &i386_optab[1469] }, /* aeskeygenassist */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1242], &i386_optab[1244] }, /* movddup */
+  { &i386_optab[1238], &i386_optab[1240] }, /* hsubps */
+  { &i386_optab[3081], &i386_optab[3082] }, /* vpcmpltd */
+  { &i386_optab[2845], &i386_optab[2846] }, /* blcfill */
+  { &i386_optab[2744], &i386_optab[2745] }, /* vpcomgtud */
+  { &i386_optab[2464], &i386_optab[2465] }, /* vinserti128 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[324], &i386_optab[328] }, /* cmpsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2777], &i386_optab[2778] }, /* vpcomfalseuq */
+  { &i386_optab[3399], &i386_optab[3400] }, /* v4fnmaddss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[212], &i386_optab[221] }, /* call */
+  { &i386_optab[3317], &i386_optab[3318] }, /* kxorb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2124], &i386_optab[2126] }, /* vpalignr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[278], &i386_optab[279] }, /* jg */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2467], &i386_optab[2469] }, /* vpmaskmovq */
+  { &i386_optab[2639], &i386_optab[2641] }, /* vfnmadd132sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[178], &i386_optab[182] }, /* ror */
+  { &i386_optab[2685], &i386_optab[2686] }, /* rorx */
+  { &i386_optab[358], &i386_optab[361] }, /* ssto */
+  { &i386_optab[3330], &i386_optab[3333] }, /* vcvtps2qq */
+  { &i386_optab[1118], &i386_optab[1121] }, /* cvtpi2pd */
+  { &i386_optab[1273], &i386_optab[1275] }, /* invvpid */
+  { &i386_optab[1280], &i386_optab[1283] }, /* phaddd */
+  { &i386_optab[3032], &i386_optab[3033] }, /* vpexpandq */
+  { &i386_optab[2848], &i386_optab[2849] }, /* blcmsk */
+  { NULL, NULL },
+  { &i386_optab[2751], &i386_optab[2752] }, /* vpcomgeuw */
+  { &i386_optab[262], &i386_optab[263] }, /* jna */
+  { &i386_optab[3725], &i386_optab[3726] }, /* vfmsub213sh */
+  { &i386_optab[1377], &i386_optab[1379] }, /* pinsrq */
+  { NULL, NULL },
+  { &i386_optab[2208], &i386_optab[2210] }, /* vpmaxsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1718], &i386_optab[1720] }, /* vcmplesd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3246], &i386_optab[3247] }, /* kxnorq */
+  { NULL, NULL },
+  { &i386_optab[2341], &i386_optab[2345] }, /* vpsrld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2055], &i386_optab[2057] }, /* vmovntpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2749], &i386_optab[2750] }, /* vpcomgeq */
+  { &i386_optab[2112], &i386_optab[2114] }, /* vpaddb */
+  { &i386_optab[1040], &i386_optab[1041] }, /* prefetcht2 */
+  { NULL, NULL },
+  { &i386_optab[2756], &i386_optab[2757] }, /* vpcomeqd */
+  { NULL, NULL },
+  { &i386_optab[2615], &i386_optab[2617] }, /* vfmsubadd132pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2713], &i386_optab[2714] }, /* vpcmov */
+  { &i386_optab[2906], &i386_optab[2907] }, /* popcnt */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[544], &i386_optab[545] }, /* fldcw */
+  { &i386_optab[3601], &i386_optab[3602] }, /* vcmpnlesh */
+  { NULL, NULL },
+  { &i386_optab[284], &i386_optab[286] }, /* loopz */
+  { NULL, NULL },
+  { &i386_optab[1552], &i386_optab[1554] }, /* vcmpnle_uspd */
+  { NULL, NULL },
+  { &i386_optab[2301], &i386_optab[2303] }, /* vpmullw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2883], &i386_optab[2884] }, /* swapgs */
+  { &i386_optab[2862], &i386_optab[2863] }, /* pfcmpeq */
+  { &i386_optab[2241], &i386_optab[2246] }, /* vpmovsxbw */
+  { &i386_optab[361], &i386_optab[363] }, /* xlat */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2409], &i386_optab[2410] }, /* vstmxcsr */
+  { NULL, NULL },
+  { &i386_optab[2297], &i386_optab[2299] }, /* vpmulhw */
+  { NULL, NULL },
+  { &i386_optab[3305], &i386_optab[3306] }, /* vptestnmw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2018], &i386_optab[2020] }, /* vmovaps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[599], &i386_optab[600] }, /* rexx */
+  { NULL, NULL },
+  { &i386_optab[221], &i386_optab[224] }, /* lcall */
+  { &i386_optab[3683], &i386_optab[3685] }, /* vcvtsi2sh */
+  { &i386_optab[1854], &i386_optab[1856] }, /* vcmpgtss */
+  { &i386_optab[295], &i386_optab[296] }, /* setc */
+  { &i386_optab[308], &i386_optab[309] }, /* sets */
+  { NULL, NULL },
+  { &i386_optab[1090], &i386_optab[1092] }, /* cmpneqpd */
+  { &i386_optab[1188], &i386_optab[1190] }, /* cvtps2dq */
+  { &i386_optab[1670], &i386_optab[1672] }, /* vcmpgtps */
+  { NULL, NULL },
+  { &i386_optab[2795], &i386_optab[2796] }, /* vphaddubq */
+  { NULL, NULL },
+  { &i386_optab[393], &i386_optab[395] }, /* sgdt */
+  { &i386_optab[3464], &i386_optab[3465] }, /* umonitor */
+  { &i386_optab[1738], &i386_optab[1740] }, /* vcmpordsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1632], &i386_optab[1634] }, /* vcmpunord_qps */
+  { NULL, NULL },
+  { &i386_optab[2503], &i386_optab[2507] }, /* vpgatherdq */
+  { &i386_optab[2545], &i386_optab[2550] }, /* vcvtph2ps */
+  { &i386_optab[3378], &i386_optab[3379] }, /* vpmovm2d */
+  { NULL, NULL },
+  { &i386_optab[3046], &i386_optab[3047] }, /* vrndscaless */
+  { &i386_optab[2983], &i386_optab[2984] }, /* vprolvd */
+  { &i386_optab[667], &i386_optab[668] }, /* cmovnb */
+  { &i386_optab[974], &i386_optab[977] }, /* movhps */
+  { &i386_optab[3090], &i386_optab[3091] }, /* vpcmpnequd */
+  { NULL, NULL },
+  { &i386_optab[2169], &i386_optab[2173] }, /* vpextrb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3257], &i386_optab[3258] }, /* vpermi2w */
+  { &i386_optab[943], &i386_optab[944] }, /* cvtps2pi */
+  { &i386_optab[2764], &i386_optab[2765] }, /* vpcomneqd */
+  { &i386_optab[2086], &i386_optab[2088] }, /* vmulsd */
+  { &i386_optab[2393], &i386_optab[2394] }, /* vroundsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1207], &i386_optab[1209] }, /* movdqu */
+  { &i386_optab[2731], &i386_optab[2732] }, /* vpcomlew */
+  { &i386_optab[1509], &i386_optab[1511] }, /* vandnps */
+  { NULL, NULL },
+  { &i386_optab[1457], &i386_optab[1459] }, /* aesdec */
+  { &i386_optab[3547], &i386_optab[3548] }, /* vcmple_osph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1634], &i386_optab[1636] }, /* vcmpneqps */
+  { &i386_optab[3053], &i386_optab[3054] }, /* vgetexpsd */
+  { NULL, NULL },
+  { &i386_optab[1818], &i386_optab[1820] }, /* vcmpneqss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2767], &i386_optab[2768] }, /* vpcomnequw */
+  { &i386_optab[1218], &i386_optab[1220] }, /* pshuflw */
+  { &i386_optab[1894], &i386_optab[1896] }, /* vcmppd */
+  { &i386_optab[3333], &i386_optab[3336] }, /* vcvtps2uqq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1598], &i386_optab[1600] }, /* vcmpnle_uqpd */
+  { &i386_optab[1820], &i386_optab[1822] }, /* vcmpneq_uqss */
+  { NULL, NULL },
+  { &i386_optab[1840], &i386_optab[1842] }, /* vcmpngtss */
+  { &i386_optab[412], &i386_optab[413] }, /* fldt */
+  { &i386_optab[2094], &i386_optab[2096] }, /* vpabsb */
+  { &i386_optab[1216], &i386_optab[1218] }, /* pshufhw */
+  { &i386_optab[1511], &i386_optab[1513] }, /* vandpd */
+  { &i386_optab[1636], &i386_optab[1638] }, /* vcmpneq_uqps */
+  { &i386_optab[2410], &i386_optab[2412] }, /* vsubpd */
+  { &i386_optab[2053], &i386_optab[2055] }, /* vmovntdqa */
+  { &i386_optab[3178], &i386_optab[3179] }, /* vpconflictq */
+  { &i386_optab[3501], &i386_optab[3502] }, /* tdpbf16ps */
+  { &i386_optab[2972], &i386_optab[2973] }, /* vpminsq */
+  { &i386_optab[1068], &i386_optab[1070] }, /* unpckhps */
+  { &i386_optab[2583], &i386_optab[2585] }, /* vfmaddsub231pd */
+  { &i386_optab[1137], &i386_optab[1139] }, /* minsd */
+  { &i386_optab[3415], &i386_optab[3416] }, /* vpshrdd */
+  { NULL, NULL },
+  { &i386_optab[839], &i386_optab[845] }, /* psrld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[922], &i386_optab[924] }, /* cmpltss */
+  { &i386_optab[2712], &i386_optab[2713] }, /* vfrczss */
+  { &i386_optab[2006], &i386_optab[2008] }, /* vmaxss */
+  { NULL, NULL },
+  { &i386_optab[2723], &i386_optab[2724] }, /* vpcomltw */
+  { &i386_optab[2916], &i386_optab[2917] }, /* xstorerng */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1262], &i386_optab[1263] }, /* vmptrst */
+  { &i386_optab[3428], &i386_optab[3429] }, /* vpopcntb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2637], &i386_optab[2639] }, /* vfnmadd231ps */
+  { &i386_optab[3241], &i386_optab[3242] }, /* korq */
+  { &i386_optab[2920], &i386_optab[2921] }, /* xcryptcfb */
+  { &i386_optab[3679], &i386_optab[3680] }, /* vcvtph2w */
+  { &i386_optab[1987], &i386_optab[1988] }, /* vhaddps */
+  { &i386_optab[2649], &i386_optab[2651] }, /* vfnmadd231ss */
+  { &i386_optab[2569], &i386_optab[2571] }, /* vfmadd213sd */
+  { &i386_optab[3577], &i386_optab[3578] }, /* vcmpnlt_uqph */
+  { &i386_optab[1523], &i386_optab[1526] }, /* vbroadcastss */
+  { &i386_optab[2538], &i386_optab[2540] }, /* vgf2p8mulb */
+  { &i386_optab[541], &i386_optab[542] }, /* fabs */
+  { NULL, NULL },
+  { &i386_optab[3681], &i386_optab[3682] }, /* vcvtsd2sh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2544], &i386_optab[2545] }, /* wrgsbase */
+  { NULL, NULL },
+  { &i386_optab[998], &i386_optab[1000] }, /* orps */
+  { &i386_optab[962], &i386_optab[964] }, /* maxps */
+  { &i386_optab[1251], &i386_optab[1252] }, /* cmpxchg16b */
+  { &i386_optab[3471], &i386_optab[3472] }, /* movdir64b */
+  { &i386_optab[2781], &i386_optab[2782] }, /* vpcomtrueq */
+  { &i386_optab[1979], &i386_optab[1980] }, /* vdppd */
+  { &i386_optab[2704], &i386_optab[2705] }, /* vfnmaddss */
+  { &i386_optab[1594], &i386_optab[1596] }, /* vcmpneq_uspd */
+  { &i386_optab[1415], &i386_optab[1417] }, /* pmovzxwq */
+  { NULL, NULL },
+  { &i386_optab[3450], &i386_optab[3451] }, /* rdsspq */
+  { NULL, NULL },
+  { &i386_optab[3231], &i386_optab[3232] }, /* ktestd */
+  { &i386_optab[964], &i386_optab[966] }, /* maxss */
+  { NULL, NULL },
+  { &i386_optab[652], &i386_optab[653] }, /* fxsave */
+  { &i386_optab[3408], &i386_optab[3409] }, /* vpshldvd */
+  { &i386_optab[1367], &i386_optab[1369] }, /* pextrq */
+  { NULL, NULL },
+  { &i386_optab[3574], &i386_optab[3575] }, /* vcmple_oqph */
+  { &i386_optab[3386], &i386_optab[3387] }, /* vreducesd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[940], &i386_optab[942] }, /* comiss */
+  { &i386_optab[3067], &i386_optab[3068] }, /* vrcp14ps */
+  { NULL, NULL },
+  { &i386_optab[3035], &i386_optab[3036] }, /* vextractf32x4 */
+  { &i386_optab[3336], &i386_optab[3337] }, /* vcvtqq2pd */
+  { &i386_optab[572], &i386_optab[573] }, /* addr16 */
+  { &i386_optab[1538], &i386_optab[1540] }, /* vcmpunordpd */
+  { &i386_optab[2919], &i386_optab[2920] }, /* xcryptctr */
+  { &i386_optab[1236], &i386_optab[1238] }, /* hsubpd */
+  { &i386_optab[2743], &i386_optab[2744] }, /* vpcomgtuw */
+  { &i386_optab[3321], &i386_optab[3322] }, /* kshiftrb */
+  { &i386_optab[3169], &i386_optab[3170] }, /* vrcp14ss */
+  { &i386_optab[442], &i386_optab[444] }, /* fucomp */
+  { &i386_optab[319], &i386_optab[320] }, /* setng */
+  { &i386_optab[2198], &i386_optab[2202] }, /* vpinsrw */
+  { &i386_optab[3269], &i386_optab[3270] }, /* vpcmpub */
+  { &i386_optab[1427], &i386_optab[1429] }, /* roundps */
+  { &i386_optab[1848], &i386_optab[1850] }, /* vcmpneq_oqss */
+  { &i386_optab[936], &i386_optab[938] }, /* cmpps */
+  { NULL, NULL },
+  { &i386_optab[559], &i386_optab[560] }, /* fsave */
+  { &i386_optab[1856], &i386_optab[1858] }, /* vcmpgt_osss */
+  { &i386_optab[2858], &i386_optab[2859] }, /* pf2id */
+  { NULL, NULL },
+  { &i386_optab[3252], &i386_optab[3253] }, /* vdbpsadbw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[950], &i386_optab[952] }, /* cvtss2si */
+  { NULL, NULL },
+  { &i386_optab[3744], &i386_optab[3745] }, /* vfpclassphx */
+  { NULL, NULL },
+  { &i386_optab[267], &i386_optab[268] }, /* jp */
+  { NULL, NULL },
+  { &i386_optab[3158], &i386_optab[3159] }, /* vprorq */
+  { &i386_optab[606], &i386_optab[607] }, /* rex64yz */
+  { &i386_optab[2925], &i386_optab[2926] }, /* rdseed */
+  { &i386_optab[3113], &i386_optab[3116] }, /* vpmovsdb */
+  { &i386_optab[632], &i386_optab[633] }, /* {vex2} */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1277], &i386_optab[1280] }, /* phaddw */
+  { &i386_optab[593], &i386_optab[594] }, /* ht */
+  { &i386_optab[3406], &i386_optab[3407] }, /* vpexpandb */
+  { NULL, NULL },
+  { &i386_optab[3461], &i386_optab[3462] }, /* notrack */
+  { &i386_optab[1485], &i386_optab[1487] }, /* pclmulhqlqdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1371], &i386_optab[1375] }, /* pinsrb */
+  { &i386_optab[3630], &i386_optab[3631] }, /* vcmpfalse_ossh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3738], &i386_optab[3739] }, /* vfnmsub231ph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1301], &i386_optab[1304] }, /* pshufb */
+  { &i386_optab[3660], &i386_optab[3661] }, /* vcvtps2phxx */
+  { &i386_optab[3316], &i386_optab[3317] }, /* kxnorb */
+  { NULL, NULL },
+  { &i386_optab[3272], &i386_optab[3273] }, /* vpcmpleub */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3582], &i386_optab[3583] }, /* vcmpngt_uqph */
+  { &i386_optab[1497], &i386_optab[1499] }, /* vaddpd */
+  { &i386_optab[1337], &i386_optab[1339] }, /* dppd */
+  { NULL, NULL },
+  { &i386_optab[1039], &i386_optab[1040] }, /* prefetcht1 */
+  { NULL, NULL },
+  { &i386_optab[373], &i386_optab[374] }, /* int */
+  { &i386_optab[3734], &i386_optab[3735] }, /* vfnmadd213sh */
+  { &i386_optab[2116], &i386_optab[2118] }, /* vpaddq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[93], &i386_optab[95] }, /* pushf */
+  { &i386_optab[263], &i386_optab[264] }, /* jnbe */
+  { NULL, NULL },
+  { &i386_optab[722], &i386_optab[723] }, /* movnti */
+  { NULL, NULL },
+  { &i386_optab[3000], &i386_optab[3003] }, /* vscatterqpd */
+  { &i386_optab[3128], &i386_optab[3131] }, /* vpmovqb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[253], &i386_optab[254] }, /* jnae */
+  { &i386_optab[2299], &i386_optab[2301] }, /* vpmulld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[387], &i386_optab[389] }, /* lidt */
+  { NULL, NULL },
+  { &i386_optab[3652], &i386_optab[3653] }, /* vcvtuqq2phx */
+  { NULL, NULL },
+  { &i386_optab[3093], &i386_optab[3094] }, /* vpcmpq */
+  { &i386_optab[566], &i386_optab[567] }, /* fsetpm */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3079], &i386_optab[3080] }, /* vpxorq */
+  { &i386_optab[2935], &i386_optab[2937] }, /* bndcn */
+  { &i386_optab[3172], &i386_optab[3173] }, /* vshufi32x4 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1710], &i386_optab[1712] }, /* vcmpeqsd */
+  { &i386_optab[1175], &i386_optab[1177] }, /* xorpd */
+  { &i386_optab[1913], &i386_optab[1918] }, /* vcvtpd2dq */
+  { &i386_optab[2689], &i386_optab[2690] }, /* vfmaddpd */
+  { &i386_optab[1184], &i386_optab[1186] }, /* cvtpd2ps */
+  { &i386_optab[1758], &i386_optab[1760] }, /* vcmpgesd */
+  { &i386_optab[3361], &i386_optab[3362] }, /* vfpclasssd */
+  { &i386_optab[726], &i386_optab[727] }, /* pause */
+  { &i386_optab[2771], &i386_optab[2772] }, /* vpcomfalsew */
+  { &i386_optab[310], &i386_optab[311] }, /* setp */
+  { &i386_optab[296], &i386_optab[297] }, /* setnae */
+  { &i386_optab[1405], &i386_optab[1407] }, /* pmovsxdq */
+  { &i386_optab[306], &i386_optab[307] }, /* setnbe */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1181], &i386_optab[1183] }, /* cvtdq2ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3292], &i386_optab[3293] }, /* vpmovm2w */
+  { NULL, NULL },
+  { &i386_optab[3763], &i386_optab[3764] }, /* vrndscaleph */
+  { &i386_optab[3767], &i386_optab[3768] }, /* vrsqrtph */
+  { &i386_optab[675], &i386_optab[676] }, /* cmovna */
+  { &i386_optab[2132], &i386_optab[2133] }, /* vpblendvb */
+  { &i386_optab[2251], &i386_optab[2256] }, /* vpmovsxwd */
+  { NULL, NULL },
+  { &i386_optab[2175], &i386_optab[2177] }, /* vpextrq */
+  { NULL, NULL },
+  { &i386_optab[448], &i386_optab[449] }, /* fldl2t */
+  { &i386_optab[1419], &i386_optab[1421] }, /* pmuldq */
+  { &i386_optab[688], &i386_optab[689] }, /* cmovle */
+  { NULL, NULL },
+  { &i386_optab[2088], &i386_optab[2090] }, /* vmulss */
+  { &i386_optab[2682], &i386_optab[2683] }, /* mulx */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1403], &i386_optab[1405] }, /* pmovsxwq */
+  { &i386_optab[2968], &i386_optab[2969] }, /* vpermt2pd */
+  { &i386_optab[687], &i386_optab[688] }, /* cmovge */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3525], &i386_optab[3526] }, /* seamcall */
+  { NULL, NULL },
+  { &i386_optab[2049], &i386_optab[2050] }, /* vmovmskpd */
+  { &i386_optab[1542], &i386_optab[1544] }, /* vcmpneqpd */
+  { &i386_optab[3600], &i386_optab[3601] }, /* vcmpnlt_ussh */
+  { &i386_optab[2226], &i386_optab[2228] }, /* vpminud */
+  { &i386_optab[3667], &i386_optab[3670] }, /* vcvtph2udq */
+  { &i386_optab[2732], &i386_optab[2733] }, /* vpcomled */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2768], &i386_optab[2769] }, /* vpcomnequd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[88], &i386_optab[89] }, /* cli */
+  { &i386_optab[3189], &i386_optab[3190] }, /* vrcp28ss */
+  { &i386_optab[3512], &i386_optab[3513] }, /* encodekey128 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3284], &i386_optab[3285] }, /* vpcmpltuw */
+  { &i386_optab[3185], &i386_optab[3186] }, /* vrcp28ps */
+  { &i386_optab[1728], &i386_optab[1730] }, /* vcmpneq_uqsd */
+  { &i386_optab[1766], &i386_optab[1768] }, /* vcmptruesd */
+  { &i386_optab[1481], &i386_optab[1483] }, /* pclmulqdq */
+  { NULL, NULL },
+  { &i386_optab[3419], &i386_optab[3420] }, /* vpshrdw */
+  { &i386_optab[2440], &i386_optab[2443] }, /* vpbroadcastb */
+  { &i386_optab[3591], &i386_optab[3592] }, /* vcmpltsh */
+  { &i386_optab[3259], &i386_optab[3260] }, /* vpermw */
+  { &i386_optab[881], &i386_optab[884] }, /* punpckhdq */
+  { &i386_optab[2956], &i386_optab[2957] }, /* kortestw */
+  { &i386_optab[3279], &i386_optab[3280] }, /* vpcmpneqw */
+  { &i386_optab[3048], &i386_optab[3049] }, /* vscalefps */
+  { &i386_optab[2937], &i386_optab[2938] }, /* bndstx */
+  { NULL, NULL },
+  { &i386_optab[2960], &i386_optab[2961] }, /* valignd */
+  { &i386_optab[3087], &i386_optab[3088] }, /* vpcmpequd */
+  { NULL, NULL },
+  { &i386_optab[966], &i386_optab[968] }, /* minps */
+  { &i386_optab[524], &i386_optab[525] }, /* f2xm1 */
+  { &i386_optab[2471], &i386_optab[2473] }, /* vpsllvq */
+  { &i386_optab[99], &i386_optab[100] }, /* sti */
+  { &i386_optab[2849], &i386_optab[2850] }, /* blcs */
+  { &i386_optab[833], &i386_optab[839] }, /* psrlw */
+  { &i386_optab[3344], &i386_optab[3345] }, /* vcvttpd2uqq */
+  { &i386_optab[3497], &i386_optab[3498] }, /* xsusldtrk */
+  { &i386_optab[1159], &i386_optab[1161] }, /* shufpd */
+  { &i386_optab[645], &i386_optab[646] }, /* rdtsc */
+  { &i386_optab[2543], &i386_optab[2544] }, /* wrfsbase */
+  { &i386_optab[821], &i386_optab[827] }, /* psraw */
+  { &i386_optab[3050], &i386_optab[3051] }, /* vscalefss */
+  { &i386_optab[3749], &i386_optab[3750] }, /* vmaxph */
+  { &i386_optab[2783], &i386_optab[2784] }, /* vpcomtrueuw */
+  { &i386_optab[3068], &i386_optab[3069] }, /* vrsqrt14ps */
+  { &i386_optab[681], &i386_optab[682] }, /* cmovpe */
+  { &i386_optab[2575], &i386_optab[2577] }, /* vfmadd213ss */
+  { &i386_optab[1391], &i386_optab[1393] }, /* pminud */
+  { &i386_optab[3657], &i386_optab[3658] }, /* vcvtpd2phz */
+  { &i386_optab[2890], &i386_optab[2891] }, /* stgi */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[761], &i386_optab[764] }, /* paddusb */
+  { &i386_optab[1520], &i386_optab[1523] }, /* vbroadcastsd */
+  { NULL, NULL },
+  { &i386_optab[1456], &i386_optab[1457] }, /* xsaveopt64 */
+  { &i386_optab[2891], &i386_optab[2892] }, /* vmgexit */
+  { NULL, NULL },
+  { &i386_optab[3027], &i386_optab[3028] }, /* vcvttps2udq */
+  { &i386_optab[1203], &i386_optab[1205] }, /* maskmovdqu */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[35], &i386_optab[36] }, /* movswl */
+  { &i386_optab[1131], &i386_optab[1133] }, /* maxpd */
+  { &i386_optab[1086], &i386_optab[1088] }, /* cmplepd */
+  { NULL, NULL },
+  { &i386_optab[3580], &i386_optab[3581] }, /* vcmpeq_usph */
+  { &i386_optab[2897], &i386_optab[2899] }, /* vmsave */
+  { &i386_optab[383], &i386_optab[384] }, /* arpl */
+  { &i386_optab[1971], &i386_optab[1973] }, /* vdivpd */
+  { &i386_optab[1870], &i386_optab[1872] }, /* vcmpneq_usss */
+  { &i386_optab[696], &i386_optab[697] }, /* fcmovna */
+  { &i386_optab[3225], &i386_optab[3228] }, /* kmovd */
+  { &i386_optab[282], &i386_optab[284] }, /* loop */
+  { &i386_optab[600], &i386_optab[601] }, /* rexxz */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3388], &i386_optab[3389] }, /* vreducess */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3527], &i386_optab[3528] }, /* clui */
+  { &i386_optab[2857], &i386_optab[2858] }, /* pavgusb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3070], &i386_optab[3071] }, /* vrcp14pd */
+  { NULL, NULL },
+  { &i386_optab[2686], &i386_optab[2687] }, /* sarx */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2194], &i386_optab[2196] }, /* vpinsrd */
+  { &i386_optab[3338], &i386_optab[3341] }, /* vcvtqq2ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3097], &i386_optab[3098] }, /* vpcmpnltq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2475], &i386_optab[2477] }, /* vpsrlvd */
+  { &i386_optab[884], &i386_optab[887] }, /* punpcklbw */
+  { &i386_optab[588], &i386_optab[589] }, /* rep */
+  { &i386_optab[3099], &i386_optab[3100] }, /* vpcmpuq */
+  { &i386_optab[332], &i386_optab[334] }, /* outs */
+  { &i386_optab[2859], &i386_optab[2860] }, /* pf2iw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[433], &i386_optab[434] }, /* ficom */
+  { &i386_optab[3569], &i386_optab[3570] }, /* vcmpgt_osph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3155], &i386_optab[3156] }, /* vprold */
+  { &i386_optab[3730], &i386_optab[3731] }, /* vfnmadd132ph */
+  { &i386_optab[2875], &i386_optab[2876] }, /* pfsub */
+  { &i386_optab[264], &i386_optab[265] }, /* ja */
+  { NULL, NULL },
+  { &i386_optab[3745], &i386_optab[3746] }, /* vfpclassphy */
+  { NULL, NULL },
+  { &i386_optab[450], &i386_optab[451] }, /* fldpi */
+  { &i386_optab[270], &i386_optab[271] }, /* jpo */
+  { NULL, NULL },
+  { &i386_optab[2964], &i386_optab[2965] }, /* vblendmpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2886], &i386_optab[2888] }, /* invlpga */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2206], &i386_optab[2208] }, /* vpmaxsb */
+  { &i386_optab[250], &i386_optab[251] }, /* jno */
+  { &i386_optab[427], &i386_optab[429] }, /* fxch */
+  { NULL, NULL },
+  { &i386_optab[2822], &i386_optab[2824] }, /* vprotd */
+  { &i386_optab[2753], &i386_optab[2754] }, /* vpcomgeuq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[574], &i386_optab[575] }, /* aword */
+  { NULL, NULL },
+  { &i386_optab[3661], &i386_optab[3662] }, /* vcvtps2phxy */
+  { NULL, NULL },
+  { &i386_optab[1534], &i386_optab[1536] }, /* vcmplepd */
+  { NULL, NULL },
+  { &i386_optab[554], &i386_optab[555] }, /* fclex */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2736], &i386_optab[2737] }, /* vpcomleud */
+  { &i386_optab[1269], &i386_optab[1270] }, /* vmfunc */
+  { &i386_optab[2700], &i386_optab[2701] }, /* vfmsubss */
+  { &i386_optab[1038], &i386_optab[1039] }, /* prefetcht0 */
+  { &i386_optab[2010], &i386_optab[2012] }, /* vminps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[538], &i386_optab[539] }, /* fsin */
+  { &i386_optab[2014], &i386_optab[2016] }, /* vminss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3715], &i386_optab[3716] }, /* vfmadd132sh */
+  { &i386_optab[3192], &i386_optab[3193] }, /* vgatherpf0qpd */
+  { &i386_optab[2680], &i386_optab[2681] }, /* xtest */
+  { NULL, NULL },
+  { &i386_optab[3162], &i386_optab[3165] }, /* vscatterqps */
+  { &i386_optab[2090], &i386_optab[2092] }, /* vorpd */
+  { NULL, NULL },
+  { &i386_optab[281], &i386_optab[282] }, /* jrcxz */
+  { &i386_optab[1736], &i386_optab[1738] }, /* vcmpnle_ussd */
+  { NULL, NULL },
+  { &i386_optab[590], &i386_optab[591] }, /* repz */
+  { &i386_optab[2376], &i386_optab[2378] }, /* vpunpckhqdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[561], &i386_optab[562] }, /* fneni */
+  { NULL, NULL },
+  { &i386_optab[2023], &i386_optab[2027] }, /* vmovddup */
+  { &i386_optab[2152], &i386_optab[2154] }, /* vpcmpgtd */
+  { &i386_optab[984], &i386_optab[986] }, /* movntps */
+  { &i386_optab[3263], &i386_optab[3264] }, /* vpcmpb */
+  { &i386_optab[3653], &i386_optab[3654] }, /* vcvtuqq2phy */
+  { &i386_optab[914], &i386_optab[916] }, /* cmpnltps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1796], &i386_optab[1798] }, /* vcmpge_oqsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1397], &i386_optab[1399] }, /* pmovsxbd */
+  { &i386_optab[930], &i386_optab[932] }, /* cmpnltss */
+  { &i386_optab[594], &i386_optab[595] }, /* hnt */
+  { &i386_optab[418], &i386_optab[422] }, /* fstp */
+  { &i386_optab[3360], &i386_optab[3361] }, /* vfpclassss */
+  { &i386_optab[1802], &i386_optab[1804] }, /* vcmpeqss */
+  { NULL, NULL },
+  { &i386_optab[1106], &i386_optab[1108] }, /* cmpneqsd */
+  { &i386_optab[596], &i386_optab[597] }, /* rexz */
+  { &i386_optab[307], &i386_optab[308] }, /* seta */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2860], &i386_optab[2861] }, /* pfacc */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3060], &i386_optab[3061] }, /* vinserti32x4 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3689], &i386_optab[3690] }, /* vcvtsh2si */
+  { &i386_optab[710], &i386_optab[713] }, /* fcomip */
+  { &i386_optab[1904], &i386_optab[1906] }, /* vcomiss */
+  { &i386_optab[3072], &i386_optab[3073] }, /* vpandd */
+  { &i386_optab[3273], &i386_optab[3274] }, /* vpcmpnequb */
+  { NULL, NULL },
+  { &i386_optab[1554], &i386_optab[1556] }, /* vcmpordpd */
+  { &i386_optab[2693], &i386_optab[2694] }, /* vfmaddsubpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[691], &i386_optab[692] }, /* cmovg */
+  { NULL, NULL },
+  { &i386_optab[682], &i386_optab[683] }, /* cmovnp */
+  { &i386_optab[1662], &i386_optab[1664] }, /* vcmpfalse_oqps */
+  { &i386_optab[2029], &i386_optab[2031] }, /* vmovhlps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[449], &i386_optab[450] }, /* fldl2e */
+  { &i386_optab[163], &i386_optab[164] }, /* mul */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1846], &i386_optab[1848] }, /* vcmpfalse_oqss */
+  { &i386_optab[2967], &i386_optab[2968] }, /* vpermi2q */
+  { &i386_optab[2762], &i386_optab[2763] }, /* vpcomneqb */
+  { &i386_optab[3759], &i386_optab[3760] }, /* vmulph */
+  { NULL, NULL },
+  { &i386_optab[3017], &i386_optab[3021] }, /* vcvtusi2sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2100], &i386_optab[2102] }, /* vpackssdw */
+  { NULL, NULL },
+  { &i386_optab[413], &i386_optab[414] }, /* fbld */
+  { &i386_optab[3654], &i386_optab[3655] }, /* vcvtpd2ph */
+  { NULL, NULL },
+  { &i386_optab[1261], &i386_optab[1262] }, /* vmptrld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3184], &i386_optab[3185] }, /* vrsqrt28pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3051], &i386_optab[3052] }, /* vgetexppd */
+  { &i386_optab[716], &i386_optab[719] }, /* fucomip */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1898], &i386_optab[1900] }, /* vcmpsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3509], &i386_optab[3510] }, /* tilerelease */
+  { &i386_optab[1782], &i386_optab[1784] }, /* vcmpnle_uqsd */
+  { &i386_optab[2096], &i386_optab[2098] }, /* vpabsd */
+  { &i386_optab[3420], &i386_optab[3422] }, /* vpdpbusd */
+  { &i386_optab[2414], &i386_optab[2416] }, /* vsubsd */
+  { &i386_optab[2453], &i386_optab[2455] }, /* vpermd */
+  { &i386_optab[2446], &i386_optab[2449] }, /* vpbroadcastq */
+  { &i386_optab[3230], &i386_optab[3231] }, /* kortestd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3508], &i386_optab[3509] }, /* tilestored */
+  { &i386_optab[1447], &i386_optab[1449] }, /* crc32 */
+  { NULL, NULL },
+  { &i386_optab[3376], &i386_optab[3377] }, /* vpmovd2m */
+  { &i386_optab[3254], &i386_optab[3255] }, /* vmovdqu16 */
+  { &i386_optab[3700], &i386_optab[3703] }, /* vcvttph2uqq */
+  { &i386_optab[106], &i386_optab[110] }, /* sub */
+  { &i386_optab[1463], &i386_optab[1465] }, /* aesenclast */
+  { &i386_optab[3066], &i386_optab[3067] }, /* vmovdqu64 */
+  { &i386_optab[2452], &i386_optab[2453] }, /* vperm2i128 */
+  { &i386_optab[3283], &i386_optab[3284] }, /* vpcmpequw */
+  { &i386_optab[2725], &i386_optab[2726] }, /* vpcomltq */
+  { &i386_optab[1393], &i386_optab[1395] }, /* pminuw */
+  { &i386_optab[614], &i386_optab[615] }, /* rex.r */
+  { &i386_optab[3459], &i386_optab[3460] }, /* endbr64 */
+  { &i386_optab[611], &i386_optab[612] }, /* rex.b */
+  { &i386_optab[1025], &i386_optab[1028] }, /* pminsw */
+  { &i386_optab[3656], &i386_optab[3657] }, /* vcvtpd2phy */
+  { NULL, NULL },
+  { &i386_optab[1271], &i386_optab[1273] }, /* invept */
+  { &i386_optab[1112], &i386_optab[1114] }, /* cmpordsd */
+  { &i386_optab[827], &i386_optab[833] }, /* psrad */
+  { NULL, NULL },
+  { &i386_optab[2758], &i386_optab[2759] }, /* vpcomequb */
+  { &i386_optab[3713], &i386_optab[3714] }, /* vfmadd213ph */
+  { NULL, NULL },
+  { &i386_optab[640], &i386_optab[641] }, /* invd */
+  { &i386_optab[2855], &i386_optab[2856] }, /* prefetchw */
+  { NULL, NULL },
+  { &i386_optab[1082], &i386_optab[1084] }, /* cmpeqpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[908], &i386_optab[910] }, /* cmpleps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3484], &i386_optab[3486] }, /* psmash */
+  { &i386_optab[2975], &i386_optab[2976] }, /* vprorvq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3253], &i386_optab[3254] }, /* vmovdqu8 */
+  { &i386_optab[172], &i386_optab[174] }, /* idiv */
+  { &i386_optab[854], &i386_optab[857] }, /* psubw */
+  { &i386_optab[2843], &i386_optab[2844] }, /* blsr */
+  { NULL, NULL },
+  { &i386_optab[601], &i386_optab[602] }, /* rexxy */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[527], &i386_optab[528] }, /* fpatan */
+  { &i386_optab[1844], &i386_optab[1846] }, /* vcmpfalsess */
+  { &i386_optab[317], &i386_optab[318] }, /* setge */
+  { NULL, NULL },
+  { &i386_optab[3171], &i386_optab[3172] }, /* vshuff32x4 */
+  { &i386_optab[1722], &i386_optab[1724] }, /* vcmpunordsd */
+  { &i386_optab[452], &i386_optab[453] }, /* fldln2 */
+  { &i386_optab[1489], &i386_optab[1491] }, /* pclmulhqhqdq */
+  { &i386_optab[2525], &i386_optab[2528] }, /* vpclmulhqlqdq */
+  { &i386_optab[3747], &i386_optab[3748] }, /* vgetmantph */
+  { &i386_optab[3761], &i386_optab[3762] }, /* vreduceph */
+  { &i386_optab[3277], &i386_optab[3278] }, /* vpcmpltw */
+  { &i386_optab[1638], &i386_optab[1640] }, /* vcmpnltps */
+  { &i386_optab[3621], &i386_optab[3622] }, /* vcmple_oqsh */
+  { &i386_optab[1660], &i386_optab[1662] }, /* vcmpfalseps */
+  { &i386_optab[3389], &i386_optab[3390] }, /* clwb */
+  { &i386_optab[3116], &i386_optab[3119] }, /* vpmovusdb */
+  { &i386_optab[1772], &i386_optab[1774] }, /* vcmplt_oqsd */
+  { &i386_optab[342], &i386_optab[347] }, /* movsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[318], &i386_optab[319] }, /* setle */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1784], &i386_optab[1786] }, /* vcmpord_ssd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[337], &i386_optab[340] }, /* slod */
+  { NULL, NULL },
+  { &i386_optab[3204], &i386_optab[3205] }, /* vscatterpf0qps */
+  { NULL, NULL },
+  { &i386_optab[3179], &i386_optab[3180] }, /* vplzcntd */
+  { NULL, NULL },
+  { &i386_optab[2465], &i386_optab[2467] }, /* vpmaskmovd */
+  { NULL, NULL },
+  { &i386_optab[251], &i386_optab[252] }, /* jb */
+  { &i386_optab[2667], &i386_optab[2669] }, /* vfnmsub231sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2550], &i386_optab[2555] }, /* vcvtps2ph */
+  { &i386_optab[3034], &i386_optab[3035] }, /* vpexpandd */
+  { &i386_optab[311], &i386_optab[312] }, /* setpe */
+  { &i386_optab[641], &i386_optab[642] }, /* wbinvd */
+  { &i386_optab[1263], &i386_optab[1265] }, /* vmread */
+  { &i386_optab[379], &i386_optab[380] }, /* bound */
+  { &i386_optab[2750], &i386_optab[2751] }, /* vpcomgeub */
+  { &i386_optab[1244], &i386_optab[1246] }, /* movshdup */
+  { &i386_optab[3278], &i386_optab[3279] }, /* vpcmplew */
+  { &i386_optab[2970], &i386_optab[2971] }, /* vpmaxsq */
+  { &i386_optab[2820], &i386_optab[2822] }, /* vprotw */
+  { &i386_optab[273], &i386_optab[274] }, /* jnl */
+  { &i386_optab[1375], &i386_optab[1377] }, /* pinsrd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1469], &i386_optab[1472] }, /* vaesdec */
+  { &i386_optab[1076], &i386_optab[1078] }, /* addsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3232], &i386_optab[3233] }, /* kxnord */
+  { &i386_optab[2629], &i386_optab[2631] }, /* vfnmadd213pd */
+  { &i386_optab[3533], &i386_optab[3534] }, /* vaddsh */
+  { &i386_optab[2943], &i386_optab[2945] }, /* sha256rnds2 */
+  { &i386_optab[2607], &i386_optab[2609] }, /* vfmsub231sd */
+  { &i386_optab[2347], &i386_optab[2351] }, /* vpsrlq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2746], &i386_optab[2747] }, /* vpcomgeb */
+  { &i386_optab[2118], &i386_optab[2120] }, /* vpaddw */
+  { &i386_optab[2735], &i386_optab[2736] }, /* vpcomleuw */
+  { &i386_optab[1341], &i386_optab[1345] }, /* extractps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2621], &i386_optab[2623] }, /* vfmsubadd132ps */
+  { &i386_optab[3629], &i386_optab[3630] }, /* vcmpngt_uqsh */
+  { NULL, NULL },
+  { &i386_optab[1210], &i386_optab[1211] }, /* movq2dq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2092], &i386_optab[2094] }, /* vorps */
+  { &i386_optab[2671], &i386_optab[2673] }, /* vfnmsub213ss */
+  { &i386_optab[3137], &i386_optab[3140] }, /* vpmovqd */
+  { &i386_optab[3536], &i386_optab[3537] }, /* vfmaddcph */
+  { NULL, NULL },
+  { &i386_optab[1644], &i386_optab[1646] }, /* vcmpnle_usps */
+  { &i386_optab[2992], &i386_optab[2993] }, /* vpcompressd */
+  { &i386_optab[469], &i386_optab[470] }, /* fisub */
+  { &i386_optab[286], &i386_optab[288] }, /* loope */
+  { &i386_optab[2659], &i386_optab[2661] }, /* vfnmsub213ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[399], &i386_optab[401] }, /* smsw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[592], &i386_optab[593] }, /* repnz */
+  { NULL, NULL },
+  { &i386_optab[494], &i386_optab[498] }, /* fmulp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2931], &i386_optab[2933] }, /* bndcl */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3542], &i386_optab[3543] }, /* vcmpeqph */
+  { &i386_optab[928], &i386_optab[930] }, /* cmpneqss */
+  { &i386_optab[1804], &i386_optab[1806] }, /* vcmpeq_oqss */
+  { &i386_optab[2160], &i386_optab[2161] }, /* vperm2f128 */
+  { &i386_optab[2807], &i386_optab[2808] }, /* vpmacsdql */
+  { &i386_optab[1240], &i386_optab[1242] }, /* lddqu */
+  { &i386_optab[3728], &i386_optab[3729] }, /* vfmsubadd213ph */
+  { &i386_optab[2794], &i386_optab[2795] }, /* vphaddubd */
+  { &i386_optab[1620], &i386_optab[1622] }, /* vcmpeq_oqps */
+  { &i386_optab[2691], &i386_optab[2692] }, /* vfmaddsd */
+  { &i386_optab[3742], &i386_optab[3743] }, /* vfpclassph */
+  { &i386_optab[788], &i386_optab[791] }, /* pcmpgtd */
+  { NULL, NULL },
+  { &i386_optab[1147], &i386_optab[1149] }, /* movmskpd */
+  { NULL, NULL },
+  { &i386_optab[1226], &i386_optab[1228] }, /* punpcklqdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3596], &i386_optab[3597] }, /* vcmpunord_qsh */
+  { &i386_optab[3676], &i386_optab[3679] }, /* vcvtph2pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3103], &i386_optab[3104] }, /* vpcmpnequq */
+  { &i386_optab[3379], &i386_optab[3380] }, /* vpmovm2q */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[689], &i386_optab[690] }, /* cmovng */
+  { &i386_optab[647], &i386_optab[648] }, /* cmpxchg8b */
+  { &i386_optab[2177], &i386_optab[2183] }, /* vpextrw */
+  { &i386_optab[1472], &i386_optab[1475] }, /* vaesdeclast */
+  { NULL, NULL },
+  { &i386_optab[1186], &i386_optab[1188] }, /* cvtps2pd */
+  { &i386_optab[3337], &i386_optab[3338] }, /* vcvtuqq2pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1838], &i386_optab[1840] }, /* vcmpnge_usss */
+  { &i386_optab[2765], &i386_optab[2766] }, /* vpcomneqq */
+  { &i386_optab[209], &i386_optab[212] }, /* shrd */
+  { &i386_optab[3768], &i386_optab[3769] }, /* vrsqrtsh */
+  { &i386_optab[2669], &i386_optab[2671] }, /* vfnmsub132ss */
+  { &i386_optab[2367], &i386_optab[2369] }, /* vpsubusw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1654], &i386_optab[1656] }, /* vcmpnge_usps */
+  { &i386_optab[459], &i386_optab[463] }, /* faddp */
+  { NULL, NULL },
+  { &i386_optab[160], &i386_optab[161] }, /* cwtd */
+  { &i386_optab[2657], &i386_optab[2659] }, /* vfnmsub132ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1969], &i386_optab[1971] }, /* vcvttss2si */
+  { &i386_optab[110], &i386_optab[112] }, /* dec */
+  { &i386_optab[1726], &i386_optab[1728] }, /* vcmpneqsd */
+  { &i386_optab[90], &i386_optab[91] }, /* cmc */
+  { &i386_optab[2766], &i386_optab[2767] }, /* vpcomnequb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[800], &i386_optab[803] }, /* por */
+  { &i386_optab[3553], &i386_optab[3554] }, /* vcmpnlt_usph */
+  { &i386_optab[1530], &i386_optab[1532] }, /* vcmpltpd */
+  { &i386_optab[2803], &i386_optab[2804] }, /* vphsubdq */
+  { &i386_optab[3561], &i386_optab[3562] }, /* vcmpngtph */
+  { &i386_optab[979], &i386_optab[982] }, /* movlps */
+  { &i386_optab[280], &i386_optab[281] }, /* jecxz */
+  { &i386_optab[3174], &i386_optab[3175] }, /* vshufi64x2 */
+  { &i386_optab[3177], &i386_optab[3178] }, /* vpconflictd */
+  { &i386_optab[1918], &i386_optab[1920] }, /* vcvtpd2dqx */
+  { &i386_optab[2412], &i386_optab[2414] }, /* vsubps */
+  { &i386_optab[970], &i386_optab[972] }, /* movaps */
+  { &i386_optab[1544], &i386_optab[1546] }, /* vcmpneq_uqpd */
+  { &i386_optab[643], &i386_optab[644] }, /* cpuid */
+  { &i386_optab[3417], &i386_optab[3418] }, /* vpshrdq */
+  { &i386_optab[2218], &i386_optab[2220] }, /* vpminsb */
+  { &i386_optab[3637], &i386_optab[3638] }, /* vucomish */
+  { &i386_optab[1022], &i386_optab[1025] }, /* pmaxub */
+  { &i386_optab[3445], &i386_optab[3447] }, /* ptwrite */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2432], &i386_optab[2434] }, /* vxorpd */
+  { &i386_optab[845], &i386_optab[851] }, /* psrlq */
+  { NULL, NULL },
+  { &i386_optab[685], &i386_optab[686] }, /* cmovnge */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[727], &i386_optab[728] }, /* emms */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2959], &i386_optab[2960] }, /* kunpckbw */
+  { NULL, NULL },
+  { &i386_optab[3403], &i386_optab[3404] }, /* vpopcntq */
+  { &i386_optab[3655], &i386_optab[3656] }, /* vcvtpd2phx */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1986], &i386_optab[1987] }, /* vhaddpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1080], &i386_optab[1082] }, /* andpd */
+  { &i386_optab[45], &i386_optab[46] }, /* movzw */
+  { &i386_optab[2913], &i386_optab[2914] }, /* montmul */
+  { &i386_optab[690], &i386_optab[691] }, /* cmovnle */
+  { &i386_optab[575], &i386_optab[576] }, /* adword */
+  { &i386_optab[3502], &i386_optab[3503] }, /* tdpbssd */
+  { &i386_optab[3711], &i386_optab[3712] }, /* vdivsh */
+  { &i386_optab[14], &i386_optab[16] }, /* movabs */
+  { &i386_optab[454], &i386_optab[458] }, /* fadd */
+  { NULL, NULL },
+  { &i386_optab[1157], &i386_optab[1159] }, /* orpd */
+  { &i386_optab[3387], &i386_optab[3388] }, /* vrangess */
+  { &i386_optab[2681], &i386_optab[2682] }, /* bzhi */
+  { &i386_optab[2778], &i386_optab[2779] }, /* vpcomtrueb */
+  { &i386_optab[392], &i386_optab[393] }, /* ltr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3449], &i386_optab[3450] }, /* rdsspd */
+  { &i386_optab[1133], &i386_optab[1135] }, /* maxsd */
+  { &i386_optab[1931], &i386_optab[1933] }, /* vcvtps2dq */
+  { &i386_optab[3642], &i386_optab[3644] }, /* vcvtudq2ph */
+  { &i386_optab[3309], &i386_optab[3312] }, /* kmovb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3198], &i386_optab[3199] }, /* vscatterpf1qpd */
+  { &i386_optab[3410], &i386_optab[3411] }, /* vpshldvq */
+  { &i386_optab[3439], &i386_optab[3441] }, /* mwaitx */
+  { &i386_optab[1814], &i386_optab[1816] }, /* vcmpunordss */
+  { &i386_optab[3325], &i386_optab[3326] }, /* vbroadcasti32x8 */
+  { &i386_optab[1361], &i386_optab[1365] }, /* pextrb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1860], &i386_optab[1862] }, /* vcmptrue_uqss */
+  { NULL, NULL },
+  { &i386_optab[570], &i386_optab[571] }, /* fnop */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3167], &i386_optab[3168] }, /* vrcp14sd */
+  { &i386_optab[303], &i386_optab[304] }, /* setnz */
+  { &i386_optab[587], &i386_optab[588] }, /* ss */
+  { &i386_optab[3282], &i386_optab[3283] }, /* vpcmpuw */
+  { &i386_optab[1676], &i386_optab[1678] }, /* vcmptrue_uqps */
+  { &i386_optab[3565], &i386_optab[3566] }, /* vcmpneq_oqph */
+  { &i386_optab[910], &i386_optab[912] }, /* cmpunordps */
+  { &i386_optab[95], &i386_optab[97] }, /* popf */
+  { &i386_optab[537], &i386_optab[538] }, /* fscale */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[926], &i386_optab[928] }, /* cmpunordss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[347], &i386_optab[349] }, /* smov */
+  { &i386_optab[2926], &i386_optab[2927] }, /* clac */
+  { &i386_optab[1650], &i386_optab[1652] }, /* vcmpeq_uqps */
+  { NULL, NULL },
+  { &i386_optab[252], &i386_optab[253] }, /* jc */
+  { NULL, NULL },
+  { &i386_optab[3516], &i386_optab[3517] }, /* aesenc256kl */
+  { NULL, NULL },
+  { &i386_optab[1836], &i386_optab[1838] }, /* vcmpngess */
+  { NULL, NULL },
+  { &i386_optab[3733], &i386_optab[3734] }, /* vfnmadd132sh */
+  { &i386_optab[265], &i386_optab[266] }, /* js */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3409], &i386_optab[3410] }, /* vpshrdvd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[583], &i386_optab[584] }, /* ds */
+  { &i386_optab[1516], &i386_optab[1517] }, /* vblendps */
+  { &i386_optab[1852], &i386_optab[1854] }, /* vcmpge_osss */
+  { &i386_optab[2518], &i386_optab[2519] }, /* vaeskeygenassist */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3663], &i386_optab[3664] }, /* vcvtuw2ph */
+  { NULL, NULL },
+  { &i386_optab[582], &i386_optab[583] }, /* cs */
+  { &i386_optab[1224], &i386_optab[1226] }, /* punpckhqdq */
+  { &i386_optab[630], &i386_optab[631] }, /* {store} */
+  { &i386_optab[1668], &i386_optab[1670] }, /* vcmpge_osps */
+  { &i386_optab[3119], &i386_optab[3122] }, /* vpmovdw */
+  { &i386_optab[363], &i386_optab[364] }, /* bsf */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3102], &i386_optab[3103] }, /* vpcmpleuq */
+  { &i386_optab[3240], &i386_optab[3241] }, /* knotq */
+  { &i386_optab[2981], &i386_optab[2982] }, /* vpermt2d */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2041], &i386_optab[2045] }, /* vmovlpd */
+  { &i386_optab[3416], &i386_optab[3417] }, /* vpshldq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1339], &i386_optab[1341] }, /* dpps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1062], &i386_optab[1064] }, /* subps */
+  { NULL, NULL },
+  { &i386_optab[1461], &i386_optab[1463] }, /* aesenc */
+  { NULL, NULL },
+  { &i386_optab[3453], &i386_optab[3454] }, /* wrssd */
+  { &i386_optab[1129], &i386_optab[1131] }, /* divsd */
+  { &i386_optab[1064], &i386_optab[1066] }, /* subss */
+  { &i386_optab[1329], &i386_optab[1333] }, /* blendvpd */
+  { &i386_optab[2665], &i386_optab[2667] }, /* vfnmsub213sd */
+  { &i386_optab[2428], &i386_optab[2430] }, /* vunpcklpd */
+  { &i386_optab[3146], &i386_optab[3149] }, /* vpmovqw */
+  { &i386_optab[1319], &i386_optab[1322] }, /* pabsw */
+  { &i386_optab[1734], &i386_optab[1736] }, /* vcmpnlesd */
+  { NULL, NULL },
+  { &i386_optab[994], &i386_optab[996] }, /* mulps */
+  { &i386_optab[3400], &i386_optab[3401] }, /* vp4dpwssd */
+  { &i386_optab[2150], &i386_optab[2152] }, /* vpcmpgtb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1862], &i386_optab[1864] }, /* vcmpeq_osss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[996], &i386_optab[998] }, /* mulss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1612], &i386_optab[1614] }, /* vcmpge_oqpd */
+  { &i386_optab[2512], &i386_optab[2517] }, /* vpgatherqq */
+  { NULL, NULL },
+  { &i386_optab[1197], &i386_optab[1199] }, /* cvttsd2si */
+  { NULL, NULL },
+  { &i386_optab[591], &i386_optab[592] }, /* repne */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2928], &i386_optab[2929] }, /* bnd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[292], &i386_optab[293] }, /* seto */
+  { &i386_optab[2204], &i386_optab[2206] }, /* vpmaddwd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3181], &i386_optab[3182] }, /* vexp2pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2892], &i386_optab[2894] }, /* vmload */
+  { NULL, NULL },
+  { &i386_optab[518], &i386_optab[524] }, /* fdivrp */
+  { &i386_optab[785], &i386_optab[788] }, /* pcmpgtw */
+  { &i386_optab[815], &i386_optab[821] }, /* psllq */
+  { &i386_optab[2924], &i386_optab[2925] }, /* adox */
+  { NULL, NULL },
+  { &i386_optab[2675], &i386_optab[2676] }, /* xacquire */
+  { &i386_optab[2390], &i386_optab[2391] }, /* vrcpss */
+  { &i386_optab[1880], &i386_optab[1882] }, /* vcmpnge_uqss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2380], &i386_optab[2382] }, /* vpunpcklbw */
+  { NULL, NULL },
+  { &i386_optab[2797], &i386_optab[2798] }, /* vphaddudq */
+  { &i386_optab[2587], &i386_optab[2589] }, /* vfmaddsub213ps */
+  { &i386_optab[670], &i386_optab[671] }, /* cmove */
+  { NULL, NULL },
+  { &i386_optab[2921], &i386_optab[2922] }, /* xcryptofb */
+  { &i386_optab[3680], &i386_optab[3681] }, /* vcvtph2uw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2910], &i386_optab[2911] }, /* xcrypt-ctr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2355], &i386_optab[2357] }, /* vpsubb */
+  { NULL, NULL },
+  { &i386_optab[1351], &i386_optab[1353] }, /* packusdw */
+  { &i386_optab[3515], &i386_optab[3516] }, /* aesdec128kl */
+  { &i386_optab[2663], &i386_optab[2665] }, /* vfnmsub132sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1421], &i386_optab[1423] }, /* pmulld */
+  { NULL, NULL },
+  { &i386_optab[1536], &i386_optab[1538] }, /* vcmple_ospd */
+  { &i386_optab[961], &i386_optab[962] }, /* maskmovq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1234], &i386_optab[1236] }, /* haddps */
+  { &i386_optab[3758], &i386_optab[3759] }, /* vgetexpsh */
+  { &i386_optab[3188], &i386_optab[3189] }, /* vrsqrt28sd */
+  { NULL, NULL },
+  { &i386_optab[116], &i386_optab[120] }, /* cmp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3213], &i386_optab[3214] }, /* xsavec */
+  { &i386_optab[3211], &i386_optab[3212] }, /* xsaves */
+  { NULL, NULL },
+  { &i386_optab[3088], &i386_optab[3089] }, /* vpcmpltud */
+  { NULL, NULL },
+  { &i386_optab[1920], &i386_optab[1922] }, /* vcvtpd2dqy */
+  { &i386_optab[1275], &i386_optab[1277] }, /* invpcid */
+  { &i386_optab[1144], &i386_optab[1147] }, /* movlpd */
+  { &i386_optab[3393], &i386_optab[3394] }, /* vpermb */
+  { &i386_optab[543], &i386_optab[544] }, /* finit */
+  { &i386_optab[328], &i386_optab[330] }, /* scmp */
+  { &i386_optab[16], &i386_optab[31] }, /* movq */
+  { &i386_optab[2449], &i386_optab[2452] }, /* vpbroadcastw */
+  { NULL, NULL },
+  { &i386_optab[3314], &i386_optab[3315] }, /* kortestb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2852], &i386_optab[2853] }, /* t1mskc */
+  { &i386_optab[697], &i386_optab[698] }, /* fcmovu */
+  { &i386_optab[2962], &i386_optab[2963] }, /* valignq */
+  { &i386_optab[1808], &i386_optab[1810] }, /* vcmplt_osss */
+  { &i386_optab[694], &i386_optab[695] }, /* fcmove */
+  { &i386_optab[2434], &i386_optab[2436] }, /* vxorps */
+  { NULL, NULL },
+  { &i386_optab[137], &i386_optab[141] }, /* adc */
+  { &i386_optab[153], &i386_optab[154] }, /* cwde */
+  { &i386_optab[2185], &i386_optab[2186] }, /* vphaddw */
+  { NULL, NULL },
+  { &i386_optab[3476], &i386_optab[3477] }, /* vcvtneps2bf16x */
+  { &i386_optab[1054], &i386_optab[1056] }, /* shufps */
+  { &i386_optab[1096], &i386_optab[1098] }, /* cmpordpd */
+  { &i386_optab[1624], &i386_optab[1626] }, /* vcmplt_osps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3498], &i386_optab[3499] }, /* xresldtrk */
+  { &i386_optab[3631], &i386_optab[3632] }, /* vcmpneq_ossh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3134], &i386_optab[3137] }, /* vpmovusqb */
+  { NULL, NULL },
+  { &i386_optab[2895], &i386_optab[2897] }, /* vmrun */
+  { &i386_optab[1439], &i386_optab[1443] }, /* pcmpestrm */
+  { NULL, NULL },
+  { &i386_optab[2917], &i386_optab[2918] }, /* xcryptecb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1832], &i386_optab[1834] }, /* vcmpord_qss */
+  { NULL, NULL },
+  { &i386_optab[3709], &i386_optab[3710] }, /* vcvttsh2usi */
+  { &i386_optab[558], &i386_optab[559] }, /* fnsave */
+  { &i386_optab[1098], &i386_optab[1100] }, /* cmpeqsd */
+  { NULL, NULL },
+  { &i386_optab[3586], &i386_optab[3587] }, /* vcmpgt_oqph */
+  { NULL, NULL },
+  { &i386_optab[699], &i386_optab[700] }, /* fcmovnb */
+  { &i386_optab[3576], &i386_optab[3577] }, /* vcmpneq_usph */
+  { NULL, NULL },
+  { &i386_optab[1648], &i386_optab[1650] }, /* vcmpord_qps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[84], &i386_optab[86] }, /* lss */
+  { &i386_optab[1892], &i386_optab[1894] }, /* vcmptrue_usss */
+  { NULL, NULL },
+  { &i386_optab[3237], &i386_optab[3240] }, /* kmovq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[112], &i386_optab[116] }, /* sbb */
+  { &i386_optab[3358], &i386_optab[3359] }, /* vinsertf32x8 */
+  { &i386_optab[2397], &i386_optab[2399] }, /* vshufpd */
+  { &i386_optab[1588], &i386_optab[1590] }, /* vcmplt_oqpd */
+  { &i386_optab[1991], &i386_optab[1993] }, /* vinsertps */
+  { &i386_optab[3548], &i386_optab[3549] }, /* vcmpunordph */
+  { &i386_optab[580], &i386_optab[581] }, /* lock */
+  { NULL, NULL },
+  { &i386_optab[1590], &i386_optab[1592] }, /* vcmple_oqpd */
+  { &i386_optab[3356], &i386_optab[3357] }, /* vextractf32x8 */
+  { &i386_optab[3094], &i386_optab[3095] }, /* vpcmpltq */
+  { &i386_optab[2388], &i386_optab[2389] }, /* vpxor */
+  { &i386_optab[1411], &i386_optab[1413] }, /* pmovzxbq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3748], &i386_optab[3749] }, /* vgetmantsh */
+  { &i386_optab[397], &i386_optab[399] }, /* sldt */
+  { NULL, NULL },
+  { &i386_optab[2479], &i386_optab[2483] }, /* vgatherdpd */
+  { &i386_optab[1047], &i386_optab[1049] }, /* rcpss */
+  { NULL, NULL },
+  { &i386_optab[3422], &i386_optab[3424] }, /* vpdpwssd */
+  { &i386_optab[241], &i386_optab[243] }, /* lret */
+  { &i386_optab[198], &i386_optab[202] }, /* shr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[78], &i386_optab[79] }, /* lds */
+  { &i386_optab[64], &i386_optab[65] }, /* popa */
+  { &i386_optab[334], &i386_optab[337] }, /* lods */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2976], &i386_optab[2977] }, /* vpsravq */
+  { &i386_optab[1600], &i386_optab[1602] }, /* vcmpord_spd */
+  { &i386_optab[650], &i386_optab[652] }, /* sysexit */
+  { &i386_optab[1045], &i386_optab[1047] }, /* rcpps */
+  { &i386_optab[3157], &i386_optab[3158] }, /* vprolq */
+  { &i386_optab[2788], &i386_optab[2790] }, /* vpermil2ps */
+  { NULL, NULL },
+  { &i386_optab[271], &i386_optab[272] }, /* jl */
+  { &i386_optab[3605], &i386_optab[3606] }, /* vcmpeq_uqsh */
+  { &i386_optab[2721], &i386_optab[2722] }, /* vpcomuq */
+  { NULL, NULL },
+  { &i386_optab[3365], &i386_optab[3366] }, /* vinserti64x2 */
+  { NULL, NULL },
+  { &i386_optab[3559], &i386_optab[3560] }, /* vcmpngeph */
+  { NULL, NULL },
+  { &i386_optab[3540], &i386_optab[3541] }, /* vfmulcph */
+  { &i386_optab[633], &i386_optab[634] }, /* {vex3} */
+  { &i386_optab[2977], &i386_optab[2978] }, /* vblendmps */
+  { &i386_optab[3413], &i386_optab[3414] }, /* vpshrdvw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[434], &i386_optab[438] }, /* fcomp */
+  { &i386_optab[1459], &i386_optab[1461] }, /* aesdeclast */
+  { NULL, NULL },
+  { &i386_optab[1760], &i386_optab[1762] }, /* vcmpge_ossd */
+  { &i386_optab[260], &i386_optab[261] }, /* jnz */
+  { &i386_optab[2655], &i386_optab[2657] }, /* vfnmsub231pd */
+  { &i386_optab[2824], &i386_optab[2826] }, /* vprotq */
+  { &i386_optab[322], &i386_optab[324] }, /* cmps */
+  { NULL, NULL },
+  { &i386_optab[3523], &i386_optab[3524] }, /* seamret */
+  { NULL, NULL },
+  { &i386_optab[1074], &i386_optab[1076] }, /* addpd */
+  { &i386_optab[2295], &i386_optab[2297] }, /* vpmulhuw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2595], &i386_optab[2597] }, /* vfmsub231pd */
+  { &i386_optab[3312], &i386_optab[3313] }, /* knotb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[638], &i386_optab[639] }, /* xadd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2641], &i386_optab[2643] }, /* vfnmadd213sd */
+  { &i386_optab[2737], &i386_optab[2738] }, /* vpcomleuq */
+  { &i386_optab[2748], &i386_optab[2749] }, /* vpcomged */
+  { &i386_optab[3532], &i386_optab[3533] }, /* vaddph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[272], &i386_optab[273] }, /* jnge */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[504], &i386_optab[505] }, /* fidiv */
+  { &i386_optab[535], &i386_optab[536] }, /* fsincos */
+  { NULL, NULL },
+  { &i386_optab[1322], &i386_optab[1325] }, /* pabsd */
+  { &i386_optab[3159], &i386_optab[3162] }, /* vpscatterqd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2154], &i386_optab[2156] }, /* vpcmpgtq */
+  { &i386_optab[1153], &i386_optab[1155] }, /* mulpd */
+  { NULL, NULL },
+  { &i386_optab[2800], &i386_optab[2801] }, /* vphaddwd */
+  { NULL, NULL },
+  { &i386_optab[277], &i386_optab[278] }, /* jnle */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2386], &i386_optab[2388] }, /* vpunpcklwd */
+  { &i386_optab[73], &i386_optab[77] }, /* out */
+  { NULL, NULL },
+  { &i386_optab[1888], &i386_optab[1890] }, /* vcmpge_oqss */
+  { &i386_optab[1049], &i386_optab[1051] }, /* rsqrtps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1053], &i386_optab[1054] }, /* sfence */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[314], &i386_optab[315] }, /* setl */
+  { NULL, NULL },
+  { &i386_optab[1988], &i386_optab[1989] }, /* vhsubpd */
+  { &i386_optab[3392], &i386_optab[3393] }, /* vpmultishiftqb */
+  { &i386_optab[2051], &i386_optab[2053] }, /* vmovntdq */
+  { &i386_optab[3615], &i386_optab[3616] }, /* vcmpgtsh */
+  { &i386_optab[1658], &i386_optab[1660] }, /* vcmpngt_usps */
+  { &i386_optab[2188], &i386_optab[2189] }, /* vphsubsw */
+  { &i386_optab[3191], &i386_optab[3192] }, /* vgatherpf0dpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1034], &i386_optab[1037] }, /* pmulhuw */
+  { &i386_optab[232], &i386_optab[235] }, /* ljmp */
+  { &i386_optab[1540], &i386_optab[1542] }, /* vcmpunord_qpd */
+  { &i386_optab[2498], &i386_optab[2503] }, /* vpgatherdd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1292], &i386_optab[1295] }, /* phsubsw */
+  { NULL, NULL },
+  { &i386_optab[672], &i386_optab[673] }, /* cmovne */
+  { NULL, NULL },
+  { &i386_optab[2879], &i386_optab[2880] }, /* pmulhrw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[536], &i386_optab[537] }, /* frndint */
+  { &i386_optab[3394], &i386_optab[3395] }, /* vpermi2b */
+  { NULL, NULL },
+  { &i386_optab[3024], &i386_optab[3027] }, /* vcvttpd2udq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[719], &i386_optab[722] }, /* fucompi */
+  { NULL, NULL },
+  { &i386_optab[3528], &i386_optab[3529] }, /* stui */
+  { &i386_optab[2802], &i386_optab[2803] }, /* vphsubbw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[623], &i386_optab[624] }, /* rex.wrb */
+  { &i386_optab[3328], &i386_optab[3329] }, /* vcvtpd2qq */
+  { NULL, NULL },
+  { &i386_optab[3550], &i386_optab[3551] }, /* vcmpneqph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2909], &i386_optab[2910] }, /* xcrypt-cbc */
+  { NULL, NULL },
+  { &i386_optab[3190], &i386_optab[3191] }, /* vrsqrt28ss */
+  { NULL, NULL },
+  { &i386_optab[669], &i386_optab[670] }, /* cmovae */
+  { &i386_optab[674], &i386_optab[675] }, /* cmovbe */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1443], &i386_optab[1445] }, /* pcmpistri */
+  { &i386_optab[3598], &i386_optab[3599] }, /* vcmpneq_uqsh */
+  { &i386_optab[58], &i386_optab[64] }, /* pop */
+  { &i386_optab[1748], &i386_optab[1750] }, /* vcmpngtsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2098], &i386_optab[2100] }, /* vpabsw */
+  { &i386_optab[1714], &i386_optab[1716] }, /* vcmpltsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[863], &i386_optab[866] }, /* psubsb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1716], &i386_optab[1718] }, /* vcmplt_ossd */
+  { NULL, NULL },
+  { &i386_optab[1347], &i386_optab[1349] }, /* movntdqa */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3477], &i386_optab[3478] }, /* vcvtneps2bf16y */
+  { &i386_optab[2418], &i386_optab[2419] }, /* vtestpd */
+  { &i386_optab[1084], &i386_optab[1086] }, /* cmpltpd */
+  { &i386_optab[147], &i386_optab[149] }, /* aad */
+  { &i386_optab[1381], &i386_optab[1383] }, /* pmaxsd */
+  { &i386_optab[934], &i386_optab[936] }, /* cmpordss */
+  { &i386_optab[31], &i386_optab[33] }, /* movbe */
+  { &i386_optab[2165], &i386_optab[2169] }, /* vpermilps */
+  { &i386_optab[3732], &i386_optab[3733] }, /* vfnmadd231ph */
+  { &i386_optab[2707], &i386_optab[2708] }, /* vfnmsubsd */
+  { &i386_optab[2308], &i386_optab[2310] }, /* vpshufb */
+  { &i386_optab[1267], &i386_optab[1268] }, /* vmxoff */
+  { &i386_optab[2761], &i386_optab[2762] }, /* vpcomequq */
+  { &i386_optab[1389], &i386_optab[1391] }, /* pminsd */
+  { &i386_optab[2722], &i386_optab[2723] }, /* vpcomltb */
+  { &i386_optab[1688], &i386_optab[1690] }, /* vcmpnlt_uqps */
+  { NULL, NULL },
+  { &i386_optab[3691], &i386_optab[3694] }, /* vcvttph2dq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3098], &i386_optab[3099] }, /* vpcmpnleq */
+  { &i386_optab[1252], &i386_optab[1255] }, /* monitor */
+  { &i386_optab[695], &i386_optab[696] }, /* fcmovbe */
+  { &i386_optab[616], &i386_optab[617] }, /* rex.rx */
+  { &i386_optab[553], &i386_optab[554] }, /* fnclex */
+  { &i386_optab[1940], &i386_optab[1942] }, /* vcvtsd2ss */
+  { &i386_optab[2894], &i386_optab[2895] }, /* vmmcall */
+  { &i386_optab[698], &i386_optab[699] }, /* fcmovae */
+  { &i386_optab[2871], &i386_optab[2872] }, /* pfrcpit1 */
+  { &i386_optab[700], &i386_optab[701] }, /* fcmovne */
+  { &i386_optab[703], &i386_optab[704] }, /* fcmovnu */
+  { &i386_optab[2323], &i386_optab[2325] }, /* vpslldq */
+  { &i386_optab[1740], &i386_optab[1742] }, /* vcmpord_qsd */
+  { &i386_optab[3538], &i386_optab[3539] }, /* vfcmulcph */
+  { &i386_optab[3710], &i386_optab[3711] }, /* vdivph */
+  { NULL, NULL },
+  { &i386_optab[3329], &i386_optab[3330] }, /* vcvtpd2uqq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1365], &i386_optab[1367] }, /* pextrd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1864], &i386_optab[1866] }, /* vcmplt_oqss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3037], &i386_optab[3038] }, /* vextractf64x4 */
+  { NULL, NULL },
+  { &i386_optab[3264], &i386_optab[3265] }, /* vpcmpltb */
+  { NULL, NULL },
+  { &i386_optab[3599], &i386_optab[3600] }, /* vcmpnltsh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2189], &i386_optab[2190] }, /* vphsubw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[316], &i386_optab[317] }, /* setnl */
+  { &i386_optab[3496], &i386_optab[3497] }, /* serialize */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1756], &i386_optab[1758] }, /* vcmpneq_oqsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[235], &i386_optab[241] }, /* ret */
+  { &i386_optab[2988], &i386_optab[2989] }, /* vbroadcasti64x4 */
+  { NULL, NULL },
+  { &i386_optab[3348], &i386_optab[3351] }, /* vcvttps2uqq */
+  { &i386_optab[1425], &i386_optab[1427] }, /* roundpd */
+  { &i386_optab[1580], &i386_optab[1582] }, /* vcmpgt_ospd */
+  { NULL, NULL },
+  { &i386_optab[3690], &i386_optab[3691] }, /* vcvtsh2usi */
+  { NULL, NULL },
+  { &i386_optab[458], &i386_optab[459] }, /* fiadd */
+  { &i386_optab[1876], &i386_optab[1878] }, /* vcmpord_sss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[384], &i386_optab[385] }, /* lar */
+  { &i386_optab[2679], &i386_optab[2680] }, /* xend */
+  { &i386_optab[2718], &i386_optab[2719] }, /* vpcomub */
+  { &i386_optab[2186], &i386_optab[2187] }, /* vphminposuw */
+  { &i386_optab[3156], &i386_optab[3157] }, /* vprord */
+  { &i386_optab[3682], &i386_optab[3683] }, /* vcvtss2sh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3465], &i386_optab[3467] }, /* tpause */
+  { &i386_optab[2989], &i386_optab[2990] }, /* vcompresspd */
+  { &i386_optab[3082], &i386_optab[3083] }, /* vpcmpled */
+  { &i386_optab[3407], &i386_optab[3408] }, /* vpexpandw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1013], &i386_optab[1019] }, /* pinsrw */
+  { &i386_optab[1884], &i386_optab[1886] }, /* vcmpfalse_osss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[896], &i386_optab[898] }, /* addps */
+  { &i386_optab[617], &i386_optab[618] }, /* rex.rxb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2950], &i386_optab[2951] }, /* kxnorw */
+  { NULL, NULL },
+  { &i386_optab[2613], &i386_optab[2615] }, /* vfmsub231ss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3418], &i386_optab[3419] }, /* vpshldw */
+  { &i386_optab[2291], &i386_optab[2293] }, /* vpmuldq */
+  { &i386_optab[2114], &i386_optab[2116] }, /* vpaddd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2747], &i386_optab[2748] }, /* vpcomgew */
+  { NULL, NULL },
+  { &i386_optab[1127], &i386_optab[1129] }, /* divpd */
+  { &i386_optab[2565], &i386_optab[2567] }, /* vfmadd231ps */
+  { NULL, NULL },
+  { &i386_optab[1550], &i386_optab[1552] }, /* vcmpnlepd */
+  { NULL, NULL },
+  { &i386_optab[2884], &i386_optab[2885] }, /* rdtscp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3602], &i386_optab[3603] }, /* vcmpnle_ussh */
+  { &i386_optab[3405], &i386_optab[3406] }, /* vpcompressw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3380], &i386_optab[3381] }, /* vpmullq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2027], &i386_optab[2028] }, /* vmovdqa */
+  { NULL, NULL },
+  { &i386_optab[2653], &i386_optab[2655] }, /* vfnmsub213pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3664], &i386_optab[3667] }, /* vcvtph2dq */
+  { &i386_optab[2246], &i386_optab[2251] }, /* vpmovsxdq */
+  { NULL, NULL },
+  { &i386_optab[1666], &i386_optab[1668] }, /* vcmpgeps */
+  { &i386_optab[2905], &i386_optab[2906] }, /* lzcnt */
+  { NULL, NULL },
+  { &i386_optab[2739], &i386_optab[2740] }, /* vpcomgtw */
+  { NULL, NULL },
+  { &i386_optab[3483], &i386_optab[3484] }, /* mcommit */
+  { NULL, NULL },
+  { &i386_optab[1248], &i386_optab[1250] }, /* fisttp */
+  { &i386_optab[2059], &i386_optab[2065] }, /* vmovq */
+  { &i386_optab[1072], &i386_optab[1074] }, /* xorps */
+  { &i386_optab[646], &i386_optab[647] }, /* rdmsr */
+  { &i386_optab[380], &i386_optab[381] }, /* hlt */
+  { &i386_optab[2143], &i386_optab[2146] }, /* vpcmpeqw */
+  { &i386_optab[1850], &i386_optab[1852] }, /* vcmpgess */
+  { NULL, NULL },
+  { &i386_optab[557], &i386_optab[558] }, /* fldenv */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2796], &i386_optab[2797] }, /* vphaddubw */
+  { NULL, NULL },
+  { &i386_optab[803], &i386_optab[809] }, /* psllw */
+  { &i386_optab[3199], &i386_optab[3200] }, /* vgatherpf0dps */
+  { &i386_optab[1433], &i386_optab[1435] }, /* pcmpgtq */
+  { &i386_optab[2695], &i386_optab[2696] }, /* vfmsubaddpd */
+  { NULL, NULL },
+  { &i386_optab[2805], &i386_optab[2806] }, /* vpmacsdd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2403], &i386_optab[2405] }, /* vsqrtps */
+  { &i386_optab[2791], &i386_optab[2792] }, /* vphaddbq */
+  { NULL, NULL },
+  { &i386_optab[1283], &i386_optab[1286] }, /* phaddsw */
+  { &i386_optab[3291], &i386_optab[3292] }, /* vpmovm2b */
+  { &i386_optab[665], &i386_optab[666] }, /* cmovc */
+  { &i386_optab[3662], &i386_optab[3663] }, /* vcvtw2ph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1169], &i386_optab[1171] }, /* ucomisd */
+  { NULL, NULL },
+  { &i386_optab[2173], &i386_optab[2175] }, /* vpextrd */
+  { &i386_optab[678], &i386_optab[679] }, /* cmovs */
+  { &i386_optab[2126], &i386_optab[2127] }, /* vpand */
+  { &i386_optab[3323], &i386_optab[3324] }, /* vbroadcastf32x8 */
+  { NULL, NULL },
+  { &i386_optab[644], &i386_optab[645] }, /* wrmsr */
+  { &i386_optab[1246], &i386_optab[1248] }, /* movsldup */
+  { NULL, NULL },
+  { &i386_optab[1161], &i386_optab[1163] }, /* sqrtpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[38], &i386_optab[39] }, /* movslq */
+  { NULL, NULL },
+  { &i386_optab[2609], &i386_optab[2611] }, /* vfmsub132ss */
+  { &i386_optab[1070], &i386_optab[1072] }, /* unpcklps */
+  { &i386_optab[2651], &i386_optab[2653] }, /* vfnmsub132pd */
+  { NULL, NULL },
+  { &i386_optab[1720], &i386_optab[1722] }, /* vcmple_ossd */
+  { NULL, NULL },
+  { &i386_optab[3694], &i386_optab[3697] }, /* vcvttph2udq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[288], &i386_optab[290] }, /* loopnz */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1674], &i386_optab[1676] }, /* vcmptrueps */
+  { &i386_optab[2769], &i386_optab[2770] }, /* vpcomnequq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3757], &i386_optab[3758] }, /* vgetexpph */
+  { NULL, NULL },
+  { &i386_optab[453], &i386_optab[454] }, /* fldz */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3500], &i386_optab[3501] }, /* sttilecfg */
+  { &i386_optab[1858], &i386_optab[1860] }, /* vcmptruess */
+  { NULL, NULL },
+  { &i386_optab[3774], &i386_optab[3775] }, /* vsubsh */
+  { &i386_optab[340], &i386_optab[342] }, /* movs */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3769], &i386_optab[3770] }, /* vscalefph */
+  { NULL, NULL },
+  { &i386_optab[1385], &i386_optab[1387] }, /* pmaxuw */
+  { NULL, NULL },
+  { &i386_optab[2325], &i386_optab[2329] }, /* vpsllq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2519], &i386_optab[2522] }, /* vpclmulqdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3065], &i386_optab[3066] }, /* vmovdqu32 */
+  { NULL, NULL },
+  { &i386_optab[2877], &i386_optab[2878] }, /* pi2fd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2835], &i386_optab[2836] }, /* slwpcb */
+  { NULL, NULL },
+  { &i386_optab[1019], &i386_optab[1022] }, /* pmaxsw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3143], &i386_optab[3146] }, /* vpmovusqd */
+  { &i386_optab[3168], &i386_optab[3169] }, /* vrsqrt14sd */
+  { &i386_optab[3074], &i386_optab[3075] }, /* vpord */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3584], &i386_optab[3585] }, /* vcmpneq_osph */
+  { NULL, NULL },
+  { &i386_optab[3624], &i386_optab[3625] }, /* vcmpnlt_uqsh */
+  { &i386_optab[529], &i386_optab[530] }, /* fprem1 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3302], &i386_optab[3303] }, /* vptestmb */
+  { &i386_optab[2872], &i386_optab[2873] }, /* pfrcpit2 */
+  { &i386_optab[3201], &i386_optab[3202] }, /* vgatherpf1dps */
+  { &i386_optab[2065], &i386_optab[2069] }, /* vmovsd */
+  { &i386_optab[2850], &i386_optab[2851] }, /* blsfill */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3633], &i386_optab[3634] }, /* vcmpgt_oqsh */
+  { &i386_optab[3401], &i386_optab[3402] }, /* vp4dpwssds */
+  { &i386_optab[2625], &i386_optab[2627] }, /* vfmsubadd231ps */
+  { &i386_optab[3245], &i386_optab[3246] }, /* kunpckwd */
+  { &i386_optab[3638], &i386_optab[3640] }, /* vcvtdq2ph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3206], &i386_optab[3207] }, /* vscatterpf1qps */
+  { &i386_optab[3480], &i386_optab[3481] }, /* enqcmds */
+  { &i386_optab[1006], &i386_optab[1013] }, /* pextrw */
+  { &i386_optab[411], &i386_optab[412] }, /* fildll */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3055], &i386_optab[3056] }, /* vgetmantpd */
+  { &i386_optab[3205], &i386_optab[3206] }, /* vscatterpf1dps */
+  { &i386_optab[445], &i386_optab[446] }, /* ftst */
+  { NULL, NULL },
+  { &i386_optab[1774], &i386_optab[1776] }, /* vcmple_oqsd */
+  { &i386_optab[3036], &i386_optab[3037] }, /* vextracti32x4 */
+  { NULL, NULL },
+  { &i386_optab[2187], &i386_optab[2188] }, /* vphsubd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3086], &i386_optab[3087] }, /* vpcmpud */
+  { &i386_optab[653], &i386_optab[654] }, /* fxsave64 */
+  { NULL, NULL },
+  { &i386_optab[194], &i386_optab[198] }, /* shl */
+  { NULL, NULL },
+  { &i386_optab[142], &i386_optab[143] }, /* not */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3261], &i386_optab[3262] }, /* vpsravw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1995], &i386_optab[1996] }, /* vmaskmovdqu */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1954], &i386_optab[1956] }, /* vcvtss2si */
+  { &i386_optab[3524], &i386_optab[3525] }, /* seamops */
+  { &i386_optab[1933], &i386_optab[1938] }, /* vcvtps2pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2971], &i386_optab[2972] }, /* vpmaxuq */
+  { &i386_optab[2611], &i386_optab[2613] }, /* vfmsub213ss */
+  { &i386_optab[992], &i386_optab[994] }, /* movups */
+  { &i386_optab[1515], &i386_optab[1516] }, /* vblendpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2838], &i386_optab[2839] }, /* andn */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1576], &i386_optab[1578] }, /* vcmpge_ospd */
+  { &i386_optab[2438], &i386_optab[2439] }, /* vbroadcasti128 */
+  { &i386_optab[3583], &i386_optab[3584] }, /* vcmpfalse_osph */
+  { &i386_optab[1810], &i386_optab[1812] }, /* vcmpless */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[206], &i386_optab[209] }, /* shld */
+  { NULL, NULL },
+  { &i386_optab[3368], &i386_optab[3369] }, /* vfpclasspdz */
+  { &i386_optab[1996], &i386_optab[1998] }, /* vmaskmovpd */
+  { &i386_optab[3228], &i386_optab[3229] }, /* knotd */
+  { &i386_optab[1626], &i386_optab[1628] }, /* vcmpleps */
+  { &i386_optab[2045], &i386_optab[2049] }, /* vmovlps */
+  { &i386_optab[3479], &i386_optab[3480] }, /* enqcmd */
+  { &i386_optab[2699], &i386_optab[2700] }, /* vfmsubsd */
+  { NULL, NULL },
+  { &i386_optab[3751], &i386_optab[3752] }, /* vminph */
+  { &i386_optab[2541], &i386_optab[2542] }, /* rdgsbase */
+  { &i386_optab[3165], &i386_optab[3167] }, /* vpsraq */
+  { &i386_optab[3258], &i386_optab[3259] }, /* vpermt2w */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2573], &i386_optab[2575] }, /* vfmadd132ss */
+  { &i386_optab[2374], &i386_optab[2376] }, /* vpunpckhdq */
+  { &i386_optab[957], &i386_optab[959] }, /* divss */
+  { &i386_optab[1826], &i386_optab[1828] }, /* vcmpnless */
+  { &i386_optab[3104], &i386_optab[3105] }, /* vpcmpnltuq */
+  { &i386_optab[3208], &i386_optab[3209] }, /* clflushopt */
+  { NULL, NULL },
+  { &i386_optab[3572], &i386_optab[3573] }, /* vcmpeq_osph */
+  { &i386_optab[1316], &i386_optab[1319] }, /* pabsb */
+  { &i386_optab[3215], &i386_optab[3216] }, /* encls */
+  { &i386_optab[1684], &i386_optab[1686] }, /* vcmpunord_sps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1868], &i386_optab[1870] }, /* vcmpunord_sss */
+  { &i386_optab[1268], &i386_optab[1269] }, /* vmxon */
+  { &i386_optab[1149], &i386_optab[1151] }, /* movntpd */
+  { NULL, NULL },
+  { &i386_optab[1155], &i386_optab[1157] }, /* mulsd */
+  { &i386_optab[2716], &i386_optab[2717] }, /* vpcomd */
+  { &i386_optab[2585], &i386_optab[2587] }, /* vfmaddsub132ps */
+  { &i386_optab[2507], &i386_optab[2512] }, /* vpgatherqd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2740], &i386_optab[2741] }, /* vpcomgtd */
+  { NULL, NULL },
+  { &i386_optab[2016], &i386_optab[2018] }, /* vmovapd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2874], &i386_optab[2875] }, /* pfrsqrt */
+  { &i386_optab[2137], &i386_optab[2140] }, /* vpcmpeqd */
+  { &i386_optab[2281], &i386_optab[2286] }, /* vpmovzxwd */
+  { &i386_optab[301], &i386_optab[302] }, /* setz */
+  { &i386_optab[493], &i386_optab[494] }, /* fimul */
+  { &i386_optab[3003], &i386_optab[3006] }, /* vpscatterdd */
+  { &i386_optab[2806], &i386_optab[2807] }, /* vpmacsdqh */
+  { NULL, NULL },
+  { &i386_optab[2832], &i386_optab[2833] }, /* vpshld */
+  { NULL, NULL },
+  { &i386_optab[3255], &i386_optab[3256] }, /* vpblendmb */
+  { &i386_optab[245], &i386_optab[247] }, /* enter */
+  { &i386_optab[1453], &i386_optab[1454] }, /* xgetbv */
+  { &i386_optab[3568], &i386_optab[3569] }, /* vcmpgtph */
+  { &i386_optab[3765], &i386_optab[3766] }, /* vrcpph */
+  { &i386_optab[3581], &i386_optab[3582] }, /* vcmpnge_uqph */
+  { &i386_optab[1830], &i386_optab[1832] }, /* vcmpordss */
+  { &i386_optab[3687], &i386_optab[3688] }, /* vcvtsh2sd */
+  { NULL, NULL },
+  { &i386_optab[1724], &i386_optab[1726] }, /* vcmpunord_qsd */
+  { &i386_optab[725], &i386_optab[726] }, /* mfence */
+  { NULL, NULL },
+  { &i386_optab[3451], &i386_optab[3452] }, /* saveprevssp */
+  { &i386_optab[1646], &i386_optab[1648] }, /* vcmpordps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2941], &i386_optab[2942] }, /* sha1msg1 */
+  { &i386_optab[3564], &i386_optab[3565] }, /* vcmpfalse_oqph */
+  { &i386_optab[664], &i386_optab[665] }, /* cmovb */
+  { &i386_optab[1452], &i386_optab[1453] }, /* xrstor64 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3650], &i386_optab[3651] }, /* vcvtuqq2ph */
+  { NULL, NULL },
+  { &i386_optab[2316], &i386_optab[2317] }, /* vpsignb */
+  { &i386_optab[2120], &i386_optab[2122] }, /* vpaddusb */
+  { &i386_optab[2359], &i386_optab[2361] }, /* vpsubq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3021], &i386_optab[3023] }, /* vcvtusi2ss */
+  { &i386_optab[2159], &i386_optab[2160] }, /* vpcmpistrm */
+  { &i386_optab[579], &i386_optab[580] }, /* dword */
+  { &i386_optab[1307], &i386_optab[1310] }, /* psignw */
+  { &i386_optab[2039], &i386_optab[2041] }, /* vmovlhps */
+  { &i386_optab[1359], &i386_optab[1361] }, /* pcmpeqq */
+  { &i386_optab[797], &i386_optab[800] }, /* pmullw */
+  { NULL, NULL },
+  { &i386_optab[1628], &i386_optab[1630] }, /* vcmple_osps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[794], &i386_optab[797] }, /* pmulhw */
+  { &i386_optab[3597], &i386_optab[3598] }, /* vcmpneqsh */
+  { NULL, NULL },
+  { &i386_optab[1896], &i386_optab[1898] }, /* vcmpps */
+  { NULL, NULL },
+  { &i386_optab[1690], &i386_optab[1692] }, /* vcmpnle_uqps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1900], &i386_optab[1902] }, /* vcmpss */
+  { &i386_optab[355], &i386_optab[358] }, /* stos */
+  { &i386_optab[1564], &i386_optab[1566] }, /* vcmpngtpd */
+  { &i386_optab[3707], &i386_optab[3708] }, /* vcvttph2uw */
+  { &i386_optab[1874], &i386_optab[1876] }, /* vcmpnle_uqss */
+  { &i386_optab[2460], &i386_optab[2463] }, /* vpermq */
+  { &i386_optab[2420], &i386_optab[2422] }, /* vucomisd */
+  { &i386_optab[2443], &i386_optab[2446] }, /* vpbroadcastd */
+  { &i386_optab[3551], &i386_optab[3552] }, /* vcmpneq_uqph */
+  { &i386_optab[124], &i386_optab[128] }, /* and */
+  { &i386_optab[3242], &i386_optab[3243] }, /* kortestq */
+  { &i386_optab[676], &i386_optab[677] }, /* cmovnbe */
+  { NULL, NULL },
+  { &i386_optab[2927], &i386_optab[2928] }, /* stac */
+  { &i386_optab[1519], &i386_optab[1520] }, /* vbroadcastf128 */
+  { &i386_optab[2589], &i386_optab[2591] }, /* vfmaddsub231ps */
+  { &i386_optab[900], &i386_optab[902] }, /* andnps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3535], &i386_optab[3536] }, /* vfcmaddcsh */
+  { &i386_optab[2846], &i386_optab[2847] }, /* blci */
+  { &i386_optab[2183], &i386_optab[2184] }, /* vphaddd */
+  { &i386_optab[2878], &i386_optab[2879] }, /* pi2fw */
+  { &i386_optab[1100], &i386_optab[1102] }, /* cmpltsd */
+  { &i386_optab[156], &i386_optab[157] }, /* cqo */
+  { &i386_optab[1532], &i386_optab[1534] }, /* vcmplt_ospd */
+  { &i386_optab[2918], &i386_optab[2919] }, /* xcryptcbc */
+  { &i386_optab[517], &i386_optab[518] }, /* fidivr */
+  { &i386_optab[47], &i386_optab[57] }, /* push */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1387], &i386_optab[1389] }, /* pminsb */
+  { &i386_optab[375], &i386_optab[376] }, /* int3 */
+  { NULL, NULL },
+  { &i386_optab[3152], &i386_optab[3155] }, /* vpmovusqw */
+  { &i386_optab[666], &i386_optab[667] }, /* cmovnae */
+  { &i386_optab[2759], &i386_optab[2760] }, /* vpcomequw */
+  { &i386_optab[620], &i386_optab[621] }, /* rex.wx */
+  { NULL, NULL },
+  { &i386_optab[3735], &i386_optab[3736] }, /* vfnmadd231sh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2705], &i386_optab[2706] }, /* vfnmsubpd */
+  { &i386_optab[530], &i386_optab[531] }, /* fdecstp */
+  { &i386_optab[2128], &i386_optab[2130] }, /* vpavgb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3108], &i386_optab[3109] }, /* vptestmq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1556], &i386_optab[1558] }, /* vcmpord_qpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3587], &i386_optab[3588] }, /* vcmptrue_usph */
+  { &i386_optab[1980], &i386_optab[1981] }, /* vdpps */
+  { NULL, NULL },
+  { &i386_optab[2841], &i386_optab[2842] }, /* blsi */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[404], &i386_optab[405] }, /* verw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[989], &i386_optab[992] }, /* movss */
+  { &i386_optab[893], &i386_optab[896] }, /* pxor */
+  { &i386_optab[3610], &i386_optab[3611] }, /* vcmpfalsesh */
+  { &i386_optab[3539], &i386_optab[3540] }, /* vfcmulcsh */
+  { &i386_optab[141], &i386_optab[142] }, /* neg */
+  { &i386_optab[2986], &i386_optab[2987] }, /* vbroadcasti32x4 */
+  { NULL, NULL },
+  { &i386_optab[3456], &i386_optab[3457] }, /* wrussq */
+  { &i386_optab[2961], &i386_optab[2962] }, /* vpternlogd */
+  { &i386_optab[1110], &i386_optab[1112] }, /* cmpnlesd */
+  { &i386_optab[1116], &i386_optab[1118] }, /* comisd */
+  { &i386_optab[3457], &i386_optab[3458] }, /* setssbsy */
+  { &i386_optab[1546], &i386_optab[1548] }, /* vcmpnltpd */
+  { &i386_optab[563], &i386_optab[564] }, /* fndisi */
+  { &i386_optab[2133], &i386_optab[2134] }, /* vpblendw */
+  { &i386_optab[1409], &i386_optab[1411] }, /* pmovzxbd */
+  { &i386_optab[3125], &i386_optab[3128] }, /* vpmovusdw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1429], &i386_optab[1431] }, /* roundsd */
+  { &i386_optab[1572], &i386_optab[1574] }, /* vcmpneq_oqpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3390], &i386_optab[3391] }, /* vpmadd52huq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1764], &i386_optab[1766] }, /* vcmpgt_ossd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2473], &i386_optab[2475] }, /* vpsravd */
+  { NULL, NULL },
+  { &i386_optab[3029], &i386_optab[3030] }, /* vcvttss2usi */
+  { &i386_optab[3397], &i386_optab[3398] }, /* v4fnmaddps */
+  { NULL, NULL },
+  { &i386_optab[186], &i386_optab[190] }, /* rcr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2786], &i386_optab[2788] }, /* vpermil2pd */
+  { NULL, NULL },
+  { &i386_optab[268], &i386_optab[269] }, /* jpe */
+  { &i386_optab[249], &i386_optab[250] }, /* jo */
+  { &i386_optab[3511], &i386_optab[3512] }, /* loadiwkey */
+  { &i386_optab[279], &i386_optab[280] }, /* jcxz */
+  { &i386_optab[609], &i386_optab[610] }, /* rex64xy */
+  { &i386_optab[2720], &i386_optab[2721] }, /* vpcomud */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3265], &i386_optab[3266] }, /* vpcmpleb */
+  { NULL, NULL },
+  { &i386_optab[429], &i386_optab[433] }, /* fcom */
+  { &i386_optab[275], &i386_optab[276] }, /* jle */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3470], &i386_optab[3471] }, /* movdiri */
+  { NULL, NULL },
+  { &i386_optab[2818], &i386_optab[2820] }, /* vprotb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[872], &i386_optab[875] }, /* psubusw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[364], &i386_optab[365] }, /* bsr */
+  { &i386_optab[3486], &i386_optab[3489] }, /* pvalidate */
+  { NULL, NULL },
+  { &i386_optab[2684], &i386_optab[2685] }, /* pext */
+  { NULL, NULL },
+  { &i386_optab[1423], &i386_optab[1425] }, /* ptest */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2734], &i386_optab[2735] }, /* vpcomleub */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[274], &i386_optab[275] }, /* jge */
+  { &i386_optab[439], &i386_optab[440] }, /* fcompp */
+  { &i386_optab[2676], &i386_optab[2677] }, /* xrelease */
+  { &i386_optab[2987], &i386_optab[2988] }, /* vbroadcastf64x4 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3712], &i386_optab[3713] }, /* vfmadd132ph */
+  { &i386_optab[628], &i386_optab[629] }, /* {disp32} */
+  { &i386_optab[3740], &i386_optab[3741] }, /* vfnmsub213sh */
+  { &i386_optab[1592], &i386_optab[1594] }, /* vcmpunord_spd */
+  { &i386_optab[2991], &i386_optab[2992] }, /* vpcompressq */
+  { &i386_optab[57], &i386_optab[58] }, /* pusha */
+  { &i386_optab[2184], &i386_optab[2185] }, /* vphaddsw */
+  { NULL, NULL },
+  { &i386_optab[2995], &i386_optab[2998] }, /* vpscatterqq */
+  { NULL, NULL },
+  { &i386_optab[972], &i386_optab[974] }, /* movhlps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3236], &i386_optab[3237] }, /* kandq */
+  { &i386_optab[2856], &i386_optab[2857] }, /* femms */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2863], &i386_optab[2864] }, /* pfcmpge */
+  { &i386_optab[2715], &i386_optab[2716] }, /* vpcomw */
+  { &i386_optab[3585], &i386_optab[3586] }, /* vcmpge_oqph */
+  { NULL, NULL },
+  { &i386_optab[2579], &i386_optab[2581] }, /* vfmaddsub132pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2842], &i386_optab[2843] }, /* blsmsk */
+  { &i386_optab[3609], &i386_optab[3610] }, /* vcmpngt_ussh */
+  { &i386_optab[1989], &i386_optab[1990] }, /* vhsubps */
+  { &i386_optab[3590], &i386_optab[3591] }, /* vcmpeq_oqsh */
+  { &i386_optab[1199], &i386_optab[1201] }, /* cvttpd2dq */
+  { &i386_optab[2690], &i386_optab[2691] }, /* vfmaddps */
+  { &i386_optab[2831], &i386_optab[2832] }, /* vpshlw */
+  { &i386_optab[3755], &i386_optab[3757] }, /* vmovw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2692], &i386_optab[2693] }, /* vfmaddss */
+  { &i386_optab[3041], &i386_optab[3042] }, /* vfixupimmsd */
+  { &i386_optab[2827], &i386_optab[2828] }, /* vpshaw */
+  { NULL, NULL },
+  { &i386_optab[1993], &i386_optab[1994] }, /* vlddqu */
+  { &i386_optab[1353], &i386_optab[1357] }, /* pblendvb */
+  { &i386_optab[3688], &i386_optab[3689] }, /* vcvtsh2ss */
+  { &i386_optab[1816], &i386_optab[1818] }, /* vcmpunord_qss */
+  { &i386_optab[2792], &i386_optab[2793] }, /* vphaddbw */
+  { &i386_optab[2804], &i386_optab[2805] }, /* vphsubwd */
+  { &i386_optab[2371], &i386_optab[2372] }, /* vptest */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[636], &i386_optab[637] }, /* {nooptimize} */
+  { &i386_optab[2942], &i386_optab[2943] }, /* sha1msg2 */
+  { &i386_optab[677], &i386_optab[678] }, /* cmova */
+  { &i386_optab[3058], &i386_optab[3059] }, /* vrndscaleps */
+  { &i386_optab[2271], &i386_optab[2276] }, /* vpmovzxbw */
+  { &i386_optab[1192], &i386_optab[1194] }, /* cvtsd2ss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[673], &i386_optab[674] }, /* cmovnz */
+  { &i386_optab[770], &i386_optab[773] }, /* pandn */
+  { NULL, NULL },
+  { &i386_optab[3341], &i386_optab[3342] }, /* vcvtqq2psx */
+  { &i386_optab[3607], &i386_optab[3608] }, /* vcmpnge_ussh */
+  { &i386_optab[3522], &i386_optab[3523] }, /* tdcall */
+  { NULL, NULL },
+  { &i386_optab[3489], &i386_optab[3492] }, /* rmpupdate */
+  { &i386_optab[1465], &i386_optab[1467] }, /* aesimc */
+  { &i386_optab[3739], &i386_optab[3740] }, /* vfnmsub132sh */
+  { &i386_optab[2982], &i386_optab[2983] }, /* vpermt2ps */
+  { &i386_optab[773], &i386_optab[776] }, /* pcmpeqb */
+  { &i386_optab[1163], &i386_optab[1165] }, /* sqrtsd */
+  { NULL, NULL },
+  { &i386_optab[170], &i386_optab[172] }, /* div */
+  { NULL, NULL },
+  { &i386_optab[3447], &i386_optab[3448] }, /* incsspd */
+  { &i386_optab[1196], &i386_optab[1197] }, /* cvttpd2pi */
+  { NULL, NULL },
+  { &i386_optab[3521], &i386_optab[3522] }, /* aesdecwide256kl */
+  { NULL, NULL },
+  { &i386_optab[417], &i386_optab[418] }, /* fist */
+  { &i386_optab[3426], &i386_optab[3428] }, /* vpdpwssds */
+  { &i386_optab[569], &i386_optab[570] }, /* ffreep */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2813], &i386_optab[2814] }, /* vpmacswd */
+  { NULL, NULL },
+  { &i386_optab[3531], &i386_optab[3532] }, /* hreset */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3530], &i386_optab[3531] }, /* senduipi */
+  { &i386_optab[1656], &i386_optab[1658] }, /* vcmpngtps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3176], &i386_optab[3177] }, /* vpbroadcastmw2d */
+  { NULL, NULL },
+  { &i386_optab[701], &i386_optab[702] }, /* fcmova */
+  { &i386_optab[866], &i386_optab[869] }, /* psubsw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[612], &i386_optab[613] }, /* rex.x */
+  { &i386_optab[34], &i386_optab[35] }, /* movsbw */
+  { &i386_optab[2710], &i386_optab[2711] }, /* vfrczps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3770], &i386_optab[3771] }, /* vscalefsh */
+  { &i386_optab[2002], &i386_optab[2004] }, /* vmaxps */
+  { NULL, NULL },
+  { &i386_optab[1981], &i386_optab[1982] }, /* vextractf128 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2161], &i386_optab[2165] }, /* vpermilpd */
+  { NULL, NULL },
+  { &i386_optab[3071], &i386_optab[3072] }, /* vrsqrt14pd */
+  { &i386_optab[1794], &i386_optab[1796] }, /* vcmpneq_ossd */
+  { &i386_optab[3703], &i386_optab[3706] }, /* vcvtph2psx */
+  { &i386_optab[906], &i386_optab[908] }, /* cmpltps */
+  { NULL, NULL },
+  { &i386_optab[1435], &i386_optab[1439] }, /* pcmpestri */
+  { &i386_optab[385], &i386_optab[387] }, /* lgdt */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2760], &i386_optab[2761] }, /* vpcomequd */
+  { &i386_optab[3268], &i386_optab[3269] }, /* vpcmpnleb */
+  { &i386_optab[902], &i386_optab[904] }, /* andps */
+  { &i386_optab[46], &i386_optab[47] }, /* movzx */
+  { &i386_optab[2531], &i386_optab[2534] }, /* vpclmulhqhqdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3320], &i386_optab[3321] }, /* kshiftlb */
+  { &i386_optab[1614], &i386_optab[1616] }, /* vcmpgt_oqpd */
+  { &i386_optab[2345], &i386_optab[2347] }, /* vpsrldq */
+  { &i386_optab[91], &i386_optab[92] }, /* lahf */
+  { &i386_optab[3385], &i386_optab[3386] }, /* vrangesd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2702], &i386_optab[2703] }, /* vfnmaddps */
+  { &i386_optab[3030], &i386_optab[3031] }, /* vcvtudq2ps */
+  { &i386_optab[3059], &i386_optab[3060] }, /* vinsertf32x4 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3573], &i386_optab[3574] }, /* vcmplt_oqph */
+  { &i386_optab[190], &i386_optab[194] }, /* sal */
+  { &i386_optab[1209], &i386_optab[1210] }, /* movdq2q */
+  { NULL, NULL },
+  { &i386_optab[3064], &i386_optab[3065] }, /* vmovdqa32 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2882], &i386_optab[2883] }, /* sysret */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3618], &i386_optab[3619] }, /* vcmptrue_uqsh */
+  { NULL, NULL },
+  { &i386_optab[3042], &i386_optab[3043] }, /* vgetmantsd */
+  { &i386_optab[293], &i386_optab[294] }, /* setno */
+  { &i386_optab[1431], &i386_optab[1433] }, /* roundss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[938], &i386_optab[940] }, /* cmpss */
+  { &i386_optab[1664], &i386_optab[1666] }, /* vcmpneq_oqps */
+  { &i386_optab[1417], &i386_optab[1419] }, /* pmovzxdq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3492], &i386_optab[3495] }, /* rmpadjust */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1672], &i386_optab[1674] }, /* vcmpgt_osps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3579], &i386_optab[3580] }, /* vcmpord_sph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[395], &i386_optab[397] }, /* sidt */
+  { &i386_optab[65], &i386_optab[69] }, /* xchg */
+  { NULL, NULL },
+  { &i386_optab[1742], &i386_optab[1744] }, /* vcmpeq_uqsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[654], &i386_optab[655] }, /* fxrstor */
+  { &i386_optab[1260], &i386_optab[1261] }, /* vmresume */
+  { NULL, NULL },
+  { &i386_optab[1560], &i386_optab[1562] }, /* vcmpngepd */
+  { NULL, NULL },
+  { &i386_optab[3006], &i386_optab[3009] }, /* vscatterdps */
+  { &i386_optab[3202], &i386_optab[3203] }, /* vgatherpf1qps */
+  { &i386_optab[313], &i386_optab[314] }, /* setpo */
+  { &i386_optab[3092], &i386_optab[3093] }, /* vpcmpnleud */
+  { &i386_optab[69], &i386_optab[73] }, /* in */
+  { &i386_optab[224], &i386_optab[232] }, /* jmp */
+  { &i386_optab[446], &i386_optab[447] }, /* fxam */
+  { &i386_optab[3614], &i386_optab[3615] }, /* vcmpge_ossh */
+  { &i386_optab[2424], &i386_optab[2426] }, /* vunpckhpd */
+  { &i386_optab[3095], &i386_optab[3096] }, /* vpcmpleq */
+  { &i386_optab[3514], &i386_optab[3515] }, /* aesenc128kl */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3290], &i386_optab[3291] }, /* vpmovw2m */
+  { NULL, NULL },
+  { &i386_optab[581], &i386_optab[582] }, /* wait */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3306], &i386_optab[3307] }, /* kaddb */
+  { NULL, NULL },
+  { &i386_optab[3723], &i386_optab[3724] }, /* vfmsub231ph */
+  { &i386_optab[3369], &i386_optab[3370] }, /* vfpclasspdx */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2697], &i386_optab[2698] }, /* vfmsubpd */
+  { &i386_optab[378], &i386_optab[379] }, /* rsm */
+  { &i386_optab[2969], &i386_optab[2970] }, /* vpermt2q */
+  { &i386_optab[3414], &i386_optab[3415] }, /* vpshldd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3308], &i386_optab[3309] }, /* kandnb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3717], &i386_optab[3718] }, /* vfmadd231sh */
+  { NULL, NULL },
+  { &i386_optab[3752], &i386_optab[3753] }, /* vminsh */
+  { NULL, NULL },
+  { &i386_optab[3436], &i386_optab[3439] }, /* monitorx */
+  { &i386_optab[2888], &i386_optab[2890] }, /* skinit */
+  { &i386_optab[642], &i386_optab[643] }, /* invlpg */
+  { NULL, NULL },
+  { &i386_optab[986], &i386_optab[987] }, /* movntq */
+  { &i386_optab[3373], &i386_optab[3374] }, /* vfpclasspsz */
+  { &i386_optab[3404], &i386_optab[3405] }, /* vpcompressb */
+  { NULL, NULL },
+  { &i386_optab[3537], &i386_optab[3538] }, /* vfmaddcsh */
+  { NULL, NULL },
+  { &i386_optab[3299], &i386_optab[3302] }, /* vpmovwb */
+  { &i386_optab[1770], &i386_optab[1772] }, /* vcmpeq_ossd */
+  { &i386_optab[2314], &i386_optab[2316] }, /* vpshuflw */
+  { NULL, NULL },
+  { &i386_optab[2798], &i386_optab[2799] }, /* vphadduwd */
+  { &i386_optab[2372], &i386_optab[2374] }, /* vpunpckhbw */
+  { &i386_optab[164], &i386_optab[170] }, /* imul */
+  { &i386_optab[2071], &i386_optab[2073] }, /* vmovsldup */
+  { &i386_optab[2812], &i386_optab[2813] }, /* vpmacssww */
+  { &i386_optab[3307], &i386_optab[3308] }, /* kandb */
+  { &i386_optab[3649], &i386_optab[3650] }, /* vcvtqq2phy */
+  { &i386_optab[625], &i386_optab[626] }, /* rex.wrxb */
+  { &i386_optab[610], &i386_optab[611] }, /* rex64xyz */
+  { &i386_optab[2870], &i386_optab[2871] }, /* pfrcp */
+  { &i386_optab[2899], &i386_optab[2900] }, /* movntsd */
+  { &i386_optab[2312], &i386_optab[2314] }, /* vpshufhw */
+  { &i386_optab[2738], &i386_optab[2739] }, /* vpcomgtb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2864], &i386_optab[2865] }, /* pfcmpgt */
+  { &i386_optab[2020], &i386_optab[2023] }, /* vmovd */
+  { &i386_optab[2134], &i386_optab[2137] }, /* vpcmpeqb */
+  { &i386_optab[2463], &i386_optab[2464] }, /* vextracti128 */
+  { &i386_optab[2077], &i386_optab[2079] }, /* vmovupd */
+  { &i386_optab[489], &i386_optab[493] }, /* fmul */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2912], &i386_optab[2913] }, /* xcrypt-ofb */
+  { &i386_optab[1762], &i386_optab[1764] }, /* vcmpgtsd */
+  { &i386_optab[3182], &i386_optab[3183] }, /* vexp2ps */
+  { NULL, NULL },
+  { &i386_optab[809], &i386_optab[815] }, /* pslld */
+  { &i386_optab[1066], &i386_optab[1068] }, /* ucomiss */
+  { NULL, NULL },
+  { &i386_optab[2828], &i386_optab[2829] }, /* vpshad */
+  { &i386_optab[782], &i386_optab[785] }, /* pcmpgtb */
+  { &i386_optab[2536], &i386_optab[2538] }, /* vgf2p8affineqb */
+  { &i386_optab[758], &i386_optab[761] }, /* paddsw */
+  { NULL, NULL },
+  { &i386_optab[3636], &i386_optab[3637] }, /* vcomish */
+  { &i386_optab[3772], &i386_optab[3773] }, /* vsqrtsh */
+  { NULL, NULL },
+  { &i386_optab[1788], &i386_optab[1790] }, /* vcmpnge_uqsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[564], &i386_optab[565] }, /* fdisi */
+  { &i386_optab[3719], &i386_optab[3720] }, /* vfmaddsub213ph */
+  { &i386_optab[680], &i386_optab[681] }, /* cmovp */
+  { &i386_optab[2261], &i386_optab[2266] }, /* vpmovzxbd */
+  { &i386_optab[3658], &i386_optab[3660] }, /* vcvtps2phx */
+  { &i386_optab[1141], &i386_optab[1144] }, /* movhpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2317], &i386_optab[2318] }, /* vpsignd */
+  { &i386_optab[3611], &i386_optab[3612] }, /* vcmpfalse_oqsh */
+  { NULL, NULL },
+  { &i386_optab[604], &i386_optab[605] }, /* rex64z */
+  { &i386_optab[3342], &i386_optab[3343] }, /* vcvtqq2psy */
+  { &i386_optab[3549], &i386_optab[3550] }, /* vcmpunord_qph */
+  { &i386_optab[155], &i386_optab[156] }, /* cdq */
+  { &i386_optab[2369], &i386_optab[2371] }, /* vpsubw */
+  { &i386_optab[2084], &i386_optab[2086] }, /* vmulps */
+  { NULL, NULL },
+  { &i386_optab[3721], &i386_optab[3722] }, /* vfmsub132ph */
+  { NULL, NULL },
+  { &i386_optab[2866], &i386_optab[2867] }, /* pfmin */
+  { NULL, NULL },
+  { &i386_optab[1173], &i386_optab[1175] }, /* unpcklpd */
+  { &i386_optab[1325], &i386_optab[1327] }, /* blendpd */
+  { &i386_optab[3173], &i386_optab[3174] }, /* vshuff64x2 */
+  { NULL, NULL },
+  { &i386_optab[3452], &i386_optab[3453] }, /* rstorssp */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2814], &i386_optab[2815] }, /* vpmacsww */
+  { NULL, NULL },
+  { &i386_optab[1445], &i386_optab[1447] }, /* pcmpistrm */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[145], &i386_optab[146] }, /* daa */
+  { &i386_optab[3608], &i386_optab[3609] }, /* vcmpngtsh */
+  { &i386_optab[723], &i386_optab[724] }, /* clflush */
+  { &i386_optab[3424], &i386_optab[3426] }, /* vpdpbusds */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1513], &i386_optab[1515] }, /* vandps */
+  { &i386_optab[3013], &i386_optab[3016] }, /* vcvtpd2udq */
+  { &i386_optab[2729], &i386_optab[2730] }, /* vpcomltuq */
+  { &i386_optab[3697], &i386_optab[3700] }, /* vcvttph2qq */
+  { &i386_optab[3478], &i386_optab[3479] }, /* vdpbf16ps */
+  { &i386_optab[531], &i386_optab[532] }, /* fincstp */
+  { &i386_optab[390], &i386_optab[391] }, /* lmsw */
+  { &i386_optab[3592], &i386_optab[3593] }, /* vcmplt_ossh */
+  { &i386_optab[1383], &i386_optab[1385] }, /* pmaxud */
+  { &i386_optab[2901], &i386_optab[2903] }, /* extrq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[968], &i386_optab[970] }, /* minss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3244], &i386_optab[3245] }, /* kunpckdq */
+  { &i386_optab[752], &i386_optab[755] }, /* paddq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2631], &i386_optab[2633] }, /* vfnmadd231pd */
+  { &i386_optab[374], &i386_optab[375] }, /* int1 */
+  { &i386_optab[349], &i386_optab[352] }, /* scas */
+  { NULL, NULL },
+  { &i386_optab[3170], &i386_optab[3171] }, /* vrsqrt14ss */
+  { &i386_optab[3078], &i386_optab[3079] }, /* vporq */
+  { &i386_optab[2563], &i386_optab[2565] }, /* vfmadd213ps */
+  { &i386_optab[1255], &i386_optab[1257] }, /* mwait */
+  { &i386_optab[567], &i386_optab[568] }, /* frstpm */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[904], &i386_optab[906] }, /* cmpeqps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3604], &i386_optab[3605] }, /* vcmpord_qsh */
+  { &i386_optab[2108], &i386_optab[2110] }, /* vpaddsb */
+  { &i386_optab[920], &i386_optab[922] }, /* cmpeqss */
+  { &i386_optab[3303], &i386_optab[3304] }, /* vptestmw */
+  { NULL, NULL },
+  { &i386_optab[3249], &i386_optab[3250] }, /* kshiftlq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1686], &i386_optab[1688] }, /* vcmpneq_usps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1800], &i386_optab[1802] }, /* vcmptrue_ussd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3384], &i386_optab[3385] }, /* vreduceps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1730], &i386_optab[1732] }, /* vcmpnltsd */
+  { NULL, NULL },
+  { &i386_optab[3563], &i386_optab[3564] }, /* vcmpfalseph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1121], &i386_optab[1127] }, /* cvtsi2sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1094], &i386_optab[1096] }, /* cmpnlepd */
+  { &i386_optab[1505], &i386_optab[1506] }, /* vaddsubpd */
+  { &i386_optab[312], &i386_optab[313] }, /* setnp */
+  { NULL, NULL },
+  { &i386_optab[707], &i386_optab[710] }, /* fucomi */
+  { &i386_optab[476], &i386_optab[482] }, /* fsubr */
+  { &i386_optab[1369], &i386_optab[1371] }, /* phminposuw */
+  { &i386_optab[3612], &i386_optab[3613] }, /* vcmpneq_oqsh */
+  { &i386_optab[3364], &i386_optab[3365] }, /* vinsertf64x2 */
+  { &i386_optab[352], &i386_optab[355] }, /* ssca */
+  { &i386_optab[595], &i386_optab[596] }, /* rex */
+  { NULL, NULL },
+  { &i386_optab[2775], &i386_optab[2776] }, /* vpcomfalseuw */
+  { &i386_optab[2146], &i386_optab[2148] }, /* vpcmpestri */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3233], &i386_optab[3234] }, /* kxord */
+  { &i386_optab[3209], &i386_optab[3210] }, /* xrstors */
+  { &i386_optab[1927], &i386_optab[1929] }, /* vcvtpd2psx */
+  { NULL, NULL },
+  { &i386_optab[182], &i386_optab[186] }, /* rcl */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[540], &i386_optab[541] }, /* fchs */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1952], &i386_optab[1954] }, /* vcvtss2sd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[174], &i386_optab[178] }, /* rol */
+  { &i386_optab[2673], &i386_optab[2675] }, /* vfnmsub231ss */
+  { &i386_optab[2378], &i386_optab[2380] }, /* vpunpckhwd */
+  { &i386_optab[539], &i386_optab[540] }, /* fcos */
+  { &i386_optab[3722], &i386_optab[3723] }, /* vfmsub213ph */
+  { &i386_optab[3463], &i386_optab[3464] }, /* pconfig */
+  { &i386_optab[2426], &i386_optab[2428] }, /* vunpckhps */
+  { &i386_optab[1151], &i386_optab[1153] }, /* movupd */
+  { &i386_optab[2212], &i386_optab[2214] }, /* vpmaxub */
+  { &i386_optab[276], &i386_optab[277] }, /* jng */
+  { &i386_optab[734], &i386_optab[737] }, /* packssdw */
+  { &i386_optab[2437], &i386_optab[2438] }, /* vzeroupper */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2661], &i386_optab[2663] }, /* vfnmsub231ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3370], &i386_optab[3371] }, /* vfpclasspdy */
+  { &i386_optab[1998], &i386_optab[2000] }, /* vmaskmovps */
+  { &i386_optab[1345], &i386_optab[1347] }, /* insertps */
+  { &i386_optab[2635], &i386_optab[2637] }, /* vfnmadd213ps */
+  { &i386_optab[2955], &i386_optab[2956] }, /* knotw */
+  { NULL, NULL },
+  { &i386_optab[2698], &i386_optab[2699] }, /* vfmsubps */
+  { NULL, NULL },
+  { &i386_optab[3395], &i386_optab[3396] }, /* vpermt2b */
+  { &i386_optab[2647], &i386_optab[2649] }, /* vfnmadd213ss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3326], &i386_optab[3327] }, /* vbroadcastf64x2 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2333], &i386_optab[2337] }, /* vpsrad */
+  { &i386_optab[2754], &i386_optab[2755] }, /* vpcomeqb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3554], &i386_optab[3555] }, /* vcmpnleph */
+  { NULL, NULL },
+  { &i386_optab[3274], &i386_optab[3275] }, /* vpcmpnltub */
+  { NULL, NULL },
+  { &i386_optab[3217], &i386_optab[3218] }, /* enclv */
+  { &i386_optab[3375], &i386_optab[3376] }, /* vfpclasspsy */
+  { &i386_optab[3640], &i386_optab[3641] }, /* vcvtdq2phx */
+  { NULL, NULL },
+  { &i386_optab[3289], &i386_optab[3290] }, /* vpmovb2m */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3737], &i386_optab[3738] }, /* vfnmsub213ph */
+  { &i386_optab[2028], &i386_optab[2029] }, /* vmovdqu */
+  { &i386_optab[1776], &i386_optab[1778] }, /* vcmpunord_ssd */
+  { &i386_optab[2900], &i386_optab[2901] }, /* movntss */
+  { &i386_optab[3648], &i386_optab[3649] }, /* vcvtqq2phx */
+  { &i386_optab[2801], &i386_optab[2802] }, /* vphaddwq */
+  { &i386_optab[526], &i386_optab[527] }, /* fptan */
+  { &i386_optab[2458], &i386_optab[2460] }, /* vpermps */
+  { &i386_optab[2717], &i386_optab[2718] }, /* vpcomq */
+  { NULL, NULL },
+  { &i386_optab[2236], &i386_optab[2241] }, /* vpmovsxbq */
+  { &i386_optab[3109], &i386_optab[3110] }, /* vptestnmq */
+  { &i386_optab[2811], &i386_optab[2812] }, /* vpmacsswd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2933], &i386_optab[2935] }, /* bndcu */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2286], &i386_optab[2291] }, /* vpmovzxwq */
+  { &i386_optab[2079], &i386_optab[2081] }, /* vmovups */
+  { NULL, NULL },
+  { &i386_optab[1566], &i386_optab[1568] }, /* vcmpngt_uspd */
+  { &i386_optab[1618], &i386_optab[1620] }, /* vcmpeqps */
+  { &i386_optab[3371], &i386_optab[3373] }, /* vfpclassps */
+  { &i386_optab[545], &i386_optab[546] }, /* fnstcw */
+  { &i386_optab[1517], &i386_optab[1518] }, /* vblendvpd */
+  { &i386_optab[2833], &i386_optab[2834] }, /* vpshlq */
+  { &i386_optab[2623], &i386_optab[2625] }, /* vfmsubadd213ps */
+  { &i386_optab[3543], &i386_optab[3544] }, /* vcmpeq_oqph */
+  { &i386_optab[2809], &i386_optab[2810] }, /* vpmacssdqh */
+  { &i386_optab[440], &i386_optab[442] }, /* fucom */
+  { &i386_optab[2965], &i386_optab[2966] }, /* vpblendmq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[157], &i386_optab[158] }, /* cbtw */
+  { &i386_optab[3039], &i386_optab[3040] }, /* vfixupimmpd */
+  { NULL, NULL },
+  { &i386_optab[3670], &i386_optab[3673] }, /* vcvtph2qq */
+  { &i386_optab[2522], &i386_optab[2525] }, /* vpclmullqlqdq */
+  { &i386_optab[1177], &i386_optab[1179] }, /* cvtdq2pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2985], &i386_optab[2986] }, /* vbroadcastf32x4 */
+  { NULL, NULL },
+  { &i386_optab[3028], &i386_optab[3029] }, /* vcvttsd2usi */
+  { NULL, NULL },
+  { &i386_optab[2382], &i386_optab[2384] }, /* vpunpckldq */
+  { &i386_optab[662], &i386_optab[663] }, /* cmovo */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2276], &i386_optab[2281] }, /* vpmovzxdq */
+  { &i386_optab[2793], &i386_optab[2794] }, /* vphadddq */
+  { &i386_optab[2318], &i386_optab[2319] }, /* vpsignw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[605], &i386_optab[606] }, /* rex64y */
+  { &i386_optab[2122], &i386_optab[2124] }, /* vpaddusw */
+  { &i386_optab[2946], &i386_optab[2947] }, /* sha256msg2 */
+  { &i386_optab[2436], &i386_optab[2437] }, /* vzeroall */
+  { &i386_optab[3706], &i386_optab[3707] }, /* vcvttph2w */
+  { &i386_optab[547], &i386_optab[550] }, /* fnstsw */
+  { &i386_optab[1310], &i386_optab[1313] }, /* psignd */
+  { &i386_optab[3355], &i386_optab[3356] }, /* vcvtuqq2psy */
+  { NULL, NULL },
+  { &i386_optab[779], &i386_optab[782] }, /* pcmpeqd */
+  { &i386_optab[2357], &i386_optab[2359] }, /* vpsubd */
+  { &i386_optab[1327], &i386_optab[1329] }, /* blendps */
+  { &i386_optab[3594], &i386_optab[3595] }, /* vcmple_ossh */
+  { &i386_optab[3560], &i386_optab[3561] }, /* vcmpnge_usph */
+  { &i386_optab[3736], &i386_optab[3737] }, /* vfnmsub132ph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2881], &i386_optab[2882] }, /* syscall */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2293], &i386_optab[2295] }, /* vpmulhrsw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[576], &i386_optab[577] }, /* data16 */
+  { &i386_optab[1622], &i386_optab[1624] }, /* vcmpltps */
+  { &i386_optab[3187], &i386_optab[3188] }, /* vrcp28sd */
+  { &i386_optab[560], &i386_optab[561] }, /* frstor */
+  { NULL, NULL },
+  { &i386_optab[2678], &i386_optab[2679] }, /* xbegin */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1806], &i386_optab[1808] }, /* vcmpltss */
+  { NULL, NULL },
+  { &i386_optab[2035], &i386_optab[2039] }, /* vmovhps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2726], &i386_optab[2727] }, /* vpcomltub */
+  { NULL, NULL },
+  { &i386_optab[634], &i386_optab[635] }, /* {evex} */
+  { &i386_optab[3047], &i386_optab[3048] }, /* vscalefpd */
+  { &i386_optab[36], &i386_optab[37] }, /* movsbq */
+  { NULL, NULL },
+  { &i386_optab[3460], &i386_optab[3461] }, /* endbr32 */
+  { &i386_optab[1078], &i386_optab[1080] }, /* andnpd */
+  { &i386_optab[565], &i386_optab[566] }, /* fnsetpm */
+  { &i386_optab[1449], &i386_optab[1450] }, /* xsave */
+  { NULL, NULL },
+  { &i386_optab[2104], &i386_optab[2106] }, /* vpackusdw */
+  { &i386_optab[132], &i386_optab[136] }, /* xor */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2903], &i386_optab[2905] }, /* insertq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[143], &i386_optab[144] }, /* aaa */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1220], &i386_optab[1222] }, /* pslldq */
+  { &i386_optab[2949], &i386_optab[2950] }, /* korw */
+  { NULL, NULL },
+  { &i386_optab[3377], &i386_optab[3378] }, /* vpmovq2m */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1610], &i386_optab[1612] }, /* vcmpneq_ospd */
+  { &i386_optab[3499], &i386_optab[3500] }, /* ldtilecfg */
+  { &i386_optab[1961], &i386_optab[1963] }, /* vcvttpd2dqx */
+  { &i386_optab[1780], &i386_optab[1782] }, /* vcmpnlt_uqsd */
+  { &i386_optab[3085], &i386_optab[3086] }, /* vpcmpnled */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1878], &i386_optab[1880] }, /* vcmpeq_usss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3381], &i386_optab[3382] }, /* vrangepd */
+  { &i386_optab[409], &i386_optab[411] }, /* fild */
+  { &i386_optab[924], &i386_optab[926] }, /* cmpless */
+  { &i386_optab[3753], &i386_optab[3755] }, /* vmovsh */
+  { &i386_optab[1694], &i386_optab[1696] }, /* vcmpeq_usps */
+  { &i386_optab[3623], &i386_optab[3624] }, /* vcmpneq_ussh */
+  { NULL, NULL },
+  { &i386_optab[1798], &i386_optab[1800] }, /* vcmpgt_oqsd */
+  { &i386_optab[1906], &i386_optab[1911] }, /* vcvtdq2pd */
+  { &i386_optab[2907], &i386_optab[2908] }, /* xstore-rng */
+  { &i386_optab[1201], &i386_optab[1203] }, /* cvttps2dq */
+  { NULL, NULL },
+  { &i386_optab[3495], &i386_optab[3496] }, /* rdpru */
+  { &i386_optab[3315], &i386_optab[3316] }, /* ktestb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[202], &i386_optab[206] }, /* sar */
+  { NULL, NULL },
+  { &i386_optab[3455], &i386_optab[3456] }, /* wrussd */
+  { &i386_optab[161], &i386_optab[162] }, /* cltd */
+  { &i386_optab[1822], &i386_optab[1824] }, /* vcmpnltss */
+  { &i386_optab[1407], &i386_optab[1409] }, /* pmovzxbw */
+  { &i386_optab[2517], &i386_optab[2518] }, /* vaesimc */
+  { &i386_optab[2963], &i386_optab[2964] }, /* vpternlogq */
+  { &i386_optab[3357], &i386_optab[3358] }, /* vextracti32x8 */
+  { &i386_optab[2439], &i386_optab[2440] }, /* vpblendd */
+  { &i386_optab[2745], &i386_optab[2746] }, /* vpcomgtuq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[305], &i386_optab[306] }, /* setna */
+  { &i386_optab[2306], &i386_optab[2308] }, /* vpsadbw */
+  { &i386_optab[3250], &i386_optab[3251] }, /* kshiftrd */
+  { &i386_optab[1956], &i386_optab[1961] }, /* vcvttpd2dq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1929], &i386_optab[1931] }, /* vcvtpd2psy */
+  { &i386_optab[3571], &i386_optab[3572] }, /* vcmptrue_uqph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[381], &i386_optab[383] }, /* nop */
+  { &i386_optab[77], &i386_optab[78] }, /* lea */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1558], &i386_optab[1560] }, /* vcmpeq_uqpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[258], &i386_optab[259] }, /* jz */
+  { NULL, NULL },
+  { &i386_optab[2719], &i386_optab[2720] }, /* vpcomuw */
+  { NULL, NULL },
+  { &i386_optab[1744], &i386_optab[1746] }, /* vcmpngesd */
+  { &i386_optab[3513], &i386_optab[3514] }, /* encodekey256 */
+  { &i386_optab[952], &i386_optab[953] }, /* cvttps2pi */
+  { NULL, NULL },
+  { &i386_optab[608], &i386_optab[609] }, /* rex64xz */
+  { &i386_optab[2908], &i386_optab[2909] }, /* xcrypt-ecb */
+  { NULL, NULL },
+  { &i386_optab[3541], &i386_optab[3542] }, /* vfmulcsh */
+  { NULL, NULL },
+  { &i386_optab[3062], &i386_optab[3063] }, /* vinserti64x4 */
+  { NULL, NULL },
+  { &i386_optab[3396], &i386_optab[3397] }, /* v4fmaddps */
+  { &i386_optab[3442], &i386_optab[3443] }, /* wrpkru */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1003], &i386_optab[1006] }, /* pavgw */
+  { &i386_optab[3398], &i386_optab[3399] }, /* v4fmaddss */
+  { NULL, NULL },
+  { &i386_optab[869], &i386_optab[872] }, /* psubusb */
+  { &i386_optab[660], &i386_optab[661] }, /* ud2b */
+  { &i386_optab[3567], &i386_optab[3568] }, /* vcmpge_osph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2687], &i386_optab[2688] }, /* shlx */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1608], &i386_optab[1610] }, /* vcmpfalse_ospd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2008], &i386_optab[2010] }, /* vminpd */
+  { NULL, NULL },
+  { &i386_optab[2757], &i386_optab[2758] }, /* vpcomeqq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2559], &i386_optab[2561] }, /* vfmadd231pd */
+  { &i386_optab[1259], &i386_optab[1260] }, /* vmlaunch */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2930], &i386_optab[2931] }, /* bndmov */
+  { NULL, NULL },
+  { &i386_optab[2528], &i386_optab[2531] }, /* vpclmullqhqdq */
+  { &i386_optab[426], &i386_optab[427] }, /* fbstp */
+  { &i386_optab[3374], &i386_optab[3375] }, /* vfpclasspsx */
+  { &i386_optab[2488], &i386_optab[2493] }, /* vgatherqpd */
+  { &i386_optab[3472], &i386_optab[3473] }, /* vcvtne2ps2bf16 */
+  { &i386_optab[1828], &i386_optab[1830] }, /* vcmpnle_usss */
+  { &i386_optab[589], &i386_optab[590] }, /* repe */
+  { &i386_optab[1179], &i386_optab[1181] }, /* cvtpd2dq */
+  { NULL, NULL },
+  { &i386_optab[1586], &i386_optab[1588] }, /* vcmpeq_ospd */
+  { &i386_optab[3641], &i386_optab[3642] }, /* vcvtdq2phy */
+  { NULL, NULL },
+  { &i386_optab[3223], &i386_optab[3224] }, /* kandd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1092], &i386_optab[1094] }, /* cmpnltpd */
+  { NULL, NULL },
+  { &i386_optab[3566], &i386_optab[3567] }, /* vcmpgeph */
+  { &i386_optab[1211], &i386_optab[1214] }, /* pmuludq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[498], &i386_optab[504] }, /* fdiv */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1948], &i386_optab[1952] }, /* vcvtsi2ss */
+  { &i386_optab[912], &i386_optab[914] }, /* cmpneqps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1183], &i386_optab[1184] }, /* cvtpd2pi */
+  { &i386_optab[405], &i386_optab[409] }, /* fld */
+  { &i386_optab[3038], &i386_optab[3039] }, /* vextracti64x4 */
+  { &i386_optab[1578], &i386_optab[1580] }, /* vcmpgtpd */
+  { &i386_optab[2773], &i386_optab[2774] }, /* vpcomfalseq */
+  { &i386_optab[1493], &i386_optab[1495] }, /* gf2p8affineinvqb */
+  { &i386_optab[1604], &i386_optab[1606] }, /* vcmpnge_uqpd */
+  { &i386_optab[2826], &i386_optab[2827] }, /* vpshab */
+  { &i386_optab[3504], &i386_optab[3505] }, /* tdpbusd */
+  { &i386_optab[2790], &i386_optab[2791] }, /* vphaddbd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2401], &i386_optab[2403] }, /* vsqrtpd */
+  { NULL, NULL },
+  { &i386_optab[3764], &i386_optab[3765] }, /* vrndscalesh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1570], &i386_optab[1572] }, /* vcmpfalse_oqpd */
+  { &i386_optab[2974], &i386_optab[2975] }, /* vprolvq */
+  { &i386_optab[663], &i386_optab[664] }, /* cmovno */
+  { &i386_optab[2816], &i386_optab[2817] }, /* vpmadcswd */
+  { &i386_optab[693], &i386_optab[694] }, /* fcmovnae */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3016], &i386_optab[3017] }, /* vcvtsd2usi */
+  { NULL, NULL },
+  { &i386_optab[702], &i386_optab[703] }, /* fcmovnbe */
+  { &i386_optab[607], &i386_optab[608] }, /* rex64x */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3354], &i386_optab[3355] }, /* vcvtuqq2psx */
+  { &i386_optab[2542], &i386_optab[2543] }, /* rdrand */
+  { NULL, NULL },
+  { &i386_optab[2158], &i386_optab[2159] }, /* vpcmpistri */
+  { &i386_optab[2683], &i386_optab[2684] }, /* pdep */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3214], &i386_optab[3215] }, /* xsavec64 */
+  { &i386_optab[2730], &i386_optab[2731] }, /* vpcomleb */
+  { &i386_optab[159], &i386_optab[160] }, /* cwtl */
+  { &i386_optab[624], &i386_optab[625] }, /* rex.wrx */
+  { &i386_optab[1922], &i386_optab[1927] }, /* vcvtpd2ps */
+  { &i386_optab[2603], &i386_optab[2605] }, /* vfmsub132sd */
+  { &i386_optab[2224], &i386_optab[2226] }, /* vpminub */
+  { NULL, NULL },
+  { &i386_optab[1232], &i386_optab[1234] }, /* haddpd */
+  { NULL, NULL },
+  { &i386_optab[3473], &i386_optab[3476] }, /* vcvtneps2bf16 */
+  { NULL, NULL },
+  { &i386_optab[3570], &i386_optab[3571] }, /* vcmptrueph */
+  { &i386_optab[86], &i386_optab[87] }, /* clc */
+  { &i386_optab[1171], &i386_optab[1173] }, /* unpckhpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[146], &i386_optab[147] }, /* das */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2416], &i386_optab[2418] }, /* vsubss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3096], &i386_optab[3097] }, /* vpcmpneqq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[692], &i386_optab[693] }, /* fcmovb */
+  { &i386_optab[2319], &i386_optab[2323] }, /* vpslld */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[100], &i386_optab[104] }, /* add */
+  { &i386_optab[2677], &i386_optab[2678] }, /* xabort */
+  { &i386_optab[3545], &i386_optab[3546] }, /* vcmplt_osph */
+  { &i386_optab[3345], &i386_optab[3348] }, /* vcvttps2qq */
+  { NULL, NULL },
+  { &i386_optab[97], &i386_optab[98] }, /* stc */
+  { &i386_optab[41], &i386_optab[44] }, /* movsxd */
+  { &i386_optab[3750], &i386_optab[3751] }, /* vmaxsh */
+  { NULL, NULL },
+  { &i386_optab[1379], &i386_optab[1381] }, /* pmaxsb */
+  { &i386_optab[376], &i386_optab[377] }, /* into */
+  { NULL, NULL },
+  { &i386_optab[2785], &i386_optab[2786] }, /* vpcomtrueuq */
+  { &i386_optab[657], &i386_optab[658] }, /* ud2 */
+  { &i386_optab[683], &i386_optab[684] }, /* cmovpo */
+  { &i386_optab[3229], &i386_optab[3230] }, /* kord */
+  { NULL, NULL },
+  { &i386_optab[2361], &i386_optab[2363] }, /* vpsubsb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1963], &i386_optab[1965] }, /* vcvttpd2dqy */
+  { &i386_optab[2643], &i386_optab[2645] }, /* vfnmadd231sd */
+  { NULL, NULL },
+  { &i386_optab[1313], &i386_optab[1316] }, /* palignr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3281], &i386_optab[3282] }, /* vpcmpnlew */
+  { &i386_optab[1786], &i386_optab[1788] }, /* vcmpeq_ussd */
+  { &i386_optab[2867], &i386_optab[2868] }, /* pfmul */
+  { &i386_optab[2957], &i386_optab[2958] }, /* kshiftlw */
+  { &i386_optab[3383], &i386_optab[3384] }, /* vrangeps */
+  { NULL, NULL },
+  { &i386_optab[3557], &i386_optab[3558] }, /* vcmpord_qph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2817], &i386_optab[2818] }, /* vpperm */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1616], &i386_optab[1618] }, /* vcmptrue_uspd */
+  { &i386_optab[2619], &i386_optab[2621] }, /* vfmsubadd231pd */
+  { &i386_optab[391], &i386_optab[392] }, /* lsl */
+  { NULL, NULL },
+  { &i386_optab[3243], &i386_optab[3244] }, /* ktestq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1752], &i386_optab[1754] }, /* vcmpfalsesd */
+  { &i386_optab[3175], &i386_optab[3176] }, /* vpbroadcastmb2q */
+  { &i386_optab[1031], &i386_optab[1034] }, /* pmovmskb */
+  { NULL, NULL },
+  { &i386_optab[1682], &i386_optab[1684] }, /* vcmple_oqps */
+  { &i386_optab[3362], &i386_optab[3363] }, /* vextractf64x2 */
+  { &i386_optab[89], &i386_optab[90] }, /* clts */
+  { &i386_optab[2399], &i386_optab[2401] }, /* vshufps */
+  { &i386_optab[1630], &i386_optab[1632] }, /* vcmpunordps */
+  { NULL, NULL },
+  { &i386_optab[3552], &i386_optab[3553] }, /* vcmpnltph */
+  { NULL, NULL },
+  { &i386_optab[1866], &i386_optab[1868] }, /* vcmple_oqss */
+  { &i386_optab[1483], &i386_optab[1485] }, /* pclmullqlqdq */
+  { &i386_optab[2836], &i386_optab[2837] }, /* lwpval */
+  { &i386_optab[3280], &i386_optab[3281] }, /* vpcmpnltw */
+  { &i386_optab[2190], &i386_optab[2194] }, /* vpinsrb */
+  { NULL, NULL },
+  { &i386_optab[297], &i386_optab[298] }, /* setnb */
+  { &i386_optab[3061], &i386_optab[3062] }, /* vinsertf64x4 */
+  { &i386_optab[2958], &i386_optab[2959] }, /* kshiftrw */
+  { &i386_optab[470], &i386_optab[476] }, /* fsubp */
+  { &i386_optab[890], &i386_optab[893] }, /* punpckldq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[424], &i386_optab[425] }, /* fistpll */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3616], &i386_optab[3617] }, /* vcmpgt_ossh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3327], &i386_optab[3328] }, /* vbroadcasti64x2 */
+  { &i386_optab[1041], &i386_optab[1044] }, /* psadbw */
+  { &i386_optab[1451], &i386_optab[1452] }, /* xrstor */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1194], &i386_optab[1196] }, /* cvtss2sd */
+  { &i386_optab[1834], &i386_optab[1836] }, /* vcmpeq_uqss */
+  { NULL, NULL },
+  { &i386_optab[629], &i386_optab[630] }, /* {load} */
+  { &i386_optab[3122], &i386_optab[3125] }, /* vpmovsdw */
+  { &i386_optab[3073], &i386_optab[3074] }, /* vpandnd */
+  { &i386_optab[483], &i386_optab[489] }, /* fsubrp */
+  { &i386_optab[1652], &i386_optab[1654] }, /* vcmpngeps */
+  { &i386_optab[3481], &i386_optab[3482] }, /* vp2intersectd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[585], &i386_optab[586] }, /* fs */
+  { NULL, NULL },
+  { &i386_optab[3194], &i386_optab[3195] }, /* vgatherpf1qpd */
+  { &i386_optab[586], &i386_optab[587] }, /* gs */
+  { &i386_optab[1289], &i386_optab[1292] }, /* phsubd */
+  { &i386_optab[3288], &i386_optab[3289] }, /* vpcmpnleuw */
+  { &i386_optab[2605], &i386_optab[2607] }, /* vfmsub213sd */
+  { &i386_optab[3443], &i386_optab[3445] }, /* rdpid */
+  { &i386_optab[2214], &i386_optab[2216] }, /* vpmaxud */
+  { &i386_optab[584], &i386_optab[585] }, /* es */
+  { &i386_optab[3203], &i386_optab[3204] }, /* vscatterpf0dps */
+  { &i386_optab[2303], &i386_optab[2305] }, /* vpmuludq */
+  { &i386_optab[259], &i386_optab[260] }, /* jne */
+  { &i386_optab[704], &i386_optab[707] }, /* fcomi */
+  { &i386_optab[658], &i386_optab[659] }, /* ud2a */
+  { NULL, NULL },
+  { &i386_optab[2808], &i386_optab[2809] }, /* vpmacssdd */
+  { &i386_optab[3593], &i386_optab[3594] }, /* vcmplesh */
+  { NULL, NULL },
+  { &i386_optab[3219], &i386_optab[3220] }, /* vcvtpd2udqy */
+  { &i386_optab[3149], &i386_optab[3152] }, /* vpmovsqw */
+  { NULL, NULL },
+  { &i386_optab[3234], &i386_optab[3235] }, /* kaddq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1698], &i386_optab[1700] }, /* vcmpngt_uqps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3727], &i386_optab[3728] }, /* vfmsubadd132ph */
+  { &i386_optab[1882], &i386_optab[1884] }, /* vcmpngt_uqss */
+  { NULL, NULL },
+  { &i386_optab[256], &i386_optab[257] }, /* jae */
+  { NULL, NULL },
+  { &i386_optab[533], &i386_optab[534] }, /* fyl2xp1 */
+  { NULL, NULL },
+  { &i386_optab[261], &i386_optab[262] }, /* jbe */
+  { &i386_optab[2929], &i386_optab[2930] }, /* bndmk */
+  { &i386_optab[3091], &i386_optab[3092] }, /* vpcmpnltud */
+  { &i386_optab[2914], &i386_optab[2915] }, /* xsha1 */
+  { &i386_optab[3575], &i386_optab[3576] }, /* vcmpunord_sph */
+  { &i386_optab[1678], &i386_optab[1680] }, /* vcmpeq_osps */
+  { &i386_optab[648], &i386_optab[650] }, /* sysenter */
+  { &i386_optab[2815], &i386_optab[2816] }, /* vpmadcsswd */
+  { &i386_optab[162], &i386_optab[163] }, /* cqto */
+  { &i386_optab[3555], &i386_optab[3556] }, /* vcmpnle_usph */
+  { &i386_optab[1250], &i386_optab[1251] }, /* fisttpll */
+  { &i386_optab[3235], &i386_optab[3236] }, /* kandnq */
+  { &i386_optab[2555], &i386_optab[2557] }, /* vfmadd132pd */
+  { &i386_optab[2799], &i386_optab[2800] }, /* vphadduwq */
+  { &i386_optab[0], &i386_optab[14] }, /* mov */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2966], &i386_optab[2967] }, /* vpermi2pd */
+  { &i386_optab[3718], &i386_optab[3719] }, /* vfmaddsub132ph */
+  { &i386_optab[3080], &i386_optab[3081] }, /* vpcmpd */
+  { &i386_optab[2922], &i386_optab[2923] }, /* xstore */
+  { &i386_optab[2876], &i386_optab[2877] }, /* pfsubr */
+  { &i386_optab[3647], &i386_optab[3648] }, /* vcvtqq2phz */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2741], &i386_optab[2742] }, /* vpcomgtq */
+  { &i386_optab[2880], &i386_optab[2881] }, /* pswapd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[120], &i386_optab[124] }, /* test */
+  { &i386_optab[1750], &i386_optab[1752] }, /* vcmpngt_ussd */
+  { NULL, NULL },
+  { &i386_optab[1712], &i386_optab[1714] }, /* vcmpeq_oqsd */
+  { &i386_optab[1942], &i386_optab[1948] }, /* vcvtsi2sd */
+  { &i386_optab[2993], &i386_optab[2995] }, /* vpscatterdq */
+  { &i386_optab[321], &i386_optab[322] }, /* setg */
+  { &i386_optab[2140], &i386_optab[2143] }, /* vpcmpeqq */
+  { &i386_optab[2770], &i386_optab[2771] }, /* vpcomfalseb */
+  { &i386_optab[3256], &i386_optab[3257] }, /* vpblendmw */
+  { &i386_optab[755], &i386_optab[758] }, /* paddsb */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[982], &i386_optab[984] }, /* movmskps */
+  { &i386_optab[987], &i386_optab[989] }, /* movntdq */
+  { &i386_optab[511], &i386_optab[517] }, /* fdivr */
+  { &i386_optab[3603], &i386_optab[3604] }, /* vcmpordsh */
+  { &i386_optab[3458], &i386_optab[3459] }, /* clrssbsy */
+  { NULL, NULL },
+  { &i386_optab[2127], &i386_optab[2128] }, /* vpandn */
+  { &i386_optab[2389], &i386_optab[2390] }, /* vrcpps */
+  { &i386_optab[1696], &i386_optab[1698] }, /* vcmpnge_uqps */
+  { &i386_optab[3322], &i386_optab[3323] }, /* vbroadcastf32x2 */
+  { &i386_optab[2869], &i386_optab[2870] }, /* pfpnacc */
+  { &i386_optab[603], &i386_optab[604] }, /* rex64 */
+  { &i386_optab[2923], &i386_optab[2924] }, /* adcx */
+  { NULL, NULL },
+  { &i386_optab[2395], &i386_optab[2396] }, /* vrsqrtps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[878], &i386_optab[881] }, /* punpckhwd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2540], &i386_optab[2541] }, /* rdfsbase */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3012], &i386_optab[3013] }, /* vcvtps2udq */
+  { &i386_optab[1746], &i386_optab[1748] }, /* vcmpnge_ussd */
+  { &i386_optab[3760], &i386_optab[3761] }, /* vmulsh */
+  { NULL, NULL },
+  { &i386_optab[2396], &i386_optab[2397] }, /* vrsqrtss */
+  { &i386_optab[1304], &i386_optab[1307] }, /* psignb */
+  { &i386_optab[444], &i386_optab[445] }, /* fucompp */
+  { &i386_optab[1401], &i386_optab[1403] }, /* pmovsxwd */
+  { &i386_optab[1205], &i386_optab[1207] }, /* movdqa */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1824], &i386_optab[1826] }, /* vcmpnlt_usss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2973], &i386_optab[2974] }, /* vpminuq */
+  { NULL, NULL },
+  { &i386_optab[1487], &i386_optab[1489] }, /* pclmullqhqdq */
+  { &i386_optab[3588], &i386_optab[3589] }, /* vcmpph */
+  { &i386_optab[136], &i386_optab[137] }, /* clr */
+  { &i386_optab[1640], &i386_optab[1642] }, /* vcmpnlt_usps */
+  { &i386_optab[3578], &i386_optab[3579] }, /* vcmpnle_uqph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2911], &i386_optab[2912] }, /* xcrypt-cfb */
+  { &i386_optab[3183], &i386_optab[3184] }, /* vrcp28pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[154], &i386_optab[155] }, /* cwd */
+  { &i386_optab[3773], &i386_optab[3774] }, /* vsubph */
+  { NULL, NULL },
+  { &i386_optab[2534], &i386_optab[2536] }, /* vgf2p8affineinvqb */
+  { &i386_optab[1270], &i386_optab[1271] }, /* getsec */
+  { &i386_optab[2728], &i386_optab[2729] }, /* vpcomltud */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2329], &i386_optab[2333] }, /* vpsllw */
+  { &i386_optab[3266], &i386_optab[3267] }, /* vpcmpneqb */
+  { &i386_optab[3100], &i386_optab[3101] }, /* vpcmpequq */
+  { &i386_optab[3049], &i386_optab[3050] }, /* vscalefsd */
+  { &i386_optab[2069], &i386_optab[2071] }, /* vmovshdup */
+  { &i386_optab[3720], &i386_optab[3721] }, /* vfmaddsub231ph */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[401], &i386_optab[403] }, /* str */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2419], &i386_optab[2420] }, /* vtestps */
+  { NULL, NULL },
+  { &i386_optab[144], &i386_optab[145] }, /* aas */
+  { NULL, NULL },
+  { &i386_optab[743], &i386_optab[746] }, /* paddb */
+  { NULL, NULL },
+  { &i386_optab[2782], &i386_optab[2783] }, /* vpcomtrueub */
+  { &i386_optab[1455], &i386_optab[1456] }, /* xsaveopt */
+  { &i386_optab[2708], &i386_optab[2709] }, /* vfnmsubss */
+  { NULL, NULL },
+  { &i386_optab[659], &i386_optab[660] }, /* ud1 */
+  { NULL, NULL },
+  { &i386_optab[1258], &i386_optab[1259] }, /* vmclear */
+  { NULL, NULL },
+  { &i386_optab[247], &i386_optab[249] }, /* leave */
+  { NULL, NULL },
+  { &i386_optab[764], &i386_optab[767] }, /* paddusw */
+  { &i386_optab[1596], &i386_optab[1598] }, /* vcmpnlt_uqpd */
+  { &i386_optab[2706], &i386_optab[2707] }, /* vfnmsubps */
+  { &i386_optab[3296], &i386_optab[3299] }, /* vpmovuswb */
+  { &i386_optab[3716], &i386_optab[3717] }, /* vfmadd213sh */
+  { &i386_optab[2130], &i386_optab[2132] }, /* vpavgw */
+  { &i386_optab[152], &i386_optab[153] }, /* cdqe */
+  { &i386_optab[3033], &i386_optab[3034] }, /* vexpandps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3106], &i386_optab[3107] }, /* vptestmd */
+  { NULL, NULL },
+  { &i386_optab[3212], &i386_optab[3213] }, /* xsaves64 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[860], &i386_optab[863] }, /* psubq */
+  { &i386_optab[1708], &i386_optab[1710] }, /* vcmptrue_usps */
+  { NULL, NULL },
+  { &i386_optab[425], &i386_optab[426] }, /* fstpt */
+  { NULL, NULL },
+  { &i386_optab[568], &i386_optab[569] }, /* ffree */
+  { &i386_optab[403], &i386_optab[404] }, /* verr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3762], &i386_optab[3763] }, /* vreducesh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3646], &i386_optab[3647] }, /* vcvtqq2ph */
+  { &i386_optab[1349], &i386_optab[1351] }, /* mpsadbw */
+  { &i386_optab[3063], &i386_optab[3064] }, /* vmovdqa64 */
+  { &i386_optab[944], &i386_optab[950] }, /* cvtsi2ss */
+  { &i386_optab[2939], &i386_optab[2940] }, /* sha1rnds4 */
+  { &i386_optab[1768], &i386_optab[1770] }, /* vcmptrue_uqsd */
+  { &i386_optab[573], &i386_optab[574] }, /* addr32 */
+  { &i386_optab[2938], &i386_optab[2939] }, /* bndldx */
+  { &i386_optab[298], &i386_optab[299] }, /* setnc */
+  { &i386_optab[2477], &i386_optab[2479] }, /* vpsrlvq */
+  { &i386_optab[3084], &i386_optab[3085] }, /* vpcmpnltd */
+  { &i386_optab[3520], &i386_optab[3521] }, /* aesencwide256kl */
+  { &i386_optab[309], &i386_optab[310] }, /* setns */
+  { &i386_optab[82], &i386_optab[84] }, /* lgs */
+  { &i386_optab[637], &i386_optab[638] }, /* bswap */
+  { &i386_optab[80], &i386_optab[82] }, /* lfs */
+  { &i386_optab[737], &i386_optab[740] }, /* packsswb */
+  { &i386_optab[451], &i386_optab[452] }, /* fldlg2 */
+  { &i386_optab[1088], &i386_optab[1090] }, /* cmpunordpd */
+  { &i386_optab[79], &i386_optab[80] }, /* les */
+  { &i386_optab[2776], &i386_optab[2777] }, /* vpcomfalseud */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2951], &i386_optab[2952] }, /* kxorw */
+  { NULL, NULL },
+  { &i386_optab[2633], &i386_optab[2635] }, /* vfnmadd132ps */
+  { &i386_optab[2851], &i386_optab[2852] }, /* blsic */
+  { &i386_optab[128], &i386_optab[132] }, /* or */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2645], &i386_optab[2647] }, /* vfnmadd132ss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[959], &i386_optab[961] }, /* ldmxcsr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2990], &i386_optab[2991] }, /* vcompressps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2216], &i386_optab[2218] }, /* vpmaxuw */
+  { NULL, NULL },
+  { &i386_optab[3529], &i386_optab[3530] }, /* testui */
+  { NULL, NULL },
+  { &i386_optab[2230], &i386_optab[2231] }, /* vpmovmskb */
+  { &i386_optab[254], &i386_optab[255] }, /* jnb */
+  { &i386_optab[3195], &i386_optab[3196] }, /* vscatterpf0dpd */
+  { &i386_optab[365], &i386_optab[367] }, /* bt */
+  { &i386_optab[1792], &i386_optab[1794] }, /* vcmpfalse_ossd */
+  { &i386_optab[2210], &i386_optab[2212] }, /* vpmaxsw */
+  { &i386_optab[2752], &i386_optab[2753] }, /* vpcomgeud */
+  { &i386_optab[1265], &i386_optab[1267] }, /* vmwrite */
+  { &i386_optab[656], &i386_optab[657] }, /* rdpmc */
+  { &i386_optab[791], &i386_optab[794] }, /* pmaddwd */
+  { NULL, NULL },
+  { &i386_optab[3218], &i386_optab[3219] }, /* vcvtpd2udqx */
+  { &i386_optab[3140], &i386_optab[3143] }, /* vpmovsqd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2351], &i386_optab[2355] }, /* vpsrlw */
+  { &i386_optab[562], &i386_optab[563] }, /* feni */
+  { &i386_optab[3430], &i386_optab[3431] }, /* vpshufbitqmb */
+  { NULL, NULL },
+  { &i386_optab[1606], &i386_optab[1608] }, /* vcmpngt_uqpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3506], &i386_optab[3507] }, /* tileloadd */
+  { &i386_optab[2337], &i386_optab[2341] }, /* vpsraw */
+  { &i386_optab[2755], &i386_optab[2756] }, /* vpcomeqw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2571], &i386_optab[2573] }, /* vfmadd231sd */
+  { &i386_optab[1165], &i386_optab[1167] }, /* subpd */
+  { &i386_optab[2012], &i386_optab[2014] }, /* vminsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3200], &i386_optab[3201] }, /* vgatherpf0qps */
+  { &i386_optab[3221], &i386_optab[3222] }, /* vcvttpd2udqy */
+  { &i386_optab[3287], &i386_optab[3288] }, /* vpcmpnltuw */
+  { &i386_optab[1333], &i386_optab[1337] }, /* blendvps */
+  { &i386_optab[3216], &i386_optab[3217] }, /* enclu */
+  { NULL, NULL },
+  { &i386_optab[2430], &i386_optab[2432] }, /* vunpcklps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3619], &i386_optab[3620] }, /* vcmpeq_ossh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[571], &i386_optab[572] }, /* fwait */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2980], &i386_optab[2981] }, /* vpermi2ps */
+  { &i386_optab[1495], &i386_optab[1497] }, /* gf2p8mulb */
+  { &i386_optab[2714], &i386_optab[2715] }, /* vpcomb */
+  { &i386_optab[1051], &i386_optab[1053] }, /* rsqrtss */
+  { &i386_optab[3434], &i386_optab[3436] }, /* clzero */
+  { &i386_optab[1704], &i386_optab[1706] }, /* vcmpge_oqps */
+  { &i386_optab[3304], &i386_optab[3305] }, /* vptestnmb */
+  { NULL, NULL },
+  { &i386_optab[1399], &i386_optab[1401] }, /* pmovsxbq */
+  { &i386_optab[635], &i386_optab[636] }, /* {rex} */
+  { &i386_optab[1108], &i386_optab[1110] }, /* cmpnltsd */
+  { &i386_optab[3613], &i386_optab[3614] }, /* vcmpgesh */
+  { &i386_optab[3746], &i386_optab[3747] }, /* vfpclasssh */
+  { &i386_optab[3589], &i386_optab[3590] }, /* vcmpeqsh */
+  { &i386_optab[2847], &i386_optab[2848] }, /* blcic */
+  { &i386_optab[1450], &i386_optab[1451] }, /* xsave64 */
+  { &i386_optab[1842], &i386_optab[1844] }, /* vcmpngt_usss */
+  { &i386_optab[2102], &i386_optab[2104] }, /* vpacksswb */
+  { &i386_optab[2830], &i386_optab[2831] }, /* vpshlb */
+  { &i386_optab[2861], &i386_optab[2862] }, /* pfadd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2978], &i386_optab[2979] }, /* vpblendmd */
+  { &i386_optab[3363], &i386_optab[3364] }, /* vextracti64x2 */
+  { NULL, NULL },
+  { &i386_optab[320], &i386_optab[321] }, /* setnle */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2696], &i386_optab[2697] }, /* vfmsubaddps */
+  { &i386_optab[3077], &i386_optab[3078] }, /* vpandq */
+  { &i386_optab[2405], &i386_optab[2407] }, /* vsqrtsd */
+  { &i386_optab[3286], &i386_optab[3287] }, /* vpcmpnequw */
+  { &i386_optab[534], &i386_optab[535] }, /* fsqrt */
+  { &i386_optab[1902], &i386_optab[1904] }, /* vcomisd */
+  { NULL, NULL },
+  { &i386_optab[2694], &i386_optab[2695] }, /* vfmaddsubps */
+  { &i386_optab[2581], &i386_optab[2583] }, /* vfmaddsub213pd */
+  { &i386_optab[3056], &i386_optab[3057] }, /* vrndscalepd */
+  { &i386_optab[684], &i386_optab[685] }, /* cmovl */
+  { NULL, NULL },
+  { &i386_optab[315], &i386_optab[316] }, /* setnge */
+  { &i386_optab[3766], &i386_optab[3767] }, /* vrcpsh */
+  { &i386_optab[3628], &i386_optab[3629] }, /* vcmpnge_uqsh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1754], &i386_optab[1756] }, /* vcmpfalse_oqsd */
+  { &i386_optab[621], &i386_optab[622] }, /* rex.wxb */
+  { NULL, NULL },
+  { &i386_optab[2394], &i386_optab[2395] }, /* vroundss */
+  { NULL, NULL },
+  { &i386_optab[2392], &i386_optab[2393] }, /* vroundps */
+  { &i386_optab[1056], &i386_optab[1058] }, /* sqrtps */
+  { &i386_optab[1228], &i386_optab[1230] }, /* addsubpd */
+  { &i386_optab[2945], &i386_optab[2946] }, /* sha256msg1 */
+  { &i386_optab[2763], &i386_optab[2764] }, /* vpcomneqw */
+  { &i386_optab[2591], &i386_optab[2593] }, /* vfmsub132pd */
+  { &i386_optab[2106], &i386_optab[2108] }, /* vpackuswb */
+  { &i386_optab[776], &i386_optab[779] }, /* pcmpeqw */
+  { &i386_optab[1058], &i386_optab[1060] }, /* sqrtss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1732], &i386_optab[1734] }, /* vcmpnlt_ussd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2202], &i386_optab[2204] }, /* vpmaddubsw */
+  { &i386_optab[290], &i386_optab[292] }, /* loopne */
+  { NULL, NULL },
+  { &i386_optab[3448], &i386_optab[3449] }, /* incsspq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3186], &i386_optab[3187] }, /* vrsqrt28ps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[414], &i386_optab[417] }, /* fst */
+  { &i386_optab[447], &i386_optab[448] }, /* fld1 */
+  { &i386_optab[3467], &i386_optab[3469] }, /* umwait */
+  { NULL, NULL },
+  { &i386_optab[2220], &i386_optab[2222] }, /* vpminsd */
+  { &i386_optab[3617], &i386_optab[3618] }, /* vcmptruesh */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[546], &i386_optab[547] }, /* fstcw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3534], &i386_optab[3535] }, /* vfcmaddcph */
+  { &i386_optab[618], &i386_optab[619] }, /* rex.w */
+  { NULL, NULL },
+  { &i386_optab[3391], &i386_optab[3392] }, /* vpmadd52luq */
+  { &i386_optab[3673], &i386_optab[3676] }, /* vcvtph2uqq */
+  { &i386_optab[2711], &i386_optab[2712] }, /* vfrczsd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[655], &i386_optab[656] }, /* fxrstor64 */
+  { &i386_optab[2000], &i386_optab[2002] }, /* vmaxpd */
+  { NULL, NULL },
+  { &i386_optab[918], &i386_optab[920] }, /* cmpordps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3429], &i386_optab[3430] }, /* vpopcntw */
+  { NULL, NULL },
+  { &i386_optab[661], &i386_optab[662] }, /* ud0 */
+  { &i386_optab[3313], &i386_optab[3314] }, /* korb */
+  { &i386_optab[619], &i386_optab[620] }, /* rex.wb */
+  { &i386_optab[622], &i386_optab[623] }, /* rex.wr */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1872], &i386_optab[1874] }, /* vcmpnlt_uqss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3031], &i386_optab[3032] }, /* vexpandpd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1413], &i386_optab[1415] }, /* pmovzxwd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2844], &i386_optab[2845] }, /* tzcnt */
+  { &i386_optab[550], &i386_optab[553] }, /* fstsw */
+  { &i386_optab[3645], &i386_optab[3646] }, /* vcvtudq2phy */
+  { &i386_optab[3210], &i386_optab[3211] }, /* xrstors64 */
+  { &i386_optab[1602], &i386_optab[1604] }, /* vcmpeq_uspd */
+  { &i386_optab[2780], &i386_optab[2781] }, /* vpcomtrued */
+  { NULL, NULL },
+  { &i386_optab[1967], &i386_optab[1969] }, /* vcvttsd2si */
+  { &i386_optab[1911], &i386_optab[1913] }, /* vcvtdq2ps */
+  { &i386_optab[2701], &i386_optab[2702] }, /* vfnmaddpd */
+  { &i386_optab[851], &i386_optab[854] }, /* psubb */
+  { &i386_optab[3634], &i386_optab[3635] }, /* vcmptrue_ussh */
+  { &i386_optab[3319], &i386_optab[3320] }, /* ktestw */
+  { NULL, NULL },
+  { &i386_optab[3412], &i386_optab[3413] }, /* vpshldvw */
+  { NULL, NULL },
+  { &i386_optab[1680], &i386_optab[1682] }, /* vcmplt_oqps */
+  { &i386_optab[3324], &i386_optab[3325] }, /* vbroadcasti32x2 */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3023], &i386_optab[3024] }, /* vcvtss2usi */
+  { &i386_optab[158], &i386_optab[159] }, /* cltq */
+  { &i386_optab[3197], &i386_optab[3198] }, /* vscatterpf1dpd */
+  { &i386_optab[1568], &i386_optab[1570] }, /* vcmpfalsepd */
+  { &i386_optab[3057], &i386_optab[3058] }, /* vgetmantps */
+  { &i386_optab[3708], &i386_optab[3709] }, /* vcvttsh2si */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[724], &i386_optab[725] }, /* lfence */
+  { &i386_optab[3045], &i386_optab[3046] }, /* vgetmantss */
+  { &i386_optab[1990], &i386_optab[1991] }, /* vinsertf128 */
+  { &i386_optab[2483], &i386_optab[2488] }, /* vgatherdps */
+  { &i386_optab[2742], &i386_optab[2743] }, /* vpcomgtub */
+  { &i386_optab[3251], &i386_optab[3252] }, /* kshiftrq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2148], &i386_optab[2150] }, /* vpcmpestrm */
+  { NULL, NULL },
+  { &i386_optab[1114], &i386_optab[1116] }, /* cmppd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1692], &i386_optab[1694] }, /* vcmpord_sps */
+  { NULL, NULL },
+  { &i386_optab[2627], &i386_optab[2629] }, /* vfnmadd132pd */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[257], &i386_optab[258] }, /* je */
+  { &i386_optab[3196], &i386_optab[3197] }, /* vscatterpf0qpd */
+  { &i386_optab[3180], &i386_optab[3181] }, /* vplzcntq */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[2885], &i386_optab[2886] }, /* clgi */
+  { NULL, NULL },
+  { &i386_optab[2940], &i386_optab[2941] }, /* sha1nexte */
+  { NULL, NULL },
+  { &i386_optab[369], &i386_optab[371] }, /* btr */
+  { &i386_optab[532], &i386_optab[533] }, /* fprem */
+  { &i386_optab[2593], &i386_optab[2595] }, /* vfmsub213pd */
+  { &i386_optab[2998], &i386_optab[3000] }, /* vscatterdpd */
+  { &i386_optab[3105], &i386_optab[3106] }, /* vpcmpnleuq */
+  { &i386_optab[1491], &i386_optab[1493] }, /* gf2p8affineqb */
+  { &i386_optab[266], &i386_optab[267] }, /* jns */
+  { &i386_optab[1000], &i386_optab[1003] }, /* pavgb */
+  { &i386_optab[1700], &i386_optab[1702] }, /* vcmpfalse_osps */
+  { NULL, NULL },
+  { &i386_optab[2868], &i386_optab[2869] }, /* pfnacc */
+  { &i386_optab[2853], &i386_optab[2854] }, /* tzmsk */
+  { &i386_optab[255], &i386_optab[256] }, /* jnc */
+  { NULL, NULL },
+  { &i386_optab[3318], &i386_optab[3319] }, /* kaddw */
+  { NULL, NULL },
+  { &i386_optab[898], &i386_optab[900] }, /* addss */
+  { NULL, NULL },
+  { &i386_optab[1044], &i386_optab[1045] }, /* pshufw */
+  { &i386_optab[3546], &i386_optab[3547] }, /* vcmpleph */
+  { &i386_optab[2601], &i386_optab[2603] }, /* vfmsub231ps */
+  { &i386_optab[3285], &i386_optab[3286] }, /* vpcmpleuw */
+  { &i386_optab[389], &i386_optab[390] }, /* lldt */
+  { &i386_optab[1503], &i386_optab[1505] }, /* vaddss */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[1499], &i386_optab[1501] }, /* vaddps */
+  { NULL, NULL },
+  { &i386_optab[2081], &i386_optab[2082] }, /* vmpsadbw */
+  { &i386_optab[2947], &i386_optab[2948] }, /* kandnw */
+  { &i386_optab[330], &i386_optab[332] }, /* ins */
+  { &i386_optab[104], &i386_optab[106] }, /* inc */
+  { NULL, NULL },
+  { &i386_optab[2577], &i386_optab[2579] }, /* vfmadd231ss */
+  { &i386_optab[3220], &i386_optab[3221] }, /* vcvttpd2udqx */
+  { NULL, NULL },
+  { &i386_optab[3519], &i386_optab[3520] }, /* aesdecwide128kl */
+  { &i386_optab[1475], &i386_optab[1478] }, /* vaesenc */
+  { &i386_optab[2567], &i386_optab[2569] }, /* vfmadd132sd */
+  { NULL, NULL },
+  { &i386_optab[2493], &i386_optab[2498] }, /* vgatherqps */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3622], &i386_optab[3623] }, /* vcmpunord_ssh */
+  { &i386_optab[2948], &i386_optab[2949] }, /* kandw */
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[243], &i386_optab[245] }, /* retf */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3632], &i386_optab[3633] }, /* vcmpge_oqsh */
+  { &i386_optab[463], &i386_optab[469] }, /* fsub */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[3075], &i386_optab[3076] }, /* vpxord */
+  { NULL, NULL },
+  { NULL, NULL },
+  { NULL, NULL },
+  { &i386_optab[525], &i386_optab[526] }, /* fyl2x */
+  { NULL, NULL },
+  { &i386_optab[556], &i386_optab[557] }, /* fstenv */
+  { NULL, NULL },
+  { &i386_optab[2772], &i386_optab[2773] }, /* vpcomfalsed */
+  { &i386_optab[300], &i386_optab[301] }, /* sete */
+  { &i386_optab[2810], &i386_optab[2811] }, /* vpmacssdql */
+  { &i386_optab[3562], &i386_optab[3563] }, /* vcmpngt_usph */
+  { &i386_optab[1528], &i386_optab[1530] }, /* vcmpeq_oqpd */
+};
+
 /* i386 register table.  */
 
 const reg_entry i386_regtab[] =
@@ -997,6 +997,88 @@ print_insn_riscv (bfd_vma memaddr, struct disassemble_info *info)
   return (*riscv_disassembler) (memaddr, insn, info);
 }
 
+/* Like print_insn_riscv, but only work out the length of the instruction
+   at MEMADDR and where it branches to, and print nothing.  Mapping symbols
+   are not consulted; the bytes at MEMADDR are always taken to be an
+   instruction, and no target is recorded for indirect jumps.  Return the
+   length of the instruction, or -1 on error.  */
+
+int
+length_insn_riscv (bfd_vma memaddr, struct disassemble_info *info)
+{
+  bfd_byte packet[8];
+  insn_t insn;
+  int insnlen, status;
+
+  status = (*info->read_memory_func) (memaddr, packet, 2, info);
+  if (status == 0)
+    {
+      insnlen = riscv_insn_length (bfd_getl16 (packet));
+      status = (*info->read_memory_func) (memaddr, packet, insnlen, info);
+    }
+  if (status != 0)
+    {
+      (*info->memory_error_func) (status, memaddr, info);
+      return -1;
+    }
+  insn = (insn_t) bfd_get_bits (packet, insnlen * 8, false);
+
+  info->insn_info_valid = 1;
+  info->branch_delay_insns = 0;
+  info->data_size = 0;
+  info->insn_type = dis_nonbranch;
+  info->target = 0;
+  info->target2 = 0;
+
+  if (insnlen == 4)
+    {
+      if ((insn & MASK_JAL) == MATCH_JAL)
+	{
+	  info->insn_type = (EXTRACT_OPERAND (RD, insn) == 0
+			     ? dis_branch : dis_jsr);
+	  info->target = EXTRACT_JTYPE_IMM (insn) + memaddr;
+	}
+      else if ((insn & MASK_JALR) == MATCH_JALR)
+	info->insn_type = (EXTRACT_OPERAND (RD, insn) == 0
+			   ? dis_branch : dis_jsr);
+      else if ((insn & OP_MASK_OP) == (MATCH_BEQ & OP_MASK_OP)
+	       && ((insn & MASK_BEQ) != (MATCH_BEQ | (2 << 12)))
+	       && ((insn & MASK_BEQ) != (MATCH_BEQ | (3 << 12))))
+	{
+	  info->insn_type = dis_condbranch;
+	  info->target = EXTRACT_BTYPE_IMM (insn) + memaddr;
+	}
+    }
+  else if (insnlen == 2)
+    {
+      if ((insn & MASK_C_J) == MATCH_C_J)
+	{
+	  info->insn_type = dis_branch;
+	  info->target = EXTRACT_CJTYPE_IMM (insn) + memaddr;
+	}
+      else if ((insn & MASK_C_JAL) == MATCH_C_JAL
+	       && info->mach == bfd_mach_riscv32)
+	{
+	  info->insn_type = dis_jsr;
+	  info->target = EXTRACT_CJTYPE_IMM (insn) + memaddr;
+	}
+      else if ((insn & MASK_C_BEQZ) == MATCH_C_BEQZ
+	       || (insn & MASK_C_BNEZ) == MATCH_C_BNEZ)
+	{
+	  info->insn_type = dis_condbranch;
+	  info->target = EXTRACT_CBTYPE_IMM (insn) + memaddr;
+	}
+      /* The rs1 field of c.jr and c.jalr is where rd usually is.  */
+      else if (EXTRACT_OPERAND (RD, insn) != 0
+	       && ((insn & MASK_C_JR) == MATCH_C_JR
+		   || (insn & MASK_C_JALR) == MATCH_C_JALR))
+	info->insn_type = ((insn & MASK_C_JR) == MATCH_C_JR
+			   ? dis_branch : dis_jsr);
+    }
+
+  return insnlen;
+}
+
 disassembler_ftype
 riscv_get_disassembler (bfd *abfd)
 {
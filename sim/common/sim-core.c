@@ -167,6 +167,37 @@ new_sim_core_mapping (SIM_DESC sd,
 #endif
 
 
+/* Recompute the shadowed flag of every mapping in ACCESS_MAP and drop
+   the cached lookup.  Called whenever the list changes.  */
+
+#if EXTERN_SIM_CORE_P
+static void
+sim_core_map_update (sim_core_map *access_map)
+{
+  sim_core_mapping *mapping;
+  access_map->last = NULL;
+  for (mapping = access_map->first;
+       mapping != NULL;
+       mapping = mapping->next)
+    {
+      sim_core_mapping *prev;
+      mapping->shadowed = 0;
+      for (prev = access_map->first;
+	   prev != mapping;
+	   prev = prev->next)
+	{
+	  if (prev->base <= mapping->bound
+	      && prev->bound >= mapping->base)
+	    {
+	      mapping->shadowed = 1;
+	      break;
+	    }
+	}
+    }
+}
+#endif
+
+
 #if EXTERN_SIM_CORE_P
 static void
 sim_core_map_attach (SIM_DESC sd,
@@ -245,6 +276,7 @@ sim_core_map_attach (SIM_DESC sd,
 					space, addr, nr_bytes, modulo,
 					client, buffer, free_buffer);
   (*last_mapping)->next = next_mapping;
+  sim_core_map_update (access_map);
 }
 #endif
 
@@ -382,6 +414,7 @@ sim_core_map_detach (SIM_DESC sd,
 	  if (dead->free_buffer != NULL)
 	    free (dead->free_buffer);
 	  free (dead);
+	  sim_core_map_update (access_map);
 	  return;
 	}
     }
@@ -428,15 +461,29 @@ sim_core_find_mapping (sim_core_common *core,
 		       sim_cpu *cpu, /* abort => cpu != NULL */
 		       sim_cia cia)
 {
-  sim_core_mapping *mapping = core->map[map].first;
+  sim_core_mapping *mapping = core->map[map].last;
   ASSERT ((addr & (nr_bytes - 1)) == 0); /* must be aligned */
   ASSERT ((addr + (nr_bytes - 1)) >= addr); /* must not wrap */
   ASSERT (!abort || cpu != NULL); /* abort needs a non null CPU */
+  /* Nothing precedes an unshadowed mapping over its own range, so if
+     the last one found covers ADDR it is also the first in the list
+     that does.  */
+  if (mapping != NULL
+      && addr >= mapping->base
+      && (addr + (nr_bytes - 1)) <= mapping->bound)
+    return mapping;
+  if (abort)
+    PROFILE_COUNT_CORE_MISS (cpu, map);
+  mapping = core->map[map].first;
   while (mapping != NULL)
     {
       if (addr >= mapping->base
 	  && (addr + (nr_bytes - 1)) <= mapping->bound)
-	return mapping;
+	{
+	  if (!mapping->shadowed)
+	    core->map[map].last = mapping;
+	  return mapping;
+	}
       mapping = mapping->next;
     }
   if (abort)
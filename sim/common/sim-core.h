@@ -60,6 +60,9 @@ struct _sim_core_mapping {
   struct hw *device;
   /* tracing */
   int trace;
+  /* set when a mapping earlier in the list overlaps this one, so
+     that an address inside it may still resolve elsewhere */
+  int shadowed;
   /* growth */
   sim_core_mapping *next;
 };
@@ -67,6 +70,8 @@ struct _sim_core_mapping {
 typedef struct _sim_core_map sim_core_map;
 struct _sim_core_map {
   sim_core_mapping *first;
+  /* the last unshadowed mapping found, tried before the list */
+  sim_core_mapping *last;
 };
 
 
@@ -908,6 +908,7 @@ static void
 profile_print_core (sim_cpu *cpu, int verbose)
 {
   unsigned int total;
+  unsigned int misses;
   unsigned int max_val;
   /* FIXME: Need to add smp support.  */
   SIM_DESC sd = CPU_STATE (cpu);
@@ -920,10 +921,12 @@ profile_print_core (sim_cpu *cpu, int verbose)
   {
     unsigned map;
     total = 0;
+    misses = 0;
     max_val = 0;
     for (map = 0; map < nr_maps; map++)
       {
 	total += PROFILE_CORE_COUNT (data) [map];
+	misses += PROFILE_CORE_MISS_COUNT (data) [map];
 	if (PROFILE_CORE_COUNT (data) [map] > max_val)
 	  max_val = PROFILE_CORE_COUNT (data) [map];
       }
@@ -932,6 +935,12 @@ profile_print_core (sim_cpu *cpu, int verbose)
   /* One could use PROFILE_LABEL_WIDTH here.  I chose not to.  */
   profile_printf (sd, cpu, "  Total:  %s accesses\n",
 		  COMMAS (total));
+  profile_printf (sd, cpu, "  Misses: %s map lookups",
+		  COMMAS (misses));
+  if (total != 0 && misses <= total)
+    profile_printf (sd, cpu, " (%.2f%% hit rate)",
+		    100.0 * (total - misses) / total);
+  profile_printf (sd, cpu, "\n");
 
   if (verbose && max_val != 0)
     {
@@ -160,6 +160,9 @@ typedef struct {
   /* Count read/write/exec accesses separatly. */
   unsigned int core_count[nr_maps];
 #define PROFILE_CORE_COUNT(p) ((p)->core_count)
+  /* Accesses whose mapping was not the cached one.  */
+  unsigned int core_miss_count[nr_maps];
+#define PROFILE_CORE_MISS_COUNT(p) ((p)->core_miss_count)
 #endif
 
 #if WITH_PROFILE_MODEL_P
@@ -276,8 +279,14 @@ do { \
   if (PROFILE_CORE_P (cpu)) \
     PROFILE_CORE_COUNT (CPU_PROFILE_DATA (cpu)) [map] += 1; \
 } while (0)
+#define PROFILE_COUNT_CORE_MISS(cpu, map) \
+do { \
+  if (PROFILE_CORE_P (cpu)) \
+    PROFILE_CORE_MISS_COUNT (CPU_PROFILE_DATA (cpu)) [map] += 1; \
+} while (0)
 #else
 #define PROFILE_COUNT_CORE(cpu, addr, size, map)
+#define PROFILE_COUNT_CORE_MISS(cpu, map)
 #endif /* ! core */
 
 #if WITH_PROFILE_MODEL_P